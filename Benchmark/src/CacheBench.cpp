@@ -0,0 +1,117 @@
+//
+// CacheBench.cpp
+//
+// Benchmarks for LRUCache and ConcurrentCache
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/LRUCache.h"
+#include "Poco/ConcurrentCache.h"
+
+
+using Poco::LRUCache;
+using Poco::ConcurrentCache;
+using Poco::SharedPtr;
+
+
+namespace {
+
+
+const int CACHE_SIZE = 100000;
+const int KEY_COUNT = 50000;
+
+
+template <class C>
+C& populatedCache()
+{
+	static C* pCache = []()
+		{
+			C* pCache = new C(CACHE_SIZE);
+			for (int i = 0; i < KEY_COUNT; ++i) pCache->add(i, i);
+			return pCache;
+		}();
+	return *pCache;
+}
+
+
+//
+// Multi-threaded lookups of existing keys
+//
+// Naming: BM_<Cache>_Get
+//
+
+static void BM_LRUCache_Get(benchmark::State& state)
+{
+	auto& cache = populatedCache<LRUCache<int, int>>();
+	int key = state.thread_index()*7919;
+
+	for (auto _ : state)
+	{
+		SharedPtr<int> pValue = cache.get(key % KEY_COUNT);
+		benchmark::DoNotOptimize(pValue);
+		key += 31;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LRUCache_Get)->ThreadRange(1, 8)->UseRealTime();
+
+
+static void BM_ConcurrentCache_Get(benchmark::State& state)
+{
+	auto& cache = populatedCache<ConcurrentCache<int, int>>();
+	int key = state.thread_index()*7919;
+
+	for (auto _ : state)
+	{
+		SharedPtr<int> pValue = cache.get(key % KEY_COUNT);
+		benchmark::DoNotOptimize(pValue);
+		key += 31;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentCache_Get)->ThreadRange(1, 8)->UseRealTime();
+
+
+//
+// Mixed workload: 90% lookups, 10% insertions of new keys
+//
+
+static void BM_LRUCache_Mixed(benchmark::State& state)
+{
+	static LRUCache<int, int> cache(CACHE_SIZE/10);
+	int key = state.thread_index()*7919;
+
+	for (auto _ : state)
+	{
+		if (key % 10 == 0) cache.add(key % KEY_COUNT, key);
+		else benchmark::DoNotOptimize(cache.get(key % KEY_COUNT));
+		key += 31;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LRUCache_Mixed)->ThreadRange(1, 8)->UseRealTime();
+
+
+static void BM_ConcurrentCache_Mixed(benchmark::State& state)
+{
+	static ConcurrentCache<int, int> cache(CACHE_SIZE/10);
+	int key = state.thread_index()*7919;
+
+	for (auto _ : state)
+	{
+		if (key % 10 == 0) cache.add(key % KEY_COUNT, key);
+		else benchmark::DoNotOptimize(cache.get(key % KEY_COUNT));
+		key += 31;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentCache_Mixed)->ThreadRange(1, 8)->UseRealTime();
+
+
+} // namespace
@@ -0,0 +1,166 @@
+//
+// CodecBench.cpp
+//
+// Benchmarks for the Base64, Base32 and HexBinary codecs
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Base64.h"
+#include "Poco/Base64Encoder.h"
+#include "Poco/Base64Decoder.h"
+#include "Poco/Base32.h"
+#include "Poco/HexBinary.h"
+#include "Poco/StreamCopier.h"
+#include <sstream>
+#include <string>
+
+
+namespace {
+
+
+std::string makeData(std::size_t length)
+{
+	std::string data(length, '\0');
+	unsigned seed = 12345;
+	for (auto& c: data)
+	{
+		seed = seed*1103515245 + 12345;
+		c = static_cast<char>(seed >> 16);
+	}
+	return data;
+}
+
+
+//
+// Naming: BM_<Codec>_<Operation>
+//
+
+static void BM_Base64_Encode(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::Base64::encode(data));
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_Base64_Encode)->Arg(64)->Arg(4096)->Arg(1 << 20);
+
+
+static void BM_Base64_Decode(benchmark::State& state)
+{
+	const std::string encoded = Poco::Base64::encode(makeData(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::Base64::decode(encoded));
+	}
+	state.SetBytesProcessed(state.iterations()*encoded.size());
+}
+BENCHMARK(BM_Base64_Decode)->Arg(64)->Arg(4096)->Arg(1 << 20);
+
+
+static void BM_Base64_DecodeURL(benchmark::State& state)
+{
+	const int options = Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING;
+	const std::string encoded = Poco::Base64::encode(makeData(state.range(0)), options);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::Base64::decode(encoded, options));
+	}
+	state.SetBytesProcessed(state.iterations()*encoded.size());
+}
+BENCHMARK(BM_Base64_DecodeURL)->Arg(64)->Arg(4096);
+
+
+static void BM_Base64_EncoderStream(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	for (auto _ : state)
+	{
+		std::ostringstream ostr;
+		Poco::Base64Encoder encoder(ostr);
+		encoder.write(data.data(), data.size());
+		encoder.close();
+		benchmark::DoNotOptimize(ostr.str());
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_Base64_EncoderStream)->Arg(4096)->Arg(1 << 20);
+
+
+static void BM_Base64_DecoderStream(benchmark::State& state)
+{
+	std::ostringstream ostr;
+	Poco::Base64Encoder encoder(ostr);
+	const std::string data = makeData(state.range(0));
+	encoder.write(data.data(), data.size());
+	encoder.close();
+	const std::string encoded = ostr.str();
+	for (auto _ : state)
+	{
+		std::istringstream istr(encoded);
+		Poco::Base64Decoder decoder(istr);
+		std::string result;
+		Poco::StreamCopier::copyToString(decoder, result);
+		benchmark::DoNotOptimize(result);
+	}
+	state.SetBytesProcessed(state.iterations()*encoded.size());
+}
+BENCHMARK(BM_Base64_DecoderStream)->Arg(4096)->Arg(1 << 20);
+
+
+static void BM_Base32_Encode(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::Base32::encode(data));
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_Base32_Encode)->Arg(4096);
+
+
+static void BM_Base32_Decode(benchmark::State& state)
+{
+	const std::string encoded = Poco::Base32::encode(makeData(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::Base32::decode(encoded));
+	}
+	state.SetBytesProcessed(state.iterations()*encoded.size());
+}
+BENCHMARK(BM_Base32_Decode)->Arg(4096);
+
+
+static void BM_HexBinary_Encode(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::HexBinary::encode(data));
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_HexBinary_Encode)->Arg(4096);
+
+
+static void BM_HexBinary_Decode(benchmark::State& state)
+{
+	const std::string encoded = Poco::HexBinary::encode(makeData(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::HexBinary::decode(encoded));
+	}
+	state.SetBytesProcessed(state.iterations()*encoded.size());
+}
+BENCHMARK(BM_HexBinary_Decode)->Arg(4096);
+
+
+} // namespace
@@ -0,0 +1,121 @@
+//
+// DigestBench.cpp
+//
+// Benchmarks for the checksum and message digest engines
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Checksum.h"
+#include "Poco/MD5Engine.h"
+#include "Poco/SHA1Engine.h"
+#include "Poco/SHA2Engine.h"
+#include "Poco/HMACEngine.h"
+#include <string>
+#include <vector>
+
+
+namespace {
+
+
+std::string makeData(std::size_t length)
+{
+	std::string data(length, '\0');
+	unsigned seed = 12345;
+	for (auto& c: data)
+	{
+		seed = seed*1103515245 + 12345;
+		c = static_cast<char>(seed >> 16);
+	}
+	return data;
+}
+
+
+//
+// Naming: BM_<Algorithm>_<Variant>
+//
+
+static void BM_Checksum(benchmark::State& state, Poco::Checksum::Type type)
+{
+	const std::string data = makeData(state.range(0));
+	for (auto _ : state)
+	{
+		Poco::Checksum checksum(type);
+		checksum.update(data);
+		benchmark::DoNotOptimize(checksum.checksum());
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK_CAPTURE(BM_Checksum, CRC32, Poco::Checksum::TYPE_CRC32)->Arg(64)->Arg(65536);
+BENCHMARK_CAPTURE(BM_Checksum, CRC32C, Poco::Checksum::TYPE_CRC32C)->Arg(64)->Arg(65536);
+BENCHMARK_CAPTURE(BM_Checksum, Adler32, Poco::Checksum::TYPE_ADLER32)->Arg(64)->Arg(65536);
+
+
+template <class Engine>
+static void BM_Digest(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	Engine engine;
+	for (auto _ : state)
+	{
+		engine.update(data);
+		benchmark::DoNotOptimize(engine.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK_TEMPLATE(BM_Digest, Poco::MD5Engine)->Arg(64)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Digest, Poco::SHA1Engine)->Arg(64)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Digest, Poco::SHA2Engine256)->Arg(64)->Arg(65536);
+BENCHMARK_TEMPLATE(BM_Digest, Poco::SHA2Engine512)->Arg(64)->Arg(65536);
+
+
+static void BM_HMAC_SHA256(benchmark::State& state)
+{
+	const std::string data = makeData(state.range(0));
+	Poco::HMACEngine<Poco::SHA2Engine256> hmac("secret key");
+	for (auto _ : state)
+	{
+		hmac.update(data);
+		benchmark::DoNotOptimize(hmac.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_HMAC_SHA256)->Arg(200);
+
+
+static void BM_SHA256_Sequential(benchmark::State& state)
+{
+	std::vector<std::string> data(1000, makeData(state.range(0)));
+	Poco::SHA2Engine256 engine;
+	for (auto _ : state)
+	{
+		for (const auto& message: data)
+		{
+			engine.update(message);
+			benchmark::DoNotOptimize(engine.digest());
+		}
+	}
+	state.SetItemsProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_SHA256_Sequential)->Arg(64)->Arg(1024);
+
+
+static void BM_SHA256_DigestMany(benchmark::State& state)
+{
+	std::vector<std::string> data(1000, makeData(state.range(0)));
+	std::vector<std::string_view> messages(data.begin(), data.end());
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::SHA2Engine::digestMany(messages));
+	}
+	state.SetItemsProcessed(state.iterations()*data.size());
+}
+BENCHMARK(BM_SHA256_DigestMany)->Arg(64)->Arg(1024);
+
+
+} // namespace
@@ -0,0 +1,148 @@
+//
+// HashMapBench.cpp
+//
+// Benchmarks for FlatHashMap and other associative containers
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/FlatHashMap.h"
+#include "Poco/HashMap.h"
+#include "Poco/OrderedMap.h"
+#include "Poco/NumberFormatter.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+using Poco::FlatHashMap;
+using Poco::HashMap;
+using Poco::OrderedMap;
+
+
+namespace {
+
+
+const int KEY_COUNT = 100000;
+
+
+template <class K>
+K makeKey(int i);
+
+
+template <>
+int makeKey<int>(int i)
+{
+	return i*2654435761U >> 1;
+}
+
+
+template <>
+std::string makeKey<std::string>(int i)
+{
+	return "/api/v1/objects/" + Poco::NumberFormatter::format(i);
+}
+
+
+template <class K>
+const std::vector<K>& keys(int offset)
+{
+	static std::vector<K> hits = [](){ std::vector<K> v; for (int i = 0; i < KEY_COUNT; ++i) v.push_back(makeKey<K>(i)); return v; }();
+	static std::vector<K> misses = [](){ std::vector<K> v; for (int i = 0; i < KEY_COUNT; ++i) v.push_back(makeKey<K>(i + KEY_COUNT)); return v; }();
+	return offset == 0 ? hits : misses;
+}
+
+
+template <class M, class K>
+M& populatedMap()
+{
+	static M* pMap = []()
+		{
+			M* pMap = new M;
+			for (const auto& key: keys<K>(0)) (*pMap)[key] = 1;
+			return pMap;
+		}();
+	return *pMap;
+}
+
+
+//
+// Naming: BM_<Container>_<Operation>, templated on the map type
+//
+
+template <class M, class K>
+static void BM_Insert(benchmark::State& state)
+{
+	const auto& k = keys<K>(0);
+	for (auto _ : state)
+	{
+		M map;
+		for (const auto& key: k) map[key] = 1;
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations()*KEY_COUNT);
+}
+
+
+template <class M, class K>
+static void BM_FindHit(benchmark::State& state)
+{
+	const M& map = populatedMap<M, K>();
+	const auto& k = keys<K>(0);
+	std::size_t i = 0;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(map.find(k[i]));
+		if (++i == k.size()) i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+template <class M, class K>
+static void BM_FindMiss(benchmark::State& state)
+{
+	const M& map = populatedMap<M, K>();
+	const auto& k = keys<K>(1);
+	std::size_t i = 0;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(map.find(k[i]));
+		if (++i == k.size()) i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+#define POCO_HASHMAP_BENCHMARKS(M, K) \
+	BENCHMARK_TEMPLATE(BM_Insert, M, K); \
+	BENCHMARK_TEMPLATE(BM_FindHit, M, K); \
+	BENCHMARK_TEMPLATE(BM_FindMiss, M, K)
+
+
+using FlatIntMap = FlatHashMap<int, int>;
+using StdIntMap = std::unordered_map<int, int>;
+using PocoIntMap = HashMap<int, int>;
+using OrderedIntMap = OrderedMap<int, int>;
+using FlatStringMap = FlatHashMap<std::string, int>;
+using StdStringMap = std::unordered_map<std::string, int>;
+using PocoStringMap = HashMap<std::string, int>;
+using OrderedStringMap = OrderedMap<std::string, int>;
+
+
+POCO_HASHMAP_BENCHMARKS(FlatIntMap, int);
+POCO_HASHMAP_BENCHMARKS(StdIntMap, int);
+POCO_HASHMAP_BENCHMARKS(PocoIntMap, int);
+POCO_HASHMAP_BENCHMARKS(OrderedIntMap, int);
+POCO_HASHMAP_BENCHMARKS(FlatStringMap, std::string);
+POCO_HASHMAP_BENCHMARKS(StdStringMap, std::string);
+POCO_HASHMAP_BENCHMARKS(PocoStringMap, std::string);
+POCO_HASHMAP_BENCHMARKS(OrderedStringMap, std::string);
+
+
+} // namespace
@@ -0,0 +1,90 @@
+//
+// JSONBench.cpp
+//
+// Benchmarks for JSON parsing
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/JSON/Parser.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/NumberFormatter.h"
+#include <string>
+
+
+using Poco::JSON::Parser;
+using Poco::JSON::Object;
+using Poco::Dynamic::Var;
+
+
+namespace {
+
+
+const std::string& document()
+{
+	static const std::string json = []()
+		{
+			std::string json("[");
+			for (int i = 0; i < 1000; ++i)
+			{
+				if (i > 0) json += ',';
+				json += "{\"id\":";
+				json += Poco::NumberFormatter::format(i);
+				json += ",\"name\":\"item number ";
+				json += Poco::NumberFormatter::format(i);
+				json += "\",\"price\":";
+				json += Poco::NumberFormatter::format(i*1.25);
+				json += ",\"active\":true,\"tags\":[\"a\",\"b\",\"c\"]}";
+			}
+			json += "]";
+			return json;
+		}();
+	return json;
+}
+
+
+//
+// Naming: BM_JSON_<Operation>
+//
+
+static void BM_JSON_Parse(benchmark::State& state)
+{
+	const std::string& json = document();
+	Parser parser;
+	for (auto _ : state)
+	{
+		parser.reset();
+		Var result = parser.parse(json);
+		benchmark::DoNotOptimize(result);
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(BM_JSON_Parse);
+
+
+static void BM_JSON_Traverse(benchmark::State& state)
+{
+	Parser parser;
+	Poco::JSON::Array::Ptr pArray = parser.parse(document()).extract<Poco::JSON::Array::Ptr>();
+	for (auto _ : state)
+	{
+		Poco::Int64 sum = 0;
+		for (const auto& item: *pArray)
+		{
+			const Object::Ptr& pObject = item.extract<Object::Ptr>();
+			sum += pObject->get("id").convert<Poco::Int64>();
+			sum += pObject->get("name").extract<std::string>().size();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations()*pArray->size());
+}
+BENCHMARK(BM_JSON_Traverse);
+
+
+} // namespace
@@ -977,6 +977,127 @@ static void Logger_AsyncChannel_ToFile(benchmark::State& state)
 BENCHMARK(Logger_AsyncChannel_ToFile);
 
 
+//
+// AsyncChannel benchmarks with the lock-free queue
+//
+// With "queueType" set to "lockFree", AsyncChannel::log() moves the
+// Message into a preallocated slot of a lock-free ring (MPSCQueue).
+// There is no heap allocation for a notification and no mutex in the
+// calling thread. The backend thread forwards the messages to the
+// target channel in batches.
+//
+// Compare with the Logger_AsyncChannel_* benchmarks above.
+//
+
+static AutoPtr<AsyncChannel> createLockFreeAsyncChannel(Channel::Ptr pChannel)
+{
+	AutoPtr<AsyncChannel> pAsyncChannel(new AsyncChannel(pChannel));
+	pAsyncChannel->setProperty("queueType", "lockFree");
+	pAsyncChannel->setProperty("overflowPolicy", "block");
+	pAsyncChannel->open();
+	return pAsyncChannel;
+}
+
+
+static void Logger_AsyncChannelLockFree_NullChannel(benchmark::State& state)
+{
+	AutoPtr<NullChannel> pNullChannel(new NullChannel);
+	AutoPtr<AsyncChannel> pAsyncChannel = createLockFreeAsyncChannel(pNullChannel);
+
+	Logger& logger = Logger::get("BenchLogger.AsyncLockFree.NullChannel");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+}
+BENCHMARK(Logger_AsyncChannelLockFree_NullChannel);
+
+
+static void Logger_AsyncChannelLockFree_WithFormat(benchmark::State& state)
+{
+	AutoPtr<NullChannel> pNullChannel(new NullChannel);
+	AutoPtr<PatternFormatter> pFormatter(new PatternFormatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t"));
+	AutoPtr<FormattingChannel> pFormattingChannel(new FormattingChannel(pFormatter, pNullChannel));
+	AutoPtr<AsyncChannel> pAsyncChannel = createLockFreeAsyncChannel(pFormattingChannel);
+
+	Logger& logger = Logger::get("BenchLogger.AsyncLockFree.WithFormat");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+}
+BENCHMARK(Logger_AsyncChannelLockFree_WithFormat);
+
+
+static void Logger_AsyncChannelLockFree_ToFile(benchmark::State& state)
+{
+	std::string tempFile = TemporaryFile::tempName() + ".log";
+
+	AutoPtr<FileChannel> pFileChannel(new FileChannel(tempFile));
+	AutoPtr<PatternFormatter> pFormatter(new PatternFormatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t"));
+	AutoPtr<FormattingChannel> pFormattingChannel(new FormattingChannel(pFormatter, pFileChannel));
+	AutoPtr<AsyncChannel> pAsyncChannel = createLockFreeAsyncChannel(pFormattingChannel);
+
+	Logger& logger = Logger::get("BenchLogger.AsyncLockFree.ToFile");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+
+	// Cleanup
+	try { File(tempFile).remove(); } catch (...) {}
+}
+BENCHMARK(Logger_AsyncChannelLockFree_ToFile);
+
+
+// Several threads logging to the same AsyncChannel.
+// The notification queue serializes the producers on its mutex,
+// the lock-free queue only on a compare-and-swap.
+static AutoPtr<AsyncChannel> pSharedAsyncChannel;
+
+static void Logger_AsyncChannel_Contended(benchmark::State& state)
+{
+	if (state.thread_index() == 0)
+	{
+		AutoPtr<NullChannel> pNullChannel(new NullChannel);
+		pSharedAsyncChannel = new AsyncChannel(pNullChannel);
+		if (state.range(0)) pSharedAsyncChannel->setProperty("queueType", "lockFree");
+		pSharedAsyncChannel->open();
+		Logger::get("BenchLogger.Async.Contended").setChannel(pSharedAsyncChannel);
+		Logger::get("BenchLogger.Async.Contended").setLevel(Message::PRIO_TRACE);
+	}
+
+	Logger& logger = Logger::get("BenchLogger.Async.Contended");
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	if (state.thread_index() == 0)
+	{
+		pSharedAsyncChannel->close();
+		Logger::get("BenchLogger.Async.Contended").setChannel(nullptr);
+		pSharedAsyncChannel.reset();
+	}
+}
+BENCHMARK(Logger_AsyncChannel_Contended)->ArgName("lockFree")->Arg(0)->Arg(1)->Threads(4);
+
+
 #ifdef POCO_ENABLE_FASTLOGGER
 
 //
@@ -1200,6 +1321,20 @@ static const char* asyncChannelFileConfig =
 	"logging.formatters.f1.class = PatternFormatter\n"
 	"logging.formatters.f1.pattern = %s\n";
 
+static const char* asyncChannelLockFreeFileConfig =
+	"logging.loggers.l1.name = BenchComparison.AsyncLockFree.File\n"
+	"logging.loggers.l1.level = trace\n"
+	"logging.loggers.l1.channel = c1\n"
+	"logging.channels.c1.class = AsyncChannel\n"
+	"logging.channels.c1.queueType = lockFree\n"
+	"logging.channels.c1.overflowPolicy = block\n"
+	"logging.channels.c1.channel = c2\n"
+	"logging.channels.c2.class = FileChannel\n"
+	"logging.channels.c2.path = %s\n"
+	"logging.channels.c2.formatter = f1\n"
+	"logging.formatters.f1.class = PatternFormatter\n"
+	"logging.formatters.f1.pattern = %s\n";
+
 static const char* fastLoggerFileConfig =
 	"logging.loggers.l1.name = BenchComparison.Fast.File\n"
 	"logging.loggers.l1.type = fast\n"
@@ -1234,6 +1369,26 @@ static void Loggers_AsyncChannel_File(benchmark::State& state)
 BENCHMARK(Loggers_AsyncChannel_File);
 
 
+// Logger + AsyncChannel (lock-free queue) writing to file
+static void Loggers_AsyncChannelLockFree_File(benchmark::State& state)
+{
+	std::string tempFile = TemporaryFile::tempName() + "_asynclf.log";
+	LoggingConfigurator::configure("trace", benchPattern,
+		Poco::format(std::string(asyncChannelLockFreeFileConfig), tempFile, benchPattern));
+
+	Logger& logger = Logger::get("BenchComparison.AsyncLockFree.File");
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message for comparison");
+	}
+
+	logger.getChannel()->close();
+	try { File(tempFile).remove(); } catch (...) {}
+}
+BENCHMARK(Loggers_AsyncChannelLockFree_File);
+
+
 // FastLogger writing to file
 // Uses lock-free SPSC queue internally (Quill)
 static void Loggers_FastLogger_File(benchmark::State& state)
@@ -1269,6 +1424,16 @@ static const char* asyncChannelNullConfig =
 	"logging.channels.c1.channel = c2\n"
 	"logging.channels.c2.class = NullChannel\n";
 
+static const char* asyncChannelLockFreeNullConfig =
+	"logging.loggers.l1.name = %s\n"
+	"logging.loggers.l1.level = trace\n"
+	"logging.loggers.l1.channel = c1\n"
+	"logging.channels.c1.class = AsyncChannel\n"
+	"logging.channels.c1.queueType = lockFree\n"
+	"logging.channels.c1.overflowPolicy = block\n"
+	"logging.channels.c1.channel = c2\n"
+	"logging.channels.c2.class = NullChannel\n";
+
 static const char* fastLoggerNullConfig =
 	"logging.loggers.l1.name = %s\n"
 	"logging.loggers.l1.type = fast\n"
@@ -1293,6 +1458,24 @@ static void Loggers_AsyncChannel_ShortMsg(benchmark::State& state)
 BENCHMARK(Loggers_AsyncChannel_ShortMsg);
 
 
+// AsyncChannel (lock-free queue) with short message (~9 bytes)
+static void Loggers_AsyncChannelLockFree_ShortMsg(benchmark::State& state)
+{
+	LoggingConfigurator::configure("trace", "%t",
+		Poco::format(std::string(asyncChannelLockFreeNullConfig), std::string("BenchComparison.AsyncLockFree.Short")));
+
+	Logger& logger = Logger::get("BenchComparison.AsyncLockFree.Short");
+
+	for (auto _ : state)
+	{
+		logger.information("Short msg");
+	}
+
+	logger.getChannel()->close();
+}
+BENCHMARK(Loggers_AsyncChannelLockFree_ShortMsg);
+
+
 // FastLogger with short message (~9 bytes)
 static void Loggers_FastLogger_ShortMsg(benchmark::State& state)
 {
@@ -1329,6 +1512,25 @@ static void Loggers_AsyncChannel_LongMsg(benchmark::State& state)
 BENCHMARK(Loggers_AsyncChannel_LongMsg);
 
 
+// AsyncChannel (lock-free queue) with long message (256 bytes)
+static void Loggers_AsyncChannelLockFree_LongMsg(benchmark::State& state)
+{
+	LoggingConfigurator::configure("trace", "%t",
+		Poco::format(std::string(asyncChannelLockFreeNullConfig), std::string("BenchComparison.AsyncLockFree.Long")));
+
+	Logger& logger = Logger::get("BenchComparison.AsyncLockFree.Long");
+
+	std::string longMsg(256, 'x');
+	for (auto _ : state)
+	{
+		logger.information(longMsg);
+	}
+
+	logger.getChannel()->close();
+}
+BENCHMARK(Loggers_AsyncChannelLockFree_LongMsg);
+
+
 // FastLogger with long message (256 bytes)
 // Tests how message size affects queueing overhead
 static void Loggers_FastLogger_LongMsg(benchmark::State& state)
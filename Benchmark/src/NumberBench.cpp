@@ -0,0 +1,190 @@
+//
+// NumberBench.cpp
+//
+// Benchmarks for number formatting and parsing
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/NumericString.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include <charconv>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+
+std::vector<Poco::Int64> makeIntegers(std::size_t count)
+{
+	std::vector<Poco::Int64> values(count);
+	Poco::UInt64 seed = 12345;
+	for (auto& v: values)
+	{
+		seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+		// Mix short and long numbers.
+		v = static_cast<Poco::Int64>(seed >> (seed & 63));
+	}
+	return values;
+}
+
+
+std::vector<double> makeDoubles(std::size_t count)
+{
+	std::vector<double> values(count);
+	Poco::UInt64 seed = 12345;
+	for (auto& v: values)
+	{
+		seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+		v = static_cast<double>(seed >> 11)/(1 << 20);
+	}
+	return values;
+}
+
+
+template <typename T>
+std::vector<std::string> toStrings(const std::vector<T>& values)
+{
+	std::vector<std::string> result;
+	for (auto v: values) result.push_back(Poco::NumberFormatter::format(v));
+	return result;
+}
+
+
+//
+// Naming: BM_<Type><Operation>_<Variant>
+//
+
+static void BM_IntFormat_NumberFormatter(benchmark::State& state)
+{
+	const auto values = makeIntegers(1000);
+	for (auto _ : state)
+	{
+		for (auto v: values) benchmark::DoNotOptimize(Poco::NumberFormatter::format(v));
+	}
+	state.SetItemsProcessed(state.iterations()*values.size());
+}
+BENCHMARK(BM_IntFormat_NumberFormatter);
+
+
+static void BM_IntFormat_ToChars(benchmark::State& state)
+{
+	const auto values = makeIntegers(1000);
+	char buffer[POCO_MAX_INT_STRING_LEN];
+	for (auto _ : state)
+	{
+		for (auto v: values) benchmark::DoNotOptimize(Poco::toChars(buffer, buffer + sizeof(buffer), v));
+	}
+	state.SetItemsProcessed(state.iterations()*values.size());
+}
+BENCHMARK(BM_IntFormat_ToChars);
+
+
+static void BM_IntParse_NumberParser(benchmark::State& state)
+{
+	const auto strings = toStrings(makeIntegers(1000));
+	for (auto _ : state)
+	{
+		for (const auto& s: strings) benchmark::DoNotOptimize(Poco::NumberParser::parse64(s));
+	}
+	state.SetItemsProcessed(state.iterations()*strings.size());
+}
+BENCHMARK(BM_IntParse_NumberParser);
+
+
+static void BM_IntParse_StdFromChars(benchmark::State& state)
+{
+	const auto strings = toStrings(makeIntegers(1000));
+	for (auto _ : state)
+	{
+		for (const auto& s: strings)
+		{
+			Poco::Int64 v;
+			benchmark::DoNotOptimize(std::from_chars(s.data(), s.data() + s.size(), v));
+			benchmark::DoNotOptimize(v);
+		}
+	}
+	state.SetItemsProcessed(state.iterations()*strings.size());
+}
+BENCHMARK(BM_IntParse_StdFromChars);
+
+
+static void BM_IntParse_FromChars(benchmark::State& state)
+{
+	const auto strings = toStrings(makeIntegers(1000));
+	for (auto _ : state)
+	{
+		for (const auto& s: strings)
+		{
+			Poco::Int64 v;
+			benchmark::DoNotOptimize(Poco::fromChars(s.data(), s.data() + s.size(), v));
+			benchmark::DoNotOptimize(v);
+		}
+	}
+	state.SetItemsProcessed(state.iterations()*strings.size());
+}
+BENCHMARK(BM_IntParse_FromChars);
+
+
+static void BM_DoubleFormat_NumberFormatter(benchmark::State& state)
+{
+	const auto values = makeDoubles(1000);
+	for (auto _ : state)
+	{
+		for (auto v: values) benchmark::DoNotOptimize(Poco::NumberFormatter::format(v));
+	}
+	state.SetItemsProcessed(state.iterations()*values.size());
+}
+BENCHMARK(BM_DoubleFormat_NumberFormatter);
+
+
+static void BM_DoubleFormat_ToChars(benchmark::State& state)
+{
+	const auto values = makeDoubles(1000);
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	for (auto _ : state)
+	{
+		for (auto v: values) benchmark::DoNotOptimize(Poco::toChars(buffer, buffer + sizeof(buffer), v));
+	}
+	state.SetItemsProcessed(state.iterations()*values.size());
+}
+BENCHMARK(BM_DoubleFormat_ToChars);
+
+
+static void BM_DoubleParse_NumberParser(benchmark::State& state)
+{
+	const auto strings = toStrings(makeDoubles(1000));
+	for (auto _ : state)
+	{
+		for (const auto& s: strings) benchmark::DoNotOptimize(Poco::NumberParser::parseFloat(s));
+	}
+	state.SetItemsProcessed(state.iterations()*strings.size());
+}
+BENCHMARK(BM_DoubleParse_NumberParser);
+
+
+static void BM_DoubleParse_FromChars(benchmark::State& state)
+{
+	const auto strings = toStrings(makeDoubles(1000));
+	for (auto _ : state)
+	{
+		for (const auto& s: strings)
+		{
+			double v;
+			benchmark::DoNotOptimize(Poco::fromChars(s.data(), s.data() + s.size(), v));
+			benchmark::DoNotOptimize(v);
+		}
+	}
+	state.SetItemsProcessed(state.iterations()*strings.size());
+}
+BENCHMARK(BM_DoubleParse_FromChars);
+
+
+} // namespace
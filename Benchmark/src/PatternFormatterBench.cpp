@@ -235,4 +235,25 @@ static void BM_PatternFormatter_LocalTime(benchmark::State& state)
 BENCHMARK(BM_PatternFormatter_LocalTime);
 
 
+//
+// Typical pattern, formatted into a fixed buffer
+//
+
+static void BM_PatternFormatter_TypicalBuffer(benchmark::State& state)
+{
+	PatternFormatter formatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t");
+	Message msg("TestSource", "This is a test log message", Message::PRIO_INFORMATION);
+	char buffer[256];
+	std::size_t length = 0;
+
+	for (auto _ : state)
+	{
+		length = formatter.format(msg, buffer, sizeof(buffer));
+		benchmark::DoNotOptimize(buffer);
+	}
+	state.SetBytesProcessed(state.iterations() * length);
+}
+BENCHMARK(BM_PatternFormatter_TypicalBuffer);
+
+
 } // namespace
@@ -0,0 +1,98 @@
+//
+// RecordSetBench.cpp
+//
+// Benchmarks for Data::RecordSet iteration (SQLite in-memory database)
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Data/Session.h"
+#include "Poco/Data/RecordSet.h"
+#include "Poco/Data/SQLite/Connector.h"
+#include <string>
+
+
+using namespace Poco::Data::Keywords;
+using Poco::Data::Session;
+using Poco::Data::Statement;
+using Poco::Data::RecordSet;
+
+
+namespace {
+
+
+Session& session()
+{
+	static Session session = []()
+		{
+			Poco::Data::SQLite::Connector::registerConnector();
+			Session session("SQLite", ":memory:");
+			session << "CREATE TABLE Items (Id INTEGER, Name VARCHAR(64), Price DOUBLE)", now;
+			session.begin();
+			for (int i = 0; i < 1000; ++i)
+			{
+				std::string name("item number ");
+				name += std::to_string(i);
+				double price = i*1.25;
+				session << "INSERT INTO Items VALUES (?, ?, ?)", bind(i), bind(name), bind(price), now;
+			}
+			session.commit();
+			return session;
+		}();
+	return session;
+}
+
+
+//
+// Naming: BM_RecordSet_<Operation>
+//
+
+static void BM_RecordSet_IterateValues(benchmark::State& state)
+{
+	Session& sess = session();
+	for (auto _ : state)
+	{
+		Statement select(sess);
+		select << "SELECT Id, Name, Price FROM Items", now;
+		RecordSet rs(select);
+		Poco::Int64 sum = 0;
+		const std::size_t rows = rs.rowCount();
+		for (std::size_t row = 0; row < rows; ++row)
+		{
+			sum += rs.value(0, row).convert<Poco::Int64>();
+			sum += rs.value(1, row).extract<std::string>().size();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations()*1000);
+}
+BENCHMARK(BM_RecordSet_IterateValues);
+
+
+static void BM_RecordSet_IterateRows(benchmark::State& state)
+{
+	Session& sess = session();
+	for (auto _ : state)
+	{
+		Statement select(sess);
+		select << "SELECT Id, Name, Price FROM Items", now;
+		RecordSet rs(select);
+		Poco::Int64 sum = 0;
+		for (auto& row: rs)
+		{
+			sum += row.get(0).convert<Poco::Int64>();
+			sum += row.get(1).convert<std::string>().size();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations()*1000);
+}
+BENCHMARK(BM_RecordSet_IterateRows);
+
+
+} // namespace
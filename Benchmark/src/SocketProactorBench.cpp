@@ -0,0 +1,158 @@
+//
+// SocketProactorBench.cpp
+//
+// Benchmarks for the SocketProactor I/O backends (epoll and io_uring)
+//
+// Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
+// Aleph ONE Software Engineering LLC
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Net/SocketProactor.h"
+#include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include <atomic>
+#include <vector>
+
+
+using Poco::Net::SocketProactor;
+using Poco::Net::DatagramSocket;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+
+
+namespace {
+
+
+//
+// Naming: Proactor_<Backend>_<Test>
+//
+// Each iteration queues one operation per socket and polls the
+// proactor until all completion handlers have been called.
+// The io_uring backend submits all queued operations and reaps
+// the completions with a single system call per poll.
+//
+
+
+const int SOCKET_PAIRS = 16;
+const std::size_t MESSAGE_SIZE = 64;
+
+
+void udpBatch(benchmark::State& state, SocketProactor::IOBackend backend)
+{
+	if (backend == SocketProactor::IO_BACKEND_IO_URING && !SocketProactor::hasIOUring())
+	{
+		state.SkipWithError("io_uring not available");
+		return;
+	}
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, backend);
+	std::vector<DatagramSocket> receivers;
+	std::vector<DatagramSocket> senders;
+	for (int i = 0; i < SOCKET_PAIRS; ++i)
+	{
+		receivers.emplace_back(SocketAddress("127.0.0.1", 0), false);
+		senders.emplace_back(SocketAddress("127.0.0.1", 0), false);
+	}
+	std::vector<SocketProactor::Buffer> bufs(SOCKET_PAIRS, SocketProactor::Buffer(MESSAGE_SIZE));
+	std::vector<SocketAddress> addrs(SOCKET_PAIRS);
+	const SocketProactor::Buffer message(MESSAGE_SIZE, 'x');
+	std::atomic<int> completed(0);
+
+	for (auto _ : state)
+	{
+		completed = 0;
+		for (int i = 0; i < SOCKET_PAIRS; ++i)
+		{
+			proactor.addReceiveFrom(receivers[i], bufs[i], addrs[i], [&completed](const std::error_code&, int)
+			{
+				++completed;
+			});
+			proactor.addSendTo(senders[i], message, receivers[i].address(), [&completed](const std::error_code&, int)
+			{
+				++completed;
+			});
+		}
+		while (completed < 2*SOCKET_PAIRS) proactor.poll();
+	}
+
+	state.SetItemsProcessed(state.iterations() * SOCKET_PAIRS);
+}
+
+
+void tcpRoundTrip(benchmark::State& state, SocketProactor::IOBackend backend)
+{
+	if (backend == SocketProactor::IO_BACKEND_IO_URING && !SocketProactor::hasIOUring())
+	{
+		state.SkipWithError("io_uring not available");
+		return;
+	}
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, backend);
+	ServerSocket server(SocketAddress("127.0.0.1", 0));
+	std::vector<StreamSocket> clients;
+	std::vector<StreamSocket> peers;
+	for (int i = 0; i < SOCKET_PAIRS; ++i)
+	{
+		clients.emplace_back(server.address());
+		peers.push_back(server.acceptConnection());
+	}
+	std::vector<SocketProactor::Buffer> bufs(SOCKET_PAIRS, SocketProactor::Buffer(MESSAGE_SIZE));
+	const SocketProactor::Buffer message(MESSAGE_SIZE, 'x');
+	std::atomic<int> completed(0);
+
+	for (auto _ : state)
+	{
+		completed = 0;
+		for (int i = 0; i < SOCKET_PAIRS; ++i)
+		{
+			proactor.addReceive(peers[i], bufs[i], [&completed](const std::error_code&, int)
+			{
+				++completed;
+			});
+			proactor.addSend(clients[i], message, [&completed](const std::error_code&, int)
+			{
+				++completed;
+			});
+		}
+		while (completed < 2*SOCKET_PAIRS) proactor.poll();
+	}
+
+	state.SetItemsProcessed(state.iterations() * SOCKET_PAIRS);
+}
+
+
+static void Proactor_Epoll_UDPBatch(benchmark::State& state)
+{
+	udpBatch(state, SocketProactor::IO_BACKEND_POLL);
+}
+BENCHMARK(Proactor_Epoll_UDPBatch)->UseRealTime();
+
+
+static void Proactor_IOUring_UDPBatch(benchmark::State& state)
+{
+	udpBatch(state, SocketProactor::IO_BACKEND_IO_URING);
+}
+BENCHMARK(Proactor_IOUring_UDPBatch)->UseRealTime();
+
+
+static void Proactor_Epoll_TCPBatch(benchmark::State& state)
+{
+	tcpRoundTrip(state, SocketProactor::IO_BACKEND_POLL);
+}
+BENCHMARK(Proactor_Epoll_TCPBatch)->UseRealTime();
+
+
+static void Proactor_IOUring_TCPBatch(benchmark::State& state)
+{
+	tcpRoundTrip(state, SocketProactor::IO_BACKEND_IO_URING);
+}
+BENCHMARK(Proactor_IOUring_TCPBatch)->UseRealTime();
+
+
+} // namespace
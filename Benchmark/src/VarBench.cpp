@@ -0,0 +1,106 @@
+//
+// VarBench.cpp
+//
+// Benchmarks for Dynamic::Var
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Dynamic/Var.h"
+#include <string>
+#include <vector>
+
+
+using Poco::Dynamic::Var;
+
+
+namespace {
+
+
+//
+// Naming: BM_Var_<Operation>
+//
+
+static void BM_Var_ConvertInt(benchmark::State& state)
+{
+	Var v(42);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(v.convert<Poco::Int64>());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Var_ConvertInt);
+
+
+static void BM_Var_ExtractString(benchmark::State& state)
+{
+	Var v(std::string("some string value"));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(v.extract<std::string>().size());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Var_ExtractString);
+
+
+static void BM_Var_CompareInt(benchmark::State& state)
+{
+	Var v1(Poco::Int64(123456789));
+	Var v2(123456789);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(v1 == v2);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Var_CompareInt);
+
+
+static void BM_Var_CompareString(benchmark::State& state)
+{
+	Var v1("a somewhat longer string value");
+	Var v2("a somewhat longer string value");
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(v1 == v2);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Var_CompareString);
+
+
+static void BM_Var_AddInt(benchmark::State& state)
+{
+	Var v1(1);
+	Var v2(2);
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(v1 + v2);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Var_AddInt);
+
+
+static void BM_Var_VectorPushBack(benchmark::State& state)
+{
+	const std::string value(40, 'x');
+	for (auto _ : state)
+	{
+		std::vector<Var> values;
+		for (int i = 0; i < 1000; ++i) values.emplace_back(value);
+		benchmark::DoNotOptimize(values);
+	}
+	state.SetItemsProcessed(state.iterations()*1000);
+}
+BENCHMARK(BM_Var_VectorPushBack);
+
+
+} // namespace
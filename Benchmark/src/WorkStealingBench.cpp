@@ -0,0 +1,286 @@
+//
+// WorkStealingBench.cpp
+//
+// Benchmarks for task dispatching through NotificationQueue,
+// ActiveThreadPool and WorkStealingScheduler
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/NotificationQueue.h"
+#include "Poco/Notification.h"
+#include "Poco/ActiveThreadPool.h"
+#include "Poco/WorkStealingScheduler.h"
+#include "Poco/WorkStealingDeque.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Runnable.h"
+#include "Poco/Environment.h"
+#include <atomic>
+#include <memory>
+
+
+using Poco::NotificationQueue;
+using Poco::Notification;
+using Poco::ActiveThreadPool;
+using Poco::WorkStealingScheduler;
+using Poco::WorkStealingDeque;
+using Poco::ThreadPool;
+using Poco::Runnable;
+using Poco::Environment;
+
+
+namespace {
+
+
+const int TASKS_PER_ITERATION = 1000;
+
+
+int workerCount()
+{
+	int n = static_cast<int>(Environment::processorCount());
+	return n > 1 ? n : 2;
+}
+
+
+class CountRunnable: public Runnable
+	/// A trivial task, so that the benchmarks
+	/// measure the dispatching overhead.
+{
+public:
+	void run() override
+	{
+		count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::atomic<int64_t> count{0};
+};
+
+
+class TaskNotification: public Notification
+{
+public:
+	TaskNotification(Runnable& r): runnable(r) {}
+
+	Runnable& runnable;
+};
+
+
+//
+// Single-threaded deque operation benchmarks
+//
+// Naming: Dispatch_<Implementation>_<Test>
+//
+
+static void Dispatch_WorkStealingDeque_PushPop(benchmark::State& state)
+{
+	WorkStealingDeque<Runnable*> deque;
+	CountRunnable runnable;
+
+	for (auto _ : state)
+	{
+		deque.push(&runnable);
+		Runnable* pRunnable;
+		deque.pop(pRunnable);
+		benchmark::DoNotOptimize(pRunnable);
+	}
+}
+BENCHMARK(Dispatch_WorkStealingDeque_PushPop);
+
+
+static void Dispatch_WorkStealingDeque_PushSteal(benchmark::State& state)
+{
+	WorkStealingDeque<Runnable*> deque;
+	CountRunnable runnable;
+
+	for (auto _ : state)
+	{
+		deque.push(&runnable);
+		Runnable* pRunnable;
+		deque.steal(pRunnable);
+		benchmark::DoNotOptimize(pRunnable);
+	}
+}
+BENCHMARK(Dispatch_WorkStealingDeque_PushSteal);
+
+
+//
+// Multi-threaded dispatch benchmarks
+// One producer thread hands trivial tasks to a set of worker
+// threads, like the TCPServer accept loop does with connections.
+//
+
+static void Dispatch_NotificationQueue_Threaded(benchmark::State& state)
+{
+	// The classic TCPServerDispatcher design: worker threads
+	// blocking on a shared, mutex-protected NotificationQueue.
+	NotificationQueue queue;
+	std::atomic<bool> done{false};
+	CountRunnable runnable;
+
+	class Worker: public Runnable
+	{
+	public:
+		Worker(NotificationQueue& q, std::atomic<bool>& d): queue(q), done(d) {}
+
+		void run() override
+		{
+			while (!done.load(std::memory_order_acquire))
+			{
+				Notification::Ptr pNf = queue.waitDequeueNotification(10);
+				if (pNf)
+				{
+					static_cast<TaskNotification*>(pNf.get())->runnable.run();
+				}
+			}
+		}
+
+		NotificationQueue& queue;
+		std::atomic<bool>& done;
+	};
+
+	int workers = workerCount();
+	ThreadPool pool(workers, workers);
+	std::vector<std::unique_ptr<Worker>> threads;
+	for (int i = 0; i < workers; ++i)
+	{
+		threads.emplace_back(new Worker(queue, done));
+		pool.start(*threads.back());
+	}
+
+	for (auto _ : state)
+	{
+		for (int i = 0; i < TASKS_PER_ITERATION; ++i)
+		{
+			queue.enqueueNotification(new TaskNotification(runnable));
+		}
+		while (!queue.empty())
+		{
+			Poco::Thread::yield();
+		}
+	}
+
+	done.store(true, std::memory_order_release);
+	queue.wakeUpAll();
+	pool.joinAll();
+
+	state.counters["tasks_per_second"] = benchmark::Counter(
+		static_cast<double>(state.iterations()*TASKS_PER_ITERATION),
+		benchmark::Counter::kIsRate);
+}
+BENCHMARK(Dispatch_NotificationQueue_Threaded)->UseRealTime();
+
+
+static void Dispatch_ActiveThreadPool_Threaded(benchmark::State& state)
+{
+	ActiveThreadPool pool("bench", workerCount(), POCO_THREAD_STACK_SIZE, ActiveThreadPool::SCHEDULING_PRIORITY_QUEUE);
+	CountRunnable runnable;
+
+	for (auto _ : state)
+	{
+		for (int i = 0; i < TASKS_PER_ITERATION; ++i)
+		{
+			pool.start(runnable);
+		}
+		pool.joinAll();
+	}
+
+	state.counters["tasks_per_second"] = benchmark::Counter(
+		static_cast<double>(state.iterations()*TASKS_PER_ITERATION),
+		benchmark::Counter::kIsRate);
+}
+BENCHMARK(Dispatch_ActiveThreadPool_Threaded)->UseRealTime();
+
+
+static void Dispatch_WorkStealingScheduler_Threaded(benchmark::State& state)
+{
+	WorkStealingScheduler scheduler("bench", workerCount());
+	CountRunnable runnable;
+
+	for (auto _ : state)
+	{
+		for (int i = 0; i < TASKS_PER_ITERATION; ++i)
+		{
+			scheduler.schedule(runnable);
+		}
+		while (scheduler.pending() > 0)
+		{
+			Poco::Thread::yield();
+		}
+	}
+
+	scheduler.joinAll();
+
+	state.counters["tasks_per_second"] = benchmark::Counter(
+		static_cast<double>(state.iterations()*TASKS_PER_ITERATION),
+		benchmark::Counter::kIsRate);
+	state.counters["steals"] = static_cast<double>(scheduler.steals());
+}
+BENCHMARK(Dispatch_WorkStealingScheduler_Threaded)->UseRealTime();
+
+
+//
+// Fork/join benchmark
+// Tasks spawn sub-tasks from within worker threads; with work
+// stealing these go to the worker's own deque.
+//
+
+class ForkRunnable: public Runnable
+{
+public:
+	ForkRunnable(WorkStealingScheduler& scheduler, int depth):
+		_scheduler(scheduler),
+		_depth(depth)
+	{
+	}
+
+	void run() override
+	{
+		if (_depth > 0)
+		{
+			if (!_pLeft)
+			{
+				_pLeft.reset(new ForkRunnable(_scheduler, _depth - 1));
+				_pRight.reset(new ForkRunnable(_scheduler, _depth - 1));
+			}
+			_scheduler.schedule(*_pLeft);
+			_scheduler.schedule(*_pRight);
+		}
+	}
+
+private:
+	WorkStealingScheduler& _scheduler;
+	int _depth;
+	std::unique_ptr<ForkRunnable> _pLeft;
+	std::unique_ptr<ForkRunnable> _pRight;
+};
+
+
+static void Dispatch_WorkStealingScheduler_ForkJoin(benchmark::State& state)
+{
+	WorkStealingScheduler scheduler("bench", workerCount());
+	ForkRunnable root(scheduler, 10);
+
+	for (auto _ : state)
+	{
+		scheduler.schedule(root);
+		while (scheduler.pending() > 0)
+		{
+			Poco::Thread::yield();
+		}
+	}
+
+	scheduler.joinAll();
+
+	state.counters["tasks_per_second"] = benchmark::Counter(
+		static_cast<double>(state.iterations()*((1 << 11) - 1)),
+		benchmark::Counter::kIsRate);
+}
+BENCHMARK(Dispatch_WorkStealingScheduler_ForkJoin)->UseRealTime();
+
+
+} // namespace
@@ -1,4 +1,5 @@
 include(CMakeFindDependencyMacro)
 find_dependency(PocoFoundation)
 find_dependency(PocoData)
+find_dependency(PocoNet)
 include("${CMAKE_CURRENT_LIST_DIR}/PocoDataPostgreSQLTargets.cmake")
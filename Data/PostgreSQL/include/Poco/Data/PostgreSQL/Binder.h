@@ -231,12 +231,27 @@ public:
 	std::size_t size() const;
 		/// Return count of bound parameters
 
-	InputParameterVector bindVector() const;
+	const InputParameterVector& bindVector() const;
 		/// Return the vector of bound parameters.
 
 	void updateBindVectorToCurrentValues();
 		/// obtain the current version of the bound data and update the internal representation
 
+	bool isBulk() const;
+		/// Returns true if containers have been bound in bulk mode.
+
+	const std::vector<InputParameterVector>& bulkBindVector() const;
+		/// Returns the parameters bound in bulk mode, one
+		/// InputParameterVector per row.
+
+	void updateBulkBindVectorToCurrentValues();
+		/// Updates the internal (string) representation of all parameters
+		/// bound in bulk mode. This is not required if the rows are sent
+		/// with COPY, which encodes the bound values directly.
+
+	void reset() override;
+		/// Clears the parameters bound in bulk mode.
+
 private:
 	Binder(const Binder&);
 		/// Don't copy the binder
@@ -251,11 +266,68 @@ private:
 	void realBind(std::size_t aPosition, Poco::Data::MetaColumn::ColumnDataType aFieldType, const void* aBufferPtr, std::size_t aLength);
 		/// Common bind implementation
 
+	template <typename C>
+	void bulkBind(std::size_t pos, Poco::Data::MetaColumn::ColumnDataType fieldType, const C& values, Direction dir)
+		/// Common bulk bind implementation. Binds every element of values
+		/// to the parameter at pos of the corresponding row.
+	{
+		poco_assert(dir == PD_IN);
+
+		if (pos == 0)
+		{
+			_bulkBindVector.assign(values.size(), InputParameterVector());
+		}
+		else if (values.size() != _bulkBindVector.size())
+		{
+			throw BindingException("All containers bound in bulk mode must have the same size");
+		}
+
+		std::size_t row = 0;
+		for (auto it = values.begin(); it != values.end(); ++it, ++row)
+		{
+			InputParameterVector& params = _bulkBindVector[row];
+			if (pos >= params.size()) params.resize(pos + 1);
+
+			using T = typename C::value_type;
+			if constexpr (std::is_same_v<T, bool>)
+				// std::vector<bool> elements have no address
+				params[pos] = InputParameter(fieldType, *it ? &TRUE_VALUE : &FALSE_VALUE, sizeof(bool));
+			else if constexpr (std::is_same_v<T, NullData>)
+				params[pos] = InputParameter(fieldType, nullptr, 0);
+			else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, BLOB> || std::is_same_v<T, CLOB>)
+				params[pos] = InputParameter(fieldType, &*it, it->size());
+			else
+				params[pos] = InputParameter(fieldType, &*it, sizeof(T));
+		}
+	}
+
+	static void updateValue(InputParameter& param);
+		/// Updates the internal representation of a single parameter.
+
+	static const bool TRUE_VALUE;
+	static const bool FALSE_VALUE;
+
 private:
 	InputParameterVector _bindVector;
+	std::vector<InputParameterVector> _bulkBindVector;
 };
 
 
+//
+// inlines
+//
+inline bool Binder::isBulk() const
+{
+	return !_bulkBindVector.empty();
+}
+
+
+inline const std::vector<InputParameterVector>& Binder::bulkBindVector() const
+{
+	return _bulkBindVector;
+}
+
+
 } // namespace Poco::Data::PostgreSQL
 
 
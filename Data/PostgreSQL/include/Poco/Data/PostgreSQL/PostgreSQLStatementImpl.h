@@ -71,6 +71,15 @@ protected:
 	void bindImpl() override;
 		/// Binds parameters
 
+	bool supportsNonBlocking() const override;
+		/// Returns true if a reactor has been set for the session, the
+		/// session does not stream results, and all parameters are
+		/// bound to a single row.
+
+	bool sendImpl(const std::function<void()>& onReceived) override;
+		/// Binds parameters and sends the statement without waiting for
+		/// the result, if a reactor has been set for the session.
+
 	Poco::Data::AbstractExtractor::Ptr extractor() override;
 		/// Returns the concrete extractor used by the statement.
 
@@ -89,6 +98,8 @@ private:
 	Binder::Ptr       _pBinder;
 	AbstractExtractor::Ptr _pExtractor;
 	NextState         _hasNext;
+	bool              _pipelining;
+	Poco::Net::SocketReactor* _pReactor;
 };
 
 
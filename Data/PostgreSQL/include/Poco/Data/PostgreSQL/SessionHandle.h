@@ -18,10 +18,15 @@
 #define SQL_PostgreSQL_SessionHandle_INCLUDED
 
 
+#include "Poco/Data/MetaColumn.h"
 #include "Poco/Mutex.h"
 #include "Poco/Types.h"
+#include <functional>
+#include <list>
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <libpq-fe.h>
 
@@ -76,6 +81,21 @@ class SessionHandle
 	/// PostgreSQL connection(session) handle
 {
 public:
+	struct PreparedStatement
+		/// A server-side prepared statement and the metadata
+		/// obtained when it was prepared.
+	{
+		std::string name;
+		std::vector<MetaColumn> columns;
+		std::vector<Oid> parameterTypes;
+		std::size_t placeholderCount = 0;
+		std::string copyStatement;
+		int users = 0;
+		bool cached = false;
+	};
+
+	using PreparedStatementPtr = std::shared_ptr<PreparedStatement>;
+
 	explicit SessionHandle();
 		/// Creates session handle
 
@@ -141,6 +161,34 @@ public:
 	void deallocatePreparedStatement(const std::string& aPreparedStatementToDeAllocate);
 		/// deallocates a previously prepared statement
 
+	void setStatementCacheSize(std::size_t size);
+		/// Sets the maximum number of prepared statements kept on
+		/// the server after the statements using them have been destroyed,
+		/// so that statements with the same SQL text can reuse them
+		/// without preparing and describing them again.
+		///
+		/// The least recently used statement not in use is deallocated
+		/// when the limit is exceeded. A size of 0 (the default) disables
+		/// the cache. The cache should be disabled if the structure of
+		/// tables used by cached statements is changed.
+
+	std::size_t statementCacheSize() const;
+		/// Returns the maximum number of cached prepared statements.
+
+	PreparedStatementPtr acquirePreparedStatement(const std::string& aSQLStatement);
+		/// Returns the cached prepared statement for the given SQL text
+		/// and marks it as used, or a null pointer if there is none.
+
+	bool addPreparedStatement(const std::string& aSQLStatement, const PreparedStatementPtr& pPreparedStatement);
+		/// Adds a newly prepared statement to the cache and marks it as used.
+		/// Returns false if the statement has not been cached, because the
+		/// cache is disabled or already contains the SQL text, in which case
+		/// the caller remains responsible for deallocating it.
+
+	void releasePreparedStatement(const PreparedStatementPtr& pPreparedStatement);
+		/// Marks a statement obtained from acquirePreparedStatement() or
+		/// added with addPreparedStatement() as no longer used.
+
 	int serverVersion() const;
 		/// remote server version
 
@@ -174,13 +222,26 @@ public:
 	Poco::FastMutex& mutex();
 		/// Get the sessionHandle mutex to protect the connection pointer
 
+	void setPendingAbort(const std::function<void()>& abort);
+		/// Sets a function that is called by disconnect() and reset()
+		/// while a statement sent without waiting for its result is
+		/// pending, so that its result can be completed with an error.
+		/// The function is called with the session mutex held and must
+		/// not block. An empty function removes it.
+		///
+		/// The caller must hold the session mutex.
+
 private:
 	static SessionParametersMap setConnectionInfoParameters(PQconninfoOption* aConnectionInfoOptionsPtr);
 
 	void deallocateStoredPreparedStatements();
 
+	void trimStatementCache();
+	void clearStatementCache();
+
 	void deallocatePreparedStatementNoLock(const std::string& aPreparedStatementToDeAllocate);
 	bool isConnectedNoLock() const;
+	void abortPendingNoLock();
 	std::string lastErrorNoLock() const;
 
 	SessionHandle(const SessionHandle&) = delete;
@@ -194,6 +255,14 @@ private:
 	bool                      _isAsynchronousCommit;
 	Poco::UInt32              _tranactionIsolationLevel;
 	std::vector <std::string> _preparedStatementsToBeDeallocated;
+	std::function<void()>     _pendingAbort;
+
+	using StatementCacheList = std::list<std::pair<std::string, PreparedStatementPtr>>;
+	using StatementCacheIndex = std::unordered_map<std::string, StatementCacheList::iterator>;
+
+	std::size_t               _statementCacheSize;
+	StatementCacheList        _statementCache;       // most recently used first
+	StatementCacheIndex       _statementCacheIndex;
 
 //	static const std::string POSTGRESQL_READ_UNCOMMITTED;  // NOT SUPPORTED
 	static const std::string POSTGRESQL_READ_COMMITTED;
@@ -291,6 +360,12 @@ inline Poco::FastMutex& SessionHandle::mutex()
 }
 
 
+inline void SessionHandle::setPendingAbort(const std::function<void()>& abort)
+{
+	_pendingAbort = abort;
+}
+
+
 inline std::string SessionHandle::connectionString() const
 {
 	return _connectionString;
@@ -25,6 +25,15 @@
 #include <string>
 
 
+namespace Poco::Net {
+
+
+class SocketReactor;
+
+
+} // namespace Poco::Net
+
+
 namespace Poco::Data::PostgreSQL {
 
 
@@ -122,6 +131,98 @@ public:
 		/// Returns true if binary extraction is enabled, otherwise false.
 		/// See setBinaryExtraction() for more information.
 
+	void setBulkCopy(const std::string& feature, bool enabled);
+		/// Sets the "bulkCopy" feature (enabled by default). If set, INSERT
+		/// statements of the form
+		///
+		///     INSERT INTO table (col1, col2, ...) VALUES ($1, $2, ...)
+		///
+		/// executed with bulk bindings are sent to the server with
+		/// COPY ... FROM STDIN (FORMAT binary), which is considerably faster
+		/// than executing the statement once per row. Note that COPY does not
+		/// apply rules defined for the table and requires the bound values to
+		/// match the column types.
+		///
+		/// If not set, or if the statement or its parameters are not suitable for
+		/// COPY, the rows are sent in pipeline mode.
+
+	bool isBulkCopy(const std::string& feature = std::string()) const;
+		/// Returns true if bulk copy is enabled, otherwise false.
+		/// See setBulkCopy() for more information.
+
+	void setPipelining(const std::string& feature, bool enabled);
+		/// Sets the "pipelining" feature (disabled by default). If set,
+		/// statements not returning any columns that are executed once for
+		/// each element of containers bound without the bulk keyword send
+		/// all rows in pipeline mode, without waiting for the result of
+		/// each row.
+		///
+		/// A pipeline runs as one implicit transaction. In autocommit mode,
+		/// a failing row therefore rolls back all rows of the execution,
+		/// whereas without pipelining the rows before the failing one
+		/// remain committed.
+		///
+		/// The setting applies to statements created afterwards.
+
+	bool isPipelining(const std::string& feature = std::string()) const;
+		/// Returns true if pipelining is enabled, otherwise false.
+		/// See setPipelining() for more information.
+
+	void setStreaming(const std::string& feature, bool enabled);
+		/// Sets the "streaming" feature. If set, the rows of query results
+		/// are received from the server while they are extracted, rather
+		/// than buffering the complete result in memory when the statement
+		/// is executed. Combined with a limit, this allows processing
+		/// arbitrarily large results in constant memory.
+		///
+		/// While a result is being streamed, the session cannot be used for
+		/// other statements. If a statement is destroyed or executed again
+		/// before all rows have been extracted, the query is cancelled
+		/// (outside of a transaction) or the remaining rows are discarded.
+		///
+		/// The setting applies to statements created afterwards.
+
+	bool isStreaming(const std::string& feature = std::string()) const;
+		/// Returns true if streaming is enabled, otherwise false.
+		/// See setStreaming() for more information.
+
+	void setStatementCacheSize(const std::string&, const Poco::Any& value);
+		/// Sets the "statementCacheSize" property, the maximum number of
+		/// prepared statements kept on the server for reuse by later
+		/// statements with the same SQL text. Value must be of type int.
+		/// A size of 0 (the default) disables the cache.
+		/// See SessionHandle::setStatementCacheSize() for more information.
+
+	Poco::Any getStatementCacheSize(const std::string&) const;
+		/// Returns the maximum number of cached prepared statements.
+
+	void setReactor(const std::string&, const Poco::Any& value);
+		/// Sets the "reactor" property to a Poco::Net::SocketReactor*,
+		/// or to a null pointer (the default).
+		///
+		/// If set, Statement::executeAsync() sends statements without
+		/// waiting for their results, and the reactor notifies the statement
+		/// when the result has been received, which is then extracted by the
+		/// reactor thread. This allows any number of statements, on different
+		/// sessions, to be executed concurrently without a thread for each.
+		/// Statements with an extraction limit, with bulk or multi-row
+		/// bindings, or created with the "streaming" feature enabled, are
+		/// executed by a thread of the default thread pool instead.
+		///
+		/// The reactor must run for as long as statements are executing.
+		/// While a statement is executing, the session must not be used
+		/// for other statements or returned to a SessionPool; this is not
+		/// checked. If the reactor stops, or the session is closed or
+		/// reset, before the result has been received, the execution
+		/// fails with an exception.
+		/// The setting applies to statements created afterwards.
+
+	Poco::Any getReactor(const std::string&) const;
+		/// Returns the reactor used for asynchronous execution.
+
+	Poco::Net::SocketReactor* reactor() const;
+		/// Returns the reactor used for asynchronous execution, or a null pointer.
+
 	SessionHandle& handle();
 		/// Get handle
 
@@ -135,6 +236,10 @@ private:
 	mutable SessionHandle _sessionHandle;
 	std::size_t           _timeout = 0;
 	bool                  _binaryExtraction = false;
+	bool                  _bulkCopy = true;
+	bool                  _pipelining = false;
+	bool                  _streaming = false;
+	Poco::Net::SocketReactor* _pReactor = nullptr;
 };
 
 
@@ -179,6 +284,74 @@ inline bool SessionImpl::isBinaryExtraction(const std::string&) const
 }
 
 
+inline void SessionImpl::setBulkCopy(const std::string&, bool enabled)
+{
+	_bulkCopy = enabled;
+}
+
+
+inline bool SessionImpl::isBulkCopy(const std::string&) const
+{
+	return _bulkCopy;
+}
+
+
+inline void SessionImpl::setPipelining(const std::string&, bool enabled)
+{
+	_pipelining = enabled;
+}
+
+
+inline bool SessionImpl::isPipelining(const std::string&) const
+{
+	return _pipelining;
+}
+
+
+inline void SessionImpl::setStreaming(const std::string&, bool enabled)
+{
+	_streaming = enabled;
+}
+
+
+inline bool SessionImpl::isStreaming(const std::string&) const
+{
+	return _streaming;
+}
+
+
+inline void SessionImpl::setStatementCacheSize(const std::string&, const Poco::Any& value)
+{
+	const int size = Poco::AnyCast<int>(value);
+	if (size < 0) throw InvalidArgumentException("statementCacheSize");
+	_sessionHandle.setStatementCacheSize(static_cast<std::size_t>(size));
+}
+
+
+inline Poco::Any SessionImpl::getStatementCacheSize(const std::string&) const
+{
+	return static_cast<int>(_sessionHandle.statementCacheSize());
+}
+
+
+inline void SessionImpl::setReactor(const std::string&, const Poco::Any& value)
+{
+	_pReactor = Poco::AnyCast<Poco::Net::SocketReactor*>(value);
+}
+
+
+inline Poco::Any SessionImpl::getReactor(const std::string&) const
+{
+	return _pReactor;
+}
+
+
+inline Poco::Net::SocketReactor* SessionImpl::reactor() const
+{
+	return _pReactor;
+}
+
+
 } // namespace Poco::Data::PostgreSQL
 
 
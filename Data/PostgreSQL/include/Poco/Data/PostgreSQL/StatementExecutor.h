@@ -23,10 +23,20 @@
 #include "Poco/Data/PostgreSQL/SessionHandle.h"
 #include "Poco/Data/MetaColumn.h"
 #include <libpq-fe.h>
+#include <functional>
 #include <string>
 #include <vector>
 
 
+namespace Poco::Net {
+
+
+class SocketReactor;
+
+
+} // namespace Poco::Net
+
+
 namespace Poco::Data::PostgreSQL {
 
 
@@ -41,8 +51,15 @@ public:
 		STMT_EXECUTED
 	};
 
-	explicit StatementExecutor(SessionHandle& aSessionHandle, bool binaryExtraction);
+	StatementExecutor(SessionHandle& aSessionHandle, bool binaryExtraction, bool bulkCopy = false, bool streaming = false);
 		/// Creates the StatementExecutor.
+		///
+		/// If bulkCopy is true, copyBulk() sends suitable INSERT
+		/// statements using COPY.
+		///
+		/// If streaming is true, the rows of a query result are received
+		/// from the server while they are fetched, instead of buffering
+		/// the complete result in execute().
 
 	~StatementExecutor();
 		/// Destroys the StatementExecutor.
@@ -59,9 +76,66 @@ public:
 
 	void execute();
 		/// Executes the statement.
+		///
+		/// If rows have been queued, the statement is sent with the
+		/// current parameters as the last row of the pipeline, and the
+		/// affected row count is the total for all rows.
+
+	bool canSend() const;
+		/// Returns true if the statement can be executed with send().
+		/// Queries created with streaming enabled cannot.
+
+	bool isStreaming() const;
+		/// Returns true if the rows of query results are received
+		/// from the server while they are fetched.
+
+	bool isSent() const;
+		/// Returns true if the statement has been sent with send(),
+		/// and execute() has not been called since.
+
+	void send(Poco::Net::SocketReactor& reactor, const std::function<void()>& onReceived);
+		/// Sends the statement with the current parameters without waiting
+		/// for the result. The result is read by the reactor thread when the
+		/// connection becomes readable, and onReceived is called from that
+		/// thread once it is complete. The next call to execute() completes
+		/// the execution with the received result, without blocking.
+		///
+		/// If the reactor stops, or the session is closed or reset, before
+		/// the result has been received, onReceived is called as well, and
+		/// execute() throws a StatementException.
+
+	void queue();
+		/// Sends the statement with the current parameters in pipeline
+		/// mode, without waiting for the result. Results are read in
+		/// batches while further rows are queued, and the pipeline is
+		/// completed by the next call to execute().
+		///
+		/// Only statements not returning any columns can be queued.
+		/// If libpq has been built without pipeline support, the statement
+		/// is executed immediately.
+
+	void discardQueue();
+		/// Discards all queued rows and leaves pipeline mode. Does not throw.
+
+	bool copyBulk(const std::vector<InputParameterVector>& rows);
+		/// Inserts the given rows with COPY ... FROM STDIN (FORMAT binary).
+		///
+		/// Returns false without sending anything if bulk copy is disabled,
+		/// if the statement is not a plain INSERT with a column list and
+		/// one placeholder per column, or if a bound type does not match
+		/// the type of its column. Otherwise, sets the affected row count
+		/// and returns true.
+
+	void executeBulk(const std::vector<InputParameterVector>& rows);
+		/// Executes the statement once for every row in pipeline mode.
+		/// The parameters of each row must have been updated to their
+		/// current values (see Binder::updateBulkBindVectorToCurrentValues()).
 
 	bool fetch();
 		/// Fetches the data for the current row
+		///
+		/// In streaming mode, further rows are received from the
+		/// server as needed.
 
 	std::size_t getAffectedRowCount() const;
 		/// get the count of rows affected by the statement
@@ -80,6 +154,16 @@ public:
 
 private:
 	void clearResults();
+	void setResult(PGresult* pResult);
+	bool receive();
+	void abandonReceive();
+	void checkExecutable(std::size_t parameterCount) const;
+	void sendQuery(const InputParameterVector& parameters);
+	void enterPipeline();
+	void readPipelineResults(std::size_t count);
+	void completePipeline();
+	void readStreamResult();
+	void discardStream();
 
 	StatementExecutor(const StatementExecutor&) = delete;
 	StatementExecutor& operator= (const StatementExecutor&) = delete;
@@ -89,17 +173,34 @@ private:
 
 	SessionHandle& _sessionHandle;
 	bool           _binaryExtraction;
+	bool           _bulkCopy;
+	bool           _streaming;
 	State          _state;
 	PGresult*      _pResultHandle;
 	std::string    _SQLStatement;
 	std::string    _preparedStatementName;	// UUID based to allow multiple prepared statements per transaction.
 	std::size_t    _countPlaceholdersInSQLStatement;
 	ColVec         _resultColumns;
+	std::vector<Oid> _parameterTypes;
+	std::string    _copyStatement;		// COPY equivalent of an INSERT statement, if there is one
+	SessionHandle::PreparedStatementPtr _pPreparedStatement;	// set if the prepared statement is cached by the session
 
 	InputParameterVector  _inputParameterVector;
 	OutputParameterVector _outputParameterVector;
 	std::size_t           _currentRow;			// current row of the result
 	std::size_t           _affectedRowCount;
+	bool                  _pipelined;			// in pipeline mode
+	bool                  _pipelineSynced;		// pipeline sync point sent
+	std::size_t           _sentCount;			// queries sent since entering pipeline mode
+	std::size_t           _pendingCount;		// queries sent, but result not read yet
+	std::size_t           _pipelineRowCount;	// affected rows of the queries read so far
+	bool                  _streamed;			// the current result is received in single-row or chunked mode
+	bool                  _streamActive;		// further results of the current query must be read
+	bool                  _cancelStream;		// cancel the query if the rest of the result is discarded
+	bool                  _sent;				// sent by send(), execute() completes with the received result
+	PGresult*             _pReceivedResult;
+	std::string           _receiveError;
+	bool                  _receiveAborted;		// the session has been closed or reset while the result was pending
 };
 
 
@@ -108,6 +209,18 @@ private:
 //
 
 
+inline bool StatementExecutor::isStreaming() const
+{
+	return _streaming;
+}
+
+
+inline bool StatementExecutor::isSent() const
+{
+	return _sent;
+}
+
+
 inline StatementExecutor::operator PGresult* ()
 {
 	return _pResultHandle;
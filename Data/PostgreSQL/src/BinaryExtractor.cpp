@@ -19,6 +19,7 @@
 #include "Poco/DateTimeParser.h"
 #include "Poco/ByteOrder.h"
 #include <limits>
+#include <type_traits>
 
 
 namespace Poco::Data::PostgreSQL {
@@ -289,14 +290,76 @@ namespace
 		return success;
 	}
 
+	template <typename T>
+	bool readIntegerValue(const OutputParameter& param, T& value)
+		/// Reads a smallint, integer or bigint column into any
+		/// integer type, with range checking.
+	{
+		Poco::Int64 tempValue = 0;
+		switch (param.internalFieldType())
+		{
+		case INT2OID:
+			{
+				Poco::Int16 v;
+				if (!readBinaryValue(param, v)) return false;
+				tempValue = v;
+				break;
+			}
+		case INT4OID:
+			{
+				Poco::Int32 v;
+				if (!readBinaryValue(param, v)) return false;
+				tempValue = v;
+				break;
+			}
+		default:
+			{
+				Poco::Int64 v;
+				if (!readBinaryValue(param, v)) return false;
+				tempValue = v;
+				break;
+			}
+		}
+
+		if (tempValue < static_cast<Poco::Int64>(std::numeric_limits<T>::min()))
+			throw Poco::RangeException("Value too small.");
+		if constexpr (sizeof(T) < sizeof(Poco::Int64) || std::is_signed_v<T>)
+		{
+			if (tempValue > static_cast<Poco::Int64>(std::numeric_limits<T>::max()))
+				throw Poco::RangeException("Value too large.");
+		}
+		value = static_cast<T>(tempValue);
+		return true;
+	}
+
 	template <typename T>
 	bool readAndConvertBinaryValue(const OutputParameter& param, Oid expectedType, T& value)
 	{
-		if (param.internalFieldType() == expectedType)
+		const Oid oid = param.internalFieldType();
+		if (oid == expectedType)
 		{
 			return readBinaryValue(param, value);
 		}
-		else
+
+		// Convert between numeric types directly, without Dynamic::Var.
+		if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+		{
+			if (oid == INT2OID || oid == INT4OID || oid == INT8OID)
+			{
+				return readIntegerValue(param, value);
+			}
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			if (oid == FLOAT4OID)
+			{
+				float floatValue;
+				if (!readBinaryValue(param, floatValue)) return false;
+				value = floatValue;
+				return true;
+			}
+		}
+
 		{
 			Poco::Dynamic::Var var;
 			if (readVar(param, var))
@@ -20,6 +20,10 @@
 namespace Poco::Data::PostgreSQL {
 
 
+const bool Binder::TRUE_VALUE = true;
+const bool Binder::FALSE_VALUE = false;
+
+
 Binder::Binder()
 {
 }
@@ -194,123 +198,143 @@ std::size_t Binder::size() const
 }
 
 
-InputParameterVector
-Binder::bindVector() const
+const InputParameterVector& Binder::bindVector() const
 {
 	return _bindVector;
 }
 
 
+void Binder::reset()
+{
+	_bulkBindVector.clear();
+}
+
+
 void Binder::updateBindVectorToCurrentValues()
 {
-	InputParameterVector::iterator itr    = _bindVector.begin();
-	InputParameterVector::iterator itrEnd = _bindVector.end();
+	for (auto& param: _bindVector)
+	{
+		updateValue(param);
+	}
+}
+
 
-	for (; itr != itrEnd; ++itr)
+void Binder::updateBulkBindVectorToCurrentValues()
+{
+	for (auto& row: _bulkBindVector)
 	{
-		switch (itr->fieldType())
+		for (auto& param: row)
 		{
-		case Poco::Data::MetaColumn::FDT_INT8:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int8*>(itr->pData())));
-			break;
+			updateValue(param);
+		}
+	}
+}
 
-		case Poco::Data::MetaColumn::FDT_UINT8:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt8*>(itr->pData())));
-			break;
 
-		case Poco::Data::MetaColumn::FDT_INT16:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int16*>(itr->pData())));
-			break;
+void Binder::updateValue(InputParameter& param)
+{
+	switch (param.fieldType())
+	{
+	case Poco::Data::MetaColumn::FDT_INT8:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int8*>(param.pData())));
+		break;
+
+	case Poco::Data::MetaColumn::FDT_UINT8:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt8*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_UINT16:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt16*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_INT16:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int16*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_INT32:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int32*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_UINT16:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt16*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_UINT32:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt32*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_INT32:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int32*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_INT64:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int64*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_UINT32:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt32*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_UINT64:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt64*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_INT64:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::Int64*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_BOOL:
-			{
-				const bool currentBoolValue = * static_cast<const bool*>(itr->pData());
-				itr->setStringVersionRepresentation(currentBoolValue ? "TRUE" : "FALSE");
-			}
-			break;
+	case Poco::Data::MetaColumn::FDT_UINT64:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const Poco::UInt64*>(param.pData())));
+		break;
+
+	case Poco::Data::MetaColumn::FDT_BOOL:
+		{
+			const bool currentBoolValue = * static_cast<const bool*>(param.pData());
+			param.setStringVersionRepresentation(currentBoolValue ? "TRUE" : "FALSE");
+		}
+		break;
 
-		case Poco::Data::MetaColumn::FDT_FLOAT:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const float*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_FLOAT:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const float*>(param.pData())));
+		break;
 
-		case Poco::Data::MetaColumn::FDT_DOUBLE:
-			itr->setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const double*>(itr->pData())));
-			break;
+	case Poco::Data::MetaColumn::FDT_DOUBLE:
+		param.setStringVersionRepresentation(Poco::NumberFormatter::format(* static_cast<const double*>(param.pData())));
+		break;
 
 //		case Poco::Data::MetaColumn::FDT_CHAR:
-//			itr->setStringVersionRepresentation(std::string(static_cast<const char*>(itr->pData()), 1));  // single character string
+//			param.setStringVersionRepresentation(std::string(static_cast<const char*>(param.pData()), 1));  // single character string
 //			break;
 
-		case Poco::Data::MetaColumn::FDT_STRING:
-			itr->setStringVersionRepresentation(* static_cast<const std::string*>(itr->pData()));
-			break;
-
-		case Poco::Data::MetaColumn::FDT_TIMESTAMP:
-			{
-				const Poco::DateTime& dateTime = * static_cast<const Poco::DateTime*>(itr->pData());
-				itr->setStringVersionRepresentation(DateTimeFormatter::format(dateTime, Poco::DateTimeFormat::ISO8601_FRAC_FORMAT));
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_DATE:
-			{
-				const Poco::Data::Date& date = * static_cast<const Poco::Data::Date*>(itr->pData());
-				itr->setStringVersionRepresentation(DateTimeFormatter::format(Poco::DateTime(date.year(), date.month(), date.day()), "%Y-%m-%d"));
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_TIME:
-			{
-				const Poco::Data::Time& time = * static_cast<const Poco::Data::Time*>(itr->pData());
-				itr->setStringVersionRepresentation(DateTimeFormatter::format(Poco::DateTime(0, 1, 1, time.hour(), time.minute(), time.second()), "%H:%M:%s%z"));
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_BLOB:
-			{
-				const Poco::Data::BLOB& blob = * static_cast<const Poco::Data::BLOB*>(itr->pData());
-				itr->setNonStringVersionRepresentation(static_cast<const void*> (blob.rawContent()), blob.size());
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_CLOB:
-			{
-				const Poco::Data::CLOB& clob = * static_cast<const Poco::Data::CLOB*>(itr->pData());
-				itr->setNonStringVersionRepresentation(static_cast<const void*> (clob.rawContent()), clob.size());
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_UUID:
-			{
-				const Poco::UUID& uuid = * static_cast<const Poco::UUID*>(itr->pData());
-				itr->setStringVersionRepresentation(uuid.toString());
-			}
-			break;
-
-		case Poco::Data::MetaColumn::FDT_UNKNOWN:
-		default:
-			break;
+	case Poco::Data::MetaColumn::FDT_STRING:
+		param.setStringVersionRepresentation(* static_cast<const std::string*>(param.pData()));
+		break;
+
+	case Poco::Data::MetaColumn::FDT_TIMESTAMP:
+		{
+			const Poco::DateTime& dateTime = * static_cast<const Poco::DateTime*>(param.pData());
+			param.setStringVersionRepresentation(DateTimeFormatter::format(dateTime, Poco::DateTimeFormat::ISO8601_FRAC_FORMAT));
+		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_DATE:
+		{
+			const Poco::Data::Date& date = * static_cast<const Poco::Data::Date*>(param.pData());
+			param.setStringVersionRepresentation(DateTimeFormatter::format(Poco::DateTime(date.year(), date.month(), date.day()), "%Y-%m-%d"));
 		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_TIME:
+		{
+			const Poco::Data::Time& time = * static_cast<const Poco::Data::Time*>(param.pData());
+			param.setStringVersionRepresentation(DateTimeFormatter::format(Poco::DateTime(0, 1, 1, time.hour(), time.minute(), time.second()), "%H:%M:%s%z"));
+		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_BLOB:
+		{
+			const Poco::Data::BLOB& blob = * static_cast<const Poco::Data::BLOB*>(param.pData());
+			param.setNonStringVersionRepresentation(static_cast<const void*> (blob.rawContent()), blob.size());
+		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_CLOB:
+		{
+			const Poco::Data::CLOB& clob = * static_cast<const Poco::Data::CLOB*>(param.pData());
+			param.setNonStringVersionRepresentation(static_cast<const void*> (clob.rawContent()), clob.size());
+		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_UUID:
+		{
+			const Poco::UUID& uuid = * static_cast<const Poco::UUID*>(param.pData());
+			param.setStringVersionRepresentation(uuid.toString());
+		}
+		break;
+
+	case Poco::Data::MetaColumn::FDT_UNKNOWN:
+	default:
+		break;
 	}
 }
 
@@ -335,345 +359,345 @@ void Binder::realBind(std::size_t aPosition, Poco::Data::MetaColumn::ColumnDataT
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Int8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Int8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Int8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Int8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Int8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::UInt8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::UInt8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::UInt8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::UInt8>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::UInt8>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Int16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Int16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Int16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Int16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Int16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::UInt16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::UInt16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::UInt16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::UInt16>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::UInt16>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT16, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Int32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Int32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Int32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Int32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Int32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::UInt32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::UInt32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::UInt32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::UInt32>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::UInt32>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT32, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Int64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Int64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Int64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Int64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Int64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Int64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_INT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::UInt64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::UInt64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::UInt64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::UInt64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::UInt64>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::UInt64>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT64, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<bool>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<bool>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BOOL, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<bool>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<bool>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BOOL, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<bool>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<bool>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BOOL, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<float>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<float>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_FLOAT, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<float>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<float>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_FLOAT, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<float>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<float>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_FLOAT, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<double>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<double>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DOUBLE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<double>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<double>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DOUBLE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<double>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<double>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DOUBLE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<char>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<char>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<char>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<char>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<char>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<char>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UINT8, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Data::BLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Data::BLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Data::BLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Data::BLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Data::BLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Data::BLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_BLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Data::CLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Data::CLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_CLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Data::CLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Data::CLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_CLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Data::CLOB>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Data::CLOB>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_CLOB, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::DateTime>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::DateTime>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIMESTAMP, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::DateTime>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::DateTime>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIMESTAMP, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::DateTime>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::DateTime>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIMESTAMP, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Data::Date>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Data::Date>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DATE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Data::Date>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Data::Date>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DATE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Data::Date>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Data::Date>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_DATE, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Data::Time>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Data::Time>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIME, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Data::Time>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Data::Time>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIME, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Data::Time>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Data::Time>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_TIME, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<Poco::Data::NullData>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<Poco::Data::NullData>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UNKNOWN, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<Poco::Data::NullData>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<Poco::Data::NullData>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UNKNOWN, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<Poco::Data::NullData>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<Poco::Data::NullData>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_UNKNOWN, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::vector<std::string>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::vector<std::string>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_STRING, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::deque<std::string>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::deque<std::string>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_STRING, val, dir);
 }
 
 
-void Binder::bind(std::size_t /*pos*/, const std::list<std::string>& /*val*/, Direction /*dir*/)
+void Binder::bind(std::size_t pos, const std::list<std::string>& val, Direction dir)
 {
-	throw NotImplementedException();
+	bulkBind(pos, Poco::Data::MetaColumn::FDT_STRING, val, dir);
 }
 
 
@@ -15,7 +15,7 @@
 #include "Poco/Data/PostgreSQL/Extractor.h"
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
-#include "Poco/NumberParser.h"
+#include "Poco/NumericString.h"
 #include "Poco/DateTimeParser.h"
 #include "Poco/MemoryStream.h"
 #include "Poco/HexBinaryDecoder.h"
@@ -25,6 +25,18 @@
 namespace Poco::Data::PostgreSQL {
 
 
+namespace
+{
+	template <typename T>
+	bool parseNumber(const OutputParameter& outputParameter, T& val)
+		/// Parses the text representation of a number in place,
+		/// without copying it into a temporary string.
+	{
+		return Poco::fromChars(std::string_view(outputParameter.pData(), outputParameter.size()), val);
+	}
+}
+
+
 Extractor::Extractor(StatementExecutor& st):
 	_statementExecutor(st)
 {
@@ -41,7 +53,7 @@ bool Extractor::extract(std::size_t pos, Poco::Int8& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	int tempVal = 0;
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParse(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -56,7 +68,7 @@ bool Extractor::extract(std::size_t pos, Poco::UInt8& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	unsigned int tempVal = 0;
-	if (isColumnNull(outputParameter)|| !Poco::NumberParser::tryParseUnsigned(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter)|| !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -71,7 +83,7 @@ bool Extractor::extract(std::size_t pos, Poco::Int16& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	int tempVal = 0;
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParse(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -86,7 +98,7 @@ bool Extractor::extract(std::size_t pos, Poco::UInt16& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	unsigned int tempVal = 0;
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParseUnsigned(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -100,7 +112,7 @@ bool Extractor::extract(std::size_t pos, Poco::Int32& val)
 {
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParse(outputParameter.pData(), val))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, val))
 	{
 		return false;
 	}
@@ -113,7 +125,7 @@ bool Extractor::extract(std::size_t pos, Poco::UInt32& val)
 {
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParseUnsigned(outputParameter.pData(), val))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, val))
 	{
 		return false;
 	}
@@ -126,7 +138,7 @@ bool Extractor::extract(std::size_t pos, Poco::Int64& val)
 {
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParse64(outputParameter.pData(), val))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, val))
 	{
 		return false;
 	}
@@ -139,7 +151,7 @@ bool Extractor::extract(std::size_t pos, Poco::UInt64& val)
 {
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParseUnsigned64(outputParameter.pData(), val))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, val))
 	{
 		return false;
 	}
@@ -154,7 +166,7 @@ bool Extractor::extract(std::size_t pos, long& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	Poco::Int64 tempVal = 0;
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParse64(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -169,7 +181,7 @@ bool Extractor::extract(std::size_t pos, unsigned long& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	Poco::UInt64 tempVal = 0;
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParseUnsigned64(outputParameter.pData(), tempVal))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -200,7 +212,7 @@ bool Extractor::extract(std::size_t pos, float& val)
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
 	double tempVal = 0.0;
-	if	(isColumnNull(outputParameter) || !Poco::NumberParser::tryParseFloat(outputParameter.pData(), tempVal))
+	if	(isColumnNull(outputParameter) || !parseNumber(outputParameter, tempVal))
 	{
 		return false;
 	}
@@ -214,7 +226,7 @@ bool Extractor::extract(std::size_t pos, double& val)
 {
 	const OutputParameter& outputParameter = extractPreamble(pos);
 
-	if (isColumnNull(outputParameter) || !Poco::NumberParser::tryParseFloat(outputParameter.pData(), val))
+	if (isColumnNull(outputParameter) || !parseNumber(outputParameter, val))
 	{
 		return false;
 	}
@@ -438,7 +450,6 @@ bool Extractor::extractToDynamic(std::size_t pos, Dynamic::Var& val)
 		return false;
 	}
 
-	const std::string tempString{outputParameter.pData(), outputParameter.size()};
 	const Oid oid = outputParameter.internalFieldType();
 
 	bool success = false;
@@ -448,7 +459,7 @@ bool Extractor::extractToDynamic(std::size_t pos, Dynamic::Var& val)
 	case BOOLOID:
 		{
 			success = true;
-			if (tempString[0] == 't')
+			if (*outputParameter.pData() == 't')
 				val = true;
 			else
 				val = false;
@@ -459,7 +470,7 @@ bool Extractor::extractToDynamic(std::size_t pos, Dynamic::Var& val)
 	case INT8OID:
 		{
 			Poco::Int64 tempValue = 0;
-			success = Poco::NumberParser::tryParse64(tempString, tempValue);
+			success = parseNumber(outputParameter, tempValue);
 			if (success)
 				val = tempValue;
 			break;
@@ -470,7 +481,7 @@ bool Extractor::extractToDynamic(std::size_t pos, Dynamic::Var& val)
 	case NUMERICOID:
 		{
 			double tempValue = 0;
-			success = Poco::NumberParser::tryParseFloat(tempString, tempValue);
+			success = parseNumber(outputParameter, tempValue);
 			if (success)
 				val = tempValue;
 			break;
@@ -482,7 +493,7 @@ bool Extractor::extractToDynamic(std::size_t pos, Dynamic::Var& val)
 	default:
 		{
 			success = true;
-			val = tempString;
+			val = std::string(outputParameter.pData(), outputParameter.size());
 			break;
 		}
 	// BLOB, CLOB
@@ -21,9 +21,11 @@ namespace Poco::Data::PostgreSQL {
 
 PostgreSQLStatementImpl::PostgreSQLStatementImpl(SessionImpl& aSessionImpl):
 	Poco::Data::StatementImpl(aSessionImpl),
-	_statementExecutor(aSessionImpl.handle(), aSessionImpl.isBinaryExtraction()),
+	_statementExecutor(aSessionImpl.handle(), aSessionImpl.isBinaryExtraction(), aSessionImpl.isBulkCopy(), aSessionImpl.isStreaming()),
 	_pBinder(new Binder),
-	_hasNext(NEXT_DONTKNOW)
+	_hasNext(NEXT_DONTKNOW),
+	_pipelining(aSessionImpl.isPipelining()),
+	_pReactor(aSessionImpl.reactor())
 {
 	if (aSessionImpl.isBinaryExtraction())
 		_pExtractor = new BinaryExtractor(_statementExecutor);
@@ -133,25 +135,93 @@ void PostgreSQLStatementImpl::compileImpl()
 
 void PostgreSQLStatementImpl::bindImpl()
 {
+	if (_statementExecutor.isSent())
+	{
+		// the result of sendImpl() has been received
+		_statementExecutor.execute();
+		_hasNext = NEXT_DONTKNOW;
+		return;
+	}
+
 	Poco::Data::AbstractBindingVec& binds = bindings();
 
 	std::size_t position = 0;
 	Poco::Data::AbstractBindingVec::iterator it= binds.begin();
 	Poco::Data::AbstractBindingVec::iterator itEnd = binds.end();
 
-	for (; it != itEnd && (*it)->canBind(); ++it)
+	try
 	{
-		(*it)->bind(position);
-		position += (*it)->numOfColumnsHandled();
+		for (; it != itEnd && (*it)->canBind(); ++it)
+		{
+			(*it)->bind(position);
+			position += (*it)->numOfColumnsHandled();
+		}
+
+		if (_pBinder->isBulk())
+		{
+			// containers bound in bulk are sent at once, with COPY if possible
+			if (!_statementExecutor.copyBulk(_pBinder->bulkBindVector()))
+			{
+				_pBinder->updateBulkBindVectorToCurrentValues();
+				_statementExecutor.executeBulk(_pBinder->bulkBindVector());
+			}
+		}
+		else
+		{
+			_pBinder->updateBindVectorToCurrentValues();
+
+			_statementExecutor.bindParams(_pBinder->bindVector());
+
+			// With pipelining enabled, rows of containers bound one at a
+			// time are queued, so that they can be sent without waiting
+			// for each result. The last row completes the execution.
+			if (_pipelining && columnsReturned() == 0 && canBind())
+				_statementExecutor.queue();
+			else
+				_statementExecutor.execute();
+		}
+	}
+	catch (...)
+	{
+		_statementExecutor.discardQueue();
+		throw;
 	}
 
-	_pBinder->updateBindVectorToCurrentValues();
+	_hasNext = NEXT_DONTKNOW;
+}
 
-	_statementExecutor.bindParams(_pBinder->bindVector());
 
-	_statementExecutor.execute();
+bool PostgreSQLStatementImpl::supportsNonBlocking() const
+{
+	if (!_pReactor || _statementExecutor.isStreaming()) return false;
+
+	for (const auto& pBinding: bindings())
+	{
+		// all parameters must be sent in a single execution
+		if (pBinding->isBulk() || pBinding->numOfRowsHandled() != 1) return false;
+	}
+	return true;
+}
+
+
+bool PostgreSQLStatementImpl::sendImpl(const std::function<void()>& onReceived)
+{
+	if (!supportsNonBlocking() || !_statementExecutor.canSend()) return false;
+
+	Poco::Data::AbstractBindingVec& binds = bindings();
+	std::size_t position = 0;
+	for (auto& pBinding: binds)
+	{
+		pBinding->bind(position);
+		position += pBinding->numOfColumnsHandled();
+	}
+
+	_pBinder->updateBindVectorToCurrentValues();
+	_statementExecutor.bindParams(_pBinder->bindVector());
+	_statementExecutor.send(*_pReactor, onReceived);
 
 	_hasNext = NEXT_DONTKNOW;
+	return true;
 }
 
 
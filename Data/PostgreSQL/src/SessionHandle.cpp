@@ -35,7 +35,8 @@ SessionHandle::SessionHandle():
 	_pConnection(nullptr),
 	_inTransaction(false),
 	_isAsynchronousCommit(false),
-	_tranactionIsolationLevel(Session::TRANSACTION_READ_COMMITTED)
+	_tranactionIsolationLevel(Session::TRANSACTION_READ_COMMITTED),
+	_statementCacheSize(0)
 {
 }
 
@@ -72,12 +73,23 @@ bool SessionHandle::isConnectedNoLock() const
 }
 
 
+void SessionHandle::abortPendingNoLock()
+{
+	// DO NOT ACQUIRE THE MUTEX IN PRIVATE METHODS
+
+	std::function<void()> abort = std::move(_pendingAbort);
+	_pendingAbort = nullptr;
+	if (abort) abort();
+}
+
+
 void SessionHandle::connect(const std::string& aConnectionString)
 {
 	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
 
 	_inTransaction = false;
 	_preparedStatementsToBeDeallocated.clear();
+	clearStatementCache();
 
 	if (isConnectedNoLock())
 	{
@@ -151,12 +163,14 @@ void SessionHandle::disconnect()
 
 	if (_pConnection)
 	{
+		abortPendingNoLock();
 		PQfinish(_pConnection);
 
 		_pConnection = nullptr;
 
 		_connectionString = std::string();
 		_inTransaction= false;
+		clearStatementCache();
 		_isAsynchronousCommit = false;
 		_tranactionIsolationLevel = Session::TRANSACTION_READ_COMMITTED;
 	}
@@ -170,6 +184,9 @@ bool SessionHandle::reset()
 
 	if (_pConnection)
 	{
+		// prepared statements do not survive the new connection
+		clearStatementCache();
+		abortPendingNoLock();
 		PQreset(_pConnection);
 	}
 
@@ -579,4 +596,110 @@ SessionParametersMap SessionHandle::connectionParameters() const
 }
 
 
+void SessionHandle::setStatementCacheSize(std::size_t size)
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
+
+	_statementCacheSize = size;
+	trimStatementCache();
+}
+
+
+std::size_t SessionHandle::statementCacheSize() const
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
+
+	return _statementCacheSize;
+}
+
+
+SessionHandle::PreparedStatementPtr SessionHandle::acquirePreparedStatement(const std::string& aSQLStatement)
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
+
+	StatementCacheIndex::iterator it = _statementCacheIndex.find(aSQLStatement);
+	if (it == _statementCacheIndex.end()) return PreparedStatementPtr();
+
+	_statementCache.splice(_statementCache.begin(), _statementCache, it->second);
+	PreparedStatementPtr pPreparedStatement = it->second->second;
+	++pPreparedStatement->users;
+	return pPreparedStatement;
+}
+
+
+bool SessionHandle::addPreparedStatement(const std::string& aSQLStatement, const PreparedStatementPtr& pPreparedStatement)
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
+
+	if (_statementCacheSize == 0 || !isConnectedNoLock()) return false;
+	if (_statementCacheIndex.find(aSQLStatement) != _statementCacheIndex.end()) return false;
+
+	_statementCache.emplace_front(aSQLStatement, pPreparedStatement);
+	_statementCacheIndex[aSQLStatement] = _statementCache.begin();
+	pPreparedStatement->users = 1;
+	pPreparedStatement->cached = true;
+	trimStatementCache();
+	return true;
+}
+
+
+void SessionHandle::releasePreparedStatement(const PreparedStatementPtr& pPreparedStatement)
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionMutex);
+
+	// statements dropped from the cache while in use
+	// belonged to a connection that has been closed
+	if (!pPreparedStatement->cached) return;
+
+	--pPreparedStatement->users;
+	trimStatementCache();
+}
+
+
+void SessionHandle::trimStatementCache()
+{
+	// DO NOT ACQUIRE THE MUTEX IN PRIVATE METHODS
+	StatementCacheList::iterator it = _statementCache.end();
+	while (_statementCache.size() > _statementCacheSize && it != _statementCache.begin())
+	{
+		--it;
+		PreparedStatementPtr pPreparedStatement = it->second;
+		if (pPreparedStatement->users > 0) continue;
+
+		pPreparedStatement->cached = false;
+		_statementCacheIndex.erase(it->first);
+		it = _statementCache.erase(it);
+
+		if (!isConnectedNoLock()) continue;
+		if (_inTransaction)
+		{
+			_preparedStatementsToBeDeallocated.push_back(pPreparedStatement->name);
+		}
+		else
+		{
+			try
+			{
+				deallocatePreparedStatementNoLock(pPreparedStatement->name);
+			}
+			catch (StatementException&)
+			{
+				// the statement stays allocated until the session is closed
+			}
+		}
+	}
+}
+
+
+void SessionHandle::clearStatementCache()
+{
+	// DO NOT ACQUIRE THE MUTEX IN PRIVATE METHODS
+	for (auto& entry: _statementCache)
+	{
+		entry.second->cached = false;
+	}
+	_statementCache.clear();
+	_statementCacheIndex.clear();
+}
+
+
 } // namespace Poco::Data::PostgreSQL
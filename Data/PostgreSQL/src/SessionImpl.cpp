@@ -156,6 +156,26 @@ void SessionImpl::open(const std::string& aConnectionString)
 		&SessionImpl::setBinaryExtraction,
 		&SessionImpl::isBinaryExtraction);
 
+	addFeature("bulkCopy",
+		&SessionImpl::setBulkCopy,
+		&SessionImpl::isBulkCopy);
+
+	addFeature("pipelining",
+		&SessionImpl::setPipelining,
+		&SessionImpl::isPipelining);
+
+	addFeature("streaming",
+		&SessionImpl::setStreaming,
+		&SessionImpl::isStreaming);
+
+	addProperty("statementCacheSize",
+		&SessionImpl::setStatementCacheSize,
+		&SessionImpl::getStatementCacheSize);
+
+	addProperty("reactor",
+		&SessionImpl::setReactor,
+		&SessionImpl::getReactor);
+
 	setName();
 }
 
@@ -18,9 +18,23 @@
 #include "Poco/UUID.h"
 #include "Poco/UUIDGenerator.h"
 #include "Poco/NumberParser.h"
-#include "Poco/NumberParser.h"
 #include "Poco/RegularExpression.h"
+#include "Poco/Ascii.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/DateTime.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/Net/Socket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/NObserver.h"
+#if !defined(POCO_OS_FAMILY_WINDOWS)
+#include <unistd.h>
+#endif
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <set>
 
 
@@ -64,20 +78,460 @@ namespace
 
 		return placeholderSet.size();
 	}
+
+
+	const std::size_t PIPELINE_WINDOW = 256;
+		// Number of queries sent in pipeline mode between flush requests.
+		// Results are read in batches of this size, so that at most two
+		// batches are in flight.
+
+	const std::size_t COPY_CHUNK_SIZE = 65536;
+		// Amount of COPY data buffered before sending it to the server.
+
+#if defined(LIBPQ_HAS_CHUNK_MODE)
+	const int STREAMING_CHUNK_SIZE = 1024;
+		// Maximum number of rows received at once in streaming mode.
+#endif
+
+	const Poco::Int64 POSTGRES_EPOCH = 946684800000000;
+		// 2000-01-01 00:00:00 UTC (the PostgreSQL epoch) in microseconds since the Unix epoch.
+
+	const Poco::Int64 MICROSECONDS_PER_DAY = 86400000000;
+
+
+	std::string errorDetails(PGresult* pResult)
+	{
+		const char* pSeverity	= PQresultErrorField(pResult, PG_DIAG_SEVERITY);
+		const char* pSQLState	= PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+		const char* pDetail		= PQresultErrorField(pResult, PG_DIAG_MESSAGE_DETAIL);
+		const char* pHint		= PQresultErrorField(pResult, PG_DIAG_MESSAGE_HINT);
+		const char* pConstraint	= PQresultErrorField(pResult, PG_DIAG_CONSTRAINT_NAME);
+
+		return std::string(PQresultErrorMessage(pResult))
+			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
+			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
+			+ " Detail: " + (pDetail ? pDetail : "N/A")
+			+ " Hint: " + (pHint   ? pHint   : "N/A")
+			+ " Constraint: " + (pConstraint ? pConstraint : "N/A");
+	}
+
+
+	std::size_t affectedRows(PGresult* pResult)
+	{
+		// non Select DML statments have an affected row count - as a char *
+		int affectedRowCount = 0;
+		const char* pAffectedRowCountString = PQcmdTuples(pResult);
+		if (pAffectedRowCountString &&
+			Poco::NumberParser::tryParse(pAffectedRowCountString, affectedRowCount) &&
+			affectedRowCount >= 0)
+		{
+			return static_cast<std::size_t>(affectedRowCount);
+		}
+		return 0;
+	}
+
+
+	void toParameterArrays(const Poco::Data::PostgreSQL::InputParameterVector& parameters,
+		std::vector<const char*>& values, std::vector<int>& lengths, std::vector<int>& formats)
+	{
+		// "transmogrify" the parameters to the C format required by PQexecPrepared
+
+		try
+		{
+			values.reserve(parameters.size());
+			lengths.reserve(parameters.size());
+			formats.reserve(parameters.size());
+			for (const auto& parameter: parameters)
+			{
+				values.push_back(static_cast<const char*>(parameter.pInternalRepresentation()));
+				lengths.push_back(static_cast<int>(parameter.size()));
+				formats.push_back(parameter.isBinary() ? 1 : 0);
+			}
+		}
+		catch (std::bad_alloc&)
+		{
+			throw Poco::Data::PostgreSQL::StatementException("Memory Allocation Error");
+		}
+	}
+
+
+	std::string copyStatement(const std::string& aSQLStatement, std::size_t countPlaceholders)
+		/// Returns the equivalent COPY statement for an INSERT statement
+		/// with a column list and the placeholders $1 to $n as values,
+		/// or an empty string if there is none.
+	{
+		static const std::string IDENTIFIER = "(?:\"[^\"]+\"|[a-z_][a-z0-9_$]*)";
+
+		if (countPlaceholders == 0) return std::string();
+
+		Poco::RegularExpression insertRE(
+			"^\\s*insert\\s+into\\s+(" + IDENTIFIER + "(?:\\s*\\.\\s*" + IDENTIFIER + ")?)"
+			"\\s*\\(([^()]+)\\)\\s*values\\s*\\(([^()]+)\\)\\s*;?\\s*$",
+			Poco::RegularExpression::RE_CASELESS);
+
+		std::vector<std::string> groups;
+		if (insertRE.split(aSQLStatement, groups) != 4) return std::string();
+
+		std::string values;
+		for (char c: groups[3])
+		{
+			if (!Poco::Ascii::isSpace(c)) values += c;
+		}
+		std::string expectedValues;
+		for (std::size_t i = 1; i <= countPlaceholders; ++i)
+		{
+			if (i > 1) expectedValues += ',';
+			expectedValues += '$';
+			expectedValues += std::to_string(i);
+		}
+		if (values != expectedValues) return std::string();
+
+		return "COPY " + groups[1] + " (" + groups[2] + ") FROM STDIN (FORMAT binary)";
+	}
+
+
+	bool canCopy(Poco::Data::MetaColumn::ColumnDataType fieldType, Oid columnType, bool integerDateTimes)
+		/// Returns true if values of the given type can be sent to a
+		/// column of the given type in binary COPY format.
+	{
+		using namespace Poco::Data::PostgreSQL;
+
+		switch (fieldType)
+		{
+		case Poco::Data::MetaColumn::FDT_INT8:
+		case Poco::Data::MetaColumn::FDT_UINT8:
+		case Poco::Data::MetaColumn::FDT_INT16:
+		case Poco::Data::MetaColumn::FDT_UINT16:
+		case Poco::Data::MetaColumn::FDT_INT32:
+		case Poco::Data::MetaColumn::FDT_UINT32:
+		case Poco::Data::MetaColumn::FDT_INT64:
+		case Poco::Data::MetaColumn::FDT_UINT64:
+			return columnType == INT2OID || columnType == INT4OID || columnType == INT8OID;
+		case Poco::Data::MetaColumn::FDT_BOOL:
+			return columnType == BOOLOID;
+		case Poco::Data::MetaColumn::FDT_FLOAT:
+		case Poco::Data::MetaColumn::FDT_DOUBLE:
+			return columnType == FLOAT4OID || columnType == FLOAT8OID;
+		case Poco::Data::MetaColumn::FDT_STRING:
+		case Poco::Data::MetaColumn::FDT_CLOB:
+			return columnType == TEXTOID || columnType == VARCHAROID || columnType == BPCHAROID;
+		case Poco::Data::MetaColumn::FDT_BLOB:
+			return columnType == BYTEAOID;
+		case Poco::Data::MetaColumn::FDT_TIMESTAMP:
+			return integerDateTimes && (columnType == TIMESTAMPOID || columnType == TIMESTAMPTZOID);
+		case Poco::Data::MetaColumn::FDT_DATE:
+			return columnType == DATEOID;
+		case Poco::Data::MetaColumn::FDT_TIME:
+			return integerDateTimes && columnType == TIMEOID;
+		case Poco::Data::MetaColumn::FDT_UUID:
+			return columnType == UUIDOID;
+		case Poco::Data::MetaColumn::FDT_UNKNOWN: // NULL
+			return true;
+		default:
+			return false;
+		}
+	}
+
+
+	template <typename T>
+	void append(std::string& buffer, T value)
+	{
+		value = Poco::ByteOrder::toNetwork(value);
+		buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+
+	template <typename T>
+	void appendField(std::string& buffer, T value)
+	{
+		append(buffer, static_cast<Poco::Int32>(sizeof(value)));
+		append(buffer, value);
+	}
+
+
+	void appendField(std::string& buffer, const void* pData, std::size_t length)
+	{
+		if (length > static_cast<std::size_t>(std::numeric_limits<Poco::Int32>::max()))
+			throw Poco::Data::PostgreSQL::StatementException("COPY value too long");
+
+		append(buffer, static_cast<Poco::Int32>(length));
+		buffer.append(static_cast<const char*>(pData), length);
+	}
+
+
+	template <typename T>
+	Poco::Int64 integerValue(const void* pData)
+	{
+		T value = *static_cast<const T*>(pData);
+		if constexpr (std::is_same_v<T, Poco::UInt64>)
+		{
+			if (value > static_cast<Poco::UInt64>(std::numeric_limits<Poco::Int64>::max()))
+				throw Poco::Data::PostgreSQL::StatementException("COPY value out of range");
+		}
+		return static_cast<Poco::Int64>(value);
+	}
+
+
+	void appendInteger(std::string& buffer, Poco::Int64 value, Oid columnType)
+	{
+		using namespace Poco::Data::PostgreSQL;
+
+		if (columnType == INT8OID)
+		{
+			appendField(buffer, value);
+		}
+		else if (columnType == INT4OID)
+		{
+			if (value < std::numeric_limits<Poco::Int32>::min() || value > std::numeric_limits<Poco::Int32>::max())
+				throw StatementException("COPY value out of range for type integer");
+			appendField(buffer, static_cast<Poco::Int32>(value));
+		}
+		else
+		{
+			if (value < std::numeric_limits<Poco::Int16>::min() || value > std::numeric_limits<Poco::Int16>::max())
+				throw StatementException("COPY value out of range for type smallint");
+			appendField(buffer, static_cast<Poco::Int16>(value));
+		}
+	}
+
+
+	void appendFloat(std::string& buffer, double value, Oid columnType)
+	{
+		if (columnType == Poco::Data::PostgreSQL::FLOAT4OID)
+		{
+			const float floatValue = static_cast<float>(value);
+			Poco::UInt32 bits;
+			std::memcpy(&bits, &floatValue, sizeof(bits));
+			appendField(buffer, bits);
+		}
+		else
+		{
+			Poco::UInt64 bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			appendField(buffer, bits);
+		}
+	}
+
+
+	void appendValue(std::string& buffer, const Poco::Data::PostgreSQL::InputParameter& parameter, Oid columnType)
+		/// Appends a field in binary COPY format. The types must
+		/// have been checked with canCopy().
+	{
+		const void* pData = parameter.pData();
+
+		switch (parameter.fieldType())
+		{
+		case Poco::Data::MetaColumn::FDT_INT8:
+			appendInteger(buffer, integerValue<Poco::Int8>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_UINT8:
+			appendInteger(buffer, integerValue<Poco::UInt8>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_INT16:
+			appendInteger(buffer, integerValue<Poco::Int16>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_UINT16:
+			appendInteger(buffer, integerValue<Poco::UInt16>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_INT32:
+			appendInteger(buffer, integerValue<Poco::Int32>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_UINT32:
+			appendInteger(buffer, integerValue<Poco::UInt32>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_INT64:
+			appendInteger(buffer, integerValue<Poco::Int64>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_UINT64:
+			appendInteger(buffer, integerValue<Poco::UInt64>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_BOOL:
+			append(buffer, static_cast<Poco::Int32>(1));
+			buffer += *static_cast<const bool*>(pData) ? '\1' : '\0';
+			break;
+		case Poco::Data::MetaColumn::FDT_FLOAT:
+			appendFloat(buffer, *static_cast<const float*>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_DOUBLE:
+			appendFloat(buffer, *static_cast<const double*>(pData), columnType);
+			break;
+		case Poco::Data::MetaColumn::FDT_STRING:
+			{
+				const std::string& value = *static_cast<const std::string*>(pData);
+				appendField(buffer, value.data(), value.size());
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_BLOB:
+			{
+				const Poco::Data::BLOB& blob = *static_cast<const Poco::Data::BLOB*>(pData);
+				appendField(buffer, blob.rawContent(), blob.size());
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_CLOB:
+			{
+				const Poco::Data::CLOB& clob = *static_cast<const Poco::Data::CLOB*>(pData);
+				appendField(buffer, clob.rawContent(), clob.size());
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_TIMESTAMP:
+			{
+				const Poco::DateTime& dateTime = *static_cast<const Poco::DateTime*>(pData);
+				appendField(buffer, dateTime.timestamp().epochMicroseconds() - POSTGRES_EPOCH);
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_DATE:
+			{
+				const Poco::Data::Date& date = *static_cast<const Poco::Data::Date*>(pData);
+				const Poco::Int64 microseconds = Poco::DateTime(date.year(), date.month(), date.day()).timestamp().epochMicroseconds() - POSTGRES_EPOCH;
+				appendField(buffer, static_cast<Poco::Int32>(microseconds/MICROSECONDS_PER_DAY));
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_TIME:
+			{
+				const Poco::Data::Time& time = *static_cast<const Poco::Data::Time*>(pData);
+				appendField(buffer, static_cast<Poco::Int64>((time.hour()*60 + time.minute())*60 + time.second())*1000000);
+			}
+			break;
+		case Poco::Data::MetaColumn::FDT_UUID:
+			{
+				char uuid[16];
+				static_cast<const Poco::UUID*>(pData)->copyTo(uuid);
+				appendField(buffer, uuid, sizeof(uuid));
+			}
+			break;
+		default: // NULL
+			append(buffer, static_cast<Poco::Int32>(-1));
+			break;
+		}
+	}
+
+	poco_socket_t duplicateSocket(int fd)
+		/// Returns a new descriptor for the socket of a connection,
+		/// which can be owned by a Poco::Net::Socket.
+	{
+#if defined(POCO_OS_FAMILY_WINDOWS)
+		WSAPROTOCOL_INFOW info;
+		if (WSADuplicateSocketW(static_cast<SOCKET>(fd), GetCurrentProcessId(), &info) != 0)
+			throw Poco::IOException("Cannot duplicate connection socket");
+		SOCKET sockfd = WSASocketW(FROM_PROTOCOL_INFO, FROM_PROTOCOL_INFO, FROM_PROTOCOL_INFO, &info, 0, WSA_FLAG_OVERLAPPED);
+#else
+		int sockfd = ::dup(fd);
+#endif
+		if (sockfd == POCO_INVALID_SOCKET)
+			throw Poco::IOException("Cannot duplicate connection socket");
+		return sockfd;
+	}
+
+
+	class ResultReceiver
+		/// Reads the result of a statement sent without waiting for it
+		/// whenever the connection is readable, and deletes itself after
+		/// calling the completion callback once the result is complete.
+	{
+	public:
+		using ReadableObserver = Poco::NObserver<ResultReceiver, Poco::Net::ReadableNotification>;
+		using ErrorObserver = Poco::NObserver<ResultReceiver, Poco::Net::ErrorNotification>;
+		using ShutdownObserver = Poco::NObserver<ResultReceiver, Poco::Net::ShutdownNotification>;
+
+		ResultReceiver(Poco::Net::SocketReactor& reactor, int fd, const std::function<bool()>& receive, const std::function<void()>& abandon, const std::function<void()>& onReceived):
+			_reactor(reactor),
+			_socket(Poco::Net::Socket::fromFileDescriptor(duplicateSocket(fd))),
+			_receive(receive),
+			_abandon(abandon),
+			_onReceived(onReceived)
+		{
+		}
+
+		const Poco::Net::Socket& socket() const
+		{
+			return _socket;
+		}
+
+		void start()
+			/// Must be the last call on the object, which may have
+			/// been deleted by the reactor thread when it returns.
+		{
+			_reactor.addEventHandler(_socket, ErrorObserver(*this, &ResultReceiver::onError));
+			_reactor.addEventHandler(_socket, ShutdownObserver(*this, &ResultReceiver::onShutdown));
+			_reactor.addEventHandler(_socket, ReadableObserver(*this, &ResultReceiver::onReadable));
+		}
+
+		void onReadable(const Poco::AutoPtr<Poco::Net::ReadableNotification>&)
+		{
+			bool complete = true;
+			try
+			{
+				complete = _receive();
+			}
+			catch (...)
+			{
+			}
+			if (complete) finish();
+		}
+
+		void onError(const Poco::AutoPtr<Poco::Net::ErrorNotification>&)
+		{
+			// the error is reported by libpq
+			onReadable(nullptr);
+		}
+
+		void onShutdown(const Poco::AutoPtr<Poco::Net::ShutdownNotification>&)
+		{
+			// the result will not be read by the reactor anymore
+			try
+			{
+				_abandon();
+			}
+			catch (...)
+			{
+			}
+			finish();
+		}
+
+	private:
+		void finish()
+		{
+			_reactor.removeEventHandler(_socket, ReadableObserver(*this, &ResultReceiver::onReadable));
+			_reactor.removeEventHandler(_socket, ShutdownObserver(*this, &ResultReceiver::onShutdown));
+			_reactor.removeEventHandler(_socket, ErrorObserver(*this, &ResultReceiver::onError));
+			std::function<void()> onReceived = std::move(_onReceived);
+			delete this;
+			onReceived();
+		}
+
+		Poco::Net::SocketReactor& _reactor;
+		Poco::Net::Socket _socket;
+		std::function<bool()> _receive;
+		std::function<void()> _abandon;
+		std::function<void()> _onReceived;
+	};
 } // namespace
 
 
 namespace Poco::Data::PostgreSQL {
 
 
-StatementExecutor::StatementExecutor(SessionHandle& sessionHandle, bool binaryExtraction):
+StatementExecutor::StatementExecutor(SessionHandle& sessionHandle, bool binaryExtraction, bool bulkCopy, bool streaming):
 	_sessionHandle(sessionHandle),
 	_binaryExtraction(binaryExtraction),
+	_bulkCopy(bulkCopy),
+	_streaming(streaming),
 	_state(STMT_INITED),
 	_pResultHandle(nullptr),
 	_countPlaceholdersInSQLStatement(0),
 	_currentRow(0),
-	_affectedRowCount(0)
+	_affectedRowCount(0),
+	_pipelined(false),
+	_pipelineSynced(false),
+	_sentCount(0),
+	_pendingCount(0),
+	_pipelineRowCount(0),
+	_streamed(false),
+	_streamActive(false),
+	_cancelStream(false),
+	_sent(false),
+	_pReceivedResult(nullptr),
+	_receiveAborted(false)
 {
 }
 
@@ -86,13 +540,21 @@ StatementExecutor::~StatementExecutor()
 {
 	try
 	{
+		discardQueue();
+		discardStream();
+
 		// remove the prepared statement from the session
-		if(_sessionHandle.isConnected() && _state >= STMT_COMPILED)
+		if (_pPreparedStatement)
+		{
+			_sessionHandle.releasePreparedStatement(_pPreparedStatement);
+		}
+		else if(_sessionHandle.isConnected() && _state >= STMT_COMPILED)
 		{
 			_sessionHandle.deallocatePreparedStatement(_preparedStatementName);
 		}
 
 		PQResultClear resultClearer(_pResultHandle);
+		PQResultClear receivedClearer(_pReceivedResult);
 	}
 	catch (...)
 	{
@@ -116,10 +578,27 @@ void StatementExecutor::prepare(const std::string& aSQLStatement)
 	_SQLStatement= std::string();
 	_preparedStatementName   = std::string();
 	_resultColumns.clear();
+	_parameterTypes.clear();
+	_copyStatement.clear();
 
 	// clear out any result data.  One way or another it is now obsolete.
 	clearResults();
 
+	// reuse a statement with the same SQL text prepared earlier on this session
+	SessionHandle::PreparedStatementPtr pCached = _sessionHandle.acquirePreparedStatement(aSQLStatement);
+	if (pCached)
+	{
+		_resultColumns = pCached->columns;
+		_parameterTypes = pCached->parameterTypes;
+		_copyStatement = pCached->copyStatement;
+		_SQLStatement = aSQLStatement;
+		_preparedStatementName = pCached->name;
+		_countPlaceholdersInSQLStatement = pCached->placeholderCount;
+		_pPreparedStatement = pCached;
+		_state = STMT_COMPILED;  // must be last
+		return;
+	}
+
 	// prepare parameters for the call to PQprepare
 	const char* ptrCSQLStatement = aSQLStatement.c_str();
 	std::size_t countPlaceholdersInSQLStatement = countOfPlaceHoldersInSQLStatement(aSQLStatement);
@@ -182,11 +661,38 @@ void StatementExecutor::prepare(const std::string& aSQLStatement)
 			_resultColumns.push_back(MetaColumn(i, PQfname(ptrPGResult, i),
 				oidToColumnDataType(PQftype(ptrPGResult, i)), 0, 0, true));
 		}
+
+		// remember the parameter types for COPY
+		int parameterCount = PQnparams(ptrPGResult);
+		for (int i = 0; i < parameterCount; ++i)
+		{
+			_parameterTypes.push_back(PQparamtype(ptrPGResult, i));
+		}
+	}
+
+	if (_resultColumns.empty() && _parameterTypes.size() == countPlaceholdersInSQLStatement)
+	{
+		_copyStatement = copyStatement(aSQLStatement, countPlaceholdersInSQLStatement);
 	}
 
 	_SQLStatement = aSQLStatement;
 	_preparedStatementName = statementName;
 	_countPlaceholdersInSQLStatement = countPlaceholdersInSQLStatement;
+
+	if (_sessionHandle.statementCacheSize() > 0)
+	{
+		SessionHandle::PreparedStatementPtr pPreparedStatement = std::make_shared<SessionHandle::PreparedStatement>();
+		pPreparedStatement->name = _preparedStatementName;
+		pPreparedStatement->columns = _resultColumns;
+		pPreparedStatement->parameterTypes = _parameterTypes;
+		pPreparedStatement->placeholderCount = _countPlaceholdersInSQLStatement;
+		pPreparedStatement->copyStatement = _copyStatement;
+		if (_sessionHandle.addPreparedStatement(aSQLStatement, pPreparedStatement))
+		{
+			_pPreparedStatement = pPreparedStatement;
+		}
+	}
+
 	_state = STMT_COMPILED;  // must be last
 }
 
@@ -210,47 +716,72 @@ void StatementExecutor::bindParams(const InputParameterVector& anInputParameterV
 
 void StatementExecutor::execute()
 {
-	if (!_sessionHandle.isConnected()) throw NotConnectedException();
-
-	if (_state < STMT_COMPILED) throw StatementException("Statement is not compiled yet");
-
-	if (_countPlaceholdersInSQLStatement != 0 &&
-		_inputParameterVector.size() != _countPlaceholdersInSQLStatement)
+	if (_sent)
 	{
-		throw StatementException("Count of Parameters in Statement different than supplied parameters");
+		// complete the execution started by send()
+		_sent = false;
+		PGresult* pResult = _pReceivedResult;
+		_pReceivedResult = nullptr;
+		if (!_receiveError.empty())
+		{
+			PQResultClear resultClearer(pResult);
+			throw StatementException(std::string("postgresql_stmt_execute error: ") + _receiveError);
+		}
+		setResult(pResult);
+		return;
 	}
 
-	// "transmogrify" the _inputParameterVector to the C format required by PQexecPrepared
+	checkExecutable(_inputParameterVector.size());
 
-	/* - from example
-		const char *paramValues[1];
-		int paramLengths[1];
-		int paramFormats[1];
-	*/
+	if (_pipelined)
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		sendQuery(_inputParameterVector);
+		completePipeline();
+		return;
+	}
 
 	std::vector<const char *> pParameterVector;
 	std::vector<int>  parameterLengthVector;
 	std::vector<int>  parameterFormatVector;
+	toParameterArrays(_inputParameterVector, pParameterVector, parameterLengthVector, parameterFormatVector);
 
-	InputParameterVector::const_iterator cItr    = _inputParameterVector.begin();
-	InputParameterVector::const_iterator cItrEnd = _inputParameterVector.end();
+	// clear out any result data.  One way or another it is now obsolete.
+	clearResults();
 
-	for (; cItr != cItrEnd; ++cItr)
+	if (_streaming && !_resultColumns.empty())
 	{
-		try
-		{
-			pParameterVector.push_back  (static_cast<const char*>(cItr->pInternalRepresentation()));
-			parameterLengthVector.push_back((int)cItr->size());
-			parameterFormatVector.push_back((int)cItr->isBinary() ? 1 : 0);
-		}
-		catch (std::bad_alloc&)
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		// Outside of a transaction block, a query can be cancelled
+		// if the rest of the result is not needed.
+		_cancelStream = PQtransactionStatus(_sessionHandle) == PQTRANS_IDLE;
+
+		if (PQsendQueryPrepared(_sessionHandle,
+			_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+			_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : nullptr,
+			_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : nullptr,
+			_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : nullptr,
+			_binaryExtraction ? 1 : 0) != 1)
 		{
-			throw StatementException("Memory Allocation Error");
+			throw StatementException(std::string("postgresql_stmt_execute error: ") + PQerrorMessage(_sessionHandle));
 		}
-	}
 
-	// clear out any result data.  One way or another it is now obsolete.
-	clearResults();
+#if defined(LIBPQ_HAS_CHUNK_MODE)
+		PQsetChunkedRowsMode(_sessionHandle, STREAMING_CHUNK_SIZE);
+#else
+		PQsetSingleRowMode(_sessionHandle);
+#endif
+		_streamed = true;
+		_streamActive = true;
+
+		// report errors, if any, here rather than in fetch()
+		readStreamResult();
+
+		_state = STMT_EXECUTED;
+		return;
+	}
 
 	PGresult* ptrPGResult = nullptr;
 	{
@@ -264,6 +795,12 @@ void StatementExecutor::execute()
 			_binaryExtraction ? 1 : 0);
 	}
 
+	setResult(ptrPGResult);
+}
+
+
+void StatementExecutor::setResult(PGresult* ptrPGResult)
+{
 	// Don't setup to auto clear the result (ptrPGResult).  It is required to retrieve the results later.
 
 	if (!ptrPGResult || (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
@@ -271,31 +808,17 @@ void StatementExecutor::execute()
 	{
 		PQResultClear resultClearer(ptrPGResult);
 
-		const char* pSeverity	= PQresultErrorField(ptrPGResult, PG_DIAG_SEVERITY);
-		const char* pSQLState	= PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE);
-		const char* pDetail		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_DETAIL);
-		const char* pHint		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_HINT);
-		const char* pConstraint	= PQresultErrorField(ptrPGResult, PG_DIAG_CONSTRAINT_NAME);
-
-				
-		throw StatementException(std::string("postgresql_stmt_execute error: ")
-			+ PQresultErrorMessage (ptrPGResult)
-			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
-			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
-			+ " Detail: " + (pDetail ? pDetail : "N/A")
-			+ " Hint: " + (pHint   ? pHint   : "N/A")
-			+ " Constraint: " + (pConstraint ? pConstraint : "N/A"),pSQLState);
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + errorDetails(ptrPGResult),
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
 	}
 
 	_pResultHandle = ptrPGResult;
 
 	// are there any results?
 
-	int affectedRowCount = 0;
-
 	if (PGRES_TUPLES_OK == PQresultStatus(_pResultHandle))
 	{
-		affectedRowCount = PQntuples(_pResultHandle);
+		int affectedRowCount = PQntuples(_pResultHandle);
 
 		if (affectedRowCount >= 0)
 		{
@@ -303,22 +826,349 @@ void StatementExecutor::execute()
 		}
 	}
 	else
-	{	// non Select DML statments also have an affected row count.
-		// unfortunately PostgreSQL offers up this count as a char * - go figure!
-		const char * pNonSelectAffectedRowCountString = PQcmdTuples(_pResultHandle);
-		if (nullptr != pNonSelectAffectedRowCountString)
-		{
-			if	(	Poco::NumberParser::tryParse(pNonSelectAffectedRowCountString, affectedRowCount)
-				 && affectedRowCount >= 0
-				)
+	{
+		// rows affected by previously queued executions are included
+		_affectedRowCount = affectedRows(_pResultHandle) + _pipelineRowCount;
+		_currentRow = _affectedRowCount;  // no fetching on these statements!
+	}
+	_pipelineRowCount = 0;
+
+	_state = STMT_EXECUTED;
+}
+
+
+bool StatementExecutor::canSend() const
+{
+	return !_streaming || _resultColumns.empty();
+}
+
+
+void StatementExecutor::send(Poco::Net::SocketReactor& reactor, const std::function<void()>& onReceived)
+{
+	checkExecutable(_inputParameterVector.size());
+
+	std::vector<const char *> pParameterVector;
+	std::vector<int>  parameterLengthVector;
+	std::vector<int>  parameterFormatVector;
+	toParameterArrays(_inputParameterVector, pParameterVector, parameterLengthVector, parameterFormatVector);
+
+	// clear out any result data.  One way or another it is now obsolete.
+	clearResults();
+	_receiveError.clear();
+	_receiveAborted = false;
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+	if (PQsendQueryPrepared(_sessionHandle,
+		_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+		_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : nullptr,
+		_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : nullptr,
+		_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : nullptr,
+		_binaryExtraction ? 1 : 0) != 1)
+	{
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + PQerrorMessage(_sessionHandle));
+	}
+
+	ResultReceiver* pReceiver = nullptr;
+	try
+	{
+		pReceiver = new ResultReceiver(reactor, PQsocket(_sessionHandle),
+			[this]() { return receive(); },
+			[this]() { abandonReceive(); },
+			onReceived);
+	}
+	catch (...)
+	{
+		// wait for the result, so that the connection can be used again
+		while (PGresult* pResult = PQgetResult(_sessionHandle)) PQclear(pResult);
+		throw;
+	}
+
+	// If the session is closed or reset, shutting down the duplicated
+	// socket makes it readable, and the reactor completes the result.
+	_sessionHandle.setPendingAbort([this, socket = pReceiver->socket()]() mutable
+		{
+			_receiveAborted = true;
+			try
+			{
+				socket.impl()->shutdown();
+			}
+			catch (...)
+			{
+			}
+		});
+	_sent = true;
+	pReceiver->start();
+}
+
+
+bool StatementExecutor::receive()
+{
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+	bool complete = true;
+	if (_receiveAborted)
+	{
+		_receiveError = "session closed before the result was received";
+	}
+	else if (PQconsumeInput(_sessionHandle) != 1)
+	{
+		_receiveError = PQerrorMessage(_sessionHandle);
+	}
+	else
+	{
+		complete = false;
+		while (!complete && !PQisBusy(_sessionHandle))
+		{
+			PGresult* pResult = PQgetResult(_sessionHandle);
+			if (!pResult)
+				complete = true;
+			// a prepared statement has a single result
+			else if (_pReceivedResult)
+				PQclear(pResult);
+			else
+				_pReceivedResult = pResult;
+		}
+	}
+	if (complete) _sessionHandle.setPendingAbort(nullptr);
+	return complete;
+}
+
+
+void StatementExecutor::abandonReceive()
+{
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		_sessionHandle.setPendingAbort(nullptr);
+		_receiveError = "reactor stopped before the result was received";
+		if (_receiveAborted || !static_cast<PGconn*>(_sessionHandle)) return;
+	}
+
+	// cancel the statement and discard its result,
+	// so that the session can be used again
+	_sessionHandle.cancel();
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	if (_receiveAborted || !static_cast<PGconn*>(_sessionHandle)) return;
+	while (PGresult* pResult = PQgetResult(_sessionHandle)) PQclear(pResult);
+}
+
+
+void StatementExecutor::queue()
+{
+	checkExecutable(_inputParameterVector.size());
+
+	if (!_resultColumns.empty())
+	{
+		throw StatementException("Statements returning columns cannot be queued: " + _SQLStatement);
+	}
+
+#if defined(LIBPQ_HAS_PIPELINING)
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+	enterPipeline();
+	sendQuery(_inputParameterVector);
+	if (_pendingCount >= 2*PIPELINE_WINDOW)
+	{
+		readPipelineResults(PIPELINE_WINDOW);
+	}
+#else
+	execute();
+	_pipelineRowCount = _affectedRowCount;
+#endif
+}
+
+
+void StatementExecutor::discardQueue()
+{
+	_pipelineRowCount = 0;
+
+#if defined(LIBPQ_HAS_PIPELINING)
+	if (!_pipelined) return;
+
+	try
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		if (_pipelineSynced || PQpipelineSync(_sessionHandle) == 1)
+		{
+			// Read and discard all results up to the sync point. Two
+			// consecutive null results mean that nothing is left to read,
+			// e.g. because the connection has been lost.
+			bool lastWasNull = false;
+			for (;;)
+			{
+				PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+				if (!ptrPGResult)
+				{
+					if (lastWasNull) break;
+					lastWasNull = true;
+					continue;
+				}
+				lastWasNull = false;
+				ExecStatusType status = PQresultStatus(ptrPGResult);
+				PQclear(ptrPGResult);
+				if (status == PGRES_PIPELINE_SYNC) break;
+			}
+		}
+		PQexitPipelineMode(_sessionHandle);
+	}
+	catch (...)
+	{
+	}
+
+	_pipelined = false;
+	_pipelineSynced = false;
+	_pendingCount = 0;
+#endif
+}
+
+
+bool StatementExecutor::copyBulk(const std::vector<InputParameterVector>& rows)
+{
+	if (!_bulkCopy || _copyStatement.empty() || rows.empty()) return false;
+
+	for (const auto& row: rows)
+	{
+		checkExecutable(row.size());
+	}
+
+	bool integerDateTimes = _sessionHandle.parameterStatus("integer_datetimes") == "on";
+	for (const auto& row: rows)
+	{
+		for (std::size_t i = 0; i < row.size(); ++i)
+		{
+			if (!canCopy(row[i].fieldType(), _parameterTypes[i], integerDateTimes)) return false;
+		}
+	}
+
+	// clear out any result data.  One way or another it is now obsolete.
+	clearResults();
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+	{
+		PGresult* ptrPGResult = PQexec(_sessionHandle, _copyStatement.c_str());
+		PQResultClear resultClearer(ptrPGResult);
+
+		if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COPY_IN)
+		{
+			throw StatementException(std::string("postgresql_stmt_copy error: ") + errorDetails(ptrPGResult) + " " + _copyStatement,
+				PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+		}
+	}
+
+	try
+	{
+		std::string buffer;
+		buffer.reserve(COPY_CHUNK_SIZE + 4096);
+
+		// header: signature, flags, header extension length
+		static const char SIGNATURE[] = "PGCOPY\n\377\r\n";
+		buffer.append(SIGNATURE, sizeof(SIGNATURE));
+		append(buffer, static_cast<Poco::Int32>(0));
+		append(buffer, static_cast<Poco::Int32>(0));
+
+		for (const auto& row: rows)
+		{
+			append(buffer, static_cast<Poco::Int16>(row.size()));
+			for (std::size_t i = 0; i < row.size(); ++i)
 			{
-				_affectedRowCount = static_cast<std::size_t>(affectedRowCount);
-				_currentRow = _affectedRowCount;  // no fetching on these statements!
+				appendValue(buffer, row[i], _parameterTypes[i]);
 			}
+
+			if (buffer.size() >= COPY_CHUNK_SIZE || &row == &rows.back())
+			{
+				if (&row == &rows.back())
+				{
+					append(buffer, static_cast<Poco::Int16>(-1)); // trailer
+				}
+				if (PQputCopyData(_sessionHandle, buffer.data(), static_cast<int>(buffer.size())) != 1)
+				{
+					throw StatementException(std::string("postgresql_stmt_copy error: ") + PQerrorMessage(_sessionHandle));
+				}
+				buffer.clear();
+			}
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		// abort the COPY and discard its result
+		PQputCopyEnd(_sessionHandle, exc.message().c_str());
+		while (PGresult* ptrPGResult = PQgetResult(_sessionHandle)) PQclear(ptrPGResult);
+		throw;
+	}
+	catch (...)
+	{
+		PQputCopyEnd(_sessionHandle, "COPY aborted by client");
+		while (PGresult* ptrPGResult = PQgetResult(_sessionHandle)) PQclear(ptrPGResult);
+		throw;
+	}
+
+	if (PQputCopyEnd(_sessionHandle, nullptr) != 1)
+	{
+		throw StatementException(std::string("postgresql_stmt_copy error: ") + PQerrorMessage(_sessionHandle));
+	}
+
+	PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+	{
+		PQResultClear resultClearer(ptrPGResult);
+		while (PGresult* ptrNextResult = PQgetResult(_sessionHandle)) PQclear(ptrNextResult);
+
+		if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK)
+		{
+			throw StatementException(std::string("postgresql_stmt_copy error: ") + errorDetails(ptrPGResult) + " " + _copyStatement,
+				PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
 		}
+
+		_affectedRowCount = affectedRows(ptrPGResult);
+		_currentRow = _affectedRowCount;
 	}
 
 	_state = STMT_EXECUTED;
+	return true;
+}
+
+
+void StatementExecutor::executeBulk(const std::vector<InputParameterVector>& rows)
+{
+	if (!_resultColumns.empty())
+	{
+		throw StatementException("Bulk binding is not supported for statements returning columns: " + _SQLStatement);
+	}
+
+	for (const auto& row: rows)
+	{
+		checkExecutable(row.size());
+	}
+
+	clearResults();
+
+#if defined(LIBPQ_HAS_PIPELINING)
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+	enterPipeline();
+	for (const auto& row: rows)
+	{
+		sendQuery(row);
+		if (_pendingCount >= 2*PIPELINE_WINDOW)
+		{
+			readPipelineResults(PIPELINE_WINDOW);
+		}
+	}
+	completePipeline();
+#else
+	std::size_t affectedRowCount = 0;
+	for (const auto& row: rows)
+	{
+		_inputParameterVector = row;
+		execute();
+		affectedRowCount += _affectedRowCount;
+	}
+	_affectedRowCount = affectedRowCount;
+	_currentRow = _affectedRowCount;
+#endif
 }
 
 
@@ -343,15 +1193,32 @@ bool StatementExecutor::fetch()
 		_outputParameterVector.resize(countColumns);
 	}
 
-	// already retrieved last row?
-	if (_currentRow == getAffectedRowCount())
+	if (_streamed)
 	{
-		return false;
-	}
+		if (0 == countColumns) return false;
+
+		// receive the next row(s) if the current ones have been retrieved
+		while (_currentRow >= static_cast<std::size_t>(PQntuples(_pResultHandle)))
+		{
+			if (!_streamActive) return false;
 
-	if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+			Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+			readStreamResult();
+		}
+		++_affectedRowCount;
+	}
+	else
 	{
-		return false;
+		// already retrieved last row?
+		if (_currentRow == getAffectedRowCount())
+		{
+			return false;
+		}
+
+		if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+		{
+			return false;
+		}
 	}
 
 	for (int i = 0; i < countColumns; ++i)
@@ -407,12 +1274,198 @@ const OutputParameter& StatementExecutor::resultColumn(std::size_t aPosition) co
 }
 
 
+void StatementExecutor::checkExecutable(std::size_t parameterCount) const
+{
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+	if (_state < STMT_COMPILED) throw StatementException("Statement is not compiled yet");
+
+	if (_countPlaceholdersInSQLStatement != 0 &&
+		parameterCount != _countPlaceholdersInSQLStatement)
+	{
+		throw StatementException("Count of Parameters in Statement different than supplied parameters");
+	}
+}
+
+
+void StatementExecutor::sendQuery(const InputParameterVector& parameters)
+{
+#if defined(LIBPQ_HAS_PIPELINING)
+	std::vector<const char*> values;
+	std::vector<int> lengths;
+	std::vector<int> formats;
+	toParameterArrays(parameters, values, lengths, formats);
+
+	if (PQsendQueryPrepared(_sessionHandle,
+		_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+		values.empty() ? nullptr : values.data(),
+		lengths.empty() ? nullptr : lengths.data(),
+		formats.empty() ? nullptr : formats.data(),
+		_binaryExtraction ? 1 : 0) != 1)
+	{
+		throw StatementException(std::string("postgresql_stmt_queue error: ") + PQerrorMessage(_sessionHandle));
+	}
+
+	++_sentCount;
+	++_pendingCount;
+
+	// Let the server send the results of the last batch while we are
+	// sending the next one.
+	if (_sentCount % PIPELINE_WINDOW == 0)
+	{
+		PQsendFlushRequest(_sessionHandle);
+		PQflush(_sessionHandle);
+	}
+#endif
+}
+
+
+void StatementExecutor::enterPipeline()
+{
+#if defined(LIBPQ_HAS_PIPELINING)
+	if (_pipelined) return;
+
+	clearResults();
+
+	if (PQenterPipelineMode(_sessionHandle) != 1)
+	{
+		throw StatementException(std::string("postgresql_stmt_queue error: ") + PQerrorMessage(_sessionHandle));
+	}
+
+	_pipelined = true;
+	_pipelineSynced = false;
+	_sentCount = 0;
+	_pendingCount = 0;
+	_pipelineRowCount = 0;
+#endif
+}
+
+
+void StatementExecutor::readPipelineResults(std::size_t count)
+{
+#if defined(LIBPQ_HAS_PIPELINING)
+	for (; count > 0; --count)
+	{
+		PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+		PQResultClear resultClearer(ptrPGResult);
+		--_pendingCount;
+
+		if (!ptrPGResult || (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
+			PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK))
+		{
+			throw StatementException(std::string("postgresql_stmt_execute error: ") +
+				(ptrPGResult ? errorDetails(ptrPGResult) : std::string(PQerrorMessage(_sessionHandle))),
+				PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+		}
+
+		_pipelineRowCount += affectedRows(ptrPGResult);
+
+		// a null result ends the results of each query
+		while (PGresult* ptrNextResult = PQgetResult(_sessionHandle)) PQclear(ptrNextResult);
+	}
+#endif
+}
+
+
+void StatementExecutor::completePipeline()
+{
+#if defined(LIBPQ_HAS_PIPELINING)
+	if (PQpipelineSync(_sessionHandle) != 1)
+	{
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + PQerrorMessage(_sessionHandle));
+	}
+	_pipelineSynced = true;
+
+	readPipelineResults(_pendingCount);
+
+	{
+		PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+		PQResultClear resultClearer(ptrPGResult);
+		if (!ptrPGResult || PQresultStatus(ptrPGResult) != PGRES_PIPELINE_SYNC)
+		{
+			throw StatementException("postgresql_stmt_execute error: pipeline synchronization failed");
+		}
+	}
+
+	PQexitPipelineMode(_sessionHandle);
+	_pipelined = false;
+	_pipelineSynced = false;
+
+	_affectedRowCount = _pipelineRowCount;
+	_currentRow = _affectedRowCount;
+	_pipelineRowCount = 0;
+	_state = STMT_EXECUTED;
+#endif
+}
+
+
+void StatementExecutor::readStreamResult()
+{
+	{
+		PQResultClear resultClearer(_pResultHandle);
+	}
+	_pResultHandle = nullptr;
+	_currentRow = 0;
+
+	PGresult* ptrPGResult = PQgetResult(_sessionHandle);
+	ExecStatusType status = ptrPGResult ? PQresultStatus(ptrPGResult) : PGRES_FATAL_ERROR;
+
+#if defined(LIBPQ_HAS_CHUNK_MODE)
+	if (status == PGRES_SINGLE_TUPLE || status == PGRES_TUPLES_CHUNK)
+#else
+	if (status == PGRES_SINGLE_TUPLE)
+#endif
+	{
+		_pResultHandle = ptrPGResult;
+		return;
+	}
+
+	// This is the last result of the query (containing no rows),
+	// which is followed by a null result.
+	_streamActive = false;
+	while (PGresult* ptrNextResult = PQgetResult(_sessionHandle)) PQclear(ptrNextResult);
+
+	if (status != PGRES_TUPLES_OK)
+	{
+		PQResultClear resultClearer(ptrPGResult);
+
+		throw StatementException(std::string("postgresql_stmt_execute error: ") +
+			(ptrPGResult ? errorDetails(ptrPGResult) : std::string(PQerrorMessage(_sessionHandle))),
+			PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE));
+	}
+
+	_pResultHandle = ptrPGResult;
+}
+
+
+void StatementExecutor::discardStream()
+{
+	if (!_streamActive) return;
+
+	_streamActive = false;
+	try
+	{
+		if (_cancelStream) _sessionHandle.cancel();
+
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		while (PGresult* ptrPGResult = PQgetResult(_sessionHandle)) PQclear(ptrPGResult);
+	}
+	catch (...)
+	{
+	}
+}
+
+
 void StatementExecutor::clearResults()
 {
+	discardStream();
+
 	// clear out any old result first
 	{
 		PQResultClear resultClearer(_pResultHandle);
 	}
+	_pResultHandle = nullptr;
+	_streamed = false;
 
 	_outputParameterVector.clear();
 	_affectedRowCount	= 0;
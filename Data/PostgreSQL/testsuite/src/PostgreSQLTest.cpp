@@ -24,6 +24,8 @@
 #include "Poco/Data/PostgreSQL/PostgreSQLException.h"
 #include "Poco/Nullable.h"
 #include "Poco/Data/DataException.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Thread.h"
 #include <iostream>
 
 #include "Poco/Data/Transaction.h"
@@ -1147,6 +1149,343 @@ void PostgreSQLTest::testBinaryBLOBStmt()
 	_pExecutor->blobStmt();
 }
 
+
+void PostgreSQLTest::testBulkCopy()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+	_pSession->setFeature("bulk", true);
+
+	std::vector<std::string> lastNames;
+	std::vector<std::string> firstNames;
+	std::vector<std::string> addresses;
+	std::vector<int> ages;
+	Poco::Int64 ageSum = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		lastNames.push_back(format("LN%d", i));
+		firstNames.push_back(format("FN%d", i));
+		addresses.push_back(format("Address %d", i));
+		ages.push_back(i % 100);
+		ageSum += i % 100;
+	}
+
+	Statement stmt = (*_pSession << "INSERT INTO Person (LastName, FirstName, Address, Age) VALUES ($1, $2, $3, $4)",
+		use(lastNames, bulk), use(firstNames, bulk), use(addresses, bulk), use(ages, bulk));
+	assertTrue (stmt.execute() == 1000);
+
+	int count = 0;
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 1000);
+	Poco::Int64 sum = 0;
+	*_pSession << "SELECT SUM(Age) FROM Person", into(sum), now;
+	assertTrue (sum == ageSum);
+	std::string address;
+	*_pSession << "SELECT Address FROM Person WHERE LastName = 'LN999'", into(address), now;
+	assertTrue (address == "Address 999");
+
+	// COPY is atomic
+	addresses[500] = std::string(100, 'x');
+	try
+	{
+		stmt.execute();
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 1000);
+	_pSession->setFeature("bulk", false);
+}
+
+
+void PostgreSQLTest::testBulkPipeline()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+	_pSession->setFeature("bulk", true);
+
+	std::vector<std::string> lastNames;
+	std::vector<std::string> firstNames;
+	std::vector<std::string> addresses;
+	std::vector<int> ages;
+	Poco::Int64 ageSum = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		lastNames.push_back(format("LN%d", i));
+		firstNames.push_back(format("FN%d", i));
+		addresses.push_back(format("Address %d", i));
+		ages.push_back(i % 100);
+		ageSum += i % 100;
+	}
+
+	// not eligible for COPY - sent in pipeline mode
+	_pSession->setFeature("bulkCopy", false);
+	Statement stmt = (*_pSession << "INSERT INTO Person VALUES ($1, $2, $3, $4)",
+		use(lastNames, bulk), use(firstNames, bulk), use(addresses, bulk), use(ages, bulk));
+	assertTrue (stmt.execute() == 1000);
+	_pSession->setFeature("bulkCopy", true);
+
+	int count = 0;
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 1000);
+	Poco::Int64 sum = 0;
+	*_pSession << "SELECT SUM(Age) FROM Person", into(sum), now;
+	assertTrue (sum == ageSum);
+
+	// with pipelining, rows of containers bound one at a time are queued as well
+	assertTrue (!_pSession->getFeature("pipelining"));
+	_pSession->setFeature("pipelining", true);
+	recreatePersonTable();
+	Statement stmt2 = (*_pSession << "INSERT INTO Person VALUES ($1, $2, $3, $4)",
+		use(lastNames), use(firstNames), use(addresses), use(ages));
+	assertTrue (stmt2.execute() == 1000);
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 1000);
+	*_pSession << "SELECT SUM(Age) FROM Person", into(sum), now;
+	assertTrue (sum == ageSum);
+
+	// a failing row aborts the pipeline, the session remains usable
+	recreatePersonTable();
+	addresses[500] = std::string(100, 'x');
+	try
+	{
+		*_pSession << "INSERT INTO Person VALUES ($1, $2, $3, $4)",
+			use(lastNames), use(firstNames), use(addresses), use(ages), now;
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 0);
+	_pSession->setFeature("pipelining", false);
+
+	// without pipelining, the rows before the failing one are committed
+	try
+	{
+		*_pSession << "INSERT INTO Person VALUES ($1, $2, $3, $4)",
+			use(lastNames), use(firstNames), use(addresses), use(ages), now;
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 500);
+	_pSession->setFeature("bulk", false);
+}
+
+
+void PostgreSQLTest::testStreaming()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+
+	std::vector<std::string> lastNames;
+	std::vector<int> ages;
+	Poco::Int64 ageSum = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		lastNames.push_back(format("LN%d", i));
+		ages.push_back(i % 100);
+		ageSum += i % 100;
+	}
+	_pSession->setFeature("bulk", true);
+	*_pSession << "INSERT INTO Person (LastName, Age) VALUES ($1, $2)", use(lastNames, bulk), use(ages, bulk), now;
+	_pSession->setFeature("bulk", false);
+
+	_pSession->setFeature("streaming", true);
+	_pSession->setFeature("binaryExtraction", true);
+
+	{
+		std::string lastName;
+		Poco::Int64 age = 0; // integer column, extracted directly
+		int count = 0;
+		Poco::Int64 sum = 0;
+		Statement stmt = (*_pSession << "SELECT LastName, Age FROM Person", into(lastName), into(age), range(0, 1));
+		while (!stmt.done())
+		{
+			if (stmt.execute() == 1)
+			{
+				++count;
+				sum += age;
+			}
+		}
+		assertTrue (count == 1000);
+		assertTrue (sum == ageSum);
+	}
+
+	{
+		// partially read result is discarded
+		std::vector<int> someAges;
+		Statement stmt = (*_pSession << "SELECT Age FROM Person", into(someAges), limit(10));
+		stmt.execute();
+		assertTrue (someAges.size() == 10);
+	}
+
+	_pSession->setFeature("streaming", false);
+
+	int count = 0;
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 1000);
+}
+
+
+void PostgreSQLTest::testStatementCache()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+
+	assertTrue (0 == Poco::AnyCast<int>(_pSession->getProperty("statementCacheSize")));
+	_pSession->setProperty("statementCacheSize", 2);
+	assertTrue (2 == Poco::AnyCast<int>(_pSession->getProperty("statementCacheSize")));
+
+	for (int i = 0; i < 10; ++i)
+	{
+		std::string lastName = format("LN%d", i);
+		*_pSession << "INSERT INTO Person (LastName, Age) VALUES ($1, $2)", use(lastName), use(i), now;
+	}
+
+	int count = 0;
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 10);
+
+	// the INSERT statement has been evicted by the two most recent ones
+	int prepared = 0;
+	*_pSession << "SELECT COUNT(*) FROM pg_prepared_statements", into(prepared), now;
+	assertTrue (prepared == 2);
+	*_pSession << "SELECT COUNT(*) FROM pg_prepared_statements", into(prepared), now;
+	assertTrue (prepared == 2);
+
+	_pSession->setProperty("statementCacheSize", 0);
+	*_pSession << "SELECT COUNT(*) FROM pg_prepared_statements", into(prepared), now;
+	assertTrue (prepared == 1);
+}
+
+
+void PostgreSQLTest::testAsyncReactor()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+	for (int i = 0; i < 10; ++i)
+	{
+		std::string lastName = format("LN%d", i);
+		*_pSession << "INSERT INTO Person (LastName, Age) VALUES ($1, $2)", use(lastName), use(i), now;
+	}
+
+	Poco::Net::SocketReactor reactor;
+	Poco::Thread thread;
+	thread.start(reactor);
+
+	// more statements than threads in the default thread pool
+	const int sessionCount = 24;
+	std::vector<Session> sessions;
+	std::vector<Statement> statements;
+	std::vector<int> ages(sessionCount);
+	std::vector<int> sums(sessionCount);
+	for (int i = 0; i < sessionCount; ++i)
+	{
+		sessions.emplace_back(PostgreSQL::Connector::KEY, _dbConnString);
+		sessions.back().setProperty("reactor", &reactor);
+		ages[i] = i;
+		statements.push_back((sessions.back() << "SELECT SUM(Age) + $1 FROM Person, pg_sleep(0.5)", use(ages[i]), into(sums[i])));
+	}
+	for (auto& stmt: statements) stmt.executeAsync();
+	for (int i = 0; i < sessionCount; ++i)
+	{
+		assertTrue (statements[i].wait() == 1);
+		assertTrue (sums[i] == 45 + i);
+	}
+
+	// multiple rows
+	std::vector<std::string> lastNames;
+	Statement stmt = (sessions[0] << "SELECT LastName FROM Person ORDER BY Age", into(lastNames));
+	Statement::Result result = stmt.executeAsync();
+	result.wait();
+	assertTrue (result.data() == 10);
+	assertTrue (lastNames.size() == 10);
+	assertTrue (lastNames[9] == "LN9");
+
+	// the statement can be executed again
+	lastNames.clear();
+	stmt.executeAsync();
+	assertTrue (stmt.wait() == 10);
+	assertTrue (lastNames.size() == 10);
+
+	// errors are reported by the result
+	int one = 1;
+	int value = 0;
+	Statement failing = (sessions[1] << "SELECT 1/($1 - 1)", use(one), into(value));
+	failing.executeAsync();
+	try
+	{
+		failing.wait();
+		fail ("must fail");
+	}
+	catch (Poco::Exception& exc)
+	{
+		assertTrue (exc.message().find("division by zero") != std::string::npos);
+	}
+	sessions[1] << "SELECT 1", into(value), now;
+	assertTrue (value == 1);
+
+	// closing the session fails the pending execution
+	Statement closed = (sessions[2] << "SELECT 1 FROM pg_sleep(10)", into(value));
+	closed.executeAsync();
+	sessions[2].close();
+	try
+	{
+		closed.wait(5000);
+		fail ("must fail");
+	}
+	catch (Poco::TimeoutException&)
+	{
+		fail ("must not time out");
+	}
+	catch (Poco::Exception&)
+	{
+	}
+
+	reactor.stop();
+	thread.join();
+
+	// stopping the reactor fails the pending execution,
+	// and the session can be used again
+	Poco::Net::SocketReactor stoppedReactor;
+	Poco::Thread stoppedThread;
+	stoppedThread.start(stoppedReactor);
+	Session session(PostgreSQL::Connector::KEY, _dbConnString);
+	session.setProperty("reactor", &stoppedReactor);
+	Statement stopped = (session << "SELECT 1 FROM pg_sleep(10)", into(value));
+	stopped.executeAsync();
+	stoppedReactor.stop();
+	stoppedThread.join();
+	try
+	{
+		stopped.wait(5000);
+		fail ("must fail");
+	}
+	catch (Poco::TimeoutException&)
+	{
+		fail ("must not time out");
+	}
+	catch (Poco::Exception& exc)
+	{
+		assertTrue (exc.message().find("reactor stopped") != std::string::npos);
+	}
+	value = 0;
+	session << "SELECT 2", into(value), now;
+	assertTrue (value == 2);
+}
+
+
 void PostgreSQLTest::dropTable(const std::string& tableName)
 {
 	try
@@ -1319,6 +1658,8 @@ void PostgreSQLTest::tearDown()
 	dropTable("Person");
 	dropTable("Strings");
 	_pSession->setFeature("binaryExtraction", false);
+	_pSession->setFeature("bulkCopy", true);
+	_pSession->setFeature("streaming", false);
 }
 
 
@@ -1418,6 +1759,12 @@ CppUnit::Test* PostgreSQLTest::suite()
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinaryCLOBStmt);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinaryBLOBStmt);
 
+	CppUnit_addTest(pSuite, PostgreSQLTest, testBulkCopy);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testBulkPipeline);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testStreaming);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testStatementCache);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testAsyncReactor);
+
 	CppUnit_addTest(pSuite, PostgreSQLTest, testSessionTransaction);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testSessionTransactionNoAutoCommit);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testTransaction);
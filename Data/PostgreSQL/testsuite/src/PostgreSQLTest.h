@@ -113,6 +113,12 @@ public:
 	void testBinaryBLOBStmt();
 	void testBinaryCLOBStmt();
 
+	void testBulkCopy();
+	void testBulkPipeline();
+	void testStreaming();
+	void testStatementCache();
+	void testAsyncReactor();
+
 	void testSessionTransaction();
 	void testSessionTransactionNoAutoCommit();
 	void testTransaction();
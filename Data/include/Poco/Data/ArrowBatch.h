@@ -0,0 +1,178 @@
+//
+// ArrowBatch.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowBatch
+//
+// Definition of the ArrowBatch class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ArrowBatch_INCLUDED
+#define Data_ArrowBatch_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/ArrowColumn.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+
+//
+// Structures of the Arrow C Data Interface
+// (see https://arrow.apache.org/docs/format/CDataInterface.html).
+// The definitions are ABI-stable and identical to the ones in
+// the Arrow headers, which may be included instead.
+//
+
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+
+struct ArrowSchema
+{
+	const char* format;
+	const char* name;
+	const char* metadata;
+	int64_t flags;
+	int64_t n_children;
+	struct ArrowSchema** children;
+	struct ArrowSchema* dictionary;
+	void (*release)(struct ArrowSchema*);
+	void* private_data;
+};
+
+
+struct ArrowArray
+{
+	int64_t length;
+	int64_t null_count;
+	int64_t offset;
+	int64_t n_buffers;
+	int64_t n_children;
+	const void** buffers;
+	struct ArrowArray** children;
+	struct ArrowArray* dictionary;
+	void (*release)(struct ArrowArray*);
+	void* private_data;
+};
+
+
+#endif // ARROW_C_DATA_INTERFACE
+
+
+namespace Poco::Data {
+
+
+class RecordSet;
+
+
+class Data_API ArrowBatch
+	/// A batch of ArrowColumn objects of equal length, corresponding
+	/// to a record batch in Apache Arrow.
+	///
+	/// An ArrowBatch can be created from a RecordSet, in which case
+	/// the values of all columns are copied column by column, directly
+	/// from the extracted data, into the contiguous buffers of the
+	/// ArrowColumn objects. If the RecordSet has a filter, only the
+	/// rows allowed by the filter are included.
+	///
+	/// The batch can then be handed to Arrow-based code without
+	/// further copies through the Arrow C Data Interface (see exportTo()),
+	/// or written to an Arrow IPC stream with ArrowStreamWriter.
+{
+public:
+	using ColumnPtr = std::shared_ptr<ArrowColumn>;
+
+	ArrowBatch();
+		/// Creates an empty ArrowBatch.
+
+	explicit ArrowBatch(const RecordSet& recordSet);
+		/// Creates an ArrowBatch containing all columns and rows of
+		/// the given RecordSet.
+		///
+		/// Throws a NotImplementedException if the RecordSet
+		/// contains a column with an unsupported type.
+
+	~ArrowBatch();
+		/// Destroys the ArrowBatch.
+
+	ArrowColumn& addColumn(const std::string& name, MetaColumn::ColumnDataType type);
+		/// Adds an empty column and returns a reference to it.
+
+	std::size_t columnCount() const;
+		/// Returns the number of columns.
+
+	std::size_t length() const;
+		/// Returns the number of rows, which is the length of the
+		/// first column, or 0 if the batch has no columns.
+
+	const ArrowColumn& column(std::size_t pos) const;
+		/// Returns the column at the given position.
+
+	ArrowColumn& column(std::size_t pos);
+		/// Returns the column at the given position.
+
+	void exportTo(struct ArrowArray* pArray, struct ArrowSchema* pSchema) const;
+		/// Exports the batch as a struct array through the Arrow C Data
+		/// Interface, with one child array per column.
+		///
+		/// The exported arrays refer to the buffers of the columns, which
+		/// are kept alive until the consumer calls the release callbacks,
+		/// even if the ArrowBatch is destroyed earlier. The columns must
+		/// not be modified after the batch has been exported.
+		///
+		/// Throws a RangeException if the columns are not all of
+		/// the same length.
+
+private:
+	void checkLength() const;
+
+	std::vector<ColumnPtr> _columns;
+};
+
+
+//
+// inlines
+//
+inline std::size_t ArrowBatch::columnCount() const
+{
+	return _columns.size();
+}
+
+
+inline std::size_t ArrowBatch::length() const
+{
+	return _columns.empty() ? 0 : _columns.front()->length();
+}
+
+
+inline const ArrowColumn& ArrowBatch::column(std::size_t pos) const
+{
+	return *_columns.at(pos);
+}
+
+
+inline ArrowColumn& ArrowBatch::column(std::size_t pos)
+{
+	return *_columns.at(pos);
+}
+
+
+} // namespace Poco::Data
+
+
+#endif // Data_ArrowBatch_INCLUDED
@@ -0,0 +1,234 @@
+//
+// ArrowColumn.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowColumn
+//
+// Definition of the ArrowColumn class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ArrowColumn_INCLUDED
+#define Data_ArrowColumn_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/MetaColumn.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/DateTime.h"
+#include "Poco/UUID.h"
+#include "Poco/UTFString.h"
+#include <string>
+#include <vector>
+
+
+namespace Poco::Data {
+
+
+class Data_API ArrowColumn
+	/// A column of values in the columnar memory layout of
+	/// Apache Arrow (see https://arrow.apache.org/docs/format/Columnar.html).
+	///
+	/// Values are stored in contiguous buffers:
+	///   - a validity bitmap, with a bit set for every value that is
+	///     not null. The bitmap is only allocated when the first null
+	///     value is appended.
+	///   - for strings and binary data, the offsets of the values
+	///     (length() + 1 Int32 values).
+	///   - the values. Boolean values are stored as a bitmap.
+	///
+	/// The Arrow type of the column is determined by the
+	/// MetaColumn::ColumnDataType given at construction:
+	///
+	///   FDT_BOOL                         bool
+	///   FDT_INT8 ... FDT_UINT64          int8 ... uint64
+	///   FDT_FLOAT, FDT_DOUBLE            float32, float64
+	///   FDT_STRING, FDT_WSTRING,
+	///   FDT_CLOB, FDT_JSON               utf8
+	///   FDT_BLOB                         binary
+	///   FDT_DATE                         date32 (days since the Unix epoch)
+	///   FDT_TIME                         time32 (seconds since midnight)
+	///   FDT_TIMESTAMP                    timestamp (microseconds since the Unix epoch)
+	///   FDT_UUID                         fixed_size_binary(16)
+{
+public:
+	ArrowColumn(const std::string& name, MetaColumn::ColumnDataType type);
+		/// Creates an empty ArrowColumn.
+		///
+		/// Throws a NotImplementedException if the type
+		/// is not supported.
+
+	~ArrowColumn();
+		/// Destroys the ArrowColumn.
+
+	const std::string& name() const;
+		/// Returns the column name.
+
+	MetaColumn::ColumnDataType type() const;
+		/// Returns the column type.
+
+	const char* format() const;
+		/// Returns the format string of the column type, as
+		/// specified by the Arrow C Data Interface.
+
+	std::size_t length() const;
+		/// Returns the number of values, including null values.
+
+	std::size_t nullCount() const;
+		/// Returns the number of null values.
+
+	bool isNull(std::size_t row) const;
+		/// Returns true if the value in the given row is null.
+
+	const std::vector<Poco::UInt8>& validity() const;
+		/// Returns the validity bitmap, which is empty if
+		/// the column does not contain null values.
+
+	const std::vector<Poco::Int32>& offsets() const;
+		/// Returns the value offsets for strings and binary data,
+		/// or an empty vector for fixed-size types.
+
+	const std::vector<char>& values() const;
+		/// Returns the values buffer.
+
+	void reserve(std::size_t rows);
+		/// Reserves memory for the given number of fixed-size values.
+
+	void appendNull();
+		/// Appends a null value.
+
+	void append(bool value);
+	void append(Poco::Int8 value);
+	void append(Poco::UInt8 value);
+	void append(Poco::Int16 value);
+	void append(Poco::UInt16 value);
+	void append(Poco::Int32 value);
+	void append(Poco::UInt32 value);
+	void append(Poco::Int64 value);
+	void append(Poco::UInt64 value);
+	void append(float value);
+	void append(double value);
+	void append(const std::string& value);
+	void append(const UTF16String& value);
+	void append(const BLOB& value);
+	void append(const CLOB& value);
+	void append(const Date& value);
+	void append(const Time& value);
+	void append(const DateTime& value);
+	void append(const UUID& value);
+		/// Appends a value.
+		///
+		/// Throws an InvalidArgumentException if the type of the
+		/// value does not match the column type (e.g., an Int64
+		/// value appended to an FDT_INT32 column).
+
+private:
+	ArrowColumn() = delete;
+
+	void appendFixed(MetaColumn::ColumnDataType type, const void* value, std::size_t size);
+	void appendVariable(const char* value, std::size_t size);
+	void appendValidity(bool valid);
+	void checkType(MetaColumn::ColumnDataType type) const;
+	bool isVariableLength() const;
+
+	std::string _name;
+	MetaColumn::ColumnDataType _type;
+	std::size_t _width;
+	std::size_t _length;
+	std::size_t _nullCount;
+	std::vector<Poco::UInt8> _validity;
+	std::vector<Poco::Int32> _offsets;
+	std::vector<char> _values;
+};
+
+
+//
+// inlines
+//
+inline const std::string& ArrowColumn::name() const
+{
+	return _name;
+}
+
+
+inline MetaColumn::ColumnDataType ArrowColumn::type() const
+{
+	return _type;
+}
+
+
+inline std::size_t ArrowColumn::length() const
+{
+	return _length;
+}
+
+
+inline std::size_t ArrowColumn::nullCount() const
+{
+	return _nullCount;
+}
+
+
+inline bool ArrowColumn::isNull(std::size_t row) const
+{
+	return !_validity.empty() && (_validity[row/8] & (1 << (row % 8))) == 0;
+}
+
+
+inline const std::vector<Poco::UInt8>& ArrowColumn::validity() const
+{
+	return _validity;
+}
+
+
+inline const std::vector<Poco::Int32>& ArrowColumn::offsets() const
+{
+	return _offsets;
+}
+
+
+inline const std::vector<char>& ArrowColumn::values() const
+{
+	return _values;
+}
+
+
+inline void ArrowColumn::appendValidity(bool valid)
+{
+	if (!valid && _validity.empty())
+	{
+		// first null value - all previous values are valid
+		_validity.assign(_length/8 + 1, 0);
+		for (std::size_t i = 0; i < _length; ++i) _validity[i/8] |= static_cast<Poco::UInt8>(1 << (i % 8));
+	}
+	if (!_validity.empty())
+	{
+		if (_length/8 >= _validity.size()) _validity.push_back(0);
+		if (valid) _validity[_length/8] |= static_cast<Poco::UInt8>(1 << (_length % 8));
+		else ++_nullCount;
+	}
+	++_length;
+}
+
+
+inline void ArrowColumn::appendFixed(MetaColumn::ColumnDataType type, const void* value, std::size_t size)
+{
+	checkType(type);
+	const char* p = static_cast<const char*>(value);
+	_values.insert(_values.end(), p, p + size);
+	appendValidity(true);
+}
+
+
+} // namespace Poco::Data
+
+
+#endif // Data_ArrowColumn_INCLUDED
@@ -0,0 +1,115 @@
+//
+// ArrowStreamWriter.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowStreamWriter
+//
+// Definition of the ArrowStreamWriter class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ArrowStreamWriter_INCLUDED
+#define Data_ArrowStreamWriter_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Data/ArrowBatch.h"
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace Poco::Data {
+
+
+class RecordSet;
+
+
+class Data_API ArrowStreamWriter
+	/// This class writes ArrowBatch objects and RecordSets to an
+	/// output stream in the Apache Arrow IPC streaming format
+	/// (see https://arrow.apache.org/docs/format/Columnar.html#ipc-streaming-format),
+	/// which can be read by any Arrow implementation, e.g. with
+	/// pyarrow.ipc.open_stream().
+	///
+	/// The schema message is written before the first record batch and
+	/// is taken from it. All subsequent batches must have the same
+	/// column names and types. The stream is terminated by close().
+	///
+	/// Example:
+	///
+	///     std::ofstream ostr("result.arrows", std::ios::binary);
+	///     ArrowStreamWriter writer(ostr);
+	///     writer.write(RecordSet(session, "SELECT * FROM Person"));
+	///     writer.close();
+{
+public:
+	explicit ArrowStreamWriter(std::ostream& ostr);
+		/// Creates the ArrowStreamWriter.
+
+	~ArrowStreamWriter();
+		/// Destroys the ArrowStreamWriter, closing
+		/// the stream if it has not been closed yet.
+
+	void write(const ArrowBatch& batch);
+		/// Writes the given batch as a record batch message,
+		/// preceded by the schema message if this is the first batch.
+		///
+		/// Throws an InvalidArgumentException if the columns of the
+		/// batch do not match the schema, or an IllegalStateException
+		/// if the stream has already been closed.
+
+	void write(const RecordSet& recordSet);
+		/// Writes the contents of the given RecordSet
+		/// as a record batch.
+
+	void close();
+		/// Writes the end-of-stream marker. If no batch has been
+		/// written, the stream will contain no schema and is therefore
+		/// not valid.
+
+	std::size_t batchCount() const;
+		/// Returns the number of record batches written so far.
+
+private:
+	struct ColumnInfo
+	{
+		std::string name;
+		MetaColumn::ColumnDataType type;
+	};
+
+	ArrowStreamWriter() = delete;
+	ArrowStreamWriter(const ArrowStreamWriter&) = delete;
+	ArrowStreamWriter& operator = (const ArrowStreamWriter&) = delete;
+
+	void writeSchema(const ArrowBatch& batch);
+	void writeRecordBatch(const ArrowBatch& batch);
+	void writeMessage(const std::vector<char>& metadata);
+	void writeBuffer(const void* data, std::size_t size);
+
+	std::ostream& _ostr;
+	std::vector<ColumnInfo> _columns;
+	std::size_t _batchCount;
+	bool _closed;
+};
+
+
+//
+// inlines
+//
+inline std::size_t ArrowStreamWriter::batchCount() const
+{
+	return _batchCount;
+}
+
+
+} // namespace Poco::Data
+
+
+#endif // Data_ArrowStreamWriter_INCLUDED
@@ -22,7 +22,7 @@
 #include "Poco/Data/SessionImpl.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Timestamp.h"
-#include "Poco/Mutex.h"
+#include <atomic>
 
 
 namespace Poco::Data {
@@ -35,8 +35,9 @@ class Data_API PooledSessionHolder: public Poco::RefCountedObject
 	/// This class is used by SessionPool to manage SessionImpl objects.
 {
 public:
-	PooledSessionHolder(SessionPool& owner, SessionImpl* pSessionImpl);
-		/// Creates the PooledSessionHolder.
+	PooledSessionHolder(SessionPool& owner, SessionImpl* pSessionImpl, Poco::UInt32 slot = 0);
+		/// Creates the PooledSessionHolder for the given
+		/// slot of the SessionPool.
 
 	~PooledSessionHolder();
 		/// Destroys the PooledSessionHolder.
@@ -47,6 +48,9 @@ public:
 	SessionPool& owner();
 		/// Returns a reference to the SessionHolder's owner.
 
+	Poco::UInt32 slot() const;
+		/// Returns the index of the SessionPool slot holding the session.
+
 	void access();
 		/// Updates the last access timestamp.
 
@@ -56,8 +60,8 @@ public:
 private:
 	SessionPool& _owner;
 	Poco::AutoPtr<SessionImpl> _pImpl;
-	Poco::Timestamp _lastUsed;
-	mutable Poco::FastMutex _mutex;
+	Poco::UInt32 _slot;
+	std::atomic<Poco::Timestamp::TimeVal> _lastUsed;
 };
 
 
@@ -76,19 +80,22 @@ inline SessionPool& PooledSessionHolder::owner()
 }
 
 
-inline void PooledSessionHolder::access()
+inline Poco::UInt32 PooledSessionHolder::slot() const
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _slot;
+}
+
 
-	_lastUsed.update();
+inline void PooledSessionHolder::access()
+{
+	_lastUsed.store(Poco::Timestamp().epochMicroseconds(), std::memory_order_relaxed);
 }
 
 
 inline int PooledSessionHolder::idle() const
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
-
-	return (int) (_lastUsed.elapsed()/Poco::Timestamp::resolution());
+	const Poco::Timestamp::TimeDiff elapsed = Poco::Timestamp().epochMicroseconds() - _lastUsed.load(std::memory_order_relaxed);
+	return (int) (elapsed/Poco::Timestamp::resolution());
 }
 
 
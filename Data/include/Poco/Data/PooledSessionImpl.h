@@ -82,6 +82,8 @@ protected:
 
 private:
 	mutable Poco::AutoPtr<PooledSessionHolder> _pHolder;
+
+	friend class SessionPool;
 };
 
 
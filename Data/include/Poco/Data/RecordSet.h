@@ -409,6 +409,7 @@ private:
 
 	friend class RowIterator;
 	friend class RowFilter;
+	friend class ArrowBatch;
 };
 
 
@@ -26,7 +26,8 @@
 #include "Poco/Any.h"
 #include "Poco/Timer.h"
 #include "Poco/Mutex.h"
-#include <list>
+#include <atomic>
+#include <memory>
 
 
 namespace Poco::Data {
@@ -49,14 +50,32 @@ class Data_API SessionPool: public RefCountedObject
 	/// the SessionPool attempts to create a new one for the client.
 	/// To avoid excessive creation of SessionImpl objects, a limit
 	/// can be set on the maximum number of objects.
-	/// Sessions found not to be connected to the database are purged
-	/// from the pool whenever one of the following events occurs:
 	///
-	///   - JanitorTimer event
-	///   - get() request
-	///   - putBack() request
+	/// Idle sessions are kept on a lock-free stack, so that get() and
+	/// returning a session to the pool do not contend for a lock.
+	/// The most recently used idle session is recycled first, which
+	/// keeps the number of active connections low and their caches
+	/// warm. With thread affinity enabled (see setThreadAffinity()),
+	/// a thread gets the session it used last, if that session is idle.
 	///
-	/// Not connected idle sessions can not exist.
+	/// Idle sessions are validated in the background by the janitor
+	/// timer, which runs every idleTime/4 seconds. Sessions found not
+	/// to be connected to the database, and sessions that have been
+	/// idle for more than idleTime seconds while more than minSessions
+	/// sessions exist, are closed. Between janitor runs, get() checks
+	/// with SessionImpl::isGood() whether a session that has been idle
+	/// for at least the validation idle time (see setValidationIdleTime())
+	/// is still usable, and closes it otherwise. Recently returned sessions
+	/// are handed out without that check, which may involve a round trip
+	/// to the database. Sessions returned to the pool in a bad state are
+	/// closed immediately.
+	///
+	/// Statistics about the pool can be obtained with statistics(),
+	/// e.g. to export them as metrics:
+	///
+	///     Poco::Prometheus::CallbackIntCounter sessionsCreated(
+	///         "sql_pool_sessions_created_total", "Number of sessions created",
+	///         [&pool]() { return pool.statistics().created; });
 	///
 	/// Usage example:
 	///
@@ -66,6 +85,26 @@ class Data_API SessionPool: public RefCountedObject
 	///     ...
 {
 public:
+	struct Statistics
+		/// Counters describing the activity of a SessionPool.
+	{
+		Poco::UInt64 requests = 0;
+			/// Number of get() requests.
+		Poco::UInt64 created = 0;
+			/// Number of sessions created.
+		Poco::UInt64 affinityHits = 0;
+			/// Number of requests served by the session
+			/// last used by the requesting thread.
+		Poco::UInt64 exhausted = 0;
+			/// Number of requests failed because the
+			/// pool was exhausted.
+		Poco::UInt64 expired = 0;
+			/// Number of idle sessions closed after idleTime.
+		Poco::UInt64 dead = 0;
+			/// Number of sessions closed because they were
+			/// found not to be connected.
+	};
+
 	SessionPool(const std::string& connector,
 		const std::string& connectionString,
 		int minSessions = 1,
@@ -101,8 +140,7 @@ public:
 		/// value when the session is reclaimed by the pool.
 	{
 		Session s = get();
-		_addPropertyMap.insert(AddPropertyMap::value_type(s.impl(),
-			std::make_pair(name, s.getProperty(name))));
+		setRestoreProperty(s, name, s.getProperty(name));
 		s.setProperty(name, value);
 
 		return s;
@@ -127,7 +165,7 @@ public:
 		/// Returns the connection timeout.
 
 	int dead();
-		/// Returns the number of not connected active sessions.
+		/// Returns the number of not connected idle sessions.
 
 	int allocated() const;
 		/// Returns the number of allocated sessions.
@@ -135,6 +173,9 @@ public:
 	int available() const;
 		/// Returns the number of available (idle + remaining capacity) sessions.
 
+	Statistics statistics() const;
+		/// Returns the statistics of the pool.
+
 	std::string name() const;
 		/// Returns the name for this pool.
 
@@ -154,8 +195,34 @@ public:
 	Poco::Any getProperty(const std::string& name) const;
 		/// Returns the requested property.
 
+	void setThreadAffinity(bool enable);
+		/// Enables or disables thread affinity.
+		///
+		/// If enabled, get() returns the session most recently
+		/// obtained by the calling thread if it is idle, instead
+		/// of the most recently returned one. This keeps per-thread
+		/// state on the session, like prepared statements or
+		/// temporary tables, warm when a fixed set of worker threads
+		/// shares the pool. Disabled by default.
+
+	bool getThreadAffinity() const;
+		/// Returns true if thread affinity is enabled.
+
+	void setValidationIdleTime(int seconds);
+		/// Sets the number of seconds a session must have been idle
+		/// before get() validates it (default 1). A session that is
+		/// not good is closed, counted as dead, and the next session
+		/// is tried. A value of 0 validates every session handed out,
+		/// a negative value leaves validation to the janitor timer.
+
+	int getValidationIdleTime() const;
+		/// Returns the validation idle time in seconds.
+
 	void shutdown();
 		/// Shuts down the session pool.
+		///
+		/// Idle sessions are closed immediately. Sessions that
+		/// are in use are closed when they are returned to the pool.
 
 	bool isActive() const;
 		/// Returns true if session pool is active (not shut down).
@@ -169,26 +236,38 @@ protected:
 
 	typedef Poco::AutoPtr<PooledSessionHolder>    PooledSessionHolderPtr;
 	typedef Poco::AutoPtr<PooledSessionImpl>      PooledSessionImplPtr;
-	typedef std::list<PooledSessionHolderPtr>     SessionList;
 	typedef Poco::HashMap<std::string, bool>      FeatureMap;
 	typedef Poco::HashMap<std::string, Poco::Any> PropertyMap;
 
 	void purgeDeadSessions();
-	int deadImpl(SessionList& rSessions);
+		/// Validates all idle sessions and closes sessions that
+		/// are not connected or have expired.
+
 	void applySettings(SessionImpl* pImpl);
 	void putBack(PooledSessionHolderPtr pHolder);
 	void onJanitorTimer(Poco::Timer&);
 
 private:
-	typedef std::pair<std::string, Poco::Any> PropertyPair;
-	typedef std::pair<std::string, bool> FeaturePair;
-	typedef std::map<SessionImpl*, PropertyPair> AddPropertyMap;
-	typedef std::map<SessionImpl*, FeaturePair> AddFeatureMap;
+	struct Slot;
 
 	SessionPool(const SessionPool&);
 	SessionPool& operator = (const SessionPool&);
 
-	void closeAll(SessionList& sessionList);
+	PooledSessionHolderPtr acquire();
+	PooledSessionHolderPtr create(Poco::UInt32 index);
+	PooledSessionHolderPtr activate(Poco::UInt32 index);
+	Poco::UInt32 popIdle();
+	void push(std::atomic<Poco::UInt64>& head, Poco::UInt32 index);
+	Poco::UInt32 pop(std::atomic<Poco::UInt64>& head);
+	bool claim(Poco::UInt32 index, Poco::UInt32 from, Poco::UInt32 to);
+	void makeIdle(Poco::UInt32 index);
+	bool checkOut(Poco::UInt32 index);
+	void close(Poco::UInt32 index);
+	bool validate(Poco::UInt32 index, bool evict);
+	int count(Poco::UInt32 state) const;
+	void setRestoreProperty(Session& session, const std::string& name, const Poco::Any& value);
+	void setRestoreFeature(Session& session, const std::string& name, bool value);
+	Slot& slot(Session& session);
 
 	std::string       _connector;
 	std::string       _connectionString;
@@ -197,14 +276,22 @@ private:
 	std::atomic<int>  _idleTime;
 	std::atomic<int>  _connTimeout;
 	std::atomic<int>  _nSessions;
-	SessionList       _idleSessions;
-	SessionList       _activeSessions;
+	std::unique_ptr<Slot[]> _pSlots;
+	std::atomic<Poco::UInt64> _idleHead;
+	std::atomic<Poco::UInt64> _freeHead;
+	const Poco::UInt64 _id;
+	std::atomic<bool> _threadAffinity;
+	std::atomic<int>  _validationIdleTime;
 	Poco::Timer       _janitorTimer;
 	FeatureMap        _featureMap;
 	PropertyMap       _propertyMap;
 	std::atomic<bool> _shutdown;
-	AddPropertyMap    _addPropertyMap;
-	AddFeatureMap     _addFeatureMap;
+	std::atomic<Poco::UInt64> _requests;
+	std::atomic<Poco::UInt64> _created;
+	std::atomic<Poco::UInt64> _affinityHits;
+	std::atomic<Poco::UInt64> _exhausted;
+	std::atomic<Poco::UInt64> _expired;
+	std::atomic<Poco::UInt64> _dead;
 	mutable
 	Poco::Mutex _mutex;
 
@@ -231,6 +318,30 @@ inline bool SessionPool::isActive() const
 }
 
 
+inline void SessionPool::setThreadAffinity(bool enable)
+{
+	_threadAffinity = enable;
+}
+
+
+inline bool SessionPool::getThreadAffinity() const
+{
+	return _threadAffinity;
+}
+
+
+inline void SessionPool::setValidationIdleTime(int seconds)
+{
+	_validationIdleTime = seconds;
+}
+
+
+inline int SessionPool::getValidationIdleTime() const
+{
+	return _validationIdleTime;
+}
+
+
 } // namespace Poco::Data
 
 
@@ -424,6 +424,13 @@ public:
 		/// When executed on a synchronous statement, this method does not alter the
 		/// statement's synchronous nature.
 		/// For transactional behavior, see execute() documentation.
+		///
+		/// If the connector supports nonblocking execution of the statement
+		/// (e.g., PostgreSQL sessions with a SocketReactor set as the "reactor"
+		/// property), the statement is compiled and sent to the server by the
+		/// calling thread, and no thread waits for the result: it is extracted
+		/// by a thread of the connector once it has been received. Otherwise,
+		/// the statement is executed by a thread of the default thread pool.
 
 	void setAsync(bool async = true);
 		/// Sets the asynchronous flag. If this flag is true, executeAsync() is called
@@ -34,6 +34,7 @@
 #include <vector>
 #include <list>
 #include <deque>
+#include <functional>
 #include <string>
 #include <sstream>
 
@@ -135,6 +136,19 @@ public:
 	void executeDirect(const std::string& query);
 		/// Execute query directly.
 
+	bool executeNonBlocking(const std::function<void()>& onReceived, bool reset = true);
+		/// Compiles the statement and sends it to the server without
+		/// waiting for the result, if the connector supports nonblocking
+		/// execution of the statement (see supportsNonBlocking() and
+		/// sendImpl()). Returns false if nothing has been sent.
+		///
+		/// Otherwise, returns true and calls onReceived from a thread of
+		/// the connector once the result has been received. A subsequent
+		/// call to execute() then extracts the result without blocking.
+		///
+		/// Only statements without an extraction limit can be
+		/// executed this way.
+
 	void reset();
 		/// Resets the statement, so that we can reuse all bindings and re-execute again.
 
@@ -204,6 +218,24 @@ protected:
 	virtual void execDirectImpl(const std::string& query);
 		/// Execute query directly.
 
+	virtual bool supportsNonBlocking() const;
+		/// Returns true if the statement can probably be executed with
+		/// sendImpl(). Called by executeNonBlocking() before the statement
+		/// is compiled, so that statements that cannot be sent are
+		/// compiled by the thread executing them asynchronously.
+		/// The default implementation returns false.
+
+	virtual bool sendImpl(const std::function<void()>& onReceived);
+		/// Binds the parameters and sends the compiled statement to
+		/// the server without waiting for the result. onReceived must be
+		/// called when the result has been received, and the following
+		/// call to bindImpl() must complete the execution with it.
+		///
+		/// Returns false if the connector or the session does not support
+		/// nonblocking execution of the statement, in which case nothing
+		/// must have been bound or sent. The default implementation
+		/// returns false.
+
 	virtual AbstractExtraction::ExtractorPtr extractor() = 0;
 		/// Returns the concrete extractor used by the statement.
 
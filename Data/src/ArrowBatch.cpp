@@ -0,0 +1,270 @@
+//
+// ArrowBatch.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowBatch
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/ArrowBatch.h"
+#include "Poco/Data/RecordSet.h"
+#include "Poco/Exception.h"
+#include <deque>
+#include <list>
+
+
+namespace Poco::Data {
+
+
+namespace
+{
+	const Poco::UInt64 EMPTY_BUFFER = 0;
+		/// Referenced by exported arrays instead of
+		/// the data of empty buffers.
+
+
+	template <typename T>
+	const void* bufferData(const std::vector<T>& buffer)
+	{
+		return buffer.empty() ? &EMPTY_BUFFER : static_cast<const void*>(buffer.data());
+	}
+
+
+	struct ArrayData
+		/// Private data of exported arrays.
+	{
+		ArrowBatch::ColumnPtr pColumn;
+		const void* buffers[3] = {nullptr, nullptr, nullptr};
+		std::vector<ArrowArray> children;
+		std::vector<ArrowArray*> childPointers;
+	};
+
+
+	struct SchemaData
+		/// Private data of exported schemas.
+	{
+		std::string name;
+		std::vector<ArrowSchema> children;
+		std::vector<ArrowSchema*> childPointers;
+	};
+
+
+	void releaseArray(ArrowArray* pArray)
+	{
+		auto* pData = static_cast<ArrayData*>(pArray->private_data);
+		for (auto& child: pData->children)
+		{
+			// children moved by the consumer have already been released
+			if (child.release) child.release(&child);
+		}
+		delete pData;
+		pArray->release = nullptr;
+	}
+
+
+	void releaseSchema(ArrowSchema* pSchema)
+	{
+		auto* pData = static_cast<SchemaData*>(pSchema->private_data);
+		for (auto& child: pData->children)
+		{
+			if (child.release) child.release(&child);
+		}
+		delete pData;
+		pSchema->release = nullptr;
+	}
+
+
+	void exportColumn(const ArrowBatch::ColumnPtr& pColumn, ArrowArray& array, ArrowSchema& schema)
+	{
+		auto* pArrayData = new ArrayData;
+		pArrayData->pColumn = pColumn;
+		int64_t nBuffers = 0;
+		pArrayData->buffers[nBuffers++] = pColumn->validity().empty() ? nullptr : pColumn->validity().data();
+		if (!pColumn->offsets().empty()) pArrayData->buffers[nBuffers++] = pColumn->offsets().data();
+		pArrayData->buffers[nBuffers++] = bufferData(pColumn->values());
+
+		array.length = static_cast<int64_t>(pColumn->length());
+		array.null_count = static_cast<int64_t>(pColumn->nullCount());
+		array.offset = 0;
+		array.n_buffers = nBuffers;
+		array.n_children = 0;
+		array.buffers = pArrayData->buffers;
+		array.children = nullptr;
+		array.dictionary = nullptr;
+		array.release = releaseArray;
+		array.private_data = pArrayData;
+
+		auto* pSchemaData = new SchemaData;
+		pSchemaData->name = pColumn->name();
+		schema.format = pColumn->format();
+		schema.name = pSchemaData->name.c_str();
+		schema.metadata = nullptr;
+		schema.flags = ARROW_FLAG_NULLABLE;
+		schema.n_children = 0;
+		schema.children = nullptr;
+		schema.dictionary = nullptr;
+		schema.release = releaseSchema;
+		schema.private_data = pSchemaData;
+	}
+
+
+	template <typename T, typename C>
+	void appendValues(ArrowColumn& column, const RecordSet& recordSet, std::size_t pos, std::size_t rows, const std::vector<bool>& allowed)
+	{
+		const Column<C>& values = recordSet.column<C>(pos);
+		column.reserve(rows);
+		std::size_t row = 0;
+		for (auto it = values.begin(); it != values.end() && row < rows; ++it, ++row)
+		{
+			if (!allowed.empty() && !allowed[row]) continue;
+			if (recordSet.isNull(pos, row))
+				column.appendNull();
+			else
+				column.append(static_cast<const T&>(*it));
+		}
+	}
+
+
+	template <typename T>
+	void appendColumn(ArrowColumn& column, const RecordSet& recordSet, Statement::Storage storage, std::size_t pos, std::size_t rows, const std::vector<bool>& allowed)
+	{
+		switch (storage)
+		{
+		case Statement::STORAGE_VECTOR:
+			appendValues<T, std::vector<T>>(column, recordSet, pos, rows, allowed);
+			break;
+		case Statement::STORAGE_LIST:
+			appendValues<T, std::list<T>>(column, recordSet, pos, rows, allowed);
+			break;
+		case Statement::STORAGE_DEQUE:
+		case Statement::STORAGE_UNKNOWN:
+			appendValues<T, std::deque<T>>(column, recordSet, pos, rows, allowed);
+			break;
+		default:
+			throw IllegalStateException("Invalid storage setting.");
+		}
+	}
+}
+
+
+ArrowBatch::ArrowBatch()
+{
+}
+
+
+ArrowBatch::ArrowBatch(const RecordSet& recordSet)
+{
+	const Statement::Storage storage = recordSet.storage();
+	const std::size_t rows = recordSet.subTotalRowCount();
+	std::vector<bool> allowed;
+	if (recordSet.isFiltered())
+	{
+		allowed.resize(rows);
+		for (std::size_t row = 0; row < rows; ++row) allowed[row] = recordSet.isAllowed(row);
+	}
+
+	const std::size_t columns = recordSet.columnCount();
+	_columns.reserve(columns);
+	for (std::size_t pos = 0; pos < columns; ++pos)
+	{
+		const MetaColumn::ColumnDataType type = recordSet.columnType(pos);
+		ArrowColumn& column = addColumn(recordSet.columnName(pos), type);
+		switch (type)
+		{
+		case MetaColumn::FDT_BOOL:      appendColumn<bool>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_INT8:      appendColumn<Int8>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_UINT8:     appendColumn<UInt8>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_INT16:     appendColumn<Int16>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_UINT16:    appendColumn<UInt16>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_INT32:     appendColumn<Int32>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_UINT32:    appendColumn<UInt32>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_INT64:     appendColumn<Int64>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_UINT64:    appendColumn<UInt64>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_FLOAT:     appendColumn<float>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_DOUBLE:    appendColumn<double>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_STRING:
+		case MetaColumn::FDT_JSON:      appendColumn<std::string>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_WSTRING:   appendColumn<UTF16String>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_BLOB:      appendColumn<BLOB>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_CLOB:      appendColumn<CLOB>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_DATE:      appendColumn<Date>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_TIME:      appendColumn<Time>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_TIMESTAMP: appendColumn<DateTime>(column, recordSet, storage, pos, rows, allowed); break;
+		case MetaColumn::FDT_UUID:      appendColumn<UUID>(column, recordSet, storage, pos, rows, allowed); break;
+		default:
+			throw NotImplementedException("Arrow column type", column.name());
+		}
+	}
+}
+
+
+ArrowBatch::~ArrowBatch()
+{
+}
+
+
+ArrowColumn& ArrowBatch::addColumn(const std::string& name, MetaColumn::ColumnDataType type)
+{
+	_columns.push_back(std::make_shared<ArrowColumn>(name, type));
+	return *_columns.back();
+}
+
+
+void ArrowBatch::exportTo(struct ArrowArray* pArray, struct ArrowSchema* pSchema) const
+{
+	poco_check_ptr (pArray);
+	poco_check_ptr (pSchema);
+
+	checkLength();
+
+	auto* pArrayData = new ArrayData;
+	auto* pSchemaData = new SchemaData;
+	pArrayData->children.resize(_columns.size());
+	pSchemaData->children.resize(_columns.size());
+	for (std::size_t i = 0; i < _columns.size(); ++i)
+	{
+		exportColumn(_columns[i], pArrayData->children[i], pSchemaData->children[i]);
+		pArrayData->childPointers.push_back(&pArrayData->children[i]);
+		pSchemaData->childPointers.push_back(&pSchemaData->children[i]);
+	}
+
+	pArray->length = static_cast<int64_t>(length());
+	pArray->null_count = 0;
+	pArray->offset = 0;
+	pArray->n_buffers = 1;
+	pArray->n_children = static_cast<int64_t>(_columns.size());
+	pArray->buffers = pArrayData->buffers;
+	pArray->children = pArrayData->childPointers.data();
+	pArray->dictionary = nullptr;
+	pArray->release = releaseArray;
+	pArray->private_data = pArrayData;
+
+	pSchema->format = "+s";
+	pSchema->name = "";
+	pSchema->metadata = nullptr;
+	pSchema->flags = 0;
+	pSchema->n_children = static_cast<int64_t>(_columns.size());
+	pSchema->children = pSchemaData->childPointers.data();
+	pSchema->dictionary = nullptr;
+	pSchema->release = releaseSchema;
+	pSchema->private_data = pSchemaData;
+}
+
+
+void ArrowBatch::checkLength() const
+{
+	for (const auto& pColumn: _columns)
+	{
+		if (pColumn->length() != length())
+			throw RangeException("Arrow columns have different lengths", pColumn->name());
+	}
+}
+
+
+} // namespace Poco::Data
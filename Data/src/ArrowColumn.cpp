@@ -0,0 +1,287 @@
+//
+// ArrowColumn.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowColumn
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/ArrowColumn.h"
+#include "Poco/Timespan.h"
+#include "Poco/UnicodeConverter.h"
+#include "Poco/Exception.h"
+#include <limits>
+
+
+namespace Poco::Data {
+
+
+ArrowColumn::ArrowColumn(const std::string& name, MetaColumn::ColumnDataType type):
+	_name(name),
+	_type(type),
+	_width(0),
+	_length(0),
+	_nullCount(0)
+{
+	switch (_type)
+	{
+	case MetaColumn::FDT_BOOL:
+		break;
+	case MetaColumn::FDT_INT8:
+	case MetaColumn::FDT_UINT8:
+		_width = 1;
+		break;
+	case MetaColumn::FDT_INT16:
+	case MetaColumn::FDT_UINT16:
+		_width = 2;
+		break;
+	case MetaColumn::FDT_INT32:
+	case MetaColumn::FDT_UINT32:
+	case MetaColumn::FDT_FLOAT:
+	case MetaColumn::FDT_DATE:
+	case MetaColumn::FDT_TIME:
+		_width = 4;
+		break;
+	case MetaColumn::FDT_INT64:
+	case MetaColumn::FDT_UINT64:
+	case MetaColumn::FDT_DOUBLE:
+	case MetaColumn::FDT_TIMESTAMP:
+		_width = 8;
+		break;
+	case MetaColumn::FDT_UUID:
+		_width = 16;
+		break;
+	case MetaColumn::FDT_STRING:
+	case MetaColumn::FDT_WSTRING:
+	case MetaColumn::FDT_BLOB:
+	case MetaColumn::FDT_CLOB:
+	case MetaColumn::FDT_JSON:
+		_offsets.push_back(0);
+		break;
+	default:
+		throw NotImplementedException("Arrow column type", _name);
+	}
+}
+
+
+ArrowColumn::~ArrowColumn()
+{
+}
+
+
+const char* ArrowColumn::format() const
+{
+	switch (_type)
+	{
+	case MetaColumn::FDT_BOOL:      return "b";
+	case MetaColumn::FDT_INT8:      return "c";
+	case MetaColumn::FDT_UINT8:     return "C";
+	case MetaColumn::FDT_INT16:     return "s";
+	case MetaColumn::FDT_UINT16:    return "S";
+	case MetaColumn::FDT_INT32:     return "i";
+	case MetaColumn::FDT_UINT32:    return "I";
+	case MetaColumn::FDT_INT64:     return "l";
+	case MetaColumn::FDT_UINT64:    return "L";
+	case MetaColumn::FDT_FLOAT:     return "f";
+	case MetaColumn::FDT_DOUBLE:    return "g";
+	case MetaColumn::FDT_STRING:
+	case MetaColumn::FDT_WSTRING:
+	case MetaColumn::FDT_CLOB:
+	case MetaColumn::FDT_JSON:      return "u";
+	case MetaColumn::FDT_BLOB:      return "z";
+	case MetaColumn::FDT_DATE:      return "tdD";
+	case MetaColumn::FDT_TIME:      return "tts";
+	case MetaColumn::FDT_TIMESTAMP: return "tsu:";
+	case MetaColumn::FDT_UUID:      return "w:16";
+	default:
+		poco_bugcheck();
+		return "";
+	}
+}
+
+
+void ArrowColumn::reserve(std::size_t rows)
+{
+	if (isVariableLength())
+		_offsets.reserve(rows + 1);
+	else if (_type == MetaColumn::FDT_BOOL)
+		_values.reserve(rows/8 + 1);
+	else
+		_values.reserve(rows*_width);
+}
+
+
+void ArrowColumn::appendNull()
+{
+	if (isVariableLength())
+		_offsets.push_back(_offsets.back());
+	else if (_type == MetaColumn::FDT_BOOL)
+	{
+		if (_length/8 >= _values.size()) _values.push_back(0);
+	}
+	else
+		_values.insert(_values.end(), _width, 0);
+	appendValidity(false);
+}
+
+
+void ArrowColumn::append(bool value)
+{
+	checkType(MetaColumn::FDT_BOOL);
+	if (_length/8 >= _values.size()) _values.push_back(0);
+	if (value) _values[_length/8] |= static_cast<char>(1 << (_length % 8));
+	appendValidity(true);
+}
+
+
+void ArrowColumn::append(Poco::Int8 value)
+{
+	appendFixed(MetaColumn::FDT_INT8, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::UInt8 value)
+{
+	appendFixed(MetaColumn::FDT_UINT8, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::Int16 value)
+{
+	appendFixed(MetaColumn::FDT_INT16, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::UInt16 value)
+{
+	appendFixed(MetaColumn::FDT_UINT16, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::Int32 value)
+{
+	appendFixed(MetaColumn::FDT_INT32, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::UInt32 value)
+{
+	appendFixed(MetaColumn::FDT_UINT32, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::Int64 value)
+{
+	appendFixed(MetaColumn::FDT_INT64, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(Poco::UInt64 value)
+{
+	appendFixed(MetaColumn::FDT_UINT64, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(float value)
+{
+	appendFixed(MetaColumn::FDT_FLOAT, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(double value)
+{
+	appendFixed(MetaColumn::FDT_DOUBLE, &value, sizeof(value));
+}
+
+
+void ArrowColumn::append(const std::string& value)
+{
+	if (_type != MetaColumn::FDT_JSON) checkType(MetaColumn::FDT_STRING);
+	appendVariable(value.data(), value.size());
+}
+
+
+void ArrowColumn::append(const UTF16String& value)
+{
+	checkType(MetaColumn::FDT_WSTRING);
+	std::string utf8;
+	Poco::UnicodeConverter::convert(value, utf8);
+	appendVariable(utf8.data(), utf8.size());
+}
+
+
+void ArrowColumn::append(const BLOB& value)
+{
+	checkType(MetaColumn::FDT_BLOB);
+	appendVariable(reinterpret_cast<const char*>(value.rawContent()), value.size());
+}
+
+
+void ArrowColumn::append(const CLOB& value)
+{
+	checkType(MetaColumn::FDT_CLOB);
+	appendVariable(value.rawContent(), value.size());
+}
+
+
+void ArrowColumn::append(const Date& value)
+{
+	const Poco::DateTime dt(value.year(), value.month(), value.day());
+	const Poco::Int32 days = static_cast<Poco::Int32>(dt.timestamp().epochMicroseconds()/Poco::Timespan::DAYS);
+	appendFixed(MetaColumn::FDT_DATE, &days, sizeof(days));
+}
+
+
+void ArrowColumn::append(const Time& value)
+{
+	const Poco::Int32 seconds = value.hour()*3600 + value.minute()*60 + value.second();
+	appendFixed(MetaColumn::FDT_TIME, &seconds, sizeof(seconds));
+}
+
+
+void ArrowColumn::append(const DateTime& value)
+{
+	const Poco::Int64 us = value.timestamp().epochMicroseconds();
+	appendFixed(MetaColumn::FDT_TIMESTAMP, &us, sizeof(us));
+}
+
+
+void ArrowColumn::append(const UUID& value)
+{
+	char bytes[16];
+	value.copyTo(bytes);
+	appendFixed(MetaColumn::FDT_UUID, bytes, sizeof(bytes));
+}
+
+
+void ArrowColumn::appendVariable(const char* value, std::size_t size)
+{
+	const std::size_t end = _values.size() + size;
+	if (end > static_cast<std::size_t>(std::numeric_limits<Poco::Int32>::max()))
+		throw RangeException("Arrow column data exceeds 2 GB", _name);
+	if (size) _values.insert(_values.end(), value, value + size);
+	_offsets.push_back(static_cast<Poco::Int32>(end));
+	appendValidity(true);
+}
+
+
+void ArrowColumn::checkType(MetaColumn::ColumnDataType type) const
+{
+	if (type != _type)
+		throw InvalidArgumentException("Value type does not match type of Arrow column", _name);
+}
+
+
+bool ArrowColumn::isVariableLength() const
+{
+	return !_offsets.empty();
+}
+
+
+} // namespace Poco::Data
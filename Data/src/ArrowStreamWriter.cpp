@@ -0,0 +1,510 @@
+//
+// ArrowStreamWriter.cpp
+//
+// Library: Data
+// Package: DataCore
+// Module:  ArrowStreamWriter
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/ArrowStreamWriter.h"
+#include "Poco/Data/RecordSet.h"
+#include "Poco/ByteOrder.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <cstring>
+
+
+namespace Poco::Data {
+
+
+namespace
+{
+	const Poco::UInt32 CONTINUATION = 0xFFFFFFFF;
+	const char PADDING[8] = {0};
+
+	// Identifiers from Schema.fbs and Message.fbs of the Arrow format.
+	const Poco::Int16 METADATA_V5 = 4;
+	const Poco::UInt8 HEADER_SCHEMA = 1;
+	const Poco::UInt8 HEADER_RECORD_BATCH = 3;
+
+	const Poco::UInt8 TYPE_INT = 2;
+	const Poco::UInt8 TYPE_FLOATING_POINT = 3;
+	const Poco::UInt8 TYPE_BINARY = 4;
+	const Poco::UInt8 TYPE_UTF8 = 5;
+	const Poco::UInt8 TYPE_BOOL = 6;
+	const Poco::UInt8 TYPE_DATE = 8;
+	const Poco::UInt8 TYPE_TIME = 9;
+	const Poco::UInt8 TYPE_TIMESTAMP = 10;
+	const Poco::UInt8 TYPE_FIXED_SIZE_BINARY = 15;
+
+	const Poco::Int16 PRECISION_SINGLE = 1;
+	const Poco::Int16 PRECISION_DOUBLE = 2;
+	const Poco::Int16 DATE_UNIT_DAY = 0;
+	const Poco::Int16 TIME_UNIT_SECOND = 0;
+	const Poco::Int16 TIME_UNIT_MICROSECOND = 2;
+
+#if defined(POCO_ARCH_BIG_ENDIAN)
+	const Poco::Int16 ENDIANNESS = 1;
+#else
+	const Poco::Int16 ENDIANNESS = 0;
+#endif
+
+
+	std::size_t padded(std::size_t size)
+	{
+		return (size + 7) & ~std::size_t(7);
+	}
+
+
+	class FlatBufferBuilder
+		/// A minimal FlatBuffers encoder, sufficient for Arrow IPC
+		/// metadata messages.
+		///
+		/// Unlike the reference implementation, which builds buffers
+		/// back to front, objects are written front to back: every table
+		/// is followed by the objects it refers to, and offset fields
+		/// are patched once their targets have been written. Each table
+		/// is preceded by its vtable.
+	{
+	public:
+		struct Field
+			/// A table field. A size of 0 denotes an absent field;
+			/// offset fields are written as placeholders.
+		{
+			std::size_t size = 0;
+			Poco::UInt64 value = 0;
+
+			static Field scalar(Poco::Int64 value, std::size_t size)
+			{
+				return Field{size, static_cast<Poco::UInt64>(value)};
+			}
+
+			static Field offset()
+			{
+				return Field{4, 0};
+			}
+		};
+
+		FlatBufferBuilder()
+		{
+			// root table offset
+			put<Poco::UInt32>(0);
+		}
+
+		std::vector<std::size_t> table(const std::vector<Field>& fields)
+			/// Writes a table and its vtable, and returns the
+			/// positions of the fields.
+		{
+			// Fields are laid out by decreasing size to keep them aligned,
+			// starting after the soffset to the vtable.
+			std::vector<std::size_t> order;
+			for (std::size_t i = 0; i < fields.size(); ++i)
+			{
+				if (fields[i].size) order.push_back(i);
+			}
+			std::stable_sort(order.begin(), order.end(), [&fields](std::size_t a, std::size_t b)
+			{
+				return fields[a].size > fields[b].size;
+			});
+			std::vector<Poco::UInt16> fieldOffsets(fields.size(), 0);
+			std::size_t tableSize = 4;
+			for (auto i: order)
+			{
+				tableSize = (tableSize + fields[i].size - 1) & ~(fields[i].size - 1);
+				fieldOffsets[i] = static_cast<Poco::UInt16>(tableSize);
+				tableSize += fields[i].size;
+			}
+
+			align(2);
+			const std::size_t vtablePos = _buffer.size();
+			put<Poco::UInt16>(static_cast<Poco::UInt16>(4 + 2*fields.size()));
+			put<Poco::UInt16>(static_cast<Poco::UInt16>(tableSize));
+			for (auto offset: fieldOffsets) put<Poco::UInt16>(offset);
+
+			align(8);
+			const std::size_t tablePos = _buffer.size();
+			put<Poco::Int32>(static_cast<Poco::Int32>(tablePos - vtablePos));
+			_buffer.resize(tablePos + tableSize, 0);
+			std::vector<std::size_t> positions(fields.size(), 0);
+			for (auto i: order)
+			{
+				positions[i] = tablePos + fieldOffsets[i];
+				Poco::UInt64 value = fields[i].value;
+				switch (fields[i].size)
+				{
+				case 1: write(positions[i], static_cast<Poco::UInt8>(value)); break;
+				case 2: write(positions[i], static_cast<Poco::UInt16>(value)); break;
+				case 4: write(positions[i], static_cast<Poco::UInt32>(value)); break;
+				case 8: write(positions[i], value); break;
+				default: poco_bugcheck();
+				}
+			}
+			// the position of a table is the position of its soffset
+			_tablePos = tablePos;
+			return positions;
+		}
+
+		std::size_t lastTable() const
+			/// Returns the position of the last table written.
+		{
+			return _tablePos;
+		}
+
+		std::size_t string(const std::string& value)
+			/// Writes a string and returns its position.
+		{
+			align(4);
+			const std::size_t pos = _buffer.size();
+			put<Poco::UInt32>(static_cast<Poco::UInt32>(value.size()));
+			_buffer.insert(_buffer.end(), value.begin(), value.end());
+			_buffer.push_back('\0');
+			return pos;
+		}
+
+		std::vector<std::size_t> offsetVector(std::size_t count)
+			/// Writes a vector of offset placeholders and returns
+			/// the positions of the elements.
+		{
+			align(4);
+			put<Poco::UInt32>(static_cast<Poco::UInt32>(count));
+			std::vector<std::size_t> positions;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				positions.push_back(_buffer.size());
+				put<Poco::UInt32>(0);
+			}
+			_vectorPos = positions.empty() ? _buffer.size() - 4 : positions.front() - 4;
+			return positions;
+		}
+
+		std::size_t structVector(const std::vector<std::pair<Poco::Int64, Poco::Int64>>& elements)
+			/// Writes a vector of structs consisting of two longs
+			/// (FieldNode or Buffer) and returns its position.
+		{
+			// the elements must be 8-byte aligned
+			while ((_buffer.size() + 4) % 8) _buffer.push_back(0);
+			const std::size_t pos = _buffer.size();
+			put<Poco::UInt32>(static_cast<Poco::UInt32>(elements.size()));
+			for (const auto& e: elements)
+			{
+				put<Poco::Int64>(e.first);
+				put<Poco::Int64>(e.second);
+			}
+			return pos;
+		}
+
+		std::size_t lastVector() const
+			/// Returns the position of the last offset vector written.
+		{
+			return _vectorPos;
+		}
+
+		void patch(std::size_t fieldPos, std::size_t targetPos)
+			/// Sets the offset field at fieldPos to refer to targetPos.
+		{
+			poco_assert (targetPos > fieldPos);
+			write(fieldPos, static_cast<Poco::UInt32>(targetPos - fieldPos));
+		}
+
+		const std::vector<char>& finish(std::size_t rootPos)
+			/// Sets the root table and returns the buffer.
+		{
+			write(0, static_cast<Poco::UInt32>(rootPos));
+			return _buffer;
+		}
+
+	private:
+		void align(std::size_t alignment)
+		{
+			while (_buffer.size() % alignment) _buffer.push_back(0);
+		}
+
+		template <typename T>
+		void put(T value)
+		{
+			_buffer.resize(_buffer.size() + sizeof(T));
+			write(_buffer.size() - sizeof(T), value);
+		}
+
+		template <typename T>
+		void write(std::size_t pos, T value)
+		{
+			value = Poco::ByteOrder::toLittleEndian(value);
+			std::memcpy(_buffer.data() + pos, &value, sizeof(T));
+		}
+
+		void write(std::size_t pos, Poco::UInt8 value)
+		{
+			_buffer[pos] = static_cast<char>(value);
+		}
+
+		std::vector<char> _buffer;
+		std::size_t _tablePos = 0;
+		std::size_t _vectorPos = 0;
+	};
+
+
+	using Field = FlatBufferBuilder::Field;
+
+
+	Poco::UInt8 typeOf(MetaColumn::ColumnDataType type)
+		/// Returns the Type union identifier for the given column type.
+	{
+		switch (type)
+		{
+		case MetaColumn::FDT_INT8:
+		case MetaColumn::FDT_UINT8:
+		case MetaColumn::FDT_INT16:
+		case MetaColumn::FDT_UINT16:
+		case MetaColumn::FDT_INT32:
+		case MetaColumn::FDT_UINT32:
+		case MetaColumn::FDT_INT64:
+		case MetaColumn::FDT_UINT64:    return TYPE_INT;
+		case MetaColumn::FDT_FLOAT:
+		case MetaColumn::FDT_DOUBLE:    return TYPE_FLOATING_POINT;
+		case MetaColumn::FDT_BLOB:      return TYPE_BINARY;
+		case MetaColumn::FDT_STRING:
+		case MetaColumn::FDT_WSTRING:
+		case MetaColumn::FDT_CLOB:
+		case MetaColumn::FDT_JSON:      return TYPE_UTF8;
+		case MetaColumn::FDT_BOOL:      return TYPE_BOOL;
+		case MetaColumn::FDT_DATE:      return TYPE_DATE;
+		case MetaColumn::FDT_TIME:      return TYPE_TIME;
+		case MetaColumn::FDT_TIMESTAMP: return TYPE_TIMESTAMP;
+		case MetaColumn::FDT_UUID:      return TYPE_FIXED_SIZE_BINARY;
+		default:
+			throw NotImplementedException("Arrow column type");
+		}
+	}
+
+
+	void writeType(FlatBufferBuilder& builder, MetaColumn::ColumnDataType type)
+		/// Writes the type table of a field.
+	{
+		switch (type)
+		{
+		case MetaColumn::FDT_INT8:
+		case MetaColumn::FDT_UINT8:
+		case MetaColumn::FDT_INT16:
+		case MetaColumn::FDT_UINT16:
+		case MetaColumn::FDT_INT32:
+		case MetaColumn::FDT_UINT32:
+		case MetaColumn::FDT_INT64:
+		case MetaColumn::FDT_UINT64:
+		{
+			static const int BIT_WIDTHS[] = {8, 8, 16, 16, 32, 32, 64, 64};
+			const int index = type - MetaColumn::FDT_INT8;
+			builder.table({Field::scalar(BIT_WIDTHS[index], 4), Field::scalar(index % 2 == 0, 1)});
+			break;
+		}
+		case MetaColumn::FDT_FLOAT:
+			builder.table({Field::scalar(PRECISION_SINGLE, 2)});
+			break;
+		case MetaColumn::FDT_DOUBLE:
+			builder.table({Field::scalar(PRECISION_DOUBLE, 2)});
+			break;
+		case MetaColumn::FDT_DATE:
+			builder.table({Field::scalar(DATE_UNIT_DAY, 2)});
+			break;
+		case MetaColumn::FDT_TIME:
+			builder.table({Field::scalar(TIME_UNIT_SECOND, 2), Field::scalar(32, 4)});
+			break;
+		case MetaColumn::FDT_TIMESTAMP:
+			builder.table({Field::scalar(TIME_UNIT_MICROSECOND, 2)});
+			break;
+		case MetaColumn::FDT_UUID:
+			builder.table({Field::scalar(16, 4)});
+			break;
+		default:
+			// Binary, Utf8 and Bool have no fields
+			builder.table({});
+			break;
+		}
+	}
+}
+
+
+ArrowStreamWriter::ArrowStreamWriter(std::ostream& ostr):
+	_ostr(ostr),
+	_batchCount(0),
+	_closed(false)
+{
+}
+
+
+ArrowStreamWriter::~ArrowStreamWriter()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void ArrowStreamWriter::write(const ArrowBatch& batch)
+{
+	if (_closed) throw IllegalStateException("Arrow stream already closed");
+
+	if (_batchCount == 0)
+	{
+		writeSchema(batch);
+	}
+	else
+	{
+		bool match = batch.columnCount() == _columns.size();
+		for (std::size_t i = 0; match && i < _columns.size(); ++i)
+		{
+			match = batch.column(i).name() == _columns[i].name && batch.column(i).type() == _columns[i].type;
+		}
+		if (!match) throw InvalidArgumentException("Arrow batch does not match stream schema");
+	}
+	writeRecordBatch(batch);
+	++_batchCount;
+}
+
+
+void ArrowStreamWriter::write(const RecordSet& recordSet)
+{
+	write(ArrowBatch(recordSet));
+}
+
+
+void ArrowStreamWriter::close()
+{
+	if (_closed) return;
+
+	_closed = true;
+	const Poco::UInt32 eos[2] = {CONTINUATION, 0};
+	_ostr.write(reinterpret_cast<const char*>(eos), sizeof(eos));
+	_ostr.flush();
+}
+
+
+void ArrowStreamWriter::writeSchema(const ArrowBatch& batch)
+{
+	for (std::size_t i = 0; i < batch.columnCount(); ++i)
+	{
+		_columns.push_back({batch.column(i).name(), batch.column(i).type()});
+	}
+
+	FlatBufferBuilder builder;
+	const auto message = builder.table({
+		Field::scalar(METADATA_V5, 2),
+		Field::scalar(HEADER_SCHEMA, 1),
+		Field::offset(),
+		Field::scalar(0, 8)});
+	const std::size_t root = builder.lastTable();
+
+	const auto schema = builder.table({Field::scalar(ENDIANNESS, 2), Field::offset()});
+	builder.patch(message[2], builder.lastTable());
+
+	const auto fields = builder.offsetVector(_columns.size());
+	builder.patch(schema[1], builder.lastVector());
+
+	for (std::size_t i = 0; i < _columns.size(); ++i)
+	{
+		const auto field = builder.table({
+			Field::offset(),
+			Field::scalar(1, 1),
+			Field::scalar(typeOf(_columns[i].type), 1),
+			Field::offset(),
+			Field(),
+			Field::offset()});
+		builder.patch(fields[i], builder.lastTable());
+
+		builder.patch(field[0], builder.string(_columns[i].name));
+
+		writeType(builder, _columns[i].type);
+		builder.patch(field[3], builder.lastTable());
+
+		builder.offsetVector(0);
+		builder.patch(field[5], builder.lastVector());
+	}
+
+	writeMessage(builder.finish(root));
+}
+
+
+void ArrowStreamWriter::writeRecordBatch(const ArrowBatch& batch)
+{
+	std::vector<std::pair<Poco::Int64, Poco::Int64>> nodes;
+	std::vector<std::pair<Poco::Int64, Poco::Int64>> buffers;
+	Poco::Int64 bodyLength = 0;
+	auto addBuffer = [&buffers, &bodyLength](std::size_t size)
+	{
+		buffers.emplace_back(bodyLength, static_cast<Poco::Int64>(size));
+		bodyLength += static_cast<Poco::Int64>(padded(size));
+	};
+	for (std::size_t i = 0; i < batch.columnCount(); ++i)
+	{
+		const ArrowColumn& column = batch.column(i);
+		if (column.length() != batch.length())
+			throw RangeException("Arrow columns have different lengths", column.name());
+		nodes.emplace_back(static_cast<Poco::Int64>(column.length()), static_cast<Poco::Int64>(column.nullCount()));
+		addBuffer(column.validity().size());
+		if (!column.offsets().empty()) addBuffer(column.offsets().size()*sizeof(Poco::Int32));
+		addBuffer(column.values().size());
+	}
+
+	FlatBufferBuilder builder;
+	const auto message = builder.table({
+		Field::scalar(METADATA_V5, 2),
+		Field::scalar(HEADER_RECORD_BATCH, 1),
+		Field::offset(),
+		Field::scalar(bodyLength, 8)});
+	const std::size_t root = builder.lastTable();
+
+	const auto recordBatch = builder.table({
+		Field::scalar(static_cast<Poco::Int64>(batch.length()), 8),
+		Field::offset(),
+		Field::offset()});
+	builder.patch(message[2], builder.lastTable());
+	builder.patch(recordBatch[1], builder.structVector(nodes));
+	builder.patch(recordBatch[2], builder.structVector(buffers));
+
+	writeMessage(builder.finish(root));
+
+	for (std::size_t i = 0; i < batch.columnCount(); ++i)
+	{
+		const ArrowColumn& column = batch.column(i);
+		writeBuffer(column.validity().data(), column.validity().size());
+		if (!column.offsets().empty()) writeBuffer(column.offsets().data(), column.offsets().size()*sizeof(Poco::Int32));
+		writeBuffer(column.values().data(), column.values().size());
+	}
+}
+
+
+void ArrowStreamWriter::writeMessage(const std::vector<char>& metadata)
+{
+	// continuation marker and length prefix, followed by the
+	// metadata padded so that the body starts 8-byte aligned
+	const std::size_t size = padded(metadata.size());
+	const Poco::UInt32 prefix[2] = {
+		CONTINUATION,
+		Poco::ByteOrder::toLittleEndian(static_cast<Poco::UInt32>(size))};
+	_ostr.write(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+	_ostr.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+	_ostr.write(PADDING, static_cast<std::streamsize>(size - metadata.size()));
+	if (!_ostr) throw WriteFileException("Cannot write Arrow stream");
+}
+
+
+void ArrowStreamWriter::writeBuffer(const void* data, std::size_t size)
+{
+	if (size) _ostr.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+	_ostr.write(PADDING, static_cast<std::streamsize>(padded(size) - size));
+	if (!_ostr) throw WriteFileException("Cannot write Arrow stream");
+}
+
+
+} // namespace Poco::Data
@@ -18,9 +18,11 @@
 namespace Poco::Data {
 
 
-PooledSessionHolder::PooledSessionHolder(SessionPool& owner, SessionImpl* pSessionImpl):
+PooledSessionHolder::PooledSessionHolder(SessionPool& owner, SessionImpl* pSessionImpl, Poco::UInt32 slot):
 	_owner(owner),
-	_pImpl(pSessionImpl, true)
+	_pImpl(pSessionImpl, true),
+	_slot(slot),
+	_lastUsed(Poco::Timestamp().epochMicroseconds())
 {
 }
 
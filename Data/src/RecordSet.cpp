@@ -162,6 +162,7 @@ const Column<C>& RecordSet::column(const std::string& name) const
 
 
 template Data_API const Column<std::vector<bool>>& RecordSet::column<std::vector<bool>>(const std::string& name) const;
+template Data_API const Column<std::vector<Int8>>& RecordSet::column<std::vector<Int8>>(const std::string& name) const;
 template Data_API const Column<std::vector<UInt8>>& RecordSet::column<std::vector<UInt8>>(const std::string& name) const;
 template Data_API const Column<std::vector<Int16>>& RecordSet::column<std::vector<Int16>>(const std::string& name) const;
 template Data_API const Column<std::vector<UInt16>>& RecordSet::column<std::vector<UInt16>>(const std::string& name) const;
@@ -181,6 +182,7 @@ template Data_API const Column<std::vector<DateTime>>& RecordSet::column<std::ve
 template Data_API const Column<std::vector<UUID>>& RecordSet::column<std::vector<UUID>>(const std::string& name) const;
 
 template Data_API const Column<std::list<bool>>& RecordSet::column<std::list<bool>>(const std::string& name) const;
+template Data_API const Column<std::list<Int8>>& RecordSet::column<std::list<Int8>>(const std::string& name) const;
 template Data_API const Column<std::list<UInt8>>& RecordSet::column<std::list<UInt8>>(const std::string& name) const;
 template Data_API const Column<std::list<Int16>>& RecordSet::column<std::list<Int16>>(const std::string& name) const;
 template Data_API const Column<std::list<UInt16>>& RecordSet::column<std::list<UInt16>>(const std::string& name) const;
@@ -200,6 +202,7 @@ template Data_API const Column<std::list<DateTime>>& RecordSet::column<std::list
 template Data_API const Column<std::list<UUID>>& RecordSet::column<std::list<UUID>>(const std::string& name) const;
 
 template Data_API const Column<std::deque<bool>>& RecordSet::column<std::deque<bool>>(const std::string& name) const;
+template Data_API const Column<std::deque<Int8>>& RecordSet::column<std::deque<Int8>>(const std::string& name) const;
 template Data_API const Column<std::deque<UInt8>>& RecordSet::column<std::deque<UInt8>>(const std::string& name) const;
 template Data_API const Column<std::deque<Int16>>& RecordSet::column<std::deque<Int16>>(const std::string& name) const;
 template Data_API const Column<std::deque<UInt16>>& RecordSet::column<std::deque<UInt16>>(const std::string& name) const;
@@ -237,6 +240,7 @@ const Column<C>& RecordSet::column(std::size_t pos) const
 
 
 template Data_API const Column<std::vector<bool>>& RecordSet::column<std::vector<bool>>(std::size_t pos) const;
+template Data_API const Column<std::vector<Int8>>& RecordSet::column<std::vector<Int8>>(std::size_t pos) const;
 template Data_API const Column<std::vector<UInt8>>& RecordSet::column<std::vector<UInt8>>(std::size_t pos) const;
 template Data_API const Column<std::vector<Int16>>& RecordSet::column<std::vector<Int16>>(std::size_t pos) const;
 template Data_API const Column<std::vector<UInt16>>& RecordSet::column<std::vector<UInt16>>(std::size_t pos) const;
@@ -256,6 +260,7 @@ template Data_API const Column<std::vector<DateTime>>& RecordSet::column<std::ve
 template Data_API const Column<std::vector<UUID>>& RecordSet::column<std::vector<UUID>>(std::size_t pos) const;
 
 template Data_API const Column<std::list<bool>>& RecordSet::column<std::list<bool>>(std::size_t pos) const;
+template Data_API const Column<std::list<Int8>>& RecordSet::column<std::list<Int8>>(std::size_t pos) const;
 template Data_API const Column<std::list<UInt8>>& RecordSet::column<std::list<UInt8>>(std::size_t pos) const;
 template Data_API const Column<std::list<Int16>>& RecordSet::column<std::list<Int16>>(std::size_t pos) const;
 template Data_API const Column<std::list<UInt16>>& RecordSet::column<std::list<UInt16>>(std::size_t pos) const;
@@ -275,6 +280,7 @@ template Data_API const Column<std::list<DateTime>>& RecordSet::column<std::list
 template Data_API const Column<std::list<UUID>>& RecordSet::column<std::list<UUID>>(std::size_t pos) const;
 
 template Data_API const Column<std::deque<bool>>& RecordSet::column<std::deque<bool>>(std::size_t pos) const;
+template Data_API const Column<std::deque<Int8>>& RecordSet::column<std::deque<Int8>>(std::size_t pos) const;
 template Data_API const Column<std::deque<UInt8>>& RecordSet::column<std::deque<UInt8>>(std::size_t pos) const;
 template Data_API const Column<std::deque<Int16>>& RecordSet::column<std::deque<Int16>>(std::size_t pos) const;
 template Data_API const Column<std::deque<UInt16>>& RecordSet::column<std::deque<UInt16>>(std::size_t pos) const;
@@ -326,6 +332,7 @@ const T& RecordSet::value(std::size_t col, std::size_t row, bool useFilter) cons
 
 
 template Data_API const bool& RecordSet::value<bool>(std::size_t col, std::size_t row, bool useFilter) const;
+template Data_API const Int8& RecordSet::value<Int8>(std::size_t col, std::size_t row, bool useFilter) const;
 template Data_API const UInt8& RecordSet::value<UInt8>(std::size_t col, std::size_t row, bool useFilter) const;
 template Data_API const Int16& RecordSet::value<Int16>(std::size_t col, std::size_t row, bool useFilter) const;
 template Data_API const UInt16& RecordSet::value<UInt16>(std::size_t col, std::size_t row, bool useFilter) const;
@@ -377,6 +384,7 @@ const T& RecordSet::value(const std::string& name, std::size_t row, bool useFilt
 
 
 template Data_API const bool& RecordSet::value<bool>(const std::string& name, std::size_t row, bool useFilter) const;
+template Data_API const Int8& RecordSet::value<Int8>(const std::string& name, std::size_t row, bool useFilter) const;
 template Data_API const UInt8& RecordSet::value<UInt8>(const std::string& name, std::size_t row, bool useFilter) const;
 template Data_API const Int16& RecordSet::value<Int16>(const std::string& name, std::size_t row, bool useFilter) const;
 template Data_API const UInt16& RecordSet::value<UInt16>(const std::string& name, std::size_t row, bool useFilter) const;
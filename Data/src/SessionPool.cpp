@@ -15,12 +15,86 @@
 #include "Poco/Data/SessionPool.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/DataException.h"
-#include <algorithm>
+#include "Poco/Thread.h"
 
 
 namespace Poco::Data {
 
 
+namespace
+{
+	// Every session lives in one of the slots of the pool. The index of a
+	// free slot is kept on the free stack; the index of an idle session on
+	// the idle stack. Both are Treiber stacks linked through the slots,
+	// with a generation count in the upper half of the head to avoid
+	// the ABA problem.
+	//
+	// A slot is claimed by changing its state with compare-and-swap.
+	// Sessions claimed for thread affinity or validation stay on the
+	// idle stack (LINKED) until popped, which avoids removing entries
+	// from the middle of the stack. Whoever clears LINKED on a slot
+	// that is no longer idle leaves it to its current owner, who pushes
+	// it again when releasing it.
+	//
+	// shutdown() closes idle sessions itself and moves every slot not
+	// owned by another thread to CLOSED. Slots owned by another thread
+	// are only flagged with SHUTDOWN; their owner closes the session
+	// and moves the slot to CLOSED when releasing it, so the holder of
+	// a slot is never accessed by two threads at once.
+
+	const Poco::UInt32 NIL = 0xFFFFFFFF;
+
+	const Poco::UInt32 SLOT_FREE       = 0;
+	const Poco::UInt32 SLOT_IDLE       = 1;
+	const Poco::UInt32 SLOT_ACTIVE     = 2;
+	const Poco::UInt32 SLOT_VALIDATING = 3;
+	const Poco::UInt32 SLOT_EVICTED    = 4;
+	const Poco::UInt32 SLOT_CLOSED     = 5;
+	const Poco::UInt32 SLOT_STATE_MASK = 0xFF;
+	const Poco::UInt32 SLOT_LINKED     = 0x100;
+	const Poco::UInt32 SLOT_SHUTDOWN   = 0x200;
+
+
+	inline Poco::UInt32 headIndex(Poco::UInt64 head)
+	{
+		return static_cast<Poco::UInt32>(head);
+	}
+
+
+	inline Poco::UInt64 nextHead(Poco::UInt64 head, Poco::UInt32 index)
+	{
+		return (((head >> 32) + 1) << 32) | index;
+	}
+
+
+	std::atomic<Poco::UInt64> nextPoolId(1);
+
+
+	struct Affinity
+		/// The slot of the session a thread obtained last from a pool.
+	{
+		Poco::UInt64 pool = 0;
+		Poco::UInt32 slot = NIL;
+	};
+
+	const std::size_t AFFINITY_ENTRIES = 4;
+	thread_local Affinity threadAffinity[AFFINITY_ENTRIES];
+		/// Most recently used pools first.
+}
+
+
+struct SessionPool::Slot
+{
+	std::atomic<Poco::UInt32> state{SLOT_FREE};
+	std::atomic<Poco::UInt32> next{NIL};
+	PooledSessionHolderPtr pHolder;
+	std::string restorePropertyName;
+	Poco::Any restorePropertyValue;
+	std::string restoreFeatureName;
+	bool restoreFeatureValue = false;
+};
+
+
 SessionPool::SessionPool(const std::string& connector, const std::string& connectionString, int minSessions, int maxSessions, int idleTime, int connTimeout):
 	_connector(connector),
 	_connectionString(connectionString),
@@ -29,9 +103,23 @@ SessionPool::SessionPool(const std::string& connector, const std::string& connec
 	_idleTime(idleTime),
 	_connTimeout(connTimeout),
 	_nSessions(0),
+	_pSlots(new Slot[maxSessions > 0 ? maxSessions : 0]),
+	_idleHead(NIL),
+	_freeHead(NIL),
+	_id(nextPoolId++),
+	_threadAffinity(false),
+	_validationIdleTime(1),
 	_janitorTimer(1000*idleTime, 1000*idleTime/4),
-	_shutdown(false)
+	_shutdown(false),
+	_requests(0),
+	_created(0),
+	_affinityHits(0),
+	_exhausted(0),
+	_expired(0),
+	_dead(0)
 {
+	for (int i = maxSessions - 1; i >= 0; --i) push(_freeHead, static_cast<Poco::UInt32>(i));
+
 	Poco::TimerCallback<SessionPool> callback(*this, &SessionPool::onJanitorTimer);
 	_janitorTimer.start(callback);
 }
@@ -53,8 +141,7 @@ SessionPool::~SessionPool()
 Session SessionPool::get(const std::string& name, bool value)
 {
 	Session s = get();
-	_addFeatureMap.insert(AddFeatureMap::value_type(s.impl(),
-		std::make_pair(name, s.getFeature(name))));
+	setRestoreFeature(s, name, s.getFeature(name));
 	s.setFeature(name, value);
 
 	return s;
@@ -62,50 +149,314 @@ Session SessionPool::get(const std::string& name, bool value)
 
 
 Session SessionPool::get()
+{
+	PooledSessionImplPtr pPSI(new PooledSessionImpl(acquire()));
+	return Session(pPSI);
+}
+
+
+SessionPool::PooledSessionHolderPtr SessionPool::acquire()
 {
 	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	purgeDeadSessions();
+	_requests.fetch_add(1, std::memory_order_relaxed);
 
-	if (_idleSessions.empty())
+	if (_threadAffinity)
 	{
-		if (_nSessions < _maxSessions)
+		for (const auto& entry: threadAffinity)
 		{
-			Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
+			if (entry.pool == _id)
+			{
+				if (claim(entry.slot, SLOT_IDLE, SLOT_ACTIVE) && checkOut(entry.slot))
+				{
+					_affinityHits.fetch_add(1, std::memory_order_relaxed);
+					return activate(entry.slot);
+				}
+				break;
+			}
+		}
+	}
+
+	for (;;)
+	{
+		Poco::UInt32 index = popIdle();
+		if (index != NIL)
+		{
+			if (checkOut(index)) return activate(index);
+			continue;
+		}
+
+		int n = _nSessions;
+		do
+		{
+			if (n >= _maxSessions)
+			{
+				_exhausted.fetch_add(1, std::memory_order_relaxed);
+				throw SessionPoolExhaustedException(_connector);
+			}
+		}
+		while (!_nSessions.compare_exchange_weak(n, n + 1));
+
+		index = pop(_freeHead);
+		if (index != NIL) return create(index);
+
+		// A closed session's slot has not been recycled yet.
+		--_nSessions;
+		if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+		Poco::Thread::yield();
+	}
+}
+
+
+SessionPool::PooledSessionHolderPtr SessionPool::create(Poco::UInt32 index)
+{
+	Slot& slot = _pSlots[index];
+	try
+	{
+		Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
 			applySettings(newSession.impl());
-			customizeSession(newSession);
+		}
+		customizeSession(newSession);
 
-			PooledSessionHolderPtr pHolder(new PooledSessionHolder(*this, newSession.impl()));
-			_idleSessions.push_back(pHolder);
-			++_nSessions;
+		slot.pHolder = new PooledSessionHolder(*this, newSession.impl(), index);
+	}
+	catch (...)
+	{
+		--_nSessions;
+		if ((slot.state.load(std::memory_order_acquire) & SLOT_STATE_MASK) == SLOT_FREE) push(_freeHead, index);
+		throw;
+	}
+	_created.fetch_add(1, std::memory_order_relaxed);
+	if (!claim(index, SLOT_FREE, SLOT_ACTIVE))
+	{
+		// shutdown() has closed the slot in the meantime
+		try
+		{
+			slot.pHolder->session()->close();
+		}
+		catch (...)
+		{
 		}
-		else throw SessionPoolExhaustedException(_connector);
+		slot.pHolder = nullptr;
+		--_nSessions;
+		throw InvalidAccessException("Session pool has been shut down.");
 	}
+	return activate(index);
+}
 
-	PooledSessionHolderPtr pHolder(_idleSessions.front());
-	PooledSessionImplPtr pPSI(new PooledSessionImpl(pHolder));
 
-	_activeSessions.push_front(pHolder);
-	_idleSessions.pop_front();
-	return Session(pPSI);
+SessionPool::PooledSessionHolderPtr SessionPool::activate(Poco::UInt32 index)
+{
+	if (_threadAffinity)
+	{
+		// move the entry for this pool to the front
+		Affinity entry{_id, index};
+		for (auto& e: threadAffinity)
+		{
+			std::swap(e, entry);
+			if (entry.pool == _id || entry.pool == 0) break;
+		}
+	}
+
+	PooledSessionHolderPtr pHolder = _pSlots[index].pHolder;
+	pHolder->access();
+	return pHolder;
 }
 
 
-void SessionPool::purgeDeadSessions()
+Poco::UInt32 SessionPool::popIdle()
 {
-	if (_shutdown) return;
+	for (;;)
+	{
+		const Poco::UInt32 index = pop(_idleHead);
+		if (index == NIL) return NIL;
+
+		Slot& slot = _pSlots[index];
+		Poco::UInt32 state = slot.state.load(std::memory_order_acquire);
+		Poco::UInt32 newState;
+		do
+		{
+			switch (state & SLOT_STATE_MASK)
+			{
+			case SLOT_IDLE:
+				newState = SLOT_ACTIVE;
+				break;
+			case SLOT_EVICTED:
+				newState = SLOT_FREE;
+				break;
+			default:
+				newState = state & ~SLOT_LINKED;
+				break;
+			}
+		}
+		while (!slot.state.compare_exchange_weak(state, newState, std::memory_order_acq_rel, std::memory_order_acquire));
+
+		if (newState == SLOT_ACTIVE && (state & SLOT_STATE_MASK) == SLOT_IDLE) return index;
+		if (newState == SLOT_FREE) push(_freeHead, index);
+	}
+}
+
+
+void SessionPool::push(std::atomic<Poco::UInt64>& head, Poco::UInt32 index)
+{
+	Poco::UInt64 current = head.load(std::memory_order_acquire);
+	do
+	{
+		_pSlots[index].next.store(headIndex(current), std::memory_order_relaxed);
+	}
+	while (!head.compare_exchange_weak(current, nextHead(current, index), std::memory_order_release, std::memory_order_acquire));
+}
+
+
+Poco::UInt32 SessionPool::pop(std::atomic<Poco::UInt64>& head)
+{
+	Poco::UInt64 current = head.load(std::memory_order_acquire);
+	while (headIndex(current) != NIL)
+	{
+		const Poco::UInt32 next = _pSlots[headIndex(current)].next.load(std::memory_order_relaxed);
+		if (head.compare_exchange_weak(current, nextHead(current, next), std::memory_order_acq_rel, std::memory_order_acquire))
+			return headIndex(current);
+	}
+	return NIL;
+}
+
+
+bool SessionPool::claim(Poco::UInt32 index, Poco::UInt32 from, Poco::UInt32 to)
+{
+	if (index >= static_cast<Poco::UInt32>(_maxSessions.load())) return false;
+
+	Slot& slot = _pSlots[index];
+	Poco::UInt32 state = slot.state.load(std::memory_order_acquire);
+	while ((state & SLOT_STATE_MASK) == from)
+	{
+		if (slot.state.compare_exchange_weak(state, (state & SLOT_LINKED) | to, std::memory_order_acq_rel, std::memory_order_acquire))
+			return true;
+	}
+	return false;
+}
 
-	SessionList::iterator it = _idleSessions.begin();
-	for (; it != _idleSessions.end(); )
+
+void SessionPool::makeIdle(Poco::UInt32 index)
+{
+	Slot& slot = _pSlots[index];
+	Poco::UInt32 state = slot.state.load(std::memory_order_acquire);
+	do
 	{
-		if (!(*it)->session()->isGood())
+		if (state & SLOT_SHUTDOWN)
 		{
-			it = _idleSessions.erase(it);
-			--_nSessions;
+			close(index);
+			return;
 		}
-		else ++it;
 	}
+	while (!slot.state.compare_exchange_weak(state, SLOT_LINKED | SLOT_IDLE, std::memory_order_acq_rel, std::memory_order_acquire));
+	if (!(state & SLOT_LINKED)) push(_idleHead, index);
+}
+
+
+bool SessionPool::checkOut(Poco::UInt32 index)
+{
+	PooledSessionHolderPtr pHolder = _pSlots[index].pHolder;
+	const int validationIdleTime = _validationIdleTime;
+	if (validationIdleTime < 0 || pHolder->idle() < validationIdleTime) return true;
+
+	bool good = false;
+	try
+	{
+		good = pHolder->session()->isGood();
+	}
+	catch (...)
+	{
+	}
+	if (!good)
+	{
+		_dead.fetch_add(1, std::memory_order_relaxed);
+		close(index);
+	}
+	return good;
+}
+
+
+void SessionPool::close(Poco::UInt32 index)
+{
+	Slot& slot = _pSlots[index];
+	try
+	{
+		slot.pHolder->session()->close();
+	}
+	catch (...)
+	{
+	}
+	slot.pHolder = nullptr;
+	slot.restorePropertyName.clear();
+	slot.restorePropertyValue = Poco::Any();
+	slot.restoreFeatureName.clear();
+
+	Poco::UInt32 state = slot.state.load(std::memory_order_acquire);
+	Poco::UInt32 newState;
+	do
+	{
+		if (state & SLOT_SHUTDOWN)
+			newState = SLOT_CLOSED;
+		else
+			newState = (state & SLOT_LINKED) ? (SLOT_LINKED | SLOT_EVICTED) : SLOT_FREE;
+	}
+	while (!slot.state.compare_exchange_weak(state, newState, std::memory_order_acq_rel, std::memory_order_acquire));
+	// shutdown() has already removed the session from the count
+	if (newState != SLOT_CLOSED) --_nSessions;
+	if (newState == SLOT_FREE) push(_freeHead, index);
+}
+
+
+bool SessionPool::validate(Poco::UInt32 index, bool evict)
+{
+	if (!claim(index, SLOT_IDLE, SLOT_VALIDATING)) return true;
+
+	PooledSessionHolderPtr pHolder = _pSlots[index].pHolder;
+	bool good = false;
+	try
+	{
+		good = pHolder->session()->isGood();
+	}
+	catch (...)
+	{
+	}
+
+	if (evict && !good)
+	{
+		_dead.fetch_add(1, std::memory_order_relaxed);
+		close(index);
+	}
+	else if (evict && pHolder->idle() > _idleTime && _nSessions > _minSessions)
+	{
+		_expired.fetch_add(1, std::memory_order_relaxed);
+		close(index);
+	}
+	else makeIdle(index);
+	return good;
+}
+
+
+void SessionPool::purgeDeadSessions()
+{
+	if (_shutdown) return;
+
+	for (int i = 0; i < _maxSessions; ++i)
+	{
+		validate(static_cast<Poco::UInt32>(i), true);
+	}
+}
+
+
+int SessionPool::count(Poco::UInt32 state) const
+{
+	int n = 0;
+	for (int i = 0; i < _maxSessions; ++i)
+	{
+		if ((_pSlots[i].state.load(std::memory_order_relaxed) & ~SLOT_LINKED) == state) ++n;
+	}
+	return n;
 }
 
 
@@ -117,15 +468,13 @@ int SessionPool::capacity() const
 
 int SessionPool::used() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	return (int) _activeSessions.size();
+	return count(SLOT_ACTIVE);
 }
 
 
 int SessionPool::idle() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	return (int) _idleSessions.size();
+	return count(SLOT_IDLE) + count(SLOT_VALIDATING);
 }
 
 
@@ -138,16 +487,10 @@ int SessionPool::connTimeout() const
 int SessionPool::dead()
 {
 	int count = 0;
-
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _idleSessions.begin();
-	SessionList::iterator itEnd = _idleSessions.end();
-	for (; it != itEnd; ++it)
+	for (int i = 0; i < _maxSessions; ++i)
 	{
-		if (!(*it)->session()->isGood())
-			++count;
+		if (!validate(static_cast<Poco::UInt32>(i), false)) ++count;
 	}
-
 	return count;
 }
 
@@ -165,14 +508,27 @@ int SessionPool::available() const
 }
 
 
+SessionPool::Statistics SessionPool::statistics() const
+{
+	Statistics stats;
+	stats.requests = _requests.load(std::memory_order_relaxed);
+	stats.created = _created.load(std::memory_order_relaxed);
+	stats.affinityHits = _affinityHits.load(std::memory_order_relaxed);
+	stats.exhausted = _exhausted.load(std::memory_order_relaxed);
+	stats.expired = _expired.load(std::memory_order_relaxed);
+	stats.dead = _dead.load(std::memory_order_relaxed);
+	return stats;
+}
+
+
 void SessionPool::setFeature(const std::string& name, bool state)
 {
 	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
+	Poco::Mutex::ScopedLock lock(_mutex);
 	if (_nSessions > 0)
 		throw InvalidAccessException("Features can not be set after the first session was created.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
 	_featureMap.insert(FeatureMap::ValueType(name, state));
 }
 
@@ -196,10 +552,10 @@ void SessionPool::setProperty(const std::string& name, const Poco::Any& value)
 {
 	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
+	Poco::Mutex::ScopedLock lock(_mutex);
 	if (_nSessions > 0)
 		throw InvalidAccessException("Properties can not be set after first session was created.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
 	_propertyMap.insert(PropertyMap::ValueType(name, value));
 }
 
@@ -233,49 +589,81 @@ void SessionPool::customizeSession(Session&)
 }
 
 
-void SessionPool::putBack(PooledSessionHolderPtr pHolder)
+SessionPool::Slot& SessionPool::slot(Session& session)
 {
-	if (_shutdown) return;
+	PooledSessionImpl* pImpl = dynamic_cast<PooledSessionImpl*>(session.impl());
+	poco_check_ptr (pImpl);
+	poco_check_ptr (pImpl->_pHolder);
+	return _pSlots[pImpl->_pHolder->slot()];
+}
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = std::find(_activeSessions.begin(), _activeSessions.end(), pHolder);
-	if (it != _activeSessions.end())
+
+void SessionPool::setRestoreProperty(Session& session, const std::string& name, const Poco::Any& value)
+{
+	Slot& s = slot(session);
+	s.restorePropertyName = name;
+	s.restorePropertyValue = value;
+}
+
+
+void SessionPool::setRestoreFeature(Session& session, const std::string& name, bool value)
+{
+	Slot& s = slot(session);
+	s.restoreFeatureName = name;
+	s.restoreFeatureValue = value;
+}
+
+
+void SessionPool::putBack(PooledSessionHolderPtr pHolder)
+{
+	const Poco::UInt32 index = pHolder->slot();
+	if (index < static_cast<Poco::UInt32>(_maxSessions.load()) && _pSlots[index].pHolder == pHolder)
 	{
+		Slot& slot = _pSlots[index];
 		try
 		{
-			if (pHolder->session()->isGood())
+			if (_shutdown)
+			{
+				close(index);
+			}
+			else if (pHolder->session()->isGood())
 			{
 				pHolder->session()->reset();
 
 				// reverse settings applied at acquisition time, if any
-				AddPropertyMap::iterator pIt = _addPropertyMap.find(pHolder->session());
-				if (pIt != _addPropertyMap.end())
-					pHolder->session()->setProperty(pIt->second.first, pIt->second.second);
-
-				AddFeatureMap::iterator fIt = _addFeatureMap.find(pHolder->session());
-				if (fIt != _addFeatureMap.end())
-					pHolder->session()->setFeature(fIt->second.first, fIt->second.second);
+				if (!slot.restorePropertyName.empty())
+				{
+					pHolder->session()->setProperty(slot.restorePropertyName, slot.restorePropertyValue);
+					slot.restorePropertyName.clear();
+					slot.restorePropertyValue = Poco::Any();
+				}
+
+				if (!slot.restoreFeatureName.empty())
+				{
+					pHolder->session()->setFeature(slot.restoreFeatureName, slot.restoreFeatureValue);
+					slot.restoreFeatureName.clear();
+				}
 
 				// re-apply the default pool settings
 				applySettings(pHolder->session());
 
 				pHolder->access();
-				_idleSessions.push_back(pHolder);
+				makeIdle(index);
+			}
+			else
+			{
+				_dead.fetch_add(1, std::memory_order_relaxed);
+				close(index);
 			}
-			else --_nSessions;
-
-			_activeSessions.erase(it);
 		}
 		catch (const Poco::Exception& e)
 		{
-			--_nSessions;
-			_activeSessions.erase(it);
+			close(index);
 			poco_bugcheck_msg(format("Exception in SessionPool::putBack(): %s", e.displayText()).c_str());
 		}
 		catch (...)
 		{
-			--_nSessions;
-			_activeSessions.erase(it);
+			close(index);
 			poco_bugcheck_msg("Unknown exception in SessionPool::putBack()");
 		}
 	}
@@ -290,53 +678,56 @@ void SessionPool::onJanitorTimer(Poco::Timer&)
 {
 	if (_shutdown) return;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _idleSessions.begin();
-	while (_nSessions > _minSessions && it != _idleSessions.end())
-	{
-		if ((*it)->idle() > _idleTime || !(*it)->session()->isGood())
-		{
-			try
-			{
-				(*it)->session()->close();
-			}
-			catch (...)
-			{
-			}
-			it = _idleSessions.erase(it);
-			--_nSessions;
-		}
-		else ++it;
-	}
+	purgeDeadSessions();
 }
 
 
 void SessionPool::shutdown()
 {
 	if (_shutdown.exchange(true)) return;
-	_shutdown = true;
 	_janitorTimer.stop();
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	closeAll(_idleSessions);
-	closeAll(_activeSessions);
-}
-
-
-void SessionPool::closeAll(SessionList& sessionList)
-{
-	SessionList::iterator it = sessionList.begin();
-	for (; it != sessionList.end();)
+	for (int i = 0; i < _maxSessions; ++i)
 	{
-		try
+		Slot& slot = _pSlots[i];
+		Poco::UInt32 state = slot.state.load(std::memory_order_acquire);
+		Poco::UInt32 newState;
+		do
 		{
-			(*it)->session()->close();
+			switch (state & SLOT_STATE_MASK)
+			{
+			case SLOT_ACTIVE:
+			case SLOT_VALIDATING:
+				// the owner closes the session when releasing the slot
+				newState = state | SLOT_SHUTDOWN;
+				break;
+			default:
+				newState = SLOT_CLOSED;
+				break;
+			}
 		}
-		catch (...)
+		while (state != newState && !slot.state.compare_exchange_weak(state, newState, std::memory_order_acq_rel, std::memory_order_acquire));
+
+		switch (state & SLOT_STATE_MASK)
 		{
+		case SLOT_IDLE:
+			try
+			{
+				slot.pHolder->session()->close();
+			}
+			catch (...)
+			{
+			}
+			slot.pHolder = nullptr;
+			--_nSessions;
+			break;
+		case SLOT_ACTIVE:
+		case SLOT_VALIDATING:
+			--_nSessions;
+			break;
+		default:
+			break;
 		}
-		it = sessionList.erase(it);
-		if (_nSessions > 0) --_nSessions;
 	}
 }
 
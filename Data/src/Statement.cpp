@@ -425,6 +425,45 @@ const Statement::Result& Statement::executeAsync(bool reset)
 const Statement::Result& Statement::doAsyncExec(bool reset)
 {
 	if (done()) _pImpl->reset();
+
+	Result result(new ActiveResultHolder<std::size_t>());
+	try
+	{
+		StatementImpl::Ptr pImpl = _pImpl;
+		auto onReceived = [pImpl, result, reset]() mutable
+		{
+			try
+			{
+				result.data(new std::size_t(pImpl->execute(reset)));
+			}
+			catch (Exception& e)
+			{
+				result.error(e);
+			}
+			catch (std::exception& e)
+			{
+				result.error(e.what());
+			}
+			catch (...)
+			{
+				result.error("unknown exception");
+			}
+			result.notify();
+		};
+		if (_pImpl->executeNonBlocking(onReceived, reset))
+		{
+			_pResult = new Result(result);
+			return *_pResult;
+		}
+	}
+	catch (Exception& e)
+	{
+		result.error(e);
+		result.notify();
+		_pResult = new Result(result);
+		return *_pResult;
+	}
+
 	if (!_pAsyncExec)
 		_pAsyncExec = new AsyncExecMethod(_pImpl, &StatementImpl::execute);
 	_pResult = new Result((*_pAsyncExec)(reset));
@@ -119,6 +119,26 @@ void StatementImpl::executeDirect(const std::string &query)
 }
 
 
+bool StatementImpl::executeNonBlocking(const std::function<void()>& onReceived, bool reset)
+{
+	if (_extrLimit.value() != Limit::LIMIT_UNLIMITED || !supportsNonBlocking() || !_rSession.isConnected())
+		return false;
+
+	try
+	{
+		if (reset) resetExtraction();
+
+		compile();
+		return sendImpl(onReceived);
+	}
+	catch(...)
+	{
+		_state = ST_DONE;
+		throw;
+	}
+}
+
+
 void StatementImpl::assignSubTotal(bool reset)
 {
 	if (_extractors.size() == _subTotalRowCount.size())
@@ -391,7 +411,19 @@ const MetaColumn& StatementImpl::metaColumn(const std::string& name) const
 	throw NotFoundException(format("Invalid column name: %s", name));
 }
 
-void StatementImpl::execDirectImpl(const std::string& query)
+bool StatementImpl::supportsNonBlocking() const
+{
+	return false;
+}
+
+
+bool StatementImpl::sendImpl(const std::function<void()>&)
+{
+	return false;
+}
+
+
+void StatementImpl::execDirectImpl(const std::string&)
 {
 	poco_assert("Not implemented");
 }
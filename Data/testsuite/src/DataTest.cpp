@@ -24,10 +24,13 @@
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SimpleRowFormatter.h"
 #include "Poco/Data/JSONRowFormatter.h"
+#include "Poco/Data/ArrowBatch.h"
+#include "Poco/Data/ArrowStreamWriter.h"
 #include "Poco/Data/DataException.h"
 #include "Connector.h"
 #include "Poco/BinaryReader.h"
 #include "Poco/BinaryWriter.h"
+#include "Poco/ByteOrder.h"
 #include "Poco/DateTime.h"
 #include "Poco/Stopwatch.h"
 #include "Poco/Types.h"
@@ -1707,6 +1710,352 @@ void DataTest::testTransactionAutoCommit()
 }
 
 
+void DataTest::testArrowColumn()
+{
+	ArrowColumn ints("ints", MetaColumn::FDT_INT32);
+	assertTrue (std::string(ints.format()) == "i");
+	ints.append(Int32(1));
+	ints.append(Int32(2));
+	assertTrue (ints.validity().empty());
+	ints.appendNull();
+	ints.append(Int32(4));
+	assertTrue (ints.length() == 4);
+	assertTrue (ints.nullCount() == 1);
+	assertTrue (ints.validity().size() == 1);
+	assertTrue (ints.validity()[0] == 0x0B);
+	assertTrue (!ints.isNull(1));
+	assertTrue (ints.isNull(2));
+	assertTrue (ints.offsets().empty());
+	assertTrue (ints.values().size() == 4*sizeof(Int32));
+	const Int32* pInts = reinterpret_cast<const Int32*>(ints.values().data());
+	assertTrue (pInts[0] == 1 && pInts[1] == 2 && pInts[2] == 0 && pInts[3] == 4);
+
+	try
+	{
+		ints.append(Int64(5));
+		fail ("must fail");
+	}
+	catch (InvalidArgumentException&) { }
+
+	ArrowColumn strings("strings", MetaColumn::FDT_STRING);
+	assertTrue (std::string(strings.format()) == "u");
+	strings.append("abc"s);
+	strings.appendNull();
+	strings.append(""s);
+	strings.append("defgh"s);
+	assertTrue (strings.offsets() == std::vector<Int32>({0, 3, 3, 3, 8}));
+	assertTrue (std::string(strings.values().begin(), strings.values().end()) == "abcdefgh");
+	assertTrue (strings.nullCount() == 1);
+
+	ArrowColumn wstrings("wstrings", MetaColumn::FDT_WSTRING);
+	wstrings.append(UTF16String(1, 0x00E4));
+	assertTrue (std::string(wstrings.values().begin(), wstrings.values().end()) == "\xc3\xa4");
+
+	ArrowColumn bools("bools", MetaColumn::FDT_BOOL);
+	for (int i = 0; i < 10; ++i) bools.append(i % 3 == 0);
+	assertTrue (bools.values().size() == 2);
+	assertTrue (static_cast<UInt8>(bools.values()[0]) == 0x49);
+	assertTrue (static_cast<UInt8>(bools.values()[1]) == 0x02);
+
+	ArrowColumn dates("dates", MetaColumn::FDT_DATE);
+	dates.append(Date(1970, 1, 2));
+	dates.append(Date(1969, 12, 31));
+	const Int32* pDays = reinterpret_cast<const Int32*>(dates.values().data());
+	assertTrue (pDays[0] == 1 && pDays[1] == -1);
+
+	ArrowColumn times("times", MetaColumn::FDT_TIME);
+	times.append(Time(1, 2, 3));
+	assertTrue (*reinterpret_cast<const Int32*>(times.values().data()) == 3723);
+
+	ArrowColumn timestamps("timestamps", MetaColumn::FDT_TIMESTAMP);
+	timestamps.append(DateTime(1970, 1, 1, 0, 0, 1, 2, 3));
+	assertTrue (*reinterpret_cast<const Int64*>(timestamps.values().data()) == 1002003);
+
+	ArrowColumn uuids("uuids", MetaColumn::FDT_UUID);
+	assertTrue (std::string(uuids.format()) == "w:16");
+	uuids.append(UUID("6ba7b810-9dad-11d1-80b4-00c04fd430c8"));
+	assertTrue (uuids.values().size() == 16);
+	assertTrue (static_cast<UInt8>(uuids.values()[0]) == 0x6b);
+
+	try
+	{
+		ArrowColumn unknown("unknown", MetaColumn::FDT_UNKNOWN);
+		fail ("must fail");
+	}
+	catch (NotImplementedException&) { }
+}
+
+
+void DataTest::testArrowBatchExport()
+{
+	ArrowArray array;
+	ArrowSchema schema;
+	{
+		ArrowBatch batch;
+		ArrowColumn& ids = batch.addColumn("id", MetaColumn::FDT_INT64);
+		ArrowColumn& names = batch.addColumn("name", MetaColumn::FDT_STRING);
+		ids.append(Int64(1));
+		ids.append(Int64(2));
+		names.append("one"s);
+		names.appendNull();
+		assertTrue (batch.columnCount() == 2);
+		assertTrue (batch.length() == 2);
+		batch.exportTo(&array, &schema);
+
+		assertTrue (array.buffers[0] == nullptr);
+		assertTrue (array.children[0]->buffers[1] == ids.values().data());
+		assertTrue (array.children[1]->buffers[0] == names.validity().data());
+		assertTrue (array.children[1]->buffers[1] == names.offsets().data());
+		assertTrue (array.children[1]->buffers[2] == names.values().data());
+	}
+
+	ArrowBatch invalid;
+	invalid.addColumn("a", MetaColumn::FDT_INT8).append(Int8(1));
+	invalid.addColumn("b", MetaColumn::FDT_INT8);
+	try
+	{
+		ArrowArray invalidArray;
+		ArrowSchema invalidSchema;
+		invalid.exportTo(&invalidArray, &invalidSchema);
+		fail ("must fail");
+	}
+	catch (RangeException&) { }
+
+	// the exported data outlives the batch
+	assertTrue (std::string(schema.format) == "+s");
+	assertTrue (schema.n_children == 2);
+	assertTrue (std::string(schema.children[0]->name) == "id");
+	assertTrue (std::string(schema.children[0]->format) == "l");
+	assertTrue (std::string(schema.children[1]->name) == "name");
+	assertTrue (std::string(schema.children[1]->format) == "u");
+	assertTrue (schema.children[1]->flags == ARROW_FLAG_NULLABLE);
+
+	assertTrue (array.length == 2);
+	assertTrue (array.n_children == 2);
+	const ArrowArray* pIds = array.children[0];
+	assertTrue (pIds->n_buffers == 2);
+	assertTrue (pIds->null_count == 0);
+	assertTrue (static_cast<const Int64*>(pIds->buffers[1])[1] == 2);
+	const ArrowArray* pNames = array.children[1];
+	assertTrue (pNames->n_buffers == 3);
+	assertTrue (pNames->null_count == 1);
+	assertTrue (static_cast<const Int32*>(pNames->buffers[1])[2] == 3);
+	assertTrue (std::string(static_cast<const char*>(pNames->buffers[2]), 3) == "one");
+
+	// a consumer may move a child out and release it independently
+	ArrowArray moved = *array.children[0];
+	array.children[0]->release = nullptr;
+	array.release(&array);
+	assertTrue (array.release == nullptr);
+	assertTrue (static_cast<const Int64*>(moved.buffers[1])[0] == 1);
+	moved.release(&moved);
+	assertTrue (moved.release == nullptr);
+	schema.release(&schema);
+	assertTrue (schema.release == nullptr);
+}
+
+
+namespace
+{
+	class FlatBufferTable
+		/// A minimal FlatBuffers reader for checking the Arrow IPC
+		/// metadata written by ArrowStreamWriter.
+	{
+	public:
+		FlatBufferTable(const char* pBuffer, std::size_t pos):
+			_pBuffer(pBuffer),
+			_pos(pos)
+		{
+		}
+
+		static FlatBufferTable root(const char* pBuffer)
+		{
+			return FlatBufferTable(pBuffer, read<UInt32>(pBuffer, 0));
+		}
+
+		template <typename T>
+		T scalar(int field, T deflt = 0) const
+		{
+			const std::size_t offset = fieldOffset(field);
+			return offset ? read<T>(_pBuffer, _pos + offset) : deflt;
+		}
+
+		FlatBufferTable table(int field) const
+		{
+			return FlatBufferTable(_pBuffer, indirect(field));
+		}
+
+		std::string string(int field) const
+		{
+			const std::size_t pos = indirect(field);
+			return std::string(_pBuffer + pos + 4, read<UInt32>(_pBuffer, pos));
+		}
+
+		std::size_t vectorSize(int field) const
+		{
+			return read<UInt32>(_pBuffer, indirect(field));
+		}
+
+		FlatBufferTable tableAt(int field, std::size_t index) const
+			/// Returns an element of a vector of tables.
+		{
+			const std::size_t pos = indirect(field) + 4 + 4*index;
+			return FlatBufferTable(_pBuffer, pos + read<UInt32>(_pBuffer, pos));
+		}
+
+		Int64 structAt(int field, std::size_t index, int member) const
+			/// Returns a member of an element of a vector of structs
+			/// consisting of two longs (FieldNode, Buffer).
+		{
+			return read<Int64>(_pBuffer, indirect(field) + 4 + 16*index + 8*member);
+		}
+
+		template <typename T>
+		static T read(const char* pBuffer, std::size_t pos)
+		{
+			T value;
+			std::memcpy(&value, pBuffer + pos, sizeof(T));
+			if constexpr (sizeof(T) > 1) value = ByteOrder::fromLittleEndian(value);
+			return value;
+		}
+
+	private:
+		std::size_t fieldOffset(int field) const
+		{
+			const std::size_t vtable = _pos - read<Int32>(_pBuffer, _pos);
+			const UInt16 vtableSize = read<UInt16>(_pBuffer, vtable);
+			const std::size_t entry = 4 + 2*field;
+			return entry < vtableSize ? read<UInt16>(_pBuffer, vtable + entry) : 0;
+		}
+
+		std::size_t indirect(int field) const
+		{
+			const std::size_t pos = _pos + fieldOffset(field);
+			return pos + read<UInt32>(_pBuffer, pos);
+		}
+
+		const char* _pBuffer;
+		std::size_t _pos;
+	};
+}
+
+
+void DataTest::testArrowStreamWriter()
+{
+	ArrowBatch batch;
+	ArrowColumn& ids = batch.addColumn("id", MetaColumn::FDT_INT32);
+	ArrowColumn& names = batch.addColumn("name", MetaColumn::FDT_STRING);
+	ids.append(Int32(1));
+	ids.appendNull();
+	names.append("one"s);
+	names.append("two"s);
+
+	std::ostringstream ostr;
+	ArrowStreamWriter writer(ostr);
+	writer.write(batch);
+	writer.write(batch);
+	assertTrue (writer.batchCount() == 2);
+
+	ArrowBatch other;
+	other.addColumn("id", MetaColumn::FDT_INT64);
+	other.addColumn("name", MetaColumn::FDT_STRING);
+	try
+	{
+		writer.write(other);
+		fail ("must fail");
+	}
+	catch (InvalidArgumentException&) { }
+
+	writer.close();
+	try
+	{
+		writer.write(batch);
+		fail ("must fail");
+	}
+	catch (IllegalStateException&) { }
+
+	// schema message, two record batch messages, end-of-stream marker
+	const std::string data = ostr.str();
+	assertTrue (data.size() % 8 == 0);
+	assertTrue (data.compare(0, 4, "\xff\xff\xff\xff") == 0);
+	assertTrue (data.compare(data.size() - 8, 8, "\xff\xff\xff\xff\0\0\0\0"s) == 0);
+	std::size_t messages = 0;
+	std::size_t pos = 0;
+	while (pos + 8 <= data.size())
+	{
+		assertTrue (data.compare(pos, 4, "\xff\xff\xff\xff") == 0);
+		const UInt32 length = FlatBufferTable::read<UInt32>(data.data(), pos + 4);
+		if (length == 0) break;
+		assertTrue (length % 8 == 0);
+		++messages;
+
+		// Message: version, header type, header, bodyLength
+		const char* pMetadata = data.data() + pos + 8;
+		const FlatBufferTable message = FlatBufferTable::root(pMetadata);
+		assertTrue (message.scalar<Int16>(0) == 4); // MetadataVersion V5
+		const Int64 bodyLength = message.scalar<Int64>(3);
+		const char* pBody = pMetadata + length;
+		if (messages == 1)
+		{
+			// Schema: endianness, fields
+			assertTrue (message.scalar<UInt8>(1) == 1);
+			assertTrue (bodyLength == 0);
+			const FlatBufferTable schema = message.table(2);
+			assertTrue (schema.scalar<Int16>(0) == 0); // little endian
+			assertTrue (schema.vectorSize(1) == 2);
+
+			// Field: name, nullable, type type, type
+			const FlatBufferTable id = schema.tableAt(1, 0);
+			assertTrue (id.string(0) == "id");
+			assertTrue (id.scalar<UInt8>(1) == 1);
+			assertTrue (id.scalar<UInt8>(2) == 2); // Int
+			assertTrue (id.table(3).scalar<Int32>(0) == 32);
+			assertTrue (id.table(3).scalar<UInt8>(1) == 1);
+
+			const FlatBufferTable name = schema.tableAt(1, 1);
+			assertTrue (name.string(0) == "name");
+			assertTrue (name.scalar<UInt8>(1) == 1);
+			assertTrue (name.scalar<UInt8>(2) == 5); // Utf8
+		}
+		else
+		{
+			// RecordBatch: length, nodes, buffers
+			assertTrue (message.scalar<UInt8>(1) == 3);
+			const FlatBufferTable recordBatch = message.table(2);
+			assertTrue (recordBatch.scalar<Int64>(0) == 2);
+
+			// FieldNode: length, null count
+			assertTrue (recordBatch.vectorSize(1) == 2);
+			assertTrue (recordBatch.structAt(1, 0, 0) == 2);
+			assertTrue (recordBatch.structAt(1, 0, 1) == 1);
+			assertTrue (recordBatch.structAt(1, 1, 0) == 2);
+			assertTrue (recordBatch.structAt(1, 1, 1) == 0);
+
+			// Buffer: offset, length; id validity and values,
+			// name validity (empty, no nulls), offsets and values
+			assertTrue (recordBatch.vectorSize(2) == 5);
+			const Int64 expected[5][2] = {{0, 1}, {8, 8}, {16, 0}, {16, 12}, {32, 6}};
+			for (std::size_t i = 0; i < 5; ++i)
+			{
+				assertTrue (recordBatch.structAt(2, i, 0) == expected[i][0]);
+				assertTrue (recordBatch.structAt(2, i, 1) == expected[i][1]);
+			}
+			assertTrue (bodyLength == 40);
+
+			assertTrue ((static_cast<UInt8>(pBody[0]) & 0x03) == 0x01);
+			assertTrue (FlatBufferTable::read<Int32>(pBody, 8) == 1);
+			assertTrue (FlatBufferTable::read<Int32>(pBody, 16) == 0);
+			assertTrue (FlatBufferTable::read<Int32>(pBody, 20) == 3);
+			assertTrue (FlatBufferTable::read<Int32>(pBody, 24) == 6);
+			assertTrue (std::string(pBody + 32, 6) == "onetwo");
+		}
+		pos += 8 + length + static_cast<std::size_t>(bodyLength);
+	}
+	assertTrue (messages == 3);
+	assertTrue (pos == data.size() - 8);
+}
+
+
 void DataTest::setUp()
 {
 }
@@ -1743,6 +2092,9 @@ CppUnit::Test* DataTest::suite()
 	CppUnit_addTest(pSuite, DataTest, testSQLChannel);
 	CppUnit_addTest(pSuite, DataTest, testNullableExtract);
 	CppUnit_addTest(pSuite, DataTest, testTransactionAutoCommit);
+	CppUnit_addTest(pSuite, DataTest, testArrowColumn);
+	CppUnit_addTest(pSuite, DataTest, testArrowBatchExport);
+	CppUnit_addTest(pSuite, DataTest, testArrowStreamWriter);
 
 	return pSuite;
 }
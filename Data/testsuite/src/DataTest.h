@@ -49,6 +49,9 @@ public:
 	void testSQLChannel();
 	void testNullableExtract();
 	void testTransactionAutoCommit();
+	void testArrowColumn();
+	void testArrowBatchExport();
+	void testArrowStreamWriter();
 
 	void setUp();
 	void tearDown();
@@ -16,6 +16,8 @@
 #include "Poco/Thread.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Exception.h"
+#include <atomic>
+#include <vector>
 #include "Connector.h"
 
 
@@ -32,6 +34,29 @@ using Poco::Data::SessionPoolExistsException;
 using Poco::Data::SessionUnavailableException;
 
 
+namespace
+{
+	class TrackingSessionPool: public SessionPool
+		/// Keeps the sessions created by the pool, so that
+		/// the test can change their state while they are idle.
+	{
+	public:
+		TrackingSessionPool(const std::string& connector, const std::string& connectionString):
+			SessionPool(connector, connectionString, 1, 4, 60, 10)
+		{
+		}
+
+		std::vector<AutoPtr<Poco::Data::SessionImpl>> sessions;
+
+	protected:
+		void customizeSession(Session& session) override
+		{
+			sessions.push_back(AutoPtr<Poco::Data::SessionImpl>(session.impl(), true));
+		}
+	};
+}
+
+
 SessionPoolTest::SessionPoolTest(const std::string& name): CppUnit::TestCase(name)
 {
 	Poco::Data::Test::Connector::addToFactory();
@@ -263,6 +288,210 @@ void SessionPoolTest::testSessionPoolContainer()
 }
 
 
+void SessionPoolTest::testSessionPoolThreadAffinity()
+{
+	SessionPool pool("test", "cs", 1, 4, 60, 10);
+	assertTrue (!pool.getThreadAffinity());
+
+	{
+		Session s1(pool.get());
+		Session s2(pool.get());
+	}
+
+	SessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.requests == 2);
+	assertTrue (stats.created == 2);
+	assertTrue (stats.affinityHits == 0);
+	assertTrue (pool.idle() == 2);
+
+	pool.setThreadAffinity(true);
+	assertTrue (pool.getThreadAffinity());
+	{
+		Session s1(pool.get());
+	}
+	assertTrue (pool.statistics().affinityHits == 0);
+
+	{
+		Session s1(pool.get());
+		assertTrue (pool.statistics().affinityHits == 1);
+
+		// the affine session is in use, so another one is recycled
+		Session s2(pool.get());
+		assertTrue (pool.statistics().affinityHits == 1);
+		assertTrue (pool.used() == 2);
+	}
+
+	Thread thread;
+	thread.startFunc([&pool]()
+	{
+		Session s(pool.get());
+	});
+	thread.join();
+
+	stats = pool.statistics();
+	assertTrue (stats.requests == 6);
+	assertTrue (stats.created == 2);
+	assertTrue (stats.affinityHits == 1);
+	assertTrue (pool.allocated() == 2);
+	assertTrue (pool.idle() == 2);
+
+	{
+		Session s1(pool.get());
+		Session s2(pool.get());
+		Session s3(pool.get());
+		Session s4(pool.get());
+		try { Session s5(pool.get()); fail ("must fail"); }
+		catch (SessionPoolExhaustedException&) { }
+	}
+
+	stats = pool.statistics();
+	assertTrue (stats.requests == 11);
+	assertTrue (stats.created == 4);
+	assertTrue (stats.exhausted == 1);
+	assertTrue (pool.idle() == 4);
+	assertTrue (pool.used() == 0);
+}
+
+
+void SessionPoolTest::testSessionPoolValidation()
+{
+	TrackingSessionPool pool("test", "cs");
+	assertTrue (pool.getValidationIdleTime() == 1);
+
+	// validate every session handed out
+	pool.setValidationIdleTime(0);
+	{
+		Session s(pool.get());
+	}
+	assertTrue (pool.sessions.size() == 1);
+	assertTrue (pool.idle() == 1);
+
+	// the connection is lost while the session is idle
+	pool.sessions[0]->setFeature("connected", false);
+	{
+		Session s(pool.get());
+		assertTrue (s.isConnected());
+	}
+	SessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.created == 2);
+	assertTrue (stats.dead == 1);
+	assertTrue (pool.allocated() == 1);
+	assertTrue (pool.idle() == 1);
+
+	// recently used sessions are not validated
+	pool.setValidationIdleTime(60);
+	pool.sessions[1]->setFeature("connected", false);
+	{
+		Session s(pool.get());
+		assertTrue (!s.isConnected());
+	}
+	stats = pool.statistics();
+	assertTrue (stats.created == 2);
+	assertTrue (stats.dead == 2);
+	assertTrue (pool.allocated() == 0);
+}
+
+
+void SessionPoolTest::testSessionPoolConcurrency()
+{
+	const int threads = 4;
+	const int iterations = 2000;
+	SessionPool pool("test", "cs", 1, threads, 60, 10);
+	std::atomic<int> exhausted(0);
+	std::atomic<int> failed(0);
+
+	std::vector<Thread> workers(threads);
+	for (auto& worker: workers)
+	{
+		worker.startFunc([&pool, &exhausted, &failed]()
+		{
+			for (int i = 0; i < iterations; ++i)
+			{
+				try
+				{
+					Session s(pool.get());
+					if (!s.isConnected()) ++failed;
+				}
+				catch (SessionPoolExhaustedException&)
+				{
+					++exhausted;
+				}
+			}
+		});
+	}
+	for (auto& worker: workers) worker.join();
+
+	assertTrue (failed == 0);
+	SessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.requests == threads*iterations);
+	assertTrue (stats.exhausted == static_cast<Poco::UInt64>(exhausted.load()));
+	assertTrue (stats.created <= static_cast<Poco::UInt64>(threads));
+	assertTrue (pool.allocated() <= threads);
+	assertTrue (pool.used() == 0);
+	assertTrue (pool.idle() == pool.allocated());
+	assertTrue (pool.available() == threads);
+}
+
+
+void SessionPoolTest::testSessionPoolShutdown()
+{
+	TrackingSessionPool pool("test", "cs");
+	Session s1(pool.get());
+	{
+		Session s2(pool.get());
+	}
+	assertTrue (pool.sessions.size() == 2);
+	assertTrue (pool.used() == 1);
+	assertTrue (pool.idle() == 1);
+
+	// idle sessions are closed at once, sessions in use when returned
+	pool.shutdown();
+	assertTrue (!pool.sessions[1]->isConnected());
+	assertTrue (pool.sessions[0]->isConnected());
+	assertTrue (pool.allocated() == 0);
+	assertTrue (pool.used() == 0);
+	assertTrue (pool.idle() == 0);
+	s1.close();
+	assertTrue (!pool.sessions[0]->isConnected());
+	assertTrue (pool.allocated() == 0);
+
+	// shutdown while other threads get and return sessions
+	const int threads = 4;
+	SessionPool racePool("test", "cs", 1, threads, 60, 10);
+	std::atomic<int> failed(0);
+	std::vector<Thread> workers(threads);
+	for (auto& worker: workers)
+	{
+		worker.startFunc([&racePool, &failed]()
+		{
+			for (;;)
+			{
+				try
+				{
+					Session s(racePool.get());
+					if (!s.isConnected()) ++failed;
+				}
+				catch (SessionPoolExhaustedException&)
+				{
+				}
+				catch (InvalidAccessException&)
+				{
+					break;
+				}
+			}
+		});
+	}
+	Thread::sleep(50);
+	racePool.shutdown();
+	for (auto& worker: workers) worker.join();
+
+	assertTrue (failed == 0);
+	assertTrue (racePool.allocated() == 0);
+	assertTrue (racePool.used() == 0);
+	assertTrue (racePool.idle() == 0);
+}
+
+
 void SessionPoolTest::setUp()
 {
 }
@@ -279,6 +508,10 @@ CppUnit::Test* SessionPoolTest::suite()
 
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPool);
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolContainer);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolThreadAffinity);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolValidation);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolConcurrency);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolShutdown);
 
 	return pSuite;
 }
@@ -26,6 +26,10 @@ public:
 
 	void testSessionPool();
 	void testSessionPoolContainer();
+	void testSessionPoolThreadAffinity();
+	void testSessionPoolValidation();
+	void testSessionPoolConcurrency();
+	void testSessionPoolShutdown();
 
 	void setUp();
 	void tearDown();
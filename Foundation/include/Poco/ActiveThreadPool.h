@@ -29,6 +29,7 @@ namespace Poco {
 
 class Runnable;
 class ActiveThreadPoolPrivate;
+class WorkStealingScheduler;
 
 
 class Foundation_API ActiveThreadPool
@@ -38,8 +39,20 @@ class Foundation_API ActiveThreadPool
 	/// The thread pool supports a task queue.
 	/// When there are no idle threads, tasks are placed in the task queue to wait for execution.
 	/// Use case for this pool is running many (more than os-max-thread-count) short live tasks
+	///
+	/// By default, tasks are kept in a single priority queue shared by
+	/// all threads. Alternatively, the pool can be created with the
+	/// SCHEDULING_WORK_STEALING policy, in which case tasks are executed
+	/// by a WorkStealingScheduler. This avoids the shared, lock-protected
+	/// queue, but task priorities and the expiry timeout are ignored.
 {
 public:
+	enum Scheduling
+	{
+		SCHEDULING_PRIORITY_QUEUE, /// Tasks are kept in a shared priority queue (default).
+		SCHEDULING_WORK_STEALING   /// Tasks are distributed over per-thread work-stealing deques.
+	};
+
 	ActiveThreadPool(int capacity = static_cast<int>(Environment::processorCount()) + 1,
 		int stackSize = POCO_THREAD_STACK_SIZE);
 		/// Creates a thread pool with a maximum thread count of capacity.
@@ -51,6 +64,14 @@ public:
 		/// Creates a thread pool with the given name and a maximum thread count of capacity.
 		/// Threads are created with given stack size.
 
+	ActiveThreadPool(const std::string& name,
+		int capacity,
+		int stackSize,
+		Scheduling scheduling);
+		/// Creates a thread pool with the given name, a maximum thread count of capacity
+		/// and the given scheduling policy.
+		/// Threads are created with given stack size.
+
 	~ActiveThreadPool();
 		/// Currently running threads will remain active
 		/// until they complete.
@@ -69,8 +90,14 @@ public:
 		/// Set the thread expiry timeout value in milliseconds.
 		/// The default expiryTimeout is 30000 milliseconds (30 seconds).
 
+	Scheduling scheduling() const;
+		/// Returns the scheduling policy of the thread pool.
+
 	void start(Runnable& target, int priority = 0);
 		/// Obtains a thread and starts the target.
+		///
+		/// The priority is ignored if the pool uses
+		/// the SCHEDULING_WORK_STEALING policy.
 
 	void joinAll();
 		/// Waits for all threads to exit and removes all threads from the thread pool.
@@ -90,6 +117,7 @@ private:
 
 private:
 	std::unique_ptr<ActiveThreadPoolPrivate> _impl;
+	std::unique_ptr<WorkStealingScheduler> _pScheduler;
 };
 
 } // namespace Poco
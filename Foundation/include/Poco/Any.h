@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <typeinfo>
 #include <cstddef>
+#include <utility>
 
 
 namespace Poco {
@@ -58,9 +59,11 @@ union Placeholder
 	///
 	/// If Holder<Type> fits into POCO_SMALL_OBJECT_SIZE bytes of storage,
 	/// it will be placement-new-allocated into the local buffer
-	/// (i.e. there will be no heap-allocation). The local buffer size is one byte
-	/// larger - [POCO_SMALL_OBJECT_SIZE + 1], additional byte value indicating
-	/// where the object was allocated. See enum Allocation.
+	/// (i.e. there will be no heap-allocation). The local buffer size is two bytes
+	/// larger - [POCO_SMALL_OBJECT_SIZE + 2]. The first additional byte indicates
+	/// where the object was allocated (see enum Allocation). The second one
+	/// holds a tag that the owner can use to identify the type of the
+	/// held object without a virtual function call.
 	///
 	/// Important: for SOO builds, only same-type (or trivial both-empty no-op)
 	/// swap operation is allowed.
@@ -112,6 +115,20 @@ public:
 		return holder[SizeV] == Allocation::POCO_ANY_LOCAL;
 	}
 
+	unsigned char tag() const
+		/// Returns the tag set with setTag(), or 0
+		/// if nothing has been assigned since.
+	{
+		return holder[SizeV + 1];
+	}
+
+	void setTag(unsigned char tag)
+		/// Sets the tag of the held object. The tag
+		/// is reset to 0 when the Placeholder is erased.
+	{
+		holder[SizeV + 1] = tag;
+	}
+
 	template<typename T, typename V,
 		typename std::enable_if_t<TypeSizeLE<T, Placeholder::Size::value>::value>* = nullptr>
 	PlaceholderT* assign(const V& value)
@@ -132,6 +149,26 @@ public:
 		return pHolder;
 	}
 
+	template<typename T, typename V,
+		typename std::enable_if_t<TypeSizeLE<T, Placeholder::Size::value>::value>* = nullptr>
+	PlaceholderT* assign(V&& value)
+	{
+		erase();
+		new (reinterpret_cast<PlaceholderT*>(holder)) T(std::forward<V>(value));
+		setAllocation(Allocation::POCO_ANY_LOCAL);
+		return reinterpret_cast<PlaceholderT*>(holder);
+	}
+
+	template<typename T, typename V,
+		typename std::enable_if_t<TypeSizeGT<T, Placeholder::Size::value>::value>* = nullptr>
+	PlaceholderT* assign(V&& value)
+	{
+		erase();
+		pHolder = new T(std::forward<V>(value));
+		setAllocation(Allocation::POCO_ANY_EXTERNAL);
+		return pHolder;
+	}
+
 	PlaceholderT* content() const
 	{
 		if (isLocal())
@@ -187,6 +224,7 @@ private:
 			break;
 		}
 		setAllocation(Allocation::POCO_ANY_EMPTY);
+		setTag(0);
 		if (clear)
 		{
 			// Force to use optimised memset internally
@@ -194,7 +232,7 @@ private:
 		}
 	}
 
-	mutable unsigned char holder[SizeV+1];
+	mutable unsigned char holder[SizeV+2];
 	AlignerType           aligner;
 
 #else // POCO_NO_SOO
@@ -229,6 +267,17 @@ private:
 		return false;
 	}
 
+	unsigned char tag() const
+		/// Always returns 0, as there is no room
+		/// for a tag without small object optimization.
+	{
+		return 0;
+	}
+
+	void setTag(unsigned char)
+	{
+	}
+
 	template <typename T, typename V>
 	PlaceholderT* assign(const V& value)
 	{
@@ -236,6 +285,13 @@ private:
 		return pHolder = new T(value);
 	}
 
+	template <typename T, typename V>
+	PlaceholderT* assign(V&& value)
+	{
+		erase();
+		return pHolder = new T(std::forward<V>(value));
+	}
+
 	PlaceholderT* content() const
 	{
 		return pHolder;
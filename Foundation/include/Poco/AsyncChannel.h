@@ -25,7 +25,11 @@
 #include "Poco/Runnable.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/MPSCQueue.h"
+#include "Poco/Message.h"
+#include "Poco/Event.h"
 #include <atomic>
+#include <memory>
 
 
 namespace Poco {
@@ -40,10 +44,27 @@ class Foundation_API AsyncChannel: public Channel, public Runnable
 	///
 	/// All log messages are put into a queue and this queue is
 	/// then processed by a separate thread.
+	///
+	/// By default, every message is wrapped into a Notification
+	/// and passed through a NotificationQueue. Setting the "queueType"
+	/// property to "lockFree" uses a bounded, lock-free ring of
+	/// preallocated message slots (MPSCQueue) instead, which avoids
+	/// the allocation and the mutex for every message logged.
+	/// The background thread forwards the messages to the target
+	/// channel in batches.
 {
 public:
 	using Ptr = AutoPtr<AsyncChannel>;
 
+	enum OverflowPolicy
+		/// What happens to a message logged while the
+		/// lock-free queue is full.
+	{
+		OVERFLOW_BLOCK,       /// wait until the queue has free capacity
+		OVERFLOW_DROP_NEWEST, /// drop the message being logged
+		OVERFLOW_DROP_OLDEST  /// drop the oldest messages in the queue
+	};
+
 	AsyncChannel(Channel::Ptr pChannel = nullptr, Thread::Priority prio = Thread::PRIO_NORMAL);
 	/// Creates the AsyncChannel and connects it to
 	/// the given channel.
@@ -109,16 +130,58 @@ public:
 	/// Only supported on Linux and Windows.
 	///
 	/// The "enableCpuAffinity" property is set-only.
+	///
+	/// The "queueType" property selects the queue implementation.
+	/// Values: "notification" (default) or "lockFree".
+	/// In lock-free mode, the "queueSize" property specifies the
+	/// capacity of the ring (default 8192), which is rounded up
+	/// to the next power of two.
+	/// The "queueType" property must be set before the channel
+	/// is opened, and is set-only.
+	///
+	/// The "overflowPolicy" property specifies what happens if
+	/// a message is logged while the lock-free queue is full.
+	/// Values: "block", "dropNewest" (default) or "dropOldest".
+	/// With "dropOldest", the oldest queued message is discarded to
+	/// make room for the new one, so that the target channel receives
+	/// the most recent messages. When messages have been dropped, a log
+	/// message indicating the number of dropped messages is generated.
+	/// The "overflowPolicy" property is set-only.
+	///
+	/// The "batchSize" property specifies the maximum number of
+	/// messages the background thread takes from the lock-free queue
+	/// and forwards to the target channel at once (default 64).
+	/// The "batchSize" property is set-only.
+
+	std::size_t droppedMessages() const;
+		/// Returns the total number of messages dropped because
+		/// the queue was full.
 
 protected:
 	~AsyncChannel() override;
 	void run() override;
 	void setPriority(const std::string& value);
+	void setQueueType(const std::string& value);
+	void setOverflowPolicy(const std::string& value);
 
 private:
+	static constexpr std::size_t DEFAULT_RING_SIZE = 8192;
+	static constexpr std::size_t DEFAULT_BATCH_SIZE = 64;
+	static constexpr long IDLE_WAIT_MILLISECONDS = 250;
+
+	using MessageRing = MPSCQueue<Message>;
+
 	template <typename M>
 	void logImpl(M&& msg);
 
+	template <typename M>
+	void logRingImpl(M&& msg);
+
+	void runRing();
+	void wakeUpRing();
+	void waitForSpace();
+	void signalSpace();
+
 	Channel::Ptr _pChannel;
 	Thread    _thread;
 	FastMutex _threadMutex;
@@ -128,6 +191,18 @@ private:
 	std::size_t _dropCount = 0;
 	std::atomic<bool> _closed;
 	bool _enableCpuAffinity = false;
+	std::atomic<std::size_t> _totalDropCount{0};
+
+	bool _lockFree = false;
+	OverflowPolicy _overflowPolicy = OVERFLOW_DROP_NEWEST;
+	std::size_t _batchSize = DEFAULT_BATCH_SIZE;
+	std::unique_ptr<MessageRing> _pRing;
+	std::atomic<bool> _ringOpen{false};
+	std::atomic<bool> _ringIdle{false};
+	std::atomic<std::size_t> _ringDropCount{0};
+	std::atomic<int> _ringBlocked{0};
+	Event _ringEvent;
+	Event _ringSpaceEvent;
 };
 
 
@@ -0,0 +1,104 @@
+//
+// Base32.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Definition of class Base32.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base32_INCLUDED
+#define Foundation_Base32_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base32Encoder.h"
+#include <string>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base32
+	/// This class provides buffer-to-buffer Base32 encoding
+	/// and decoding, as specified in RFC 4648.
+	///
+	/// Groups of five bytes are processed as a single 40-bit
+	/// word, using table lookups for the alphabet.
+	///
+	/// The options are the same as for Base32Encoder and
+	/// Base32Decoder (see Base32EncodingOptions), and decode()
+	/// accepts the same input as Base32Decoder.
+	///
+	/// Base32Encoder and Base32Decoder use this class internally.
+{
+public:
+	static std::size_t encodedLength(std::size_t length, int options = BASE32_USE_PADDING);
+		/// Returns the number of characters encode() produces
+		/// for length bytes of input.
+
+	static std::size_t encode(const void* data, std::size_t length, char* output, int options = BASE32_USE_PADDING);
+		/// Encodes length bytes starting at data and writes the result
+		/// to output, which must have room for at least
+		/// encodedLength(length, options) characters.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const std::string& data, int options = BASE32_USE_PADDING);
+		/// Encodes the given data and returns the result.
+
+	static std::size_t decodedLength(std::size_t length);
+		/// Returns the maximum number of bytes decode() produces
+		/// for length characters of input.
+
+	static std::size_t decode(const char* data, std::size_t length, void* output, int options = 0);
+		/// Decodes length characters starting at data and writes the
+		/// result to output, which must have room for at least
+		/// decodedLength(length) bytes.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input contains an
+		/// invalid character, or if it ends with a group of a length
+		/// not permitted by RFC 4648 (1, 3 or 6 characters).
+
+	static std::string decode(const std::string& data, int options = 0);
+		/// Decodes the given data and returns the result.
+		///
+		/// Throws a DataFormatException if the input is not valid.
+
+	static const unsigned char* alphabet(int options);
+		/// Returns the 32 character alphabet selected by the
+		/// given options.
+
+	Base32() = delete;
+
+private:
+	static std::size_t decodeBlocks(const char*& it, const char* end, unsigned char* output, int options, bool& invalid);
+		/// Decodes complete groups of eight characters, starting at it.
+		///
+		/// Stops at the first incomplete group, or at the first group
+		/// containing an invalid character, in which case invalid is set
+		/// to true. In both cases it is left pointing to the start of that
+		/// group. Returns the number of bytes written.
+
+	static std::size_t decodeFinal(const char* it, const char* end, unsigned char* output, int options);
+		/// Decodes the incomplete group left over by decodeBlocks()
+		/// at the end of the input.
+
+	friend class Base32DecoderBuf;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base32_INCLUDED
@@ -19,17 +19,22 @@
 
 
 #include "Poco/Foundation.h"
-#include "Poco/UnbufferedStreamBuf.h"
+#include "Poco/BufferedStreamBuf.h"
 #include <istream>
 
 
 namespace Poco {
 
 
-class Foundation_API Base32DecoderBuf: public UnbufferedStreamBuf
+class Foundation_API Base32DecoderBuf: public BufferedStreamBuf
 	/// This streambuf base32-decodes all data read
 	/// from the istream connected to it.
 	///
+	/// Input is read and decoded in blocks (see Base32::decode()).
+	/// If the input contains an invalid character, the data decoded
+	/// before it is returned first, and the next read throws a
+	/// DataFormatException.
+	///
 	/// Note: For performance reasons, the characters
 	/// are read directly from the given istream's
 	/// underlying streambuf, so the state
@@ -41,20 +46,19 @@ public:
 	~Base32DecoderBuf() override;
 
 private:
-	int readFromDevice() override;
-	int readOne();
+	std::streamsize readFromDevice(char* buffer, std::streamsize length) override;
 
-	static const unsigned char* encoding(int options);
+	enum
+	{
+		BUFFER_SIZE = 4096
+	};
 
-	unsigned char   _group[8];
-	int             _groupLength;
-	int             _groupIndex;
+	int             _options;
 	std::streambuf& _buf;
-	const unsigned char* _encoding;
-
-	static const unsigned char REVERSE_DEFAULT_ENCODING[256];
-	static const unsigned char REVERSE_HEX_ENCODING[256];
-	static const unsigned char REVERSE_CROCKFORD_ENCODING[256];
+	char            _input[BUFFER_SIZE];
+	std::streamsize _pending;
+	bool            _eof;
+	bool            _error;
 
 private:
 	Base32DecoderBuf(const Base32DecoderBuf&);
@@ -75,20 +75,18 @@ protected:
 		/// Returns the alphabet to be used for encoding/decoding
 		/// according to the specified options.
 
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
+		/// Encodes all complete groups of five bytes in one
+		/// pass (see Base32::encode()), instead of byte by byte.
+
 private:
 	int writeToDevice(char c) override;
+	int writeGroups(const unsigned char* data, std::streamsize groups);
 
 	unsigned char   _group[5];
 	int             _groupLength;
 	std::streambuf& _buf;
-	bool		_doPadding;
-	const unsigned char* _encoding;
-
-	static const unsigned char DEFAULT_ENCODING[32];
-	static const unsigned char HEX_ENCODING[32];
-	static const unsigned char CROCKFORD_ENCODING[32];
-
-	friend class Base32DecoderBuf;
+	int             _options;
 
 	Base32EncoderBuf(const Base32EncoderBuf&);
 	Base32EncoderBuf& operator = (const Base32EncoderBuf&);
@@ -0,0 +1,106 @@
+//
+// Base64.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Definition of class Base64.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Base64_INCLUDED
+#define Foundation_Base64_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Base64Encoder.h"
+#include <string>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API Base64
+	/// This class provides buffer-to-buffer Base64 encoding
+	/// and decoding, as specified in RFC 4648.
+	///
+	/// Blocks of input are processed with AVX2, SSSE3 or NEON
+	/// instructions if the CPU supports them (see CPUFeatures).
+	/// A table-driven scalar implementation handles the remaining
+	/// input and other CPUs.
+	///
+	/// The options are the same as for Base64Encoder and
+	/// Base64Decoder (see Base64EncodingOptions), and decode()
+	/// accepts the same input as Base64Decoder. Unlike Base64Encoder,
+	/// encode() never inserts line breaks.
+	///
+	/// Base64Encoder and Base64Decoder use this class internally.
+{
+public:
+	static std::size_t encodedLength(std::size_t length, int options = 0);
+		/// Returns the number of characters encode() produces
+		/// for length bytes of input.
+
+	static std::size_t encode(const void* data, std::size_t length, char* output, int options = 0);
+		/// Encodes length bytes starting at data and writes the result
+		/// to output, which must have room for at least
+		/// encodedLength(length, options) characters.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const std::string& data, int options = 0);
+		/// Encodes the given data and returns the result.
+
+	static std::size_t decodedLength(std::size_t length);
+		/// Returns the maximum number of bytes decode() produces
+		/// for length characters of input.
+
+	static std::size_t decode(const char* data, std::size_t length, void* output, int options = 0);
+		/// Decodes length characters starting at data and writes the
+		/// result to output, which must have room for at least
+		/// decodedLength(length) bytes.
+		///
+		/// Whitespace (space, tab, CR and LF) is ignored, unless
+		/// BASE64_URL_ENCODING is specified.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input contains an
+		/// invalid character, or if it ends with an incomplete group
+		/// and BASE64_NO_PADDING has not been specified.
+
+	static std::string decode(const std::string& data, int options = 0);
+		/// Decodes the given data and returns the result.
+		///
+		/// Throws a DataFormatException if the input is not valid.
+
+	Base64() = delete;
+
+private:
+	static std::size_t decodeBlocks(const char*& it, const char* end, unsigned char* output, int options, bool& invalid);
+		/// Decodes complete groups of four characters, starting at it.
+		///
+		/// Stops at the first incomplete group, or at the first group
+		/// containing an invalid character, in which case invalid is set
+		/// to true. In both cases it is left pointing to the start of that
+		/// group. Returns the number of bytes written.
+
+	static std::size_t decodeFinal(const char* it, const char* end, unsigned char* output, int options);
+		/// Decodes the incomplete group left over by decodeBlocks()
+		/// at the end of the input.
+
+	friend class Base64DecoderBuf;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Base64_INCLUDED
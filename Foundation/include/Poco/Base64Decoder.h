@@ -19,17 +19,22 @@
 
 
 #include "Poco/Foundation.h"
-#include "Poco/UnbufferedStreamBuf.h"
+#include "Poco/BufferedStreamBuf.h"
 #include <istream>
 
 
 namespace Poco {
 
 
-class Foundation_API Base64DecoderBuf: public UnbufferedStreamBuf
+class Foundation_API Base64DecoderBuf: public BufferedStreamBuf
 	/// This streambuf base64-decodes all data read
 	/// from the istream connected to it.
 	///
+	/// Input is read and decoded in blocks (see Base64::decode()).
+	/// If the input contains an invalid character, the data decoded
+	/// before it is returned first, and the next read throws a
+	/// DataFormatException.
+	///
 	/// Note: For performance reasons, the characters
 	/// are read directly from the given istream's
 	/// underlying streambuf, so the state
@@ -41,20 +46,19 @@ public:
 	~Base64DecoderBuf() override;
 
 private:
-	int readFromDevice() override;
-	int readOne();
+	std::streamsize readFromDevice(char* buffer, std::streamsize length) override;
+
+	enum
+	{
+		BUFFER_SIZE = 4096
+	};
 
 	int             _options;
-	unsigned char   _group[3];
-	int             _groupLength;
-	int             _groupIndex;
 	std::streambuf& _buf;
-	const unsigned char* _pInEncoding;
-
-	static unsigned char IN_ENCODING[256];
-	static bool          IN_ENCODING_INIT;
-	static unsigned char IN_ENCODING_URL[256];
-	static bool          IN_ENCODING_URL_INIT;
+	char            _input[BUFFER_SIZE];
+	std::streamsize _pending;
+	bool            _eof;
+	bool            _error;
 
 private:
 	Base64DecoderBuf(const Base64DecoderBuf&);
@@ -67,8 +67,14 @@ public:
 	int getLineLength() const;
 		/// Returns the currently set line length.
 
+protected:
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
+		/// Encodes all complete groups of three bytes in one
+		/// pass (see Base64::encode()), instead of byte by byte.
+
 private:
 	int writeToDevice(char c) override;
+	int writeGroups(const unsigned char* data, std::streamsize groups);
 
 	int             _options;
 	unsigned char   _group[3];
@@ -76,12 +82,6 @@ private:
 	int             _pos;
 	int             _lineLength;
 	std::streambuf& _buf;
-	const unsigned char* _pOutEncoding;
-
-	static const unsigned char OUT_ENCODING[64];
-	static const unsigned char OUT_ENCODING_URL[64];
-
-	friend class Base64DecoderBuf;
 
 	Base64EncoderBuf(const Base64EncoderBuf&);
 	Base64EncoderBuf& operator = (const Base64EncoderBuf&);
@@ -0,0 +1,82 @@
+//
+// CPUFeatures.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  CPUFeatures
+//
+// Definition of the CPUFeatures class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CPUFeatures_INCLUDED
+#define Foundation_CPUFeatures_INCLUDED
+
+
+#include "Poco/Foundation.h"
+
+
+#if (POCO_ARCH == POCO_ARCH_AMD64 || POCO_ARCH == POCO_ARCH_IA32) && (defined(__GNUC__) || defined(_MSC_VER))
+	#define POCO_CPU_X86 1
+#elif (POCO_ARCH == POCO_ARCH_AARCH64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+	#define POCO_CPU_NEON 1
+#endif
+
+
+#if defined(__GNUC__)
+	#define POCO_TARGET(features) __attribute__((target(features)))
+		/// Enables the given instruction set extensions for a single
+		/// function, so that intrinsics can be used without compiling
+		/// the whole translation unit for a newer CPU. The function must
+		/// only be called after checking the corresponding CPUFeatures flag.
+#else
+	#define POCO_TARGET(features)
+#endif
+
+
+namespace Poco {
+
+
+class Foundation_API CPUFeatures
+	/// This class provides runtime detection of the CPU instruction
+	/// set extensions used by the optimized code paths in the library.
+	///
+	/// Detection is performed once, on first use; all member functions
+	/// are thread-safe.
+{
+public:
+	static bool hasSSSE3();
+		/// Returns true if the CPU supports SSSE3.
+
+	static bool hasSSE42();
+		/// Returns true if the CPU supports SSE4.2, including the
+		/// CRC32 instruction.
+
+	static bool hasPCLMUL();
+		/// Returns true if the CPU supports the PCLMULQDQ (carry-less
+		/// multiplication) instruction.
+
+	static bool hasAVX2();
+		/// Returns true if the CPU and the operating system support AVX2.
+
+	static bool hasSHA();
+		/// Returns true if the CPU supports the Intel SHA extensions
+		/// (SHA-1 and SHA-256).
+
+	static bool hasNEON();
+		/// Returns true if the CPU supports the ARMv8 Advanced SIMD (NEON)
+		/// instructions. Always true on AArch64.
+
+	CPUFeatures() = delete;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CPUFeatures_INCLUDED
@@ -0,0 +1,447 @@
+//
+// ConcurrentCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ConcurrentCache
+//
+// Definition of the ConcurrentCache class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ConcurrentCache_INCLUDED
+#define Foundation_ConcurrentCache_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/RWLock.h"
+#include "Poco/Clock.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Exception.h"
+#include "Poco/Bugcheck.h"
+#include <unordered_map>
+#include <functional>
+#include <vector>
+#include <set>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <class TKey, class TValue, class THash = std::hash<TKey>>
+class ConcurrentCache
+	/// A ConcurrentCache is a bounded cache designed for many threads
+	/// accessing it simultaneously.
+	///
+	/// Unlike the caches derived from AbstractCache, which serialize all
+	/// operations behind a single mutex and notify their strategy on
+	/// every access, a ConcurrentCache splits its entries into a number
+	/// of shards, selected by the hash of the key. Each shard is protected
+	/// by its own RWLock, and lookups only take the read lock, so
+	/// get() calls for different keys, or for the same key, proceed in
+	/// parallel.
+	///
+	/// Replacement within a shard uses the CLOCK algorithm, an
+	/// approximation of least recently used replacement: get() merely
+	/// sets a reference flag on the entry, and when space is needed, add()
+	/// sweeps over the entries, evicting the first one not referenced
+	/// since the last sweep. Expired entries are evicted first.
+	///
+	/// Entries can expire after a given time (in milliseconds). The
+	/// expiration time can be set for the whole cache, and overridden
+	/// for individual entries. Expired entries are never returned,
+	/// and are removed lazily when space is needed, or by forceReplace().
+	///
+	/// The cache counts hits, misses, evictions and expirations.
+	/// See statistics().
+	///
+	/// The capacity is divided evenly among the shards, so the cache may
+	/// evict an entry before the total capacity has been reached, if the
+	/// keys are not evenly distributed. ConcurrentCache does not fire
+	/// events.
+	///
+	/// Usage:
+	///     ConcurrentCache<std::string, Session> cache(100000, 30*60*1000);
+	///     cache.add(id, session);
+	///     ...
+	///     SharedPtr<Session> pSession = cache.get(id);
+	///     if (pSession) ...
+{
+public:
+	using ValuePtr = SharedPtr<TValue>;
+
+	struct Statistics
+	{
+		UInt64 hits = 0;
+			/// Number of get() calls that found a valid entry.
+		UInt64 misses = 0;
+			/// Number of get() calls that found no valid entry.
+		UInt64 evictions = 0;
+			/// Number of entries removed to make room for new ones.
+		UInt64 expirations = 0;
+			/// Number of expired entries removed.
+	};
+
+	enum
+	{
+		DEFAULT_SHARDS = 16
+	};
+
+	explicit ConcurrentCache(std::size_t capacity = 1024, Timestamp::TimeDiff expire = 0, std::size_t shards = DEFAULT_SHARDS):
+		/// Creates the ConcurrentCache, holding up to capacity entries.
+		///
+		/// If expire is greater than zero, entries expire after the
+		/// given number of milliseconds.
+		///
+		/// The number of shards is rounded up to the next power of two,
+		/// and reduced if necessary, so that each shard holds at least
+		/// one entry.
+		_expire(expire),
+		_shardBits(0)
+	{
+		if (capacity < 1) throw InvalidArgumentException("capacity must be > 0");
+		if (expire < 0) throw InvalidArgumentException("expire must be >= 0");
+
+		std::size_t shardCount = 1;
+		while (shardCount < shards && shardCount*2 <= capacity)
+		{
+			shardCount *= 2;
+			++_shardBits;
+		}
+		std::size_t shardCapacity = (capacity + shardCount - 1)/shardCount;
+		_shards.reserve(shardCount);
+		for (std::size_t i = 0; i < shardCount; ++i)
+		{
+			_shards.emplace_back(new Shard(shardCapacity));
+		}
+	}
+
+	~ConcurrentCache() = default;
+
+	ConcurrentCache(const ConcurrentCache&) = delete;
+	ConcurrentCache& operator = (const ConcurrentCache&) = delete;
+
+	void add(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		add(key, ValuePtr(new TValue(val)), _expire);
+	}
+
+	void add(const TKey& key, ValuePtr val)
+		/// Adds the key value pair to the cache. Note that adding a null SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		add(key, val, _expire);
+	}
+
+	void add(const TKey& key, ValuePtr val, Timestamp::TimeDiff expire)
+		/// Adds the key value pair to the cache, expiring after the
+		/// given number of milliseconds, or never if expire is zero.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		poco_check_ptr (val.get());
+
+		Shard& shard = shardFor(key);
+		Clock::ClockVal now = Clock().raw();
+		Clock::ClockVal expiry = expire > 0 ? now + expire*1000 : 0;
+
+		RWLock::ScopedWriteLock lock(shard.lock);
+		auto it = shard.index.find(key);
+		if (it != shard.index.end())
+		{
+			Slot& slot = shard.slots[it->second];
+			slot.value = val;
+			slot.expiry = expiry;
+			slot.referenced.store(true, std::memory_order_relaxed);
+		}
+		else
+		{
+			if (shard.freeSlots.empty()) evict(shard, now);
+			std::size_t pos = shard.freeSlots.back();
+			shard.freeSlots.pop_back();
+			Slot& slot = shard.slots[pos];
+			slot.key = key;
+			slot.value = val;
+			slot.expiry = expiry;
+			slot.used = true;
+			slot.referenced.store(false, std::memory_order_relaxed);
+			shard.index.emplace(key, pos);
+		}
+	}
+
+	void remove(const TKey& key)
+		/// Removes an entry from the cache. If the entry is not found,
+		/// the remove is ignored.
+	{
+		Shard& shard = shardFor(key);
+		RWLock::ScopedWriteLock lock(shard.lock);
+		auto it = shard.index.find(key);
+		if (it != shard.index.end())
+		{
+			release(shard, it->second);
+			shard.index.erase(it);
+		}
+	}
+
+	bool has(const TKey& key) const
+		/// Returns true if the cache contains a valid value for the key.
+	{
+		const Shard& shard = shardFor(key);
+		RWLock::ScopedReadLock lock(shard.lock);
+		auto it = shard.index.find(key);
+		return it != shard.index.end() && !isExpired(shard.slots[it->second]);
+	}
+
+	ValuePtr get(const TKey& key)
+		/// Returns a SharedPtr of the value. The SharedPtr will remain valid
+		/// even when cache replacement removes the element.
+		/// If for the key no valid value exists, an empty SharedPtr is returned.
+	{
+		Shard& shard = shardFor(key);
+		RWLock::ScopedReadLock lock(shard.lock);
+		auto it = shard.index.find(key);
+		if (it != shard.index.end())
+		{
+			const Slot& slot = shard.slots[it->second];
+			if (!isExpired(slot))
+			{
+				// only write the flag if necessary, to avoid
+				// invalidating the cache line in other cores
+				if (!slot.referenced.load(std::memory_order_relaxed))
+					slot.referenced.store(true, std::memory_order_relaxed);
+				shard.hits.fetch_add(1, std::memory_order_relaxed);
+				return slot.value;
+			}
+		}
+		shard.misses.fetch_add(1, std::memory_order_relaxed);
+		return ValuePtr();
+	}
+
+	void clear()
+		/// Removes all elements from the cache.
+	{
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedWriteLock lock(pShard->lock);
+			for (std::size_t pos = 0; pos < pShard->slots.size(); ++pos)
+			{
+				if (pShard->slots[pos].used) release(*pShard, pos);
+			}
+			pShard->index.clear();
+			pShard->hand = 0;
+		}
+	}
+
+	std::size_t size()
+		/// Returns the number of cached elements, after
+		/// removing expired elements.
+	{
+		forceReplace();
+		std::size_t result = 0;
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedReadLock lock(pShard->lock);
+			result += pShard->index.size();
+		}
+		return result;
+	}
+
+	void forceReplace()
+		/// Removes all expired elements. As with the other caches, there
+		/// is no background thread removing expired elements, so this can
+		/// be used to release their memory if the cache is rarely modified.
+	{
+		Clock::ClockVal now = Clock().raw();
+		for (auto& pShard: _shards)
+		{
+			RWLock::ScopedWriteLock lock(pShard->lock);
+			for (std::size_t pos = 0; pos < pShard->slots.size(); ++pos)
+			{
+				Slot& slot = pShard->slots[pos];
+				if (slot.used && slot.expiry != 0 && slot.expiry <= now)
+				{
+					pShard->index.erase(slot.key);
+					release(*pShard, pos);
+					pShard->expirations.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+	}
+
+	std::set<TKey> getAllKeys() const
+		/// Returns a copy of all keys of valid elements stored in the cache.
+	{
+		std::set<TKey> result;
+		forEach([&result](const TKey& key, const TValue&)
+			{
+				result.insert(key);
+			});
+		return result;
+	}
+
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+		/// Iterates over all valid key-value pairs in the
+		/// cache, using a functor or lambda expression.
+		///
+		/// The given functor must take the key and value
+		/// as parameters. Note that the value is passed
+		/// as the actual value (or reference),
+		/// not a Poco::SharedPtr.
+		///
+		/// Shards are locked one at a time, so the functor
+		/// must not modify the cache.
+	{
+		for (const auto& pShard: _shards)
+		{
+			RWLock::ScopedReadLock lock(pShard->lock);
+			for (const auto& slot: pShard->slots)
+			{
+				if (slot.used && !isExpired(slot)) fn(slot.key, *slot.value);
+			}
+		}
+	}
+
+	Statistics statistics() const
+		/// Returns the hit, miss, eviction and expiration counts.
+	{
+		Statistics stats;
+		for (const auto& pShard: _shards)
+		{
+			stats.hits        += pShard->hits.load(std::memory_order_relaxed);
+			stats.misses      += pShard->misses.load(std::memory_order_relaxed);
+			stats.evictions   += pShard->evictions.load(std::memory_order_relaxed);
+			stats.expirations += pShard->expirations.load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+	void resetStatistics()
+		/// Resets all counters to zero.
+	{
+		for (auto& pShard: _shards)
+		{
+			pShard->hits = 0;
+			pShard->misses = 0;
+			pShard->evictions = 0;
+			pShard->expirations = 0;
+		}
+	}
+
+	std::size_t capacity() const
+		/// Returns the maximum number of elements, which
+		/// may be slightly larger than the requested capacity.
+	{
+		return _shards.size()*_shards[0]->slots.size();
+	}
+
+	std::size_t shards() const
+		/// Returns the number of shards.
+	{
+		return _shards.size();
+	}
+
+private:
+	struct Slot
+	{
+		TKey key = TKey();
+		ValuePtr value;
+		Clock::ClockVal expiry = 0;
+		mutable std::atomic<bool> referenced{false};
+		bool used = false;
+	};
+
+	struct alignas(64) Shard
+	{
+		explicit Shard(std::size_t capacity):
+			slots(capacity)
+		{
+			freeSlots.reserve(capacity);
+			for (std::size_t pos = capacity; pos > 0; --pos) freeSlots.push_back(pos - 1);
+			index.reserve(capacity);
+		}
+
+		mutable RWLock lock;
+		std::unordered_map<TKey, std::size_t, THash> index;
+		std::vector<Slot> slots;
+		std::vector<std::size_t> freeSlots;
+		std::size_t hand = 0;
+		mutable std::atomic<UInt64> hits{0};
+		mutable std::atomic<UInt64> misses{0};
+		std::atomic<UInt64> evictions{0};
+		std::atomic<UInt64> expirations{0};
+	};
+
+	Shard& shardFor(const TKey& key) const
+	{
+		if (_shardBits == 0) return *_shards[0];
+		// Fibonacci hashing, so that the shard does not depend on the
+		// same low-order bits the shard's hash table uses.
+		UInt64 h = static_cast<UInt64>(_hash(key))*0x9E3779B97F4A7C15ULL;
+		return *_shards[static_cast<std::size_t>(h >> (64 - _shardBits))];
+	}
+
+	static bool isExpired(const Slot& slot)
+	{
+		return slot.expiry != 0 && slot.expiry <= Clock().raw();
+	}
+
+	static void release(Shard& shard, std::size_t pos)
+	{
+		Slot& slot = shard.slots[pos];
+		slot.key = TKey();
+		slot.value.reset();
+		slot.used = false;
+		shard.freeSlots.push_back(pos);
+	}
+
+	void evict(Shard& shard, Clock::ClockVal now)
+		/// Runs the clock hand until it finds an expired or
+		/// unreferenced entry, and removes that entry.
+	{
+		for (;;)
+		{
+			std::size_t pos = shard.hand;
+			if (++shard.hand == shard.slots.size()) shard.hand = 0;
+
+			Slot& slot = shard.slots[pos];
+			if (slot.expiry != 0 && slot.expiry <= now)
+			{
+				shard.expirations.fetch_add(1, std::memory_order_relaxed);
+			}
+			else if (slot.referenced.load(std::memory_order_relaxed))
+			{
+				slot.referenced.store(false, std::memory_order_relaxed);
+				continue;
+			}
+			else
+			{
+				shard.evictions.fetch_add(1, std::memory_order_relaxed);
+			}
+			shard.index.erase(slot.key);
+			release(shard, pos);
+			return;
+		}
+	}
+
+	std::vector<std::unique_ptr<Shard>> _shards;
+	Timestamp::TimeDiff _expire;
+	int _shardBits;
+	THash _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ConcurrentCache_INCLUDED
@@ -86,6 +86,17 @@ public:
 	{
 	}
 
+	Struct(Data&& val): _data(std::move(val))
+		/// Creates the Struct from the given value.
+	{
+	}
+
+	Struct(const Struct& other) = default;
+		/// Creates the Struct from another one.
+
+	Struct(Struct&& other) noexcept = default;
+		/// Creates the Struct by moving the contents of another one.
+
 	template <typename T>
 	Struct(const std::map<K, T>& val)
 	{
@@ -101,6 +112,12 @@ public:
 	virtual ~Struct() = default;
 		/// Destroys the Struct.
 
+	Struct& operator = (const Struct& other) = default;
+		/// Assigns another Struct.
+
+	Struct& operator = (Struct&& other) noexcept = default;
+		/// Move-assigns another Struct.
+
 	inline Var& operator [] (const K& name)
 		/// Returns the Var with the given name, creates an entry if not found.
 	{
@@ -317,6 +334,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(ValueType&& val): _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	const std::type_info& type() const override
@@ -409,6 +430,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const ValueType& value() const
 	{
 		return _val;
@@ -482,6 +508,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(ValueType&& val) : _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	const std::type_info& type() const override
@@ -574,6 +604,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const ValueType& value() const
 	{
 		return _val;
@@ -647,6 +682,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(ValueType&& val) : _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	const std::type_info& type() const override
@@ -739,6 +778,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const ValueType& value() const
 	{
 		return _val;
@@ -812,6 +856,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(ValueType&& val) : _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	const std::type_info&type() const override
@@ -904,6 +952,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const ValueType& value() const
 	{
 		return _val;
@@ -29,6 +29,8 @@
 #include <typeinfo>
 #include <map>
 #include <set>
+#include <type_traits>
+#include <utility>
 
 
 namespace Poco::Dynamic {
@@ -79,6 +81,14 @@ class Foundation_API Var
 	///
 	/// A Var can be created from and converted to a value of any type for which a specialization of
 	/// VarHolderImpl is available. For supported types, see VarHolder documentation.
+	///
+	/// Holders of up to POCO_SMALL_OBJECT_SIZE bytes, including those for std::string and
+	/// the container types, are stored inside the Var without a heap allocation. For bool,
+	/// the built-in integer and floating-point types and std::string, the Var additionally
+	/// stores a type tag, which lets extraction, conversion to numbers, comparison and
+	/// arithmetic access the value directly, without virtual function calls.
+	/// Vars and values of class type can be moved into a Var, and take() moves the
+	/// value out of a Var.
 {
 public:
 	using Ptr = SharedPtr<Var>;
@@ -95,12 +105,22 @@ public:
 		construct(val);
 	}
 
+	template <typename T, typename = std::enable_if_t<std::is_class_v<T> && !std::is_const_v<T> && !std::is_same_v<T, Var>>>
+	Var(T&& val)
+		/// Creates the Var from the given value, which is moved into the Var.
+	{
+		construct(std::move(val));
+	}
+
 	Var(const char* pVal);
 		// Convenience constructor for const char* which gets mapped to a std::string internally, i.e. pVal is deep-copied.
 
 	Var(const Var& other);
 		/// Copy constructor.
 
+	Var(Var&& other) noexcept;
+		/// Move constructor. The other Var is empty afterwards.
+
 	~Var();
 		/// Destroys the Var.
 
@@ -139,6 +159,10 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (Impl::hasVarConvert<T>())
+		{
+			if (convertTagged(val)) return;
+		}
 		pHolder->convert(val);
 	}
 
@@ -161,6 +185,17 @@ public:
 		if (!pHolder)
 			throw InvalidAccessException("Can not convert empty value.");
 
+		if constexpr (Impl::hasVarConvert<T>())
+		{
+			T result;
+			if (convertTagged(result)) return result;
+		}
+		else if constexpr (Impl::varTag<T>() != Impl::VAR_TAG_NONE)
+		{
+			if (_placeholder.tag() == Impl::varTag<T>())
+				return static_cast<VarHolderImpl<T>*>(pHolder)->value();
+		}
+
 		if (typeid(T) == pHolder->type()) return extract<T>();
 
 		T result;
@@ -182,17 +217,7 @@ public:
 		/// not available for the given type.
 		/// Throws InvalidAccessException if Var is empty.
 	{
-		VarHolder* pHolder = content();
-
-		if (!pHolder)
-			throw InvalidAccessException("Can not convert empty value.");
-
-		if (typeid(T) == pHolder->type())
-			return extract<T>();
-
-		T result;
-		pHolder->convert(result);
-		return result;
+		return convert<T>();
 	}
 
 	template <typename T>
@@ -206,6 +231,12 @@ public:
 	{
 		VarHolder* pHolder = content();
 
+		if constexpr (Impl::varTag<T>() != Impl::VAR_TAG_NONE)
+		{
+			if (_placeholder.tag() == Impl::varTag<T>())
+				return static_cast<VarHolderImpl<T>*>(pHolder)->value();
+		}
+
 		if ( (pHolder != nullptr) && pHolder->type() == typeid(T))
 		{
 			auto* pHolderImpl = static_cast<VarHolderImpl<T>*>(pHolder);
@@ -220,6 +251,21 @@ public:
 				Poco::demangle<T>()));
 	}
 
+	template <typename T>
+	T take()
+		/// Moves the actual value out of the Var, which
+		/// is empty afterwards.
+		///
+		/// Must be instantiated with the exact type of
+		/// the stored value, otherwise a BadCastException
+		/// is thrown.
+		/// Throws InvalidAccessException if Var is empty.
+	{
+		T value(std::move(const_cast<T&>(extract<T>())));
+		clear();
+		return value;
+	}
+
 	template <typename T>
 	Var& operator = (const T& other)
 		/// Assignment operator for assigning POD to Var
@@ -229,12 +275,24 @@ public:
 		return *this;
 	}
 
+	template <typename T, typename = std::enable_if_t<std::is_class_v<T> && !std::is_const_v<T> && !std::is_same_v<T, Var>>>
+	Var& operator = (T&& other)
+		/// Assignment operator for moving a value into the Var.
+	{
+		clear();
+		construct(std::move(other));
+		return *this;
+	}
+
 	bool operator ! () const;
 		/// Logical NOT operator.
 
 	Var& operator = (const Var& other);
 		/// Assignment operator specialization for Var
 
+	Var& operator = (Var&& other) noexcept;
+		/// Move assignment operator. The other Var is empty afterwards.
+
 	template <typename T>
 	const Var operator + (const T& other) const
 		/// Addition operator for adding POD to Var
@@ -600,14 +658,66 @@ private:
 	{
 	}
 
+	template <typename F>
+	bool visitTagged(F&& func) const
+		/// If the held value is of a tagged type, calls func with a pointer
+		/// to the VarHolderImpl for that type and returns true.
+		/// Otherwise, returns false.
+	{
+		VarHolder* pHolder = content();
+		switch (_placeholder.tag())
+		{
+		case Impl::VAR_TAG_BOOL:        func(static_cast<VarHolderImpl<bool>*>(pHolder)); return true;
+		case Impl::VAR_TAG_SCHAR:       func(static_cast<VarHolderImpl<signed char>*>(pHolder)); return true;
+		case Impl::VAR_TAG_SHORT:       func(static_cast<VarHolderImpl<short>*>(pHolder)); return true;
+		case Impl::VAR_TAG_INT:         func(static_cast<VarHolderImpl<int>*>(pHolder)); return true;
+		case Impl::VAR_TAG_LONG:        func(static_cast<VarHolderImpl<long>*>(pHolder)); return true;
+		case Impl::VAR_TAG_LONG_LONG:   func(static_cast<VarHolderImpl<long long>*>(pHolder)); return true;
+		case Impl::VAR_TAG_UCHAR:       func(static_cast<VarHolderImpl<unsigned char>*>(pHolder)); return true;
+		case Impl::VAR_TAG_USHORT:      func(static_cast<VarHolderImpl<unsigned short>*>(pHolder)); return true;
+		case Impl::VAR_TAG_UINT:        func(static_cast<VarHolderImpl<unsigned int>*>(pHolder)); return true;
+		case Impl::VAR_TAG_ULONG:       func(static_cast<VarHolderImpl<unsigned long>*>(pHolder)); return true;
+		case Impl::VAR_TAG_ULONG_LONG:  func(static_cast<VarHolderImpl<unsigned long long>*>(pHolder)); return true;
+		case Impl::VAR_TAG_FLOAT:       func(static_cast<VarHolderImpl<float>*>(pHolder)); return true;
+		case Impl::VAR_TAG_DOUBLE:      func(static_cast<VarHolderImpl<double>*>(pHolder)); return true;
+		case Impl::VAR_TAG_STRING:      func(static_cast<VarHolderImpl<std::string>*>(pHolder)); return true;
+		default:                        return false;
+		}
+	}
+
+	template <typename T>
+	bool convertTagged(T& val) const
+		/// Converts the held value with a non-virtual call
+		/// if its type is tagged.
+	{
+		return visitTagged([&val](auto* pImpl)
+			{
+				using Holder = std::remove_pointer_t<decltype(pImpl)>;
+				pImpl->Holder::convert(val);
+			});
+	}
+
+	bool integerValue(UInt64& magnitude, bool& negative) const;
+		/// If the held value is of a tagged integer type, stores its
+		/// absolute value and sign and returns true.
+
 	template<typename ValueType>
 	void construct(const ValueType& value)
 	{
 		_placeholder.assign<VarHolderImpl<ValueType>, ValueType>(value);
+		_placeholder.setTag(Impl::varTag<ValueType>());
+	}
+
+	template<typename ValueType, typename = std::enable_if_t<!std::is_reference_v<ValueType>>>
+	void construct(ValueType&& value)
+	{
+		_placeholder.assign<VarHolderImpl<ValueType>, ValueType>(std::move(value));
+		_placeholder.setTag(Impl::varTag<ValueType>());
 	}
 
 	void construct(const char* value);
 	void construct(const Var& other);
+	void construct(Var&& other) noexcept;
 
 	Placeholder<VarHolder> _placeholder;
 };
@@ -624,15 +734,32 @@ private:
 
 inline void Var::construct(const char* value)
 {
-	const std::string val(value);
-	_placeholder.assign<VarHolderImpl<std::string>, std::string>(val);
+	construct(std::string(value));
 }
 
 
 inline void Var::construct(const Var& other)
 {
 	if (!other.isEmpty())
+	{
 		(void) other.content()->clone(&_placeholder);
+		_placeholder.setTag(other._placeholder.tag());
+	}
+}
+
+
+inline void Var::construct(Var&& other) noexcept
+{
+	if (other._placeholder.isLocal())
+	{
+		(void) other.content()->moveTo(&_placeholder);
+		_placeholder.setTag(other._placeholder.tag());
+		other.clear();
+	}
+	else if (!other.isEmpty())
+	{
+		_placeholder.swap(other._placeholder);
+	}
 }
 
 
@@ -646,17 +773,9 @@ inline void Var::swap(Var& other)
 	}
 	else
 	{
-		const Var tmp(*this);
-		try
-		{
-			construct(other);
-			other = tmp;
-		}
-		catch (...)
-		{
-			construct(tmp);
-			throw;
-		}
+		Var tmp(std::move(*this));
+		*this = std::move(other);
+		other = std::move(tmp);
 	}
 }
 
@@ -782,6 +901,14 @@ inline bool Var::isOrdered() const
 
 inline bool Var::isInteger() const
 {
+	bool result = false;
+	if (visitTagged([&result](auto* pImpl)
+		{
+			using Holder = std::remove_pointer_t<decltype(pImpl)>;
+			result = pImpl->Holder::isInteger();
+		}))
+		return result;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isInteger() : false;
 }
@@ -789,6 +916,14 @@ inline bool Var::isInteger() const
 
 inline bool Var::isSigned() const
 {
+	bool result = false;
+	if (visitTagged([&result](auto* pImpl)
+		{
+			using Holder = std::remove_pointer_t<decltype(pImpl)>;
+			result = pImpl->Holder::isSigned();
+		}))
+		return result;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isSigned() : false;
 }
@@ -796,6 +931,14 @@ inline bool Var::isSigned() const
 
 inline bool Var::isNumeric() const
 {
+	bool result = false;
+	if (visitTagged([&result](auto* pImpl)
+		{
+			using Holder = std::remove_pointer_t<decltype(pImpl)>;
+			result = pImpl->Holder::isNumeric();
+		}))
+		return result;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isNumeric() : false;
 }
@@ -803,6 +946,14 @@ inline bool Var::isNumeric() const
 
 inline bool Var::isBoolean() const
 {
+	bool result = false;
+	if (visitTagged([&result](auto* pImpl)
+		{
+			using Holder = std::remove_pointer_t<decltype(pImpl)>;
+			result = pImpl->Holder::isBoolean();
+		}))
+		return result;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isBoolean() : false;
 }
@@ -810,6 +961,14 @@ inline bool Var::isBoolean() const
 
 inline bool Var::isString() const
 {
+	bool result = false;
+	if (visitTagged([&result](auto* pImpl)
+		{
+			using Holder = std::remove_pointer_t<decltype(pImpl)>;
+			result = pImpl->Holder::isString();
+		}))
+		return result;
+
 	VarHolder* pHolder = content();
 	return (pHolder != nullptr) ? pHolder->isString() : false;
 }
@@ -112,6 +112,75 @@ void containerToJSON(C& cont, std::string& val)
 }
 
 
+enum VarTag: unsigned char
+	/// Identifies the types held by a Var that the Var can
+	/// access without virtual function calls. All other types
+	/// are tagged VAR_TAG_NONE.
+{
+	VAR_TAG_NONE = 0,
+	VAR_TAG_BOOL,
+	VAR_TAG_SCHAR,
+	VAR_TAG_SHORT,
+	VAR_TAG_INT,
+	VAR_TAG_LONG,
+	VAR_TAG_LONG_LONG,
+	VAR_TAG_UCHAR,
+	VAR_TAG_USHORT,
+	VAR_TAG_UINT,
+	VAR_TAG_ULONG,
+	VAR_TAG_ULONG_LONG,
+	VAR_TAG_FLOAT,
+	VAR_TAG_DOUBLE,
+	VAR_TAG_STRING
+};
+
+
+template <typename T>
+constexpr VarTag varTag()
+	/// Returns the VarTag for values of type T.
+{
+	if constexpr (std::is_same_v<T, bool>) return VAR_TAG_BOOL;
+	else if constexpr (std::is_same_v<T, signed char>) return VAR_TAG_SCHAR;
+	else if constexpr (std::is_same_v<T, short>) return VAR_TAG_SHORT;
+	else if constexpr (std::is_same_v<T, int>) return VAR_TAG_INT;
+	else if constexpr (std::is_same_v<T, long>) return VAR_TAG_LONG;
+	else if constexpr (std::is_same_v<T, long long>) return VAR_TAG_LONG_LONG;
+	else if constexpr (std::is_same_v<T, unsigned char>) return VAR_TAG_UCHAR;
+	else if constexpr (std::is_same_v<T, unsigned short>) return VAR_TAG_USHORT;
+	else if constexpr (std::is_same_v<T, unsigned int>) return VAR_TAG_UINT;
+	else if constexpr (std::is_same_v<T, unsigned long>) return VAR_TAG_ULONG;
+	else if constexpr (std::is_same_v<T, unsigned long long>) return VAR_TAG_ULONG_LONG;
+	else if constexpr (std::is_same_v<T, float>) return VAR_TAG_FLOAT;
+	else if constexpr (std::is_same_v<T, double>) return VAR_TAG_DOUBLE;
+	else if constexpr (std::is_same_v<T, std::string>) return VAR_TAG_STRING;
+	else return VAR_TAG_NONE;
+}
+
+
+inline bool isIntegerTag(unsigned char tag)
+	/// Returns true if the tag denotes an integer type other than bool.
+{
+	return tag >= VAR_TAG_SCHAR && tag <= VAR_TAG_ULONG_LONG;
+}
+
+
+template <typename T>
+constexpr bool hasVarConvert()
+	/// Returns true if VarHolder has a virtual convert()
+	/// overload for values of type T.
+{
+	return std::is_same_v<T, Int8> || std::is_same_v<T, Int16> ||
+		std::is_same_v<T, Int32> || std::is_same_v<T, Int64> ||
+		std::is_same_v<T, UInt8> || std::is_same_v<T, UInt16> ||
+		std::is_same_v<T, UInt32> || std::is_same_v<T, UInt64> ||
+#ifdef POCO_INT64_IS_LONG
+		std::is_same_v<T, long long> || std::is_same_v<T, unsigned long long> ||
+#endif
+		std::is_same_v<T, bool> || std::is_same_v<T, float> ||
+		std::is_same_v<T, double> || std::is_same_v<T, char>;
+}
+
+
 } // namespace Impl
 
 
@@ -145,6 +214,16 @@ public:
 		/// instantiated in-place if it's size is smaller
 		/// than POCO_SMALL_OBJECT_SIZE.
 
+	[[nodiscard]] virtual VarHolder* moveTo(Placeholder<VarHolder>* pHolder);
+		/// Moves the held value into a new VarHolder
+		/// instantiated in the given Placeholder, leaving
+		/// this VarHolder in a valid but unspecified state.
+		///
+		/// Must not throw, as it is used by the move
+		/// constructor of Var. The default implementation
+		/// calls clone(), and should be overridden for types
+		/// whose copy constructor may throw or is expensive.
+
 	[[nodiscard]] virtual const std::type_info& type() const = 0;
 		/// Implementation must return the type information
 		/// (typeid) for the stored content.
@@ -323,6 +402,16 @@ protected:
 		return pVarHolder->assign<VarHolderImpl<T>, T>(val);
 	}
 
+	template <typename T>
+	VarHolder* moveHolder(Placeholder<VarHolder>* pVarHolder, T& val) const
+		/// Instantiates value holder wrapper, moving val into it.
+		///
+		/// Called from moveTo() member function of the implementation.
+	{
+		poco_check_ptr (pVarHolder);
+		return pVarHolder->assign<VarHolderImpl<T>, T>(std::move(val));
+	}
+
 	template <typename F, typename T>
 	static void convertToSmaller(const F& from, T& to)
 		/// Converts signed integral or floating-point values from larger to smaller type.
@@ -817,6 +906,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(T&& val): _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -1114,6 +1207,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const T& value() const
 	{
 		return _val;
@@ -2980,6 +3078,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(std::string&& val) : _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -3129,6 +3231,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const std:: string& value() const
 	{
 		return _val;
@@ -3175,6 +3282,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(Poco::UTF16String&& val) : _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -3322,6 +3433,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const Poco::UTF16String& value() const
 	{
 		return _val;
@@ -3944,6 +4060,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(std::vector<T>&& val): _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -3965,6 +4085,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const std::vector<T>& value() const
 	{
 		return _val;
@@ -4007,6 +4132,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(std::list<T>&& val): _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -4028,6 +4157,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const std::list<T>& value() const
 	{
 		return _val;
@@ -4080,6 +4214,10 @@ public:
 	{
 	}
 
+	VarHolderImpl(std::deque<T>&& val): _val(std::move(val))
+	{
+	}
+
 	~VarHolderImpl() override = default;
 
 	VarHolderImpl() = delete;
@@ -4101,6 +4239,11 @@ public:
 		return cloneHolder(pVarHolder, _val);
 	}
 
+	VarHolder* moveTo(Placeholder<VarHolder>* pVarHolder) override
+	{
+		return moveHolder(pVarHolder, _val);
+	}
+
 	const std::deque<T>& value() const
 	{
 		return _val;
@@ -23,6 +23,11 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Timespan.h"
 #include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Thread.h"
+#include <memory>
+#include <string>
+#include <vector>
 
 
 namespace Poco {
@@ -32,6 +37,7 @@ class LogFile;
 class RotateStrategy;
 class ArchiveStrategy;
 class PurgeStrategy;
+class Timer;
 
 
 class Foundation_API FileChannel: public Channel
@@ -154,6 +160,39 @@ class Foundation_API FileChannel: public Channel
 	///   * true:  Every essages is immediately flushed to the log file (default).
 	///   * false: Messages are not immediately flushed to the log file.
 	///
+	/// The bufferSize property enables write combining. Messages are
+	/// collected in a buffer of the given size (in bytes, at least 4096),
+	/// and the buffer is written to the log file with a single write
+	/// when it is full, or when it holds messages older than the
+	/// flush interval. A value of 0 (default) disables write combining.
+	/// Write combining has no effect if the flush property is true.
+	///
+	/// The flushInterval property specifies, in milliseconds, how long
+	/// messages may stay in the buffer (default 1000). The interval is
+	/// checked whenever a message is logged. If the backgroundFlush
+	/// property is true, a background thread additionally flushes the
+	/// buffer periodically, so that messages reach the log file even
+	/// if no further messages are logged.
+	///
+	/// The sync property specifies when the log file's data is forced
+	/// to the disk (using fdatasync() where available):
+	///
+	///   * none:      The data is left to the operating system (default).
+	///   * periodic:  The data is synced every flush interval.
+	///   * <n>:       The data is synced after every <n> messages.
+	///
+	/// The sync property is independent of the flush property; if both
+	/// are set, every message is flushed and, in addition, synced as
+	/// specified.
+	///
+	/// The asyncRotation property specifies whether log file rotation,
+	/// including archiving, compression and purging, is performed by
+	/// a background thread. Messages logged while the log file is rotated
+	/// are kept in memory and written to the new log file afterwards.
+	/// If more than 8192 messages are pending, further messages wait
+	/// for the rotation to complete.
+	/// Valid values are "true" and "false" (default).
+	///
 	/// The rotateOnOpen property specifies whether an existing log file should be
 	/// rotated (and archived) when the channel is opened. Valid values are:
 	///
@@ -205,6 +244,16 @@ public:
 		///                   for details.
 		///   * rotateOnOpen: Specifies whether an existing log file should be
 		///                   rotated and archived when the channel is opened.
+		///   * bufferSize:   The size of the write combining buffer.
+		///                   See the FileChannel class for details.
+		///   * flushInterval: The maximum time messages stay in the
+		///                   write combining buffer, in milliseconds.
+		///   * backgroundFlush: Enables a background thread that flushes
+		///                   the write combining buffer periodically.
+		///   * sync:         Specifies when data is forced to the disk.
+		///                   See the FileChannel class for details.
+		///   * asyncRotation: Specifies whether log files are rotated
+		///                   by a background thread.
 
 	std::string getProperty(const std::string& name) const override;
 		/// Returns the value of the property with the given name.
@@ -241,6 +290,11 @@ public:
 	static const std::string PROP_PURGECOUNT;
 	static const std::string PROP_FLUSH;
 	static const std::string PROP_ROTATEONOPEN;
+	static const std::string PROP_BUFFERSIZE;
+	static const std::string PROP_FLUSHINTERVAL;
+	static const std::string PROP_BACKGROUNDFLUSH;
+	static const std::string PROP_SYNC;
+	static const std::string PROP_ASYNCROTATION;
 
 protected:
 	~FileChannel() override;
@@ -252,10 +306,23 @@ protected:
 	void setPurgeCount(const std::string& count);
 	void setFlush(const std::string& flush);
 	void setRotateOnOpen(const std::string& rotateOnOpen);
+	void setBufferSize(const std::string& bufferSize);
+	void setFlushInterval(const std::string& flushInterval);
+	void setSync(const std::string& sync);
 	void purge();
 
 private:
+	void configureFile(LogFile* pFile);
+	void writeFile(const std::string& text);
+	void flushFile();
+	void rotate();
+	void rotateImpl(LogFile* pFile);
+	void waitForRotation();
+	void onFlushTimer(Timer&);
+
 	bool setNoPurge(const std::string& value);
+	static constexpr std::size_t MAX_PENDING_MESSAGES = 8192;
+
 	int extractDigit(const std::string& value, std::string::const_iterator* nextToDigit = nullptr) const;
 	Timespan::TimeDiff extractFactor(const std::string& value, std::string::const_iterator start) const;
 
@@ -276,6 +343,22 @@ private:
 	ArchiveStrategy* _pArchiveStrategy;
 	PurgeStrategy*   _pPurgeStrategy;
 	FastMutex        _mutex;
+
+	std::size_t      _bufferSize;
+	Timespan         _flushInterval;
+	bool             _backgroundFlush;
+	std::string      _sync;
+	bool             _periodicSync;
+	int              _syncMessages;
+	int              _unsyncedMessages;
+	Timestamp        _lastFlush;
+	std::unique_ptr<Timer> _pFlushTimer;
+
+	bool             _asyncRotation;
+	bool             _rotating;
+	std::vector<std::string> _pendingMessages;
+	Thread           _rotationThread;
+	Condition        _rotationComplete;
 };
 
 
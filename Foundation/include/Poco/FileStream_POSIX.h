@@ -64,6 +64,11 @@ public:
 	void flushToDisk();
 		/// Forces buffered data to be written to the disk
 
+	void flushDataToDisk();
+		/// Forces buffered data to be written to the disk, without
+		/// necessarily updating file metadata not needed to read
+		/// the data (fdatasync() where available).
+
 	NativeHandle nativeHandle() const;
 		/// Returns native file descriptor handle
 	
@@ -62,6 +62,10 @@ public:
 	void flushToDisk();
 		/// Forces buffered data to be written to the disk
 
+	void flushDataToDisk();
+		/// Forces buffered data to be written to the disk.
+		/// Same as flushToDisk() on Windows.
+
 	NativeHandle nativeHandle() const;
 		/// Returns native file descriptor handle
 
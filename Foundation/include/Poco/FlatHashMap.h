@@ -0,0 +1,155 @@
+//
+// FlatHashMap.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashMap
+//
+// Definition of the FlatHashMap class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashMap_INCLUDED
+#define Foundation_FlatHashMap_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/FlatHashTable.h"
+#include "Poco/Exception.h"
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace Poco {
+
+
+template <class Key, class Mapped>
+struct FlatHashMapKeyOf
+	/// This class template is used internally by FlatHashMap.
+{
+	const Key& operator () (const std::pair<const Key, Mapped>& value) const
+	{
+		return value.first;
+	}
+};
+
+
+template <class Key, class Mapped, class HashFunc = FlatHash<Key>, class KeyEqual = std::equal_to<>>
+class FlatHashMap: public FlatHashTable<std::pair<const Key, Mapped>, Key, FlatHashMapKeyOf<Key, Mapped>, HashFunc, KeyEqual>
+	/// This class implements a map using an open addressing
+	/// FlatHashTable.
+	///
+	/// A FlatHashMap can be used just like a std::unordered_map, but
+	/// lookups are considerably faster, especially for keys not in the
+	/// map, and the elements are stored without per-element allocations.
+	/// Unlike with std::unordered_map, references to elements are
+	/// invalidated when the map grows.
+	///
+	/// With the default hash function and key comparison, std::string
+	/// keys can be looked up with a std::string_view or a C string.
+{
+public:
+	using Base = FlatHashTable<std::pair<const Key, Mapped>, Key, FlatHashMapKeyOf<Key, Mapped>, HashFunc, KeyEqual>;
+	using MappedType = Mapped;
+	using mapped_type = Mapped;
+	using PairType = std::pair<Key, Mapped>;
+	using Iterator = typename Base::Iterator;
+	using ConstIterator = typename Base::ConstIterator;
+
+	FlatHashMap() = default;
+
+	explicit FlatHashMap(std::size_t initialReserve, const HashFunc& hash = HashFunc(), const KeyEqual& equal = KeyEqual()):
+		/// Creates the FlatHashMap with room for initialReserve entries.
+		Base(initialReserve, hash, equal)
+	{
+	}
+
+	FlatHashMap(std::initializer_list<typename Base::ValueType> values):
+		Base(values.size())
+	{
+		Base::insert(values.begin(), values.end());
+	}
+
+	template <class InputIt>
+	FlatHashMap(InputIt first, InputIt last)
+	{
+		Base::insert(first, last);
+	}
+
+	using Base::insert;
+
+	template <class P, typename = typename std::enable_if<std::is_constructible<typename Base::ValueType, P&&>::value>::type>
+	std::pair<Iterator, bool> insert(P&& value)
+		/// Inserts a value constructed from the given one, e.g.
+		/// a PairType, unless an element with the key already exists.
+	{
+		return Base::emplace(std::forward<P>(value));
+	}
+
+	template <class... Args>
+	std::pair<Iterator, bool> try_emplace(const Key& key, Args&&... args)
+		/// Inserts a value constructed from args with the given key,
+		/// unless an element with the key already exists, in which
+		/// case args are not used.
+	{
+		return Base::emplacePiecewise(key, std::forward<Args>(args)...);
+	}
+
+	template <class... Args>
+	std::pair<Iterator, bool> try_emplace(Key&& key, Args&&... args)
+	{
+		return Base::emplacePiecewise(std::move(key), std::forward<Args>(args)...);
+	}
+
+	template <class M>
+	std::pair<Iterator, bool> insert_or_assign(const Key& key, M&& value)
+		/// Inserts the value with the given key, or assigns it
+		/// to the existing element with the key.
+	{
+		std::pair<Iterator, bool> res = Base::emplacePiecewise(key, std::forward<M>(value));
+		if (!res.second) res.first->second = std::forward<M>(value);
+		return res;
+	}
+
+	Mapped& operator [] (const Key& key)
+	{
+		return Base::emplacePiecewise(key).first->second;
+	}
+
+	Mapped& operator [] (Key&& key)
+	{
+		return Base::emplacePiecewise(std::move(key)).first->second;
+	}
+
+	template <class K>
+	Mapped& at(const K& key)
+		/// Returns a reference to the value of the element with
+		/// the given key. Throws a NotFoundException if there
+		/// is no such element.
+	{
+		Iterator it = Base::find(key);
+		if (it == Base::end()) throw NotFoundException();
+		return it->second;
+	}
+
+	template <class K>
+	const Mapped& at(const K& key) const
+	{
+		ConstIterator it = Base::find(key);
+		if (it == Base::end()) throw NotFoundException();
+		return it->second;
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashMap_INCLUDED
@@ -0,0 +1,76 @@
+//
+// FlatHashSet.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashSet
+//
+// Definition of the FlatHashSet class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashSet_INCLUDED
+#define Foundation_FlatHashSet_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/FlatHashTable.h"
+#include <initializer_list>
+
+
+namespace Poco {
+
+
+template <class Value>
+struct FlatHashSetKeyOf
+	/// This class template is used internally by FlatHashSet.
+{
+	const Value& operator () (const Value& value) const
+	{
+		return value;
+	}
+};
+
+
+template <class Value, class HashFunc = FlatHash<Value>, class KeyEqual = std::equal_to<>>
+class FlatHashSet: public FlatHashTable<Value, Value, FlatHashSetKeyOf<Value>, HashFunc, KeyEqual>
+	/// This class implements a set using an open addressing
+	/// FlatHashTable.
+	///
+	/// A FlatHashSet can be used just like a std::unordered_set.
+	/// See FlatHashMap for the differences.
+{
+public:
+	using Base = FlatHashTable<Value, Value, FlatHashSetKeyOf<Value>, HashFunc, KeyEqual>;
+
+	FlatHashSet() = default;
+
+	explicit FlatHashSet(std::size_t initialReserve, const HashFunc& hash = HashFunc(), const KeyEqual& equal = KeyEqual()):
+		/// Creates the FlatHashSet with room for initialReserve entries.
+		Base(initialReserve, hash, equal)
+	{
+	}
+
+	FlatHashSet(std::initializer_list<Value> values):
+		Base(values.size())
+	{
+		Base::insert(values.begin(), values.end());
+	}
+
+	template <class InputIt>
+	FlatHashSet(InputIt first, InputIt last)
+	{
+		Base::insert(first, last);
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashSet_INCLUDED
@@ -0,0 +1,1071 @@
+//
+// FlatHashTable.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashTable
+//
+// Definition of the FlatHashTable class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashTable_INCLUDED
+#define Foundation_FlatHashTable_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Hash.h"
+#include "Poco/HashStatistic.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_FLATHASH_SSE2 1
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_FLATHASH_NEON 1
+	#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+namespace Poco {
+
+
+template <class T, class Enable = void>
+struct FlatHash
+	/// The default hash function for FlatHashMap and FlatHashSet.
+	///
+	/// The open addressing scheme of FlatHashTable uses the low-order
+	/// bits of the hash value to select the probe position, and seven
+	/// other bits as a fingerprint of the key, so all bits of the hash
+	/// value must be well distributed. Therefore, the result of std::hash,
+	/// which is the identity function for integers on common platforms,
+	/// is passed through hashMix().
+{
+	std::size_t operator () (const T& value) const
+	{
+		return static_cast<std::size_t>(hashMix(static_cast<UInt64>(std::hash<T>()(value))));
+	}
+};
+
+
+template <class T>
+struct FlatHash<T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type>
+	/// FlatHash for integers and enumerations.
+{
+	std::size_t operator () (T value) const
+	{
+		return static_cast<std::size_t>(hashMix(static_cast<UInt64>(value)));
+	}
+};
+
+
+template <class T>
+struct FlatHash<T*>
+	/// FlatHash for pointers.
+{
+	std::size_t operator () (const T* value) const
+	{
+		return static_cast<std::size_t>(hashMix(static_cast<UInt64>(reinterpret_cast<std::uintptr_t>(value))));
+	}
+};
+
+
+struct FlatStringHash
+	/// A transparent hash function for strings, using hashBytes().
+	///
+	/// Enables lookups in containers with std::string keys
+	/// with a std::string_view or C string, without first
+	/// constructing a std::string.
+{
+	using is_transparent = void;
+
+	std::size_t operator () (std::string_view value) const
+	{
+		return static_cast<std::size_t>(hashBytes(value.data(), value.size()));
+	}
+};
+
+
+template <>
+struct FlatHash<std::string>: public FlatStringHash
+{
+};
+
+
+template <>
+struct FlatHash<std::string_view>: public FlatStringHash
+{
+};
+
+
+namespace Impl {
+
+
+enum FlatCtrl: Int8
+{
+	FLAT_CTRL_EMPTY   = -128,
+	FLAT_CTRL_DELETED = -2
+		/// Control bytes of empty and deleted slots. Full slots
+		/// store the seven fingerprint bits of the hash value.
+};
+
+
+inline int flatTrailingZeros(UInt64 value)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return static_cast<int>(index);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, static_cast<unsigned long>(value))) return static_cast<int>(index);
+	_BitScanForward(&index, static_cast<unsigned long>(value >> 32));
+	return static_cast<int>(index) + 32;
+#else
+	return __builtin_ctzll(value);
+#endif
+}
+
+
+inline int flatLeadingZeros(UInt64 value)
+{
+#if defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return 63 - static_cast<int>(index);
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32))) return 31 - static_cast<int>(index);
+	_BitScanReverse(&index, static_cast<unsigned long>(value));
+	return 63 - static_cast<int>(index);
+#else
+	return __builtin_clzll(value);
+#endif
+}
+
+
+template <int Shift, int Bits>
+class FlatBitMask
+	/// A set of slot positions within a group, one bit
+	/// (or one bit out of 1 << Shift bits) per slot.
+{
+public:
+	explicit FlatBitMask(UInt64 mask):
+		_mask(mask)
+	{
+	}
+
+	explicit operator bool () const
+	{
+		return _mask != 0;
+	}
+
+	int lowest() const
+		/// Returns the lowest slot position in the set,
+		/// which must not be empty.
+	{
+		return flatTrailingZeros(_mask) >> Shift;
+	}
+
+	int leadingZeros() const
+		/// Returns the number of positions above the highest
+		/// position in the set, which must not be empty.
+	{
+		return (flatLeadingZeros(_mask) - (64 - Bits)) >> Shift;
+	}
+
+	void clearLowest()
+	{
+		_mask &= _mask - 1;
+	}
+
+private:
+	UInt64 _mask;
+};
+
+
+#if defined(POCO_FLATHASH_SSE2)
+
+
+class FlatGroup
+	/// A group of control bytes, probed in parallel with SSE2.
+{
+public:
+	static const int WIDTH = 16;
+	using Mask = FlatBitMask<0, 16>;
+
+	explicit FlatGroup(const Int8* pCtrl):
+		_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl)))
+	{
+	}
+
+	Mask match(Int8 h2) const
+		/// Returns the positions of slots with the given fingerprint.
+	{
+		return Mask(static_cast<UInt16>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl))));
+	}
+
+	Mask matchEmpty() const
+	{
+		return match(FLAT_CTRL_EMPTY);
+	}
+
+	Mask matchEmptyOrDeleted() const
+	{
+		// empty and deleted are the only negative control bytes
+		return Mask(static_cast<UInt16>(_mm_movemask_epi8(_ctrl)));
+	}
+
+private:
+	__m128i _ctrl;
+};
+
+
+#elif defined(POCO_FLATHASH_NEON)
+
+
+class FlatGroup
+	/// A group of control bytes, probed in parallel with NEON.
+	///
+	/// NEON has no movemask instruction; comparison results are narrowed
+	/// to four bits per slot instead, of which the top bit is kept.
+{
+public:
+	static const int WIDTH = 16;
+	using Mask = FlatBitMask<2, 64>;
+
+	explicit FlatGroup(const Int8* pCtrl):
+		_ctrl(vld1q_s8(pCtrl))
+	{
+	}
+
+	Mask match(Int8 h2) const
+	{
+		return toMask(vceqq_s8(vdupq_n_s8(h2), _ctrl));
+	}
+
+	Mask matchEmpty() const
+	{
+		return match(FLAT_CTRL_EMPTY);
+	}
+
+	Mask matchEmptyOrDeleted() const
+	{
+		return toMask(vcltzq_s8(_ctrl));
+	}
+
+private:
+	static Mask toMask(uint8x16_t cmp)
+	{
+		uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+		return Mask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & UINT64_C(0x8888888888888888));
+	}
+
+	int8x16_t _ctrl;
+};
+
+
+#else
+
+
+class FlatGroup
+	/// A group of control bytes, probed sequentially.
+{
+public:
+	static const int WIDTH = 16;
+	using Mask = FlatBitMask<0, 16>;
+
+	explicit FlatGroup(const Int8* pCtrl)
+	{
+		std::memcpy(_ctrl, pCtrl, WIDTH);
+	}
+
+	Mask match(Int8 h2) const
+	{
+		UInt64 mask = 0;
+		for (int i = 0; i < WIDTH; ++i)
+		{
+			if (_ctrl[i] == h2) mask |= UInt64(1) << i;
+		}
+		return Mask(mask);
+	}
+
+	Mask matchEmpty() const
+	{
+		return match(FLAT_CTRL_EMPTY);
+	}
+
+	Mask matchEmptyOrDeleted() const
+	{
+		UInt64 mask = 0;
+		for (int i = 0; i < WIDTH; ++i)
+		{
+			if (_ctrl[i] < 0) mask |= UInt64(1) << i;
+		}
+		return Mask(mask);
+	}
+
+private:
+	Int8 _ctrl[WIDTH];
+};
+
+
+#endif
+
+
+template <class Hash, class KeyEqual, class = void>
+struct FlatIsTransparent: std::false_type
+{
+};
+
+
+template <class Hash, class KeyEqual>
+struct FlatIsTransparent<Hash, KeyEqual, std::void_t<typename Hash::is_transparent, typename KeyEqual::is_transparent>>: std::true_type
+{
+};
+
+
+} // namespace Impl
+
+
+template <class Value, class Key, class KeyOf, class HashFunc, class KeyEqual>
+class FlatHashTable
+	/// This class implements an open addressing hash table in the style
+	/// of the "Swiss table" design. It is the implementation of
+	/// FlatHashMap and FlatHashSet, which should be used instead.
+	///
+	/// Elements are stored directly in a single array of slots. For every
+	/// slot, a separate array holds a control byte, which is either empty,
+	/// deleted, or contains seven bits of the hash value of the element
+	/// in the slot. A lookup compares the control bytes of a group of 16
+	/// slots at once (with SSE2 or NEON, if available) and only compares
+	/// keys of slots whose control byte matches, so that on average far
+	/// less than one key comparison is needed for a failed lookup.
+	/// Groups are probed quadratically.
+	///
+	/// The capacity is always a power of two, and the table is grown
+	/// when it is 7/8 full. Erased elements leave a tombstone, unless
+	/// no probe sequence can pass through the slot; tombstones are
+	/// purged when the table is rehashed.
+	///
+	/// Iterators and references to elements are invalidated by
+	/// every insertion that rehashes the table.
+	///
+	/// The FlatHashTable is not thread safe.
+{
+public:
+	using KeyType = Key;
+	using ValueType = Value;
+	using Reference = Value&;
+	using ConstReference = const Value&;
+	using Pointer = Value*;
+	using ConstPointer = const Value*;
+	using Hash = HashFunc;
+	using SizeType = std::size_t;
+
+	using key_type = Key;
+	using value_type = Value;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using hasher = HashFunc;
+	using key_equal = KeyEqual;
+	using reference = Value&;
+	using const_reference = const Value&;
+	using pointer = Value*;
+	using const_pointer = const Value*;
+
+	template <bool IsConst>
+	class IteratorImpl
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Value;
+		using difference_type = std::ptrdiff_t;
+		using pointer = typename std::conditional<IsConst, const Value*, Value*>::type;
+		using reference = typename std::conditional<IsConst, const Value&, Value&>::type;
+
+		IteratorImpl() = default;
+
+		template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+		IteratorImpl(const IteratorImpl<false>& it):
+			_pCtrl(it._pCtrl),
+			_pCtrlEnd(it._pCtrlEnd),
+			_pSlot(it._pSlot)
+		{
+		}
+
+		reference operator * () const
+		{
+			return *_pSlot;
+		}
+
+		pointer operator -> () const
+		{
+			return _pSlot;
+		}
+
+		IteratorImpl& operator ++ ()
+		{
+			++_pCtrl;
+			++_pSlot;
+			skipFree();
+			return *this;
+		}
+
+		IteratorImpl operator ++ (int)
+		{
+			IteratorImpl tmp(*this);
+			++*this;
+			return tmp;
+		}
+
+		bool operator == (const IteratorImpl& it) const
+		{
+			return _pSlot == it._pSlot;
+		}
+
+		bool operator != (const IteratorImpl& it) const
+		{
+			return _pSlot != it._pSlot;
+		}
+
+	private:
+		IteratorImpl(const Int8* pCtrl, const Int8* pCtrlEnd, Value* pSlot):
+			_pCtrl(pCtrl),
+			_pCtrlEnd(pCtrlEnd),
+			_pSlot(pSlot)
+		{
+		}
+
+		void skipFree()
+		{
+			while (_pCtrl != _pCtrlEnd && *_pCtrl < 0)
+			{
+				++_pCtrl;
+				++_pSlot;
+			}
+		}
+
+		const Int8* _pCtrl = nullptr;
+		const Int8* _pCtrlEnd = nullptr;
+		Value* _pSlot = nullptr;
+
+		friend class FlatHashTable;
+		friend class IteratorImpl<!IsConst>;
+	};
+
+	static const bool IS_SET = std::is_same<Value, Key>::value;
+		/// Elements of a set must not be modified through iterators.
+
+	using Iterator = IteratorImpl<IS_SET>;
+	using ConstIterator = IteratorImpl<true>;
+	using iterator = Iterator;
+	using const_iterator = ConstIterator;
+
+	FlatHashTable() = default;
+
+	explicit FlatHashTable(std::size_t initialReserve, const HashFunc& hash = HashFunc(), const KeyEqual& equal = KeyEqual()):
+		/// Creates the FlatHashTable with room for initialReserve elements.
+		_hash(hash),
+		_equal(equal)
+	{
+		reserve(initialReserve);
+	}
+
+	FlatHashTable(const FlatHashTable& table):
+		_hash(table._hash),
+		_equal(table._equal)
+	{
+		reserve(table._size);
+		for (const auto& value: table) insertUnique(value);
+	}
+
+	FlatHashTable(FlatHashTable&& table) noexcept:
+		_pCtrl(table._pCtrl),
+		_pSlots(table._pSlots),
+		_capacity(table._capacity),
+		_size(table._size),
+		_growthLeft(table._growthLeft),
+		_hash(std::move(table._hash)),
+		_equal(std::move(table._equal))
+	{
+		table.reset();
+	}
+
+	~FlatHashTable()
+	{
+		destroyAll();
+		deallocate();
+	}
+
+	FlatHashTable& operator = (const FlatHashTable& table)
+	{
+		if (&table != this)
+		{
+			FlatHashTable tmp(table);
+			swap(tmp);
+		}
+		return *this;
+	}
+
+	FlatHashTable& operator = (FlatHashTable&& table) noexcept
+	{
+		if (&table != this)
+		{
+			destroyAll();
+			deallocate();
+			_pCtrl = table._pCtrl;
+			_pSlots = table._pSlots;
+			_capacity = table._capacity;
+			_size = table._size;
+			_growthLeft = table._growthLeft;
+			_hash = std::move(table._hash);
+			_equal = std::move(table._equal);
+			table.reset();
+		}
+		return *this;
+	}
+
+	void swap(FlatHashTable& table) noexcept
+		/// Swaps the FlatHashTable with another one.
+	{
+		using std::swap;
+		swap(_pCtrl, table._pCtrl);
+		swap(_pSlots, table._pSlots);
+		swap(_capacity, table._capacity);
+		swap(_size, table._size);
+		swap(_growthLeft, table._growthLeft);
+		swap(_hash, table._hash);
+		swap(_equal, table._equal);
+	}
+
+	Iterator begin()
+	{
+		Iterator it(_pCtrl, _pCtrl + _capacity, _pSlots);
+		it.skipFree();
+		return it;
+	}
+
+	Iterator end()
+	{
+		return Iterator(_pCtrl + _capacity, _pCtrl + _capacity, _pSlots + _capacity);
+	}
+
+	ConstIterator begin() const
+	{
+		return const_cast<FlatHashTable*>(this)->begin();
+	}
+
+	ConstIterator end() const
+	{
+		return const_cast<FlatHashTable*>(this)->end();
+	}
+
+	ConstIterator cbegin() const
+	{
+		return begin();
+	}
+
+	ConstIterator cend() const
+	{
+		return end();
+	}
+
+	template <class K>
+	Iterator find(const K& key)
+		/// Returns an iterator pointing to the element with the given key,
+		/// or end() if there is no such element.
+		///
+		/// If both the hash function and the key comparison are transparent
+		/// (like the defaults for std::string keys), the key can be of any
+		/// type they accept, e.g. a std::string_view. Otherwise, it is
+		/// converted to KeyType first.
+	{
+		if constexpr (std::is_same<K, Key>::value || Impl::FlatIsTransparent<HashFunc, KeyEqual>::value)
+		{
+			std::size_t index = findIndex(key, hashOf(key));
+			return index == NOT_FOUND ? end() : iteratorAt(index);
+		}
+		else return find(static_cast<const Key&>(Key(key)));
+	}
+
+	template <class K>
+	ConstIterator find(const K& key) const
+	{
+		return const_cast<FlatHashTable*>(this)->find(key);
+	}
+
+	template <class K>
+	std::size_t count(const K& key) const
+	{
+		return find(key) != end() ? 1 : 0;
+	}
+
+	template <class K>
+	bool contains(const K& key) const
+	{
+		return find(key) != end();
+	}
+
+	std::pair<Iterator, bool> insert(const Value& value)
+		/// Inserts the value, unless an element with
+		/// the same key already exists.
+	{
+		return emplaceKey(KeyOf()(value), value);
+	}
+
+	std::pair<Iterator, bool> insert(Value&& value)
+	{
+		return emplaceKey(KeyOf()(value), std::move(value));
+	}
+
+	template <class InputIt>
+	void insert(InputIt first, InputIt last)
+	{
+		for (; first != last; ++first) insert(*first);
+	}
+
+	template <class... Args>
+	std::pair<Iterator, bool> emplace(Args&&... args)
+		/// Constructs a value from the given arguments and inserts it,
+		/// unless an element with the same key already exists.
+	{
+		Value value(std::forward<Args>(args)...);
+		return emplaceKey(KeyOf()(value), std::move(value));
+	}
+
+	Iterator erase(ConstIterator it)
+		/// Erases the element the given iterator points to, and
+		/// returns an iterator pointing to the next element.
+	{
+		std::size_t index = static_cast<std::size_t>(it._pSlot - _pSlots);
+		eraseAt(index);
+		Iterator next = iteratorAt(index);
+		next.skipFree();
+		return next;
+	}
+
+	template <bool S = IS_SET, typename = typename std::enable_if<!S>::type>
+	Iterator erase(IteratorImpl<false> it)
+	{
+		return erase(ConstIterator(it));
+	}
+
+	template <class K, typename = typename std::enable_if<!std::is_convertible<const K&, ConstIterator>::value>::type>
+	std::size_t erase(const K& key)
+		/// Erases the element with the given key, if it exists.
+		/// Returns the number of erased elements.
+	{
+		Iterator it = find(key);
+		if (it == end()) return 0;
+		eraseAt(static_cast<std::size_t>(it._pSlot - _pSlots));
+		return 1;
+	}
+
+	void clear()
+		/// Erases all elements, but keeps the allocated memory.
+	{
+		destroyAll();
+		if (_capacity > 0)
+		{
+			std::memset(_pCtrl, Impl::FLAT_CTRL_EMPTY, _capacity + Impl::FlatGroup::WIDTH);
+			_growthLeft = capacityToGrowth(_capacity);
+		}
+		_size = 0;
+	}
+
+	void reserve(std::size_t count)
+		/// Makes room for at least count elements,
+		/// without further rehashing.
+	{
+		if (count > _size + _growthLeft)
+		{
+			rehash(normalizeCapacity(count));
+		}
+	}
+
+	void rehash(std::size_t count)
+		/// Rehashes the table to at least count slots, removing all
+		/// tombstones. The capacity will not be reduced below what
+		/// is required for the current number of elements.
+	{
+		std::size_t capacity = normalizeCapacity(_size);
+		while (capacity < count) capacity = capacity > 0 ? capacity*2 : Impl::FlatGroup::WIDTH;
+		if (capacity > 0)
+		{
+			resize(capacity);
+		}
+		else if (_capacity > 0)
+		{
+			deallocate();
+			reset();
+		}
+	}
+
+	std::size_t size() const
+	{
+		return _size;
+	}
+
+	bool empty() const
+	{
+		return _size == 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the number of slots.
+	{
+		return _capacity;
+	}
+
+	std::size_t bucket_count() const
+	{
+		return _capacity;
+	}
+
+	float load_factor() const
+	{
+		return _capacity > 0 ? static_cast<float>(_size)/static_cast<float>(_capacity) : 0.0f;
+	}
+
+	float max_load_factor() const
+		/// Returns the maximum load factor, which is fixed at 7/8.
+	{
+		return 0.875f;
+	}
+
+	std::size_t max_size() const
+	{
+		return std::numeric_limits<std::ptrdiff_t>::max()/sizeof(Value);
+	}
+
+	HashFunc hash_function() const
+	{
+		return _hash;
+	}
+
+	KeyEqual key_eq() const
+	{
+		return _equal;
+	}
+
+#ifdef POCO_COMPILER_MSVC
+#pragma warning(push)
+#pragma warning(disable: 4996)
+#else
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+	HashStatistic currentState(bool details = false) const
+		/// Returns the current internal state.
+		///
+		/// As a FlatHashTable has no buckets, each group of 16 slots
+		/// is treated as a hash position, and an element counts for
+		/// the group its probe sequence starts in. A high maximum
+		/// indicates clustering caused by a poor hash function.
+	{
+		std::size_t groups = _capacity/Impl::FlatGroup::WIDTH;
+		std::vector<UInt32> entries(groups, 0);
+		for (std::size_t i = 0; i < _capacity; ++i)
+		{
+			if (_pCtrl[i] >= 0)
+			{
+				std::size_t position = (h1(hashOf(KeyOf()(_pSlots[i]))) & (_capacity - 1))/Impl::FlatGroup::WIDTH;
+				++entries[position];
+			}
+		}
+		UInt32 zeroEntries = static_cast<UInt32>(std::count(entries.begin(), entries.end(), 0U));
+		UInt32 maxEntry = entries.empty() ? 0 : *std::max_element(entries.begin(), entries.end());
+		if (!details) entries.clear();
+		return HashStatistic(static_cast<UInt32>(groups), static_cast<UInt32>(_size), zeroEntries, maxEntry, entries);
+	}
+#ifdef POCO_COMPILER_MSVC
+#pragma warning(pop)
+#else
+#pragma GCC diagnostic pop
+#endif
+
+protected:
+	template <class K, class... Args>
+	std::pair<Iterator, bool> emplaceKey(const K& key, Args&&... args)
+		/// Inserts a value constructed from args, unless an
+		/// element with the given key already exists.
+	{
+		std::size_t hash = hashOf(key);
+		std::size_t index = findIndex(key, hash);
+		if (index != NOT_FOUND) return std::make_pair(iteratorAt(index), false);
+
+		index = prepareInsert(hash);
+		constructAt(index, std::forward<Args>(args)...);
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+	template <class K, class... Args>
+	std::pair<Iterator, bool> emplacePiecewise(K&& key, Args&&... args)
+		/// Inserts a value constructed piecewise from the key
+		/// and args, unless an element with the key already exists.
+	{
+		std::size_t hash = hashOf(key);
+		std::size_t index = findIndex(key, hash);
+		if (index != NOT_FOUND) return std::make_pair(iteratorAt(index), false);
+
+		index = prepareInsert(hash);
+		constructAt(index, std::piecewise_construct,
+			std::forward_as_tuple(std::forward<K>(key)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+private:
+	static const std::size_t NOT_FOUND = ~std::size_t(0);
+
+	template <class K>
+	std::size_t hashOf(const K& key) const
+	{
+		return _hash(key);
+	}
+
+	static std::size_t h1(std::size_t hash)
+	{
+		return hash >> 7;
+	}
+
+	static Int8 h2(std::size_t hash)
+	{
+		return static_cast<Int8>(hash & 0x7F);
+	}
+
+	template <class K>
+	std::size_t findIndex(const K& key, std::size_t hash) const
+	{
+		if (_capacity == 0) return NOT_FOUND;
+
+		const std::size_t mask = _capacity - 1;
+		std::size_t pos = h1(hash) & mask;
+		std::size_t step = 0;
+		for (;;)
+		{
+			Impl::FlatGroup group(_pCtrl + pos);
+			for (auto match = group.match(h2(hash)); match; match.clearLowest())
+			{
+				std::size_t index = (pos + match.lowest()) & mask;
+				if (_equal(KeyOf()(_pSlots[index]), key)) return index;
+			}
+			if (group.matchEmpty()) return NOT_FOUND;
+			step += Impl::FlatGroup::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	std::size_t findFirstNonFull(std::size_t hash) const
+	{
+		const std::size_t mask = _capacity - 1;
+		std::size_t pos = h1(hash) & mask;
+		std::size_t step = 0;
+		for (;;)
+		{
+			auto match = Impl::FlatGroup(_pCtrl + pos).matchEmptyOrDeleted();
+			if (match) return (pos + match.lowest()) & mask;
+			step += Impl::FlatGroup::WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	std::size_t prepareInsert(std::size_t hash)
+		/// Finds a slot for a new element with the given hash,
+		/// growing the table if necessary, and marks the slot full.
+	{
+		std::size_t index = _capacity > 0 ? findFirstNonFull(hash) : 0;
+		if (_capacity == 0 || (_growthLeft == 0 && _pCtrl[index] != Impl::FLAT_CTRL_DELETED))
+		{
+			grow();
+			index = findFirstNonFull(hash);
+		}
+		if (_pCtrl[index] == Impl::FLAT_CTRL_EMPTY) --_growthLeft;
+		setCtrl(index, h2(hash));
+		++_size;
+		return index;
+	}
+
+	template <class... Args>
+	void constructAt(std::size_t index, Args&&... args)
+	{
+		try
+		{
+			::new (static_cast<void*>(_pSlots + index)) Value(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			setCtrl(index, Impl::FLAT_CTRL_DELETED);
+			--_size;
+			throw;
+		}
+	}
+
+	void insertUnique(const Value& value)
+		/// Inserts a value known not to be in the table.
+	{
+		std::size_t index = prepareInsert(hashOf(KeyOf()(value)));
+		constructAt(index, value);
+	}
+
+	void eraseAt(std::size_t index)
+	{
+		_pSlots[index].~Value();
+		--_size;
+
+		// If there is no run of WIDTH non-empty slots around the slot,
+		// no probe sequence has ever passed it, so it can become empty.
+		const std::size_t mask = _capacity - 1;
+		auto emptyBefore = Impl::FlatGroup(_pCtrl + ((index - Impl::FlatGroup::WIDTH) & mask)).matchEmpty();
+		auto emptyAfter = Impl::FlatGroup(_pCtrl + index).matchEmpty();
+		if (emptyBefore && emptyAfter && emptyAfter.lowest() + emptyBefore.leadingZeros() < Impl::FlatGroup::WIDTH)
+		{
+			setCtrl(index, Impl::FLAT_CTRL_EMPTY);
+			++_growthLeft;
+		}
+		else setCtrl(index, Impl::FLAT_CTRL_DELETED);
+	}
+
+	void setCtrl(std::size_t index, Int8 ctrl)
+	{
+		_pCtrl[index] = ctrl;
+		// mirror the first group after the end, so that
+		// groups can be loaded without wrapping around
+		if (index < static_cast<std::size_t>(Impl::FlatGroup::WIDTH))
+			_pCtrl[_capacity + index] = ctrl;
+	}
+
+	Iterator iteratorAt(std::size_t index)
+	{
+		return Iterator(_pCtrl + index, _pCtrl + _capacity, _pSlots + index);
+	}
+
+	static std::size_t capacityToGrowth(std::size_t capacity)
+	{
+		return capacity - capacity/8;
+	}
+
+	static std::size_t normalizeCapacity(std::size_t count)
+		/// Returns the smallest power of two, but at least one group,
+		/// with room for count elements.
+	{
+		if (count == 0) return 0;
+		std::size_t capacity = Impl::FlatGroup::WIDTH;
+		while (capacityToGrowth(capacity) < count) capacity *= 2;
+		return capacity;
+	}
+
+	void grow()
+	{
+		if (_capacity == 0)
+			resize(Impl::FlatGroup::WIDTH);
+		else if (_size <= capacityToGrowth(_capacity)/2)
+			resize(_capacity); // many tombstones, rehash in place
+		else
+			resize(_capacity*2);
+	}
+
+	void resize(std::size_t capacity)
+	{
+		Int8* pOldCtrl = _pCtrl;
+		Value* pOldSlots = _pSlots;
+		std::size_t oldCapacity = _capacity;
+
+		_pSlots = std::allocator<Value>().allocate(capacity);
+		try
+		{
+			_pCtrl = new Int8[capacity + Impl::FlatGroup::WIDTH];
+		}
+		catch (...)
+		{
+			std::allocator<Value>().deallocate(_pSlots, capacity);
+			_pSlots = pOldSlots;
+			throw;
+		}
+		std::memset(_pCtrl, Impl::FLAT_CTRL_EMPTY, capacity + Impl::FlatGroup::WIDTH);
+		_capacity = capacity;
+		_growthLeft = capacityToGrowth(capacity) - _size;
+
+		for (std::size_t i = 0; i < oldCapacity; ++i)
+		{
+			if (pOldCtrl[i] >= 0)
+			{
+				std::size_t hash = hashOf(KeyOf()(pOldSlots[i]));
+				std::size_t index = findFirstNonFull(hash);
+				setCtrl(index, h2(hash));
+				::new (static_cast<void*>(_pSlots + index)) Value(std::move_if_noexcept(pOldSlots[i]));
+				pOldSlots[i].~Value();
+			}
+		}
+		if (oldCapacity > 0)
+		{
+			delete [] pOldCtrl;
+			std::allocator<Value>().deallocate(pOldSlots, oldCapacity);
+		}
+	}
+
+	void destroyAll()
+	{
+		if (!std::is_trivially_destructible<Value>::value)
+		{
+			for (std::size_t i = 0; i < _capacity; ++i)
+			{
+				if (_pCtrl[i] >= 0) _pSlots[i].~Value();
+			}
+		}
+	}
+
+	void deallocate()
+	{
+		if (_capacity > 0)
+		{
+			delete [] _pCtrl;
+			std::allocator<Value>().deallocate(_pSlots, _capacity);
+		}
+	}
+
+	void reset()
+	{
+		_pCtrl = nullptr;
+		_pSlots = nullptr;
+		_capacity = 0;
+		_size = 0;
+		_growthLeft = 0;
+	}
+
+	Int8* _pCtrl = nullptr;
+	Value* _pSlots = nullptr;
+	std::size_t _capacity = 0;
+	std::size_t _size = 0;
+	std::size_t _growthLeft = 0;
+	HashFunc _hash;
+	KeyEqual _equal;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashTable_INCLUDED
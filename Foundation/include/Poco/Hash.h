@@ -24,6 +24,9 @@
 #include "Poco/Foundation.h"
 #include "Poco/Types.h"
 #include <cstddef>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 
 #if defined(_MSC_VER)
@@ -47,6 +50,23 @@ std::size_t Foundation_API hash(UInt64 n);
 std::size_t Foundation_API hash(const std::string& str);
 
 
+UInt64 Foundation_API hashBytes(const void* data, std::size_t length, UInt64 seed = 0);
+	/// Returns a 64-bit hash value for the given bytes, using
+	/// the wyhash algorithm by Wang Yi.
+	///
+	/// wyhash is among the fastest hash functions for both short
+	/// and long inputs, and passes the SMHasher quality tests.
+	/// The result is the same on all platforms.
+
+
+UInt64 hashMix(UInt64 value);
+	/// Mixes the bits of the given value, so that every bit of
+	/// the result depends on every bit of the value.
+	///
+	/// Suitable for turning integers, or the result of a weak
+	/// hash function, into a hash value for open addressing.
+
+
 template <class T>
 struct Hash
 	/// A generic hash function.
@@ -113,6 +133,36 @@ inline std::size_t hash(UInt64 n)
 namespace Impl {
 
 
+inline UInt64 hashMum(UInt64 a, UInt64 b)
+	/// Multiplies a and b to a 128-bit product, and
+	/// returns the XOR of its high and low halves.
+{
+#if defined(__SIZEOF_INT128__)
+	__uint128_t r = static_cast<__uint128_t>(a)*b;
+	return static_cast<UInt64>(r) ^ static_cast<UInt64>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	UInt64 hi;
+	UInt64 lo = _umul128(a, b, &hi);
+	return lo ^ hi;
+#else
+	UInt64 ha = a >> 32;
+	UInt64 hb = b >> 32;
+	UInt64 la = static_cast<UInt32>(a);
+	UInt64 lb = static_cast<UInt32>(b);
+	UInt64 rh = ha*hb;
+	UInt64 rm0 = ha*lb;
+	UInt64 rm1 = hb*la;
+	UInt64 rl = la*lb;
+	UInt64 t = rl + (rm0 << 32);
+	UInt64 c = t < rl;
+	UInt64 lo = t + (rm1 << 32);
+	c += lo < t;
+	UInt64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+	return lo ^ hi;
+#endif
+}
+
+
 template <typename SizeT>
 inline void hashCombine(SizeT& seed, SizeT value)
 {
@@ -162,6 +212,12 @@ inline void hashCombine(Poco::UInt64& h, Poco::UInt64 k)
 } // namespace Impl
 
 
+inline UInt64 hashMix(UInt64 value)
+{
+	return Impl::hashMum(value ^ UINT64_C(0x2d358dccaa6c78a5), UINT64_C(0x8bb84b93962eacc9));
+}
+
+
 template <class T>
 inline void hashCombine(std::size_t& seed, T const& v)
 {
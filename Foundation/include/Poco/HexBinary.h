@@ -0,0 +1,85 @@
+//
+// HexBinary.h
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Definition of class HexBinary.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_HexBinary_INCLUDED
+#define Foundation_HexBinary_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <string>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API HexBinary
+	/// This class provides buffer-to-buffer hexBinary encoding
+	/// and decoding, where each octet is encoded as two
+	/// hexadecimal digits.
+	///
+	/// Blocks of input are processed with SSSE3 or NEON
+	/// instructions if the CPU supports them (see CPUFeatures).
+	/// A table-driven scalar implementation handles the remaining
+	/// input and other CPUs.
+	///
+	/// HexBinaryEncoder and HexBinaryDecoder use this class internally.
+{
+public:
+	static std::size_t encode(const void* data, std::size_t length, char* output, bool uppercase = false);
+		/// Encodes length bytes starting at data and writes
+		/// 2*length characters to output.
+		///
+		/// Returns the number of characters written.
+
+	static std::string encode(const std::string& data, bool uppercase = false);
+		/// Encodes the given data and returns the result.
+
+	static std::size_t decode(const char* data, std::size_t length, void* output);
+		/// Decodes length characters starting at data and writes the
+		/// result to output, which must have room for at least
+		/// length/2 bytes. Whitespace (space, tab, CR and LF) is
+		/// ignored; both upper and lower case digits are accepted.
+		///
+		/// Returns the number of bytes written.
+		///
+		/// Throws a DataFormatException if the input contains an
+		/// invalid character or an odd number of digits.
+
+	static std::string decode(const std::string& data);
+		/// Decodes the given data and returns the result.
+		///
+		/// Throws a DataFormatException if the input is not valid.
+
+	HexBinary() = delete;
+
+private:
+	static std::size_t decodeBlocks(const char*& it, const char* end, unsigned char* output, bool& invalid);
+		/// Decodes complete pairs of digits, starting at it.
+		///
+		/// Stops at a trailing single digit, or at the first pair
+		/// containing an invalid character, in which case invalid is
+		/// set to true. In both cases it is left pointing to the start
+		/// of that pair. Returns the number of bytes written.
+
+	friend class HexBinaryDecoderBuf;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_HexBinary_INCLUDED
@@ -19,14 +19,14 @@
 
 
 #include "Poco/Foundation.h"
-#include "Poco/UnbufferedStreamBuf.h"
+#include "Poco/BufferedStreamBuf.h"
 #include <istream>
 
 
 namespace Poco {
 
 
-class Foundation_API HexBinaryDecoderBuf: public UnbufferedStreamBuf
+class Foundation_API HexBinaryDecoderBuf: public BufferedStreamBuf
 	/// This streambuf decodes all hexBinary-encoded data read
 	/// from the istream connected to it.
 	/// In hexBinary encoding, each binary octet is encoded as a character tuple,
@@ -34,6 +34,11 @@ class Foundation_API HexBinaryDecoderBuf: public UnbufferedStreamBuf
 	/// See also: XML Schema Part 2: Datatypes (http://www.w3.org/TR/xmlschema-2/),
 	/// section 3.2.15.
 	///
+	/// Input is read and decoded in blocks (see HexBinary::decode()).
+	/// If the input contains an invalid character, the data decoded
+	/// before it is returned first, and the next read throws a
+	/// DataFormatException.
+	///
 	/// Note: For performance reasons, the characters
 	/// are read directly from the given istream's
 	/// underlying streambuf, so the state
@@ -45,10 +50,18 @@ public:
 	~HexBinaryDecoderBuf() override;
 
 private:
-	int readFromDevice() override;
-	int readOne();
+	std::streamsize readFromDevice(char* buffer, std::streamsize length) override;
+
+	enum
+	{
+		BUFFER_SIZE = 4096
+	};
 
 	std::streambuf& _buf;
+	char            _input[BUFFER_SIZE];
+	std::streamsize _pending;
+	bool            _eof;
+	bool            _error;
 };
 
 
@@ -61,8 +61,14 @@ public:
 	void setUppercase(bool flag = true);
 		/// Specify whether hex digits a-f are written in upper or lower case.
 
+protected:
+	std::streamsize xsputn(const char* s, std::streamsize n) override;
+		/// Encodes the given data in one pass (see HexBinary::encode()),
+		/// instead of byte by byte.
+
 private:
 	int writeToDevice(char c) override;
+	int writeBytes(const unsigned char* data, std::streamsize length);
 
 	int _pos;
 	int _lineLength;
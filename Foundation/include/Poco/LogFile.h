@@ -39,6 +39,30 @@ public:
 		/// Writes the given text to the log file.
 		/// If flush is true, the text will be immediately
 		/// flushed to the file.
+		///
+		/// If write combining has been enabled with setBufferSize()
+		/// and flush is false, the text is written to the file
+		/// when the buffer is full, or when flush() or sync()
+		/// is called.
+
+	void setBufferSize(std::size_t bufferSize);
+		/// Enables write combining with a buffer of the given size,
+		/// which is rounded up to at least 4096 bytes.
+		/// Without write combining (a buffer size of 0, the default),
+		/// every text is written to the file immediately.
+		///
+		/// The file is reopened to resize the buffer.
+
+	std::size_t getBufferSize() const;
+		/// Returns the buffer size set with setBufferSize().
+
+	void flush();
+		/// Writes all buffered text to the file.
+
+	void sync();
+		/// Writes all buffered text to the file and forces the
+		/// data to be written to the disk (using fdatasync()
+		/// where available).
 
 	UInt64 size() const;
 		/// Returns the current size in bytes of the log file.
@@ -54,9 +78,19 @@ private:
 	mutable Poco::FileOutputStream _str;
 	Timestamp _creationDate;
 	UInt64 _size;
+	std::size_t _bufferSize;
 };
 
 
+//
+// inlines
+//
+inline std::size_t LogFile::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
 } // namespace Poco
 
 
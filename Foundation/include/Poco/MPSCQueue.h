@@ -56,7 +56,8 @@ class MPSCQueue
 	///
 	/// Thread safety:
 	///   - Multiple threads may call tryPush/emplace concurrently (producers)
-	///   - Exactly one thread may call tryPop (consumer)
+	///   - Exactly one thread should call tryPop (consumer); producers may
+	///     additionally call it to discard the oldest item
 	///   - size(), empty(), capacity() may be called from any thread
 	///
 	/// Note: This queue does not provide blocking operations. For blocking
@@ -165,31 +166,43 @@ public:
 		/// Attempts to pop an item from the queue.
 		/// If successful, moves the item into the provided reference
 		/// and returns true. Returns false if the queue is empty.
-		/// Must be called from exactly one thread (the consumer).
+		///
+		/// Normally called from exactly one thread (the consumer).
+		/// A producer may also call tryPop() to make room for a new
+		/// item by discarding the oldest one when the queue is full.
 	{
 		std::size_t tail = _tail.load(std::memory_order_relaxed);
-		Slot& slot = _slots[index(tail)];
-		std::size_t seq = slot.sequence.load(std::memory_order_acquire);
-		std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(tail + 1);
 
-		if (diff == 0)
-		{
-			// Slot has been written and is ready to read
-			item = std::move(*slot.ptr());
-			slot.ptr()->~T();
-			// Mark slot as available for producers (sequence = tail + capacity)
-			slot.sequence.store(tail + _capacity, std::memory_order_release);
-			_tail.store(tail + 1, std::memory_order_relaxed);
-			return true;
-		}
-		else if (diff < 0)
+		for (;;)
 		{
-			// Queue is empty or producer hasn't finished writing yet
-			return false;
-		}
+			Slot& slot = _slots[index(tail)];
+			std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(tail + 1);
 
-		// This shouldn't happen with a single consumer
-		return false;
+			if (diff == 0)
+			{
+				// Slot has been written and is ready to read
+				if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+				{
+					item = std::move(*slot.ptr());
+					slot.ptr()->~T();
+					// Mark slot as available for producers (sequence = tail + capacity)
+					slot.sequence.store(tail + _capacity, std::memory_order_release);
+					return true;
+				}
+				// CAS failed, another thread popped this slot, retry with updated tail
+			}
+			else if (diff < 0)
+			{
+				// Queue is empty or producer hasn't finished writing yet
+				return false;
+			}
+			else
+			{
+				// Another thread has popped this slot, reload tail and retry
+				tail = _tail.load(std::memory_order_relaxed);
+			}
+		}
 	}
 
 	std::size_t size() const
@@ -252,7 +265,7 @@ private:
 
 	// Align head and tail to separate cache lines to avoid false sharing
 	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _head{0}; // written by producers (CAS)
-	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _tail{0}; // written by consumer only
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _tail{0}; // written by consumer (CAS)
 };
 
 
@@ -21,6 +21,7 @@
 #include "Poco/Foundation.h"
 #include "Poco/Exception.h"
 #include "Poco/FPEnvironment.h"
+#include "Poco/ByteOrder.h"
 #ifdef min
 	#undef min
 #endif
@@ -36,6 +37,7 @@
 	#include <locale>
 #endif
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 /// Maximum length of an integer formatted as a string.
@@ -183,6 +185,180 @@ inline char thousandSeparator()
 }
 
 
+//
+// Non-allocating Conversions
+//
+// toChars() and fromChars() have the same contract as std::to_chars()
+// and std::from_chars() for base 10: they never allocate, never skip
+// whitespace, accept no leading '+' and no thousand separators, and
+// report the end of the written or consumed characters in the result.
+// Floating-point numbers are formatted like doubleToStr() and floatToStr().
+//
+
+namespace Impl {
+
+	inline UInt64 loadEightChars(const char* p)
+		/// Loads eight characters into an integer, first character
+		/// in the least significant byte.
+	{
+		UInt64 v;
+		std::memcpy(&v, p, sizeof(v));
+		return ByteOrder::fromLittleEndian(v);
+	}
+
+	inline bool isEightDigits(UInt64 v)
+		/// Returns true if all eight characters loaded by
+		/// loadEightChars() are decimal digits.
+	{
+		return (((v & 0xF0F0F0F0F0F0F0F0ULL) | (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+	}
+
+	inline UInt32 parseEightDigits(UInt64 v)
+		/// Converts eight digits loaded by loadEightChars() to their
+		/// value, combining adjacent digits, then pairs, then quads
+		/// with one multiplication each.
+	{
+		v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+		v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+		return static_cast<UInt32>(((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+	}
+
+} // namespace Impl
+
+
+template <typename I, std::enable_if_t<std::is_integral_v<I> && !std::is_same_v<I, bool>, int> = 0>
+std::to_chars_result toChars(char* first, char* last, I value)
+	/// Writes the decimal representation of value to [first, last).
+	///
+	/// Returns {end, std::errc()} if successful, or
+	/// {last, std::errc::value_too_large} if the buffer is too small.
+{
+	return std::to_chars(first, last, value);
+}
+
+
+Foundation_API std::to_chars_result toChars(char* first, char* last, double value);
+	/// Writes the shortest representation of value that converts
+	/// back to the same value to [first, last), in the format used
+	/// by doubleToStr(). No terminating zero is written.
+	///
+	/// Returns {end, std::errc()} if successful, or
+	/// {last, std::errc::value_too_large} if the buffer is too small.
+	/// A buffer of POCO_MAX_FLT_STRING_LEN characters is always sufficient.
+
+
+Foundation_API std::to_chars_result toChars(char* first, char* last, float value);
+	/// Writes the shortest representation of value that converts
+	/// back to the same value to [first, last), in the format used
+	/// by floatToStr(). No terminating zero is written.
+	///
+	/// Returns {end, std::errc()} if successful, or
+	/// {last, std::errc::value_too_large} if the buffer is too small.
+
+
+template <typename I, std::enable_if_t<std::is_integral_v<I> && !std::is_same_v<I, bool>, int> = 0>
+std::from_chars_result fromChars(const char* first, const char* last, I& value)
+	/// Parses a decimal integer, optionally preceded by '-' for signed
+	/// types, from [first, last) and assigns it to value.
+	///
+	/// On little-endian platforms, runs of eight digits are validated
+	/// and converted with a few 64-bit operations (SWAR) instead of
+	/// one multiplication per digit.
+	///
+	/// Returns {end, std::errc()} if successful. If there are no digits,
+	/// returns {first, std::errc::invalid_argument}. If the number does not
+	/// fit into I, all digits are consumed and std::errc::result_out_of_range
+	/// is returned. value is only modified if successful.
+{
+	using U = std::make_unsigned_t<I>;
+
+	const char* p = first;
+	[[maybe_unused]] bool negative = false;
+	if constexpr (std::is_signed_v<I>)
+	{
+		if (p < last && *p == '-')
+		{
+			negative = true;
+			++p;
+		}
+	}
+	const char* const digits = p;
+	UInt64 acc = 0;
+
+	// Eight-digit blocks are safe as long as acc has at most eleven digits,
+	// as 10^11 * 10^8 + 10^8 < 2^64.
+	while (last - p >= 8 && p - digits < 12)
+	{
+		const UInt64 chunk = Impl::loadEightChars(p);
+		if (!Impl::isEightDigits(chunk)) break;
+		acc = acc*100000000 + Impl::parseEightDigits(chunk);
+		p += 8;
+	}
+
+	bool overflow = false;
+	for (; p < last; ++p)
+	{
+		const unsigned d = static_cast<unsigned char>(*p) - static_cast<unsigned>('0');
+		if (d > 9) break;
+		if (acc > (std::numeric_limits<UInt64>::max() - d)/10)
+			overflow = true;
+		else
+			acc = acc*10 + d;
+	}
+
+	if (p == digits) return {first, std::errc::invalid_argument};
+
+	const UInt64 limit = static_cast<UInt64>(std::numeric_limits<U>::max());
+	if constexpr (std::is_signed_v<I>)
+	{
+		const UInt64 max = static_cast<UInt64>(std::numeric_limits<I>::max());
+		if (overflow || acc > max + (negative ? 1 : 0)) return {p, std::errc::result_out_of_range};
+		// Negate in unsigned arithmetic to avoid overflow for the minimum value.
+		value = static_cast<I>(negative ? static_cast<U>(0 - static_cast<U>(acc)) : static_cast<U>(acc));
+	}
+	else
+	{
+		if (overflow || acc > limit) return {p, std::errc::result_out_of_range};
+		value = static_cast<I>(acc);
+	}
+	return {p, std::errc()};
+}
+
+
+Foundation_API std::from_chars_result fromChars(const char* first, const char* last, double& value);
+	/// Parses a floating-point number in the format accepted by
+	/// std::from_chars() with std::chars_format::general from
+	/// [first, last) and assigns it to value. "inf", "infinity" and
+	/// "nan" are accepted in any case.
+	///
+	/// Returns {end, std::errc()} if successful, {first, std::errc::invalid_argument}
+	/// if no number could be parsed, or {end, std::errc::result_out_of_range}
+	/// if the value cannot be represented. value is only modified if successful.
+
+
+Foundation_API std::from_chars_result fromChars(const char* first, const char* last, float& value);
+	/// Parses a floating-point number from [first, last) and assigns
+	/// it to value. See fromChars(const char*, const char*, double&).
+
+
+template <typename T>
+[[nodiscard]] bool fromChars(std::string_view str, T& value)
+	/// Parses the complete string str with the fromChars() overload
+	/// for T and assigns the result to value.
+	///
+	/// Returns true if successful, or false if str does not contain
+	/// a number of type T without any leading or trailing characters.
+	/// value is only modified if successful.
+{
+	const char* const end = str.data() + str.size();
+	T result;
+	const auto [ptr, ec] = fromChars(str.data(), end, result);
+	if (ec != std::errc() || ptr != end) return false;
+	value = result;
+	return true;
+}
+
+
 //
 // String to Number Conversions
 //
@@ -211,8 +387,11 @@ template <typename I>
 	if (*start == '+') ++start;
 	if (start >= end) return false; // reject bare sign without digits
 
-	// Try std::from_chars -- handles sign, overflow, and all bases.
-	const auto [ptr, ec] = std::from_chars(start, end, outResult, base);
+	// Try fromChars() for base 10, std::from_chars otherwise --
+	// both handle sign and overflow.
+	const auto [ptr, ec] = (base == 10) ?
+		fromChars(start, end, outResult) :
+		std::from_chars(start, end, outResult, base);
 	if (ec == std::errc() && ptr == end)
 		return true;
 
@@ -21,6 +21,8 @@
 #include "Poco/Foundation.h"
 #include "Poco/Formatter.h"
 #include "Poco/Message.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timestamp.h"
 #include <vector>
 
 
@@ -76,7 +78,11 @@ class Foundation_API PatternFormatter: public Formatter
 	///   * %v[width] - the message source (%s) but text length is padded/cropped to 'width'
 	///   * %[name] - the value of the message parameter with the given name
 	///   * %% - percent sign
-
+	///
+	/// The pattern is parsed once, when it is set. Date/time fields
+	/// at the beginning of the pattern (e.g. "%Y-%m-%d %H:%M:%S")
+	/// are rendered only once per second, and the result is reused
+	/// for all messages logged within the same second.
 {
 public:
 	using Ptr = AutoPtr<PatternFormatter>;
@@ -97,6 +103,17 @@ public:
 		/// Formats the message according to the specified
 		/// format pattern and places the result in text.
 
+	std::size_t format(const Message& msg, char* buffer, std::size_t size);
+		/// Formats the message according to the specified
+		/// format pattern and places the result in the given
+		/// buffer, without allocating memory. The result is not
+		/// zero-terminated.
+		///
+		/// Returns the length of the formatted message. If the
+		/// returned length is greater than size, the buffer was
+		/// too small, and only the first size characters have been
+		/// written.
+
 	void setProperty(const std::string& name, const std::string& value) override;
 		/// Sets the property with the given name to the given value.
 		///
@@ -147,11 +164,48 @@ private:
 		std::string prepend;
 	};
 
+	enum
+	{
+		MAX_PREFIX_LENGTH = 64
+	};
+
+	struct TimeFields
+		/// The date/time fields of a second, together with the
+		/// timestamp prefix of the pattern rendered for that second.
+	{
+		Timestamp::TimeVal epochSecond = Timestamp::TIMEVAL_MIN;
+		int tzd = 0;
+		int year = 0;
+		int month = 0;
+		int day = 0;
+		int dayOfWeek = 0;
+		int hour = 0;
+		int minute = 0;
+		int second = 0;
+		std::size_t prefixLength = 0;
+		char prefix[MAX_PREFIX_LENGTH];
+	};
+
+	template <class S>
+	void formatImpl(const Message& msg, S& sink);
+
+	template <class S>
+	static bool formatTime(char key, const TimeFields& fields, S& sink);
+		/// Appends the date/time field for the given key, if it
+		/// does not depend on the fraction of the second.
+		/// Returns false if the key does not denote such a field.
+
+	void getTimeFields(Timestamp::TimeVal epochSecond, bool localTime, TimeFields& fields);
+		/// Returns the date/time fields for the given second (UTC),
+		/// from the cache if possible.
+
 	void parsePattern();
 		/// Will parse the _pattern string into the vector of PatternActions,
 		/// which contains the message key, any text that needs to be written first
 		/// a property in case of %[] and required length.
+		/// Also determines the actions making up the timestamp prefix.
 
+	void resetTimeCache();
 	void parsePriorityNames();
 
 	static const char* extractBasename(const char* path);
@@ -160,6 +214,10 @@ private:
 	static const std::string DEFAULT_PRIORITY_NAMES;
 
 	std::vector<PatternAction> _patternActions;
+	std::size_t _prefixActions;
+	bool _prefixLocalTime;
+	TimeFields _timeCache[2];
+	SpinlockMutex _timeCacheMutex;
 	bool _localTime;
 	bool _localTimeSet;
 	std::string _pattern;
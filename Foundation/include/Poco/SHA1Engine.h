@@ -34,6 +34,9 @@ namespace Poco {
 class Foundation_API SHA1Engine: public DigestEngine
 	/// This class implements the SHA-1 message digest algorithm.
 	/// (FIPS 180-1, see http://www.itl.nist.gov/fipspubs/fip180-1.htm)
+	///
+	/// Complete blocks are processed with the Intel SHA extensions
+	/// if the CPU supports them (see CPUFeatures).
 {
 public:
 	enum
@@ -54,6 +57,7 @@ protected:
 
 private:
 	void transform();
+	void transformBlocks(const UInt8* data, std::size_t blocks);
 	static void byteReverse(UInt32* buffer, int byteCount);
 
 	using BYTE = UInt8;
@@ -26,6 +26,8 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/DigestEngine.h"
+#include <string_view>
+#include <vector>
 
 
 namespace Poco {
@@ -34,6 +36,10 @@ namespace Poco {
 class Foundation_API SHA2Engine: public DigestEngine
 	/// This class implements the SHA-2 message digest algorithm.
 	/// (FIPS 180-4, see http://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf)
+	///
+	/// For SHA-224 and SHA-256, complete blocks are processed with
+	/// the Intel SHA extensions or the ARMv8 SHA-2 instructions if
+	/// available (see CPUFeatures).
 {
 public:
 	enum ALGORITHM
@@ -53,6 +59,25 @@ public:
 	void reset() override;
 	const DigestEngine::Digest& digest() override;
 
+	static std::vector<DigestEngine::Digest> digestMany(const std::vector<std::string_view>& messages, ALGORITHM algorithm = SHA_256);
+		/// Computes the digests of all given messages and returns
+		/// them in the same order.
+		///
+		/// This is considerably faster than hashing the messages one
+		/// after the other with a single engine if there are many small
+		/// messages and the CPU supports AVX2, but not the SHA
+		/// extensions: up to eight SHA-224 or SHA-256 messages are
+		/// then hashed in parallel, one per vector lane. Otherwise, or
+		/// for the other algorithms, the messages are hashed sequentially.
+
+	static std::vector<DigestEngine::Digest> digestManyAVX2(const std::vector<std::string_view>& messages, ALGORITHM algorithm = SHA_256);
+		/// Same as digestMany(), but always uses the AVX2 implementation
+		/// for SHA-224 and SHA-256 if the CPU supports AVX2, even if it
+		/// also supports the SHA extensions. Otherwise, falls back to
+		/// digestMany().
+		///
+		/// This is mainly intended for testing the AVX2 implementation.
+
 protected:
 	void updateImpl(const void *data, std::size_t length) override;
 
@@ -0,0 +1,125 @@
+//
+// SlabAllocator.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  SlabAllocator
+//
+// Definition of the SlabAllocator class and the SlabBufferAllocator class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_SlabAllocator_INCLUDED
+#define Foundation_SlabAllocator_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <ios>
+#include <vector>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API SlabAllocator
+	/// A thread-caching allocator for memory blocks of a few
+	/// fixed size classes, intended for I/O buffers.
+	///
+	/// Requested sizes are rounded up to the next power of two
+	/// between MIN_BLOCK_SIZE and MAX_BLOCK_SIZE. Each size class
+	/// has a central free list, protected by a mutex, and every
+	/// thread has its own cache of free blocks for each size class.
+	///
+	/// Allocations and deallocations normally only touch the calling
+	/// thread's cache and therefore need neither a lock nor an atomic
+	/// operation. This includes deallocations of blocks that have been
+	/// allocated by another thread: the block simply goes into the
+	/// cache of the deallocating thread. Only when a thread's cache
+	/// runs empty or full, a batch of blocks is moved from or to the
+	/// central free list.
+	///
+	/// Blocks are taken from the system in slabs of several blocks,
+	/// and are never returned to the system. When a thread terminates,
+	/// its cached blocks are moved to the central free list.
+	///
+	/// Sizes larger than MAX_BLOCK_SIZE are passed on to
+	/// operator new and operator delete.
+{
+public:
+	enum
+	{
+		MIN_BLOCK_SIZE = 64,
+		MAX_BLOCK_SIZE = 256*1024,
+		SIZE_CLASSES   = 13
+	};
+
+	struct Statistics
+		/// Statistics for a size class.
+	{
+		std::size_t blockSize = 0;    /// The block size of the size class.
+		std::size_t totalBlocks = 0;  /// The number of blocks taken from the system.
+		std::size_t freeBlocks = 0;   /// The number of blocks in the central free list.
+		std::size_t refills = 0;      /// The number of thread cache refills from the central free list.
+		std::size_t flushes = 0;      /// The number of thread cache flushes to the central free list.
+	};
+
+	static void* allocate(std::size_t size);
+		/// Allocates a memory block of at least the given size.
+		///
+		/// Throws a std::bad_alloc if no memory is available.
+
+	static void deallocate(void* ptr, std::size_t size) noexcept;
+		/// Releases a memory block obtained from allocate().
+		/// The size must be the same as the one given to allocate().
+		/// The block may be released by any thread.
+
+	static std::size_t blockSize(std::size_t size);
+		/// Returns the size of the blocks allocated for the given
+		/// size, or the size itself if it is larger than MAX_BLOCK_SIZE.
+
+	static void flushThreadCache();
+		/// Moves all blocks cached by the calling thread
+		/// to the central free lists.
+
+	static std::vector<Statistics> statistics();
+		/// Returns statistics for all size classes.
+		///
+		/// Blocks in thread caches are counted in totalBlocks,
+		/// but not in freeBlocks.
+
+private:
+	SlabAllocator() = delete;
+};
+
+
+template <typename ch>
+class SlabBufferAllocator
+	/// A BufferAllocator for BasicBufferedStreamBuf and
+	/// BasicBufferedBidirectionalStreamBuf that obtains
+	/// buffers from the SlabAllocator.
+{
+public:
+	using char_type = ch;
+
+	static char_type* allocate(std::streamsize size)
+	{
+		return static_cast<char_type*>(SlabAllocator::allocate(static_cast<std::size_t>(size)*sizeof(char_type)));
+	}
+
+	static void deallocate(char_type* ptr, std::streamsize size) noexcept
+	{
+		SlabAllocator::deallocate(ptr, static_cast<std::size_t>(size)*sizeof(char_type));
+	}
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_SlabAllocator_INCLUDED
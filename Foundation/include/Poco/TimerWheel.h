@@ -0,0 +1,225 @@
+//
+// TimerWheel.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TimerWheel
+//
+// Definition of the TimerWheel class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimerWheel_INCLUDED
+#define Foundation_TimerWheel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Clock.h"
+#include "Poco/Timespan.h"
+#include "Poco/Mutex.h"
+#include <functional>
+#include <vector>
+
+
+namespace Poco {
+
+
+class Foundation_API TimerWheel
+	/// A hashed hierarchical timing wheel, for managing a large
+	/// number of timeouts, like per-connection idle timeouts.
+	///
+	/// Scheduling, rescheduling and cancelling a timer takes constant
+	/// time, independent of the number of timers. Timers are kept in
+	/// four levels of 256 slots each. With the default resolution
+	/// of one millisecond, the lowest level covers 256 milliseconds,
+	/// and the highest level covers about 49 days. Timers further in
+	/// the future are kept in the highest level until they come
+	/// within its range.
+	///
+	/// The TimerWheel does not have a thread of its own. It must be
+	/// driven by calling advance(), which invokes the callbacks of all
+	/// expired timers in the calling thread. nextTimeout() tells how
+	/// long the driving thread may sleep (e.g., in a poll() call)
+	/// before advance() must be called again. If a timer expiring
+	/// earlier is scheduled by another thread while the driving thread
+	/// is sleeping, the wake-up callback set with setWakeUpCallback()
+	/// is invoked.
+	///
+	/// A timer never expires before its expiry time, but may expire up
+	/// to one tick (plus scheduling latency) later.
+	///
+	/// All member functions can be called from any thread, including
+	/// from timer callbacks. Callbacks are invoked without holding the
+	/// internal lock.
+	///
+	/// Usage:
+	///     TimerWheel wheel;
+	///     TimerWheel::TimerId id = wheel.schedule(Timespan(5, 0), []()
+	///         {
+	///             std::cout << "Timeout!" << std::endl;
+	///         });
+	///     ...
+	///     wheel.reschedule(id, Timespan(5, 0)); // reset idle timeout
+	///     ...
+	///     for (;;)
+	///     {
+	///         Thread::sleep(wheel.nextTimeout(Timespan(1, 0)).totalMilliseconds());
+	///         wheel.advance();
+	///     }
+{
+public:
+	using Callback = std::function<void()>;
+	using TimerId = UInt64;
+
+	static const TimerId INVALID_TIMER = 0;
+		/// A TimerId that never denotes a timer.
+
+	explicit TimerWheel(const Timespan& resolution = Timespan(1000));
+		/// Creates the TimerWheel with the given tick resolution,
+		/// which must be at least one microsecond.
+
+	~TimerWheel();
+		/// Destroys the TimerWheel. Pending timers are discarded
+		/// without invoking their callbacks.
+
+	TimerId schedule(const Clock& expiry, Callback callback);
+		/// Schedules the callback for execution at the given time,
+		/// and returns the ID of the new timer.
+
+	TimerId schedule(const Timespan& delay, Callback callback);
+		/// Schedules the callback for execution after the given delay,
+		/// and returns the ID of the new timer.
+
+	bool reschedule(TimerId id, const Clock& expiry);
+		/// Changes the expiry time of the given timer.
+		///
+		/// Returns false if the timer does not exist, because it
+		/// has expired or has been cancelled.
+
+	bool reschedule(TimerId id, const Timespan& delay);
+		/// Changes the expiry time of the given timer to the
+		/// given delay from now.
+		///
+		/// Returns false if the timer does not exist, because it
+		/// has expired or has been cancelled.
+
+	bool cancel(TimerId id);
+		/// Cancels the given timer.
+		///
+		/// Returns false if the timer does not exist, because it
+		/// has expired or has been cancelled. A callback that is
+		/// currently executing is not affected.
+
+	bool isScheduled(TimerId id) const;
+		/// Returns true if the given timer has neither expired
+		/// nor been cancelled.
+
+	std::size_t advance();
+		/// Invokes the callbacks of all timers that have expired,
+		/// in order of expiry. Returns the number of callbacks invoked.
+		///
+		/// Exceptions thrown by callbacks are passed to the ErrorHandler.
+
+	std::size_t advance(const Clock& now);
+		/// Invokes the callbacks of all timers that have expired
+		/// at the given time.
+
+	Timespan nextTimeout(const Timespan& maxTimeout);
+		/// Returns the time until advance() must be called next,
+		/// rounded up to full milliseconds, but not more than maxTimeout.
+		///
+		/// The driving thread is considered sleeping until the next
+		/// call to advance(). If a timer expiring before the returned
+		/// timeout is scheduled in the meantime, the wake-up callback
+		/// is invoked.
+
+	void setWakeUpCallback(const Callback& wakeUp);
+		/// Sets the callback for waking up the thread driving
+		/// the TimerWheel. See nextTimeout().
+		///
+		/// Must be set before timers are scheduled.
+
+	void clear();
+		/// Cancels all timers.
+
+	std::size_t size() const;
+		/// Returns the number of scheduled timers.
+
+	bool empty() const;
+		/// Returns true if no timers are scheduled.
+
+	Timespan resolution() const;
+		/// Returns the tick resolution.
+
+private:
+	enum
+	{
+		LEVELS = 4,
+		SLOT_BITS = 8,
+		SLOTS = 1 << SLOT_BITS,
+		SLOT_MASK = SLOTS - 1,
+		BITMAP_WORDS = SLOTS/64
+	};
+
+	static const UInt32 NIL = 0xFFFFFFFF;
+
+	struct Node
+	{
+		Callback callback;
+		UInt64 expiry = 0;
+		UInt32 generation = 1;
+		UInt32 prev = NIL;
+		UInt32 next = NIL;
+		UInt32 slot = NIL;
+	};
+
+	UInt64 expiryTick(const Clock& expiry) const;
+	UInt64 currentTick(const Clock& now) const;
+	Node* find(TimerId id);
+	const Node* find(TimerId id) const;
+	UInt32 allocate();
+	void release(UInt32 index);
+	void insert(UInt32 index, UInt64 minTick);
+	void unlink(UInt32 index);
+	void cascade(int level);
+	void expire(std::vector<Callback>& expired);
+	void advanceTo(UInt64 tick, std::vector<Callback>& expired);
+	int findSlot(int from, int to) const;
+	bool mustWakeUp(UInt64 expiry);
+
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel& operator = (const TimerWheel&) = delete;
+
+	Clock _start;
+	Clock::ClockDiff _resolution;
+	UInt64 _currentTick;
+	std::size_t _size;
+	std::vector<Node> _nodes;
+	UInt32 _freeList;
+	UInt32 _slots[LEVELS*SLOTS];
+	UInt64 _bitmap[BITMAP_WORDS];
+	bool _sleeping;
+	UInt64 _wakeUpTick;
+	Callback _wakeUp;
+	mutable FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline Timespan TimerWheel::resolution() const
+{
+	return Timespan(_resolution);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimerWheel_INCLUDED
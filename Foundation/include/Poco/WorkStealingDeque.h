@@ -0,0 +1,222 @@
+//
+// WorkStealingDeque.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingDeque
+//
+// Definition of the WorkStealingDeque class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingDeque_INCLUDED
+#define Foundation_WorkStealingDeque_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace Poco {
+
+
+template <typename T>
+class WorkStealingDeque
+	/// A lock-free, unbounded work-stealing deque, as described by
+	/// Chase and Lev ("Dynamic Circular Work-Stealing Deque", 2005),
+	/// using the C++11 memory model mapping given by Lê, Pop, Cohen
+	/// and Zappa Nardelli ("Correct and Efficient Work-Stealing for
+	/// Weak Memory Models", 2013).
+	///
+	/// The deque has a single owner thread, which pushes and pops
+	/// items at the bottom end (LIFO), and any number of thief threads,
+	/// which steal items from the top end (FIFO).
+	///
+	/// The ring buffer grows when full. Buffers that have been replaced
+	/// are kept until the deque is destroyed, as thieves may still
+	/// read from them.
+	///
+	/// T must be trivially copyable, and is typically a pointer type.
+	///
+	/// Thread safety:
+	///   - Exactly one thread (the owner) may call push() and pop().
+	///   - Any thread may call steal(), empty() and size().
+{
+public:
+	static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque requires a trivially copyable type");
+
+	explicit WorkStealingDeque(std::size_t capacity = 256):
+		/// Creates the deque with the given initial capacity,
+		/// which is rounded up to the next power of two.
+		_top(0),
+		_bottom(0)
+	{
+		std::size_t n = 2;
+		while (n < capacity) n *= 2;
+		_buffers.emplace_back(new Buffer(n));
+		_pBuffer.store(_buffers.back().get(), std::memory_order_relaxed);
+	}
+
+	~WorkStealingDeque() = default;
+		/// Destroys the deque.
+
+	WorkStealingDeque(const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator = (const WorkStealingDeque&) = delete;
+
+	void push(T item)
+		/// Pushes an item onto the bottom of the deque.
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed);
+		std::int64_t t = _top.load(std::memory_order_acquire);
+		Buffer* pBuffer = _pBuffer.load(std::memory_order_relaxed);
+		if (b - t > static_cast<std::int64_t>(pBuffer->capacity()) - 1)
+		{
+			pBuffer = grow(pBuffer, t, b);
+		}
+		pBuffer->put(b, item);
+		std::atomic_thread_fence(std::memory_order_release);
+		_bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	bool pop(T& item)
+		/// Pops the most recently pushed item from the bottom of
+		/// the deque. Returns false if the deque is empty, or if the
+		/// last item has been taken by a thief.
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+		Buffer* pBuffer = _pBuffer.load(std::memory_order_relaxed);
+		_bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t t = _top.load(std::memory_order_relaxed);
+		bool result = true;
+		if (t <= b)
+		{
+			item = pBuffer->get(b);
+			if (t == b)
+			{
+				// last item; race against thieves
+				if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					result = false;
+				_bottom.store(b + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			result = false;
+			_bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return result;
+	}
+
+	bool steal(T& item)
+		/// Steals the least recently pushed item from the top of the
+		/// deque. Returns false if the deque is empty, or if another
+		/// thread has taken the item first.
+		/// May be called by any thread.
+	{
+		std::int64_t t = _top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t b = _bottom.load(std::memory_order_acquire);
+		if (t < b)
+		{
+			Buffer* pBuffer = _pBuffer.load(std::memory_order_acquire);
+			T result = pBuffer->get(t);
+			if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return false;
+			item = result;
+			return true;
+		}
+		return false;
+	}
+
+	bool empty() const
+		/// Returns true if the deque is empty.
+		/// The result is only a snapshot if other threads
+		/// access the deque concurrently.
+	{
+		return size() == 0;
+	}
+
+	std::size_t size() const
+		/// Returns the number of items in the deque.
+		/// The result is only a snapshot if other threads
+		/// access the deque concurrently.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed);
+		std::int64_t t = _top.load(std::memory_order_relaxed);
+		return b > t ? static_cast<std::size_t>(b - t) : 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the current capacity of the ring buffer.
+	{
+		return _pBuffer.load(std::memory_order_relaxed)->capacity();
+	}
+
+private:
+	class Buffer
+	{
+	public:
+		explicit Buffer(std::size_t capacity):
+			_mask(capacity - 1),
+			_items(new std::atomic<T>[capacity])
+		{
+		}
+
+		std::size_t capacity() const
+		{
+			return _mask + 1;
+		}
+
+		void put(std::int64_t index, T item)
+		{
+			_items[static_cast<std::size_t>(index) & _mask].store(item, std::memory_order_relaxed);
+		}
+
+		T get(std::int64_t index) const
+		{
+			return _items[static_cast<std::size_t>(index) & _mask].load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::size_t _mask;
+		std::unique_ptr<std::atomic<T>[]> _items;
+	};
+
+	Buffer* grow(Buffer* pOld, std::int64_t top, std::int64_t bottom)
+	{
+		_buffers.emplace_back(new Buffer(pOld->capacity()*2));
+		Buffer* pNew = _buffers.back().get();
+		for (std::int64_t i = top; i < bottom; ++i)
+		{
+			pNew->put(i, pOld->get(i));
+		}
+		_pBuffer.store(pNew, std::memory_order_release);
+		return pNew;
+	}
+
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> _top;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> _bottom;
+	alignas(CACHE_LINE_SIZE) std::atomic<Buffer*> _pBuffer;
+	std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingDeque_INCLUDED
@@ -0,0 +1,188 @@
+//
+// WorkStealingScheduler.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingScheduler
+//
+// Definition of the WorkStealingScheduler class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingScheduler_INCLUDED
+#define Foundation_WorkStealingScheduler_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Thread.h"
+#include "Poco/Environment.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+
+
+class Runnable;
+
+
+class Foundation_API WorkStealingScheduler
+	/// A fixed-size set of worker threads that execute Runnable
+	/// objects, using work stealing for load balancing.
+	///
+	/// Every worker has its own lock-free WorkStealingDeque.
+	/// Runnables scheduled from within a worker (e.g., a task
+	/// spawning sub-tasks) are pushed onto that worker's deque.
+	/// Runnables scheduled by other threads go into a lock-free,
+	/// bounded injection queue shared by all workers. Should the
+	/// injection queue ever be full, runnables are put into a
+	/// mutex-protected overflow queue instead.
+	///
+	/// A worker takes work from its own deque first, then from the
+	/// injection queue, and finally steals from the deques of the
+	/// other workers. A worker that finds no work spins briefly and
+	/// then parks until new work is scheduled. Scheduling only
+	/// touches the parking lock if there actually are parked workers.
+	///
+	/// Runnables are executed in no particular order, and
+	/// there is no support for priorities.
+	///
+	/// Worker threads are started when the first runnable is
+	/// scheduled, and are stopped by joinAll().
+{
+public:
+	WorkStealingScheduler(int threads = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates the WorkStealingScheduler with the given
+		/// number of worker threads and thread stack size.
+
+	WorkStealingScheduler(const std::string& name,
+		int threads = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates the WorkStealingScheduler with the given name,
+		/// number of worker threads and thread stack size.
+		///
+		/// The name is used to name the worker threads.
+
+	~WorkStealingScheduler();
+		/// Waits for all scheduled runnables to complete and
+		/// stops the worker threads.
+
+	void schedule(Runnable& target);
+		/// Schedules the given Runnable for execution by one
+		/// of the worker threads.
+		///
+		/// The Runnable must stay alive until its run()
+		/// member function has returned.
+
+	void joinAll();
+		/// Waits until all scheduled runnables, including those
+		/// scheduled while waiting, have completed and stops the
+		/// worker threads. Worker threads are started again
+		/// when the next runnable is scheduled.
+		///
+		/// Runnables scheduled while the worker threads are
+		/// stopping are run by the scheduling thread itself.
+
+	int capacity() const;
+		/// Returns the number of worker threads.
+
+	int getStackSize() const;
+		/// Returns the stack size of the worker threads.
+
+	const std::string& name() const;
+		/// Returns the name of the scheduler.
+
+	int pending() const;
+		/// Returns the number of runnables that have been
+		/// scheduled, but have not completed yet.
+
+	Int64 steals() const;
+		/// Returns the number of runnables that have been
+		/// stolen from another worker's deque.
+
+private:
+	struct Worker;
+	class InjectionQueue;
+
+	void start();
+	void run(Worker& worker);
+	Runnable* nextTask(Worker& worker);
+	Runnable* takeTask();
+	void runTask(Runnable& target);
+	bool hasWork() const;
+	void park();
+	void wakeUp();
+	void taskDone();
+
+	WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+	WorkStealingScheduler& operator = (const WorkStealingScheduler&) = delete;
+
+	std::string _name;
+	int _threads;
+	int _stackSize;
+	std::vector<std::unique_ptr<Worker>> _workers;
+	std::unique_ptr<InjectionQueue> _pInjectionQueue;
+	std::deque<Runnable*> _overflow;
+	std::mutex _overflowMutex;
+	std::atomic<int> _overflowCount;
+	std::atomic<bool> _running;
+	std::atomic<bool> _stopped;
+	std::atomic<int> _pending;
+	std::atomic<int> _parked;
+	std::atomic<Int64> _steals;
+	int _wakeUps;
+	std::mutex _parkMutex;
+	std::condition_variable _parkCondition;
+	std::condition_variable _idleCondition;
+	std::mutex _startMutex;
+};
+
+
+//
+// inlines
+//
+inline int WorkStealingScheduler::capacity() const
+{
+	return _threads;
+}
+
+
+inline int WorkStealingScheduler::getStackSize() const
+{
+	return _stackSize;
+}
+
+
+inline const std::string& WorkStealingScheduler::name() const
+{
+	return _name;
+}
+
+
+inline int WorkStealingScheduler::pending() const
+{
+	return _pending.load(std::memory_order_relaxed);
+}
+
+
+inline Int64 WorkStealingScheduler::steals() const
+{
+	return _steals.load(std::memory_order_relaxed);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingScheduler_INCLUDED
@@ -15,6 +15,7 @@
 #include "Poco/ActiveThreadPool.h"
 #include "Poco/Runnable.h"
 #include "Poco/Thread.h"
+#include "Poco/WorkStealingScheduler.h"
 #include "Poco/ThreadLocal.h"
 #include "Poco/ErrorHandler.h"
 #include "Poco/Condition.h"
@@ -433,6 +434,16 @@ ActiveThreadPool::ActiveThreadPool(const std::string& name, int capacity, int st
 }
 
 
+ActiveThreadPool::ActiveThreadPool(const std::string& name, int capacity, int stackSize, Scheduling scheduling):
+	_impl(new ActiveThreadPoolPrivate(capacity, stackSize, name))
+{
+	if (scheduling == SCHEDULING_WORK_STEALING)
+	{
+		_pScheduler.reset(new WorkStealingScheduler(name, capacity, stackSize));
+	}
+}
+
+
 ActiveThreadPool::~ActiveThreadPool()
 {
 }
@@ -444,8 +455,20 @@ int ActiveThreadPool::capacity() const
 }
 
 
+ActiveThreadPool::Scheduling ActiveThreadPool::scheduling() const
+{
+	return _pScheduler ? SCHEDULING_WORK_STEALING : SCHEDULING_PRIORITY_QUEUE;
+}
+
+
 void ActiveThreadPool::start(Runnable& target, int priority)
 {
+	if (_pScheduler)
+	{
+		_pScheduler->schedule(target);
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_impl->mutex);
 
 	if (!_impl->tryStart(target))
@@ -464,6 +487,7 @@ void ActiveThreadPool::start(Runnable& target, int priority)
 
 void ActiveThreadPool::joinAll()
 {
+	if (_pScheduler) _pScheduler->joinAll();
 	_impl->joinAll();
 }
 
@@ -22,6 +22,7 @@
 #include "Poco/Exception.h"
 #include "Poco/String.h"
 #include "Poco/Format.h"
+#include <vector>
 #if defined(__linux__)
 #include <sched.h>
 #include <unistd.h>
@@ -100,7 +101,13 @@ void AsyncChannel::open()
 {
 	FastMutex::ScopedLock lock(_threadMutex);
 
+	if (_lockFree && !_pRing)
+	{
+		std::size_t capacity = _queueSize != 0 ? _queueSize : DEFAULT_RING_SIZE;
+		_pRing = std::make_unique<MessageRing>(capacity);
+	}
 	if (!_thread.isRunning()) _thread.start(*this);
+	if (_pRing) _ringOpen.store(true, std::memory_order_release);
 }
 
 
@@ -108,7 +115,17 @@ void AsyncChannel::close()
 {
 	if (!_closed.exchange(true))
 	{
-		if (_thread.isRunning())
+		if (_pRing)
+		{
+			// the background thread delivers all queued messages before it exits
+			_ringSpaceEvent.set();
+			do
+			{
+				_ringEvent.set();
+			}
+			while (!_thread.tryJoin(100));
+		}
+		else if (_thread.isRunning())
 		{
 			while (!_queue.empty()) Thread::sleep(100);
 
@@ -126,9 +143,15 @@ template <typename M>
 void AsyncChannel::logImpl(M&& msg)
 {
 	if (_closed) return;
+	if (_lockFree)
+	{
+		logRingImpl(std::forward<M>(msg));
+		return;
+	}
 	if (_queueSize != 0 && static_cast<std::size_t>(_queue.size()) >= _queueSize)
 	{
 		++_dropCount;
+		++_totalDropCount;
 		return;
 	}
 
@@ -144,6 +167,39 @@ void AsyncChannel::logImpl(M&& msg)
 }
 
 
+template <typename M>
+void AsyncChannel::logRingImpl(M&& msg)
+{
+	if (!_ringOpen.load(std::memory_order_acquire)) open();
+
+	// emplace() only moves from msg if it succeeds
+	while (!_pRing->emplace(std::forward<M>(msg)))
+	{
+		if (_overflowPolicy == OVERFLOW_DROP_NEWEST)
+		{
+			++_ringDropCount;
+			++_totalDropCount;
+			return;
+		}
+		else if (_overflowPolicy == OVERFLOW_DROP_OLDEST)
+		{
+			Message oldest;
+			if (_pRing->tryPop(oldest))
+			{
+				++_ringDropCount;
+				++_totalDropCount;
+			}
+		}
+		else
+		{
+			if (_closed) return;
+			waitForSpace();
+		}
+	}
+	wakeUpRing();
+}
+
+
 void AsyncChannel::log(const Message& msg)
 {
 	logImpl(msg);
@@ -177,6 +233,20 @@ void AsyncChannel::setProperty(const std::string& name, const std::string& value
 	{
 		_enableCpuAffinity = (Poco::icompare(value, "true") == 0 || value == "1");
 	}
+	else if (name == "queueType")
+	{
+		setQueueType(value);
+	}
+	else if (name == "overflowPolicy")
+	{
+		setOverflowPolicy(value);
+	}
+	else if (name == "batchSize")
+	{
+		std::size_t batchSize = Poco::NumberParser::parseUnsigned(value);
+		if (batchSize == 0) throw InvalidArgumentException("batchSize", value);
+		_batchSize = batchSize;
+	}
 	else
 	{
 		Channel::setProperty(name, value);
@@ -209,6 +279,12 @@ void AsyncChannel::run()
 #endif
 	}
 
+	if (_pRing)
+	{
+		runRing();
+		return;
+	}
+
 	AutoPtr<Notification> nf = _queue.waitDequeueNotification();
 	while (nf)
 	{
@@ -244,4 +320,118 @@ void AsyncChannel::setPriority(const std::string& value)
 }
 
 
+void AsyncChannel::setQueueType(const std::string& value)
+{
+	FastMutex::ScopedLock lock(_threadMutex);
+
+	bool lockFree;
+	if (Poco::icompare(value, "notification") == 0)
+		lockFree = false;
+	else if (Poco::icompare(value, "lockFree") == 0)
+		lockFree = true;
+	else
+		throw InvalidArgumentException("queueType", value);
+
+	if (lockFree != _lockFree && _thread.isRunning())
+		throw IllegalStateException("Cannot change the queue type of an open AsyncChannel");
+	_lockFree = lockFree;
+}
+
+
+void AsyncChannel::setOverflowPolicy(const std::string& value)
+{
+	if (Poco::icompare(value, "block") == 0)
+		_overflowPolicy = OVERFLOW_BLOCK;
+	else if (Poco::icompare(value, "dropNewest") == 0)
+		_overflowPolicy = OVERFLOW_DROP_NEWEST;
+	else if (Poco::icompare(value, "dropOldest") == 0)
+		_overflowPolicy = OVERFLOW_DROP_OLDEST;
+	else
+		throw InvalidArgumentException("overflowPolicy", value);
+}
+
+
+std::size_t AsyncChannel::droppedMessages() const
+{
+	return _totalDropCount;
+}
+
+
+void AsyncChannel::runRing()
+{
+	std::vector<Message> batch(_batchSize);
+	std::size_t reportedDropCount = 0;
+	for (;;)
+	{
+		std::size_t n = 0;
+		while (n < batch.size() && _pRing->tryPop(batch[n])) ++n;
+
+		if (n > 0)
+		{
+			signalSpace();
+			std::size_t dropCount = _ringDropCount.load(std::memory_order_relaxed);
+
+			FastMutex::ScopedLock lock(_channelMutex);
+
+			if (_pChannel)
+			{
+				if (dropCount != reportedDropCount)
+				{
+					_pChannel->log(Message(batch[0], Poco::format("Dropped %z messages.", dropCount - reportedDropCount)));
+					reportedDropCount = dropCount;
+				}
+				for (std::size_t i = 0; i < n; i++)
+				{
+					_pChannel->log(batch[i]);
+				}
+			}
+		}
+		else if (_closed)
+		{
+			break;
+		}
+		else
+		{
+			// Producers only signal the event if the idle flag is set.
+			// The fences make sure that either the producer sees the flag,
+			// or the consumer sees the message.
+			_ringIdle.store(true);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (_pRing->empty() && !_closed) _ringEvent.tryWait(IDLE_WAIT_MILLISECONDS);
+			_ringIdle.store(false, std::memory_order_relaxed);
+		}
+	}
+}
+
+
+void AsyncChannel::wakeUpRing()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_ringIdle.load(std::memory_order_relaxed)) _ringEvent.set();
+}
+
+
+void AsyncChannel::waitForSpace()
+{
+	// The consumer only signals the event if a producer is blocked.
+	// The fences make sure that either the consumer sees the blocked
+	// producer, or the producer sees the free slot.
+	_ringBlocked.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_pRing->size() >= _pRing->capacity() && !_closed)
+	{
+		wakeUpRing();
+		_ringSpaceEvent.tryWait(IDLE_WAIT_MILLISECONDS);
+	}
+	_ringBlocked.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+void AsyncChannel::signalSpace()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_ringBlocked.load(std::memory_order_relaxed) > 0) _ringSpaceEvent.set();
+}
+
+
 } // namespace Poco
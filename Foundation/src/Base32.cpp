@@ -0,0 +1,344 @@
+//
+// Base32.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base32
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base32.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+namespace
+{
+	const unsigned char DEFAULT_ENCODING[32] =
+	{
+		'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+		'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+		'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+		'Y', 'Z', '2', '3', '4', '5', '6', '7'
+	};
+
+
+	const unsigned char HEX_ENCODING[32] =
+	{
+		'0', '1', '2', '3', '4', '5', '6', '7',
+		'8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+		'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N',
+		'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V'
+	};
+
+
+	const unsigned char CROCKFORD_ENCODING[32] =
+	{
+		'0', '1', '2', '3', '4', '5', '6', '7',
+		'8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+		'G', 'H', 'J', 'K', 'M', 'N', 'P', 'Q',
+		'R', 'S', 'T', 'V', 'W', 'X', 'Y', 'Z'
+	};
+
+
+	const unsigned char REVERSE_DEFAULT_ENCODING[256] =
+	{
+		/* 00 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 08 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 10 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 18 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 20 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 28 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 30 */ 0xFF, 0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+		/* 38 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+		/* 40 */ 0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+		/* 48 */ 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+		/* 50 */ 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+		/* 58 */ 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 60 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 68 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 70 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 78 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 80 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 88 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 90 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 98 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+	};
+
+
+	const unsigned char REVERSE_HEX_ENCODING[256] =
+	{
+		/* 00 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 08 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 10 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 18 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 20 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 28 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 30 */ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		/* 38 */ 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+		/* 40 */ 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+		/* 48 */ 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+		/* 50 */ 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0xFF,
+		/* 58 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 60 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 68 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 70 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 78 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 80 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 88 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 90 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 98 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+	};
+
+
+	const unsigned char REVERSE_CROCKFORD_ENCODING[256] =
+	{
+		/* 00 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 08 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 10 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 18 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 20 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 28 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 30 */ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		/* 38 */ 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+		/* 40 */ 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+		/* 48 */ 0x11, 0x01, 0x12, 0x13, 0x01, 0x14, 0x15, 0x00,
+		/* 50 */ 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0x1B, 0x1C,
+		/* 58 */ 0x1D, 0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 60 */ 0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+		/* 68 */ 0x11, 0x01, 0x12, 0x13, 0x01, 0x14, 0x15, 0x00,
+		/* 70 */ 0x16, 0x17, 0x18, 0x19, 0x1A, 0xFF, 0x1B, 0x1C,
+		/* 78 */ 0x1D, 0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 80 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 88 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 90 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* 98 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* A8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* B8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* C8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* D8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* E8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F0 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		/* F8 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+	};
+
+
+	const unsigned char* reverseAlphabet(int options)
+	{
+		if ((options & BASE32_USE_HEX_ALPHABET) != 0)
+			return REVERSE_HEX_ENCODING;
+		else if ((options & BASE32_USE_CROCKFORD_ALPHABET) != 0)
+			return REVERSE_CROCKFORD_ENCODING;
+		else
+			return REVERSE_DEFAULT_ENCODING;
+	}
+
+
+	inline void encodeGroup(const unsigned char* in, char* out, const unsigned char* alphabet)
+	{
+		const UInt64 value =
+			(UInt64(in[0]) << 32) | (UInt64(in[1]) << 24) | (UInt64(in[2]) << 16) |
+			(UInt64(in[3]) << 8) | UInt64(in[4]);
+		for (int i = 0; i < 8; i++)
+		{
+			out[i] = static_cast<char>(alphabet[(value >> (35 - 5*i)) & 0x1F]);
+		}
+	}
+
+
+	inline std::size_t decodeGroup(const unsigned char* chars, unsigned char* out, const unsigned char* reverse)
+		/// Decodes a complete (possibly padded) group of eight
+		/// valid characters and returns the number of bytes.
+	{
+		UInt64 value = 0;
+		for (int i = 0; i < 8; i++)
+		{
+			value = (value << 5) | reverse[chars[i]];
+		}
+		std::size_t n = 5;
+		if (chars[2] == '=')
+			n = 1;
+		else if (chars[4] == '=')
+			n = 2;
+		else if (chars[5] == '=')
+			n = 3;
+		else if (chars[7] == '=')
+			n = 4;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			out[i] = static_cast<unsigned char>(value >> (32 - 8*i));
+		}
+		return n;
+	}
+}
+
+
+const unsigned char* Base32::alphabet(int options)
+{
+	if ((options & BASE32_USE_HEX_ALPHABET) != 0)
+		return HEX_ENCODING;
+	else if ((options & BASE32_USE_CROCKFORD_ALPHABET) != 0)
+		return CROCKFORD_ENCODING;
+	else
+		return DEFAULT_ENCODING;
+}
+
+
+std::size_t Base32::encodedLength(std::size_t length, int options)
+{
+	static const std::size_t PARTIAL_LENGTH[5] = {0, 2, 4, 5, 7};
+
+	if (options & BASE32_USE_PADDING)
+		return ((length + 4)/5)*8;
+	else
+		return (length/5)*8 + PARTIAL_LENGTH[length % 5];
+}
+
+
+std::size_t Base32::encode(const void* data, std::size_t length, char* output, int options)
+{
+	static const std::size_t PARTIAL_LENGTH[5] = {0, 2, 4, 5, 7};
+
+	const unsigned char* encoding = alphabet(options);
+	const unsigned char* in = static_cast<const unsigned char*>(data);
+	const unsigned char* end = in + length;
+	char* out = output;
+	while (end - in >= 5)
+	{
+		encodeGroup(in, out, encoding);
+		in += 5;
+		out += 8;
+	}
+	if (in < end)
+	{
+		const std::size_t rest = end - in;
+		unsigned char group[5] = {0, 0, 0, 0, 0};
+		for (std::size_t i = 0; i < rest; i++) group[i] = in[i];
+		char chars[8];
+		encodeGroup(group, chars, encoding);
+		const std::size_t n = PARTIAL_LENGTH[rest];
+		for (std::size_t i = 0; i < n; i++) *out++ = chars[i];
+		if (options & BASE32_USE_PADDING)
+		{
+			for (std::size_t i = n; i < 8; i++) *out++ = '=';
+		}
+	}
+	return out - output;
+}
+
+
+std::string Base32::encode(const std::string& data, int options)
+{
+	std::string result(encodedLength(data.size(), options), '\0');
+	result.resize(encode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+std::size_t Base32::decodedLength(std::size_t length)
+{
+	return ((length + 7)/8)*5;
+}
+
+
+std::size_t Base32::decode(const char* data, std::size_t length, void* output, int options)
+{
+	const char* it = data;
+	const char* end = data + length;
+	unsigned char* out = static_cast<unsigned char*>(output);
+	bool invalid = false;
+	std::size_t n = decodeBlocks(it, end, out, options, invalid);
+	if (invalid) throw DataFormatException("Invalid Base32 character");
+	return n + decodeFinal(it, end, out + n, options);
+}
+
+
+std::string Base32::decode(const std::string& data, int options)
+{
+	std::string result(decodedLength(data.size()), '\0');
+	result.resize(decode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+std::size_t Base32::decodeBlocks(const char*& it, const char* end, unsigned char* output, int options, bool& invalid)
+{
+	const unsigned char* reverse = reverseAlphabet(options);
+	unsigned char* out = output;
+	invalid = false;
+	while (end - it >= 8)
+	{
+		const unsigned char* chars = reinterpret_cast<const unsigned char*>(it);
+		for (int i = 0; i < 8; i++)
+		{
+			if (reverse[chars[i]] == 0xFF)
+			{
+				invalid = true;
+				return out - output;
+			}
+		}
+		out += decodeGroup(chars, out, reverse);
+		it += 8;
+	}
+	return out - output;
+}
+
+
+std::size_t Base32::decodeFinal(const char* it, const char* end, unsigned char* output, int options)
+{
+	// Per RFC 4648, Section 6, permissible group lengths
+	// are 2, 4, 5, 7 and 8 characters.
+	static const bool PERMISSIBLE[8] = {true, false, true, false, true, true, false, true};
+
+	const unsigned char* reverse = reverseAlphabet(options);
+	const std::size_t n = end - it;
+	poco_assert_dbg (n < 8);
+	unsigned char chars[8] = {'=', '=', '=', '=', '=', '=', '=', '='};
+	for (std::size_t i = 0; i < n; i++)
+	{
+		chars[i] = static_cast<unsigned char>(it[i]);
+		if (reverse[chars[i]] == 0xFF) throw DataFormatException("Invalid Base32 character");
+	}
+	if (!PERMISSIBLE[n]) throw DataFormatException("Incomplete Base32 group");
+	if (n == 0) return 0;
+	return decodeGroup(chars, output, reverse);
+}
+
+
+} // namespace Poco
@@ -13,43 +13,16 @@
 
 
 #include "Poco/Base32Encoder.h"
+#include "Poco/Base32.h"
 
 
 namespace Poco {
 
 
-const unsigned char Base32EncoderBuf::DEFAULT_ENCODING[32] =
-{
-	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-	'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-	'Y', 'Z', '2', '3', '4', '5', '6', '7'
-};
-
-
-const unsigned char Base32EncoderBuf::HEX_ENCODING[32] =
-{
-	'0', '1', '2', '3', '4', '5', '6', '7',
-	'8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
-	'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 
-	'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V'
-};
-
-
-const unsigned char Base32EncoderBuf::CROCKFORD_ENCODING[32] =
-{
-	'0', '1', '2', '3', '4', '5', '6', '7',
-	'8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
-	'G', 'H', 'J', 'K', 'M', 'N', 'P', 'Q',
-	'R', 'S', 'T', 'V', 'W', 'X', 'Y', 'Z'
-};
-
-
 Base32EncoderBuf::Base32EncoderBuf(std::ostream& ostr, int options):
 	_groupLength(0),
 	_buf(*ostr.rdbuf()),
-	_doPadding((options & BASE32_USE_PADDING) != 0),
-	_encoding(encoding(options))
+	_options(options)
 {
 }
 
@@ -73,126 +46,74 @@ int Base32EncoderBuf::writeToDevice(char c)
 	_group[_groupLength++] = (unsigned char) c;
 	if (_groupLength == 5)
 	{
-		unsigned char idx;
-		idx = _group[0] >> 3;
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x07) << 2) | (_group[1] >> 6);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x3E) >> 1);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x01) << 4) | (_group[2] >> 4);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[2] & 0x0F) << 1) | (_group[3] >> 7);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[3] & 0x7C) >> 2);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[3] & 0x03) << 3) | (_group[4] >> 5);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = (_group[4] & 0x1F);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
 		_groupLength = 0;
+		if (writeGroups(_group, 1) == eof) return eof;
 	}
 	return charToInt(c);
 }
 
 
-int Base32EncoderBuf::close()
+std::streamsize Base32EncoderBuf::xsputn(const char* s, std::streamsize n)
 {
 	static const int eof = std::char_traits<char>::eof();
 
-	if (sync() == eof) return eof;
-	if (_groupLength == 1)
+	std::streamsize i = 0;
+	while (_groupLength > 0 && i < n)
 	{
-		_group[1] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 3;
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x07) << 2);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		if (_doPadding) 
-		{
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-		}
+		if (writeToDevice(s[i]) == eof) return i;
+		++i;
 	}
-	else if (_groupLength == 2)
+	const std::streamsize groups = (n - i)/5;
+	if (groups > 0)
 	{
-		_group[2] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 3;
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x07) << 2) | (_group[1] >> 6);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x3E) >> 1);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x01) << 4);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		if (_doPadding) 
-		{
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-		}
+		if (writeGroups(reinterpret_cast<const unsigned char*>(s + i), groups) == eof) return i;
+		i += groups*5;
 	}
-	else if (_groupLength == 3)
+	while (i < n)
+	{
+		_group[_groupLength++] = static_cast<unsigned char>(s[i++]);
+	}
+	return n;
+}
+
+
+int Base32EncoderBuf::writeGroups(const unsigned char* data, std::streamsize groups)
+{
+	static const int eof = std::char_traits<char>::eof();
+	static const std::streamsize MAX_GROUPS = 128;
+
+	char buffer[MAX_GROUPS*8];
+	while (groups > 0)
 	{
-		_group[3] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 3;
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x07) << 2) | (_group[1] >> 6);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x3E) >> 1);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x01) << 4) | (_group[2] >> 4);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[2] & 0x0F) << 1);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		if (_doPadding) 
-		{
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-		}
+		const std::streamsize n = groups < MAX_GROUPS ? groups : MAX_GROUPS;
+		const std::streamsize length = static_cast<std::streamsize>(Base32::encode(data, static_cast<std::size_t>(n*5), buffer, _options));
+		if (_buf.sputn(buffer, length) != length) return eof;
+		data += n*5;
+		groups -= n;
 	}
-	else if (_groupLength == 4)
+	return 0;
+}
+
+
+int Base32EncoderBuf::close()
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	if (sync() == eof) return eof;
+	if (_groupLength > 0)
 	{
-		_group[4] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 3;
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x07) << 2) | (_group[1] >> 6);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x3E) >> 1);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x01) << 4) | (_group[2] >> 4);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[2] & 0x0F) << 1) | (_group[3] >> 7);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[3] & 0x7C) >> 2);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		idx = ((_group[3] & 0x03) << 3);
-		if (_buf.sputc(_encoding[idx]) == eof) return eof;
-		if (_doPadding && _buf.sputc('=') == eof) return eof;
+		char buffer[8];
+		const std::streamsize length = static_cast<std::streamsize>(Base32::encode(_group, _groupLength, buffer, _options));
+		_groupLength = 0;
+		if (_buf.sputn(buffer, length) != length) return eof;
 	}
-	_groupLength = 0;
 	return _buf.pubsync();
 }
 
 
 const unsigned char* Base32EncoderBuf::encoding(int options)
 {
-	if ((options & BASE32_USE_HEX_ALPHABET) != 0)
-		return HEX_ENCODING;
-	else if ((options & BASE32_USE_CROCKFORD_ALPHABET) != 0)
-		return CROCKFORD_ENCODING;
-	else
-		return DEFAULT_ENCODING;
+	return Base32::alphabet(options);
 }
 
 
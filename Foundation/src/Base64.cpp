@@ -0,0 +1,510 @@
+//
+// Base64.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  Base64
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Base64.h"
+#include "Poco/CPUFeatures.h"
+#include "Poco/Exception.h"
+#include <cstring>
+#if defined(POCO_CPU_X86)
+#include <immintrin.h>
+#elif defined(POCO_CPU_NEON)
+#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	constexpr char ENCODING[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	constexpr char ENCODING_URL[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+
+	struct DecodingTable
+		/// Maps characters to their 6-bit values, or to 0xFF for
+		/// characters not in the alphabet (including the padding
+		/// character, which is handled separately).
+	{
+		constexpr DecodingTable(const char* alphabet): values()
+		{
+			for (int i = 0; i < 256; i++) values[i] = 0xFF;
+			for (int i = 0; i < 64; i++) values[static_cast<unsigned char>(alphabet[i])] = static_cast<UInt8>(i);
+		}
+
+		UInt8 values[256];
+	};
+
+
+	constexpr DecodingTable DECODING(ENCODING);
+	constexpr DecodingTable DECODING_URL(ENCODING_URL);
+
+
+	inline bool isWhitespace(char c)
+	{
+		return c == ' ' || c == '\r' || c == '\t' || c == '\n';
+	}
+
+
+	inline void encodeGroup(const unsigned char* in, char* out, const char* alphabet)
+	{
+		out[0] = alphabet[in[0] >> 2];
+		out[1] = alphabet[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+		out[2] = alphabet[((in[1] & 0x0F) << 2) | (in[2] >> 6)];
+		out[3] = alphabet[in[2] & 0x3F];
+	}
+
+
+#if defined(POCO_CPU_X86)
+
+
+	//
+	// The x86 kernels follow W. Mula and D. Lemire, "Faster Base64 Encoding
+	// and Decoding Using AVX2 Instructions", ACM TWEB 12(3), 2018.
+	//
+
+
+	POCO_TARGET("ssse3")
+	void encodeSSSE3(const unsigned char*& in, const unsigned char* end, char*& out, bool url)
+		/// Encodes 12 bytes per iteration. Reads 16 bytes,
+		/// so at least 4 bytes must follow the last block.
+	{
+		const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+		const __m128i mask0 = _mm_set1_epi32(0x0FC0FC00);
+		const __m128i mul0 = _mm_set1_epi32(0x04000040);
+		const __m128i mask1 = _mm_set1_epi32(0x003F03F0);
+		const __m128i mul1 = _mm_set1_epi32(0x01000010);
+		const __m128i shiftLUT = _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, (url ? '-' : '+') - 62, (url ? '_' : '/') - 63, 'A', 0, 0);
+		while (end - in >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+			v = _mm_shuffle_epi8(v, shuffle);
+			const __m128i indices = _mm_or_si128(
+				_mm_mulhi_epu16(_mm_and_si128(v, mask0), mul0),
+				_mm_mullo_epi16(_mm_and_si128(v, mask1), mul1));
+			__m128i shift = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+			const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+			shift = _mm_or_si128(shift, _mm_and_si128(less, _mm_set1_epi8(13)));
+			shift = _mm_shuffle_epi8(shiftLUT, shift);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_add_epi8(shift, indices));
+			in += 12;
+			out += 16;
+		}
+	}
+
+
+	POCO_TARGET("avx2")
+	void encodeAVX2(const unsigned char*& in, const unsigned char* end, char*& out, bool url)
+		/// Encodes 24 bytes per iteration. Reads 28 bytes,
+		/// so at least 4 bytes must follow the last block.
+	{
+		const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+		const __m256i mask0 = _mm256_set1_epi32(0x0FC0FC00);
+		const __m256i mul0 = _mm256_set1_epi32(0x04000040);
+		const __m256i mask1 = _mm256_set1_epi32(0x003F03F0);
+		const __m256i mul1 = _mm256_set1_epi32(0x01000010);
+		const __m256i shiftLUT = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, (url ? '-' : '+') - 62, (url ? '_' : '/') - 63, 'A', 0, 0));
+		while (end - in >= 28)
+		{
+			const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+			const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 12));
+			__m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+			v = _mm256_shuffle_epi8(v, shuffle);
+			const __m256i indices = _mm256_or_si256(
+				_mm256_mulhi_epu16(_mm256_and_si256(v, mask0), mul0),
+				_mm256_mullo_epi16(_mm256_and_si256(v, mask1), mul1));
+			__m256i shift = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+			const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+			shift = _mm256_or_si256(shift, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+			shift = _mm256_shuffle_epi8(shiftLUT, shift);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi8(shift, indices));
+			in += 24;
+			out += 32;
+		}
+	}
+
+
+	POCO_TARGET("ssse3")
+	void decodeSSSE3(const char*& in, const char* end, unsigned char*& out, bool url)
+		/// Decodes 16 characters per iteration. Stops at the first
+		/// block containing a character outside the alphabet.
+	{
+		const __m128i lutLo = _mm_setr_epi8(
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+		const __m128i lutHi = _mm_setr_epi8(
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+		const __m128i lutRoll = _mm_setr_epi8(
+			0, 16, 19, 4, -65, -65, -71, -71,
+			0, 0, 0, 0, 0, 0, 0, 0);
+		const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+		const __m128i plus = _mm_set1_epi8('+');
+		const __m128i slash = _mm_set1_epi8('/');
+		const __m128i minus = _mm_set1_epi8('-');
+		const __m128i underscore = _mm_set1_epi8('_');
+		const __m128i merge0 = _mm_set1_epi32(0x01400140);
+		const __m128i merge1 = _mm_set1_epi32(0x00011000);
+		const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+		while (end - in >= 16)
+		{
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+			if (url)
+			{
+				if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, plus), _mm_cmpeq_epi8(v, slash)))) break;
+				const __m128i isMinus = _mm_cmpeq_epi8(v, minus);
+				const __m128i isUnderscore = _mm_cmpeq_epi8(v, underscore);
+				v = _mm_or_si128(
+					_mm_andnot_si128(_mm_or_si128(isMinus, isUnderscore), v),
+					_mm_or_si128(_mm_and_si128(isMinus, plus), _mm_and_si128(isUnderscore, slash)));
+			}
+			const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(v, 4), nibbleMask);
+			const __m128i loNibbles = _mm_and_si128(v, nibbleMask);
+			const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+			const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xFFFF) break;
+			const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(v, slash), hiNibbles));
+			v = _mm_add_epi8(v, roll);
+			v = _mm_madd_epi16(_mm_maddubs_epi16(v, merge0), merge1);
+			v = _mm_shuffle_epi8(v, pack);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out), v);
+			const int last = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+			std::memcpy(out + 8, &last, 4);
+			in += 16;
+			out += 12;
+		}
+	}
+
+
+	POCO_TARGET("avx2")
+	void decodeAVX2(const char*& in, const char* end, unsigned char*& out, bool url)
+		/// Decodes 32 characters per iteration. Stops at the first
+		/// block containing a character outside the alphabet.
+	{
+		const __m256i lutLo = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+			0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+		const __m256i lutHi = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+			0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+		const __m256i lutRoll = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			0, 16, 19, 4, -65, -65, -71, -71,
+			0, 0, 0, 0, 0, 0, 0, 0));
+		const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+		const __m256i plus = _mm256_set1_epi8('+');
+		const __m256i slash = _mm256_set1_epi8('/');
+		const __m256i minus = _mm256_set1_epi8('-');
+		const __m256i underscore = _mm256_set1_epi8('_');
+		const __m256i merge0 = _mm256_set1_epi32(0x01400140);
+		const __m256i merge1 = _mm256_set1_epi32(0x00011000);
+		const __m256i pack = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+		const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+		while (end - in >= 32)
+		{
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+			if (url)
+			{
+				if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, plus), _mm256_cmpeq_epi8(v, slash)))) break;
+				const __m256i isMinus = _mm256_cmpeq_epi8(v, minus);
+				const __m256i isUnderscore = _mm256_cmpeq_epi8(v, underscore);
+				v = _mm256_or_si256(
+					_mm256_andnot_si256(_mm256_or_si256(isMinus, isUnderscore), v),
+					_mm256_or_si256(_mm256_and_si256(isMinus, plus), _mm256_and_si256(isUnderscore, slash)));
+			}
+			const __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), nibbleMask);
+			const __m256i loNibbles = _mm256_and_si256(v, nibbleMask);
+			const __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+			const __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+			if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256())) != -1) break;
+			const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(v, slash), hiNibbles));
+			v = _mm256_add_epi8(v, roll);
+			v = _mm256_madd_epi16(_mm256_maddubs_epi16(v, merge0), merge1);
+			v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, pack), compact);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(v));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(v, 1));
+			in += 32;
+			out += 24;
+		}
+	}
+
+
+#elif defined(POCO_CPU_NEON)
+
+
+	void encodeNEON(const unsigned char*& in, const unsigned char* end, char*& out, const char* alphabet)
+		/// Encodes 48 bytes per iteration.
+	{
+		const uint8_t* pAlphabet = reinterpret_cast<const uint8_t*>(alphabet);
+		uint8x16x4_t table;
+		table.val[0] = vld1q_u8(pAlphabet);
+		table.val[1] = vld1q_u8(pAlphabet + 16);
+		table.val[2] = vld1q_u8(pAlphabet + 32);
+		table.val[3] = vld1q_u8(pAlphabet + 48);
+		const uint8x16_t mask = vdupq_n_u8(0x3F);
+		while (end - in >= 48)
+		{
+			const uint8x16x3_t v = vld3q_u8(in);
+			uint8x16x4_t r;
+			r.val[0] = vshrq_n_u8(v.val[0], 2);
+			r.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), mask);
+			r.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), mask);
+			r.val[3] = vandq_u8(v.val[2], mask);
+			r.val[0] = vqtbl4q_u8(table, r.val[0]);
+			r.val[1] = vqtbl4q_u8(table, r.val[1]);
+			r.val[2] = vqtbl4q_u8(table, r.val[2]);
+			r.val[3] = vqtbl4q_u8(table, r.val[3]);
+			vst4q_u8(reinterpret_cast<uint8_t*>(out), r);
+			in += 48;
+			out += 64;
+		}
+	}
+
+
+	void decodeNEON(const char*& in, const char* end, unsigned char*& out, const UInt8* decoding)
+		/// Decodes 64 characters per iteration. Stops at the first
+		/// block containing a character outside the alphabet.
+	{
+		uint8x16x4_t tableLo;
+		tableLo.val[0] = vld1q_u8(decoding);
+		tableLo.val[1] = vld1q_u8(decoding + 16);
+		tableLo.val[2] = vld1q_u8(decoding + 32);
+		tableLo.val[3] = vld1q_u8(decoding + 48);
+		uint8x16x4_t tableHi;
+		tableHi.val[0] = vld1q_u8(decoding + 64);
+		tableHi.val[1] = vld1q_u8(decoding + 80);
+		tableHi.val[2] = vld1q_u8(decoding + 96);
+		tableHi.val[3] = vld1q_u8(decoding + 112);
+		const uint8x16_t offset = vdupq_n_u8(0x40);
+		while (end - in >= 64)
+		{
+			uint8x16x4_t v = vld4q_u8(reinterpret_cast<const uint8_t*>(in));
+			uint8x16_t error = vdupq_n_u8(0);
+			for (int i = 0; i < 4; i++)
+			{
+				// Characters 0x00-0x3F are looked up in the first table,
+				// 0x40-0x7F in the second; anything above stays 0 and is
+				// caught by the sign bit of the character itself.
+				uint8x16_t d = vqtbl4q_u8(tableLo, v.val[i]);
+				d = vqtbx4q_u8(d, tableHi, veorq_u8(v.val[i], offset));
+				error = vorrq_u8(error, vorrq_u8(d, v.val[i]));
+				v.val[i] = d;
+			}
+			if (vmaxvq_u8(error) & 0x80) break;
+			uint8x16x3_t r;
+			r.val[0] = vorrq_u8(vshlq_n_u8(v.val[0], 2), vshrq_n_u8(v.val[1], 4));
+			r.val[1] = vorrq_u8(vshlq_n_u8(v.val[1], 4), vshrq_n_u8(v.val[2], 2));
+			r.val[2] = vorrq_u8(vshlq_n_u8(v.val[2], 6), v.val[3]);
+			vst3q_u8(out, r);
+			in += 64;
+			out += 48;
+		}
+	}
+
+
+#endif
+}
+
+
+std::size_t Base64::encodedLength(std::size_t length, int options)
+{
+	if (options & BASE64_NO_PADDING)
+		return (length/3)*4 + (length % 3 ? length % 3 + 1 : 0);
+	else
+		return ((length + 2)/3)*4;
+}
+
+
+std::size_t Base64::encode(const void* data, std::size_t length, char* output, int options)
+{
+	const bool url = (options & BASE64_URL_ENCODING) != 0;
+	const char* alphabet = url ? ENCODING_URL : ENCODING;
+	const unsigned char* in = static_cast<const unsigned char*>(data);
+	const unsigned char* end = in + length;
+	char* out = output;
+
+#if defined(POCO_CPU_X86)
+	if (length >= 16)
+	{
+		if (CPUFeatures::hasAVX2())
+			encodeAVX2(in, end, out, url);
+		if (CPUFeatures::hasSSSE3())
+			encodeSSSE3(in, end, out, url);
+	}
+#elif defined(POCO_CPU_NEON)
+	encodeNEON(in, end, out, alphabet);
+#endif
+
+	while (end - in >= 3)
+	{
+		encodeGroup(in, out, alphabet);
+		in += 3;
+		out += 4;
+	}
+	if (in < end)
+	{
+		unsigned char group[3] = {in[0], 0, 0};
+		if (end - in == 2) group[1] = in[1];
+		char chars[4];
+		encodeGroup(group, chars, alphabet);
+		*out++ = chars[0];
+		*out++ = chars[1];
+		if (end - in == 2) *out++ = chars[2];
+		if (!(options & BASE64_NO_PADDING))
+		{
+			if (end - in == 1) *out++ = '=';
+			*out++ = '=';
+		}
+	}
+	return out - output;
+}
+
+
+std::string Base64::encode(const std::string& data, int options)
+{
+	std::string result(encodedLength(data.size(), options), '\0');
+	result.resize(encode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+std::size_t Base64::decodedLength(std::size_t length)
+{
+	return ((length + 3)/4)*3;
+}
+
+
+std::size_t Base64::decode(const char* data, std::size_t length, void* output, int options)
+{
+	const char* it = data;
+	const char* end = data + length;
+	unsigned char* out = static_cast<unsigned char*>(output);
+	bool invalid = false;
+	std::size_t n = decodeBlocks(it, end, out, options, invalid);
+	if (invalid) throw DataFormatException("Invalid Base64 character");
+	return n + decodeFinal(it, end, out + n, options);
+}
+
+
+std::string Base64::decode(const std::string& data, int options)
+{
+	std::string result(decodedLength(data.size()), '\0');
+	result.resize(decode(data.data(), data.size(), result.data(), options));
+	return result;
+}
+
+
+std::size_t Base64::decodeBlocks(const char*& it, const char* end, unsigned char* output, int options, bool& invalid)
+{
+	const bool url = (options & BASE64_URL_ENCODING) != 0;
+	const UInt8* decoding = url ? DECODING_URL.values : DECODING.values;
+#if defined(POCO_CPU_X86)
+	const bool avx2 = CPUFeatures::hasAVX2();
+	const bool ssse3 = CPUFeatures::hasSSSE3();
+#endif
+	unsigned char* out = output;
+	invalid = false;
+	while (it < end)
+	{
+		// Vector kernels stop at padding, whitespace or invalid characters;
+		// the scalar loop below handles one group and then hands back.
+#if defined(POCO_CPU_X86)
+		if (end - it >= 16)
+		{
+			if (avx2) decodeAVX2(it, end, out, url);
+			if (ssse3) decodeSSSE3(it, end, out, url);
+		}
+#elif defined(POCO_CPU_NEON)
+		decodeNEON(it, end, out, decoding);
+#endif
+
+		if (!url)
+		{
+			while (it < end && isWhitespace(*it)) ++it;
+		}
+		const char* groupStart = it;
+		unsigned char chars[4];
+		UInt32 value = 0;
+		int n = 0;
+		while (n < 4 && it < end)
+		{
+			const unsigned char c = static_cast<unsigned char>(*it++);
+			if (!url && isWhitespace(c)) continue;
+			UInt8 v = 0;
+			if (c != '=')
+			{
+				v = decoding[c];
+				if (v == 0xFF)
+				{
+					invalid = true;
+					it = groupStart;
+					return out - output;
+				}
+			}
+			chars[n++] = c;
+			value = (value << 6) | v;
+		}
+		if (n < 4)
+		{
+			it = groupStart;
+			break;
+		}
+		*out++ = static_cast<unsigned char>(value >> 16);
+		if (chars[2] != '=')
+		{
+			*out++ = static_cast<unsigned char>(value >> 8);
+			if (chars[3] != '=')
+				*out++ = static_cast<unsigned char>(value);
+		}
+	}
+	return out - output;
+}
+
+
+std::size_t Base64::decodeFinal(const char* it, const char* end, unsigned char* output, int options)
+{
+	const bool url = (options & BASE64_URL_ENCODING) != 0;
+	const UInt8* decoding = url ? DECODING_URL.values : DECODING.values;
+	unsigned char chars[4] = {'=', '=', '=', '='};
+	int n = 0;
+	for (; it < end; ++it)
+	{
+		const unsigned char c = static_cast<unsigned char>(*it);
+		if (!url && isWhitespace(c)) continue;
+		if (c != '=' && decoding[c] == 0xFF) throw DataFormatException("Invalid Base64 character");
+		poco_assert_dbg (n < 3);
+		chars[n++] = c;
+	}
+
+	// A single trailing character cannot encode a byte and is ignored.
+	if (n < 2) return 0;
+	if (!(options & BASE64_NO_PADDING)) throw DataFormatException("Incomplete Base64 group");
+
+	UInt32 value = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		value = (value << 6) | (chars[i] == '=' ? 0 : decoding[chars[i]]);
+	}
+	value <<= 6;
+	output[0] = static_cast<unsigned char>(value >> 16);
+	if (chars[2] == '=') return 1;
+	output[1] = static_cast<unsigned char>(value >> 8);
+	return 2;
+}
+
+
+} // namespace Poco
@@ -13,66 +13,21 @@
 
 
 #include "Poco/Base64Decoder.h"
-#include "Poco/Base64Encoder.h"
+#include "Poco/Base64.h"
 #include "Poco/Exception.h"
-#include "Poco/Mutex.h"
 
 
 namespace Poco {
 
 
-unsigned char Base64DecoderBuf::IN_ENCODING[256];
-bool Base64DecoderBuf::IN_ENCODING_INIT = false;
-unsigned char Base64DecoderBuf::IN_ENCODING_URL[256];
-bool Base64DecoderBuf::IN_ENCODING_URL_INIT = false;
-
-
-namespace
-{
-	static FastMutex mutex;
-}
-
-
 Base64DecoderBuf::Base64DecoderBuf(std::istream& istr, int options):
+	BufferedStreamBuf(BUFFER_SIZE, std::ios::in),
 	_options(options),
-	_groupLength(0),
-	_groupIndex(0),
 	_buf(*istr.rdbuf()),
-	_pInEncoding((options & BASE64_URL_ENCODING) ? IN_ENCODING_URL : IN_ENCODING)
+	_pending(0),
+	_eof(false),
+	_error(false)
 {
-	FastMutex::ScopedLock lock(mutex);
-	if (options & BASE64_URL_ENCODING)
-	{
-		if (!IN_ENCODING_URL_INIT)
-		{
-			for (unsigned i = 0; i < sizeof(IN_ENCODING_URL); i++)
-			{
-				IN_ENCODING_URL[i] = 0xFF;
-			}
-			for (unsigned i = 0; i < sizeof(Base64EncoderBuf::OUT_ENCODING_URL); i++)
-			{
-				IN_ENCODING_URL[Base64EncoderBuf::OUT_ENCODING_URL[i]] = static_cast<UInt8>(i);
-			}
-			IN_ENCODING_URL[static_cast<unsigned char>('=')] = '\0';
-			IN_ENCODING_URL_INIT = true;
-		}
-	}
-	else
-	{
-		if (!IN_ENCODING_INIT)
-		{
-			for (unsigned i = 0; i < sizeof(IN_ENCODING); i++)
-			{
-				IN_ENCODING[i] = 0xFF;
-			}
-			for (unsigned i = 0; i < sizeof(Base64EncoderBuf::OUT_ENCODING); i++)
-			{
-				IN_ENCODING[Base64EncoderBuf::OUT_ENCODING[i]] = static_cast<UInt8>(i);
-			}
-			IN_ENCODING[static_cast<unsigned char>('=')] = '\0';
-			IN_ENCODING_INIT = true;
-		}
-	}
 }
 
 
@@ -81,70 +36,41 @@ Base64DecoderBuf::~Base64DecoderBuf()
 }
 
 
-int Base64DecoderBuf::readFromDevice()
+std::streamsize Base64DecoderBuf::readFromDevice(char* buffer, std::streamsize length)
 {
-	if (_groupIndex < _groupLength)
-	{
-		return _group[_groupIndex++];
-	}
-	else
+	if (_error) throw DataFormatException("Invalid Base64 character");
+
+	unsigned char* output = reinterpret_cast<unsigned char*>(buffer);
+	std::size_t n = 0;
+	while (n == 0 && !_eof)
 	{
-		unsigned char buffer[4];
-		int c;
-		if ((c = readOne()) == -1) return -1;
-		buffer[0] = static_cast<UInt8>(c);
-		if (_pInEncoding[buffer[0]] == 0xFF) throw DataFormatException();
-		if ((c = readOne()) == -1) return -1;
-		buffer[1] = static_cast<UInt8>(c);
-		if (_pInEncoding[buffer[1]] == 0xFF) throw DataFormatException();
-		if (_options & BASE64_NO_PADDING)
+		// _input starts with the characters of an incomplete group
+		// left over from the previous block.
+		std::streamsize maxInput = (length/3)*4;
+		if (maxInput > BUFFER_SIZE) maxInput = BUFFER_SIZE;
+		const std::streamsize nRead = _buf.sgetn(_input + _pending, maxInput - _pending);
+		if (nRead <= 0)
 		{
-			if ((c = readOne()) != -1)
-				buffer[2] = static_cast<UInt8>(c);
-			else
-				buffer[2] = '=';
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) != -1)
-				buffer[3] = static_cast<UInt8>(c);
-			else
-				buffer[3] = '=';
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+			_eof = true;
+			return static_cast<std::streamsize>(Base64::decodeFinal(_input, _input + _pending, output, _options));
 		}
-		else
+
+		const char* it = _input;
+		const char* end = _input + _pending + nRead;
+		n = Base64::decodeBlocks(it, end, output, _options, _error);
+		if (_error)
 		{
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[2] = static_cast<UInt8>(c);
-			if (_pInEncoding[buffer[2]] == 0xFF) throw DataFormatException();
-			if ((c = readOne()) == -1) throw DataFormatException();
-			buffer[3] = static_cast<UInt8>(c);
-			if (_pInEncoding[buffer[3]] == 0xFF) throw DataFormatException();
+			if (n == 0) throw DataFormatException("Invalid Base64 character");
+			break;
+		}
+		_pending = 0;
+		for (; it < end; ++it)
+		{
+			if (*it != ' ' && *it != '\r' && *it != '\t' && *it != '\n')
+				_input[_pending++] = *it;
 		}
-
-		_group[0] = (_pInEncoding[buffer[0]] << 2) | (_pInEncoding[buffer[1]] >> 4);
-		_group[1] = ((_pInEncoding[buffer[1]] & 0x0F) << 4) | (_pInEncoding[buffer[2]] >> 2);
-		_group[2] = (_pInEncoding[buffer[2]] << 6) | _pInEncoding[buffer[3]];
-
-		if (buffer[2] == '=')
-			_groupLength = 1;
-		else if (buffer[3] == '=')
-			_groupLength = 2;
-		else
-			_groupLength = 3;
-		_groupIndex = 1;
-		return _group[0];
-	}
-}
-
-
-int Base64DecoderBuf::readOne()
-{
-	int ch = _buf.sbumpc();
-	if (!(_options & BASE64_URL_ENCODING))
-	{
-		while (ch == ' ' || ch == '\r' || ch == '\t' || ch == '\n')
-			ch = _buf.sbumpc();
 	}
-	return ch;
+	return static_cast<std::streamsize>(n);
 }
 
 
@@ -13,44 +13,18 @@
 
 
 #include "Poco/Base64Encoder.h"
+#include "Poco/Base64.h"
 
 
 namespace Poco {
 
 
-const unsigned char Base64EncoderBuf::OUT_ENCODING[64] =
-{
-	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-	'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-	'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-	'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-	'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-	'w', 'x', 'y', 'z', '0', '1', '2', '3',
-	'4', '5', '6', '7', '8', '9', '+', '/'
-};
-
-
-const unsigned char Base64EncoderBuf::OUT_ENCODING_URL[64] =
-{
-	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-	'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-	'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-	'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-	'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-	'w', 'x', 'y', 'z', '0', '1', '2', '3',
-	'4', '5', '6', '7', '8', '9', '-', '_'
-};
-
-
 Base64EncoderBuf::Base64EncoderBuf(std::ostream& ostr, int options):
 	_options(options),
 	_groupLength(0),
 	_pos(0),
 	_lineLength((options & BASE64_URL_ENCODING) ? 0 : 72),
-	_buf(*ostr.rdbuf()),
-	_pOutEncoding((options & BASE64_URL_ENCODING) ? OUT_ENCODING_URL : OUT_ENCODING)
+	_buf(*ostr.rdbuf())
 {
 }
 
@@ -86,63 +60,81 @@ int Base64EncoderBuf::writeToDevice(char c)
 	_group[_groupLength++] = (unsigned char) c;
 	if (_groupLength == 3)
 	{
-		unsigned char idx;
-		idx = _group[0] >> 2;
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x03) << 4) | (_group[1] >> 4);
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x0F) << 2) | (_group[2] >> 6);
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = _group[2] & 0x3F;
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		_pos += 4;
-		if (_lineLength > 0 && _pos >= _lineLength)
-		{
-			if (_buf.sputc('\r') == eof) return eof;
-			if (_buf.sputc('\n') == eof) return eof;
-			_pos = 0;
-		}
 		_groupLength = 0;
+		if (writeGroups(_group, 1) == eof) return eof;
 	}
 	return charToInt(c);
 }
 
 
-int Base64EncoderBuf::close()
+std::streamsize Base64EncoderBuf::xsputn(const char* s, std::streamsize n)
 {
 	static const int eof = std::char_traits<char>::eof();
 
-	if (sync() == eof) return eof;
-	if (_groupLength == 1)
+	std::streamsize i = 0;
+	while (_groupLength > 0 && i < n)
 	{
-		_group[1] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 2;
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x03) << 4) | (_group[1] >> 4);
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		if (!(_options & BASE64_NO_PADDING))
-		{
-			if (_buf.sputc('=') == eof) return eof;
-			if (_buf.sputc('=') == eof) return eof;
-		}
+		if (writeToDevice(s[i]) == eof) return i;
+		++i;
 	}
-	else if (_groupLength == 2)
+	const std::streamsize groups = (n - i)/3;
+	if (groups > 0)
 	{
-		_group[2] = 0;
-		unsigned char idx;
-		idx = _group[0] >> 2;
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = ((_group[0] & 0x03) << 4) | (_group[1] >> 4);
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		idx = ((_group[1] & 0x0F) << 2) | (_group[2] >> 6);
-		if (_buf.sputc(_pOutEncoding[idx]) == eof) return eof;
-		if (!(_options & BASE64_NO_PADDING))
+		if (writeGroups(reinterpret_cast<const unsigned char*>(s + i), groups) == eof) return i;
+		i += groups*3;
+	}
+	while (i < n)
+	{
+		_group[_groupLength++] = static_cast<unsigned char>(s[i++]);
+	}
+	return n;
+}
+
+
+int Base64EncoderBuf::writeGroups(const unsigned char* data, std::streamsize groups)
+{
+	static const int eof = std::char_traits<char>::eof();
+	static const std::streamsize MAX_GROUPS = 256;
+
+	char buffer[MAX_GROUPS*4 + 2];
+	while (groups > 0)
+	{
+		std::streamsize n = groups < MAX_GROUPS ? groups : MAX_GROUPS;
+		if (_lineLength > 0)
 		{
-			if (_buf.sputc('=') == eof) return eof;
+			// A line break follows the group that reaches the line length.
+			std::streamsize lineGroups = (_lineLength - _pos + 3)/4;
+			if (lineGroups < 1) lineGroups = 1;
+			if (n > lineGroups) n = lineGroups;
 		}
+		std::streamsize length = static_cast<std::streamsize>(Base64::encode(data, static_cast<std::size_t>(n*3), buffer, _options));
+		_pos += static_cast<int>(length);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			buffer[length++] = '\r';
+			buffer[length++] = '\n';
+			_pos = 0;
+		}
+		if (_buf.sputn(buffer, length) != length) return eof;
+		data += n*3;
+		groups -= n;
+	}
+	return 0;
+}
+
+
+int Base64EncoderBuf::close()
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	if (sync() == eof) return eof;
+	if (_groupLength > 0)
+	{
+		char buffer[4];
+		const std::streamsize length = static_cast<std::streamsize>(Base64::encode(_group, _groupLength, buffer, _options));
+		_groupLength = 0;
+		if (_buf.sputn(buffer, length) != length) return eof;
 	}
-	_groupLength = 0;
 	return _buf.pubsync();
 }
 
@@ -0,0 +1,124 @@
+//
+// CPUFeatures.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  CPUFeatures
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CPUFeatures.h"
+#if defined(POCO_CPU_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#elif defined(POCO_CPU_X86)
+#include <cpuid.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	struct Features
+	{
+		bool ssse3 = false;
+		bool sse42 = false;
+		bool pclmul = false;
+		bool avx2 = false;
+		bool sha = false;
+		bool neon = false;
+	};
+
+
+	Features detectFeatures()
+	{
+		Features features;
+#if defined(POCO_CPU_X86)
+	#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		const int maxLeaf = info[0];
+		__cpuid(info, 1);
+		features.ssse3 = (info[2] & (1 << 9)) != 0;
+		features.sse42 = (info[2] & (1 << 20)) != 0;
+		features.pclmul = (info[2] & (1 << 1)) != 0;
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (maxLeaf >= 7)
+		{
+			__cpuidex(info, 7, 0);
+			features.avx2 = osxsave && avx && (_xgetbv(0) & 0x06) == 0x06 && (info[1] & (1 << 5)) != 0;
+			features.sha = (info[1] & (1 << 29)) != 0;
+		}
+	#else
+		__builtin_cpu_init();
+		features.ssse3 = __builtin_cpu_supports("ssse3") != 0;
+		features.sse42 = __builtin_cpu_supports("sse4.2") != 0;
+		features.pclmul = __builtin_cpu_supports("pclmul") != 0;
+		features.avx2 = __builtin_cpu_supports("avx2") != 0;
+		unsigned eax = 0;
+		unsigned ebx = 0;
+		unsigned ecx = 0;
+		unsigned edx = 0;
+		if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+			features.sha = (ebx & (1u << 29)) != 0;
+	#endif
+#elif defined(POCO_CPU_NEON)
+		features.neon = true;
+#endif
+		return features;
+	}
+
+
+	const Features& features()
+	{
+		static const Features features = detectFeatures();
+		return features;
+	}
+}
+
+
+bool CPUFeatures::hasSSSE3()
+{
+	return features().ssse3;
+}
+
+
+bool CPUFeatures::hasSSE42()
+{
+	return features().sse42;
+}
+
+
+bool CPUFeatures::hasPCLMUL()
+{
+	return features().pclmul;
+}
+
+
+bool CPUFeatures::hasAVX2()
+{
+	return features().avx2;
+}
+
+
+bool CPUFeatures::hasSHA()
+{
+	return features().sha;
+}
+
+
+bool CPUFeatures::hasNEON()
+{
+	return features().neon;
+}
+
+
+} // namespace Poco
@@ -13,12 +13,249 @@
 
 
 #include "Poco/Checksum.h"
+#include "Poco/CPUFeatures.h"
 #include <zlib.h>
+#include <cstring>
+#if defined(POCO_CPU_X86)
+#include <immintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
 
 
 namespace Poco {
 
 
+namespace
+{
+	constexpr UInt32 CRC32C_POLY = 0x82F63B78; // reflected Castagnoli polynomial
+
+
+	struct CRC32CTable
+		/// Tables for the slicing-by-8 software implementation.
+	{
+		constexpr CRC32CTable(): values()
+		{
+			for (UInt32 i = 0; i < 256; i++)
+			{
+				UInt32 crc = i;
+				for (int k = 0; k < 8; k++) crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+				values[0][i] = crc;
+			}
+			for (UInt32 i = 0; i < 256; i++)
+			{
+				for (int t = 1; t < 8; t++)
+					values[t][i] = (values[t - 1][i] >> 8) ^ values[0][values[t - 1][i] & 0xFF];
+			}
+		}
+
+		UInt32 values[8][256];
+	};
+
+
+	constexpr CRC32CTable CRC32C_TABLE;
+
+
+	inline UInt32 load32(const unsigned char* p)
+	{
+		UInt32 v;
+		std::memcpy(&v, p, sizeof(v));
+#if defined(POCO_ARCH_BIG_ENDIAN)
+		v = (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+#endif
+		return v;
+	}
+
+
+	UInt32 crc32cSoftware(UInt32 crc, const unsigned char* p, std::size_t n)
+		/// Calculates the raw (not inverted) CRC using slicing-by-8.
+	{
+		const auto& t = CRC32C_TABLE.values;
+		while (n >= 8)
+		{
+			const UInt32 lo = load32(p) ^ crc;
+			const UInt32 hi = load32(p + 4);
+			crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24] ^
+			      t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+			p += 8;
+			n -= 8;
+		}
+		while (n-- > 0) crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+		return crc;
+	}
+
+
+#if defined(POCO_CPU_X86)
+
+
+	constexpr UInt32 multModP(UInt32 a, UInt32 b)
+		/// Multiplies two polynomials modulo the CRC polynomial,
+		/// in the reflected representation used by the CRC (x^0 is
+		/// the most significant bit).
+	{
+		UInt32 m = 0x80000000;
+		UInt32 p = 0;
+		for (;;)
+		{
+			if (a & m)
+			{
+				p ^= b;
+				if ((a & (m - 1)) == 0) break;
+			}
+			m >>= 1;
+			b = (b & 1) ? (b >> 1) ^ CRC32C_POLY : b >> 1;
+		}
+		return p;
+	}
+
+
+	constexpr UInt32 xPowModP(UInt64 n)
+		/// Returns x^n modulo the CRC polynomial.
+	{
+		UInt32 p = 0x80000000; // x^0
+		UInt32 k = 0x40000000; // x^1
+		while (n)
+		{
+			if (n & 1) p = multModP(p, k);
+			k = multModP(k, k);
+			n >>= 1;
+		}
+		return p;
+	}
+
+
+	constexpr std::size_t CRC32C_LONG = 8192;
+	constexpr std::size_t CRC32C_SHORT = 256;
+
+
+	inline UInt64 load64(const unsigned char* p)
+	{
+		UInt64 v;
+		std::memcpy(&v, p, sizeof(v));
+		return v;
+	}
+
+
+	POCO_TARGET("sse4.2")
+	inline UInt32 crc32cWord(UInt32 crc, const unsigned char* p)
+	{
+#if POCO_ARCH == POCO_ARCH_AMD64
+		return static_cast<UInt32>(_mm_crc32_u64(crc, load64(p)));
+#else
+		crc = _mm_crc32_u32(crc, load32(p));
+		return _mm_crc32_u32(crc, load32(p + 4));
+#endif
+	}
+
+
+	POCO_TARGET("sse4.2")
+	UInt32 crc32cSSE42(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		while (n >= 8)
+		{
+			crc = crc32cWord(crc, p);
+			p += 8;
+			n -= 8;
+		}
+		while (n-- > 0) crc = _mm_crc32_u8(crc, *p++);
+		return crc;
+	}
+
+
+	POCO_TARGET("sse4.2,pclmul")
+	inline UInt32 crc32cShift(UInt32 crc, UInt32 k)
+		/// Returns crc * x^(n*8), where k = x^(n*8 - 33), i.e. the CRC of
+		/// crc followed by n zero bytes. The extra 33 powers of x are
+		/// supplied by the carry-less multiplication and the final CRC32.
+	{
+		const __m128i product = _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(crc)), _mm_cvtsi32_si128(static_cast<int>(k)), 0);
+		unsigned char bytes[16];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), product);
+		return crc32cWord(0, bytes);
+	}
+
+
+	template <std::size_t LANE>
+	POCO_TARGET("sse4.2,pclmul")
+	UInt32 crc32cLanes(UInt32 crc, const unsigned char*& p, std::size_t& n)
+		/// Processes blocks of 3*LANE bytes as three independent streams,
+		/// hiding the latency of the CRC32 instruction, and combines
+		/// the results with carry-less multiplications.
+	{
+		constexpr UInt32 shift1 = xPowModP(8*LANE - 33);
+		constexpr UInt32 shift2 = xPowModP(16*LANE - 33);
+		while (n >= 3*LANE)
+		{
+			UInt32 crc0 = crc;
+			UInt32 crc1 = 0;
+			UInt32 crc2 = 0;
+			for (std::size_t i = 0; i < LANE; i += 8)
+			{
+				crc0 = crc32cWord(crc0, p + i);
+				crc1 = crc32cWord(crc1, p + LANE + i);
+				crc2 = crc32cWord(crc2, p + 2*LANE + i);
+			}
+			crc = crc32cShift(crc0, shift2) ^ crc32cShift(crc1, shift1) ^ crc2;
+			p += 3*LANE;
+			n -= 3*LANE;
+		}
+		return crc;
+	}
+
+
+	POCO_TARGET("sse4.2,pclmul")
+	UInt32 crc32cPCLMUL(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		crc = crc32cLanes<CRC32C_LONG>(crc, p, n);
+		crc = crc32cLanes<CRC32C_SHORT>(crc, p, n);
+		return crc32cSSE42(crc, p, n);
+	}
+
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+
+	UInt32 crc32cARM(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		while (n >= 8)
+		{
+			UInt64 v;
+			std::memcpy(&v, p, sizeof(v));
+			crc = __crc32cd(crc, v);
+			p += 8;
+			n -= 8;
+		}
+		while (n-- > 0) crc = __crc32cb(crc, *p++);
+		return crc;
+	}
+
+
+#endif
+
+
+	UInt32 crc32c(UInt32 crc, const char* data, std::size_t length)
+	{
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+		crc = ~crc;
+#if defined(POCO_CPU_X86)
+		if (CPUFeatures::hasSSE42())
+		{
+			if (length >= 3*CRC32C_SHORT && CPUFeatures::hasPCLMUL())
+				crc = crc32cPCLMUL(crc, p, length);
+			else
+				crc = crc32cSSE42(crc, p, length);
+		}
+		else crc = crc32cSoftware(crc, p, length);
+#elif defined(__ARM_FEATURE_CRC32)
+		crc = crc32cARM(crc, p, length);
+#else
+		crc = crc32cSoftware(crc, p, length);
+#endif
+		return ~crc;
+	}
+}
+
+
 Checksum::Checksum():
 	_type(TYPE_CRC32),
 	_value(crc32(0L, nullptr, 0))
@@ -32,7 +269,7 @@ Checksum::Checksum(Type t):
 {
 	if (t == TYPE_CRC32)
 		_value = crc32(0L, nullptr, 0);
-	else
+	else if (t == TYPE_ADLER32)
 		_value = adler32(0L, nullptr, 0);
 }
 
@@ -46,6 +283,8 @@ void Checksum::update(const char* data, unsigned length)
 {
 	if (_type == TYPE_ADLER32)
 		_value = adler32(_value, reinterpret_cast<const Bytef*>(data), length);
+	else if (_type == TYPE_CRC32C)
+		_value = crc32c(_value, data, length);
 	else
 		_value = crc32(_value, reinterpret_cast<const Bytef*>(data), length);
 }
@@ -24,6 +24,8 @@
 #include "Poco/String.h"
 #include "Poco/Exception.h"
 #include "Poco/Ascii.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Timer.h"
 
 
 namespace Poco {
@@ -38,6 +40,11 @@ const std::string FileChannel::PROP_PURGEAGE     = "purgeAge";
 const std::string FileChannel::PROP_PURGECOUNT   = "purgeCount";
 const std::string FileChannel::PROP_FLUSH        = "flush";
 const std::string FileChannel::PROP_ROTATEONOPEN = "rotateOnOpen";
+const std::string FileChannel::PROP_BUFFERSIZE   = "bufferSize";
+const std::string FileChannel::PROP_FLUSHINTERVAL = "flushInterval";
+const std::string FileChannel::PROP_BACKGROUNDFLUSH = "backgroundFlush";
+const std::string FileChannel::PROP_SYNC         = "sync";
+const std::string FileChannel::PROP_ASYNCROTATION = "asyncRotation";
 
 FileChannel::FileChannel():
 	_times("utc"),
@@ -47,7 +54,17 @@ FileChannel::FileChannel():
 	_pFile(nullptr),
 	_pRotateStrategy(new NullRotateStrategy()),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
-	_pPurgeStrategy(new NullPurgeStrategy())
+	_pPurgeStrategy(new NullPurgeStrategy()),
+	_bufferSize(0),
+	_flushInterval(1*Timespan::SECONDS),
+	_backgroundFlush(false),
+	_sync("none"),
+	_periodicSync(false),
+	_syncMessages(0),
+	_unsyncedMessages(0),
+	_asyncRotation(false),
+	_rotating(false),
+	_rotationThread("FileChannelRotation")
 {
 	_pArchiveStrategy->setPurgeCallback([this]() { purge(); });
 }
@@ -62,7 +79,17 @@ FileChannel::FileChannel(const std::string& path):
 	_pFile(nullptr),
 	_pRotateStrategy(new NullRotateStrategy()),
 	_pArchiveStrategy(new ArchiveByNumberStrategy),
-	_pPurgeStrategy(new NullPurgeStrategy())
+	_pPurgeStrategy(new NullPurgeStrategy()),
+	_bufferSize(0),
+	_flushInterval(1*Timespan::SECONDS),
+	_backgroundFlush(false),
+	_sync("none"),
+	_periodicSync(false),
+	_syncMessages(0),
+	_unsyncedMessages(0),
+	_asyncRotation(false),
+	_rotating(false),
+	_rotationThread("FileChannelRotation")
 {
 	_pArchiveStrategy->setPurgeCallback([this]() { purge(); });
 }
@@ -88,7 +115,7 @@ void FileChannel::open()
 {
 	FastMutex::ScopedLock lock(_mutex);
 
-	if (!_pFile)
+	if (!_pFile && !_rotating)
 	{
 		_pFile = new LogFile(_path);
 		if (_rotateOnOpen && _pFile->size() > 0)
@@ -104,14 +131,33 @@ void FileChannel::open()
 		}
 
 		_pFile = _pArchiveStrategy->open(_pFile);
+		configureFile(_pFile);
+
+		if (_backgroundFlush && !_pFlushTimer)
+		{
+			long interval = static_cast<long>(_flushInterval.totalMilliseconds());
+			_pFlushTimer = std::make_unique<Timer>(interval, interval);
+			_pFlushTimer->start(TimerCallback<FileChannel>(*this, &FileChannel::onFlushTimer));
+		}
 	}
 }
 
 
 void FileChannel::close()
 {
+	std::unique_ptr<Timer> pFlushTimer;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+		pFlushTimer = std::move(_pFlushTimer);
+	}
+	// The timer callback acquires the mutex, so the timer
+	// must be stopped without holding it.
+	if (pFlushTimer) pFlushTimer->stop();
+
 	FastMutex::ScopedLock lock(_mutex);
 
+	waitForRotation();
+
 	if (_pFile != nullptr)
 		_pArchiveStrategy->close();
 
@@ -126,8 +172,31 @@ void FileChannel::log(const Message& msg)
 
 	FastMutex::ScopedLock lock(_mutex);
 
+	if (_rotating)
+	{
+		if (_pendingMessages.size() < MAX_PENDING_MESSAGES)
+		{
+			_pendingMessages.push_back(msg.getText());
+			return;
+		}
+		// too many pending messages; wait for the rotation to complete
+		waitForRotation();
+		if (!_pFile)
+		{
+			_pFile = _pArchiveStrategy->open(new LogFile(_path));
+			configureFile(_pFile);
+		}
+	}
+
 	if (_pRotateStrategy->mustRotate(_pFile))
 	{
+		if (_asyncRotation)
+		{
+			rotate();
+			_pendingMessages.push_back(msg.getText());
+			return;
+		}
+
 		try
 		{
 			_pFile = _pArchiveStrategy->archive(_pFile);
@@ -136,12 +205,128 @@ void FileChannel::log(const Message& msg)
 		{
 			_pFile = new LogFile(_path);
 		}
+		configureFile(_pFile);
 		// we must call mustRotate() again to give the
 		// RotateByIntervalStrategy a chance to write its timestamp
 		// to the new file.
 		_pRotateStrategy->mustRotate(_pFile);
 	}
-	_pFile->write(msg.getText(), _flush);
+	writeFile(msg.getText());
+}
+
+
+void FileChannel::configureFile(LogFile* pFile)
+{
+	if (_bufferSize) pFile->setBufferSize(_bufferSize);
+	_lastFlush.update();
+}
+
+
+void FileChannel::writeFile(const std::string& text)
+{
+	_pFile->write(text, _flush);
+
+	if (_syncMessages > 0 && ++_unsyncedMessages >= _syncMessages)
+	{
+		_pFile->sync();
+		_unsyncedMessages = 0;
+		_lastFlush.update();
+	}
+	else if (((_bufferSize && !_flush) || _periodicSync) && _lastFlush.isElapsed(_flushInterval.totalMicroseconds()))
+	{
+		flushFile();
+	}
+}
+
+
+void FileChannel::flushFile()
+{
+	if (_periodicSync)
+		_pFile->sync();
+	else
+		_pFile->flush();
+	_lastFlush.update();
+}
+
+
+void FileChannel::rotate()
+{
+	// The previous rotation has completed, but its thread may not have exited yet.
+	_rotationThread.join();
+
+	LogFile* pFile = _pFile;
+	_pFile = nullptr;
+	_rotating = true;
+	try
+	{
+		_rotationThread.startFunc([this, pFile]() { rotateImpl(pFile); });
+	}
+	catch (...)
+	{
+		_pFile = pFile;
+		_rotating = false;
+		throw;
+	}
+}
+
+
+void FileChannel::rotateImpl(LogFile* pFile)
+{
+	LogFile* pNewFile = nullptr;
+	try
+	{
+		pNewFile = _pArchiveStrategy->archive(pFile);
+	}
+	catch (...)
+	{
+	}
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	// Errors cannot be reported from the rotation thread. If the new
+	// log file cannot be created, the next log() call will try again.
+	try
+	{
+		if (!pNewFile) pNewFile = new LogFile(_path);
+		_pFile = pNewFile;
+		configureFile(_pFile);
+		_pRotateStrategy->mustRotate(_pFile);
+		for (const auto& text: _pendingMessages)
+		{
+			writeFile(text);
+		}
+	}
+	catch (...)
+	{
+	}
+	_pendingMessages.clear();
+	_rotating = false;
+	_rotationComplete.broadcast();
+}
+
+
+void FileChannel::waitForRotation()
+{
+	while (_rotating)
+		_rotationComplete.wait(_mutex);
+	_rotationThread.join();
+}
+
+
+void FileChannel::onFlushTimer(Timer&)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_pFile)
+	{
+		try
+		{
+			flushFile();
+		}
+		catch (...)
+		{
+		}
+	}
 }
 
 
@@ -149,6 +334,9 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 {
 	FastMutex::ScopedLock lock(_mutex);
 
+	// the strategies are used by the rotation thread
+	waitForRotation();
+
 	if (name == PROP_TIMES)
 	{
 		_times = value;
@@ -175,6 +363,16 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 		setFlush(value);
 	else if (name == PROP_ROTATEONOPEN)
 		setRotateOnOpen(value);
+	else if (name == PROP_BUFFERSIZE)
+		setBufferSize(value);
+	else if (name == PROP_FLUSHINTERVAL)
+		setFlushInterval(value);
+	else if (name == PROP_BACKGROUNDFLUSH)
+		_backgroundFlush = icompare(value, "true") == 0;
+	else if (name == PROP_SYNC)
+		setSync(value);
+	else if (name == PROP_ASYNCROTATION)
+		_asyncRotation = icompare(value, "true") == 0;
 	else
 		Channel::setProperty(name, value);
 }
@@ -200,6 +398,16 @@ std::string FileChannel::getProperty(const std::string& name) const
 		return std::string(_flush ? "true" : "false");
 	else if (name == PROP_ROTATEONOPEN)
 		return std::string(_rotateOnOpen ? "true" : "false");
+	else if (name == PROP_BUFFERSIZE)
+		return NumberFormatter::format(_bufferSize);
+	else if (name == PROP_FLUSHINTERVAL)
+		return NumberFormatter::format(_flushInterval.totalMilliseconds());
+	else if (name == PROP_BACKGROUNDFLUSH)
+		return std::string(_backgroundFlush ? "true" : "false");
+	else if (name == PROP_SYNC)
+		return _sync;
+	else if (name == PROP_ASYNCROTATION)
+		return std::string(_asyncRotation ? "true" : "false");
 	else
 		return Channel::getProperty(name);
 }
@@ -397,6 +605,51 @@ void FileChannel::setRotateOnOpen(const std::string& rotateOnOpen)
 }
 
 
+void FileChannel::setBufferSize(const std::string& bufferSize)
+{
+	if (bufferSize.empty() || icompare(bufferSize, "none") == 0)
+		_bufferSize = 0;
+	else
+		_bufferSize = static_cast<std::size_t>(NumberParser::parseUnsigned64(bufferSize));
+
+	if (_pFile) _pFile->setBufferSize(_bufferSize);
+}
+
+
+void FileChannel::setFlushInterval(const std::string& flushInterval)
+{
+	unsigned interval = NumberParser::parseUnsigned(flushInterval);
+	if (interval == 0)
+		throw InvalidArgumentException("flushInterval", flushInterval);
+
+	_flushInterval = Timespan(static_cast<Timespan::TimeDiff>(interval)*Timespan::MILLISECONDS);
+}
+
+
+void FileChannel::setSync(const std::string& sync)
+{
+	if (icompare(sync, "none") == 0)
+	{
+		_periodicSync = false;
+		_syncMessages = 0;
+	}
+	else if (icompare(sync, "periodic") == 0)
+	{
+		_periodicSync = true;
+		_syncMessages = 0;
+	}
+	else
+	{
+		int n = NumberParser::parse(sync);
+		if (n <= 0) throw InvalidArgumentException("sync", sync);
+		_periodicSync = false;
+		_syncMessages = n;
+	}
+	_unsyncedMessages = 0;
+	_sync = sync;
+}
+
+
 void FileChannel::purge()
 {
 	if (_pPurgeStrategy)
@@ -81,6 +81,12 @@ void FileIOS::flushToDisk()
 }
 
 
+void FileIOS::flushDataToDisk()
+{
+	_buf.flushDataToDisk();
+}
+
+
 FileInputStream::FileInputStream():
 	std::istream(&_buf)
 {
@@ -208,6 +208,21 @@ void FileStreamBuf::flushToDisk()
 }
 
 
+void FileStreamBuf::flushDataToDisk()
+{
+	if (getMode() & std::ios::out)
+	{
+		sync();
+#if POCO_OS == POCO_OS_LINUX
+		if (::fdatasync(_fd) != 0)
+#else
+		if (::fsync(_fd) != 0)
+#endif
+			File::handleLastError(_path);
+	}
+}
+
+
 FileStreamBuf::NativeHandle FileStreamBuf::nativeHandle() const
 {
 	return _fd;
@@ -244,6 +244,12 @@ void FileStreamBuf::flushToDisk()
 }
 
 
+void FileStreamBuf::flushDataToDisk()
+{
+	flushToDisk();
+}
+
+
 FileStreamBuf::NativeHandle FileStreamBuf::nativeHandle() const
 {
 	return _handle;
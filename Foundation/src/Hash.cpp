@@ -13,21 +13,135 @@
 
 
 #include "Poco/Hash.h"
+#include "Poco/ByteOrder.h"
+#include <cstring>
 
 
 namespace Poco {
 
 
+namespace
+{
+	// wyhash (final version 4.2), by Wang Yi, released into the public domain.
+
+	const UInt64 WYP[4] =
+	{
+		UINT64_C(0x2d358dccaa6c78a5),
+		UINT64_C(0x8bb84b93962eacc9),
+		UINT64_C(0x4b33a62ed433d4a3),
+		UINT64_C(0x4d5a2da51de1aa47)
+	};
+
+	inline void wyMum(UInt64& a, UInt64& b)
+	{
+#if defined(__SIZEOF_INT128__)
+		__uint128_t r = static_cast<__uint128_t>(a)*b;
+		a = static_cast<UInt64>(r);
+		b = static_cast<UInt64>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+#else
+		UInt64 ha = a >> 32;
+		UInt64 hb = b >> 32;
+		UInt64 la = static_cast<UInt32>(a);
+		UInt64 lb = static_cast<UInt32>(b);
+		UInt64 rh = ha*hb;
+		UInt64 rm0 = ha*lb;
+		UInt64 rm1 = hb*la;
+		UInt64 rl = la*lb;
+		UInt64 t = rl + (rm0 << 32);
+		UInt64 c = t < rl;
+		UInt64 lo = t + (rm1 << 32);
+		c += lo < t;
+		a = lo;
+		b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+	}
+
+	inline UInt64 wyMix(UInt64 a, UInt64 b)
+	{
+		wyMum(a, b);
+		return a ^ b;
+	}
+
+	inline UInt64 wyRead8(const UInt8* p)
+	{
+		UInt64 v;
+		std::memcpy(&v, p, sizeof(v));
+		return ByteOrder::fromLittleEndian(v);
+	}
+
+	inline UInt64 wyRead4(const UInt8* p)
+	{
+		UInt32 v;
+		std::memcpy(&v, p, sizeof(v));
+		return ByteOrder::fromLittleEndian(v);
+	}
+
+	inline UInt64 wyRead3(const UInt8* p, std::size_t k)
+	{
+		return (static_cast<UInt64>(p[0]) << 16) | (static_cast<UInt64>(p[k >> 1]) << 8) | p[k - 1];
+	}
+}
+
+
 std::size_t hash(const std::string& str)
 {
-	std::size_t h = 0;
-	std::string::const_iterator it  = str.begin();
-	std::string::const_iterator end = str.end();
-	while (it != end)
+	return static_cast<std::size_t>(hashBytes(str.data(), str.size()));
+}
+
+
+UInt64 hashBytes(const void* data, std::size_t length, UInt64 seed)
+{
+	const UInt8* p = static_cast<const UInt8*>(data);
+	seed ^= wyMix(seed ^ WYP[0], WYP[1]);
+	UInt64 a;
+	UInt64 b;
+	if (length <= 16)
+	{
+		if (length >= 4)
+		{
+			a = (wyRead4(p) << 32) | wyRead4(p + ((length >> 3) << 2));
+			b = (wyRead4(p + length - 4) << 32) | wyRead4(p + length - 4 - ((length >> 3) << 2));
+		}
+		else if (length > 0)
+		{
+			a = wyRead3(p, length);
+			b = 0;
+		}
+		else a = b = 0;
+	}
+	else
 	{
-		h = h * 0xf4243 ^ *it++;
+		std::size_t i = length;
+		if (i >= 48)
+		{
+			UInt64 see1 = seed;
+			UInt64 see2 = seed;
+			do
+			{
+				seed = wyMix(wyRead8(p) ^ WYP[1], wyRead8(p + 8) ^ seed);
+				see1 = wyMix(wyRead8(p + 16) ^ WYP[2], wyRead8(p + 24) ^ see1);
+				see2 = wyMix(wyRead8(p + 32) ^ WYP[3], wyRead8(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			}
+			while (i >= 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16)
+		{
+			seed = wyMix(wyRead8(p) ^ WYP[1], wyRead8(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = wyRead8(p + i - 16);
+		b = wyRead8(p + i - 8);
 	}
-	return h;
+	a ^= WYP[1];
+	b ^= seed;
+	wyMum(a, b);
+	return wyMix(a ^ WYP[0] ^ length, b ^ WYP[1]);
 }
 
 
@@ -0,0 +1,277 @@
+//
+// HexBinary.cpp
+//
+// Library: Foundation
+// Package: Streams
+// Module:  HexBinary
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/HexBinary.h"
+#include "Poco/CPUFeatures.h"
+#include "Poco/Exception.h"
+#if defined(POCO_CPU_X86)
+#include <immintrin.h>
+#elif defined(POCO_CPU_NEON)
+#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	constexpr char DIGITS[] = "0123456789abcdef";
+	constexpr char DIGITS_UPPER[] = "0123456789ABCDEF";
+
+
+	struct DecodingTable
+		/// Maps hexadecimal digits to their values, and
+		/// all other characters to 0xFF.
+	{
+		constexpr DecodingTable(): values()
+		{
+			for (int i = 0; i < 256; i++) values[i] = 0xFF;
+			for (int i = 0; i < 10; i++) values['0' + i] = static_cast<UInt8>(i);
+			for (int i = 0; i < 6; i++)
+			{
+				values['a' + i] = static_cast<UInt8>(10 + i);
+				values['A' + i] = static_cast<UInt8>(10 + i);
+			}
+		}
+
+		UInt8 values[256];
+	};
+
+
+	constexpr DecodingTable DECODING;
+
+
+	inline bool isWhitespace(char c)
+	{
+		return c == ' ' || c == '\r' || c == '\t' || c == '\n';
+	}
+
+
+#if defined(POCO_CPU_X86)
+
+
+	POCO_TARGET("ssse3")
+	void encodeSSSE3(const unsigned char*& in, const unsigned char* end, char*& out, const char* digits)
+		/// Encodes 16 bytes per iteration.
+	{
+		const __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+		const __m128i mask = _mm_set1_epi8(0x0F);
+		while (end - in >= 16)
+		{
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+			const __m128i hi = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+			const __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(v, mask));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hi, lo));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hi, lo));
+			in += 16;
+			out += 32;
+		}
+	}
+
+
+	POCO_TARGET("ssse3")
+	inline bool digitValues(__m128i v, __m128i& values)
+		/// Converts 16 hexadecimal digits to their values.
+		/// Returns false if any character is not a digit.
+	{
+		const __m128i decimal = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+		const __m128i isDecimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal);
+		const __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+		const __m128i isAlpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+		if (_mm_movemask_epi8(_mm_or_si128(isDecimal, isAlpha)) != 0xFFFF) return false;
+		values = _mm_or_si128(
+			_mm_and_si128(isDecimal, decimal),
+			_mm_and_si128(isAlpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+		return true;
+	}
+
+
+	POCO_TARGET("ssse3")
+	void decodeSSSE3(const char*& in, const char* end, unsigned char*& out)
+		/// Decodes 32 digits per iteration. Stops at the first
+		/// block containing a character that is not a digit.
+	{
+		const __m128i merge = _mm_set1_epi16(0x0110);
+		while (end - in >= 32)
+		{
+			__m128i v0;
+			__m128i v1;
+			if (!digitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), v0)) break;
+			if (!digitValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)), v1)) break;
+			// Each pair of values becomes 16*hi + lo in a 16-bit lane.
+			v0 = _mm_maddubs_epi16(v0, merge);
+			v1 = _mm_maddubs_epi16(v1, merge);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v0, v1));
+			in += 32;
+			out += 16;
+		}
+	}
+
+
+#elif defined(POCO_CPU_NEON)
+
+
+	void encodeNEON(const unsigned char*& in, const unsigned char* end, char*& out, const char* digits)
+		/// Encodes 16 bytes per iteration.
+	{
+		const uint8x16_t table = vld1q_u8(reinterpret_cast<const uint8_t*>(digits));
+		const uint8x16_t mask = vdupq_n_u8(0x0F);
+		while (end - in >= 16)
+		{
+			const uint8x16_t v = vld1q_u8(in);
+			uint8x16x2_t r;
+			r.val[0] = vqtbl1q_u8(table, vshrq_n_u8(v, 4));
+			r.val[1] = vqtbl1q_u8(table, vandq_u8(v, mask));
+			vst2q_u8(reinterpret_cast<uint8_t*>(out), r);
+			in += 16;
+			out += 32;
+		}
+	}
+
+
+	inline uint8x16_t digitValues(uint8x16_t v, uint8x16_t& valid)
+		/// Converts 16 hexadecimal digits to their values and
+		/// clears the corresponding bytes of valid for non-digits.
+	{
+		const uint8x16_t decimal = vsubq_u8(v, vdupq_n_u8('0'));
+		const uint8x16_t isDecimal = vcleq_u8(decimal, vdupq_n_u8(9));
+		const uint8x16_t alpha = vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+		const uint8x16_t isAlpha = vcleq_u8(alpha, vdupq_n_u8(5));
+		valid = vandq_u8(valid, vorrq_u8(isDecimal, isAlpha));
+		return vorrq_u8(vandq_u8(isDecimal, decimal), vandq_u8(isAlpha, vaddq_u8(alpha, vdupq_n_u8(10))));
+	}
+
+
+	void decodeNEON(const char*& in, const char* end, unsigned char*& out)
+		/// Decodes 32 digits per iteration. Stops at the first
+		/// block containing a character that is not a digit.
+	{
+		while (end - in >= 32)
+		{
+			const uint8x16x2_t v = vld2q_u8(reinterpret_cast<const uint8_t*>(in));
+			uint8x16_t valid = vdupq_n_u8(0xFF);
+			const uint8x16_t hi = digitValues(v.val[0], valid);
+			const uint8x16_t lo = digitValues(v.val[1], valid);
+			if (vminvq_u8(valid) != 0xFF) break;
+			vst1q_u8(out, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+			in += 32;
+			out += 16;
+		}
+	}
+
+
+#endif
+}
+
+
+std::size_t HexBinary::encode(const void* data, std::size_t length, char* output, bool uppercase)
+{
+	const char* digits = uppercase ? DIGITS_UPPER : DIGITS;
+	const unsigned char* in = static_cast<const unsigned char*>(data);
+	const unsigned char* end = in + length;
+	char* out = output;
+
+#if defined(POCO_CPU_X86)
+	if (length >= 16 && CPUFeatures::hasSSSE3())
+		encodeSSSE3(in, end, out, digits);
+#elif defined(POCO_CPU_NEON)
+	encodeNEON(in, end, out, digits);
+#endif
+
+	for (; in < end; ++in)
+	{
+		*out++ = digits[*in >> 4];
+		*out++ = digits[*in & 0x0F];
+	}
+	return out - output;
+}
+
+
+std::string HexBinary::encode(const std::string& data, bool uppercase)
+{
+	std::string result(2*data.size(), '\0');
+	encode(data.data(), data.size(), result.data(), uppercase);
+	return result;
+}
+
+
+std::size_t HexBinary::decode(const char* data, std::size_t length, void* output)
+{
+	const char* it = data;
+	const char* end = data + length;
+	bool invalid = false;
+	std::size_t n = decodeBlocks(it, end, static_cast<unsigned char*>(output), invalid);
+	if (invalid) throw DataFormatException("Invalid hexadecimal digit");
+	for (; it < end; ++it)
+	{
+		if (!isWhitespace(*it)) throw DataFormatException("Odd number of hexadecimal digits");
+	}
+	return n;
+}
+
+
+std::string HexBinary::decode(const std::string& data)
+{
+	std::string result(data.size()/2, '\0');
+	result.resize(decode(data.data(), data.size(), result.data()));
+	return result;
+}
+
+
+std::size_t HexBinary::decodeBlocks(const char*& it, const char* end, unsigned char* output, bool& invalid)
+{
+#if defined(POCO_CPU_X86)
+	const bool ssse3 = CPUFeatures::hasSSSE3();
+#endif
+	unsigned char* out = output;
+	invalid = false;
+	while (it < end)
+	{
+#if defined(POCO_CPU_X86)
+		if (ssse3 && end - it >= 32) decodeSSSE3(it, end, out);
+#elif defined(POCO_CPU_NEON)
+		decodeNEON(it, end, out);
+#endif
+
+		while (it < end && isWhitespace(*it)) ++it;
+		if (it == end) break;
+		const char* pairStart = it;
+		const UInt8 hi = DECODING.values[static_cast<unsigned char>(*it++)];
+		if (hi == 0xFF)
+		{
+			invalid = true;
+			it = pairStart;
+			break;
+		}
+		while (it < end && isWhitespace(*it)) ++it;
+		if (it == end)
+		{
+			it = pairStart;
+			break;
+		}
+		const UInt8 lo = DECODING.values[static_cast<unsigned char>(*it++)];
+		if (lo == 0xFF)
+		{
+			invalid = true;
+			it = pairStart;
+			break;
+		}
+		*out++ = static_cast<unsigned char>((hi << 4) | lo);
+	}
+	return out - output;
+}
+
+
+} // namespace Poco
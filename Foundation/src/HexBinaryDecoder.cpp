@@ -13,6 +13,7 @@
 
 
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinary.h"
 #include "Poco/Exception.h"
 
 
@@ -20,7 +21,11 @@ namespace Poco {
 
 
 HexBinaryDecoderBuf::HexBinaryDecoderBuf(std::istream& istr):
-	_buf(*istr.rdbuf())
+	BufferedStreamBuf(BUFFER_SIZE, std::ios::in),
+	_buf(*istr.rdbuf()),
+	_pending(0),
+	_eof(false),
+	_error(false)
 {
 }
 
@@ -30,37 +35,42 @@ HexBinaryDecoderBuf::~HexBinaryDecoderBuf()
 }
 
 
-int HexBinaryDecoderBuf::readFromDevice()
+std::streamsize HexBinaryDecoderBuf::readFromDevice(char* buffer, std::streamsize length)
 {
-	int c;
-	int n;
-	if ((n = readOne()) == -1) return -1;
-	if (n >= '0' && n <= '9')
-		c = n - '0';
-	else if (n >= 'A' && n <= 'F')
-		c = n - 'A' + 10;
-	else if (n >= 'a' && n <= 'f')
-		c = n - 'a' + 10;
-	else throw DataFormatException();
-	c <<= 4;
-	if ((n = readOne()) == -1) throw DataFormatException();
-	if (n >= '0' && n <= '9')
-		c |= n - '0';
-	else if (n >= 'A' && n <= 'F')
-		c |= n - 'A' + 10;
-	else if (n >= 'a' && n <= 'f')
-		c |= n - 'a' + 10;
-	else throw DataFormatException();
-	return c;
-}
-
-
-int HexBinaryDecoderBuf::readOne()
-{
-	int ch = _buf.sbumpc();
-	while (ch == ' ' || ch == '\r' || ch == '\t' || ch == '\n')
-		ch = _buf.sbumpc();
-	return ch;
+	if (_error) throw DataFormatException("Invalid hexadecimal digit");
+
+	unsigned char* output = reinterpret_cast<unsigned char*>(buffer);
+	std::size_t n = 0;
+	while (n == 0 && !_eof)
+	{
+		// _input starts with the first digit of an incomplete
+		// pair left over from the previous block.
+		std::streamsize maxInput = length*2;
+		if (maxInput > BUFFER_SIZE) maxInput = BUFFER_SIZE;
+		const std::streamsize nRead = _buf.sgetn(_input + _pending, maxInput - _pending);
+		if (nRead <= 0)
+		{
+			_eof = true;
+			if (_pending > 0) throw DataFormatException("Odd number of hexadecimal digits");
+			break;
+		}
+
+		const char* it = _input;
+		const char* end = _input + _pending + nRead;
+		n = HexBinary::decodeBlocks(it, end, output, _error);
+		if (_error)
+		{
+			if (n == 0) throw DataFormatException("Invalid hexadecimal digit");
+			break;
+		}
+		_pending = 0;
+		for (; it < end; ++it)
+		{
+			if (*it != ' ' && *it != '\r' && *it != '\t' && *it != '\n')
+				_input[_pending++] = *it;
+		}
+	}
+	return static_cast<std::streamsize>(n);
 }
 
 
@@ -13,6 +13,7 @@
 
 
 #include "Poco/HexBinaryEncoder.h"
+#include "Poco/HexBinary.h"
 
 
 namespace Poco {
@@ -60,17 +61,49 @@ void HexBinaryEncoderBuf::setUppercase(bool flag)
 int HexBinaryEncoderBuf::writeToDevice(char c)
 {
 	static const int eof = std::char_traits<char>::eof();
-	static const char digits[] = "0123456789abcdef0123456789ABCDEF";
 
-	if (_buf.sputc(digits[_uppercase + ((c >> 4) & 0xF)]) == eof) return eof;
-	++_pos;
-	if (_buf.sputc(digits[_uppercase + (c & 0xF)]) == eof) return eof;
-	if (++_pos >= _lineLength && _lineLength > 0)
+	if (writeBytes(reinterpret_cast<const unsigned char*>(&c), 1) == eof) return eof;
+	return charToInt(c);
+}
+
+
+std::streamsize HexBinaryEncoderBuf::xsputn(const char* s, std::streamsize n)
+{
+	static const int eof = std::char_traits<char>::eof();
+
+	if (writeBytes(reinterpret_cast<const unsigned char*>(s), n) == eof) return 0;
+	return n;
+}
+
+
+int HexBinaryEncoderBuf::writeBytes(const unsigned char* data, std::streamsize length)
+{
+	static const int eof = std::char_traits<char>::eof();
+	static const std::streamsize MAX_BYTES = 512;
+
+	char buffer[MAX_BYTES*2 + 1];
+	while (length > 0)
 	{
-		if (_buf.sputc('\n') == eof) return eof;
-		_pos = 0;
+		std::streamsize n = length < MAX_BYTES ? length : MAX_BYTES;
+		if (_lineLength > 0)
+		{
+			// A line break follows the byte that reaches the line length.
+			std::streamsize lineBytes = (_lineLength - _pos + 1)/2;
+			if (lineBytes < 1) lineBytes = 1;
+			if (n > lineBytes) n = lineBytes;
+		}
+		std::streamsize size = static_cast<std::streamsize>(HexBinary::encode(data, static_cast<std::size_t>(n), buffer, _uppercase != 0));
+		_pos += static_cast<int>(size);
+		if (_lineLength > 0 && _pos >= _lineLength)
+		{
+			buffer[size++] = '\n';
+			_pos = 0;
+		}
+		if (_buf.sputn(buffer, size) != size) return eof;
+		data += n;
+		length -= n;
 	}
-	return charToInt(c);
+	return 0;
 }
 
 
@@ -208,7 +208,7 @@ std::streamsize InflatingStreamBuf::writeToDevice(const char* buffer, std::strea
 	for (;;)
 	{
 		int rc = inflate(_pZstr, Z_NO_FLUSH);
-		if (rc == Z_STREAM_END)
+		if (rc == Z_STREAM_END || (rc == Z_BUF_ERROR && _pZstr->avail_in == 0))
 		{
 			_pOstr->write(_buffer, INFLATE_BUFFER_SIZE - _pZstr->avail_out);
 			if (!_pOstr->good()) throw IOException("Failed writing inflated data to output stream");
@@ -221,6 +221,9 @@ std::streamsize InflatingStreamBuf::writeToDevice(const char* buffer, std::strea
 			if (!_pOstr->good()) throw IOException("Failed writing inflated data to output stream");
 			_pZstr->next_out  = (unsigned char*) _buffer;
 			_pZstr->avail_out = INFLATE_BUFFER_SIZE;
+			// inflate() may hold back output that did not fit
+			// into the buffer, even if all input has been consumed.
+			continue;
 		}
 		if (_pZstr->avail_in == 0)
 		{
@@ -15,6 +15,7 @@
 #include "Poco/LogFile.h"
 #include "Poco/File.h"
 #include "Poco/Exception.h"
+#include <cstring>
 
 namespace Poco {
 
@@ -22,7 +23,8 @@ namespace Poco {
 LogFile::LogFile(const std::string& path):
 	_path(path),
 	_str(_path, std::ios::app),
-	_size(static_cast<UInt64>(_str.tellp()))
+	_size(static_cast<UInt64>(_str.tellp())),
+	_bufferSize(0)
 {
 	// There seems to be a strange "optimization" in the Windows NTFS
 	// filesystem that causes it to reuse directory entries of deleted
@@ -51,7 +53,10 @@ LogFile::~LogFile()
 
 void LogFile::write(const std::string& text, bool flush)
 {
-	std::streampos pos = _str.tellp();
+	// tellp() flushes the stream buffer, so the size
+	// is maintained here if write combining is enabled.
+	std::streampos pos = _bufferSize ? std::streampos(static_cast<std::streamoff>(_size)) : _str.tellp();
+	std::size_t length = text.size() + std::strlen(POCO_DEFAULT_NEWLINE_CHARS);
 
 #if defined(POCO_OS_FAMILY_WINDOWS)
 	// Replace \n with \r\n
@@ -67,6 +72,7 @@ void LogFile::write(const std::string& text, bool flush)
 
 		prevChar = c;
 	}
+	length = logText.size() + std::strlen(POCO_DEFAULT_NEWLINE_CHARS);
 	_str << logText;
 #else
 	_str << text;
@@ -76,17 +82,50 @@ void LogFile::write(const std::string& text, bool flush)
 
 	if (flush)
 		_str.flushToDisk();
-	else
+	else if (_bufferSize == 0)
 		_str.flush();
 
 	if (!_str.good())
 	{
 		_str.clear();
-		_str.seekp(pos);
+		if (_bufferSize == 0) _str.seekp(pos);
+		throw WriteFileException(_path);
+	}
+
+	if (_bufferSize)
+		_size += length;
+	else
+		_size = static_cast<UInt64>(_str.tellp());
+}
+
+
+void LogFile::setBufferSize(std::size_t bufferSize)
+{
+	if (bufferSize == _bufferSize) return;
+
+	_str.close();
+	_str.clear();
+	_str.rdbuf()->resizeBuffer(static_cast<std::streamsize>(bufferSize));
+	_str.open(_path, std::ios::app);
+	_bufferSize = bufferSize;
+}
+
+
+void LogFile::flush()
+{
+	_str.flush();
+	if (!_str.good())
+	{
+		_str.clear();
 		throw WriteFileException(_path);
 	}
+}
 
-	_size = static_cast<UInt64>(_str.tellp());
+
+void LogFile::sync()
+{
+	flush();
+	_str.flushDataToDisk();
 }
 
 
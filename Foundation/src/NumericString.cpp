@@ -174,16 +174,16 @@ namespace {
 /// Format a floating-point value using std::to_chars with shortest representation.
 /// Chooses fixed or scientific notation based on the value's exponent and the
 /// [lowDec, highDec] range, matching double-conversion's ToShortest behavior.
+/// Writes no terminating zero and returns the end of the written characters,
+/// or nullptr if the buffer is too small.
 template <typename T>
-void toShortestStr(char* buffer, int bufferSize, T value, int lowDec, int highDec)
+char* toShortest(char* first, char* last, T value, int lowDec, int highDec)
 {
 	// Handle NaN, infinity, and -0 directly -- log10 is undefined for these.
 	if (!std::isfinite(value) || value == T(0))
 	{
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
-		return;
+		auto [ptr, ec] = std::to_chars(first, last, value);
+		return ec == std::errc() ? ptr : nullptr;
 	}
 
 	// Compute the base-10 exponent robustly. std::floor(std::log10(x)) can
@@ -202,26 +202,34 @@ void toShortestStr(char* buffer, int bufferSize, T value, int lowDec, int highDe
 	if (useFixed)
 	{
 		// Fixed notation with trailing-zero trimming for shortest output
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value, std::chars_format::fixed);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
+		auto [ptr, ec] = std::to_chars(first, last, value, std::chars_format::fixed);
+		if (ec != std::errc()) return nullptr;
 
-		char* dot = static_cast<char*>(std::memchr(buffer, '.', ptr - buffer));
+		const char* dot = static_cast<const char*>(std::memchr(first, '.', ptr - first));
 		if (dot != nullptr)
 		{
-			char* last = ptr - 1;
-			while (last > dot && *last == '0') --last;
-			*(last == dot ? last : last + 1) = '\0';
+			char* end = ptr - 1;
+			while (end > dot && *end == '0') --end;
+			return end == dot ? end : end + 1;
 		}
+		return ptr;
 	}
 	else
 	{
-		auto [ptr, ec] = std::to_chars(buffer, buffer + bufferSize, value);
-		if (ec != std::errc()) { buffer[0] = '\0'; return; }
-		*ptr = '\0';
+		auto [ptr, ec] = std::to_chars(first, last, value);
+		return ec == std::errc() ? ptr : nullptr;
 	}
 }
 
+
+template <typename T>
+void toShortestStr(char* buffer, int bufferSize, T value, int lowDec, int highDec)
+{
+	char* end = toShortest(buffer, buffer + bufferSize - 1, value, lowDec, highDec);
+	*(end ? end : buffer) = '\0';
+}
+
+
 /// Adjust a fixed-notation string to the requested precision by truncating
 /// or zero-padding the fractional digits. Uses round-half-up rounding to
 /// match double-conversion's behavior.
@@ -551,6 +559,112 @@ double strToDouble(const char* str, const char* inf, const char* nan)
 #endif // POCO_HAS_FLOAT_CHARCONV
 
 
+#ifdef POCO_HAS_FLOAT_CHARCONV
+
+std::to_chars_result toChars(char* first, char* last, double value)
+{
+	char* end = toShortest(first, last, value, -std::numeric_limits<double>::digits10, std::numeric_limits<double>::digits10);
+	if (!end) return {last, std::errc::value_too_large};
+	return {end, std::errc()};
+}
+
+
+std::to_chars_result toChars(char* first, char* last, float value)
+{
+	char* end = toShortest(first, last, value, -std::numeric_limits<float>::digits10, std::numeric_limits<float>::digits10);
+	if (!end) return {last, std::errc::value_too_large};
+	return {end, std::errc()};
+}
+
+
+std::from_chars_result fromChars(const char* first, const char* last, double& value)
+{
+	return std::from_chars(first, last, value);
+}
+
+
+std::from_chars_result fromChars(const char* first, const char* last, float& value)
+{
+	return std::from_chars(first, last, value);
+}
+
+#else // !POCO_HAS_FLOAT_CHARCONV
+
+namespace {
+
+template <typename T, typename FormatFn>
+std::to_chars_result toCharsImpl(char* first, char* last, T value, FormatFn formatFn)
+{
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+	formatFn(buffer, POCO_MAX_FLT_STRING_LEN, value);
+	const std::size_t length = std::strlen(buffer);
+	if (length > static_cast<std::size_t>(last - first)) return {last, std::errc::value_too_large};
+	std::memcpy(first, buffer, length);
+	return {first + length, std::errc()};
+}
+
+
+template <typename T, typename ParseFn>
+std::from_chars_result fromCharsImpl(const char* first, const char* last, T& value, ParseFn parseFn)
+{
+	using namespace double_conversion;
+
+	// Accept the same special values as std::from_chars.
+	const char* p = (first < last && *first == '-') ? first + 1 : first;
+	const std::size_t length = static_cast<std::size_t>(last - p);
+	if (length >= 3 && icompare(std::string(p, 3), "nan") == 0)
+	{
+		value = std::numeric_limits<T>::quiet_NaN();
+		return {p + 3, std::errc()};
+	}
+	if (length >= 3 && icompare(std::string(p, 3), "inf") == 0)
+	{
+		const bool full = length >= 8 && icompare(std::string(p, 8), "infinity") == 0;
+		value = (p == first) ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+		return {p + (full ? 8 : 3), std::errc()};
+	}
+	if (length == 0 || *p == '+') return {first, std::errc::invalid_argument};
+
+	int processed = 0;
+	StringToDoubleConverter converter(StringToDoubleConverter::ALLOW_TRAILING_JUNK, 0.0, 0.0, nullptr, nullptr);
+	const T result = parseFn(converter, first, static_cast<int>(last - first), &processed);
+	if (processed == 0) return {first, std::errc::invalid_argument};
+	if (FPEnvironment::isInfinite(result)) return {first + processed, std::errc::result_out_of_range};
+	value = result;
+	return {first + processed, std::errc()};
+}
+
+} // namespace
+
+
+std::to_chars_result toChars(char* first, char* last, double value)
+{
+	return toCharsImpl(first, last, value, [](char* buf, int sz, double v) { doubleToStr(buf, sz, v); });
+}
+
+
+std::to_chars_result toChars(char* first, char* last, float value)
+{
+	return toCharsImpl(first, last, value, [](char* buf, int sz, float v) { floatToStr(buf, sz, v); });
+}
+
+
+std::from_chars_result fromChars(const char* first, const char* last, double& value)
+{
+	return fromCharsImpl(first, last, value,
+		[](double_conversion::StringToDoubleConverter& c, const char* s, int n, int* processed) { return c.StringToDouble(s, n, processed); });
+}
+
+
+std::from_chars_result fromChars(const char* first, const char* last, float& value)
+{
+	return fromCharsImpl(first, last, value,
+		[](double_conversion::StringToDoubleConverter& c, const char* s, int n, int* processed) { return c.StringToFloat(s, n, processed); });
+}
+
+#endif // POCO_HAS_FLOAT_CHARCONV
+
+
 namespace {
 
 /// Common implementation for string-to-float/double overloads.
@@ -564,6 +678,19 @@ bool strToFloatImpl(const std::string& str, T& result, char decSep, char thSep,
 {
 	if (str.empty()) return false;
 
+	// Plain numbers are parsed in place, without a temporary copy.
+	// Everything else (whitespace, separators, suffixes, special values)
+	// takes the general path below.
+	if (decSep == '.' && thSep != '.')
+	{
+		T value;
+		if (fromChars(str, value) && !FPEnvironment::isInfinite(value) && !FPEnvironment::isNaN(value))
+		{
+			result = value;
+			return true;
+		}
+	}
+
 	std::string tmp(str);
 	trimInPlace(tmp);
 	removeInPlace(tmp, thSep);
@@ -14,7 +14,6 @@
 
 #include "Poco/PatternFormatter.h"
 #include "Poco/Message.h"
-#include "Poco/NumberFormatter.h"
 #include "Poco/DateTimeFormat.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTime.h"
@@ -24,11 +23,166 @@
 #include "Poco/NumberParser.h"
 #include "Poco/StringTokenizer.h"
 #include "Poco/Path.h"
+#include <algorithm>
+#include <cstring>
 
 
 namespace Poco {
 
 
+namespace
+{
+	const char DIGIT_PAIRS[] =
+		"0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+
+	bool isTimeKey(char key)
+		/// Returns true if the key denotes a date/time field
+		/// that does not depend on the fraction of the second.
+	{
+		return key != 0 && std::strchr("wWbBdefmnoyYHhaAMS", key) != nullptr;
+	}
+
+
+	class StringSink
+		/// Appends the formatted message to a std::string.
+	{
+	public:
+		explicit StringSink(std::string& str): _str(str)
+		{
+		}
+
+		void append(const char* s, std::size_t n)
+		{
+			_str.append(s, n);
+		}
+
+		void append(const std::string& s)
+		{
+			_str.append(s);
+		}
+
+		void append(char c)
+		{
+			_str += c;
+		}
+
+		void append(std::size_t n, char c)
+		{
+			_str.append(n, c);
+		}
+
+	private:
+		std::string& _str;
+	};
+
+
+	class BufferSink
+		/// Writes the formatted message to a fixed-size buffer.
+		/// Output that does not fit is discarded, but counted.
+	{
+	public:
+		BufferSink(char* buffer, std::size_t size): _buffer(buffer), _size(size), _length(0)
+		{
+		}
+
+		void append(const char* s, std::size_t n)
+		{
+			if (_length < _size) std::memcpy(_buffer + _length, s, std::min(n, _size - _length));
+			_length += n;
+		}
+
+		void append(const std::string& s)
+		{
+			append(s.data(), s.size());
+		}
+
+		void append(char c)
+		{
+			if (_length < _size) _buffer[_length] = c;
+			++_length;
+		}
+
+		void append(std::size_t n, char c)
+		{
+			if (_length < _size) std::memset(_buffer + _length, c, std::min(n, _size - _length));
+			_length += n;
+		}
+
+		std::size_t length() const
+		{
+			return _length;
+		}
+
+	private:
+		char* _buffer;
+		std::size_t _size;
+		std::size_t _length;
+	};
+
+
+	template <class S>
+	void appendNumber(S& sink, Int64 value, int width = 0, char fill = '0')
+		/// Appends the decimal representation of value, right-justified
+		/// in a field of the given width.
+	{
+		char buffer[32];
+		char* end = buffer + sizeof(buffer);
+		char* p = end;
+		UInt64 n = value < 0 ? 0 - static_cast<UInt64>(value) : static_cast<UInt64>(value);
+		while (n >= 100)
+		{
+			const char* d = DIGIT_PAIRS + 2*(n % 100);
+			n /= 100;
+			*--p = d[1];
+			*--p = d[0];
+		}
+		if (n >= 10)
+		{
+			const char* d = DIGIT_PAIRS + 2*n;
+			*--p = d[1];
+			*--p = d[0];
+		}
+		else *--p = static_cast<char>('0' + n);
+		if (value < 0) *--p = '-';
+		while (end - p < width) *--p = fill;
+		sink.append(p, static_cast<std::size_t>(end - p));
+	}
+
+
+	template <class S>
+	void appendTzd(S& sink, int tzd, bool iso)
+		/// Appends the time zone differential in ISO 8601 or RFC format,
+		/// like DateTimeFormatter::tzdISO() and DateTimeFormatter::tzdRFC().
+	{
+		if (tzd == DateTimeFormatter::UTC)
+		{
+			if (iso)
+				sink.append('Z');
+			else
+				sink.append("GMT", 3);
+			return;
+		}
+		if (tzd >= 0)
+		{
+			sink.append('+');
+		}
+		else
+		{
+			sink.append('-');
+			tzd = -tzd;
+		}
+		appendNumber(sink, tzd/3600, 2);
+		if (iso) sink.append(':');
+		appendNumber(sink, (tzd%3600)/60, 2);
+	}
+}
+
+
 const std::string PatternFormatter::PROP_PATTERN = "pattern";
 const std::string PatternFormatter::PROP_TIMES   = "times";
 const std::string PatternFormatter::PROP_PRIORITY_NAMES = "priorityNames";
@@ -36,6 +190,8 @@ const std::string PatternFormatter::DEFAULT_PRIORITY_NAMES = "Fatal,Critical,Err
 std::string PatternFormatter::_cachedNodeName;
 
 PatternFormatter::PatternFormatter():
+	_prefixActions(0),
+	_prefixLocalTime(false),
 	_localTime(false),
 	_localTimeSet(false),
 	_priorityNames(DEFAULT_PRIORITY_NAMES)
@@ -45,6 +201,8 @@ PatternFormatter::PatternFormatter():
 
 
 PatternFormatter::PatternFormatter(const std::string& format):
+	_prefixActions(0),
+	_prefixLocalTime(false),
 	_localTime(false),
 	_localTimeSet(false),
 	_pattern(format),
@@ -63,84 +221,119 @@ PatternFormatter::~PatternFormatter()
 void PatternFormatter::format(const Message& msg, std::string& text)
 {
 	text.reserve(text.size() + 128);
-	Timestamp timestamp = msg.getTime();
-	bool localTime = _localTime;
-	if (localTime)
+	StringSink sink(text);
+	formatImpl(msg, sink);
+}
+
+
+std::size_t PatternFormatter::format(const Message& msg, char* buffer, std::size_t size)
+{
+	BufferSink sink(buffer, size);
+	formatImpl(msg, sink);
+	return sink.length();
+}
+
+
+template <class S>
+void PatternFormatter::formatImpl(const Message& msg, S& sink)
+{
+	Timestamp::TimeVal epochMicroseconds = msg.getTime().epochMicroseconds();
+	Timestamp::TimeVal epochSecond = epochMicroseconds/Timestamp::resolution();
+	int micros = static_cast<int>(epochMicroseconds % Timestamp::resolution());
+	if (micros < 0)
+	{
+		micros += static_cast<int>(Timestamp::resolution());
+		--epochSecond;
+	}
+	bool localTime = _localTime || _prefixLocalTime;
+	TimeFields fields;
+	bool haveFields = false;
+	std::size_t i = 0;
+	if (_prefixActions > 0)
 	{
-		timestamp += Timezone::utcOffset()*Timestamp::resolution();
-		timestamp += Timezone::dst()*Timestamp::resolution();
+		getTimeFields(epochSecond, localTime, fields);
+		haveFields = true;
+		if (fields.prefixLength <= MAX_PREFIX_LENGTH)
+		{
+			sink.append(fields.prefix, fields.prefixLength);
+			i = _prefixActions;
+		}
 	}
-	DateTime dateTime = timestamp;
-	for (auto& pa:_patternActions)
+	for (; i < _patternActions.size(); ++i)
 	{
-		text.append(pa.prepend);
+		const PatternAction& pa = _patternActions[i];
+		sink.append(pa.prepend);
 		switch (pa.key)
 		{
-		case 's': text.append(msg.getSource()); break;
-		case 't': text.append(msg.getText()); break;
-		case 'l': NumberFormatter::append(text, (int) msg.getPriority()); break;
-		case 'p': text.append(getPriorityName((int) msg.getPriority())); break;
-		case 'q': text += getPriorityName((int) msg.getPriority()).at(0); break;
-		case 'P': NumberFormatter::append(text, msg.getPid()); break;
-		case 'T': text.append(msg.getThread()); break;
-		case 'I': NumberFormatter::append(text, msg.getTid()); break;
-		case 'J': NumberFormatter::append(text, msg.getOsTid()); break;
+		case 's': sink.append(msg.getSource()); break;
+		case 't': sink.append(msg.getText()); break;
+		case 'l': appendNumber(sink, static_cast<int>(msg.getPriority())); break;
+		case 'p': sink.append(getPriorityName(static_cast<int>(msg.getPriority()))); break;
+		case 'q': sink.append(getPriorityName(static_cast<int>(msg.getPriority())).at(0)); break;
+		case 'P': appendNumber(sink, msg.getPid()); break;
+		case 'T': sink.append(msg.getThread()); break;
+		case 'I': appendNumber(sink, msg.getTid()); break;
+		case 'J': appendNumber(sink, msg.getOsTid()); break;
 		case 'N':
 			if (_cachedNodeName.empty())
 				_cachedNodeName = Environment::nodeName();
-			text.append(_cachedNodeName);
+			sink.append(_cachedNodeName);
+			break;
+		case 'U':
+			if (msg.getSourceFile())
+				sink.append(msg.getSourceFile(), std::strlen(msg.getSourceFile()));
 			break;
-		case 'U': text.append(msg.getSourceFile() ? msg.getSourceFile() : ""); break;
-		case 'O': text.append(extractBasename(msg.getSourceFile())); break;
-		case 'u': NumberFormatter::append(text, msg.getSourceLine()); break;
-		case 'w': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()], 0, 3); break;
-		case 'W': text.append(DateTimeFormat::WEEKDAY_NAMES[dateTime.dayOfWeek()]); break;
-		case 'b': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1], 0, 3); break;
-		case 'B': text.append(DateTimeFormat::MONTH_NAMES[dateTime.month() - 1]); break;
-		case 'd': NumberFormatter::append0(text, dateTime.day(), 2); break;
-		case 'e': NumberFormatter::append(text, dateTime.day()); break;
-		case 'f': NumberFormatter::append(text, dateTime.day(), 2); break;
-		case 'm': NumberFormatter::append0(text, dateTime.month(), 2); break;
-		case 'n': NumberFormatter::append(text, dateTime.month()); break;
-		case 'o': NumberFormatter::append(text, dateTime.month(), 2); break;
-		case 'y': NumberFormatter::append0(text, dateTime.year() % 100, 2); break;
-		case 'Y': NumberFormatter::append0(text, dateTime.year(), 4); break;
-		case 'H': NumberFormatter::append0(text, dateTime.hour(), 2); break;
-		case 'h': NumberFormatter::append0(text, dateTime.hourAMPM(), 2); break;
-		case 'a': text.append(dateTime.isAM() ? "am" : "pm"); break;
-		case 'A': text.append(dateTime.isAM() ? "AM" : "PM"); break;
-		case 'M': NumberFormatter::append0(text, dateTime.minute(), 2); break;
-		case 'S': NumberFormatter::append0(text, dateTime.second(), 2); break;
-		case 'i': NumberFormatter::append0(text, dateTime.millisecond(), 3); break;
-		case 'c': NumberFormatter::append0(text, dateTime.millisecond()/10, 2); break;
-		case 'F': NumberFormatter::append0(text, dateTime.millisecond()*1000 + dateTime.microsecond(), 6); break;
-		case 'z': text.append(DateTimeFormatter::tzdISO(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
-		case 'Z': text.append(DateTimeFormatter::tzdRFC(localTime ? Timezone::tzd() : DateTimeFormatter::UTC)); break;
-		case 'E': NumberFormatter::append(text, msg.getTime().epochTime()); break;
+		case 'O':
+			{
+				const char* basename = extractBasename(msg.getSourceFile());
+				sink.append(basename, std::strlen(basename));
+			}
+			break;
+		case 'u': appendNumber(sink, msg.getSourceLine()); break;
+		case 'i': appendNumber(sink, micros/1000, 3); break;
+		case 'c': appendNumber(sink, micros/10000, 2); break;
+		case 'F': appendNumber(sink, micros, 6); break;
+		case 'z':
+		case 'Z':
+			if (!haveFields)
+			{
+				getTimeFields(epochSecond, localTime, fields);
+				haveFields = true;
+			}
+			appendTzd(sink, fields.tzd, pa.key == 'z');
+			break;
+		case 'E': appendNumber(sink, msg.getTime().epochTime()); break;
 		case 'v':
 			if (pa.length > msg.getSource().length())	//append spaces
-				text.append(msg.getSource()).append(pa.length - msg.getSource().length(), ' ');
+			{
+				sink.append(msg.getSource());
+				sink.append(pa.length - msg.getSource().length(), ' ');
+			}
 			else if (pa.length && pa.length < msg.getSource().length()) // crop
-				text.append(msg.getSource(), msg.getSource().length()-pa.length, pa.length);
+				sink.append(msg.getSource().data() + msg.getSource().length() - pa.length, pa.length);
 			else
-				text.append(msg.getSource());
+				sink.append(msg.getSource());
 			break;
 		case 'x':
-			try
-			{
-				text.append(msg[pa.property]);
-			}
-			catch (...)
-			{
-			}
+			if (msg.has(pa.property))
+				sink.append(msg.get(pa.property));
 			break;
 		case 'L':
 			if (!localTime)
 			{
 				localTime = true;
-				timestamp += Timezone::utcOffset()*Timestamp::resolution();
-				timestamp += Timezone::dst()*Timestamp::resolution();
-				dateTime = timestamp;
+				haveFields = false;
+			}
+			break;
+		default:
+			if (isTimeKey(pa.key))
+			{
+				if (!haveFields)
+				{
+					getTimeFields(epochSecond, localTime, fields);
+					haveFields = true;
+				}
+				formatTime(pa.key, fields, sink);
 			}
 			break;
 		}
@@ -148,6 +341,78 @@ void PatternFormatter::format(const Message& msg, std::string& text)
 }
 
 
+template <class S>
+bool PatternFormatter::formatTime(char key, const TimeFields& fields, S& sink)
+{
+	switch (key)
+	{
+	case 'w': sink.append(DateTimeFormat::WEEKDAY_NAMES[fields.dayOfWeek].data(), 3); break;
+	case 'W': sink.append(DateTimeFormat::WEEKDAY_NAMES[fields.dayOfWeek]); break;
+	case 'b': sink.append(DateTimeFormat::MONTH_NAMES[fields.month - 1].data(), 3); break;
+	case 'B': sink.append(DateTimeFormat::MONTH_NAMES[fields.month - 1]); break;
+	case 'd': appendNumber(sink, fields.day, 2); break;
+	case 'e': appendNumber(sink, fields.day); break;
+	case 'f': appendNumber(sink, fields.day, 2, ' '); break;
+	case 'm': appendNumber(sink, fields.month, 2); break;
+	case 'n': appendNumber(sink, fields.month); break;
+	case 'o': appendNumber(sink, fields.month, 2, ' '); break;
+	case 'y': appendNumber(sink, fields.year % 100, 2); break;
+	case 'Y': appendNumber(sink, fields.year, 4); break;
+	case 'H': appendNumber(sink, fields.hour, 2); break;
+	case 'h':
+		{
+			int hour = fields.hour < 1 ? 12 : (fields.hour > 12 ? fields.hour - 12 : fields.hour);
+			appendNumber(sink, hour, 2);
+		}
+		break;
+	case 'a': sink.append(fields.hour < 12 ? "am" : "pm", 2); break;
+	case 'A': sink.append(fields.hour < 12 ? "AM" : "PM", 2); break;
+	case 'M': appendNumber(sink, fields.minute, 2); break;
+	case 'S': appendNumber(sink, fields.second, 2); break;
+	default: return false;
+	}
+	return true;
+}
+
+
+void PatternFormatter::getTimeFields(Timestamp::TimeVal epochSecond, bool localTime, TimeFields& fields)
+{
+	TimeFields& cached = _timeCache[localTime ? 1 : 0];
+	{
+		SpinlockMutex::ScopedLock lock(_timeCacheMutex);
+		if (cached.epochSecond == epochSecond)
+		{
+			fields = cached;
+			return;
+		}
+	}
+
+	fields.epochSecond = epochSecond;
+	fields.tzd = localTime ? Timezone::tzd() : DateTimeFormatter::UTC;
+	Timestamp::TimeVal second = localTime ? epochSecond + fields.tzd : epochSecond;
+	DateTime dateTime(Timestamp(second*Timestamp::resolution()));
+	fields.year      = dateTime.year();
+	fields.month     = dateTime.month();
+	fields.day       = dateTime.day();
+	fields.dayOfWeek = dateTime.dayOfWeek();
+	fields.hour      = dateTime.hour();
+	fields.minute    = dateTime.minute();
+	fields.second    = dateTime.second();
+
+	BufferSink sink(fields.prefix, MAX_PREFIX_LENGTH);
+	for (std::size_t i = 0; i < _prefixActions; ++i)
+	{
+		const PatternAction& pa = _patternActions[i];
+		sink.append(pa.prepend);
+		formatTime(pa.key, fields, sink);
+	}
+	fields.prefixLength = sink.length();
+
+	SpinlockMutex::ScopedLock lock(_timeCacheMutex);
+	cached = fields;
+}
+
+
 void PatternFormatter::parsePattern()
 {
 	_patternActions.clear();
@@ -204,6 +469,26 @@ void PatternFormatter::parsePattern()
 	{
 		_patternActions.push_back(endAct);
 	}
+
+	// The leading date/time fields that only change once per
+	// second make up the timestamp prefix. %L may precede them.
+	_prefixActions = 0;
+	_prefixLocalTime = false;
+	bool timeKeys = false;
+	std::size_t n = 0;
+	for (const auto& pa: _patternActions)
+	{
+		if (pa.key == 'L' && !timeKeys)
+			_prefixLocalTime = true;
+		else if (isTimeKey(pa.key))
+			timeKeys = true;
+		else
+			break;
+		++n;
+	}
+	if (timeKeys) _prefixActions = n;
+
+	resetTimeCache();
 }
 
 
@@ -218,6 +503,7 @@ void PatternFormatter::setProperty(const std::string& name, const std::string& v
 	{
 		_localTime = (value == "local");
 		_localTimeSet = true;
+		resetTimeCache();
 	}
 	else if (name == PROP_PRIORITY_NAMES)
 	{
@@ -256,6 +542,17 @@ bool PatternFormatter::isLocalTimeConfigured() const
 }
 
 
+void PatternFormatter::resetTimeCache()
+{
+	SpinlockMutex::ScopedLock lock(_timeCacheMutex);
+
+	for (auto& fields: _timeCache)
+	{
+		fields.epochSecond = Timestamp::TIMEVAL_MIN;
+	}
+}
+
+
 void PatternFormatter::parsePriorityNames()
 {
 	StringTokenizer st(_priorityNames, ",;", StringTokenizer::TOK_TRIM);
@@ -16,7 +16,11 @@
 
 
 #include "Poco/SHA1Engine.h"
+#include "Poco/CPUFeatures.h"
 #include <cstring>
+#if defined(POCO_CPU_X86)
+#include <immintrin.h>
+#endif
 
 
 #ifdef POCO_ARCH_LITTLE_ENDIAN
@@ -29,6 +33,65 @@
 namespace Poco {
 
 
+#if defined(POCO_CPU_X86)
+
+
+namespace
+{
+	template <int F>
+	POCO_TARGET("sha,sse4.1")
+	inline void sha1Rounds(__m128i& abcd, __m128i& e, __m128i& prev, __m128i* w, int first)
+		/// Performs five groups of four rounds using round function F,
+		/// extending the message schedule held in w as it goes.
+	{
+		for (int i = first; i < first + 5; i++)
+		{
+			__m128i& wi = w[i & 3];
+			if (i >= 4)
+			{
+				// w[i] = (w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16]) <<< 1
+				wi = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(wi, w[(i + 1) & 3]), w[(i + 2) & 3]), w[(i + 3) & 3]);
+			}
+			if (i > 0) e = _mm_sha1nexte_epu32(prev, wi);
+			else e = _mm_add_epi32(e, wi);
+			prev = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e, F);
+		}
+	}
+
+
+	POCO_TARGET("sha,sse4.1")
+	void sha1BlocksSHA(UInt32 state[5], const UInt8* data, std::size_t blocks)
+	{
+		const __m128i mask = _mm_set_epi64x(0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+		__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+		__m128i e0 = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+		while (blocks-- > 0)
+		{
+			const __m128i abcdSave = abcd;
+			const __m128i eSave = e0;
+			__m128i w[4];
+			for (int i = 0; i < 4; i++)
+				w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16*i)), mask);
+			__m128i e = e0;
+			__m128i prev = abcd;
+			sha1Rounds<0>(abcd, e, prev, w, 0);
+			sha1Rounds<1>(abcd, e, prev, w, 5);
+			sha1Rounds<2>(abcd, e, prev, w, 10);
+			sha1Rounds<3>(abcd, e, prev, w, 15);
+			e0 = _mm_sha1nexte_epu32(prev, eSave);
+			abcd = _mm_add_epi32(abcd, abcdSave);
+			data += 64;
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(abcd, 0x1B));
+		state[4] = static_cast<UInt32>(_mm_extract_epi32(e0, 3));
+	}
+}
+
+
+#endif
+
+
 SHA1Engine::SHA1Engine()
 {
 	_digest.reserve(16);
@@ -66,18 +129,31 @@ void SHA1Engine::updateImpl(const void* buffer_, std::size_t count)
 	_context.countLo += ((UInt32) count << 3);
 	_context.countHi += ((UInt32 ) count >> 29);
 
-	/* Process data in BLOCK_SIZE chunks */
-	while (count-- > 0)
+	/* Complete a partial block saved by a previous call */
+	if (_context.slop > 0)
 	{
-		db[_context.slop++] = *(buffer++);
-		if (_context.slop == BLOCK_SIZE)
-		{
-			/* transform this one block */
-			SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-			transform();
-			_context.slop = 0 ;	/* no slop left */
-		}
+		std::size_t n = BLOCK_SIZE - _context.slop;
+		if (n > count) n = count;
+		std::memcpy(db + _context.slop, buffer, n);
+		_context.slop += static_cast<UInt32>(n);
+		buffer += n;
+		count -= n;
+		if (_context.slop < BLOCK_SIZE) return;
+		transformBlocks(db, 1);
+		_context.slop = 0;
 	}
+
+	/* Process complete blocks directly from the input */
+	if (count >= BLOCK_SIZE)
+	{
+		transformBlocks(buffer, count/BLOCK_SIZE);
+		buffer += count - count % BLOCK_SIZE;
+		count %= BLOCK_SIZE;
+	}
+
+	/* Save the rest for the next call */
+	std::memcpy(db, buffer, count);
+	_context.slop = static_cast<UInt32>(count);
 }
 
 
@@ -106,38 +182,38 @@ const DigestEngine::Digest& SHA1Engine::digest()
 	int count;
 	UInt32 lowBitcount  = _context.countLo;
 	UInt32 highBitcount = _context.countHi;
+	BYTE* db = (BYTE*) &_context.data[0];
 
 	/* Compute number of bytes mod 64 */
 	count = (int) ((_context.countLo >> 3) & 0x3F);
 
 	/* Set the first char of padding to 0x80.  This is safe since there is
 		always at least one byte free */
-	((BYTE*) _context.data)[count++] = 0x80;
+	db[count++] = 0x80;
 
 	/* Pad out to 56 mod 64 */
 	if (count > 56)
 	{
 		/* Two lots of padding:  Pad the first block to 64 bytes */
-		std::memset((BYTE*) &_context.data + count, 0, 64 - count);
-		SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-		transform();
+		std::memset(db + count, 0, 64 - count);
+		transformBlocks(db, 1);
 
 		/* Now fill the next block with 56 bytes */
-		std::memset(&_context.data, 0, 56);
+		std::memset(db, 0, 56);
 	}
 	else
 	{
 		/* Pad block to 56 bytes */
-		std::memset((BYTE*) &_context.data + count, 0, 56 - count);
+		std::memset(db + count, 0, 56 - count);
 	}
-	SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-
-	/* Append length in bits and transform */
-	_context.data[14] = highBitcount;
-	_context.data[15] = lowBitcount;
 
-	transform();
-	SHA1_BYTE_REVERSE(_context.data, DIGEST_SIZE);
+	/* Append length in bits (big endian) and transform */
+	for (count = 0; count < 4; count++)
+	{
+		db[56 + count] = (BYTE) (highBitcount >> (8*(3 - count)));
+		db[60 + count] = (BYTE) (lowBitcount >> (8*(3 - count)));
+	}
+	transformBlocks(db, 1);
 
 	unsigned char hash[DIGEST_SIZE];
 	for (count = 0; count < DIGEST_SIZE; count++)
@@ -224,6 +300,26 @@ typedef UInt32 UL;	/* to save space */
 }
 
 
+void SHA1Engine::transformBlocks(const UInt8* data, std::size_t blocks)
+{
+#if defined(POCO_CPU_X86)
+	if (CPUFeatures::hasSHA())
+	{
+		sha1BlocksSHA(_context.digest, data, blocks);
+		return;
+	}
+#endif
+	while (blocks-- > 0)
+	{
+		if (data != reinterpret_cast<const UInt8*>(_context.data))
+			std::memcpy(_context.data, data, BLOCK_SIZE);
+		SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
+		transform();
+		data += BLOCK_SIZE;
+	}
+}
+
+
 void SHA1Engine::transform()
 {
 	UInt32 W[80];
@@ -21,7 +21,13 @@
 
 
 #include "Poco/SHA2Engine.h"
+#include "Poco/CPUFeatures.h"
 #include <string.h>
+#if defined(POCO_CPU_X86)
+#include <immintrin.h>
+#elif defined(POCO_CPU_NEON) && defined(__ARM_FEATURE_SHA2)
+#include <arm_neon.h>
+#endif
 
 
 namespace Poco {
@@ -244,6 +250,262 @@ void _sha256_process(HASHCONTEXT* pContext, const unsigned char data[64])
 }
 
 
+#if defined(POCO_CPU_X86)
+
+
+POCO_TARGET("sha,sse4.1")
+static void _sha256_process_sha(Poco::UInt32 state[8], const unsigned char* data, std::size_t blocks)
+{
+	const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+
+	// The SHA-256 instructions keep the state as ABEF and CDGH.
+	__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+	__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+	__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+	while (blocks-- > 0)
+	{
+		const __m128i abefSave = state0;
+		const __m128i cdghSave = state1;
+		__m128i w[4];
+		for (int i = 0; i < 4; i++)
+			w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16*i)), mask);
+		for (int i = 0; i < 16; i++)
+		{
+			__m128i& wi = w[i & 3];
+			if (i >= 4)
+			{
+				// w[i] = s1(w[i-2]) + w[i-7] + s0(w[i-15]) + w[i-16]
+				tmp = _mm_add_epi32(_mm_sha256msg1_epu32(wi, w[(i + 1) & 3]), _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+				wi = _mm_sha256msg2_epu32(tmp, w[(i + 3) & 3]);
+			}
+			__m128i msg = _mm_add_epi32(wi, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&K32[4*i])));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+		state0 = _mm_add_epi32(state0, abefSave);
+		state1 = _mm_add_epi32(state1, cdghSave);
+		data += 64;
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+
+#elif defined(POCO_CPU_NEON) && defined(__ARM_FEATURE_SHA2)
+
+
+static void _sha256_process_sha(Poco::UInt32 state[8], const unsigned char* data, std::size_t blocks)
+{
+	uint32x4_t state0 = vld1q_u32(&state[0]);
+	uint32x4_t state1 = vld1q_u32(&state[4]);
+	while (blocks-- > 0)
+	{
+		const uint32x4_t abcdSave = state0;
+		const uint32x4_t efghSave = state1;
+		uint32x4_t w[4];
+		for (int i = 0; i < 4; i++)
+			w[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16*i)));
+		for (int i = 0; i < 16; i++)
+		{
+			const uint32x4_t msg = vaddq_u32(w[i & 3], vld1q_u32(&K32[4*i]));
+			if (i < 12)
+				w[i & 3] = vsha256su1q_u32(vsha256su0q_u32(w[i & 3], w[(i + 1) & 3]), w[(i + 2) & 3], w[(i + 3) & 3]);
+			const uint32x4_t abcd = state0;
+			state0 = vsha256hq_u32(state0, state1, msg);
+			state1 = vsha256h2q_u32(state1, abcd, msg);
+		}
+		state0 = vaddq_u32(state0, abcdSave);
+		state1 = vaddq_u32(state1, efghSave);
+		data += 64;
+	}
+	vst1q_u32(&state[0], state0);
+	vst1q_u32(&state[4], state1);
+}
+
+
+#endif
+
+
+static void _sha256_process_blocks(HASHCONTEXT* pContext, const unsigned char* data, std::size_t blocks)
+{
+#if defined(POCO_CPU_X86)
+	if (Poco::CPUFeatures::hasSHA())
+	{
+		_sha256_process_sha(pContext->state.state32, data, blocks);
+		return;
+	}
+#elif defined(POCO_CPU_NEON) && defined(__ARM_FEATURE_SHA2)
+	_sha256_process_sha(pContext->state.state32, data, blocks);
+	return;
+#endif
+	while (blocks-- > 0)
+	{
+		_sha256_process(pContext, data);
+		data += 64;
+	}
+}
+
+
+#if defined(POCO_CPU_X86)
+
+
+namespace
+{
+	template <int N>
+	POCO_TARGET("avx2")
+	inline __m256i rotr(__m256i x)
+	{
+		return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+	}
+
+
+	POCO_TARGET("avx2")
+	void sha256CompressAVX2(Poco::UInt32 state[8][8], const unsigned char* blocks[8])
+		/// Processes one block for each of eight independent messages.
+		/// Word i of the state of message j is state[i][j].
+	{
+		__m256i w[64];
+		alignas(32) Poco::UInt32 column[8];
+		for (int t = 0; t < 16; t++)
+		{
+			for (int j = 0; j < 8; j++) GET_UINT32(column[j], blocks[j], 4*t);
+			w[t] = _mm256_load_si256(reinterpret_cast<const __m256i*>(column));
+		}
+		for (int t = 16; t < 64; t++)
+		{
+			const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr<7>(w[t - 15]), rotr<18>(w[t - 15])), _mm256_srli_epi32(w[t - 15], 3));
+			const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr<17>(w[t - 2]), rotr<19>(w[t - 2])), _mm256_srli_epi32(w[t - 2], 10));
+			w[t] = _mm256_add_epi32(_mm256_add_epi32(s1, w[t - 7]), _mm256_add_epi32(s0, w[t - 16]));
+		}
+
+		__m256i v[8];
+		for (int i = 0; i < 8; i++) v[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[i]));
+		__m256i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+		for (int t = 0; t < 64; t++)
+		{
+			const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr<6>(e), rotr<11>(e)), rotr<25>(e));
+			const __m256i ch = _mm256_xor_si256(g, _mm256_and_si256(e, _mm256_xor_si256(f, g)));
+			const __m256i temp1 = _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, _mm256_add_epi32(w[t], _mm256_set1_epi32(static_cast<int>(K32[t])))));
+			const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr<2>(a), rotr<13>(a)), rotr<22>(a));
+			const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+			h = g;
+			g = f;
+			f = e;
+			e = _mm256_add_epi32(d, temp1);
+			d = c;
+			c = b;
+			b = a;
+			a = _mm256_add_epi32(temp1, _mm256_add_epi32(S0, maj));
+		}
+		const __m256i r[8] = {a, b, c, d, e, f, g, h};
+		for (int i = 0; i < 8; i++)
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[i]), _mm256_add_epi32(v[i], r[i]));
+	}
+
+
+	struct Lane
+		/// A message being hashed in one of the vector lanes.
+	{
+		const unsigned char* data = nullptr;
+		std::size_t blocks = 0;
+		unsigned char tail[128];
+		std::size_t tailBlocks = 0;
+		std::size_t tailNext = 0;
+		std::size_t message = 0;
+		bool active = false;
+
+		void start(std::string_view m, std::size_t index)
+		{
+			data = reinterpret_cast<const unsigned char*>(m.data());
+			blocks = m.size()/64;
+			const std::size_t rest = m.size() % 64;
+			memset(tail, 0, sizeof(tail));
+			if (rest > 0) memcpy(tail, data + 64*blocks, rest);
+			tail[rest] = 0x80;
+			tailBlocks = rest < 56 ? 1 : 2;
+			tailNext = 0;
+			const Poco::UInt64 bits = static_cast<Poco::UInt64>(m.size()) << 3;
+			PUT_UINT64(bits, tail, 64*tailBlocks - 8);
+			message = index;
+			active = true;
+		}
+
+		const unsigned char* next()
+		{
+			if (blocks > 0)
+			{
+				const unsigned char* p = data;
+				data += 64;
+				blocks--;
+				return p;
+			}
+			return tail + 64*tailNext++;
+		}
+
+		bool done() const
+		{
+			return blocks == 0 && tailNext == tailBlocks;
+		}
+	};
+
+
+	void sha256DigestManyAVX2(const std::vector<std::string_view>& messages, const Poco::UInt32 iv[8], std::size_t digestLength, std::vector<Poco::DigestEngine::Digest>& digests)
+	{
+		static const unsigned char zeroBlock[64] = {};
+		Poco::UInt32 state[8][8];
+		Lane lanes[8];
+		std::size_t nextMessage = 0;
+		for (int j = 0; j < 8 && nextMessage < messages.size(); j++)
+		{
+			lanes[j].start(messages[nextMessage], nextMessage);
+			for (int i = 0; i < 8; i++) state[i][j] = iv[i];
+			nextMessage++;
+		}
+
+		bool active = true;
+		while (active)
+		{
+			const unsigned char* blocks[8];
+			for (int j = 0; j < 8; j++)
+				blocks[j] = lanes[j].active ? lanes[j].next() : zeroBlock;
+
+			sha256CompressAVX2(state, blocks);
+
+			active = false;
+			for (int j = 0; j < 8; j++)
+			{
+				Lane& lane = lanes[j];
+				if (lane.active && lane.done())
+				{
+					unsigned char hash[32];
+					for (int i = 0; i < 8; i++) PUT_UINT32(state[i][j], hash, 4*i);
+					digests[lane.message].assign(hash, hash + digestLength);
+					if (nextMessage < messages.size())
+					{
+						lane.start(messages[nextMessage], nextMessage);
+						for (int i = 0; i < 8; i++) state[i][j] = iv[i];
+						nextMessage++;
+					}
+					else lane.active = false;
+				}
+				active = active || lane.active;
+			}
+		}
+	}
+}
+
+
+#endif
+
+
 void _sha512_process(HASHCONTEXT* pContext, const unsigned char data[128])
 {
 	int i;
@@ -304,16 +566,16 @@ void SHA2Engine::updateImpl(const void* buffer_, std::size_t count)
 		if (left && count >= fill)
 		{
 			memcpy((void *)(pContext->buffer + left), data, fill);
-			_sha256_process(pContext, pContext->buffer);
+			_sha256_process_blocks(pContext, pContext->buffer, 1);
 			data += fill;
 			count -= fill;
 			left = 0;
 		}
-		while (count >= 64)
+		if (count >= 64)
 		{
-			_sha256_process(pContext, data);
-			data += 64;
-			count -= 64;
+			_sha256_process_blocks(pContext, data, count/64);
+			data += count - count % 64;
+			count %= 64;
 		}
 	}
 	if (count > 0) memcpy((void *)(pContext->buffer + left), data, count);
@@ -352,8 +614,10 @@ std::size_t SHA2Engine::digestLength() const
 
 void SHA2Engine::reset()
 {
-	free(_context);
-	_context = calloc(1, sizeof(HASHCONTEXT));
+	if (_context == nullptr)
+		_context = calloc(1, sizeof(HASHCONTEXT));
+	else
+		memset(_context, 0, sizeof(HASHCONTEXT));
 	HASHCONTEXT* pContext = (HASHCONTEXT*)_context;
 	if (_algorithm == SHA_224)
 	{
@@ -481,4 +745,39 @@ const DigestEngine::Digest& SHA2Engine::digest()
 }
 
 
+std::vector<DigestEngine::Digest> SHA2Engine::digestMany(const std::vector<std::string_view>& messages, ALGORITHM algorithm)
+{
+#if defined(POCO_CPU_X86)
+	if (algorithm <= SHA_256 && messages.size() > 1 && !CPUFeatures::hasSHA() && CPUFeatures::hasAVX2())
+	{
+		return digestManyAVX2(messages, algorithm);
+	}
+#endif
+	std::vector<DigestEngine::Digest> digests;
+	SHA2Engine engine(algorithm);
+	digests.reserve(messages.size());
+	for (const auto& message: messages)
+	{
+		engine.update(message.data(), message.size());
+		digests.push_back(engine.digest());
+	}
+	return digests;
+}
+
+
+std::vector<DigestEngine::Digest> SHA2Engine::digestManyAVX2(const std::vector<std::string_view>& messages, ALGORITHM algorithm)
+{
+#if defined(POCO_CPU_X86)
+	if (algorithm <= SHA_256 && CPUFeatures::hasAVX2())
+	{
+		SHA2Engine engine(algorithm);
+		std::vector<DigestEngine::Digest> digests(messages.size());
+		sha256DigestManyAVX2(messages, static_cast<HASHCONTEXT*>(engine._context)->state.state32, engine.digestLength(), digests);
+		return digests;
+	}
+#endif
+	return digestMany(messages, algorithm);
+}
+
+
 } // namespace Poco
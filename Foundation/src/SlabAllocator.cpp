@@ -0,0 +1,302 @@
+//
+// SlabAllocator.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  SlabAllocator
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/SlabAllocator.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <new>
+
+
+namespace Poco {
+
+
+namespace
+{
+	const std::size_t SLAB_SIZE = 64*1024;
+	const std::size_t THREAD_CACHE_SIZE = 256*1024;
+	const std::size_t MAX_CACHED_BLOCKS = 256;
+
+	struct FreeBlock
+	{
+		FreeBlock* pNext;
+	};
+
+	struct SizeClass
+	{
+		Poco::FastMutex mutex;
+		FreeBlock* pFree = nullptr;
+		std::size_t freeBlocks = 0;
+		std::vector<char*> slabs;
+		std::size_t blockSize = 0;
+		std::size_t cacheLimit = 0;
+		std::size_t batchSize = 0;
+		std::atomic<std::size_t> totalBlocks{0};
+		std::atomic<std::size_t> refills{0};
+		std::atomic<std::size_t> flushes{0};
+	};
+
+	class CentralCache
+	{
+	public:
+		CentralCache()
+		{
+			std::size_t blockSize = SlabAllocator::MIN_BLOCK_SIZE;
+			for (auto& sc: _classes)
+			{
+				sc.blockSize = blockSize;
+				sc.cacheLimit = THREAD_CACHE_SIZE/blockSize;
+				if (sc.cacheLimit > MAX_CACHED_BLOCKS) sc.cacheLimit = MAX_CACHED_BLOCKS;
+				if (sc.cacheLimit < 2) sc.cacheLimit = 2;
+				sc.batchSize = sc.cacheLimit/2;
+				blockSize *= 2;
+			}
+		}
+
+		SizeClass& sizeClass(int index)
+		{
+			return _classes[index];
+		}
+
+		FreeBlock* take(int index, std::size_t& count)
+			/// Takes up to count blocks from the central free list,
+			/// allocating a new slab if the free list is empty.
+			/// Returns the blocks as a list, and the actual number
+			/// of blocks in count.
+		{
+			SizeClass& sc = _classes[index];
+			Poco::FastMutex::ScopedLock lock(sc.mutex);
+			if (!sc.pFree) newSlab(sc);
+			FreeBlock* pHead = sc.pFree;
+			FreeBlock* pTail = pHead;
+			std::size_t n = 1;
+			while (n < count && pTail->pNext)
+			{
+				pTail = pTail->pNext;
+				++n;
+			}
+			sc.pFree = pTail->pNext;
+			sc.freeBlocks -= n;
+			pTail->pNext = nullptr;
+			count = n;
+			return pHead;
+		}
+
+		void put(int index, FreeBlock* pHead, FreeBlock* pTail, std::size_t count)
+			/// Puts a list of blocks back on the central free list.
+		{
+			SizeClass& sc = _classes[index];
+			Poco::FastMutex::ScopedLock lock(sc.mutex);
+			pTail->pNext = sc.pFree;
+			sc.pFree = pHead;
+			sc.freeBlocks += count;
+		}
+
+		SlabAllocator::Statistics statistics(int index)
+		{
+			SizeClass& sc = _classes[index];
+			SlabAllocator::Statistics stats;
+			stats.blockSize = sc.blockSize;
+			stats.totalBlocks = sc.totalBlocks.load(std::memory_order_relaxed);
+			stats.refills = sc.refills.load(std::memory_order_relaxed);
+			stats.flushes = sc.flushes.load(std::memory_order_relaxed);
+			Poco::FastMutex::ScopedLock lock(sc.mutex);
+			stats.freeBlocks = sc.freeBlocks;
+			return stats;
+		}
+
+	private:
+		void newSlab(SizeClass& sc)
+		{
+			std::size_t blocks = SLAB_SIZE/sc.blockSize;
+			if (blocks < sc.batchSize) blocks = sc.batchSize;
+			if (blocks < 1) blocks = 1;
+			char* pSlab = new char[blocks*sc.blockSize];
+			sc.slabs.push_back(pSlab);
+			for (std::size_t i = 0; i < blocks; ++i)
+			{
+				FreeBlock* pBlock = reinterpret_cast<FreeBlock*>(pSlab + i*sc.blockSize);
+				pBlock->pNext = sc.pFree;
+				sc.pFree = pBlock;
+			}
+			sc.freeBlocks += blocks;
+			sc.totalBlocks.fetch_add(blocks, std::memory_order_relaxed);
+		}
+
+		SizeClass _classes[SlabAllocator::SIZE_CLASSES];
+	};
+
+	CentralCache& centralCache()
+	{
+		// Intentionally never destroyed, as thread caches may
+		// still return blocks during static destruction.
+		static CentralCache* pCache = new CentralCache;
+		return *pCache;
+	}
+
+	thread_local bool threadCacheDestroyed = false;
+
+	class ThreadCache
+	{
+	public:
+		ThreadCache()
+		{
+			for (int i = 0; i < SlabAllocator::SIZE_CLASSES; ++i)
+			{
+				_pFree[i] = nullptr;
+				_count[i] = 0;
+			}
+		}
+
+		~ThreadCache()
+		{
+			flush();
+			threadCacheDestroyed = true;
+		}
+
+		void* allocate(int index)
+		{
+			if (!_pFree[index])
+			{
+				SizeClass& sc = centralCache().sizeClass(index);
+				std::size_t count = sc.batchSize;
+				_pFree[index] = centralCache().take(index, count);
+				_count[index] = count;
+				sc.refills.fetch_add(1, std::memory_order_relaxed);
+			}
+			FreeBlock* pBlock = _pFree[index];
+			_pFree[index] = pBlock->pNext;
+			--_count[index];
+			return pBlock;
+		}
+
+		void deallocate(int index, void* ptr)
+		{
+			FreeBlock* pBlock = static_cast<FreeBlock*>(ptr);
+			pBlock->pNext = _pFree[index];
+			_pFree[index] = pBlock;
+			SizeClass& sc = centralCache().sizeClass(index);
+			if (++_count[index] > sc.cacheLimit)
+			{
+				release(index, sc.batchSize);
+				sc.flushes.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		void flush()
+		{
+			for (int i = 0; i < SlabAllocator::SIZE_CLASSES; ++i)
+			{
+				if (_count[i] > 0) release(i, _count[i]);
+			}
+		}
+
+	private:
+		void release(int index, std::size_t count)
+			/// Moves count blocks from the head of the
+			/// thread's list to the central free list.
+		{
+			FreeBlock* pHead = _pFree[index];
+			FreeBlock* pTail = pHead;
+			for (std::size_t n = 1; n < count; ++n) pTail = pTail->pNext;
+			_pFree[index] = pTail->pNext;
+			_count[index] -= count;
+			centralCache().put(index, pHead, pTail, count);
+		}
+
+		FreeBlock* _pFree[SlabAllocator::SIZE_CLASSES];
+		std::size_t _count[SlabAllocator::SIZE_CLASSES];
+	};
+
+	thread_local ThreadCache threadCache;
+
+	int sizeClassIndex(std::size_t size)
+	{
+		std::size_t blockSize = SlabAllocator::MIN_BLOCK_SIZE;
+		int index = 0;
+		while (blockSize < size)
+		{
+			blockSize *= 2;
+			++index;
+		}
+		return index;
+	}
+}
+
+
+void* SlabAllocator::allocate(std::size_t size)
+{
+	if (size > MAX_BLOCK_SIZE) return ::operator new(size);
+
+	int index = sizeClassIndex(size);
+	if (threadCacheDestroyed)
+	{
+		std::size_t count = 1;
+		return centralCache().take(index, count);
+	}
+	else
+	{
+		return threadCache.allocate(index);
+	}
+}
+
+
+void SlabAllocator::deallocate(void* ptr, std::size_t size) noexcept
+{
+	if (!ptr) return;
+	if (size > MAX_BLOCK_SIZE)
+	{
+		::operator delete(ptr);
+		return;
+	}
+
+	int index = sizeClassIndex(size);
+	if (threadCacheDestroyed)
+	{
+		FreeBlock* pBlock = static_cast<FreeBlock*>(ptr);
+		centralCache().put(index, pBlock, pBlock, 1);
+	}
+	else
+	{
+		threadCache.deallocate(index, ptr);
+	}
+}
+
+
+std::size_t SlabAllocator::blockSize(std::size_t size)
+{
+	if (size > MAX_BLOCK_SIZE) return size;
+
+	return centralCache().sizeClass(sizeClassIndex(size)).blockSize;
+}
+
+
+void SlabAllocator::flushThreadCache()
+{
+	if (!threadCacheDestroyed) threadCache.flush();
+}
+
+
+std::vector<SlabAllocator::Statistics> SlabAllocator::statistics()
+{
+	std::vector<Statistics> result;
+	result.reserve(SIZE_CLASSES);
+	for (int i = 0; i < SIZE_CLASSES; ++i)
+	{
+		result.push_back(centralCache().statistics(i));
+	}
+	return result;
+}
+
+
+} // namespace Poco
@@ -0,0 +1,468 @@
+//
+// TimerWheel.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TimerWheel
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/TimerWheel.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	inline int countTrailingZeros(UInt64 bits)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(bits);
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanForward64(&index, bits);
+		return static_cast<int>(index);
+#else
+		int n = 0;
+		while ((bits & 1) == 0)
+		{
+			bits >>= 1;
+			++n;
+		}
+		return n;
+#endif
+	}
+}
+
+
+const TimerWheel::TimerId TimerWheel::INVALID_TIMER;
+const UInt32 TimerWheel::NIL;
+
+
+TimerWheel::TimerWheel(const Timespan& resolution):
+	_resolution(resolution.totalMicroseconds()),
+	_currentTick(0),
+	_size(0),
+	_freeList(NIL),
+	_sleeping(false),
+	_wakeUpTick(0)
+{
+	if (_resolution < 1) throw InvalidArgumentException("TimerWheel resolution must be at least one microsecond");
+
+	std::fill(_slots, _slots + LEVELS*SLOTS, NIL);
+	std::fill(_bitmap, _bitmap + BITMAP_WORDS, 0);
+}
+
+
+TimerWheel::~TimerWheel()
+{
+}
+
+
+TimerWheel::TimerId TimerWheel::schedule(const Clock& expiry, Callback callback)
+{
+	TimerId id;
+	bool wakeUp;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		UInt32 index = allocate();
+		Node& node = _nodes[index];
+		node.callback = std::move(callback);
+		node.expiry = expiryTick(expiry);
+		insert(index, _currentTick + 1);
+		++_size;
+		id = (static_cast<TimerId>(node.generation) << 32) | index;
+		wakeUp = mustWakeUp(node.expiry);
+	}
+	if (wakeUp && _wakeUp) _wakeUp();
+	return id;
+}
+
+
+TimerWheel::TimerId TimerWheel::schedule(const Timespan& delay, Callback callback)
+{
+	Clock expiry;
+	expiry += delay.totalMicroseconds();
+	return schedule(expiry, std::move(callback));
+}
+
+
+bool TimerWheel::reschedule(TimerId id, const Clock& expiry)
+{
+	bool wakeUp;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		Node* pNode = find(id);
+		if (!pNode) return false;
+
+		UInt32 index = static_cast<UInt32>(id & 0xFFFFFFFF);
+		unlink(index);
+		pNode->expiry = expiryTick(expiry);
+		insert(index, _currentTick + 1);
+		wakeUp = mustWakeUp(pNode->expiry);
+	}
+	if (wakeUp && _wakeUp) _wakeUp();
+	return true;
+}
+
+
+bool TimerWheel::reschedule(TimerId id, const Timespan& delay)
+{
+	Clock expiry;
+	expiry += delay.totalMicroseconds();
+	return reschedule(id, expiry);
+}
+
+
+bool TimerWheel::cancel(TimerId id)
+{
+	Callback callback;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		Node* pNode = find(id);
+		if (!pNode) return false;
+
+		// The callback is destroyed without holding the lock.
+		callback = std::move(pNode->callback);
+		UInt32 index = static_cast<UInt32>(id & 0xFFFFFFFF);
+		unlink(index);
+		release(index);
+	}
+	return true;
+}
+
+
+bool TimerWheel::isScheduled(TimerId id) const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return find(id) != nullptr;
+}
+
+
+std::size_t TimerWheel::advance()
+{
+	return advance(Clock());
+}
+
+
+std::size_t TimerWheel::advance(const Clock& now)
+{
+	std::vector<Callback> expired;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		_sleeping = false;
+		UInt64 tick = currentTick(now);
+		if (tick > _currentTick) advanceTo(tick, expired);
+	}
+	for (auto& callback: expired)
+	{
+		try
+		{
+			callback();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+	return expired.size();
+}
+
+
+Timespan TimerWheel::nextTimeout(const Timespan& maxTimeout)
+{
+	Clock now;
+	Clock::ClockDiff elapsed = now - _start;
+	Timespan::TimeDiff timeout = maxTimeout.totalMicroseconds();
+
+	FastMutex::ScopedLock lock(_mutex);
+
+	if (_size > 0)
+	{
+		// Without looking at the higher levels, the next expiry is only
+		// known up to the end of the current rotation of the lowest level.
+		UInt64 wrap = (_currentTick | SLOT_MASK) + 1;
+		UInt64 next = wrap;
+		if (_currentTick + 1 < wrap)
+		{
+			int index = findSlot(static_cast<int>((_currentTick + 1) & SLOT_MASK), SLOT_MASK);
+			if (index >= 0) next = (_currentTick & ~static_cast<UInt64>(SLOT_MASK)) + index;
+		}
+		Clock::ClockDiff until = static_cast<Clock::ClockDiff>(next)*_resolution - elapsed;
+		if (until < 0) until = 0;
+		until = ((until + 999)/1000)*1000;
+		if (until < timeout) timeout = until;
+	}
+	if (timeout < 0) timeout = 0;
+	_sleeping = true;
+	_wakeUpTick = static_cast<UInt64>((elapsed + timeout)/_resolution);
+	return Timespan(timeout);
+}
+
+
+void TimerWheel::setWakeUpCallback(const Callback& wakeUp)
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	_wakeUp = wakeUp;
+}
+
+
+void TimerWheel::clear()
+{
+	std::vector<Callback> callbacks;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		callbacks.reserve(_size);
+		for (UInt32 index = 0; index < _nodes.size(); ++index)
+		{
+			if (_nodes[index].slot != NIL)
+			{
+				callbacks.push_back(std::move(_nodes[index].callback));
+				release(index);
+			}
+		}
+		std::fill(_slots, _slots + LEVELS*SLOTS, NIL);
+		std::fill(_bitmap, _bitmap + BITMAP_WORDS, 0);
+	}
+}
+
+
+std::size_t TimerWheel::size() const
+{
+	FastMutex::ScopedLock lock(_mutex);
+
+	return _size;
+}
+
+
+bool TimerWheel::empty() const
+{
+	return size() == 0;
+}
+
+
+UInt64 TimerWheel::expiryTick(const Clock& expiry) const
+{
+	// Round up, so that a timer never expires early.
+	Clock::ClockDiff diff = expiry - _start;
+	if (diff <= 0) return 0;
+	return static_cast<UInt64>((diff + _resolution - 1)/_resolution);
+}
+
+
+UInt64 TimerWheel::currentTick(const Clock& now) const
+{
+	Clock::ClockDiff diff = now - _start;
+	if (diff <= 0) return 0;
+	return static_cast<UInt64>(diff/_resolution);
+}
+
+
+TimerWheel::Node* TimerWheel::find(TimerId id)
+{
+	UInt32 index = static_cast<UInt32>(id & 0xFFFFFFFF);
+	UInt32 generation = static_cast<UInt32>(id >> 32);
+	if (index < _nodes.size() && _nodes[index].slot != NIL && _nodes[index].generation == generation)
+		return &_nodes[index];
+	else
+		return nullptr;
+}
+
+
+const TimerWheel::Node* TimerWheel::find(TimerId id) const
+{
+	return const_cast<TimerWheel*>(this)->find(id);
+}
+
+
+UInt32 TimerWheel::allocate()
+{
+	if (_freeList != NIL)
+	{
+		UInt32 index = _freeList;
+		_freeList = _nodes[index].next;
+		return index;
+	}
+	if (_nodes.size() >= NIL) throw Poco::RangeException("Too many timers");
+	_nodes.emplace_back();
+	return static_cast<UInt32>(_nodes.size() - 1);
+}
+
+
+void TimerWheel::release(UInt32 index)
+{
+	Node& node = _nodes[index];
+	node.callback = nullptr;
+	node.slot = NIL;
+	node.prev = NIL;
+	node.next = _freeList;
+	if (++node.generation == 0) node.generation = 1;
+	_freeList = index;
+	--_size;
+}
+
+
+void TimerWheel::insert(UInt32 index, UInt64 minTick)
+{
+	Node& node = _nodes[index];
+	UInt64 tick = node.expiry > minTick ? node.expiry : minTick;
+	UInt64 delta = tick - _currentTick;
+	int level = 0;
+	while (level < LEVELS - 1 && delta >= (static_cast<UInt64>(1) << (SLOT_BITS*(level + 1))))
+		++level;
+
+	// Timers beyond the range of the highest level are placed in its
+	// last slot, and are placed again when that slot is cascaded.
+	const UInt64 range = static_cast<UInt64>(1) << (SLOT_BITS*LEVELS);
+	if (delta >= range) tick = _currentTick + range - 1;
+
+	UInt32 slot = static_cast<UInt32>(level*SLOTS + ((tick >> (SLOT_BITS*level)) & SLOT_MASK));
+	node.slot = slot;
+	node.prev = NIL;
+	node.next = _slots[slot];
+	if (node.next != NIL) _nodes[node.next].prev = index;
+	_slots[slot] = index;
+	if (level == 0) _bitmap[slot/64] |= static_cast<UInt64>(1) << (slot % 64);
+}
+
+
+void TimerWheel::unlink(UInt32 index)
+{
+	Node& node = _nodes[index];
+	if (node.prev != NIL)
+		_nodes[node.prev].next = node.next;
+	else
+		_slots[node.slot] = node.next;
+	if (node.next != NIL)
+		_nodes[node.next].prev = node.prev;
+	if (node.slot < SLOTS && _slots[node.slot] == NIL)
+		_bitmap[node.slot/64] &= ~(static_cast<UInt64>(1) << (node.slot % 64));
+	node.slot = NIL;
+	node.prev = NIL;
+	node.next = NIL;
+}
+
+
+void TimerWheel::cascade(int level)
+{
+	UInt32 slot = static_cast<UInt32>(level*SLOTS + ((_currentTick >> (SLOT_BITS*level)) & SLOT_MASK));
+	UInt32 index = _slots[slot];
+	_slots[slot] = NIL;
+	while (index != NIL)
+	{
+		UInt32 next = _nodes[index].next;
+		// the current slot has not been expired yet
+		insert(index, _currentTick);
+		index = next;
+	}
+}
+
+
+void TimerWheel::expire(std::vector<Callback>& expired)
+{
+	UInt32 slot = static_cast<UInt32>(_currentTick & SLOT_MASK);
+	UInt32 index = _slots[slot];
+	_slots[slot] = NIL;
+	_bitmap[slot/64] &= ~(static_cast<UInt64>(1) << (slot % 64));
+	while (index != NIL)
+	{
+		UInt32 next = _nodes[index].next;
+		expired.push_back(std::move(_nodes[index].callback));
+		release(index);
+		index = next;
+	}
+}
+
+
+void TimerWheel::advanceTo(UInt64 tick, std::vector<Callback>& expired)
+{
+	while (_currentTick < tick)
+	{
+		if (_size == 0)
+		{
+			_currentTick = tick;
+			break;
+		}
+		UInt64 next = _currentTick + 1;
+		if ((next & SLOT_MASK) == 0)
+		{
+			_currentTick = next;
+			for (int level = 1; level < LEVELS; ++level)
+			{
+				cascade(level);
+				if (((_currentTick >> (SLOT_BITS*level)) & SLOT_MASK) != 0) break;
+			}
+			expire(expired);
+		}
+		else
+		{
+			// Skip empty slots up to the end of the current rotation.
+			UInt64 base = _currentTick & ~static_cast<UInt64>(SLOT_MASK);
+			UInt64 last = std::min(tick, base + SLOT_MASK);
+			int index = findSlot(static_cast<int>(next & SLOT_MASK), static_cast<int>(last & SLOT_MASK));
+			if (index < 0)
+			{
+				_currentTick = last;
+			}
+			else
+			{
+				_currentTick = base + index;
+				expire(expired);
+			}
+		}
+	}
+}
+
+
+int TimerWheel::findSlot(int from, int to) const
+{
+	for (int word = from/64; word <= to/64; ++word)
+	{
+		UInt64 bits = _bitmap[word];
+		if (word == from/64) bits &= ~static_cast<UInt64>(0) << (from % 64);
+		if (word == to/64 && to % 64 != 63) bits &= (static_cast<UInt64>(1) << (to % 64 + 1)) - 1;
+		if (bits) return word*64 + countTrailingZeros(bits);
+	}
+	return -1;
+}
+
+
+bool TimerWheel::mustWakeUp(UInt64 expiry)
+{
+	if (_sleeping && expiry < _wakeUpTick)
+	{
+		_sleeping = false;
+		return true;
+	}
+	return false;
+}
+
+
+} // namespace Poco
@@ -42,6 +42,12 @@ Var::Var(const Var& other)
 }
 
 
+Var::Var(Var&& other) noexcept
+{
+	construct(std::move(other));
+}
+
+
 Var::~Var()
 {
 	destruct();
@@ -57,6 +63,32 @@ Var& Var::operator = (const Var& rhs)
 }
 
 
+Var& Var::operator = (Var&& rhs) noexcept
+{
+	if (this == &rhs) return *this;
+	clear();
+	construct(std::move(rhs));
+	return *this;
+}
+
+
+bool Var::integerValue(UInt64& magnitude, bool& negative) const
+{
+	if (!Impl::isIntegerTag(_placeholder.tag())) return false;
+
+	return visitTagged([&magnitude, &negative](auto* pImpl)
+		{
+			using T = std::decay_t<decltype(pImpl->value())>;
+			if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+			{
+				T value = pImpl->value();
+				negative = value < 0;
+				magnitude = negative ? UInt64(0) - static_cast<UInt64>(value) : static_cast<UInt64>(value);
+			}
+		});
+}
+
+
 const Var Var::operator + (const Var& other) const
 {
 	if (isInteger())
@@ -233,6 +265,22 @@ bool Var::operator == (const Var& other) const
 {
 	if (isEmpty() != other.isEmpty()) return false;
 	if (isEmpty() && other.isEmpty()) return true;
+
+	// Values are compared by their string representation. For integers,
+	// booleans and strings, this is equivalent to comparing the values.
+	UInt64 magnitude, otherMagnitude;
+	bool negative, otherNegative;
+	if (integerValue(magnitude, negative) && other.integerValue(otherMagnitude, otherNegative))
+		return magnitude == otherMagnitude && negative == otherNegative;
+
+	const unsigned char tag = _placeholder.tag();
+	if (tag == other._placeholder.tag())
+	{
+		if (tag == Impl::VAR_TAG_STRING)
+			return extract<std::string>() == other.extract<std::string>();
+		else if (tag == Impl::VAR_TAG_BOOL)
+			return extract<bool>() == other.extract<bool>();
+	}
 	return convert<std::string>() == other.convert<std::string>();
 }
 
@@ -246,10 +294,7 @@ bool Var::operator == (const char* other) const
 
 bool Var::operator != (const Var& other) const
 {
-	if (isEmpty() && other.isEmpty()) return false;
-	else if (isEmpty() || other.isEmpty()) return true;
-
-	return convert<std::string>() != other.convert<std::string>();
+	return !(*this == other);
 }
 
 
@@ -263,6 +308,8 @@ bool Var::operator != (const char* other) const
 bool Var::operator < (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (_placeholder.tag() == Impl::VAR_TAG_STRING && other._placeholder.tag() == Impl::VAR_TAG_STRING)
+		return extract<std::string>() < other.extract<std::string>();
 	return convert<std::string>() < other.convert<std::string>();
 }
 
@@ -270,6 +317,8 @@ bool Var::operator < (const Var& other) const
 bool Var::operator <= (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (_placeholder.tag() == Impl::VAR_TAG_STRING && other._placeholder.tag() == Impl::VAR_TAG_STRING)
+		return extract<std::string>() <= other.extract<std::string>();
 	return convert<std::string>() <= other.convert<std::string>();
 }
 
@@ -277,6 +326,8 @@ bool Var::operator <= (const Var& other) const
 bool Var::operator > (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (_placeholder.tag() == Impl::VAR_TAG_STRING && other._placeholder.tag() == Impl::VAR_TAG_STRING)
+		return extract<std::string>() > other.extract<std::string>();
 	return convert<std::string>() > other.convert<std::string>();
 }
 
@@ -284,6 +335,8 @@ bool Var::operator > (const Var& other) const
 bool Var::operator >= (const Var& other) const
 {
 	if (isEmpty() || other.isEmpty()) return false;
+	if (_placeholder.tag() == Impl::VAR_TAG_STRING && other._placeholder.tag() == Impl::VAR_TAG_STRING)
+		return extract<std::string>() >= other.extract<std::string>();
 	return convert<std::string>() >= other.convert<std::string>();
 }
 
@@ -50,6 +50,12 @@ VarHolder::~VarHolder()
 }
 
 
+VarHolder* VarHolder::moveTo(Placeholder<VarHolder>* pVarHolder)
+{
+	return clone(pVarHolder);
+}
+
+
 namespace Impl {
 
 
@@ -0,0 +1,437 @@
+//
+// WorkStealingScheduler.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingScheduler
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/WorkStealingScheduler.h"
+#include "Poco/WorkStealingDeque.h"
+#include "Poco/Runnable.h"
+#include "Poco/ThreadLocal.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <sstream>
+
+
+namespace Poco {
+
+
+namespace
+{
+	const std::size_t INJECTION_QUEUE_CAPACITY = 4096;
+	const int SPIN_ROUNDS = 64;
+
+	thread_local void* pCurrentWorker = nullptr;
+}
+
+
+struct WorkStealingScheduler::Worker
+{
+	Worker(WorkStealingScheduler& scheduler, std::size_t index):
+		owner(scheduler),
+		index(index),
+		seed(static_cast<UInt32>(index*2654435761u + 1))
+	{
+	}
+
+	std::size_t nextVictim(std::size_t n)
+		/// Returns a pseudo-random start index for stealing.
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		return seed % n;
+	}
+
+	WorkStealingScheduler& owner;
+	std::size_t index;
+	UInt32 seed;
+	WorkStealingDeque<Runnable*> deque;
+	Thread thread;
+};
+
+
+class WorkStealingScheduler::InjectionQueue
+	/// A bounded, lock-free multi-producer multi-consumer queue,
+	/// based on Dmitry Vyukov's bounded MPMC queue.
+{
+public:
+	explicit InjectionQueue(std::size_t capacity):
+		_mask(capacity - 1),
+		_cells(new Cell[capacity]),
+		_enqueuePos(0),
+		_dequeuePos(0)
+	{
+		poco_assert ((capacity & _mask) == 0);
+
+		for (std::size_t i = 0; i < capacity; ++i)
+		{
+			_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	bool tryPush(Runnable* pRunnable)
+	{
+		Cell* pCell;
+		std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & _mask];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+			if (diff == 0)
+			{
+				if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = _enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		pCell->pRunnable = pRunnable;
+		pCell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool tryPop(Runnable*& pRunnable)
+	{
+		Cell* pCell;
+		std::size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			pCell = &_cells[pos & _mask];
+			std::size_t seq = pCell->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+			if (diff == 0)
+			{
+				if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = _dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+		pRunnable = pCell->pRunnable;
+		pCell->sequence.store(pos + _mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool empty() const
+	{
+		return _enqueuePos.load(std::memory_order_relaxed) == _dequeuePos.load(std::memory_order_relaxed);
+	}
+
+private:
+	static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+	struct Cell
+	{
+		std::atomic<std::size_t> sequence;
+		Runnable* pRunnable = nullptr;
+	};
+
+	const std::size_t _mask;
+	std::unique_ptr<Cell[]> _cells;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _enqueuePos;
+	alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _dequeuePos;
+};
+
+
+WorkStealingScheduler::WorkStealingScheduler(int threads, int stackSize):
+	WorkStealingScheduler(std::string(), threads, stackSize)
+{
+}
+
+
+WorkStealingScheduler::WorkStealingScheduler(const std::string& name, int threads, int stackSize):
+	_name(name),
+	_threads(threads),
+	_stackSize(stackSize),
+	_pInjectionQueue(new InjectionQueue(INJECTION_QUEUE_CAPACITY)),
+	_overflowCount(0),
+	_running(false),
+	_stopped(false),
+	_pending(0),
+	_parked(0),
+	_steals(0),
+	_wakeUps(0)
+{
+	poco_assert (threads > 0);
+}
+
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+	try
+	{
+		joinAll();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void WorkStealingScheduler::schedule(Runnable& target)
+{
+	// Pairs with joinAll(): either joinAll() sees this runnable
+	// as pending and runs it, or we see the workers stopping.
+	_pending.fetch_add(1, std::memory_order_seq_cst);
+	if (_stopped.load(std::memory_order_seq_cst))
+	{
+		runTask(target);
+		return;
+	}
+
+	Worker* pWorker = static_cast<Worker*>(pCurrentWorker);
+	if (pWorker && &pWorker->owner == this)
+	{
+		pWorker->deque.push(&target);
+	}
+	else if (!_pInjectionQueue->tryPush(&target))
+	{
+		std::lock_guard<std::mutex> lock(_overflowMutex);
+		_overflow.push_back(&target);
+		_overflowCount.fetch_add(1, std::memory_order_release);
+	}
+	// Checked after queuing the runnable, so that it is not lost
+	// if joinAll() has stopped the workers in the meantime.
+	if (!_running.load(std::memory_order_seq_cst)) start();
+	wakeUp();
+}
+
+
+void WorkStealingScheduler::joinAll()
+{
+	{
+		std::unique_lock<std::mutex> lock(_parkMutex);
+		_idleCondition.wait(lock, [this]{ return _pending.load() == 0; });
+	}
+
+	std::lock_guard<std::mutex> lock(_startMutex);
+	if (!_running.load(std::memory_order_relaxed)) return;
+
+	{
+		std::lock_guard<std::mutex> parkLock(_parkMutex);
+		_stopped = true;
+		_parkCondition.notify_all();
+	}
+	for (auto& pWorker: _workers)
+	{
+		pWorker->thread.join();
+	}
+	// Runnables scheduled while the workers were stopping
+	// are run here, so that none is left behind in a queue.
+	while (_pending.load(std::memory_order_seq_cst) > 0)
+	{
+		Runnable* pTarget = takeTask();
+		if (pTarget)
+			runTask(*pTarget);
+		else
+			Thread::yield();
+	}
+	_workers.clear();
+	_wakeUps = 0;
+	_running.store(false, std::memory_order_seq_cst);
+	_stopped = false;
+}
+
+
+void WorkStealingScheduler::start()
+{
+	std::lock_guard<std::mutex> lock(_startMutex);
+	if (_running.load(std::memory_order_relaxed)) return;
+
+	for (int i = 0; i < _threads; ++i)
+	{
+		_workers.emplace_back(new Worker(*this, static_cast<std::size_t>(i)));
+	}
+	for (auto& pWorker: _workers)
+	{
+		std::ostringstream name;
+		name << _name << "[#" << pWorker->index + 1 << "]";
+		pWorker->thread.setName(name.str());
+		pWorker->thread.setStackSize(_stackSize);
+		Worker* pW = pWorker.get();
+		pWorker->thread.startFunc([this, pW]() { run(*pW); });
+	}
+	_running.store(true, std::memory_order_release);
+}
+
+
+void WorkStealingScheduler::run(Worker& worker)
+{
+	pCurrentWorker = &worker;
+	int idleRounds = 0;
+	while (!_stopped.load(std::memory_order_acquire))
+	{
+		Runnable* pTarget = nextTask(worker);
+		if (pTarget)
+		{
+			idleRounds = 0;
+			runTask(*pTarget);
+		}
+		else if (++idleRounds < SPIN_ROUNDS)
+		{
+			Thread::yield();
+		}
+		else
+		{
+			park();
+			idleRounds = 0;
+		}
+	}
+	pCurrentWorker = nullptr;
+}
+
+
+Runnable* WorkStealingScheduler::nextTask(Worker& worker)
+{
+	Runnable* pTarget = nullptr;
+	if (worker.deque.pop(pTarget)) return pTarget;
+	if (_pInjectionQueue->tryPop(pTarget)) return pTarget;
+	if (_overflowCount.load(std::memory_order_acquire) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_overflowMutex);
+		if (!_overflow.empty())
+		{
+			pTarget = _overflow.front();
+			_overflow.pop_front();
+			_overflowCount.fetch_sub(1, std::memory_order_relaxed);
+			return pTarget;
+		}
+	}
+
+	std::size_t n = _workers.size();
+	std::size_t start = worker.nextVictim(n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		Worker& victim = *_workers[(start + i) % n];
+		if (&victim != &worker && victim.deque.steal(pTarget))
+		{
+			_steals.fetch_add(1, std::memory_order_relaxed);
+			return pTarget;
+		}
+	}
+	return nullptr;
+}
+
+
+void WorkStealingScheduler::runTask(Runnable& target)
+{
+	try
+	{
+		target.run();
+	}
+	catch (Exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		ErrorHandler::handle();
+	}
+	ThreadLocalStorage::clear();
+	taskDone();
+}
+
+
+Runnable* WorkStealingScheduler::takeTask()
+{
+	Runnable* pTarget = nullptr;
+	if (_pInjectionQueue->tryPop(pTarget)) return pTarget;
+	{
+		std::lock_guard<std::mutex> lock(_overflowMutex);
+		if (!_overflow.empty())
+		{
+			pTarget = _overflow.front();
+			_overflow.pop_front();
+			_overflowCount.fetch_sub(1, std::memory_order_relaxed);
+			return pTarget;
+		}
+	}
+	for (auto& pWorker: _workers)
+	{
+		if (pWorker->deque.steal(pTarget)) return pTarget;
+	}
+	return nullptr;
+}
+
+
+bool WorkStealingScheduler::hasWork() const
+{
+	if (!_pInjectionQueue->empty()) return true;
+	if (_overflowCount.load(std::memory_order_relaxed) > 0) return true;
+	for (const auto& pWorker: _workers)
+	{
+		if (!pWorker->deque.empty()) return true;
+	}
+	return false;
+}
+
+
+void WorkStealingScheduler::park()
+{
+	std::unique_lock<std::mutex> lock(_parkMutex);
+	_parked.fetch_add(1, std::memory_order_relaxed);
+	// Pairs with the fence in wakeUp(): either we see the newly
+	// scheduled work, or the scheduling thread sees us parked.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!hasWork())
+	{
+		_parkCondition.wait(lock, [this]{ return _wakeUps > 0 || _stopped.load(); });
+	}
+	if (_wakeUps > 0) --_wakeUps;
+	_parked.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+void WorkStealingScheduler::wakeUp()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_parked.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		if (_wakeUps < _parked.load(std::memory_order_relaxed))
+		{
+			++_wakeUps;
+			_parkCondition.notify_one();
+		}
+	}
+}
+
+
+void WorkStealingScheduler::taskDone()
+{
+	if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		_idleCondition.notify_all();
+	}
+}
+
+
+} // namespace Poco
@@ -180,6 +180,32 @@ void ActiveThreadPoolTest::testActiveThreadPool3()
 	assertTrue (std::equal(result.begin(), result.end(), mock.begin(), mock.end()));
 }
 
+
+void ActiveThreadPoolTest::testWorkStealing()
+{
+	ActiveThreadPool pool("WorkStealing", 3, POCO_THREAD_STACK_SIZE, ActiveThreadPool::SCHEDULING_WORK_STEALING);
+	assertTrue (pool.scheduling() == ActiveThreadPool::SCHEDULING_WORK_STEALING);
+	assertTrue (pool.capacity() == 3);
+	assertTrue (pool.name() == "WorkStealing");
+	RunnableAdapter<ActiveThreadPoolTest> ra(*this, &ActiveThreadPoolTest::count);
+
+	_count = 0;
+	for (int i = 0; i < 2000; ++i)
+	{
+		pool.start(ra, i % 3);
+	}
+	pool.joinAll();
+	assertTrue (_count == 2000);
+
+	_count = 0;
+	for (int i = 0; i < 1000; ++i)
+	{
+		pool.start(ra);
+	}
+	pool.joinAll();
+	assertTrue (_count == 1000);
+}
+
 void ActiveThreadPoolTest::setUp()
 {
 	_count = 0;
@@ -204,6 +230,7 @@ CppUnit::Test* ActiveThreadPoolTest::suite()
 	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testActiveThreadPool1);
 	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testActiveThreadPool2);
 	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testActiveThreadPool3);
+	CppUnit_addTest(pSuite, ActiveThreadPoolTest, testWorkStealing);
 
 	return pSuite;
 }
@@ -29,6 +29,7 @@ public:
 	void testActiveThreadPool1();
 	void testActiveThreadPool2();
 	void testActiveThreadPool3();
+	void testWorkStealing();
 
 	void setUp();
 	void tearDown();
@@ -13,10 +13,12 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base32Encoder.h"
 #include "Poco/Base32Decoder.h"
+#include "Poco/Base32.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
+using Poco::Base32;
 using Poco::Base32Encoder;
 using Poco::Base32Decoder;
 using Poco::DataFormatException;
@@ -441,6 +443,64 @@ void Base32Test::testEncodeDecodeCrockford()
 }
 
 
+void Base32Test::testBuffer()
+{
+	assertTrue (Base32::encode("") == "");
+	assertTrue (Base32::encode("f") == "MY======");
+	assertTrue (Base32::encode("fo") == "MZXQ====");
+	assertTrue (Base32::encode("foo") == "MZXW6===");
+	assertTrue (Base32::encode("foob") == "MZXW6YQ=");
+	assertTrue (Base32::encode("fooba") == "MZXW6YTB");
+	assertTrue (Base32::encode("foobar") == "MZXW6YTBOI======");
+	assertTrue (Base32::encode("foobar", Poco::BASE32_NO_PADDING) == "MZXW6YTBOI");
+	assertTrue (Base32::encode("foobar", Poco::BASE32_USE_HEX_ALPHABET | Poco::BASE32_USE_PADDING) == "CPNMUOJ1E8======");
+	assertTrue (Base32::decode("MZXW6YTBOI======") == "foobar");
+	assertTrue (Base32::decode("MZXW6YTBOI") == "foobar");
+
+	const int optionSets[] = {
+		Poco::BASE32_USE_PADDING,
+		Poco::BASE32_NO_PADDING,
+		Poco::BASE32_USE_HEX_ALPHABET,
+		Poco::BASE32_USE_CROCKFORD_ALPHABET | Poco::BASE32_USE_PADDING
+	};
+	for (int options: optionSets)
+	{
+		std::string data;
+		for (int length = 0; length < 100; length++)
+		{
+			const std::string encoded = Base32::encode(data, options);
+			assertTrue (encoded.size() == Base32::encodedLength(data.size(), options));
+
+			std::ostringstream ostr;
+			Base32Encoder encoder(ostr, options);
+			encoder << data;
+			encoder.close();
+			assertTrue (ostr.str() == encoded);
+
+			assertTrue (Base32::decode(encoded, options) == data);
+			data += static_cast<char>(length*37);
+		}
+	}
+
+	try
+	{
+		Base32::decode("MZXW6YTBO");
+		fail("incomplete group - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		Base32::decode("MZXW6YTBO1======");
+		fail("invalid character - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+}
+
+
 void Base32Test::setUp()
 {
 }
@@ -464,6 +524,7 @@ CppUnit::Test* Base32Test::suite()
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecode);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecodeHex);
 	CppUnit_addTest(pSuite, Base32Test, testEncodeDecodeCrockford);
+	CppUnit_addTest(pSuite, Base32Test, testBuffer);
 
 	return pSuite;
 }
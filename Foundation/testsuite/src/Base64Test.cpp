@@ -13,15 +13,56 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
+#include "Poco/Base64.h"
+#include "Poco/StreamCopier.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
+using Poco::Base64;
 using Poco::Base64Encoder;
 using Poco::Base64Decoder;
 using Poco::DataFormatException;
 
 
+namespace
+{
+	std::string referenceEncode(const std::string& data, bool url, bool padding)
+	{
+		const char* alphabet = url ?
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_" :
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		std::string result;
+		for (std::size_t i = 0; i < data.size(); i += 3)
+		{
+			unsigned value = static_cast<unsigned char>(data[i]) << 16;
+			if (i + 1 < data.size()) value |= static_cast<unsigned char>(data[i + 1]) << 8;
+			if (i + 2 < data.size()) value |= static_cast<unsigned char>(data[i + 2]);
+			result += alphabet[(value >> 18) & 0x3F];
+			result += alphabet[(value >> 12) & 0x3F];
+			if (i + 1 < data.size()) result += alphabet[(value >> 6) & 0x3F];
+			else if (padding) result += '=';
+			if (i + 2 < data.size()) result += alphabet[value & 0x3F];
+			else if (padding) result += '=';
+		}
+		return result;
+	}
+
+
+	std::string testData(std::size_t length)
+	{
+		std::string data;
+		unsigned seed = 12345;
+		for (std::size_t i = 0; i < length; i++)
+		{
+			seed = seed*1103515245 + 12345;
+			data += static_cast<char>(seed >> 16);
+		}
+		return data;
+	}
+}
+
+
 Base64Test::Base64Test(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -377,6 +418,134 @@ void Base64Test::testEncodeDecode()
 }
 
 
+void Base64Test::testBuffer()
+{
+	assertTrue (Base64::encode("") == "");
+	assertTrue (Base64::encode("f") == "Zg==");
+	assertTrue (Base64::encode("fo") == "Zm8=");
+	assertTrue (Base64::encode("foo") == "Zm9v");
+	assertTrue (Base64::encode("foob") == "Zm9vYg==");
+	assertTrue (Base64::encode("fooba") == "Zm9vYmE=");
+	assertTrue (Base64::encode("foobar") == "Zm9vYmFy");
+	assertTrue (Base64::encode("fo", Poco::BASE64_NO_PADDING) == "Zm8");
+	assertTrue (Base64::decode("Zm9vYmE=") == "fooba");
+	assertTrue (Base64::decode("Zm9v\r\nYmFy") == "foobar");
+	assertTrue (Base64::decode("Zm9vYmE", Poco::BASE64_NO_PADDING) == "fooba");
+
+	// lengths around the vector block sizes
+	for (std::size_t length = 0; length < 300; length++)
+	{
+		const std::string data = testData(length);
+		const std::string encoded = Base64::encode(data);
+		assertTrue (encoded == referenceEncode(data, false, true));
+		assertTrue (encoded.size() == Base64::encodedLength(length));
+		assertTrue (Base64::decode(encoded) == data);
+
+		const std::string unpadded = Base64::encode(data, Poco::BASE64_NO_PADDING);
+		assertTrue (unpadded == referenceEncode(data, false, false));
+		assertTrue (unpadded.size() == Base64::encodedLength(length, Poco::BASE64_NO_PADDING));
+		assertTrue (Base64::decode(unpadded, Poco::BASE64_NO_PADDING) == data);
+	}
+}
+
+
+void Base64Test::testBufferURL()
+{
+	const int options = Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING;
+	for (std::size_t length = 0; length < 300; length++)
+	{
+		const std::string data = testData(length);
+		const std::string encoded = Base64::encode(data, options);
+		assertTrue (encoded == referenceEncode(data, true, false));
+		assertTrue (Base64::decode(encoded, options) == data);
+		assertTrue (Base64::decode(referenceEncode(data, true, true), Poco::BASE64_URL_ENCODING) == data);
+	}
+	assertTrue (Base64::decode("IUAjJCVeJiooKV9-PD4=", Poco::BASE64_URL_ENCODING) == "!@#$%^&*()_~<>");
+}
+
+
+void Base64Test::testBufferInvalid()
+{
+	const std::string encoded = referenceEncode(testData(96), false, true);
+	for (std::size_t pos = 0; pos < encoded.size(); pos++)
+	{
+		std::string invalid(encoded);
+		invalid[pos] = '#';
+		try
+		{
+			Base64::decode(invalid);
+			fail("invalid character - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+
+		std::string spaced(encoded);
+		spaced.insert(pos, " ");
+		assertTrue (Base64::decode(spaced) == testData(96));
+	}
+
+	const std::string urlEncoded = referenceEncode(testData(96), true, false);
+	for (std::size_t pos = 0; pos < urlEncoded.size(); pos++)
+	{
+		std::string invalid(urlEncoded);
+		invalid[pos] = (pos % 2) ? '+' : '/';
+		try
+		{
+			Base64::decode(invalid, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING);
+			fail("standard alphabet character in URL encoding - must throw");
+		}
+		catch (DataFormatException&)
+		{
+		}
+	}
+
+	try
+	{
+		Base64::decode("Zm9vYmE");
+		fail("missing padding - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+	try
+	{
+		Base64::decode(std::string("Zm9v\x80mFy"));
+		fail("non-ASCII character - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+}
+
+
+void Base64Test::testStreamBlocks()
+{
+	const std::string data = testData(100000);
+	std::stringstream str;
+	Base64Encoder encoder(str);
+	encoder.write(data.data(), 1);
+	encoder.write(data.data() + 1, static_cast<std::streamsize>(data.size() - 1));
+	encoder.close();
+
+	std::string encoded = str.str();
+	std::string expected;
+	const std::string reference = referenceEncode(data, false, true);
+	for (std::size_t i = 0; i < reference.size(); i += 72)
+	{
+		expected += reference.substr(i, 72);
+		if (i + 72 < reference.size() || reference.size() % 72 == 0) expected += "\r\n";
+	}
+	assertTrue (encoded == expected);
+
+	Base64Decoder decoder(str);
+	std::string decoded;
+	Poco::StreamCopier::copyToString(decoder, decoded);
+	assertTrue (decoded == data);
+	assertTrue (Base64::decode(encoded) == data);
+}
+
+
 void Base64Test::setUp()
 {
 }
@@ -398,6 +567,10 @@ CppUnit::Test* Base64Test::suite()
 	CppUnit_addTest(pSuite, Base64Test, testDecoderURL);
 	CppUnit_addTest(pSuite, Base64Test, testDecoderNoPadding);
 	CppUnit_addTest(pSuite, Base64Test, testEncodeDecode);
+	CppUnit_addTest(pSuite, Base64Test, testBuffer);
+	CppUnit_addTest(pSuite, Base64Test, testBufferURL);
+	CppUnit_addTest(pSuite, Base64Test, testBufferInvalid);
+	CppUnit_addTest(pSuite, Base64Test, testStreamBlocks);
 
 	return pSuite;
 }
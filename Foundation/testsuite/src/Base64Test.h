@@ -31,6 +31,10 @@ public:
 	void testDecoderURL();
 	void testDecoderNoPadding();
 	void testEncodeDecode();
+	void testBuffer();
+	void testBufferURL();
+	void testBufferInvalid();
+	void testStreamBlocks();
 
 	void setUp();
 	void tearDown();
@@ -19,6 +19,8 @@
 #include "Poco/FormattingChannel.h"
 #include "Poco/ConsoleChannel.h"
 #include "Poco/StreamChannel.h"
+#include "Poco/Event.h"
+#include "Poco/NumberFormatter.h"
 #include "TestChannel.h"
 #include <sstream>
 
@@ -73,6 +75,44 @@ private:
 };
 
 
+class BlockingChannel : public TestChannel
+{
+public:
+	void log(const Message& msg) override
+	{
+		_ready.wait();
+		TestChannel::log(msg);
+	}
+
+	void release()
+	{
+		_ready.set();
+	}
+
+private:
+	Poco::Event _ready{Poco::Event::EVENT_MANUALRESET};
+};
+
+
+class ReleaseRunnable : public Runnable
+{
+public:
+	ReleaseRunnable(BlockingChannel& channel) :
+		_channel(channel)
+	{
+	}
+
+	void run()
+	{
+		Thread::sleep(200);
+		_channel.release();
+	}
+
+private:
+	BlockingChannel& _channel;
+};
+
+
 ChannelTest::ChannelTest(const std::string& name) : CppUnit::TestCase(name)
 {
 }
@@ -131,6 +171,109 @@ void ChannelTest::testAsync()
 }
 
 
+void ChannelTest::testAsyncLockFree()
+{
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("queueType", "lockFree");
+	pAsync->setProperty("queueSize", "64");
+	pAsync->setProperty("overflowPolicy", "block");
+	pAsync->setProperty("batchSize", "16");
+	pAsync->open();
+	LogRunnable lr1(pAsync);
+	LogRunnable lr2(pAsync);
+	Thread t1;
+	Thread t2;
+	t1.start(lr1);
+	t2.start(lr2);
+	for (int i = 0; i < 1000; i++)
+	{
+		pAsync->log(Message("Source", Poco::NumberFormatter::format(i), Message::PRIO_INFORMATION));
+	}
+	lr1.stop();
+	lr2.stop();
+	t1.join();
+	t2.join();
+	pAsync->close();
+	assertTrue (pAsync->droppedMessages() == 0);
+
+	int next = 0;
+	for (const auto& msg: pChannel->list())
+	{
+		if (msg.getSource() == "Source")
+		{
+			assertTrue (msg.getText() == Poco::NumberFormatter::format(next));
+			next++;
+		}
+	}
+	assertTrue (next == 1000);
+
+	try
+	{
+		AutoPtr<AsyncChannel> pOpen = new AsyncChannel(pChannel);
+		pOpen->open();
+		pOpen->setProperty("queueType", "lockFree");
+		fail("channel is open - must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+}
+
+
+void ChannelTest::testAsyncLockFreeOverflow()
+{
+	const int count = 100;
+	const char* policies[] = {"dropNewest", "dropOldest", "block"};
+	for (const char* policy: policies)
+	{
+		AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+		AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+		pAsync->setProperty("queueType", "lockFree");
+		pAsync->setProperty("queueSize", "16");
+		pAsync->setProperty("overflowPolicy", policy);
+		pAsync->setProperty("batchSize", "1");
+		pAsync->open();
+
+		// the channel only accepts messages after a delay, so the queue fills up
+		ReleaseRunnable rr(*pChannel);
+		Thread t;
+		t.start(rr);
+		for (int i = 0; i < count; i++)
+		{
+			pAsync->log(Message("Source", Poco::NumberFormatter::format(i), Message::PRIO_INFORMATION));
+		}
+		t.join();
+		pAsync->close();
+
+		int delivered = 0;
+		bool dropReported = false;
+		for (const auto& msg: pChannel->list())
+		{
+			if (msg.getText().find("Dropped") == 0)
+				dropReported = true;
+			else
+				delivered++;
+		}
+		assertTrue (delivered + pAsync->droppedMessages() == count);
+		if (std::string(policy) == "block")
+		{
+			assertTrue (delivered == count);
+			assertTrue (!dropReported);
+		}
+		else
+		{
+			assertTrue (pAsync->droppedMessages() > 0);
+			assertTrue (dropReported);
+			if (std::string(policy) == "dropOldest")
+				assertTrue (pChannel->getLastMessage().getText() == Poco::NumberFormatter::format(count - 1));
+			else
+				assertTrue (pChannel->getLastMessage().getText() != Poco::NumberFormatter::format(count - 1));
+		}
+	}
+}
+
+
 void ChannelTest::testFormatting()
 {
 	AutoPtr<TestChannel> pChannel = new TestChannel;
@@ -182,6 +325,8 @@ CppUnit::Test* ChannelTest::suite()
 	CppUnit_addTest(pSuite, ChannelTest, testSplitter);
 	CppUnit_addTest(pSuite, ChannelTest, testSplitterAddSameChannelTwice);
 	CppUnit_addTest(pSuite, ChannelTest, testAsync);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncLockFree);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncLockFreeOverflow);
 	CppUnit_addTest(pSuite, ChannelTest, testFormatting);
 	CppUnit_addTest(pSuite, ChannelTest, testConsole);
 	CppUnit_addTest(pSuite, ChannelTest, testStream);
@@ -27,6 +27,8 @@ public:
 	void testSplitter();
 	void testSplitterAddSameChannelTwice();
 	void testAsync();
+	void testAsyncLockFree();
+	void testAsyncLockFreeOverflow();
 	void testFormatting();
 	void testConsole();
 	void testStream();
@@ -0,0 +1,140 @@
+//
+// ChecksumTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ChecksumTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Checksum.h"
+#include <string>
+
+
+using Poco::Checksum;
+using Poco::UInt32;
+
+
+namespace
+{
+	UInt32 referenceCRC32C(const std::string& data)
+	{
+		UInt32 crc = 0xFFFFFFFF;
+		for (unsigned char c: data)
+		{
+			crc ^= c;
+			for (int k = 0; k < 8; k++) crc = (crc & 1) ? (crc >> 1) ^ 0x82F63B78 : crc >> 1;
+		}
+		return ~crc;
+	}
+}
+
+
+ChecksumTest::ChecksumTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ChecksumTest::~ChecksumTest()
+{
+}
+
+
+void ChecksumTest::testCRC32()
+{
+	Checksum checksum;
+	assertTrue (checksum.type() == Checksum::TYPE_CRC32);
+	assertTrue (checksum.checksum() == 0);
+	checksum.update("123456789");
+	assertTrue (checksum.checksum() == 0xCBF43926);
+}
+
+
+void ChecksumTest::testAdler32()
+{
+	Checksum checksum(Checksum::TYPE_ADLER32);
+	assertTrue (checksum.checksum() == 1);
+	checksum.update("123456789");
+	assertTrue (checksum.checksum() == 0x091E01DE);
+}
+
+
+void ChecksumTest::testCRC32C()
+{
+	Checksum checksum(Checksum::TYPE_CRC32C);
+	assertTrue (checksum.type() == Checksum::TYPE_CRC32C);
+	assertTrue (checksum.checksum() == 0);
+	checksum.update("123456789");
+	assertTrue (checksum.checksum() == 0xE3069283);
+
+	// RFC 3720, B.4
+	Checksum zeros(Checksum::TYPE_CRC32C);
+	zeros.update(std::string(32, '\0'));
+	assertTrue (zeros.checksum() == 0x8A9136AA);
+
+	Checksum ones(Checksum::TYPE_CRC32C);
+	ones.update(std::string(32, '\xFF'));
+	assertTrue (ones.checksum() == 0x62A8AB43);
+
+	Checksum incrementing(Checksum::TYPE_CRC32C);
+	for (int i = 0; i < 32; i++) incrementing.update(static_cast<char>(i));
+	assertTrue (incrementing.checksum() == 0x46DD794E);
+}
+
+
+void ChecksumTest::testCRC32CBlocks()
+{
+	// Lengths around the sizes of the blocks processed in parallel.
+	std::string data(100000, '\0');
+	UInt32 seed = 12345;
+	for (auto& c: data)
+	{
+		seed = seed*1103515245 + 12345;
+		c = static_cast<char>(seed >> 16);
+	}
+	const std::size_t lengths[] = {0, 1, 7, 8, 9, 63, 767, 768, 769, 1000, 24575, 24576, 24577, 50000, 99997};
+	for (std::size_t length: lengths)
+	{
+		for (std::size_t offset = 0; offset < 3; offset++)
+		{
+			const std::string s = data.substr(offset, length);
+			const UInt32 expected = referenceCRC32C(s);
+
+			Checksum whole(Checksum::TYPE_CRC32C);
+			whole.update(s);
+			assertEqual (expected, whole.checksum());
+
+			Checksum parts(Checksum::TYPE_CRC32C);
+			parts.update(s.data(), static_cast<unsigned>(length/3));
+			parts.update(s.data() + length/3, static_cast<unsigned>(length - length/3));
+			assertEqual (expected, parts.checksum());
+		}
+	}
+}
+
+
+void ChecksumTest::setUp()
+{
+}
+
+
+void ChecksumTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ChecksumTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ChecksumTest");
+
+	CppUnit_addTest(pSuite, ChecksumTest, testCRC32);
+	CppUnit_addTest(pSuite, ChecksumTest, testAdler32);
+	CppUnit_addTest(pSuite, ChecksumTest, testCRC32C);
+	CppUnit_addTest(pSuite, ChecksumTest, testCRC32CBlocks);
+
+	return pSuite;
+}
@@ -0,0 +1,41 @@
+//
+// ChecksumTest.h
+//
+// Definition of the ChecksumTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ChecksumTest_INCLUDED
+#define ChecksumTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ChecksumTest: public CppUnit::TestCase
+{
+public:
+	ChecksumTest(const std::string& name);
+	~ChecksumTest();
+
+	void testCRC32();
+	void testAdler32();
+	void testCRC32C();
+	void testCRC32CBlocks();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // ChecksumTest_INCLUDED
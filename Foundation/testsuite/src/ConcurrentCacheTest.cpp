@@ -0,0 +1,282 @@
+//
+// ConcurrentCacheTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ConcurrentCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ConcurrentCache.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+
+using namespace Poco;
+
+
+ConcurrentCacheTest::ConcurrentCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ConcurrentCacheTest::~ConcurrentCacheTest()
+{
+}
+
+
+void ConcurrentCacheTest::testClear()
+{
+	ConcurrentCache<int, int> aCache(16, 0, 1);
+	assertTrue (aCache.size() == 0);
+	assertTrue (aCache.getAllKeys().size() == 0);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.getAllKeys().size() == 3);
+	assertTrue (aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (*aCache.get(1) == 2);
+	assertTrue (*aCache.get(3) == 4);
+	assertTrue (*aCache.get(5) == 6);
+	aCache.remove(3);
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.get(3).isNull());
+	assertTrue (aCache.size() == 2);
+	aCache.clear();
+	assertTrue (!aCache.has(1));
+	assertTrue (!aCache.has(5));
+	assertTrue (aCache.size() == 0);
+
+	// all slots must be usable again
+	for (int i = 0; i < 16; ++i) aCache.add(i, i);
+	assertTrue (aCache.size() == 16);
+}
+
+
+void ConcurrentCacheTest::testCacheSize0()
+{
+	try
+	{
+		ConcurrentCache<int, int> aCache(0);
+		failmsg ("cache size of 0 is illegal, test should fail");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void ConcurrentCacheTest::testShards()
+{
+	ConcurrentCache<int, int> aCache1(1000, 0, 10);
+	assertTrue (aCache1.shards() == 16);
+	assertTrue (aCache1.capacity() >= 1000);
+
+	ConcurrentCache<int, int> aCache2(3, 0, 16);
+	assertTrue (aCache2.shards() == 2);
+	assertTrue (aCache2.capacity() == 4);
+
+	ConcurrentCache<int, int> aCache3(1);
+	assertTrue (aCache3.shards() == 1);
+	assertTrue (aCache3.capacity() == 1);
+	aCache3.add(1, 2);
+	aCache3.add(3, 4);
+	assertTrue (!aCache3.has(1));
+	assertTrue (*aCache3.get(3) == 4);
+}
+
+
+void ConcurrentCacheTest::testReplacement()
+{
+	ConcurrentCache<int, int> aCache(3, 0, 1);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+
+	// 1 was recently used, so 3 goes first
+	assertTrue (*aCache.get(1) == 2);
+	aCache.add(7, 8);
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (aCache.has(7));
+
+	aCache.add(9, 10);
+	assertTrue (aCache.has(1) + aCache.has(5) + aCache.has(7) == 2);
+	assertTrue (aCache.has(9));
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.statistics().evictions == 2);
+
+	// capacity is never exceeded
+	ConcurrentCache<int, int> aCache2(100);
+	for (int i = 0; i < 1000; ++i)
+	{
+		aCache2.add(i, i);
+		aCache2.get(i/2);
+	}
+	assertTrue (aCache2.size() <= aCache2.capacity());
+	assertTrue (aCache2.has(999));
+}
+
+
+void ConcurrentCacheTest::testDuplicateAdd()
+{
+	ConcurrentCache<int, int> aCache(3, 0, 1);
+	aCache.add(1, 2);
+	assertTrue (*aCache.get(1) == 2);
+	aCache.add(1, 3);
+	assertTrue (*aCache.get(1) == 3);
+	assertTrue (aCache.size() == 1);
+
+	SharedPtr<int> pValue = aCache.get(1);
+	aCache.remove(1);
+	assertTrue (*pValue == 3);
+}
+
+
+void ConcurrentCacheTest::testExpire()
+{
+	ConcurrentCache<int, int> aCache(16, 200);
+	aCache.add(1, 2);
+	aCache.add(3, SharedPtr<int>(new int(4)), 0);
+	aCache.add(5, SharedPtr<int>(new int(6)), 5000);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+	Thread::sleep(300);
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.get(1).isNull());
+	assertTrue (*aCache.get(3) == 4);
+	assertTrue (*aCache.get(5) == 6);
+	assertTrue (aCache.getAllKeys().size() == 2);
+	assertTrue (aCache.size() == 2);
+	assertTrue (aCache.statistics().expirations == 1);
+
+	// expired entries are replaced before valid ones
+	ConcurrentCache<int, int> aCache2(2, 0, 1);
+	aCache2.add(1, SharedPtr<int>(new int(2)), 100);
+	aCache2.add(3, 4);
+	Thread::sleep(200);
+	aCache2.add(5, 6);
+	assertTrue (aCache2.has(3));
+	assertTrue (aCache2.has(5));
+	assertTrue (aCache2.statistics().expirations == 1);
+	assertTrue (aCache2.statistics().evictions == 0);
+}
+
+
+void ConcurrentCacheTest::testStatistics()
+{
+	ConcurrentCache<std::string, std::string> aCache(64);
+	aCache.add("a", "1");
+	aCache.add("b", "2");
+	aCache.get("a");
+	aCache.get("a");
+	aCache.get("b");
+	aCache.get("c");
+	ConcurrentCache<std::string, std::string>::Statistics stats = aCache.statistics();
+	assertTrue (stats.hits == 3);
+	assertTrue (stats.misses == 1);
+	assertTrue (stats.evictions == 0);
+	assertTrue (stats.expirations == 0);
+
+	aCache.resetStatistics();
+	stats = aCache.statistics();
+	assertTrue (stats.hits == 0);
+	assertTrue (stats.misses == 0);
+}
+
+
+void ConcurrentCacheTest::testForEach()
+{
+	ConcurrentCache<int, int> aCache(16);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+
+	int keySum = 0;
+	int valueSum = 0;
+	aCache.forEach([&](const int& key, const int& value)
+	{
+		keySum += key;
+		valueSum += value;
+	});
+	assertTrue (keySum == 9);
+	assertTrue (valueSum == 12);
+}
+
+
+void ConcurrentCacheTest::testConcurrentAccess()
+{
+	const int KEYS = 2000;
+	const int THREADS = 4;
+	ConcurrentCache<int, int> aCache(KEYS/2);
+	std::atomic<int> errors(0);
+	std::vector<Thread> threads(THREADS);
+	for (int t = 0; t < THREADS; ++t)
+	{
+		threads[t].startFunc([&aCache, &errors, t]()
+		{
+			for (int i = 0; i < 20000; ++i)
+			{
+				int key = (i*7 + t*13) % KEYS;
+				if (i % 4 == 0)
+				{
+					aCache.add(key, key*2);
+				}
+				else if (i % 97 == 0)
+				{
+					aCache.remove(key);
+				}
+				else
+				{
+					SharedPtr<int> pValue = aCache.get(key);
+					if (pValue && *pValue != key*2) ++errors;
+				}
+			}
+		});
+	}
+	for (auto& t: threads) t.join();
+
+	assertTrue (errors == 0);
+	assertTrue (aCache.size() <= aCache.capacity());
+	ConcurrentCache<int, int>::Statistics stats = aCache.statistics();
+	assertTrue (stats.hits + stats.misses > 0);
+}
+
+
+void ConcurrentCacheTest::setUp()
+{
+}
+
+
+void ConcurrentCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ConcurrentCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ConcurrentCacheTest");
+
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testClear);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testCacheSize0);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testShards);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testReplacement);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testDuplicateAdd);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testExpire);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testStatistics);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testForEach);
+	CppUnit_addTest(pSuite, ConcurrentCacheTest, testConcurrentAccess);
+
+	return pSuite;
+}
@@ -0,0 +1,42 @@
+//
+// ConcurrentCacheTest.h
+//
+// Tests for ConcurrentCache
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+#ifndef ConcurrentCacheTest_INCLUDED
+#define ConcurrentCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ConcurrentCacheTest: public CppUnit::TestCase
+{
+public:
+	ConcurrentCacheTest(const std::string& name);
+	~ConcurrentCacheTest();
+
+	void testClear();
+	void testCacheSize0();
+	void testShards();
+	void testReplacement();
+	void testDuplicateAdd();
+	void testExpire();
+	void testStatistics();
+	void testForEach();
+	void testConcurrentAccess();
+
+	void setUp();
+	void tearDown();
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ConcurrentCacheTest_INCLUDED
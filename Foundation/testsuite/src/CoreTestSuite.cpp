@@ -26,6 +26,7 @@
 #include "NumberParserTest.h"
 #include "DynamicFactoryTest.h"
 #include "MemoryPoolTest.h"
+#include "SlabAllocatorTest.h"
 #include "AnyTest.h"
 #include "VarTest.h"
 #include "FormatTest.h"
@@ -60,6 +61,7 @@ CppUnit::Test* CoreTestSuite::suite()
 	pSuite->addTest(NumberParserTest::suite());
 	pSuite->addTest(DynamicFactoryTest::suite());
 	pSuite->addTest(MemoryPoolTest::suite());
+	pSuite->addTest(SlabAllocatorTest::suite());
 	pSuite->addTest(AnyTest::suite());
 	pSuite->addTest(VarTest::suite());
 	pSuite->addTest(FormatTest::suite());
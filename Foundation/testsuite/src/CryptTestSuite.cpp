@@ -14,6 +14,7 @@
 #include "SHA1EngineTest.h"
 #include "SHA2EngineTest.h"
 #include "HMACEngineTest.h"
+#include "ChecksumTest.h"
 #include "PBKDF2EngineTest.h"
 #include "DigestStreamTest.h"
 #include "RandomTest.h"
@@ -29,6 +30,7 @@ CppUnit::Test* CryptTestSuite::suite()
 	pSuite->addTest(SHA1EngineTest::suite());
 	pSuite->addTest(SHA2EngineTest::suite());
 	pSuite->addTest(HMACEngineTest::suite());
+	pSuite->addTest(ChecksumTest::suite());
 	pSuite->addTest(PBKDF2EngineTest::suite());
 	pSuite->addTest(DigestStreamTest::suite());
 	pSuite->addTest(RandomTest::suite());
@@ -29,6 +29,7 @@
 #include "Poco/RotateStrategy.h"
 #include "Poco/ArchiveStrategy.h"
 #include "Poco/PurgeStrategy.h"
+#include "Poco/FileStream.h"
 #include <vector>
 #include <iostream>
 
@@ -140,6 +141,177 @@ void FileChannelTest::testFlushing()
 }
 
 
+void FileChannelTest::testWriteCombining()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_FLUSH, "false");
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "65536");
+		pChannel->setProperty(FileChannel::PROP_FLUSHINTERVAL, "600000");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_BUFFERSIZE) == "65536");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_FLUSHINTERVAL) == "600000");
+		pChannel->open();
+		Message msg("source", "01234567890123456789", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 100; ++i)
+		{
+			pChannel->log(msg);
+		}
+
+		// Everything is still in the buffer.
+		File f(name);
+		assertTrue (f.exists());
+		assertTrue (f.getSize() == 0);
+
+		pChannel->close();
+		assertTrue (f.getSize() >= 2100);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testBackgroundFlush()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_FLUSH, "false");
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "65536");
+		pChannel->setProperty(FileChannel::PROP_FLUSHINTERVAL, "100");
+		pChannel->setProperty(FileChannel::PROP_BACKGROUNDFLUSH, "true");
+		pChannel->open();
+		Message msg("source", "01234567890123456789", Message::PRIO_INFORMATION);
+		pChannel->log(msg);
+
+		// The buffer is flushed by the timer, without further messages being logged.
+		File f(name);
+		int n = 0;
+		while (f.getSize() == 0 && n++ < 50)
+		{
+			Thread::sleep(100);
+		}
+		assertTrue (f.getSize() >= 20);
+		pChannel->close();
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testSync()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		assertTrue (pChannel->getProperty(FileChannel::PROP_SYNC) == "none");
+		pChannel->setProperty(FileChannel::PROP_SYNC, "periodic");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_SYNC) == "periodic");
+		try
+		{
+			pChannel->setProperty(FileChannel::PROP_SYNC, "0");
+			fail("must throw");
+		}
+		catch (InvalidArgumentException&)
+		{
+		}
+		try
+		{
+			pChannel->setProperty(FileChannel::PROP_SYNC, "always");
+			fail("must throw");
+		}
+		catch (Poco::SyntaxException&)
+		{
+		}
+
+		pChannel->setProperty(FileChannel::PROP_FLUSH, "false");
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "65536");
+		pChannel->setProperty(FileChannel::PROP_FLUSHINTERVAL, "600000");
+		pChannel->setProperty(FileChannel::PROP_SYNC, "10");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_SYNC) == "10");
+		pChannel->open();
+		Message msg("source", "01234567890123456789", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 9; ++i)
+		{
+			pChannel->log(msg);
+		}
+		File f(name);
+		assertTrue (f.getSize() == 0);
+
+		// The 10th message writes the buffer to disk.
+		pChannel->log(msg);
+		assertTrue (f.getSize() >= 210);
+		pChannel->close();
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
+void FileChannelTest::testAsyncRotation()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_ROTATION, "2 K");
+		pChannel->setProperty(FileChannel::PROP_ASYNCROTATION, "true");
+		pChannel->setProperty(FileChannel::PROP_FLUSH, "false");
+		pChannel->setProperty(FileChannel::PROP_BUFFERSIZE, "8192");
+		pChannel->open();
+		for (int i = 0; i < 500; ++i)
+		{
+			Message msg("source", "This is log file entry " + NumberFormatter::format0(i, 3), Message::PRIO_INFORMATION);
+			pChannel->log(msg);
+		}
+		pChannel->close();
+
+		// No message must be lost or reordered during rotation.
+		std::vector<std::string> files;
+		files.push_back(name);
+		for (int i = 0; File(name + "." + NumberFormatter::format(i)).exists(); ++i)
+		{
+			files.push_back(name + "." + NumberFormatter::format(i));
+		}
+		assertTrue (files.size() >= 2);
+
+		int expected = 0;
+		for (auto it = files.rbegin(); it != files.rend(); ++it)
+		{
+			Poco::FileInputStream istr(*it);
+			std::string line;
+			while (std::getline(istr, line))
+			{
+				assertTrue (line == "This is log file entry " + NumberFormatter::format0(expected, 3));
+				++expected;
+			}
+		}
+		assertTrue (expected == 500);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
 void FileChannelTest::testRotateBySize()
 {
 	std::string name = filename();
@@ -947,6 +1119,10 @@ CppUnit::Test* FileChannelTest::suite()
 
 	CppUnit_addTest(pSuite, FileChannelTest, testRotateNever);
 	CppUnit_addTest(pSuite, FileChannelTest, testFlushing);
+	CppUnit_addTest(pSuite, FileChannelTest, testWriteCombining);
+	CppUnit_addTest(pSuite, FileChannelTest, testBackgroundFlush);
+	CppUnit_addTest(pSuite, FileChannelTest, testSync);
+	CppUnit_addTest(pSuite, FileChannelTest, testAsyncRotation);
 	CppUnit_addTest(pSuite, FileChannelTest, testRotateBySize);
 	CppUnit_addTest(pSuite, FileChannelTest, testRotateByAge);
 	CppUnit_addLongTest(pSuite, FileChannelTest, testRotateAtTimeDayUTC);
@@ -33,6 +33,10 @@ public:
 
 	void testRotateNever();
 	void testFlushing();
+	void testWriteCombining();
+	void testBackgroundFlush();
+	void testSync();
+	void testAsyncRotation();
 	void testRotateBySize();
 	void testRotateByAge();
 	void testRotateAtTimeDayUTC();
@@ -0,0 +1,476 @@
+//
+// FlatHashMapTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "FlatHashMapTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/FlatHashMap.h"
+#include "Poco/FlatHashSet.h"
+#include "Poco/Exception.h"
+#include "Poco/NumberFormatter.h"
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+
+
+using Poco::FlatHashMap;
+using Poco::FlatHashSet;
+using Poco::NumberFormatter;
+
+
+FlatHashMapTest::FlatHashMapTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+FlatHashMapTest::~FlatHashMapTest()
+{
+}
+
+
+void FlatHashMapTest::testInsert()
+{
+	const int N = 1000;
+
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	assertTrue (hm.empty());
+	assertTrue (hm.find(0) == hm.end());
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntMap::Iterator, bool> res = hm.insert(IntMap::ValueType(i, i*2));
+		assertTrue (res.first->first == i);
+		assertTrue (res.first->second == i*2);
+		assertTrue (res.second);
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it != hm.end());
+		assertTrue (it->first == i);
+		assertTrue (it->second == i*2);
+		assertTrue (hm.count(i) == 1);
+		assertTrue (hm.size() == i + 1);
+	}
+
+	assertTrue (!hm.empty());
+	assertTrue (hm.load_factor() <= hm.max_load_factor());
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it != hm.end());
+		assertTrue (it->first == i);
+		assertTrue (it->second == i*2);
+	}
+	assertTrue (hm.find(N) == hm.end());
+	assertTrue (!hm.contains(-1));
+
+	for (int i = 0; i < N; ++i)
+	{
+		std::pair<IntMap::Iterator, bool> res = hm.insert(std::make_pair(i, 0));
+		assertTrue (res.first->first == i);
+		assertTrue (res.first->second == i*2);
+		assertTrue (!res.second);
+	}
+
+	std::pair<IntMap::Iterator, bool> res = hm.emplace(N, N*2);
+	assertTrue (res.second);
+	res = hm.try_emplace(N, 0);
+	assertTrue (!res.second);
+	assertTrue (res.first->second == N*2);
+	res = hm.insert_or_assign(N, 1);
+	assertTrue (!res.second);
+	assertTrue (hm.at(N) == 1);
+	assertTrue (hm.size() == N + 1);
+}
+
+
+void FlatHashMapTest::testErase()
+{
+	const int N = 1000;
+
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(std::make_pair(i, i*2));
+	}
+	assertTrue (hm.size() == N);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		assertTrue (hm.erase(i) == 1);
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it == hm.end());
+	}
+	assertTrue (hm.size() == N/2);
+	assertTrue (hm.erase(0) == 0);
+
+	for (int i = 0; i < N; i += 2)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it == hm.end());
+	}
+
+	for (int i = 1; i < N; i += 2)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it != hm.end());
+		assertTrue (it->first == i);
+	}
+
+	for (int i = 0; i < N; i += 2)
+	{
+		hm.insert(std::make_pair(i, i*2));
+	}
+
+	for (int i = 0; i < N; ++i)
+	{
+		IntMap::Iterator it = hm.find(i);
+		assertTrue (it != hm.end());
+		assertTrue (it->first == i);
+		assertTrue (it->second == i*2);
+	}
+
+	// erase while iterating
+	IntMap::Iterator it = hm.begin();
+	while (it != hm.end())
+	{
+		if (it->first % 3 == 0) it = hm.erase(it);
+		else ++it;
+	}
+	for (int i = 0; i < N; ++i)
+	{
+		assertTrue (hm.contains(i) == (i % 3 != 0));
+	}
+
+	hm.clear();
+	assertTrue (hm.empty());
+	assertTrue (hm.begin() == hm.end());
+	assertTrue (hm.find(1) == hm.end());
+}
+
+
+void FlatHashMapTest::testIterator()
+{
+	const int N = 1000;
+
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(std::make_pair(i, i*2));
+	}
+
+	std::map<int, int> values;
+	IntMap::Iterator it; // do not initialize here to test proper behavior of uninitialized iterators
+	it = hm.begin();
+	while (it != hm.end())
+	{
+		assertTrue (values.find(it->first) == values.end());
+		values[it->first] = it->second;
+		it->second = it->first*3;
+		++it;
+	}
+
+	assertTrue (values.size() == N);
+	for (int i = 0; i < N; ++i)
+	{
+		assertTrue (hm[i] == i*3);
+	}
+}
+
+
+void FlatHashMapTest::testConstIterator()
+{
+	const int N = 1000;
+
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm.insert(std::make_pair(i, i*2));
+	}
+
+	std::map<int, int> values;
+	const IntMap& chm = hm;
+	IntMap::ConstIterator it = chm.begin();
+	while (it != chm.end())
+	{
+		assertTrue (values.find(it->first) == values.end());
+		values[it->first] = it->second;
+		++it;
+	}
+
+	assertTrue (values.size() == N);
+	assertTrue (chm.at(5) == 10);
+	try
+	{
+		chm.at(N);
+		fail ("no such element - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+}
+
+
+void FlatHashMapTest::testIndex()
+{
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+
+	hm[1] = 2;
+	hm[2] = 4;
+	hm[3] = 6;
+
+	assertTrue (hm.size() == 3);
+	assertTrue (hm[1] == 2);
+	assertTrue (hm[2] == 4);
+	assertTrue (hm[3] == 6);
+	assertTrue (hm[4] == 0);
+	assertTrue (hm.size() == 4);
+}
+
+
+void FlatHashMapTest::testStringKeys()
+{
+	using StringMap = FlatHashMap<std::string, std::unique_ptr<int>>;
+	StringMap hm;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		hm.try_emplace("key" + NumberFormatter::format(i), new int(i));
+	}
+	assertTrue (hm.size() == 200);
+
+	// heterogeneous lookup, no std::string constructed
+	std::string_view sv("key42");
+	StringMap::Iterator it = hm.find(sv);
+	assertTrue (it != hm.end());
+	assertTrue (*it->second == 42);
+	assertTrue (hm.contains("key199"));
+	assertTrue (!hm.contains("key200"));
+	assertTrue (hm.erase(std::string_view("key0")) == 1);
+	assertTrue (!hm.contains(std::string("key0")));
+
+	// move-only values survive rehashing
+	hm.rehash(4096);
+	assertTrue (hm.capacity() >= 4096);
+	assertTrue (*hm.at("key100") == 100);
+	assertTrue (hm.size() == 199);
+}
+
+
+void FlatHashMapTest::testCopyMove()
+{
+	using StringMap = FlatHashMap<std::string, std::string>;
+	StringMap hm = {{"a", "1"}, {"b", "2"}, {"c", "3"}};
+
+	StringMap copy(hm);
+	assertTrue (copy.size() == 3);
+	assertTrue (copy["b"] == "2");
+	copy["b"] = "x";
+	assertTrue (hm["b"] == "2");
+
+	StringMap moved(std::move(copy));
+	assertTrue (moved.size() == 3);
+	assertTrue (moved["b"] == "x");
+	assertTrue (copy.empty());
+	assertTrue (copy.find("a") == copy.end());
+	copy["d"] = "4";
+	assertTrue (copy.size() == 1);
+
+	copy = hm;
+	assertTrue (copy.size() == 3);
+	assertTrue (!copy.contains("d"));
+
+	moved = std::move(copy);
+	assertTrue (moved.size() == 3);
+	assertTrue (moved["b"] == "2");
+
+	hm.swap(copy);
+	assertTrue (hm.empty());
+	assertTrue (copy.size() == 3);
+}
+
+
+void FlatHashMapTest::testRehash()
+{
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm(1000);
+	std::size_t capacity = hm.capacity();
+	assertTrue (capacity >= 1000);
+	for (int i = 0; i < 1000; ++i)
+	{
+		hm[i] = i;
+	}
+	assertTrue (hm.capacity() == capacity);
+
+	for (int i = 100; i < 1000; ++i)
+	{
+		hm.erase(i);
+	}
+	hm.rehash(0);
+	assertTrue (hm.capacity() < capacity);
+	assertTrue (hm.size() == 100);
+	for (int i = 0; i < 100; ++i)
+	{
+		assertTrue (hm[i] == i);
+	}
+
+	hm.clear();
+	hm.rehash(0);
+	assertTrue (hm.capacity() == 0);
+	assertTrue (hm.find(1) == hm.end());
+	hm[1] = 1;
+	assertTrue (hm.size() == 1);
+}
+
+
+void FlatHashMapTest::testChurn()
+{
+	// Alternating insertions and erasures must neither grow the
+	// table without bounds nor lose elements to tombstones.
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+	std::set<int> reference;
+	unsigned seed = 12345;
+	for (int i = 0; i < 100000; ++i)
+	{
+		seed = seed*1103515245 + 12345;
+		int key = static_cast<int>((seed >> 8) % 2000);
+		if (seed & 0x10000)
+		{
+			hm[key] = key;
+			reference.insert(key);
+		}
+		else
+		{
+			assertTrue (hm.erase(key) == reference.erase(key));
+		}
+	}
+	assertTrue (hm.size() == reference.size());
+	assertTrue (hm.capacity() <= 4096);
+	for (int key: reference)
+	{
+		assertTrue (hm.contains(key));
+	}
+	std::size_t count = 0;
+	for (const auto& p: hm)
+	{
+		assertTrue (reference.count(p.first) == 1);
+		++count;
+	}
+	assertTrue (count == reference.size());
+}
+
+
+void FlatHashMapTest::testSet()
+{
+	using StringSet = FlatHashSet<std::string>;
+	StringSet hs = {"one", "two", "three"};
+
+	assertTrue (hs.size() == 3);
+	assertTrue (hs.contains("two"));
+	assertTrue (!hs.insert("two").second);
+	assertTrue (hs.insert("four").second);
+	assertTrue (hs.count(std::string_view("four")) == 1);
+	assertTrue (hs.erase("one") == 1);
+	assertTrue (hs.size() == 3);
+
+	std::set<std::string> values(hs.begin(), hs.end());
+	assertTrue (values.size() == 3);
+	assertTrue (values.count("three") == 1);
+
+	StringSet::Iterator it = hs.find("three");
+	it = hs.erase(it);
+	assertTrue (hs.size() == 2);
+	assertTrue (!hs.contains("three"));
+}
+
+
+void FlatHashMapTest::testHashBytes()
+{
+	std::string data("The quick brown fox jumps over the lazy dog, again and again and again.");
+	std::set<Poco::UInt64> hashes;
+	for (std::size_t n = 0; n <= data.size(); ++n)
+	{
+		Poco::UInt64 h = Poco::hashBytes(data.data(), n);
+		assertTrue (h == Poco::hashBytes(data.data(), n));
+		assertTrue (hashes.insert(h).second);
+		assertTrue (Poco::hashBytes(data.data(), n, 1) != h);
+	}
+
+	// the hash must not depend on alignment
+	std::string shifted = "x" + data;
+	assertTrue (Poco::hashBytes(shifted.data() + 1, data.size()) == Poco::hashBytes(data.data(), data.size()));
+	assertTrue (Poco::hash(data) == static_cast<std::size_t>(Poco::hashBytes(data.data(), data.size())));
+
+	// nearby integers must differ in the fingerprint bits
+	std::set<Poco::UInt64> fingerprints;
+	for (Poco::UInt64 i = 0; i < 128; ++i)
+	{
+		fingerprints.insert(Poco::hashMix(i) & 0x7F);
+	}
+	assertTrue (fingerprints.size() > 64);
+}
+
+
+void FlatHashMapTest::testStatistic()
+{
+	using IntMap = FlatHashMap<int, int>;
+	IntMap hm;
+	for (int i = 0; i < 1000; ++i)
+	{
+		hm[i] = i;
+	}
+	auto stat = hm.currentState(true);
+	assertTrue (stat.numberOfEntries() == 1000);
+	assertTrue (stat.maxPositionsOfTable() == hm.capacity()/16);
+	assertTrue (stat.detailedEntriesPerHash().size() == hm.capacity()/16);
+	assertTrue (stat.maxEntriesPerHash() < 40);
+}
+
+
+void FlatHashMapTest::setUp()
+{
+}
+
+
+void FlatHashMapTest::tearDown()
+{
+}
+
+
+CppUnit::Test* FlatHashMapTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("FlatHashMapTest");
+
+	CppUnit_addTest(pSuite, FlatHashMapTest, testInsert);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testErase);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testIterator);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testConstIterator);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testIndex);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testStringKeys);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testCopyMove);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testRehash);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testChurn);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testSet);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testHashBytes);
+	CppUnit_addTest(pSuite, FlatHashMapTest, testStatistic);
+
+	return pSuite;
+}
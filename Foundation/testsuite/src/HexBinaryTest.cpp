@@ -13,10 +13,14 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/HexBinaryEncoder.h"
 #include "Poco/HexBinaryDecoder.h"
+#include "Poco/HexBinary.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/String.h"
 #include "Poco/Exception.h"
 #include <sstream>
 
 
+using Poco::HexBinary;
 using Poco::HexBinaryEncoder;
 using Poco::HexBinaryDecoder;
 using Poco::DataFormatException;
@@ -217,6 +221,51 @@ void HexBinaryTest::testEncodeDecode()
 }
 
 
+void HexBinaryTest::testBuffer()
+{
+	assertTrue (HexBinary::encode("") == "");
+	assertTrue (HexBinary::encode("\x01\xAB\xff") == "01abff");
+	assertTrue (HexBinary::encode("\x01\xAB\xff", true) == "01ABFF");
+	assertTrue (HexBinary::decode("01 ab\r\nFF") == "\x01\xAB\xff");
+
+	// lengths around the vector block sizes
+	std::string data;
+	for (int length = 0; length < 100; length++)
+	{
+		std::string expected;
+		for (char c: data) expected += Poco::NumberFormatter::formatHex(static_cast<unsigned char>(c), 2);
+		const std::string encoded = HexBinary::encode(data, true);
+		assertTrue (encoded == expected);
+		assertTrue (HexBinary::decode(encoded) == data);
+		assertTrue (HexBinary::decode(Poco::toLower(encoded)) == data);
+
+		for (std::size_t pos = 0; pos < encoded.size(); pos += 7)
+		{
+			std::string invalid(encoded);
+			invalid[pos] = 'g';
+			try
+			{
+				HexBinary::decode(invalid);
+				fail("invalid digit - must throw");
+			}
+			catch (DataFormatException&)
+			{
+			}
+		}
+		data += static_cast<char>(length*37);
+	}
+
+	try
+	{
+		HexBinary::decode("01a");
+		fail("odd number of digits - must throw");
+	}
+	catch (DataFormatException&)
+	{
+	}
+}
+
+
 void HexBinaryTest::setUp()
 {
 }
@@ -234,6 +283,7 @@ CppUnit::Test* HexBinaryTest::suite()
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testDecoder);
 	CppUnit_addTest(pSuite, HexBinaryTest, testEncodeDecode);
+	CppUnit_addTest(pSuite, HexBinaryTest, testBuffer);
 
 	return pSuite;
 }
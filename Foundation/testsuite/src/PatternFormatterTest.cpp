@@ -14,11 +14,17 @@
 #include "Poco/PatternFormatter.h"
 #include "Poco/Message.h"
 #include "Poco/DateTime.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/LocalDateTime.h"
+#include "Poco/Timestamp.h"
 
 
 using Poco::PatternFormatter;
 using Poco::Message;
 using Poco::DateTime;
+using Poco::DateTimeFormatter;
+using Poco::LocalDateTime;
+using Poco::Timestamp;
 
 
 PatternFormatterTest::PatternFormatterTest(const std::string& name): CppUnit::TestCase(name)
@@ -178,6 +184,89 @@ void PatternFormatterTest::testExtractBasename()
 }
 
 
+void PatternFormatterTest::testTimestampCache()
+{
+	PatternFormatter fmt("%Y-%m-%d %H:%M:%S.%F %w %b %f %o %h%A %z [%p] %t");
+	Message msg("source", "text", Message::PRIO_WARNING);
+	std::string result;
+
+	// The timestamp prefix must follow second and day changes, and
+	// must be correct for timestamps within the same second.
+	DateTime base(2023, 12, 31, 23, 59, 58, 999, 999);
+	Timestamp::TimeDiff steps[] = {0, 1, 1, 999999, 1, 1000000, 500000, -3000000, 86400000000};
+	Timestamp ts = base.timestamp();
+	for (auto step: steps)
+	{
+		ts += step;
+		msg.setTime(ts);
+		result.clear();
+		fmt.format(msg, result);
+		assertEqual (DateTimeFormatter::format(ts, "%Y-%m-%d %H:%M:%S.%F %w %b %f %o %h%A %z") + " [Warning] text", result);
+	}
+
+	// Timestamps before the epoch
+	msg.setTime(DateTime(1969, 12, 31, 23, 59, 59, 250).timestamp());
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual (std::string("1969-12-31 23:59:59.250000 Wed Dec 31 12 11PM Z [Warning] text"), result);
+
+	// Local time, with the prefix and with %L following other fields.
+	ts = DateTime(2024, 7, 1, 12, 0, 0).timestamp();
+	msg.setTime(ts);
+	LocalDateTime local(ts);
+	fmt.setProperty("pattern", "%L%Y-%m-%d %H:%M:%S %z");
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual (DateTimeFormatter::format(local, "%Y-%m-%d %H:%M:%S %z"), result);
+
+	fmt.setProperty("pattern", "%H:%M %t %L%H:%M");
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual ("12:00 text " + DateTimeFormatter::format(local, "%H:%M"), result);
+
+	fmt.setProperty("pattern", "%H:%M:%S");
+	fmt.setProperty("times", "local");
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual (DateTimeFormatter::format(local, "%H:%M:%S"), result);
+
+	fmt.setProperty("times", "UTC");
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual (std::string("12:00:00"), result);
+
+	// A prefix that does not fit into the cache
+	fmt.setProperty("pattern", std::string(100, '-') + "%H:%M:%S");
+	result.clear();
+	fmt.format(msg, result);
+	assertEqual (std::string(100, '-') + "12:00:00", result);
+}
+
+
+void PatternFormatterTest::testBufferFormat()
+{
+	PatternFormatter fmt("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t");
+	Message msg("TestSource", "Test message text", Message::PRIO_ERROR);
+	msg.setTime(DateTime(2005, 1, 1, 14, 30, 15, 500).timestamp());
+	const std::string expected("2005-01-01 14:30:15.500 [Error] TestSource: Test message text");
+
+	char buffer[128];
+	std::size_t n = fmt.format(msg, buffer, sizeof(buffer));
+	assertEqual (expected.size(), n);
+	assertEqual (expected, std::string(buffer, n));
+
+	// The result is truncated if the buffer is too small.
+	std::fill(buffer, buffer + sizeof(buffer), 'x');
+	n = fmt.format(msg, buffer, 30);
+	assertEqual (expected.size(), n);
+	assertEqual (expected.substr(0, 30), std::string(buffer, 30));
+	assertTrue (buffer[30] == 'x');
+
+	n = fmt.format(msg, nullptr, 0);
+	assertEqual (expected.size(), n);
+}
+
+
 void PatternFormatterTest::setUp()
 {
 }
@@ -194,6 +283,8 @@ CppUnit::Test* PatternFormatterTest::suite()
 
 	CppUnit_addTest(pSuite, PatternFormatterTest, testPatternFormatter);
 	CppUnit_addTest(pSuite, PatternFormatterTest, testExtractBasename);
+	CppUnit_addTest(pSuite, PatternFormatterTest, testTimestampCache);
+	CppUnit_addTest(pSuite, PatternFormatterTest, testBufferFormat);
 
 	return pSuite;
 }
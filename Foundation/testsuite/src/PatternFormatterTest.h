@@ -26,6 +26,8 @@ public:
 
 	void testPatternFormatter();
 	void testExtractBasename();
+	void testTimestampCache();
+	void testBufferFormat();
 
 	void setUp();
 	void tearDown();
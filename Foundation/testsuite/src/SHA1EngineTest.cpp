@@ -12,6 +12,7 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/SHA1Engine.h"
+#include <algorithm>
 
 
 using Poco::SHA1Engine;
@@ -46,6 +47,27 @@ void SHA1EngineTest::testSHA1()
 }
 
 
+void SHA1EngineTest::testBlocks()
+{
+	// Feed the same data in differently sized pieces, so that blocks
+	// are processed both from the internal buffer and the input.
+	std::string data;
+	for (int i = 0; i < 1000; i++) data += static_cast<char>(i*31);
+	SHA1Engine engine;
+	engine.update(data);
+	const std::string expected = DigestEngine::digestToHex(engine.digest());
+	assertTrue (expected == "6d8e2f33dbd4328b794d66be4d1abbec1c6f0fbb");
+
+	const std::size_t pieces[] = {1, 3, 63, 64, 65, 127, 200};
+	for (std::size_t piece: pieces)
+	{
+		for (std::size_t pos = 0; pos < data.size(); pos += piece)
+			engine.update(data.data() + pos, std::min(piece, data.size() - pos));
+		assertTrue (DigestEngine::digestToHex(engine.digest()) == expected);
+	}
+}
+
+
 void SHA1EngineTest::setUp()
 {
 }
@@ -61,6 +83,7 @@ CppUnit::Test* SHA1EngineTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SHA1EngineTest");
 
 	CppUnit_addTest(pSuite, SHA1EngineTest, testSHA1);
+	CppUnit_addTest(pSuite, SHA1EngineTest, testBlocks);
 
 	return pSuite;
 }
@@ -16,10 +16,12 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/SHA2Engine.h"
+#include "Poco/CPUFeatures.h"
 
 
 using Poco::SHA2Engine;
 using Poco::DigestEngine;
+using Poco::CPUFeatures;
 
 
 SHA2EngineTest::SHA2EngineTest(const std::string& rName): CppUnit::TestCase(rName)
@@ -173,6 +175,60 @@ void SHA2EngineTest::testSHA512_256()
 	assertTrue (DigestEngine::digestToHex(engine.digest()) == "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21");
 }
 
+void SHA2EngineTest::testDigestMany()
+{
+	std::vector<std::string> data;
+	for (int i = 0; i < 150; i++)
+	{
+		std::string message;
+		for (int j = 0; j < i; j++) message += static_cast<char>(i + j*7);
+		data.push_back(message);
+	}
+	std::vector<std::string_view> messages(data.begin(), data.end());
+
+	const SHA2Engine::ALGORITHM algorithms[] = {SHA2Engine::SHA_224, SHA2Engine::SHA_256, SHA2Engine::SHA_512};
+	for (auto algorithm: algorithms)
+	{
+		const std::vector<DigestEngine::Digest> digests = SHA2Engine::digestMany(messages, algorithm);
+		assertTrue (digests.size() == messages.size());
+		SHA2Engine engine(algorithm);
+		for (std::size_t i = 0; i < messages.size(); i++)
+		{
+			engine.update(data[i]);
+			assertTrue (digests[i] == engine.digest());
+		}
+	}
+
+	// The AVX2 implementation is only used by digestMany() if the
+	// CPU lacks the SHA extensions, so test it explicitly as well.
+	if (CPUFeatures::hasAVX2())
+	{
+		const SHA2Engine::ALGORITHM avx2Algorithms[] = {SHA2Engine::SHA_224, SHA2Engine::SHA_256};
+		for (auto algorithm: avx2Algorithms)
+		{
+			for (std::size_t count: {std::size_t(1), std::size_t(7), messages.size()})
+			{
+				const std::vector<std::string_view> subset(messages.end() - count, messages.end());
+				const std::vector<DigestEngine::Digest> digests = SHA2Engine::digestManyAVX2(subset, algorithm);
+				assertTrue (digests.size() == subset.size());
+				SHA2Engine engine(algorithm);
+				for (std::size_t i = 0; i < subset.size(); i++)
+				{
+					engine.update(subset[i].data(), subset[i].size());
+					assertTrue (digests[i] == engine.digest());
+				}
+			}
+		}
+	}
+
+	assertTrue (SHA2Engine::digestMany({}).empty());
+	const std::vector<DigestEngine::Digest> abc = SHA2Engine::digestMany({"abc", "", "abc"});
+	assertTrue (DigestEngine::digestToHex(abc[0]) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+	assertTrue (DigestEngine::digestToHex(abc[1]) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+	assertTrue (abc[2] == abc[0]);
+}
+
+
 void SHA2EngineTest::setUp()
 {
 }
@@ -193,5 +249,6 @@ CppUnit::Test* SHA2EngineTest::suite()
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512);
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512_224);
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512_256);
+	CppUnit_addTest(pSuite, SHA2EngineTest, testDigestMany);
 	return pSuite;
 }
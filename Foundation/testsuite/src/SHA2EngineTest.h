@@ -30,6 +30,7 @@ public:
 	void testSHA512();
 	void testSHA512_224();
 	void testSHA512_256();
+	void testDigestMany();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,266 @@
+//
+// SlabAllocatorTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "SlabAllocatorTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/SlabAllocator.h"
+#include "Poco/BufferedStreamBuf.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <vector>
+#include <cstring>
+
+
+using Poco::SlabAllocator;
+using Poco::SlabBufferAllocator;
+
+
+namespace
+{
+	std::size_t freeBlocks(std::size_t blockSize)
+	{
+		for (const auto& stats: SlabAllocator::statistics())
+		{
+			if (stats.blockSize == blockSize) return stats.freeBlocks;
+		}
+		return 0;
+	}
+
+	class Deallocator: public Poco::Runnable
+	{
+	public:
+		Deallocator(std::vector<void*>& blocks, std::size_t size):
+			_blocks(blocks),
+			_size(size)
+		{
+		}
+
+		void run()
+		{
+			for (auto p: _blocks) SlabAllocator::deallocate(p, _size);
+			_blocks.clear();
+		}
+
+	private:
+		std::vector<void*>& _blocks;
+		std::size_t _size;
+	};
+
+	struct ExitAllocator
+		/// Allocates from the destructor, which runs after
+		/// the thread cache has been destroyed if the
+		/// ExitAllocator has been constructed first.
+	{
+		~ExitAllocator()
+		{
+			if (!pDone) return;
+			char* p = static_cast<char*>(SlabAllocator::allocate(64));
+			std::memset(p, 'x', 64);
+			SlabAllocator::deallocate(p, 64);
+			*pDone = true;
+		}
+
+		bool* pDone = nullptr;
+	};
+
+	thread_local ExitAllocator exitAllocator;
+
+	class ExitRunnable: public Poco::Runnable
+	{
+	public:
+		ExitRunnable(bool& done):
+			_done(done)
+		{
+		}
+
+		void run()
+		{
+			exitAllocator.pDone = &_done;
+			SlabAllocator::deallocate(SlabAllocator::allocate(64), 64);
+		}
+
+	private:
+		bool& _done;
+	};
+
+	class TestStreamBuf: public Poco::BasicBufferedStreamBuf<char, std::char_traits<char>, SlabBufferAllocator<char>>
+	{
+	public:
+		TestStreamBuf():
+			Poco::BasicBufferedStreamBuf<char, std::char_traits<char>, SlabBufferAllocator<char>>(4096, std::ios::out)
+		{
+		}
+
+		std::streamsize writeToDevice(const char* buffer, std::streamsize length) override
+		{
+			data.append(buffer, static_cast<std::size_t>(length));
+			return length;
+		}
+
+		std::string data;
+	};
+}
+
+
+SlabAllocatorTest::SlabAllocatorTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+SlabAllocatorTest::~SlabAllocatorTest()
+{
+}
+
+
+void SlabAllocatorTest::testBlockSize()
+{
+	assertTrue (SlabAllocator::blockSize(0) == SlabAllocator::MIN_BLOCK_SIZE);
+	assertTrue (SlabAllocator::blockSize(1) == SlabAllocator::MIN_BLOCK_SIZE);
+	assertTrue (SlabAllocator::blockSize(64) == 64);
+	assertTrue (SlabAllocator::blockSize(65) == 128);
+	assertTrue (SlabAllocator::blockSize(4096) == 4096);
+	assertTrue (SlabAllocator::blockSize(4097) == 8192);
+	assertTrue (SlabAllocator::blockSize(16384) == 16384);
+	assertTrue (SlabAllocator::blockSize(SlabAllocator::MAX_BLOCK_SIZE) == SlabAllocator::MAX_BLOCK_SIZE);
+	assertTrue (SlabAllocator::blockSize(SlabAllocator::MAX_BLOCK_SIZE + 1) == SlabAllocator::MAX_BLOCK_SIZE + 1);
+	assertTrue (SlabAllocator::statistics().size() == SlabAllocator::SIZE_CLASSES);
+}
+
+
+void SlabAllocatorTest::testAllocate()
+{
+	std::vector<char*> blocks;
+	for (int i = 0; i < 1000; ++i)
+	{
+		char* p = static_cast<char*>(SlabAllocator::allocate(4096));
+		std::memset(p, i & 0xFF, 4096);
+		blocks.push_back(p);
+	}
+	for (int i = 0; i < 1000; ++i)
+	{
+		for (int k = 0; k < 4096; k += 512)
+		{
+			assertTrue (static_cast<unsigned char>(blocks[i][k]) == (i & 0xFF));
+		}
+		for (int j = i + 1; j < 1000; j += 97)
+		{
+			assertTrue (blocks[i] != blocks[j]);
+		}
+	}
+	for (auto p: blocks) SlabAllocator::deallocate(p, 4096);
+
+	// a freed block is reused by the same thread
+	SlabAllocator::flushThreadCache();
+	void* p1 = SlabAllocator::allocate(100);
+	SlabAllocator::deallocate(p1, 100);
+	void* p2 = SlabAllocator::allocate(128);
+	assertTrue (p1 == p2);
+	SlabAllocator::deallocate(p2, 128);
+
+	SlabAllocator::flushThreadCache();
+	for (const auto& stats: SlabAllocator::statistics())
+	{
+		if (stats.blockSize == 4096)
+		{
+			assertTrue (stats.totalBlocks >= 1000);
+			assertTrue (stats.refills > 0);
+			assertTrue (stats.flushes > 0);
+		}
+	}
+}
+
+
+void SlabAllocatorTest::testCrossThread()
+{
+	SlabAllocator::flushThreadCache();
+	const std::size_t freeBefore = freeBlocks(16384);
+
+	std::vector<void*> blocks;
+	for (int i = 0; i < 100; ++i)
+	{
+		blocks.push_back(SlabAllocator::allocate(16384));
+	}
+	SlabAllocator::flushThreadCache();
+
+	Deallocator deallocator(blocks, 16384);
+	Poco::Thread thread;
+	thread.start(deallocator);
+	thread.join();
+	assertTrue (blocks.empty());
+
+	// the terminated thread has returned its cached blocks
+	SlabAllocator::flushThreadCache();
+	assertTrue (freeBlocks(16384) >= freeBefore);
+}
+
+
+void SlabAllocatorTest::testThreadExit()
+{
+	bool done = false;
+	ExitRunnable runnable(done);
+	Poco::Thread thread;
+	thread.start(runnable);
+	thread.join();
+	assertTrue (done);
+}
+
+
+void SlabAllocatorTest::testLargeBlocks()
+{
+	const std::size_t size = SlabAllocator::MAX_BLOCK_SIZE + 1;
+	char* p = static_cast<char*>(SlabAllocator::allocate(size));
+	std::memset(p, 'x', size);
+	assertTrue (p[size - 1] == 'x');
+	SlabAllocator::deallocate(p, size);
+	SlabAllocator::deallocate(nullptr, 4096);
+}
+
+
+void SlabAllocatorTest::testBufferAllocator()
+{
+	std::string expected;
+	{
+		TestStreamBuf buf;
+		std::ostream ostr(&buf);
+		for (int i = 0; i < 1000; ++i)
+		{
+			ostr << "line " << i << '\n';
+			expected += "line " + std::to_string(i) + '\n';
+		}
+		ostr.flush();
+		assertTrue (buf.data == expected);
+	}
+}
+
+
+void SlabAllocatorTest::setUp()
+{
+}
+
+
+void SlabAllocatorTest::tearDown()
+{
+}
+
+
+CppUnit::Test* SlabAllocatorTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SlabAllocatorTest");
+
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testBlockSize);
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testAllocate);
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testCrossThread);
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testThreadExit);
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testLargeBlocks);
+	CppUnit_addTest(pSuite, SlabAllocatorTest, testBufferAllocator);
+
+	return pSuite;
+}
@@ -0,0 +1,43 @@
+//
+// SlabAllocatorTest.h
+//
+// Definition of the SlabAllocatorTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SlabAllocatorTest_INCLUDED
+#define SlabAllocatorTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class SlabAllocatorTest: public CppUnit::TestCase
+{
+public:
+	SlabAllocatorTest(const std::string& name);
+	~SlabAllocatorTest();
+
+	void testBlockSize();
+	void testAllocate();
+	void testCrossThread();
+	void testThreadExit();
+	void testLargeBlocks();
+	void testBufferAllocator();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // SlabAllocatorTest_INCLUDED
@@ -67,6 +67,8 @@ using Poco::intToStr;
 using Poco::intToStr;
 using Poco::floatToStr;
 using Poco::doubleToStr;
+using Poco::toChars;
+using Poco::fromChars;
 using Poco::thousandSeparator;
 using Poco::decimalSeparator;
 using Poco::format;
@@ -1073,6 +1075,146 @@ void StringTest::testFloatToString()
 }
 
 
+void StringTest::testToChars()
+{
+	char buffer[POCO_MAX_FLT_STRING_LEN];
+
+	auto res = toChars(buffer, buffer + sizeof(buffer), 0);
+	assertTrue (res.ec == std::errc());
+	assertTrue (std::string(buffer, res.ptr) == "0");
+	res = toChars(buffer, buffer + sizeof(buffer), std::numeric_limits<Poco::Int64>::min());
+	assertTrue (std::string(buffer, res.ptr) == "-9223372036854775808");
+	res = toChars(buffer, buffer + sizeof(buffer), std::numeric_limits<Poco::UInt64>::max());
+	assertTrue (std::string(buffer, res.ptr) == "18446744073709551615");
+	res = toChars(buffer, buffer + 3, 1234);
+	assertTrue (res.ec == std::errc::value_too_large);
+
+	const double doubles[] = {0.0, -0.0, 1.0, -1.5, 0.1, 1e15, 1e16, 1.03721575516329e-112,
+		123456.789, std::numeric_limits<double>::max(), std::numeric_limits<double>::denorm_min(),
+		std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()};
+	for (double d: doubles)
+	{
+		res = toChars(buffer, buffer + sizeof(buffer), d);
+		assertTrue (res.ec == std::errc());
+		const std::string str(buffer, res.ptr);
+		assertTrue (str == Poco::NumberFormatter::format(d));
+		if (!FPEnvironment::isNaN(d))
+		{
+			double back = 0;
+			assertTrue (fromChars(str, back));
+			assertTrue (back == d);
+		}
+	}
+
+	const float floats[] = {0.0f, 1.0f, -1.5f, 0.1f, 3.4028235e38f, 1e-7f};
+	for (float f: floats)
+	{
+		res = toChars(buffer, buffer + sizeof(buffer), f);
+		assertTrue (res.ec == std::errc());
+		assertTrue (std::string(buffer, res.ptr) == Poco::NumberFormatter::format(f));
+	}
+
+	res = toChars(buffer, buffer + 3, 123.456);
+	assertTrue (res.ec == std::errc::value_too_large);
+}
+
+
+void StringTest::testFromChars()
+{
+	int i = 0;
+	assertTrue (fromChars("0", i) && i == 0);
+	assertTrue (fromChars("-2147483648", i) && i == std::numeric_limits<int>::min());
+	assertTrue (fromChars("2147483647", i) && i == std::numeric_limits<int>::max());
+	assertTrue (fromChars("000000000000000000000000042", i) && i == 42);
+	i = 7;
+	assertTrue (!fromChars("2147483648", i) && i == 7);
+	assertTrue (!fromChars("-2147483649", i) && i == 7);
+	assertTrue (!fromChars("", i));
+	assertTrue (!fromChars("-", i));
+	assertTrue (!fromChars("+1", i));
+	assertTrue (!fromChars(" 1", i));
+	assertTrue (!fromChars("1 ", i));
+	assertTrue (!fromChars("1,000", i));
+	assertTrue (i == 7);
+
+	unsigned u = 0;
+	assertTrue (!fromChars("-1", u));
+	assertTrue (fromChars("4294967295", u) && u == 4294967295u);
+	assertTrue (!fromChars("4294967296", u));
+
+	Poco::Int8 i8 = 0;
+	assertTrue (fromChars("-128", i8) && i8 == -128);
+	assertTrue (!fromChars("128", i8));
+
+	Poco::Int64 i64 = 0;
+	assertTrue (fromChars("-9223372036854775808", i64) && i64 == std::numeric_limits<Poco::Int64>::min());
+	assertTrue (fromChars("9223372036854775807", i64) && i64 == std::numeric_limits<Poco::Int64>::max());
+	assertTrue (!fromChars("9223372036854775808", i64));
+
+	Poco::UInt64 u64 = 0;
+	assertTrue (fromChars("18446744073709551615", u64) && u64 == std::numeric_limits<Poco::UInt64>::max());
+	assertTrue (!fromChars("18446744073709551616", u64));
+	assertTrue (!fromChars("99999999999999999999999999", u64));
+
+	// Check every length and digit position against std::from_chars,
+	// to cover both the eight-digit blocks and the remaining digits.
+	const std::string digits = "12345678901234567890";
+	for (std::size_t len = 1; len <= digits.size(); ++len)
+	{
+		for (std::size_t pos = 0; pos < len; ++pos)
+		{
+			std::string str = digits.substr(0, len);
+			for (char c: {'0', '9', 'x', ':', '/'})
+			{
+				str[pos] = c;
+				Poco::UInt64 expected = 1;
+				Poco::UInt64 actual = 1;
+				const auto r1 = std::from_chars(str.data(), str.data() + str.size(), expected);
+				const auto r2 = fromChars(str.data(), str.data() + str.size(), actual);
+				assertTrue (r1.ptr == r2.ptr);
+				assertTrue (r1.ec == r2.ec);
+				assertTrue (expected == actual);
+			}
+		}
+	}
+
+	const char* str = "12345abc";
+	const auto res = fromChars(str, str + 8, i);
+	assertTrue (res.ec == std::errc() && res.ptr == str + 5 && i == 12345);
+
+	const auto inv = fromChars(str + 5, str + 8, i);
+	assertTrue (inv.ec == std::errc::invalid_argument && inv.ptr == str + 5);
+
+	const std::string big = "123456789012345678901234567890x";
+	const auto ovf = fromChars(big.data(), big.data() + big.size(), u64);
+	assertTrue (ovf.ec == std::errc::result_out_of_range && ovf.ptr == big.data() + 30);
+
+	double d = 0;
+	assertTrue (fromChars("1.5", d) && d == 1.5);
+	assertTrue (fromChars("-1e-3", d) && d == -1e-3);
+	assertTrue (fromChars("inf", d) && FPEnvironment::isInfinite(d));
+	assertTrue (fromChars("nan", d) && FPEnvironment::isNaN(d));
+	d = 2;
+	assertTrue (!fromChars("", d));
+	assertTrue (!fromChars("1.5x", d));
+	assertTrue (!fromChars("+1.5", d));
+	assertTrue (!fromChars("1e400", d));
+	assertTrue (d == 2);
+
+	float f = 0;
+	assertTrue (fromChars("0.1", f) && f == 0.1f);
+	assertTrue (!fromChars("1e40", f));
+
+	// strToInt() and strToDouble() still accept thousand separators
+	// and other decorations around the number.
+	assertTrue (strToInt("  1,234,567", i, 10) && i == 1234567);
+	assertTrue (strToInt("+42", i, 10) && i == 42);
+	assertTrue (strToDouble(" 1,234.5 ", d) && d == 1234.5);
+	assertTrue (strToDouble("1.234,5", d, ',', '.') && d == 1234.5);
+	assertTrue (strToDouble("1.5", d, ',', '.') && d == 15);
+}
+
+
 void StringTest::testNumericStringLimit()
 {
 	char c = 0, t = -1;
@@ -1699,6 +1841,8 @@ CppUnit::Test* StringTest::suite()
 	CppUnit_addTest(pSuite, StringTest, testNumericLocale);
 	CppUnit_addTest(pSuite, StringTest, testIntToString);
 	CppUnit_addTest(pSuite, StringTest, testFloatToString);
+	CppUnit_addTest(pSuite, StringTest, testToChars);
+	CppUnit_addTest(pSuite, StringTest, testFromChars);
 	CppUnit_addTest(pSuite, StringTest, testJSONString);
 	CppUnit_addTest(pSuite, StringTest, conversionBenchmarks);
 
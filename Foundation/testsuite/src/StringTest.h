@@ -55,6 +55,8 @@ public:
 
 	void testIntToString();
 	void testFloatToString();
+	void testToChars();
+	void testFromChars();
 
 	void conversionBenchmarks();
 	void benchmarkFloatToStr();
@@ -0,0 +1,334 @@
+//
+// TimerWheelTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "TimerWheelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/TimerWheel.h"
+#include "Poco/Random.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Exception.h"
+#include "Poco/ErrorHandler.h"
+#include <atomic>
+#include <vector>
+
+
+using Poco::TimerWheel;
+using Poco::Clock;
+using Poco::Timespan;
+
+
+namespace
+{
+	const Clock::ClockDiff MS = 1000;
+	const Clock::ClockDiff SECOND = 1000*MS;
+
+	class CountingErrorHandler: public Poco::ErrorHandler
+	{
+	public:
+		void exception(const Poco::Exception&) override
+		{
+			++count;
+		}
+
+		void exception(const std::exception&) override
+		{
+			++count;
+		}
+
+		void exception() override
+		{
+			++count;
+		}
+
+		int count = 0;
+	};
+}
+
+
+TimerWheelTest::TimerWheelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+TimerWheelTest::~TimerWheelTest()
+{
+}
+
+
+void TimerWheelTest::testSchedule()
+{
+	Clock base;
+	TimerWheel wheel;
+	std::vector<int> fired;
+
+	wheel.schedule(base + 30*MS, [&fired]() { fired.push_back(3); });
+	wheel.schedule(base + 10*MS, [&fired]() { fired.push_back(1); });
+	wheel.schedule(base + 20*MS, [&fired]() { fired.push_back(2); });
+	assertEqual (3, wheel.size());
+
+	assertEqual (0, wheel.advance(base + 5*MS));
+	assertTrue (fired.empty());
+
+	assertEqual (2, wheel.advance(base + 21*MS));
+	assertEqual (2, fired.size());
+	assertEqual (1, fired[0]);
+	assertEqual (2, fired[1]);
+	assertEqual (1, wheel.size());
+
+	assertEqual (1, wheel.advance(base + 40*MS));
+	assertEqual (3, fired[2]);
+	assertTrue (wheel.empty());
+
+	// A timer that has already expired is run on the next tick.
+	wheel.schedule(base, [&fired]() { fired.push_back(4); });
+	assertEqual (1, wheel.advance(base + 42*MS));
+	assertEqual (4, fired[3]);
+}
+
+
+void TimerWheelTest::testCancel()
+{
+	Clock base;
+	TimerWheel wheel;
+	int fired = 0;
+
+	TimerWheel::TimerId id1 = wheel.schedule(base + 10*MS, [&fired]() { ++fired; });
+	TimerWheel::TimerId id2 = wheel.schedule(base + 10*MS, [&fired]() { ++fired; });
+	assertTrue (id1 != id2);
+	assertTrue (id1 != TimerWheel::INVALID_TIMER);
+	assertTrue (wheel.isScheduled(id1));
+
+	assertTrue (wheel.cancel(id1));
+	assertTrue (!wheel.isScheduled(id1));
+	assertTrue (!wheel.cancel(id1));
+	assertEqual (1, wheel.size());
+
+	assertEqual (1, wheel.advance(base + 20*MS));
+	assertEqual (1, fired);
+
+	// Expired timers cannot be cancelled, and IDs are not reused.
+	assertTrue (!wheel.cancel(id2));
+	TimerWheel::TimerId id3 = wheel.schedule(base + 30*MS, [&fired]() { ++fired; });
+	assertTrue (id3 != id1 && id3 != id2);
+	assertTrue (!wheel.isScheduled(id1));
+	assertTrue (!wheel.isScheduled(id2));
+	assertTrue (!wheel.cancel(TimerWheel::INVALID_TIMER));
+
+	wheel.schedule(base + 40*MS, [&fired]() { ++fired; });
+	wheel.clear();
+	assertTrue (wheel.empty());
+	assertTrue (!wheel.isScheduled(id3));
+	assertEqual (0, wheel.advance(base + 50*MS));
+	assertEqual (1, fired);
+}
+
+
+void TimerWheelTest::testReschedule()
+{
+	Clock base;
+	TimerWheel wheel;
+	int fired = 0;
+
+	TimerWheel::TimerId id = wheel.schedule(base + 100*MS, [&fired]() { ++fired; });
+	assertTrue (wheel.reschedule(id, base + 500*MS));
+	assertEqual (0, wheel.advance(base + 200*MS));
+	assertTrue (wheel.reschedule(id, base + 300*MS));
+	assertEqual (0, wheel.advance(base + 299*MS));
+	assertEqual (1, wheel.advance(base + 302*MS));
+	assertEqual (1, fired);
+	assertTrue (!wheel.reschedule(id, base + 400*MS));
+}
+
+
+void TimerWheelTest::testCascade()
+{
+	Clock base;
+	TimerWheel wheel;
+	std::vector<Clock::ClockDiff> delays = {
+		255*MS, 256*MS, 257*MS, 1*SECOND, 65*SECOND, 66*SECOND,
+		3600*SECOND, 5*3600*SECOND, 10*24*3600*SECOND, 60LL*24*3600*SECOND
+	};
+	std::vector<Clock::ClockDiff> fired(delays.size(), 0);
+	Clock::ClockDiff now = 0;
+	for (std::size_t i = 0; i < delays.size(); ++i)
+	{
+		wheel.schedule(base + delays[i], [&fired, &now, i]() { fired[i] = now; });
+	}
+
+	// Advance in irregular steps, the timers must expire in time.
+	Poco::Random rnd;
+	while (!wheel.empty())
+	{
+		Clock::ClockDiff step = now < 2*SECOND ? MS : (now < 3600*SECOND ? 37*MS : 1234*MS);
+		now += step + rnd.next(2)*MS;
+		wheel.advance(base + now);
+	}
+	for (std::size_t i = 0; i < delays.size(); ++i)
+	{
+		assertTrue (fired[i] >= delays[i]);
+		assertTrue (fired[i] <= delays[i] + 1236*MS);
+	}
+}
+
+
+void TimerWheelTest::testManyTimers()
+{
+	Clock base;
+	TimerWheel wheel;
+	const int n = 100000;
+	std::vector<Clock::ClockDiff> delays(n);
+	std::vector<TimerWheel::TimerId> ids(n);
+	std::vector<int> fired(n, 0);
+	Clock::ClockDiff now = 0;
+	bool early = false;
+	bool late = false;
+
+	Poco::Random rnd;
+	for (int i = 0; i < n; ++i)
+	{
+		delays[i] = static_cast<Clock::ClockDiff>(rnd.next(100000))*MS/10;
+		ids[i] = wheel.schedule(base + delays[i], [&, i]()
+			{
+				++fired[i];
+				if (now < delays[i]) early = true;
+				if (now > delays[i] + 2*MS) late = true;
+			});
+	}
+	for (int i = 0; i < n; i += 3)
+	{
+		assertTrue (wheel.cancel(ids[i]));
+	}
+	assertEqual (n - (n + 2)/3, wheel.size());
+
+	while (!wheel.empty())
+	{
+		now += MS;
+		wheel.advance(base + now);
+	}
+	assertTrue (!early);
+	assertTrue (!late);
+	for (int i = 0; i < n; ++i)
+	{
+		assertEqual (i % 3 == 0 ? 0 : 1, fired[i]);
+	}
+}
+
+
+void TimerWheelTest::testNextTimeout()
+{
+	TimerWheel wheel;
+	Timespan maxTimeout(1, 0);
+	assertTrue (wheel.nextTimeout(maxTimeout) == maxTimeout);
+
+	wheel.schedule(Timespan(50*MS), []() {});
+	Timespan timeout = wheel.nextTimeout(maxTimeout);
+	assertTrue (timeout.totalMilliseconds() > 0);
+	assertTrue (timeout.totalMilliseconds() <= 51);
+
+	wheel.schedule(Timespan(5*MS), []() {});
+	timeout = wheel.nextTimeout(maxTimeout);
+	assertTrue (timeout.totalMilliseconds() <= 6);
+
+	Poco::Thread::sleep(10);
+	assertTrue (wheel.nextTimeout(maxTimeout) == 0);
+	assertEqual (1, wheel.advance());
+
+	// Timers far in the future wake up the driving thread at the
+	// end of each rotation of the lowest level at most.
+	wheel.clear();
+	wheel.schedule(Timespan(10*SECOND), []() {});
+	timeout = wheel.nextTimeout(maxTimeout);
+	assertTrue (timeout.totalMilliseconds() <= 257);
+}
+
+
+void TimerWheelTest::testWakeUp()
+{
+	TimerWheel wheel;
+	Poco::Event wakeUp;
+	std::atomic<int> fired(0);
+	wheel.setWakeUpCallback([&wakeUp]() { wakeUp.set(); });
+
+	// The driving thread sleeps for up to one second, unless woken up.
+	Poco::Thread thread;
+	std::atomic<bool> stop(false);
+	Poco::Event sleeping;
+	thread.startFunc([&]()
+		{
+			while (!stop)
+			{
+				Timespan timeout = wheel.nextTimeout(Timespan(1, 0));
+				sleeping.set();
+				wakeUp.tryWait(static_cast<long>(timeout.totalMilliseconds()));
+				wheel.advance();
+			}
+		});
+
+	sleeping.wait();
+	Clock start;
+	wheel.schedule(Timespan(20*MS), [&fired]() { ++fired; });
+	while (fired == 0 && start.elapsed() < 2*SECOND)
+	{
+		Poco::Thread::sleep(5);
+	}
+	assertEqual (1, fired.load());
+	assertTrue (start.elapsed() < 500*MS);
+
+	stop = true;
+	wakeUp.set();
+	thread.join();
+}
+
+
+void TimerWheelTest::testCallbackException()
+{
+	CountingErrorHandler eh;
+	Poco::ErrorHandler* pOldEH = Poco::ErrorHandler::set(&eh);
+
+	Clock base;
+	TimerWheel wheel;
+	int fired = 0;
+	wheel.schedule(base + 10*MS, []() { throw Poco::IOException("timer"); });
+	wheel.schedule(base + 10*MS, [&fired]() { ++fired; });
+	assertEqual (2, wheel.advance(base + 20*MS));
+	assertEqual (1, fired);
+	assertEqual (1, eh.count);
+
+	Poco::ErrorHandler::set(pOldEH);
+}
+
+
+void TimerWheelTest::setUp()
+{
+}
+
+
+void TimerWheelTest::tearDown()
+{
+}
+
+
+CppUnit::Test* TimerWheelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TimerWheelTest");
+
+	CppUnit_addTest(pSuite, TimerWheelTest, testSchedule);
+	CppUnit_addTest(pSuite, TimerWheelTest, testCancel);
+	CppUnit_addTest(pSuite, TimerWheelTest, testReschedule);
+	CppUnit_addTest(pSuite, TimerWheelTest, testCascade);
+	CppUnit_addTest(pSuite, TimerWheelTest, testManyTimers);
+	CppUnit_addTest(pSuite, TimerWheelTest, testNextTimeout);
+	CppUnit_addTest(pSuite, TimerWheelTest, testWakeUp);
+	CppUnit_addTest(pSuite, TimerWheelTest, testCallbackException);
+
+	return pSuite;
+}
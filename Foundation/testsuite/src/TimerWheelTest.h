@@ -0,0 +1,43 @@
+//
+// TimerWheelTest.h
+//
+// Definition of the TimerWheelTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef TimerWheelTest_INCLUDED
+#define TimerWheelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class TimerWheelTest: public CppUnit::TestCase
+{
+public:
+	TimerWheelTest(const std::string& name);
+	~TimerWheelTest();
+
+	void testSchedule();
+	void testCancel();
+	void testReschedule();
+	void testCascade();
+	void testManyTimers();
+	void testNextTimeout();
+	void testWakeUp();
+	void testCallbackException();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // TimerWheelTest_INCLUDED
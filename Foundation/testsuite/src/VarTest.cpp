@@ -3417,6 +3417,170 @@ void VarTest::testVarVisitor()
 }
 
 
+void VarTest::testMove()
+{
+	std::string str(100, 'x');
+	Var v1(std::move(str));
+	assertTrue (v1.isString());
+	assertTrue (v1.extract<std::string>() == std::string(100, 'x'));
+
+	Var v2(std::move(v1));
+	assertTrue (v1.isEmpty());
+	assertTrue (v2.extract<std::string>() == std::string(100, 'x'));
+
+	v1 = std::move(v2);
+	assertTrue (v2.isEmpty());
+	assertTrue (v1.size() == 100);
+	assertTrue (v1 == std::string(100, 'x'));
+
+	std::vector<Var> vec = {1, "two", 3.0};
+	v2 = std::move(vec);
+	assertTrue (v2.isVector());
+	assertTrue (v2.size() == 3);
+	assertTrue (v2[1] == "two");
+
+	Var v3(42);
+	v3.swap(v2);
+	assertTrue (v3.isVector());
+	assertTrue (v2 == 42);
+	assertTrue (v2.isInteger());
+
+	DynamicStruct ds;
+	ds["a"] = 1;
+	ds["b"] = "two";
+	Var v4(std::move(ds));
+	assertTrue (v4.isStruct());
+	assertTrue (v4["b"] == "two");
+	Var v5(std::move(v4));
+	assertTrue (v4.isEmpty());
+	assertTrue (v5["a"] == 1);
+
+	std::vector<Var> vars;
+	for (int i = 0; i < 100; ++i)
+	{
+		vars.emplace_back(Poco::NumberFormatter::format(i) + std::string(32, '.'));
+	}
+	for (int i = 0; i < 100; ++i)
+	{
+		assertTrue (vars[i].extract<std::string>() == Poco::NumberFormatter::format(i) + std::string(32, '.'));
+	}
+}
+
+
+void VarTest::testTake()
+{
+	Var v(std::string(64, 'y'));
+	std::string str = v.take<std::string>();
+	assertTrue (str == std::string(64, 'y'));
+	assertTrue (v.isEmpty());
+
+	v = std::vector<Var>{1, 2, 3};
+	std::vector<Var> vec = v.take<std::vector<Var>>();
+	assertTrue (vec.size() == 3);
+	assertTrue (v.isEmpty());
+
+	v = 42;
+	try
+	{
+		str = v.take<std::string>();
+		fail ("must throw");
+	}
+	catch (BadCastException&)
+	{
+	}
+	assertTrue (v == 42);
+
+	v.clear();
+	try
+	{
+		str = v.take<std::string>();
+		fail ("must throw");
+	}
+	catch (InvalidAccessException&)
+	{
+	}
+}
+
+
+void VarTest::testTaggedConversion()
+{
+	// tagged and untagged paths must agree
+	Var i8(Poco::Int8(-8));
+	Var u64(Poco::UInt64(1) << 40);
+	Var f(1.5f);
+	Var s("123");
+	Var b(true);
+
+	assertTrue (i8.convert<Poco::Int64>() == -8);
+	assertTrue (i8.convert<double>() == -8.0);
+	assertTrue (i8.isInteger() && i8.isSigned() && i8.isNumeric());
+	assertTrue (!i8.isString() && !i8.isBoolean());
+	try
+	{
+		i8.convert<Poco::UInt32>();
+		fail ("negative to unsigned - must throw");
+	}
+	catch (RangeException&)
+	{
+	}
+
+	assertTrue (u64.convert<Poco::Int64>() == (Poco::Int64(1) << 40));
+	assertTrue (!u64.isSigned());
+	try
+	{
+		u64.convert<Poco::Int32>();
+		fail ("out of range - must throw");
+	}
+	catch (RangeException&)
+	{
+	}
+
+	assertTrue (f.convert<double>() == 1.5);
+	assertTrue (!f.isInteger() && f.isNumeric());
+	assertTrue (s.convert<int>() == 123);
+	assertTrue (s.isString() && !s.isNumeric());
+	assertTrue (s.extract<std::string>() == "123");
+	assertTrue (b.convert<int>() == 1);
+	assertTrue (b.isBoolean());
+	assertTrue (b.convert<std::string>() == "true");
+
+	Var copy(u64);
+	assertTrue (copy.extract<Poco::UInt64>() == (Poco::UInt64(1) << 40));
+	copy = s;
+	assertTrue (copy.convert<Poco::Int64>() == 123);
+	copy = Poco::UUID();
+	assertTrue (!copy.isNumeric());
+	copy = 7;
+	assertTrue (copy + Var(1.5) == 8);
+	assertTrue (Var(1.5) + copy == 8.5);
+	++copy;
+	assertTrue (copy == 8);
+}
+
+
+void VarTest::testTaggedComparison()
+{
+	assertTrue (Var(Poco::Int8(5)) == Var(Poco::UInt64(5)));
+	assertTrue (Var(-1) != Var(Poco::UInt64(0xFFFFFFFFFFFFFFFFULL)));
+	assertTrue (Var(-1) == Var(Poco::Int64(-1)));
+	assertTrue (Var(0) != Var(1));
+	assertTrue (Var(true) == Var(true));
+	assertTrue (Var(true) != Var(false));
+	assertTrue (Var(true) != Var(1));
+	assertTrue (Var("abc") == Var(std::string("abc")));
+	assertTrue (Var("abc") != Var("abd"));
+	assertTrue (Var("42") == Var(42));
+	assertTrue (Var(42) == Var("42"));
+	assertTrue (Var("abc") < Var("abd"));
+	assertTrue (Var("abd") >= Var("abc"));
+	assertTrue (Var() != Var(0));
+	assertTrue (Var() == Var());
+
+	// integers are compared by their string representation
+	assertTrue (Var(10) < Var(9));
+}
+
+
 void VarTest::setUp()
 {
 }
@@ -3486,6 +3650,10 @@ CppUnit::Test* VarTest::suite()
 	CppUnit_addTest(pSuite, VarTest, testEmpty);
 	CppUnit_addTest(pSuite, VarTest, testIterator);
 	CppUnit_addTest(pSuite, VarTest, testVarVisitor);
+	CppUnit_addTest(pSuite, VarTest, testMove);
+	CppUnit_addTest(pSuite, VarTest, testTake);
+	CppUnit_addTest(pSuite, VarTest, testTaggedConversion);
+	CppUnit_addTest(pSuite, VarTest, testTaggedComparison);
 	CppUnit_addTest(pSuite, VarTest, testEnumType);
 
 	return pSuite;
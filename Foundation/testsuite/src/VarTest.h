@@ -82,6 +82,10 @@ public:
 	void testIterator();
 	void testSharedPtr();
 	void testVarVisitor();
+	void testMove();
+	void testTake();
+	void testTaggedConversion();
+	void testTaggedComparison();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,312 @@
+//
+// WorkStealingSchedulerTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "WorkStealingSchedulerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/WorkStealingScheduler.h"
+#include "Poco/WorkStealingDeque.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+using Poco::WorkStealingScheduler;
+using Poco::WorkStealingDeque;
+using Poco::Runnable;
+using Poco::Thread;
+
+
+namespace
+{
+	class CountRunnable: public Runnable
+	{
+	public:
+		CountRunnable(std::atomic<int>& count):
+			_count(count)
+		{
+		}
+
+		void run() override
+		{
+			++_count;
+		}
+
+	private:
+		std::atomic<int>& _count;
+	};
+
+	class SpawnRunnable: public Runnable
+		/// Recursively schedules two children until depth
+		/// reaches zero, counting all executed runnables.
+	{
+	public:
+		SpawnRunnable(WorkStealingScheduler& scheduler, std::atomic<int>& count, int depth):
+			_scheduler(scheduler),
+			_count(count),
+			_depth(depth)
+		{
+		}
+
+		void run() override
+		{
+			++_count;
+			if (_depth > 0)
+			{
+				_pLeft.reset(new SpawnRunnable(_scheduler, _count, _depth - 1));
+				_pRight.reset(new SpawnRunnable(_scheduler, _count, _depth - 1));
+				_scheduler.schedule(*_pLeft);
+				_scheduler.schedule(*_pRight);
+			}
+		}
+
+	private:
+		WorkStealingScheduler& _scheduler;
+		std::atomic<int>& _count;
+		int _depth;
+		std::unique_ptr<SpawnRunnable> _pLeft;
+		std::unique_ptr<SpawnRunnable> _pRight;
+	};
+
+	class Thief: public Runnable
+	{
+	public:
+		Thief(WorkStealingDeque<int>& deque, std::atomic<bool>& done):
+			_deque(deque),
+			_done(done)
+		{
+		}
+
+		void run() override
+		{
+			int item;
+			while (!_done || !_deque.empty())
+			{
+				if (_deque.steal(item)) items.push_back(item);
+			}
+		}
+
+		std::vector<int> items;
+
+	private:
+		WorkStealingDeque<int>& _deque;
+		std::atomic<bool>& _done;
+	};
+}
+
+
+WorkStealingSchedulerTest::WorkStealingSchedulerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+WorkStealingSchedulerTest::~WorkStealingSchedulerTest()
+{
+}
+
+
+void WorkStealingSchedulerTest::testDeque()
+{
+	WorkStealingDeque<int> deque(4);
+	assertTrue (deque.empty());
+	assertTrue (deque.capacity() == 4);
+
+	int item = 0;
+	assertTrue (!deque.pop(item));
+	assertTrue (!deque.steal(item));
+
+	deque.push(1);
+	deque.push(2);
+	deque.push(3);
+	assertTrue (deque.size() == 3);
+
+	assertTrue (deque.pop(item));
+	assertTrue (item == 3);
+	assertTrue (deque.steal(item));
+	assertTrue (item == 1);
+	assertTrue (deque.pop(item));
+	assertTrue (item == 2);
+	assertTrue (deque.empty());
+	assertTrue (!deque.pop(item));
+	assertTrue (!deque.steal(item));
+}
+
+
+void WorkStealingSchedulerTest::testDequeGrow()
+{
+	WorkStealingDeque<int> deque(2);
+	for (int i = 0; i < 100; ++i)
+	{
+		deque.push(i);
+	}
+	assertTrue (deque.size() == 100);
+	assertTrue (deque.capacity() == 128);
+
+	int item = 0;
+	for (int i = 0; i < 50; ++i)
+	{
+		assertTrue (deque.steal(item));
+		assertTrue (item == i);
+	}
+	for (int i = 99; i >= 50; --i)
+	{
+		assertTrue (deque.pop(item));
+		assertTrue (item == i);
+	}
+	assertTrue (deque.empty());
+}
+
+
+void WorkStealingSchedulerTest::testDequeSteal()
+{
+	const int ITEMS = 100000;
+	WorkStealingDeque<int> deque(16);
+	std::atomic<bool> done(false);
+	Thief thief1(deque, done);
+	Thief thief2(deque, done);
+	Thread thread1;
+	Thread thread2;
+	thread1.start(thief1);
+	thread2.start(thief2);
+
+	std::vector<int> popped;
+	int item;
+	for (int i = 0; i < ITEMS; ++i)
+	{
+		deque.push(i);
+		if (i % 3 == 0 && deque.pop(item)) popped.push_back(item);
+	}
+	while (deque.pop(item)) popped.push_back(item);
+	done = true;
+	thread1.join();
+	thread2.join();
+
+	std::vector<int> seen(ITEMS, 0);
+	for (auto i: popped) ++seen[i];
+	for (auto i: thief1.items) ++seen[i];
+	for (auto i: thief2.items) ++seen[i];
+	for (int i = 0; i < ITEMS; ++i)
+	{
+		assertTrue (seen[i] == 1);
+	}
+}
+
+
+void WorkStealingSchedulerTest::testSchedule()
+{
+	WorkStealingScheduler scheduler("WorkStealingSchedulerTest", 4);
+	assertTrue (scheduler.capacity() == 4);
+	assertTrue (scheduler.name() == "WorkStealingSchedulerTest");
+
+	std::atomic<int> count(0);
+	CountRunnable runnable(count);
+	for (int i = 0; i < 10000; ++i)
+	{
+		scheduler.schedule(runnable);
+	}
+	scheduler.joinAll();
+	assertTrue (count == 10000);
+	assertTrue (scheduler.pending() == 0);
+}
+
+
+void WorkStealingSchedulerTest::testNestedSchedule()
+{
+	WorkStealingScheduler scheduler(4);
+	std::atomic<int> count(0);
+	SpawnRunnable root(scheduler, count, 12);
+	scheduler.schedule(root);
+	scheduler.joinAll();
+	assertTrue (count == (1 << 13) - 1);
+}
+
+
+void WorkStealingSchedulerTest::testRestart()
+{
+	WorkStealingScheduler scheduler(2);
+	std::atomic<int> count(0);
+	CountRunnable runnable(count);
+
+	scheduler.joinAll();
+	for (int round = 1; round <= 3; ++round)
+	{
+		for (int i = 0; i < 100; ++i)
+		{
+			scheduler.schedule(runnable);
+		}
+		scheduler.joinAll();
+		assertTrue (count == round*100);
+	}
+
+	// workers park when idle and must pick up new work
+	scheduler.schedule(runnable);
+	Thread::sleep(100);
+	scheduler.schedule(runnable);
+	scheduler.joinAll();
+	assertTrue (count == 302);
+}
+
+
+void WorkStealingSchedulerTest::testScheduleDuringJoin()
+{
+	WorkStealingScheduler scheduler(2);
+	std::atomic<int> count(0);
+	CountRunnable runnable(count);
+	const int total = 20000;
+
+	std::atomic<bool> done(false);
+	Thread producer;
+	producer.startFunc([&]()
+	{
+		for (int i = 0; i < total; ++i)
+		{
+			scheduler.schedule(runnable);
+			if (i % 64 == 0) Thread::yield();
+		}
+		done = true;
+	});
+	// runnables scheduled while the workers are stopping must not get lost
+	while (!done)
+	{
+		scheduler.joinAll();
+	}
+	producer.join();
+	scheduler.joinAll();
+	assertTrue (count == total);
+	assertTrue (scheduler.pending() == 0);
+}
+
+
+void WorkStealingSchedulerTest::setUp()
+{
+}
+
+
+void WorkStealingSchedulerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* WorkStealingSchedulerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WorkStealingSchedulerTest");
+
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testDeque);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testDequeGrow);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testDequeSteal);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testSchedule);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testNestedSchedule);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testRestart);
+	CppUnit_addTest(pSuite, WorkStealingSchedulerTest, testScheduleDuringJoin);
+
+	return pSuite;
+}
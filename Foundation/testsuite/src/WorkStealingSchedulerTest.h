@@ -0,0 +1,44 @@
+//
+// WorkStealingSchedulerTest.h
+//
+// Definition of the WorkStealingSchedulerTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef WorkStealingSchedulerTest_INCLUDED
+#define WorkStealingSchedulerTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class WorkStealingSchedulerTest: public CppUnit::TestCase
+{
+public:
+	WorkStealingSchedulerTest(const std::string& name);
+	~WorkStealingSchedulerTest();
+
+	void testDeque();
+	void testDequeGrow();
+	void testDequeSteal();
+	void testSchedule();
+	void testNestedSchedule();
+	void testRestart();
+	void testScheduleDuringJoin();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // WorkStealingSchedulerTest_INCLUDED
@@ -226,6 +226,9 @@ public:
 	Object& set(const std::string& key, const Dynamic::Var& value);
 		/// Sets a new value.
 
+	Object& set(const std::string& key, Dynamic::Var&& value);
+		/// Sets a new value, moving it into the Object.
+
 	void stringify(std::ostream& out, unsigned int indent = 0, int step = -1) const;
 		/// Prints the object to out stream.
 		///
@@ -92,7 +92,7 @@ public:
 		/// A null value is read.
 
 private:
-	void setValue(const Poco::Dynamic::Var& value);
+	void setValue(Poco::Dynamic::Var&& value);
 	using Stack = std::stack<Dynamic::Var>;
 
 	Stack        _stack;
@@ -157,8 +157,7 @@ inline void ParseHandler::value(bool b)
 
 inline void ParseHandler::null()
 {
-	Poco::Dynamic::Var empty;
-	setValue(empty);
+	setValue(Poco::Dynamic::Var());
 }
 
 
@@ -208,8 +208,14 @@ const std::string& Object::getKey(KeyList::const_iterator& iter) const
 
 Object& Object::set(const std::string& key, const Dynamic::Var& value)
 {
-	std::pair<ValueMap::iterator, bool> ret = _values.insert(ValueMap::value_type(key, value));
-	if (!ret.second) ret.first->second = value;
+	return set(key, Dynamic::Var(value));
+}
+
+
+Object& Object::set(const std::string& key, Dynamic::Var&& value)
+{
+	std::pair<ValueMap::iterator, bool> ret = _values.try_emplace(key, std::move(value));
+	if (!ret.second) ret.first->second = std::move(value);
 	if (_preserveInsOrder)
 	{
 		auto it = _keys.begin();
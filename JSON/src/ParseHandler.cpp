@@ -49,7 +49,7 @@ void ParseHandler::startObject()
 	}
 	else
 	{
-		Var parent = _stack.top();
+		const Var& parent = _stack.top();
 
 		if (parent.type() == typeid(Array::Ptr))
 		{
@@ -84,7 +84,7 @@ void ParseHandler::startArray()
 	}
 	else
 	{
-		Var parent = _stack.top();
+		const Var& parent = _stack.top();
 
 		if (parent.type() == typeid(Array::Ptr))
 		{
@@ -115,21 +115,21 @@ void ParseHandler::key(const std::string& k)
 }
 
 
-void ParseHandler::setValue(const Var& value)
+void ParseHandler::setValue(Var&& value)
 {
 	if (!_stack.empty())
 	{
-		Var parent = _stack.top();
+		const Var& parent = _stack.top();
 
 		if (parent.type() == typeid(Array::Ptr))
 		{
 			Array::Ptr arr = parent.extract<Array::Ptr>();
-			arr->add(value);
+			arr->add(std::move(value));
 		}
 		else if (parent.type() == typeid(Object::Ptr))
 		{
 			Object::Ptr obj = parent.extract<Object::Ptr>();
-			obj->set(_key, value);
+			obj->set(_key, std::move(value));
 			_key.clear();
 		}
 	}
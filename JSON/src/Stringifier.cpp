@@ -15,6 +15,8 @@
 #include "Poco/JSON/Stringifier.h"
 #include "Poco/JSON/Array.h"
 #include "Poco/JSON/Object.h"
+#include "Poco/NumericString.h"
+#include <cmath>
 
 
 using Poco::Dynamic::Var;
@@ -23,6 +25,28 @@ using Poco::Dynamic::Var;
 namespace Poco::JSON {
 
 
+namespace
+{
+	template <typename T>
+	void formatNumber(T value, std::ostream& out)
+		/// Writes a number without a temporary string; non-finite
+		/// values, which JSON cannot represent, are written as null.
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			if (!std::isfinite(value))
+			{
+				out << "null";
+				return;
+			}
+		}
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		const auto res = Poco::toChars(buffer, buffer + sizeof(buffer), value);
+		out.write(buffer, res.ptr - buffer);
+	}
+}
+
+
 void Stringifier::stringify(const Var& any, std::ostream& out, unsigned int indent, int step, int options)
 {
 	bool escapeUnicode = ((options & Poco::JSON_ESCAPE_UNICODE) != 0);
@@ -62,7 +86,26 @@ void Stringifier::stringify(const Var& any, std::ostream& out, unsigned int inde
 	{
 		out << "null";
 	}
-	else if (any.isNumeric() || any.isBoolean())
+	else if (any.isBoolean())
+	{
+		out << (any.extract<bool>() ? "true" : "false");
+	}
+	else if (any.type() == typeid(double))
+	{
+		formatNumber(any.extract<double>(), out);
+	}
+	else if (any.type() == typeid(float))
+	{
+		formatNumber(any.extract<float>(), out);
+	}
+	else if (any.isInteger() && any.type() != typeid(char))
+	{
+		if (any.isSigned())
+			formatNumber(any.convert<Poco::Int64>(), out);
+		else
+			formatNumber(any.convert<Poco::UInt64>(), out);
+	}
+	else if (any.isNumeric())
 	{
 		auto value = any.convert<std::string>();
 		if ((Poco::icompare(value, "nan") == 0) ||
@@ -1619,9 +1619,30 @@ void JSONTest::testStringifyNaN()
 	Object::Ptr o = new Object;
 	o->set("NaN", NAN);
 	o->set("Infinity", INFINITY);
+	o->set("MinusInfinity", -INFINITY);
 	std::ostringstream stream;
 	o->stringify(stream, 0);
-	assertEqual (stream.str(), std::string(R"({"Infinity":null,"NaN":null})"));
+	assertEqual (stream.str(), std::string(R"({"Infinity":null,"MinusInfinity":null,"NaN":null})"));
+}
+
+
+void JSONTest::testStringifyNumbers()
+{
+	Poco::JSON::Array::Ptr a = new Poco::JSON::Array;
+	a->add(0);
+	a->add(std::numeric_limits<Poco::Int64>::min());
+	a->add(std::numeric_limits<Poco::UInt64>::max());
+	a->add(static_cast<Poco::Int8>(-5));
+	a->add(static_cast<Poco::UInt16>(65535));
+	a->add(1.5);
+	a->add(0.1f);
+	a->add(1e100);
+	a->add(true);
+	a->add(false);
+	a->add('c');
+	std::ostringstream stream;
+	a->stringify(stream, 0);
+	assertEqual (stream.str(), std::string(R"([0,-9223372036854775808,18446744073709551615,-5,65535,1.5,0.1,1e+100,true,false,"c"])"));
 }
 
 
@@ -2609,6 +2630,7 @@ CppUnit::Test* JSONTest::suite()
 	CppUnit_addTest(pSuite, JSONTest, testPrintHandler);
 	CppUnit_addTest(pSuite, JSONTest, testStringify);
 	CppUnit_addTest(pSuite, JSONTest, testStringifyNaN);
+	CppUnit_addTest(pSuite, JSONTest, testStringifyNumbers);
 	CppUnit_addTest(pSuite, JSONTest, testStringifyPreserveOrder);
 	CppUnit_addTest(pSuite, JSONTest, testVarConvert);
 	CppUnit_addTest(pSuite, JSONTest, testBasicJson);
@@ -68,6 +68,7 @@ public:
 	void testPrintHandler();
 	void testStringify();
 	void testStringifyNaN();
+	void testStringifyNumbers();
 	void testStringifyPreserveOrder();
 	void testVarConvert();
 
@@ -15,9 +15,9 @@
 #include "Poco/JWT/Serializer.h"
 #include "Poco/JWT/JWTException.h"
 #include "Poco/JSON/Parser.h"
+#include "Poco/Base64.h"
 #include "Poco/Base64Encoder.h"
 #include "Poco/Base64Decoder.h"
-#include "Poco/MemoryStream.h"
 #include "Poco/StringTokenizer.h"
 #include <sstream>
 
@@ -28,8 +28,8 @@ namespace Poco::JWT {
 std::string Serializer::serialize(const Poco::JSON::Object& object)
 {
 	std::ostringstream stream;
-	serialize(object, stream);
-	return stream.str();
+	object.stringify(stream);
+	return Poco::Base64::encode(stream.str(), Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING);
 }
 
 
@@ -43,8 +43,21 @@ void Serializer::serialize(const Poco::JSON::Object& object, std::ostream& strea
 
 Poco::JSON::Object::Ptr Serializer::deserialize(const std::string& serialized)
 {
-	Poco::MemoryInputStream stream(serialized.data(), serialized.size());
-	return deserialize(stream);
+	Poco::JSON::Parser parser;
+	try
+	{
+		Poco::Dynamic::Var json = parser.parse(Poco::Base64::decode(serialized, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING));
+		Poco::JSON::Object::Ptr pObject = json.extract<Poco::JSON::Object::Ptr>();
+		return pObject;
+	}
+	catch (Poco::BadCastException&)
+	{
+		throw ParseException("String does not deserialize to a JSON object");
+	}
+	catch (Poco::Exception& exc)
+	{
+		throw ParseException("Failed to deserialize JWT component", exc.displayText());
+	}
 }
 
 
@@ -20,8 +20,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/DynamicFactory.h"
 #include "Poco/MemoryStream.h"
-#include "Poco/Base64Encoder.h"
-#include "Poco/Base64Decoder.h"
+#include "Poco/Base64.h"
 #include "Poco/Crypto/DigestEngine.h"
 #include "Poco/Crypto/RSADigestEngine.h"
 #include "Poco/Crypto/ECDSADigestEngine.h"
@@ -487,27 +486,22 @@ bool Signer::tryVerify(const std::string& jwt, Token& token) const
 
 std::string Signer::encode(const Poco::DigestEngine::Digest& digest)
 {
-	std::ostringstream stream;
-	Poco::Base64Encoder encoder(stream, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING);
-	encoder.write(reinterpret_cast<const char*>(&digest[0]), digest.size());
-	encoder.close();
-	return stream.str();
+	return Poco::Base64::encode(std::string(digest.begin(), digest.end()), Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING);
 }
 
 
 Poco::DigestEngine::Digest Signer::decode(const std::string& signature)
 {
-	Poco::DigestEngine::Digest digest;
-	digest.reserve(64);
-	Poco::MemoryInputStream stream(signature.data(), signature.size());
-	Poco::Base64Decoder decoder(stream, Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING);
-	int ch = decoder.get();
-	while (ch != -1)
+	Poco::DigestEngine::Digest digest(Poco::Base64::decodedLength(signature.size()));
+	try
 	{
-		digest.push_back(static_cast<unsigned char>(static_cast<unsigned>(ch)));
-		ch = decoder.get();
+		digest.resize(Poco::Base64::decode(signature.data(), signature.size(), digest.data(), Poco::BASE64_URL_ENCODING | Poco::BASE64_NO_PADDING));
+	}
+	catch (Poco::DataFormatException&)
+	{
+		// A malformed signature simply fails verification.
+		digest.clear();
 	}
-
 	return digest;
 }
 
@@ -0,0 +1,261 @@
+//
+// AsyncWebSocket.h
+//
+// Library: Net
+// Package: WebSocket
+// Module:  AsyncWebSocket
+//
+// Definition of the AsyncWebSocket class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_AsyncWebSocket_INCLUDED
+#define Net_AsyncWebSocket_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/NObserver.h"
+#include "Poco/Random.h"
+#include "Poco/Mutex.h"
+#include <deque>
+#include <functional>
+#include <string>
+
+
+namespace Poco::Net {
+
+
+class StreamSocketImpl;
+class PerMessageDeflate;
+
+
+class Net_API AsyncWebSocket: public Poco::RefCountedObject
+	/// AsyncWebSocket drives a WebSocket from a SocketReactor, so that
+	/// a single thread can serve a large number of WebSocket connections.
+	///
+	/// The WebSocket is handed over to the AsyncWebSocket after the
+	/// opening handshake, and must not be used directly afterwards.
+	/// The socket is put into non-blocking mode.
+	///
+	/// Whenever the socket becomes readable, all available data is
+	/// read at once, and every complete message is passed to the
+	/// message callback, in the reactor thread. Fragmented messages
+	/// are reassembled, and compressed messages are decompressed if the
+	/// "permessage-deflate" extension has been negotiated for the WebSocket.
+	/// Control frames are passed to the message callback as well.
+	/// PING frames are answered with a PONG frame automatically.
+	///
+	/// sendFrame() can be called from any thread. A frame is sent
+	/// immediately if the socket accepts it. Otherwise, it is queued
+	/// and sent from the reactor thread as soon as the socket becomes
+	/// writable, together with all other frames queued in the meantime,
+	/// using a single writev() call.
+	///
+	/// The close callback is invoked exactly once, in the reactor thread,
+	/// when the connection has been closed, either by the peer, due to
+	/// an error, or with close().
+	///
+	/// The SocketReactor holds a reference to the AsyncWebSocket from
+	/// start() until the connection has been closed.
+	///
+	/// Example:
+	///     AsyncWebSocket::Ptr pWS = new AsyncWebSocket(ws, reactor);
+	///     pWS->setMessageCallback(
+	///         [](AsyncWebSocket& ws, const char* data, std::size_t length, int flags)
+	///         {
+	///             if ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_TEXT)
+	///                 ws.sendFrame(data, static_cast<int>(length));
+	///         });
+	///     pWS->start();
+{
+public:
+	using Ptr = Poco::AutoPtr<AsyncWebSocket>;
+
+	using MessageCallback = std::function<void(AsyncWebSocket& webSocket, const char* data, std::size_t length, int flags)>;
+		/// Called for every message or control frame received.
+		/// The flags contain the FIN bit and the opcode of the
+		/// message (see WebSocket::FrameFlags and WebSocket::FrameOpcodes).
+		/// The data is only valid during the call.
+
+	using CloseCallback = std::function<void(AsyncWebSocket& webSocket, int statusCode, const std::string& reason)>;
+		/// Called when the connection has been closed, with the
+		/// status code and reason from the CLOSE frame, or with
+		/// WebSocket::WS_RESERVED_ABNORMAL_CLOSE if the connection
+		/// was closed without a close handshake.
+
+	AsyncWebSocket(const WebSocket& webSocket, SocketReactor& reactor);
+		/// Creates the AsyncWebSocket for the given WebSocket,
+		/// which will be served by the given SocketReactor.
+
+	void setMessageCallback(const MessageCallback& callback);
+		/// Sets the callback for received messages.
+		///
+		/// Must be called before start().
+
+	void setCloseCallback(const CloseCallback& callback);
+		/// Sets the callback invoked when the connection has been closed.
+		///
+		/// Must be called before start().
+
+	void start();
+		/// Registers the AsyncWebSocket with the SocketReactor.
+		///
+		/// Data that has already been received together with the
+		/// opening handshake is processed by start(), so the message
+		/// callback may be invoked before start() returns.
+
+	bool sendFrame(const void* buffer, int length, int flags = WebSocket::FRAME_TEXT);
+		/// Sends the contents of the given buffer as a single frame,
+		/// or queues it if the socket does not accept it immediately.
+		///
+		/// If "permessage-deflate" has been negotiated, complete text and
+		/// binary frames are compressed.
+		///
+		/// Returns false if the frame could not be sent or queued,
+		/// because the connection is closing or has been closed.
+
+	bool sendFrame(const std::string& message, int flags = WebSocket::FRAME_TEXT);
+		/// Sends the given message as a single frame.
+		///
+		/// See sendFrame(const void*, int, int) for more information.
+
+	bool shutdown(Poco::UInt16 statusCode = WebSocket::WS_NORMAL_CLOSE, const std::string& statusMessage = std::string());
+		/// Starts the close handshake by sending a CLOSE frame.
+		///
+		/// The connection is closed when the peer has answered the
+		/// CLOSE frame. No more frames can be sent after calling
+		/// shutdown().
+		///
+		/// Returns false if the close handshake has already been started.
+
+	void close();
+		/// Closes the connection without a close handshake.
+		///
+		/// If called outside of the reactor thread, the connection
+		/// is closed asynchronously by the reactor thread.
+
+	bool isOpen() const;
+		/// Returns true if the connection has not been closed.
+
+	std::size_t pendingBytes() const;
+		/// Returns the number of bytes queued for sending.
+		///
+		/// Can be used to detect slow peers.
+
+	void setMaxPayloadSize(int maxPayloadSize);
+		/// Sets the maximum size of a received message, after
+		/// reassembly and decompression. Larger messages cause
+		/// the connection to be closed with status code
+		/// WebSocket::WS_PAYLOAD_TOO_BIG.
+		///
+		/// The default is the WebSocket's maximum payload size.
+		/// Must be called before start().
+
+	int getMaxPayloadSize() const;
+		/// Returns the maximum size of a received message.
+
+	const WebSocket& socket() const;
+		/// Returns the WebSocket.
+
+protected:
+	~AsyncWebSocket() override;
+
+	void onReadable(const Poco::AutoPtr<ReadableNotification>& pNf);
+	void onWritable(const Poco::AutoPtr<WritableNotification>& pNf);
+	void onError(const Poco::AutoPtr<ErrorNotification>& pNf);
+	void onShutdown(const Poco::AutoPtr<ShutdownNotification>& pNf);
+
+private:
+	enum
+	{
+		RECEIVE_BUFFER_SIZE = 16384,
+		MAX_IDLE_BUFFER_SIZE = 65536,
+		MAX_IOVECS = 64,
+		MAX_HEADER_LENGTH = 14,
+		MAX_CONTROL_PAYLOAD_LENGTH = 125
+	};
+
+	bool processInput();
+	bool handleFrame(int flags, const char* payload, std::size_t length);
+	bool deliver(const char* data, std::size_t length, int flags);
+	void fail(int statusCode, const std::string& reason);
+	bool queueFrame(const char* payload, std::size_t length, int flags);
+	void encodeFrame(const char* payload, std::size_t length, int flags, std::string& frame);
+	bool flushOutput();
+	void abort(int statusCode, const std::string& reason);
+	void closeAfterFlush();
+	void closeImpl();
+
+	AsyncWebSocket() = delete;
+	AsyncWebSocket(const AsyncWebSocket&) = delete;
+	AsyncWebSocket& operator = (const AsyncWebSocket&) = delete;
+
+	WebSocket _webSocket;
+	StreamSocketImpl* _pSocketImpl;
+	PerMessageDeflate* _pDeflate;
+	SocketReactor& _reactor;
+	bool _mustMaskPayload;
+	bool _secure;
+	int _maxPayloadSize;
+	MessageCallback _messageCallback;
+	CloseCallback _closeCallback;
+	Poco::NObserver<AsyncWebSocket, ReadableNotification> _readableObserver;
+	Poco::NObserver<AsyncWebSocket, WritableNotification> _writableObserver;
+	Poco::NObserver<AsyncWebSocket, ErrorNotification> _errorObserver;
+	Poco::NObserver<AsyncWebSocket, ShutdownNotification> _shutdownObserver;
+
+	// reactor thread only
+	std::string _input;
+	std::size_t _inputOffset;
+	std::string _message;
+	int _messageFlags;
+	bool _messageCompressed;
+	std::string _inflated;
+	bool _started;
+
+	// guarded by _mutex
+	std::deque<std::string> _output;
+	std::size_t _outputOffset;
+	std::string _sendBuffer;
+	std::size_t _pendingBytes;
+	bool _writableRegistered;
+	bool _open;
+	bool _closeSent;
+	bool _closing;
+	int _closeStatus;
+	std::string _closeReason;
+	std::string _compressed;
+	Poco::Random _rnd;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline const WebSocket& AsyncWebSocket::socket() const
+{
+	return _webSocket;
+}
+
+
+inline int AsyncWebSocket::getMaxPayloadSize() const
+{
+	return _maxPayloadSize;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_AsyncWebSocket_INCLUDED
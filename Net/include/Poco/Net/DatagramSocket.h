@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/Socket.h"
 #include "Poco/Buffer.h"
+#include <vector>
 
 
 namespace Poco::Net {
@@ -269,6 +270,94 @@ public:
 		/// The flags parameter can be used to pass system-defined flags
 		/// for recvfrom() like MSG_PEEK.
 
+	int sendBatch(const SocketBufVec& buffers, const std::vector<SocketAddress>& addresses, int flags = 0);
+		/// Sends each buffer as a separate datagram, to the
+		/// address with the same index in addresses. If addresses
+		/// is empty, the socket must be connected and all datagrams
+		/// are sent to the connected peer.
+		///
+		/// On Linux, all datagrams are sent with a single sendmmsg()
+		/// call; on other platforms, one datagram is sent at a time.
+		///
+		/// Returns the number of datagrams sent, which may be less
+		/// than the number of buffers, or -1 if the socket is
+		/// non-blocking and no datagram could be sent.
+		///
+		/// Throws an InvalidArgumentException if addresses is neither
+		/// empty nor of the same size as buffers.
+
+	int receiveBatch(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, int flags = 0);
+		/// Receives up to buffers.size() datagrams, each into the
+		/// buffer with the same index. The sender addresses and the
+		/// lengths of the received datagrams are stored in addresses
+		/// and lengths, which are resized accordingly.
+		///
+		/// On Linux, the datagrams are received with a single recvmmsg()
+		/// call, which waits for the first datagram only and then
+		/// returns all datagrams already queued (up to the number of
+		/// buffers). On other platforms, a single datagram is received.
+		///
+		/// Returns the number of datagrams received, or -1 if the
+		/// socket is non-blocking and no datagram is available.
+
+	int receiveBatch(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, std::vector<int>& segmentSizes, int flags = 0);
+		/// Receives up to buffers.size() datagrams, like the above
+		/// function, and also stores the GRO segment size for each
+		/// received buffer in segmentSizes.
+		///
+		/// If receive offload is enabled (see setReceiveOffload()),
+		/// a buffer may contain several datagrams from the same sender,
+		/// each segmentSize bytes long except the last one, which may
+		/// be shorter. A segment size of 0 means that the buffer
+		/// contains a single datagram.
+
+	int receiveBatch(SocketBufVec& buffers, int* pLengths, struct sockaddr** ppSA, poco_socklen_t** ppSALen, int flags = 0);
+		/// Receives up to buffers.size() datagrams, storing the
+		/// native sender addresses. ppSA and ppSALen must point to
+		/// arrays of buffers.size() pointers to the address storage
+		/// and its length, and pLengths to an array of buffers.size()
+		/// ints receiving the datagram lengths.
+		///
+		/// Returns the number of datagrams received, or -1 if the
+		/// socket is non-blocking and no datagram is available.
+
+	void setSegmentSize(int size);
+		/// Sets the value of the UDP_SEGMENT socket option (generic
+		/// segmentation offload).
+		///
+		/// If set to a non-zero value, a buffer passed to sendBytes(),
+		/// sendTo() or sendBatch() that is larger than size is split
+		/// into several datagrams of the given size by the kernel or
+		/// the network interface, which is considerably cheaper than
+		/// sending the datagrams one by one.
+		///
+		/// Only supported on Linux; throws a NotImplementedException
+		/// on other platforms.
+
+	int getSegmentSize();
+		/// Returns the value of the UDP_SEGMENT socket option.
+		///
+		/// Only supported on Linux; throws a NotImplementedException
+		/// on other platforms.
+
+	void setReceiveOffload(bool flag);
+		/// Sets the value of the UDP_GRO socket option (generic
+		/// receive offload).
+		///
+		/// If enabled, consecutive datagrams of the same size from
+		/// the same sender may be delivered in a single buffer.
+		/// Use the receiveBatch() overload taking segmentSizes to
+		/// split them up again.
+		///
+		/// Only supported on Linux; throws a NotImplementedException
+		/// on other platforms.
+
+	bool getReceiveOffload();
+		/// Returns the value of the UDP_GRO socket option.
+		///
+		/// Only supported on Linux; throws a NotImplementedException
+		/// on other platforms.
+
 	void setBroadcast(bool flag);
 		/// Sets the value of the SO_BROADCAST socket option.
 		///
@@ -285,6 +374,9 @@ protected:
 		///
 		/// The SocketImpl must be a DatagramSocketImpl, otherwise
 		/// an InvalidArgumentException will be thrown.
+
+private:
+	int receiveBatchImpl(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, int* pSegmentSizes, int flags);
 };
 
 
@@ -0,0 +1,257 @@
+//
+// HPACK.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HPACK
+//
+// Definition of the HPACKTable, HPACKDecoder and HPACKEncoder classes.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HPACK_INCLUDED
+#define Net_HPACK_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class Net_API HPACKTable
+	/// The HPACK indexing table (RFC 7541, Section 2.3), consisting
+	/// of the static table and a dynamic table with a maximum size.
+	///
+	/// Index 1 refers to the first entry of the static table,
+	/// index 62 to the most recently added entry of the dynamic table.
+{
+public:
+	using Header = std::pair<std::string, std::string>;
+	using HeaderList = std::vector<Header>;
+
+	enum
+	{
+		STATIC_TABLE_SIZE = 61,
+		ENTRY_OVERHEAD    = 32
+	};
+
+	explicit HPACKTable(std::size_t maxSize = 4096);
+		/// Creates the HPACKTable with the given maximum
+		/// size of the dynamic table.
+
+	~HPACKTable();
+		/// Destroys the HPACKTable.
+
+	bool get(std::size_t index, std::string& name, std::string& value) const;
+		/// Looks up the entry with the given index.
+		/// Returns false if there is no such entry.
+
+	void add(const std::string& name, const std::string& value);
+		/// Adds an entry to the dynamic table, evicting the
+		/// oldest entries as necessary. An entry larger than
+		/// the maximum size empties the dynamic table.
+
+	std::size_t find(const std::string& name, const std::string& value, bool& valueMatch) const;
+		/// Searches the static and dynamic table for an entry with
+		/// the given name, preferring entries that also match the value.
+		/// Returns the index, or 0 if the name was not found.
+		/// valueMatch is set to true if the value matches as well.
+
+	void setMaxSize(std::size_t maxSize);
+		/// Sets the maximum size of the dynamic table,
+		/// evicting entries as necessary.
+
+	std::size_t getMaxSize() const;
+		/// Returns the maximum size of the dynamic table.
+
+	std::size_t size() const;
+		/// Returns the current size of the dynamic table,
+		/// as defined in RFC 7541, Section 4.1.
+
+	std::size_t entries() const;
+		/// Returns the number of entries in the dynamic table.
+
+private:
+	void evict(std::size_t maxSize);
+
+	std::deque<Header> _entries;
+	std::size_t _size;
+	std::size_t _maxSize;
+};
+
+
+class Net_API HPACKDecoder
+	/// Decodes HPACK header blocks (RFC 7541).
+	///
+	/// Header blocks must be decoded in the order in which they
+	/// have been received on the connection, as decoding updates
+	/// the decoder's dynamic table.
+{
+public:
+	using HeaderList = HPACKTable::HeaderList;
+
+	explicit HPACKDecoder(std::size_t maxTableSize = 4096);
+		/// Creates the HPACKDecoder. The given maximum table size
+		/// is the value announced in SETTINGS_HEADER_TABLE_SIZE;
+		/// the encoder may not exceed it.
+
+	~HPACKDecoder();
+		/// Destroys the HPACKDecoder.
+
+	void decode(const char* pBlock, std::size_t length, HeaderList& headers);
+		/// Decodes the given header block and appends the
+		/// header fields to headers.
+		///
+		/// Throws a HTTP2Exception with code H2_ERR_COMPRESSION
+		/// if the header block is malformed. Throws a HTTP2Exception
+		/// with code H2_ERR_ENHANCE_YOUR_CALM if the decoded header
+		/// list exceeds the maximum header list size. Fields beyond
+		/// the limit are not added to headers, but the rest of the
+		/// block is still decoded, so the dynamic table remains usable.
+
+	void setMaxHeaderListSize(std::size_t size);
+		/// Sets the maximum size of a decoded header list,
+		/// as defined for SETTINGS_MAX_HEADER_LIST_SIZE.
+
+	std::size_t getMaxHeaderListSize() const;
+		/// Returns the maximum size of a decoded header list.
+
+	const HPACKTable& table() const;
+		/// Returns the decoder's indexing table.
+
+private:
+	std::size_t _maxTableSize;
+	std::size_t _maxHeaderListSize;
+	HPACKTable _table;
+};
+
+
+class Net_API HPACKEncoder
+	/// Encodes header lists into HPACK header blocks (RFC 7541).
+	///
+	/// Header fields found in the static or dynamic table are sent
+	/// as indexed fields. All other fields are added to the dynamic
+	/// table, unless they are marked as sensitive or are too large.
+	/// String literals are Huffman-coded whenever that makes
+	/// them shorter.
+	///
+	/// Header blocks must be sent in the order in which they have
+	/// been encoded, as encoding updates the encoder's dynamic table.
+{
+public:
+	using HeaderList = HPACKTable::HeaderList;
+
+	explicit HPACKEncoder(std::size_t maxTableSize = 4096);
+		/// Creates the HPACKEncoder with the given maximum table size.
+
+	~HPACKEncoder();
+		/// Destroys the HPACKEncoder.
+
+	void encode(const HeaderList& headers, std::string& block);
+		/// Encodes the given header list and appends the
+		/// resulting header block to block.
+
+	void encode(const std::string& name, const std::string& value, std::string& block, bool sensitive = false);
+		/// Encodes a single header field and appends it to block.
+		/// Sensitive fields are encoded as never-indexed literals.
+		///
+		/// A header block must contain either a single call to
+		/// encode(const HeaderList&, std::string&), or any number of
+		/// calls to this function, after a call to beginBlock().
+
+	void beginBlock(std::string& block);
+		/// Begins a new header block, appending a pending dynamic
+		/// table size update, if any, to block.
+
+	void setMaxTableSize(std::size_t maxTableSize);
+		/// Sets the maximum size of the dynamic table, which must not
+		/// exceed the decoder's SETTINGS_HEADER_TABLE_SIZE. The change is
+		/// signalled to the decoder at the beginning of the next header block.
+
+	void setHuffmanEncoding(bool enable);
+		/// Enables or disables Huffman coding of string literals.
+		/// Huffman coding is enabled by default.
+
+	const HPACKTable& table() const;
+		/// Returns the encoder's indexing table.
+
+	static void encodeInteger(std::string& out, UInt8 prefix, int prefixBits, std::size_t value);
+		/// Appends an integer with a prefixBits-bit prefix to out,
+		/// as described in RFC 7541, Section 5.1. prefix contains
+		/// the bits preceding the integer in the first byte.
+
+	static void encodeHuffman(std::string& out, const std::string& str);
+		/// Appends the Huffman code for str to out.
+
+	static std::size_t huffmanLength(const std::string& str);
+		/// Returns the length of the Huffman code for str, in bytes.
+
+private:
+	void encodeString(std::string& out, const std::string& str);
+
+	HPACKTable _table;
+	bool _huffman;
+	bool _tableSizeUpdate;
+	std::size_t _minTableSize;
+};
+
+
+//
+// inlines
+//
+inline std::size_t HPACKTable::getMaxSize() const
+{
+	return _maxSize;
+}
+
+
+inline std::size_t HPACKTable::size() const
+{
+	return _size;
+}
+
+
+inline std::size_t HPACKTable::entries() const
+{
+	return _entries.size();
+}
+
+
+inline std::size_t HPACKDecoder::getMaxHeaderListSize() const
+{
+	return _maxHeaderListSize;
+}
+
+
+inline const HPACKTable& HPACKDecoder::table() const
+{
+	return _table;
+}
+
+
+inline void HPACKEncoder::setHuffmanEncoding(bool enable)
+{
+	_huffman = enable;
+}
+
+
+inline const HPACKTable& HPACKEncoder::table() const
+{
+	return _table;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HPACK_INCLUDED
@@ -0,0 +1,245 @@
+//
+// HTTP2ClientSession.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ClientSession
+//
+// Definition of the HTTP2ClientSession class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ClientSession_INCLUDED
+#define Net_HTTP2ClientSession_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Buffer.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Thread.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include <atomic>
+#include <map>
+
+
+namespace Poco::Net {
+
+
+class HTTPRequest;
+class HTTPResponse;
+
+
+class Net_API HTTP2ClientSession: public Poco::RefCountedObject
+	/// This class implements the client side of an HTTP/2
+	/// connection (RFC 9113).
+	///
+	/// A HTTP2ClientSession can be shared by any number of threads.
+	/// Every call to sendRequest() opens a new stream on the
+	/// connection, so concurrent requests are multiplexed over a
+	/// single connection, up to the limit for concurrent streams
+	/// announced by the server. Request and response bodies are
+	/// buffered in memory.
+	///
+	/// Frames sent by the server are read by a separate thread,
+	/// which is started by the constructor and terminated by close().
+	///
+	/// Normally, HTTP2ClientSession objects are created and
+	/// managed by a HTTPClientPool.
+{
+public:
+	using Ptr = Poco::AutoPtr<HTTP2ClientSession>;
+
+	enum
+	{
+		DEFAULT_INITIAL_WINDOW_SIZE = 1048576
+	};
+
+	HTTP2ClientSession(const StreamSocket& socket, const std::string& host, Poco::UInt16 port);
+		/// Creates the HTTP2ClientSession for the given socket, which
+		/// must be connected to the given host and port. For a secure
+		/// socket, "h2" must have been negotiated via ALPN.
+		///
+		/// Sends the connection preface and starts the thread
+		/// reading frames from the server.
+
+	void sendRequest(HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody);
+		/// Sends the given request, with the given body, on a new stream
+		/// and waits for the response. The response header is stored in
+		/// response, the response body in responseBody.
+		///
+		/// The :authority pseudo-header is taken from the request's
+		/// Host header, if present, or from host and port given
+		/// to the constructor. Connection-specific header fields
+		/// are not sent.
+		///
+		/// If the server has already reached its limit for concurrent
+		/// streams, waits until another stream completes.
+		///
+		/// Throws a HTTP2Exception with code H2_ERR_REFUSED_STREAM if the
+		/// server has not processed the request because it refused the
+		/// stream or is shutting down the connection; such requests can
+		/// safely be retried on another connection. Throws a HTTP2Exception
+		/// with the respective error code if the server resets the stream,
+		/// a TimeoutException if no response is received within the
+		/// timeout, or a NetException if the connection is lost.
+
+	bool canSendRequest() const;
+		/// Returns true if the connection is open, the server has
+		/// not announced to shut it down, and new streams can be
+		/// opened without waiting.
+
+	bool isOpen() const;
+		/// Returns true if the connection is open and the server
+		/// has not announced to shut it down.
+
+	int activeStreams() const;
+		/// Returns the number of open streams.
+
+	int maxConcurrentStreams() const;
+		/// Returns the maximum number of concurrent streams
+		/// announced by the server.
+
+	Poco::Timestamp lastUsed() const;
+		/// Returns the time at which the last stream completed,
+		/// or the time the session has been created if no
+		/// stream has been opened yet.
+
+	void setTimeout(const Poco::Timespan& timeout);
+		/// Sets the timeout for receiving a response,
+		/// and for waiting for flow-control window.
+
+	Poco::Timespan getTimeout() const;
+		/// Returns the timeout.
+
+	bool secure() const;
+		/// Returns true if the connection is secure.
+
+	const std::string& host() const;
+		/// Returns the host name of the server.
+
+	Poco::UInt16 port() const;
+		/// Returns the port number of the server.
+
+	void close();
+		/// Sends a GOAWAY frame to the server, closes the connection
+		/// and waits for the reading thread to terminate. Pending
+		/// requests fail with a NetException.
+
+protected:
+	~HTTP2ClientSession();
+		/// Destroys the HTTP2ClientSession, closing the
+		/// connection if it is still open.
+
+private:
+	struct Stream;
+	using StreamMap = std::map<UInt32, Stream*>;
+
+	void run();
+	bool receive(char* pBuffer, std::size_t length, bool frameStart);
+	bool readFrame(HTTP2Frame& frame);
+	void handleFrame(const HTTP2Frame& frame);
+	void handleData(const HTTP2Frame& frame);
+	void handleHeaders(const HTTP2Frame& frame);
+	void handleContinuation(const HTTP2Frame& frame);
+	void handleRstStream(const HTTP2Frame& frame);
+	void handleSettings(const HTTP2Frame& frame);
+	void handlePing(const HTTP2Frame& frame);
+	void handleGoAway(const HTTP2Frame& frame);
+	void handleWindowUpdate(const HTTP2Frame& frame);
+	void headerBlockComplete(UInt32 streamId, bool endStream);
+	void consumeReceiveWindow(UInt32 streamId, UInt32 length);
+	void checkOpen() const;
+	void openStream(Stream& stream, const HTTPRequest& request, std::size_t contentLength);
+	void closeStream(Stream& stream);
+	void waitForResponse(Stream& stream);
+	void shutdown(const std::string& error);
+
+	void writeFrame(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length);
+	void writeFrameImpl(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length);
+	void sendPreface();
+	void sendWindowUpdate(UInt32 streamId, UInt32 increment);
+	void sendRstStream(UInt32 streamId, HTTP2Frame::ErrorCode error);
+	void sendGoAway(HTTP2Frame::ErrorCode error);
+	void sendHeaders(Stream& stream, const HTTPRequest& request, std::size_t contentLength);
+	void sendData(Stream& stream, const char* pData, std::size_t length);
+	std::size_t acquireSendWindow(Stream& stream, std::size_t length);
+
+	HTTP2ClientSession(const HTTP2ClientSession&) = delete;
+	HTTP2ClientSession& operator = (const HTTP2ClientSession&) = delete;
+
+	StreamSocket _socket;
+	std::string _host;
+	Poco::UInt16 _port;
+	std::string _authority;
+	std::atomic<Poco::Timespan::TimeDiff> _timeout;
+	Poco::Thread _thread;
+
+	Poco::Buffer<char> _readBuffer;
+	std::size_t _readPos;
+	std::size_t _readEnd;
+	Poco::Buffer<char> _payload;
+	HPACKDecoder _decoder;
+	std::string _headerBlock;
+	UInt32 _continuationStreamId;
+	bool _continuationEndStream;
+	Int64 _recvWindow;
+	UInt32 _recvConsumed;
+
+	mutable Poco::FastMutex _mutex;
+	Poco::Condition _condition;
+	StreamMap _streams;
+	int _openStreams;
+	Int64 _sendWindow;
+	Int64 _peerInitialWindowSize;
+	UInt32 _peerMaxConcurrentStreams;
+	std::atomic<UInt32> _peerMaxFrameSize;
+	std::atomic<bool> _closed;
+	bool _goAwayReceived;
+	std::string _error;
+	Poco::Timestamp _lastUsed;
+
+	Poco::FastMutex _writeMutex;
+	HPACKEncoder _encoder;
+	Poco::Buffer<char> _writeBuffer;
+	std::atomic<UInt32> _nextStreamId;
+	bool _goAwaySent;
+};
+
+
+//
+// inlines
+//
+inline const std::string& HTTP2ClientSession::host() const
+{
+	return _host;
+}
+
+
+inline Poco::UInt16 HTTP2ClientSession::port() const
+{
+	return _port;
+}
+
+
+inline bool HTTP2ClientSession::secure() const
+{
+	return _socket.secure();
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTP2ClientSession_INCLUDED
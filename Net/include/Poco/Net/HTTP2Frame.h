@@ -0,0 +1,191 @@
+//
+// HTTP2Frame.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Frame
+//
+// Definition of the HTTP2Frame class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2Frame_INCLUDED
+#define Net_HTTP2Frame_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <string>
+
+
+namespace Poco::Net {
+
+
+class Net_API HTTP2Frame
+	/// This class represents the header of an HTTP/2 frame
+	/// (RFC 9113, Section 4.1) and defines the frame types,
+	/// flags, settings and error codes used by HTTP/2.
+{
+public:
+	enum FrameType
+	{
+		FRAME_TYPE_DATA          = 0x0,
+		FRAME_TYPE_HEADERS       = 0x1,
+		FRAME_TYPE_PRIORITY      = 0x2,
+		FRAME_TYPE_RST_STREAM    = 0x3,
+		FRAME_TYPE_SETTINGS      = 0x4,
+		FRAME_TYPE_PUSH_PROMISE  = 0x5,
+		FRAME_TYPE_PING          = 0x6,
+		FRAME_TYPE_GOAWAY        = 0x7,
+		FRAME_TYPE_WINDOW_UPDATE = 0x8,
+		FRAME_TYPE_CONTINUATION  = 0x9
+	};
+
+	enum FrameFlags
+	{
+		FRAME_FLAG_END_STREAM  = 0x01,
+		FRAME_FLAG_ACK         = 0x01,
+		FRAME_FLAG_END_HEADERS = 0x04,
+		FRAME_FLAG_PADDED      = 0x08,
+		FRAME_FLAG_PRIORITY    = 0x20
+	};
+
+	enum Setting
+	{
+		SETTING_HEADER_TABLE_SIZE      = 0x1,
+		SETTING_ENABLE_PUSH            = 0x2,
+		SETTING_MAX_CONCURRENT_STREAMS = 0x3,
+		SETTING_INITIAL_WINDOW_SIZE    = 0x4,
+		SETTING_MAX_FRAME_SIZE         = 0x5,
+		SETTING_MAX_HEADER_LIST_SIZE   = 0x6
+	};
+
+	enum ErrorCode
+	{
+		H2_ERR_NONE                = 0x0,
+		H2_ERR_PROTOCOL            = 0x1,
+		H2_ERR_INTERNAL            = 0x2,
+		H2_ERR_FLOW_CONTROL        = 0x3,
+		H2_ERR_SETTINGS_TIMEOUT    = 0x4,
+		H2_ERR_STREAM_CLOSED       = 0x5,
+		H2_ERR_FRAME_SIZE          = 0x6,
+		H2_ERR_REFUSED_STREAM      = 0x7,
+		H2_ERR_CANCEL              = 0x8,
+		H2_ERR_COMPRESSION         = 0x9,
+		H2_ERR_CONNECT             = 0xa,
+		H2_ERR_ENHANCE_YOUR_CALM   = 0xb,
+		H2_ERR_INADEQUATE_SECURITY = 0xc,
+		H2_ERR_HTTP_1_1_REQUIRED   = 0xd
+	};
+
+	enum
+	{
+		HEADER_SIZE            = 9,
+		DEFAULT_MAX_FRAME_SIZE = 16384,
+		MAX_MAX_FRAME_SIZE     = 16777215,
+		DEFAULT_WINDOW_SIZE    = 65535,
+		MAX_WINDOW_SIZE        = 0x7fffffff,
+		DEFAULT_TABLE_SIZE     = 4096
+	};
+
+	static const std::string CONNECTION_PREFACE;
+		/// The client connection preface,
+		/// "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n".
+
+	HTTP2Frame();
+		/// Creates an empty frame header.
+
+	HTTP2Frame(FrameType type, UInt8 flags, UInt32 streamId, UInt32 length = 0);
+		/// Creates a frame header with the given type,
+		/// flags, stream identifier and payload length.
+
+	~HTTP2Frame();
+		/// Destroys the HTTP2Frame.
+
+	FrameType type() const;
+		/// Returns the frame type.
+
+	UInt8 flags() const;
+		/// Returns the frame flags.
+
+	bool hasFlag(UInt8 flag) const;
+		/// Returns true if the given flag is set.
+
+	UInt32 streamId() const;
+		/// Returns the stream identifier.
+
+	UInt32 length() const;
+		/// Returns the payload length.
+
+	void setLength(UInt32 length);
+		/// Sets the payload length.
+
+	void write(char* pBuffer) const;
+		/// Writes the HEADER_SIZE bytes of the frame
+		/// header to the given buffer.
+
+	void read(const char* pBuffer);
+		/// Reads the frame header from the HEADER_SIZE
+		/// bytes in the given buffer.
+
+	static UInt32 readUInt32(const char* pBuffer);
+		/// Reads a 32-bit integer in network byte order.
+
+	static void writeUInt32(char* pBuffer, UInt32 value);
+		/// Writes a 32-bit integer in network byte order.
+
+private:
+	FrameType _type;
+	UInt8 _flags;
+	UInt32 _streamId;
+	UInt32 _length;
+};
+
+
+//
+// inlines
+//
+inline HTTP2Frame::FrameType HTTP2Frame::type() const
+{
+	return _type;
+}
+
+
+inline UInt8 HTTP2Frame::flags() const
+{
+	return _flags;
+}
+
+
+inline bool HTTP2Frame::hasFlag(UInt8 flag) const
+{
+	return (_flags & flag) != 0;
+}
+
+
+inline UInt32 HTTP2Frame::streamId() const
+{
+	return _streamId;
+}
+
+
+inline UInt32 HTTP2Frame::length() const
+{
+	return _length;
+}
+
+
+inline void HTTP2Frame::setLength(UInt32 length)
+{
+	_length = length;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTP2Frame_INCLUDED
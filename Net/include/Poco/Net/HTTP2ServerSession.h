@@ -0,0 +1,182 @@
+//
+// HTTP2ServerSession.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerSession
+//
+// Definition of the HTTP2ServerSession class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ServerSession_INCLUDED
+#define Net_HTTP2ServerSession_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/ActiveThreadPool.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Buffer.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include <atomic>
+#include <map>
+
+
+namespace Poco::Net {
+
+
+class HTTPResponse;
+
+
+class Net_API HTTP2ServerSession
+	/// This class implements the server side of an HTTP/2
+	/// connection (RFC 9113), including stream multiplexing,
+	/// HPACK header compression and flow control.
+	///
+	/// Every request is dispatched to a HTTPRequestHandler obtained
+	/// from the given HTTPRequestHandlerFactory, so existing request
+	/// handlers can be used for HTTP/2 without changes. The request
+	/// handler sees a HTTPServerRequest with version "HTTP/2.0" and
+	/// a Host header taken from the :authority pseudo-header.
+	///
+	/// The thread calling run() reads and processes all frames of
+	/// the connection. A request is dispatched as soon as it has been
+	/// received completely, including its body. Request handlers run
+	/// in the given ActiveThreadPool, so multiple requests on the same
+	/// connection are handled concurrently. Response bodies are sent
+	/// as DATA frames as the handler writes them, subject to the
+	/// flow-control windows granted by the client.
+	///
+	/// Normally, a HTTP2ServerSession is created by HTTPServerConnection
+	/// when it receives the HTTP/2 connection preface, if HTTP/2 has
+	/// been enabled with HTTPServerParams::setHTTP2Enabled().
+	///
+	/// Server push is not supported.
+{
+public:
+	HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
+		/// Creates the HTTP2ServerSession for the given socket.
+		/// Request handlers run in the default ActiveThreadPool.
+
+	HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ActiveThreadPool& threadPool);
+		/// Creates the HTTP2ServerSession for the given socket.
+		/// Request handlers run in the given ActiveThreadPool.
+
+	~HTTP2ServerSession();
+		/// Destroys the HTTP2ServerSession.
+
+	void run();
+		/// Reads the connection preface and processes frames
+		/// until the connection is closed by the client, has been
+		/// idle for the keep-alive timeout given in the HTTPServerParams,
+		/// or a connection error occurs. Waits for all request handlers
+		/// to complete before returning.
+
+	void run(const char* pReceived, std::size_t length);
+		/// Same as run(), but the given data, which must be the
+		/// beginning of the connection preface, has already been
+		/// received from the socket.
+
+	void stop();
+		/// Stops accepting new streams. The session terminates as
+		/// soon as all current streams have completed and the
+		/// connection is idle.
+
+	int activeStreams() const;
+		/// Returns the number of open streams.
+
+private:
+	class Stream;
+	class Request;
+	class Response;
+	class OutputStreamBuf;
+	class Task;
+
+	using StreamPtr = Poco::AutoPtr<Stream>;
+	using StreamMap = std::map<UInt32, StreamPtr>;
+
+	bool receive(char* pBuffer, std::size_t length, bool frameStart);
+	void readPreface();
+	bool readFrame(HTTP2Frame& frame);
+	void handleFrame(const HTTP2Frame& frame);
+	void handleData(const HTTP2Frame& frame);
+	void handleHeaders(const HTTP2Frame& frame);
+	void handleContinuation(const HTTP2Frame& frame);
+	void handleRstStream(const HTTP2Frame& frame);
+	void handleSettings(const HTTP2Frame& frame);
+	void handlePing(const HTTP2Frame& frame);
+	void handleWindowUpdate(const HTTP2Frame& frame);
+	void headerBlockComplete(UInt32 streamId, bool endStream);
+	void consumeReceiveWindow(Stream* pStream, UInt32 length);
+	void resetStream(UInt32 streamId, HTTP2Frame::ErrorCode error);
+	void dispatch(StreamPtr pStream);
+	void processRequest(Stream& stream);
+	void streamDone(Stream& stream);
+	StreamPtr findStream(UInt32 streamId) const;
+	void close();
+
+	void writeFrame(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length);
+	void writeFrameImpl(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length);
+	void sendSettings();
+	void sendWindowUpdate(UInt32 streamId, UInt32 increment);
+	void sendRstStream(UInt32 streamId, HTTP2Frame::ErrorCode error);
+	void sendGoAway(HTTP2Frame::ErrorCode error);
+	void sendHeaders(Stream& stream, const HTTPResponse& response, bool endStream);
+	void sendData(Stream& stream, const char* pData, std::size_t length, bool endStream);
+	std::size_t acquireSendWindow(Stream& stream, std::size_t length);
+
+	HTTP2ServerSession(const HTTP2ServerSession&) = delete;
+	HTTP2ServerSession& operator = (const HTTP2ServerSession&) = delete;
+
+	StreamSocket _socket;
+	SocketAddress _clientAddress;
+	SocketAddress _serverAddress;
+	HTTPServerParams::Ptr _pParams;
+	HTTPRequestHandlerFactory::Ptr _pFactory;
+	Poco::ActiveThreadPool& _threadPool;
+
+	std::string _received;
+	std::size_t _receivedPos;
+	Poco::Buffer<char> _payload;
+	HPACKDecoder _decoder;
+	std::string _headerBlock;
+	UInt32 _continuationStreamId;
+	bool _continuationEndStream;
+	std::atomic<UInt32> _lastStreamId;
+	Int64 _recvWindow;
+	UInt32 _recvConsumed;
+	bool _goAwayReceived;
+
+	mutable Poco::FastMutex _mutex;
+	Poco::Condition _condition;
+	StreamMap _streams;
+	int _activeTasks;
+	Int64 _sendWindow;
+	Int64 _peerInitialWindowSize;
+	std::atomic<UInt32> _peerMaxFrameSize;
+	std::atomic<bool> _closed;
+	std::atomic<bool> _stopped;
+
+	Poco::FastMutex _writeMutex;
+	HPACKEncoder _encoder;
+	Poco::Buffer<char> _writeBuffer;
+	bool _goAwaySent;
+};
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTP2ServerSession_INCLUDED
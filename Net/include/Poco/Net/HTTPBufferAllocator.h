@@ -19,7 +19,6 @@
 
 
 #include "Poco/Net/Net.h"
-#include "Poco/MemoryPool.h"
 #include <ios>
 
 
@@ -28,33 +27,23 @@ namespace Poco::Net {
 
 class Net_API HTTPBufferAllocator
 	/// A BufferAllocator for HTTP streams.
+	///
+	/// Buffers are obtained from the Poco::SlabAllocator,
+	/// which caches free buffers per thread.
 {
 public:
 	static char* allocate(std::streamsize size);
 	static void deallocate(char* ptr, std::streamsize size);
-	static const Poco::MemoryPool& pool();
 
 	enum
 	{
 		BUFFER_SIZE = 4096
+			/// The default buffer size for HTTP streams and sessions.
+			/// See HTTPSession::setBufferSize().
 	};
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
-//
-// inlines
-//
-
-
-inline const Poco::MemoryPool& HTTPBufferAllocator::pool()
-{
-	return _pool;
-}
-
-
 } // namespace Poco::Net
 
 
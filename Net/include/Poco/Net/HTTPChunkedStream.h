@@ -20,7 +20,6 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/HTTPBasicStreamBuf.h"
-#include "Poco/MemoryPool.h"
 #include <cstddef>
 #include <istream>
 #include <ostream>
@@ -79,9 +78,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -94,9 +90,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
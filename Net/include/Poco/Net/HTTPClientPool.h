@@ -0,0 +1,276 @@
+//
+// HTTPClientPool.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientPool
+//
+// Definition of the HTTPClientPool class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPClientPool_INCLUDED
+#define Net_HTTPClientPool_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTP2ClientSession.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/URI.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class HTTPRequest;
+class HTTPResponse;
+
+
+class Net_API HTTPClientPool
+	/// A thread-safe pool of HTTP client connections, keyed by
+	/// scheme, host and port.
+	///
+	/// sendRequest() sends a request to the server designated by
+	/// a URI, using a pooled connection. If HTTP/2 is available for
+	/// the server, all requests to it are multiplexed over a shared
+	/// HTTP2ClientSession; otherwise, an idle HTTP/1.1 connection is
+	/// reused with keep-alive, or a new one is created.
+	///
+	/// The number of connections per server is limited. If the limit
+	/// has been reached, a request for a HTTP/1.1 connection waits until
+	/// another connection has been returned to the pool. Connections
+	/// that have been idle for longer than the idle timeout are closed.
+	///
+	/// For HTTP/2 with plain HTTP ("h2c"), the server must be known to
+	/// support HTTP/2 (see setHTTP2PriorKnowledge()), as upgrading from
+	/// HTTP/1.1 is not supported. For HTTP/2 over TLS, which is negotiated
+	/// via ALPN, use the HTTPSClientPool class from the NetSSL library.
+	///
+	/// HTTP/1.1 request pipelining is not supported, as most servers
+	/// and proxies do not handle it reliably. HTTP/2 is used instead
+	/// to send multiple concurrent requests over a single connection.
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_CONNECTIONS_PER_HOST = 8
+	};
+
+	HTTPClientPool();
+		/// Creates the HTTPClientPool with a limit of
+		/// DEFAULT_MAX_CONNECTIONS_PER_HOST connections per server
+		/// and an idle timeout of 60 seconds.
+
+	HTTPClientPool(int maxConnectionsPerHost, const Poco::Timespan& idleTimeout);
+		/// Creates the HTTPClientPool with the given limit of
+		/// connections per server and the given idle timeout.
+
+	virtual ~HTTPClientPool();
+		/// Destroys the HTTPClientPool and closes all connections.
+		///
+		/// All sessions obtained with borrowSession() must have been
+		/// returned before the HTTPClientPool is destroyed.
+
+	void sendRequest(const Poco::URI& uri, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody);
+		/// Sends the given request, with the given body, to the server
+		/// specified by the scheme, host and port of the given URI, and
+		/// receives the response. The path and query of the URI are not
+		/// used; the request URI is taken from the request.
+		///
+		/// Requests refused by a HTTP/2 server, because it has reached
+		/// its stream limit or is shutting down the connection, are
+		/// retried once on another connection. Idempotent requests that
+		/// fail on a reused HTTP/1.1 connection before a response has
+		/// been received are retried once on a new connection.
+		///
+		/// Throws a TimeoutException if no connection becomes
+		/// available within the timeout.
+
+	HTTPClientSession* borrowSession(const Poco::URI& uri);
+		/// Returns an HTTP/1.1 session for the server specified by the
+		/// scheme, host and port of the given URI, for exclusive use
+		/// by the caller. Idle sessions are reused; if there are none,
+		/// and the connection limit has not been reached, a new session
+		/// is created. Otherwise, waits for a session to be returned.
+		///
+		/// The session must be returned with returnSession(), after
+		/// the response body has been read completely.
+		///
+		/// Throws a TimeoutException if no session becomes
+		/// available within the timeout.
+
+	void returnSession(HTTPClientSession* pSession, bool reusable = true);
+		/// Returns a session obtained from borrowSession() to the pool.
+		/// If reusable is false, or the connection has been closed,
+		/// the session is deleted; otherwise it is kept as idle session.
+
+	void purge();
+		/// Closes all connections that have been
+		/// idle for longer than the idle timeout.
+		///
+		/// purge() is called by sendRequest() and borrowSession()
+		/// at most once per idle timeout, but can also be called
+		/// periodically by the application.
+
+	void clear();
+		/// Closes all idle HTTP/1.1 connections and all HTTP/2
+		/// connections. Requests pending on HTTP/2 connections fail.
+
+	int connections(const Poco::URI& uri) const;
+		/// Returns the number of connections to the server
+		/// specified by the scheme, host and port of uri,
+		/// including idle and borrowed connections.
+
+	int idleConnections(const Poco::URI& uri) const;
+		/// Returns the number of idle HTTP/1.1 connections to the
+		/// server specified by the scheme, host and port of uri.
+
+	void setMaxConnectionsPerHost(int maxConnections);
+		/// Sets the maximum number of connections per server.
+
+	int getMaxConnectionsPerHost() const;
+		/// Returns the maximum number of connections per server.
+
+	void setIdleTimeout(const Poco::Timespan& timeout);
+		/// Sets the time after which idle connections are closed.
+
+	Poco::Timespan getIdleTimeout() const;
+		/// Returns the time after which idle connections are closed.
+
+	void setTimeout(const Poco::Timespan& timeout);
+		/// Sets the timeout for sessions created by the pool,
+		/// and for waiting for an available connection.
+		///
+		/// The default is 60 seconds.
+
+	Poco::Timespan getTimeout() const;
+		/// Returns the timeout for sessions and for waiting
+		/// for an available connection.
+
+	void setHTTP2Enabled(bool enabled);
+		/// Enables or disables HTTP/2. HTTP/2 is enabled by default.
+
+	bool getHTTP2Enabled() const;
+		/// Returns true if HTTP/2 is enabled.
+
+	void setHTTP2PriorKnowledge(bool enabled);
+		/// If enabled, HTTP/2 is used for "http" URIs without
+		/// negotiation, as described in RFC 9113, Section 3.3.
+		/// This must only be enabled if all servers the pool
+		/// connects to via plain HTTP support HTTP/2.
+		///
+		/// Disabled by default.
+
+	bool getHTTP2PriorKnowledge() const;
+		/// Returns true if HTTP/2 is used for "http" URIs
+		/// without negotiation.
+
+protected:
+	virtual HTTPClientSession* createSession(const std::string& scheme, const std::string& host, Poco::UInt16 port);
+		/// Creates a new HTTP/1.1 session for the given server.
+		///
+		/// The default implementation creates a HTTPClientSession for
+		/// "http", and uses the default HTTPSessionFactory for other
+		/// schemes. The pool sets the timeout and enables keep-alive
+		/// for the returned session.
+
+	virtual HTTP2ClientSession::Ptr createHTTP2Session(const std::string& scheme, const std::string& host, Poco::UInt16 port);
+		/// Connects to the given server and creates a HTTP2ClientSession
+		/// for the connection. Returns a null pointer if the server does
+		/// not support HTTP/2, in which case the pool uses HTTP/1.1 for
+		/// the server from then on.
+		///
+		/// The default implementation creates a HTTP2ClientSession for
+		/// "http" if prior knowledge has been enabled, and returns a
+		/// null pointer otherwise.
+
+	virtual void sessionReturned(HTTPClientSession& session);
+		/// Called by returnSession() before a session is kept as idle
+		/// session or deleted. The default implementation does nothing.
+
+	void addIdleSession(const std::string& scheme, const std::string& host, Poco::UInt16 port, HTTPClientSession* pSession);
+		/// Adds the given connected HTTP/1.1 session for the given server
+		/// to the idle sessions, taking ownership of it.
+		///
+		/// Can be used by createHTTP2Session() implementations to keep
+		/// a connection for which HTTP/1.1 has been negotiated, instead
+		/// of closing it. If the connection limit for the server has
+		/// been reached, the session is deleted.
+
+private:
+	struct IdleSession
+	{
+		std::unique_ptr<HTTPClientSession> pSession;
+		Poco::Timestamp since;
+	};
+
+	struct HostPool
+	{
+		HostPool(): inUse(0), http2Connecting(false), http2Unavailable(false)
+		{
+		}
+
+		std::size_t connections() const
+		{
+			return idle.size() + inUse + http2.size();
+		}
+
+		std::vector<IdleSession> idle;
+		std::size_t inUse;
+		std::vector<HTTP2ClientSession::Ptr> http2;
+		bool http2Connecting;
+		bool http2Unavailable;
+	};
+
+	using HostMap = std::map<std::string, HostPool>;
+	using SessionMap = std::map<HTTPClientSession*, std::string>;
+
+	struct Target
+	{
+		std::string scheme;
+		std::string host;
+		Poco::UInt16 port;
+		std::string key;
+	};
+
+	static Target target(const Poco::URI& uri);
+	static std::string key(const std::string& scheme, const std::string& host, Poco::UInt16 port);
+	HTTPClientSession* acquireSession(const Target& target, bool& reused);
+	HTTP2ClientSession::Ptr acquireHTTP2Session(const Target& target);
+	bool sendHTTP2Request(const Target& target, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody);
+	void sendHTTP1Request(const Target& target, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody);
+	void purgeIfDue();
+	void evictIdle(HostPool& pool, std::vector<IdleSession>& evicted);
+
+	HTTPClientPool(const HTTPClientPool&) = delete;
+	HTTPClientPool& operator = (const HTTPClientPool&) = delete;
+
+	std::size_t _maxConnectionsPerHost;
+	Poco::Timespan _idleTimeout;
+	Poco::Timespan _timeout;
+	bool _http2Enabled;
+	bool _http2PriorKnowledge;
+	HostMap _hosts;
+	SessionMap _borrowed;
+	Poco::Timestamp _lastPurge;
+	mutable Poco::FastMutex _mutex;
+	Poco::Condition _condition;
+};
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPClientPool_INCLUDED
@@ -86,6 +86,11 @@ public:
 	HTTPClientSession(const StreamSocket& socket, const ProxyConfig& proxyConfig);
 		/// Creates a HTTPClientSession using the given socket and proxy configuration.
 
+	HTTPClientSession(const StreamSocket& socket, const std::string& host, Poco::UInt16 port);
+		/// Creates a HTTPClientSession using the given socket, host and port.
+		/// The socket may already be connected to the given server.
+		/// The session takes ownership of the socket.
+
 	virtual ~HTTPClientSession();
 		/// Destroys the HTTPClientSession and closes
 		/// the underlying socket.
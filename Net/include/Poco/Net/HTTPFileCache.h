@@ -0,0 +1,147 @@
+//
+// HTTPFileCache.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPFileCache
+//
+// Definition of the HTTPFileCache class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPFileCache_INCLUDED
+#define Net_HTTPFileCache_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/LRUCache.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Timespan.h"
+#include <atomic>
+#include <memory>
+#include <string>
+
+
+namespace Poco::Net {
+
+
+class HTTPRequest;
+
+
+class Net_API HTTPFileCache: public Poco::RefCountedObject
+	/// A cache of open files and their precomputed HTTP
+	/// response headers, for serving static files with
+	/// HTTPServerResponse::sendFile().
+	///
+	/// Each entry keeps the file open, together with its size and
+	/// the Last-Modified and ETag header values. Since the file
+	/// contents are sent with sendfile() at an explicit offset, the
+	/// same open file can be shared by all connections.
+	///
+	/// Entries are revalidated (by checking the file's size and
+	/// modification time) when they are older than the check interval,
+	/// and reopened if the file has changed. Files larger than the
+	/// maximum file size are not cached.
+	///
+	/// To enable the cache for a HTTPServer or HTTPReactorServer,
+	/// pass it to HTTPServerParams::setFileCache().
+	///
+	/// The class is thread-safe.
+{
+public:
+	using Ptr = Poco::AutoPtr<HTTPFileCache>;
+
+	struct Entry
+	{
+		std::string path;
+		std::shared_ptr<Poco::FileInputStream> pStream;
+		Poco::File::FileSize size = 0;
+		Poco::Timestamp lastModified;
+		std::string lastModifiedHeader;
+		std::string etag;
+		std::atomic<Poco::Timestamp::TimeVal> validated{0};
+	};
+
+	using EntryPtr = Poco::SharedPtr<Entry>;
+
+	HTTPFileCache(std::size_t maxEntries = 1024, Poco::File::FileSize maxFileSize = 1024*1024, const Poco::Timespan& checkInterval = Poco::Timespan(1, 0));
+		/// Creates the HTTPFileCache.
+
+	EntryPtr get(const std::string& path);
+		/// Returns the entry for the file with the given path, opening
+		/// the file and adding it to the cache if necessary.
+		///
+		/// Files larger than the maximum file size are opened,
+		/// but not added to the cache.
+		///
+		/// Throws a FileNotFoundException or OpenFileException
+		/// if the file cannot be opened.
+
+	void remove(const std::string& path);
+		/// Removes the entry for the given path from the cache.
+
+	void clear();
+		/// Removes all entries from the cache.
+
+	std::size_t size();
+		/// Returns the number of cached files.
+
+	Poco::File::FileSize maxFileSize() const;
+		/// Returns the maximum size of a cached file.
+
+	const Poco::Timespan& checkInterval() const;
+		/// Returns the interval after which cached entries
+		/// are revalidated.
+
+	static EntryPtr open(const std::string& path);
+		/// Opens the file and creates an entry for it,
+		/// without caching it.
+
+	static bool notModified(const HTTPRequest& request, const Entry& entry);
+		/// Returns true if one of the If-None-Match fields of the
+		/// request matches the ETag of the entry, using the weak
+		/// comparison function (RFC 9110, 13.1.2). A field value
+		/// may contain a list of entity tags, or "*".
+
+protected:
+	~HTTPFileCache();
+
+private:
+	HTTPFileCache(const HTTPFileCache&) = delete;
+	HTTPFileCache& operator = (const HTTPFileCache&) = delete;
+
+	Poco::LRUCache<std::string, Entry> _cache;
+	Poco::File::FileSize _maxFileSize;
+	Poco::Timespan _checkInterval;
+};
+
+
+//
+// inlines
+//
+inline Poco::File::FileSize HTTPFileCache::maxFileSize() const
+{
+	return _maxFileSize;
+}
+
+
+inline const Poco::Timespan& HTTPFileCache::checkInterval() const
+{
+	return _checkInterval;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPFileCache_INCLUDED
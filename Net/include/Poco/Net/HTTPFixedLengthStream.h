@@ -82,9 +82,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -97,9 +94,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
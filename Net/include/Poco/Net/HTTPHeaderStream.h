@@ -20,7 +20,6 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/HTTPBasicStreamBuf.h"
-#include "Poco/MemoryPool.h"
 #include <cstddef>
 #include <istream>
 #include <ostream>
@@ -74,9 +73,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -89,9 +85,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
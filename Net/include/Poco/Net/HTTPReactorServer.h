@@ -3,19 +3,33 @@
 
 #include "Poco/Logger.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPRequestParser.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Net/TCPReactorServer.h"
-#include "Poco/ThreadPool.h"
+#include <functional>
+#include <vector>
 namespace Poco::Net {
 
 
 class Net_API HTTPReactorServer
+	/// A HTTP server based on TCPReactorServer.
+	///
+	/// For a shared-nothing, thread-per-core deployment, configure
+	/// one acceptor per core (HTTPServerParams::setAcceptorNum()),
+	/// enable setUseSelfReactor(), optionally pin the reactor threads
+	/// with setThreadAffinity(), and pass a FactoryCreator so that
+	/// every acceptor gets its own request handler factory.
+	/// Each acceptor then owns its listening socket (SO_REUSEPORT),
+	/// reactor, connections and handler factory.
 {
 public:
+	using FactoryCreator = std::function<HTTPRequestHandlerFactory::Ptr(int acceptor)>;
+		/// Creates the request handler factory for the given acceptor.
+
 	HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
 		/// Listens on the wildcard address on the given port.
 
@@ -24,6 +38,13 @@ public:
 		/// single interface (e.g. SocketAddress("127.0.0.1", 9800) for a
 		/// localhost-only service).
 
+	HTTPReactorServer(const SocketAddress& address, HTTPServerParams::Ptr pParams, const FactoryCreator& factoryCreator);
+		/// Listens on the given address and creates a separate request
+		/// handler factory for each acceptor by calling factoryCreator
+		/// with the acceptor index. Requests received on connections
+		/// accepted by an acceptor are always dispatched to its own
+		/// factory.
+
 	~HTTPReactorServer();
 	void start();
 	void stop();
@@ -33,11 +54,13 @@ public:
 	void sendErrorResponse(HTTPSession& session, HTTPResponse::HTTPStatus status);
 
 private:
-	TCPReactorServer               _tcpReactorServer;
-	HTTPServerParams::Ptr          _pParams;
-	HTTPRequestHandlerFactory::Ptr _pFactory;
+	void onMessage(const TcpReactorConnectionPtr& conn, HTTPRequestHandlerFactory& factory);
+	bool processRequest(const TcpReactorConnectionPtr& conn, HTTPRequestParser& parser, HTTPRequestHandlerFactory& factory);
 
-	ThreadPool _threadPool;
+	TCPReactorServer                            _tcpReactorServer;
+	HTTPServerParams::Ptr                       _pParams;
+	HTTPRequestHandlerFactory::Ptr              _pFactory;
+	std::vector<HTTPRequestHandlerFactory::Ptr> _factories;
 };
 
 } // namespace Poco::Net
@@ -1,10 +1,14 @@
 #ifndef Net_HTTPReactorServerSession_INCLUDED
 #define Net_HTTPReactorServerSession_INCLUDED
+#include "Poco/Net/HTTPRequestParser.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/SocketAddress.h"
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/TCPReactorServerConnection.h"
+#include "Poco/FileStream.h"
 #include <cstring>
+#include <memory>
 #include <string>
 namespace Poco::Net {
 
@@ -18,6 +22,13 @@ public:
 	HTTPReactorServerSession(const StreamSocket& socket, std::string& buf, HTTPServerParams::Ptr pParams);
 	/// Creates the HTTPReactorServerSession.
 
+	HTTPReactorServerSession(const StreamSocket& socket, std::string& buf, HTTPRequestParser& parser, HTTPServerParams::Ptr pParams);
+	/// Creates the HTTPReactorServerSession, using the given parser.
+	///
+	/// The parser keeps its state across sessions, so a request
+	/// received in several pieces is scanned only once. It must be
+	/// associated with the connection owning buf.
+
 	virtual ~HTTPReactorServerSession();
 	/// Destroys the HTTPReactorServerSession.
 
@@ -34,8 +45,37 @@ public:
 	/// Returns the server's address.
 
 	bool checkRequestComplete();
+	/// Parses the received data and returns true if the buffer
+	/// contains a complete request.
+	///
+	/// Throws a MessageException if the request is malformed.
 
 	void popCompletedRequest();
+	/// Removes the completed request from the buffer and
+	/// prepares the parser for the next (pipelined) request.
+
+	const HTTPRequestParser& parser() const;
+	/// Returns the request parser.
+
+	void setConnection(const TcpReactorConnectionPtr& pConnection);
+	/// Sets the reactor connection the session belongs to.
+	/// Required for sendFile() to continue large transfers
+	/// from the reactor thread instead of blocking.
+
+	void sendFile(const std::shared_ptr<Poco::FileInputStream>& pStream, std::streamoff offset, std::streamsize count);
+	/// Sends count bytes of the given file, starting at offset.
+	///
+	/// If a connection has been set, the transfer is done without
+	/// blocking; the part not accepted by the socket immediately
+	/// is sent as the socket becomes writable (see
+	/// TCPReactorServerConnection::sendFile()). Otherwise, the file
+	/// is sent with StreamSocket::sendFile().
+
+	void skipHeader();
+	/// Positions the read pointer at the beginning of the
+	/// request body. Used when the request header has been
+	/// taken from the parser instead of being read from the
+	/// session.
 
 private:
 	int get() override;
@@ -46,19 +86,26 @@ private:
 
 	int write(const char* buffer, std::streamsize length) override;
 
-	bool parseHeaders(std::size_t pos, std::size_t& bodyStart, std::size_t& contentLength, bool& isChunked);
-
-	bool parseChunkSize(std::size_t& pos, std::size_t& chunkSize, int&);
-
 private:
-	std::string&   _buf;
-	char*          _pcur{nullptr};
-	char*          _pend{nullptr};
-	int            _idx{0};
-	int            _complete{0};
-	StreamSocket   _realsocket;
+	std::string&       _buf;
+	HTTPRequestParser  _parser;
+	HTTPRequestParser* _pParser;
+	std::size_t        _idx{0};
+	std::size_t        _complete{0};
+	StreamSocket       _realsocket;
+	TcpReactorConnectionPtr _pConnection;
 };
 
+
+//
+// inlines
+//
+inline const HTTPRequestParser& HTTPReactorServerSession::parser() const
+{
+	return *_pParser;
+}
+
+
 } // namespace Poco::Net
 
 #endif // Net_HTTPReactorServerSession_INCLUDED
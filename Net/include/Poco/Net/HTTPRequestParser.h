@@ -0,0 +1,364 @@
+//
+// HTTPRequestParser.h
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPRequestParser
+//
+// Definition of the HTTPRequestParser class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPRequestParser_INCLUDED
+#define Net_HTTPRequestParser_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+namespace Poco::Net {
+
+
+class HTTPRequest;
+
+
+class Net_API HTTPRequestParser
+	/// An incremental, zero-copy HTTP/1.x request parser.
+	///
+	/// The parser works directly on a receive buffer that is owned by
+	/// the caller. Each call to parse() continues where the previous
+	/// call stopped, so data received in several pieces is scanned
+	/// only once. The request line and header fields are recorded as
+	/// offsets into the buffer and made available as string_views;
+	/// no memory is allocated per request once the field table has
+	/// grown to its working size.
+	///
+	/// The parser also determines the extent of the message body
+	/// (Content-Length or chunked transfer encoding), so that
+	/// messageLength() gives the number of bytes occupied by the
+	/// complete request. Bytes following that position belong to the
+	/// next (pipelined) request; after consuming the current request,
+	/// call reset() and continue parsing with the remaining bytes.
+	///
+	/// Obsolete header line folding is rejected, as permitted
+	/// by RFC 9112, section 5.2.
+	///
+	/// The number of header fields and the total size of the request
+	/// line and header are limited (see setFieldLimit() and
+	/// setHeaderSizeLimit()), so that a client cannot make the server
+	/// buffer an unbounded header. HTTPReactorServer takes the limits
+	/// from its HTTPServerParams.
+{
+public:
+	enum Status
+	{
+		PARSE_INCOMPLETE, /// More data is required.
+		PARSE_COMPLETE,   /// A complete request (including body) is in the buffer.
+		PARSE_ERROR       /// The request is malformed; see error().
+	};
+
+	using Field = std::pair<std::string_view, std::string_view>;
+
+	HTTPRequestParser();
+		/// Creates the HTTPRequestParser.
+
+	~HTTPRequestParser();
+		/// Destroys the HTTPRequestParser.
+
+	Status parse(const char* buffer, std::size_t length);
+		/// Continues parsing the request starting at buffer.
+		///
+		/// The buffer must start with the same bytes that have been
+		/// passed in previous calls since the last reset(), optionally
+		/// followed by newly received data. The buffer may have been
+		/// moved in memory between calls.
+		///
+		/// Returns the parser status.
+
+	void reset();
+		/// Resets the parser for the next request.
+		/// The limits are kept.
+
+	void setFieldLimit(int limit);
+		/// Sets the maximum number of header fields allowed.
+		/// Specify 0 for unlimited (not recommended).
+		///
+		/// The default limit is 100, the same as for MessageHeader.
+
+	int getFieldLimit() const;
+		/// Returns the maximum number of header fields allowed.
+
+	void setHeaderSizeLimit(std::size_t limit);
+		/// Sets the maximum size in bytes of the request line
+		/// and header, including the terminating empty line.
+		/// Specify 0 for unlimited (not recommended).
+		///
+		/// The default limit is 64 KiB.
+
+	std::size_t getHeaderSizeLimit() const;
+		/// Returns the maximum size of the request line and header.
+
+	Status status() const;
+		/// Returns the current parser status.
+
+	const std::string& error() const;
+		/// Returns a description of the error if status()
+		/// is PARSE_ERROR.
+
+	bool limitExceeded() const;
+		/// Returns true if parsing failed because the field
+		/// limit or the header size limit has been exceeded.
+		/// Such requests should be rejected with status 431
+		/// (Request Header Fields Too Large).
+
+	bool headerComplete() const;
+		/// Returns true if the request line and all header
+		/// fields have been parsed.
+
+	std::size_t headerLength() const;
+		/// Returns the length of the request line and header,
+		/// including the terminating empty line.
+		/// Only valid if headerComplete() returns true.
+
+	std::size_t messageLength() const;
+		/// Returns the length of the complete request, including
+		/// the body. Only valid if status() is PARSE_COMPLETE.
+
+	bool chunked() const;
+		/// Returns true if the request body uses chunked
+		/// transfer encoding.
+
+	bool hasContentLength() const;
+		/// Returns true if the request has a Content-Length header.
+
+	std::size_t contentLength() const;
+		/// Returns the value of the Content-Length header, or 0.
+
+	std::string_view method() const;
+		/// Returns the request method.
+
+	std::string_view uri() const;
+		/// Returns the request URI.
+
+	std::string_view version() const;
+		/// Returns the HTTP version string.
+
+	std::size_t fieldCount() const;
+		/// Returns the number of header fields.
+
+	Field field(std::size_t index) const;
+		/// Returns the name and value of the header field
+		/// with the given index. Leading and trailing whitespace
+		/// is removed from the value.
+
+	void fill(HTTPRequest& request) const;
+		/// Sets method, URI, version and header fields of the given
+		/// request. The request's field limits and auto-decoding
+		/// settings are honored.
+		///
+		/// Throws a MessageException if a limit is exceeded.
+		/// Only valid if headerComplete() returns true.
+
+private:
+	enum State
+	{
+		ST_REQUEST_LINE,
+		ST_HEADER,
+		ST_BODY,
+		ST_CHUNK_SIZE,
+		ST_CHUNK_DATA,
+		ST_CHUNK_DATA_END,
+		ST_TRAILER,
+		ST_COMPLETE,
+		ST_ERROR
+	};
+
+	enum Limits
+	{
+		MAX_METHOD_LENGTH  = 32,
+		MAX_URI_LENGTH     = 16384,
+		MAX_VERSION_LENGTH = 8
+	};
+
+	static constexpr int DFL_FIELD_LIMIT = 100;
+	static constexpr std::size_t DFL_HEADER_SIZE_LIMIT = 65536;
+
+	struct Span
+	{
+		std::size_t offset = 0;
+		std::size_t length = 0;
+	};
+
+	struct FieldSpan
+	{
+		Span name;
+		Span value;
+	};
+
+	const char* nextLine(std::size_t& lineEnd, std::size_t& next);
+	const char* nextHeaderLine(std::size_t& lineEnd, std::size_t& next);
+	bool parseRequestLine(std::size_t begin, std::size_t end);
+	bool parseHeaderLine(std::size_t begin, std::size_t end);
+	bool parseChunkSize(std::size_t begin, std::size_t end);
+	Status fail(const char* message);
+	Status failLimit(const char* message);
+	std::string_view view(const Span& span) const;
+
+	HTTPRequestParser(const HTTPRequestParser&) = delete;
+	HTTPRequestParser& operator = (const HTTPRequestParser&) = delete;
+
+	const char* _pBuffer = nullptr;
+	std::size_t _length = 0;
+	std::size_t _pos = 0;
+	State _state = ST_REQUEST_LINE;
+	Span _method;
+	Span _uri;
+	Span _version;
+	std::vector<FieldSpan> _fields;
+	std::size_t _headerLength = 0;
+	std::size_t _messageLength = 0;
+	std::size_t _contentLength = 0;
+	std::size_t _chunkRemaining = 0;
+	bool _hasContentLength = false;
+	bool _hasTransferEncoding = false;
+	bool _chunked = false;
+	bool _limitExceeded = false;
+	int _fieldLimit = DFL_FIELD_LIMIT;
+	std::size_t _headerSizeLimit = DFL_HEADER_SIZE_LIMIT;
+	std::string _error;
+};
+
+
+//
+// inlines
+//
+inline HTTPRequestParser::Status HTTPRequestParser::status() const
+{
+	if (_state == ST_COMPLETE) return PARSE_COMPLETE;
+	if (_state == ST_ERROR) return PARSE_ERROR;
+	return PARSE_INCOMPLETE;
+}
+
+
+inline const std::string& HTTPRequestParser::error() const
+{
+	return _error;
+}
+
+
+inline bool HTTPRequestParser::limitExceeded() const
+{
+	return _limitExceeded;
+}
+
+
+inline void HTTPRequestParser::setFieldLimit(int limit)
+{
+	_fieldLimit = limit;
+}
+
+
+inline int HTTPRequestParser::getFieldLimit() const
+{
+	return _fieldLimit;
+}
+
+
+inline void HTTPRequestParser::setHeaderSizeLimit(std::size_t limit)
+{
+	_headerSizeLimit = limit;
+}
+
+
+inline std::size_t HTTPRequestParser::getHeaderSizeLimit() const
+{
+	return _headerSizeLimit;
+}
+
+
+inline bool HTTPRequestParser::headerComplete() const
+{
+	return _state != ST_REQUEST_LINE && _state != ST_HEADER && _state != ST_ERROR;
+}
+
+
+inline std::size_t HTTPRequestParser::headerLength() const
+{
+	return _headerLength;
+}
+
+
+inline std::size_t HTTPRequestParser::messageLength() const
+{
+	return _messageLength;
+}
+
+
+inline bool HTTPRequestParser::chunked() const
+{
+	return _chunked;
+}
+
+
+inline bool HTTPRequestParser::hasContentLength() const
+{
+	return _hasContentLength;
+}
+
+
+inline std::size_t HTTPRequestParser::contentLength() const
+{
+	return _contentLength;
+}
+
+
+inline std::string_view HTTPRequestParser::view(const Span& span) const
+{
+	return std::string_view(_pBuffer + span.offset, span.length);
+}
+
+
+inline std::string_view HTTPRequestParser::method() const
+{
+	return view(_method);
+}
+
+
+inline std::string_view HTTPRequestParser::uri() const
+{
+	return view(_uri);
+}
+
+
+inline std::string_view HTTPRequestParser::version() const
+{
+	return view(_version);
+}
+
+
+inline std::size_t HTTPRequestParser::fieldCount() const
+{
+	return _fields.size();
+}
+
+
+inline HTTPRequestParser::Field HTTPRequestParser::field(std::size_t index) const
+{
+	return Field(view(_fields[index].name), view(_fields[index].value));
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_HTTPRequestParser_INCLUDED
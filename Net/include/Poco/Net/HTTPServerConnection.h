@@ -31,6 +31,7 @@ namespace Poco::Net {
 
 
 class HTTPServerSession;
+class HTTPServerRequest;
 
 
 class Net_API HTTPServerConnection: public TCPServerConnection
@@ -50,6 +51,9 @@ public:
 protected:
 	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
 	void onServerStopped(const bool& abortCurrent);
+	static bool isHTTP2Preface(const HTTPServerRequest& request);
+		/// Returns true if the request is the beginning of
+		/// the HTTP/2 connection preface ("PRI * HTTP/2.0").
 
 private:
 	HTTPServerParams::Ptr          _pParams;
@@ -20,6 +20,7 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/TCPServerParams.h"
+#include "Poco/Net/HTTPFileCache.h"
 
 
 namespace Poco::Net {
@@ -103,6 +104,96 @@ public:
 		/// Returns true if automatic conversion of HTTP header values
 		/// when reading HTTP header.
 
+	void setBufferSize(std::streamsize size);
+		/// Sets the size of the buffers used by sessions and
+		/// request/response streams of the server.
+		///
+		/// A larger size (e.g., 16384) reduces the number of system
+		/// calls for large request and response bodies, at the cost
+		/// of more memory per connection.
+		/// The default is HTTPBufferAllocator::BUFFER_SIZE.
+
+	std::streamsize getBufferSize() const;
+		/// Returns the buffer size.
+
+	void setMaxHeaderFields(int maxFields);
+		/// Sets the maximum number of header fields allowed
+		/// in a request. Specify 0 for unlimited (not recommended).
+		///
+		/// The default is 100.
+
+	int getMaxHeaderFields() const;
+		/// Returns the maximum number of header fields allowed
+		/// in a request.
+
+	void setMaxHeaderSize(std::size_t maxSize);
+		/// Sets the maximum size in bytes of the request line and
+		/// header of a request received by a HTTPReactorServer,
+		/// including the terminating empty line. Specify 0 for
+		/// unlimited (not recommended).
+		///
+		/// The default is 65536 (64 KB).
+
+	std::size_t getMaxHeaderSize() const;
+		/// Returns the maximum size of the request line and header.
+
+	void setFileCache(HTTPFileCache::Ptr pFileCache);
+		/// Sets the cache of open files and precomputed headers
+		/// used by HTTPServerResponse::sendFile().
+		///
+		/// The cache can be shared by multiple servers.
+		/// The default is no cache.
+
+	HTTPFileCache::Ptr getFileCache() const;
+		/// Returns the file cache used by HTTPServerResponse::sendFile(),
+		/// which may be null.
+
+	void setHTTP2Enabled(bool enabled);
+		/// Enables or disables HTTP/2 support.
+		///
+		/// If enabled, a HTTPServerConnection that receives the HTTP/2
+		/// connection preface switches to HTTP/2 (see HTTP2ServerSession).
+		/// This supports HTTP/2 over cleartext TCP with prior knowledge
+		/// (h2c), as well as HTTP/2 over TLS if the server's TLS context
+		/// offers "h2" via ALPN.
+		///
+		/// The default is false.
+
+	bool getHTTP2Enabled() const;
+		/// Returns true if HTTP/2 support is enabled.
+
+	void setMaxConcurrentStreams(int maxStreams);
+		/// Sets the maximum number of concurrent streams
+		/// per HTTP/2 connection (SETTINGS_MAX_CONCURRENT_STREAMS).
+		///
+		/// The default is 100.
+
+	int getMaxConcurrentStreams() const;
+		/// Returns the maximum number of concurrent streams
+		/// per HTTP/2 connection.
+
+	void setInitialWindowSize(int size);
+		/// Sets the initial HTTP/2 flow-control window size for
+		/// request bodies, for both streams and the connection.
+		///
+		/// The default is 1048576 (1 MB).
+
+	int getInitialWindowSize() const;
+		/// Returns the initial HTTP/2 flow-control window size.
+
+	void setMaxRequestBodySize(Poco::Int64 size);
+		/// Sets the maximum size of a HTTP/2 request body.
+		///
+		/// HTTP/2 request bodies are buffered in memory until the
+		/// request is complete. A stream whose body exceeds this
+		/// size is reset with RST_STREAM (CANCEL). A value of 0
+		/// disables the limit.
+		///
+		/// The default is 16777216 (16 MB).
+
+	Poco::Int64 getMaxRequestBodySize() const;
+		/// Returns the maximum size of a HTTP/2 request body.
+
 protected:
 	virtual ~HTTPServerParams();
 		/// Destroys the HTTPServerParams.
@@ -115,6 +206,14 @@ private:
 	int            _maxKeepAliveRequests;
 	Poco::Timespan _keepAliveTimeout;
 	bool           _autoDecodeHeaders;
+	std::streamsize _bufferSize;
+	int            _maxHeaderFields;
+	std::size_t    _maxHeaderSize;
+	HTTPFileCache::Ptr _pFileCache;
+	bool           _http2Enabled;
+	int            _maxConcurrentStreams;
+	int            _initialWindowSize;
+	Poco::Int64    _maxRequestBodySize;
 };
 
 
@@ -163,6 +262,54 @@ inline bool HTTPServerParams::getAutoDecodeHeaders() const
 }
 
 
+inline std::streamsize HTTPServerParams::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
+inline int HTTPServerParams::getMaxHeaderFields() const
+{
+	return _maxHeaderFields;
+}
+
+
+inline std::size_t HTTPServerParams::getMaxHeaderSize() const
+{
+	return _maxHeaderSize;
+}
+
+
+inline HTTPFileCache::Ptr HTTPServerParams::getFileCache() const
+{
+	return _pFileCache;
+}
+
+
+inline bool HTTPServerParams::getHTTP2Enabled() const
+{
+	return _http2Enabled;
+}
+
+
+inline int HTTPServerParams::getMaxConcurrentStreams() const
+{
+	return _maxConcurrentStreams;
+}
+
+
+inline int HTTPServerParams::getInitialWindowSize() const
+{
+	return _initialWindowSize;
+}
+
+
+inline Poco::Int64 HTTPServerParams::getMaxRequestBodySize() const
+{
+	return _maxRequestBodySize;
+}
+
+
 } // namespace Poco::Net
 
 
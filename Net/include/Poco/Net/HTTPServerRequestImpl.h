@@ -31,6 +31,7 @@ namespace Poco::Net {
 
 
 class HTTPServerSession;
+class HTTPReactorServerSession;
 class HTTPServerParams;
 class StreamSocket;
 
@@ -47,6 +48,11 @@ public:
 		/// Creates the HTTPServerRequestImpl, using the
 		/// given HTTPServerSession.
 
+	HTTPServerRequestImpl(HTTPServerResponseImpl& response, HTTPReactorServerSession& session, HTTPServerParams* pParams);
+		/// Creates the HTTPServerRequestImpl, taking the request
+		/// line and header fields from the session's HTTPRequestParser
+		/// instead of parsing them again from the session stream.
+
 	~HTTPServerRequestImpl();
 		/// Destroys the HTTPServerRequestImpl.
 
@@ -86,6 +92,8 @@ public:
 		/// Returns the underlying HTTPServerSession.
 
 private:
+	void init();
+
 	HTTPServerResponseImpl&         _response;
 	HTTPSession&              _session;
 	std::istream*                   _pStream;
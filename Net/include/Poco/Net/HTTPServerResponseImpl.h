@@ -21,6 +21,8 @@
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/Net.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/FileStream.h"
+#include <memory>
 
 
 namespace Poco::Net {
@@ -70,6 +72,16 @@ public:
 		/// Must not be called after send(), sendBuffer()
 		/// or redirect() has been called.
 		///
+		/// If a HTTPFileCache has been set in the server's
+		/// HTTPServerParams, the open file and its headers are
+		/// taken from the cache, an ETag header is added, and a
+		/// request with a matching If-None-Match header is answered
+		/// with 304 Not Modified.
+		///
+		/// With a HTTPReactorServer, the file is sent without
+		/// blocking the reactor thread; the transfer may still be
+		/// in progress when this method returns.
+		///
 		/// Throws a FileNotFoundException if the file
 		/// cannot be found, or an OpenFileException if
 		/// the file cannot be opened.
@@ -110,6 +122,8 @@ protected:
 	void attachRequest(HTTPServerRequestImpl* pRequest);
 
 private:
+	void sendFileContent(const std::shared_ptr<Poco::FileInputStream>& pStream, std::streamsize length);
+
 	HTTPSession& _session;
 	HTTPServerRequestImpl* _pRequest;
 	std::ostream*      _pStream;
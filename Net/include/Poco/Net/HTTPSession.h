@@ -62,6 +62,20 @@ public:
 	Poco::Timespan getTimeout() const;
 		/// Returns the timeout for the HTTP session.
 
+	void setBufferSize(std::streamsize size);
+		/// Sets the size of the session's receive buffer and of
+		/// the buffers of HTTP streams subsequently created for
+		/// the session. The default is HTTPBufferAllocator::BUFFER_SIZE.
+		///
+		/// Larger buffers reduce the number of system calls
+		/// needed for large request or response bodies.
+		///
+		/// Throws an IllegalStateException if the receive buffer
+		/// holds data that has not been read yet.
+
+	std::streamsize getBufferSize() const;
+		/// Returns the buffer size.
+
 	void setConnectTimeout(const Poco::Timespan& timeout);
 		/// Sets the connect timeout.
 
@@ -236,6 +250,7 @@ private:
 	char*            _pBuffer;
 	char*            _pCurrent;
 	char*            _pEnd;
+	std::streamsize  _bufferSize;
 	bool             _keepAlive;
 	Poco::Timespan   _connectionTimeout;
 	Poco::Timespan   _receiveTimeout;
@@ -261,6 +276,12 @@ inline bool HTTPSession::getKeepAlive() const
 }
 
 
+inline std::streamsize HTTPSession::getBufferSize() const
+{
+	return _bufferSize;
+}
+
+
 inline Poco::Timespan HTTPSession::getTimeout() const
 {
 	return _receiveTimeout;
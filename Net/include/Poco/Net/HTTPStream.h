@@ -20,7 +20,6 @@
 
 #include "Poco/Net/Net.h"
 #include "Poco/Net/HTTPBasicStreamBuf.h"
-#include "Poco/MemoryPool.h"
 #include <cstddef>
 #include <istream>
 #include <ostream>
@@ -75,9 +74,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -90,9 +86,6 @@ public:
 
 	void* operator new(std::size_t size);
 	void operator delete(void* ptr);
-
-private:
-	static Poco::MemoryPool _pool;
 };
 
 
@@ -23,6 +23,7 @@
 #include <ostream>
 #include <istream>
 #include <vector>
+#include <string_view>
 
 
 namespace Poco::Net {
@@ -86,6 +87,15 @@ public:
 		/// Throws a MessageException if the input stream is
 		/// malformed.
 
+	void readField(std::string_view name, std::string_view value);
+		/// Adds a header field that has already been split into
+		/// name and value by an external parser (e.g. HTTPRequestParser).
+		///
+		/// The same field limits and automatic decoding as in read()
+		/// are applied. Trailing whitespace is removed from the value.
+		///
+		/// Throws a MessageException if a limit is exceeded.
+
 	void setAutoDecode(bool convert);
 		/// Enables or disables automatic conversion of HTTP header values
 		/// when reading HTTP header.
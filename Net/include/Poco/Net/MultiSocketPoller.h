@@ -48,7 +48,7 @@ public:
 	MultiSocketPoller(typename UDPHandlerImpl<S>::List& handlers, const UDPServerParams& serverParams):
 		_address(serverParams.address()),
 		_timeout(serverParams.timeout()),
-		_reader(handlers)
+		_reader(handlers, serverParams)
 		/// Creates the MutiSocketPoller.
 	{
 		poco_assert (_address.port() > 0 && _address.host().toString() != "0.0.0.0");
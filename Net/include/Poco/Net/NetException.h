@@ -42,6 +42,7 @@ POCO_DECLARE_EXCEPTION(Net_API, MultipartException, MessageException)
 POCO_DECLARE_EXCEPTION(Net_API, HTTPException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, NotAuthenticatedException, HTTPException)
 POCO_DECLARE_EXCEPTION(Net_API, UnsupportedRedirectException, HTTPException)
+POCO_DECLARE_EXCEPTION(Net_API, HTTP2Exception, HTTPException)
 POCO_DECLARE_EXCEPTION(Net_API, FTPException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, SMTPException, NetException)
 POCO_DECLARE_EXCEPTION(Net_API, POP3Exception, NetException)
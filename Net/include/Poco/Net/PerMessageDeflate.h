@@ -0,0 +1,160 @@
+//
+// PerMessageDeflate.h
+//
+// Library: Net
+// Package: WebSocket
+// Module:  PerMessageDeflate
+//
+// Definition of the PerMessageDeflate class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_PerMessageDeflate_INCLUDED
+#define Net_PerMessageDeflate_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/DeflatingStream.h"
+#include "Poco/InflatingStream.h"
+#include <memory>
+#include <ostream>
+#include <string>
+
+
+namespace Poco::Net {
+
+
+class Net_API PerMessageDeflate
+	/// This class implements the "permessage-deflate" WebSocket
+	/// extension, as specified in RFC 7692, using the zlib
+	/// streams from the Foundation library.
+	///
+	/// It also provides the extension negotiation for the
+	/// WebSocket opening handshake.
+	///
+	/// Compression and decompression use separate zlib streams,
+	/// so compress() and decompress() can be called from different
+	/// threads. Neither of them must be called concurrently from
+	/// more than one thread.
+	///
+	/// Unless context takeover has been disabled, the zlib streams
+	/// are kept for the lifetime of the connection, which requires
+	/// about 300 KB of memory per connection in total.
+{
+public:
+	enum
+	{
+		MIN_WINDOW_BITS = 9,
+			/// zlib does not support a window size of 8 bits
+			/// for raw deflate streams.
+		MAX_WINDOW_BITS = 15
+	};
+
+	struct Parameters
+		/// The extension parameters negotiated in the handshake.
+	{
+		bool serverNoContextTakeover = false;
+		bool clientNoContextTakeover = false;
+		int serverMaxWindowBits = MAX_WINDOW_BITS;
+		int clientMaxWindowBits = MAX_WINDOW_BITS;
+	};
+
+	PerMessageDeflate(const Parameters& params, bool server);
+		/// Creates the PerMessageDeflate using the given parameters,
+		/// for the server side or client side of a connection.
+
+	~PerMessageDeflate();
+		/// Destroys the PerMessageDeflate.
+
+	void compress(const char* data, std::size_t length, std::string& compressed);
+		/// Compresses the given message and stores the
+		/// compressed payload in compressed.
+
+	void decompress(const char* data, std::size_t length, bool final, std::string& decompressed, std::size_t maxLength);
+		/// Decompresses the given payload of a compressed message,
+		/// and appends the result to decompressed. The payload can
+		/// be given in fragments; final must be true for the last
+		/// fragment of a message.
+		///
+		/// Throws a WebSocketException (WS_ERR_PAYLOAD_TOO_BIG) if
+		/// decompressed would grow beyond maxLength bytes, or a
+		/// WebSocketException (WS_ERR_DECOMPRESSION_FAILED) if
+		/// the payload cannot be decompressed.
+
+	const Parameters& parameters() const;
+		/// Returns the negotiated parameters.
+
+	static std::string offer();
+		/// Returns the extension offer sent by a client in the
+		/// Sec-WebSocket-Extensions header.
+
+	static bool negotiate(const std::string& offers, Parameters& params, std::string& response);
+		/// Finds the first acceptable "permessage-deflate" offer in the
+		/// given Sec-WebSocket-Extensions header value sent by a client.
+		///
+		/// If there is one, stores the negotiated parameters in params,
+		/// the extension response for the server's Sec-WebSocket-Extensions
+		/// header in response, and returns true. Otherwise, returns false.
+
+	static bool accept(const std::string& response, Parameters& params);
+		/// Parses the Sec-WebSocket-Extensions header value sent by
+		/// a server in response to offer().
+		///
+		/// Returns true and stores the parameters in params if the
+		/// server has accepted the extension, or false otherwise.
+		/// Throws a WebSocketException (WS_ERR_HANDSHAKE_EXTENSION)
+		/// if the response is not valid.
+
+	static const std::string EXTENSION_NAME;
+		/// The extension name ("permessage-deflate").
+
+private:
+	class StringStreamBuf: public std::streambuf
+		/// Appends all data written to a std::string.
+	{
+	public:
+		void setTarget(std::string* pTarget, std::size_t maxLength);
+		bool exceeded() const;
+
+	protected:
+		int_type overflow(int_type c) override;
+		std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+	private:
+		std::string* _pTarget = nullptr;
+		std::size_t _maxLength = 0;
+		bool _exceeded = false;
+	};
+
+	PerMessageDeflate(const PerMessageDeflate&) = delete;
+	PerMessageDeflate& operator = (const PerMessageDeflate&) = delete;
+
+	Parameters _params;
+	bool _server;
+	StringStreamBuf _deflatedBuf;
+	std::ostream _deflated;
+	std::unique_ptr<Poco::DeflatingOutputStream> _pDeflater;
+	StringStreamBuf _inflatedBuf;
+	std::ostream _inflated;
+	std::unique_ptr<Poco::InflatingOutputStream> _pInflater;
+};
+
+
+//
+// inlines
+//
+inline const PerMessageDeflate::Parameters& PerMessageDeflate::parameters() const
+{
+	return _params;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // Net_PerMessageDeflate_INCLUDED
@@ -258,6 +258,18 @@
 #endif
 
 
+#if (POCO_OS == POCO_OS_LINUX) && !defined(POCO_NET_NO_MMSG)
+	#define POCO_HAVE_MMSG 1
+	#include <netinet/udp.h>
+	#ifndef UDP_SEGMENT
+		#define UDP_SEGMENT 103
+	#endif
+	#ifndef UDP_GRO
+		#define UDP_GRO 104
+	#endif
+#endif
+
+
 #if defined(POCO_HAVE_ADDRINFO)
 	#ifndef AI_PASSIVE
 		#define AI_PASSIVE 0
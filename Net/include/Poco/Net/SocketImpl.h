@@ -279,6 +279,40 @@ public:
 		///
 		/// Returns the number of bytes received.
 
+	int sendBatch(const SocketBufVec& buffers, const SocketAddress* pAddresses, int flags = 0);
+		/// Sends each buffer as a separate datagram. If pAddresses is
+		/// not null, it must point to an array of buffers.size() addresses,
+		/// and each datagram is sent to the corresponding address.
+		/// Otherwise, the socket must be connected.
+		///
+		/// On platforms supporting it, all datagrams are sent with
+		/// a single call to sendmmsg().
+		///
+		/// Returns the number of datagrams sent, which may be less
+		/// than the number of buffers, or -1 if the socket is
+		/// non-blocking and no datagram could be sent.
+
+	int receiveBatch(SocketBufVec& buffers, int* pLengths, struct sockaddr** ppSA, poco_socklen_t** ppSALen, int* pSegmentSizes = nullptr, int flags = 0);
+		/// Receives up to buffers.size() datagrams, each one
+		/// into the corresponding buffer. The length of each received
+		/// datagram is stored in pLengths.
+		///
+		/// ppSA and ppSALen must point to arrays of buffers.size()
+		/// pointers to the storage for the native sender addresses
+		/// and their lengths. On input, each length must hold the size
+		/// of the address storage.
+		///
+		/// If pSegmentSizes is not null, the GRO segment size of each
+		/// datagram is stored there (or 0 if the received data has not
+		/// been coalesced). See DatagramSocket::setReceiveOffload().
+		///
+		/// On platforms supporting it, the datagrams are received with
+		/// a single call to recvmmsg(), which waits for the first datagram
+		/// only. Otherwise, a single datagram is received.
+		///
+		/// Returns the number of datagrams received, or -1 if the
+		/// socket is non-blocking and no datagram is available.
+
 	virtual void sendUrgent(unsigned char data);
 		/// Sends one byte of urgent data through
 		/// the socket.
@@ -290,8 +324,7 @@ public:
 
 	virtual std::streamsize sendFile(Poco::FileInputStream& FileInputStream, std::streamoff offset = 0, std::streamsize count = 0);
 		/// Sends the contents of a file over the socket, using operating
-		/// system-specific APIs, if available. The socket must not have
-		/// been set to non-blocking.
+		/// system-specific APIs, if available.
 		///
 		/// If count is != 0, sends the given number of bytes, otherwise
 		/// sends all bytes, starting from the given offset.
@@ -307,9 +340,15 @@ public:
 		/// Returns the number of bytes sent, which should be the same
 		/// as count, unless count is 0.
 		///
+		/// If the socket has been set to non-blocking, sends as many
+		/// bytes as the socket accepts without blocking and returns
+		/// the number of bytes sent, which may be less than requested.
+		/// The caller is expected to continue with the remaining part
+		/// (at offset + returned value) once the socket becomes writable
+		/// again. Returns -1 if no data could be sent because the
+		/// operation would block.
+		///
 		/// Throws NetException (or a subclass) in case of any errors.
-		/// Also throws a NetException if the socket has been set to
-		/// non-blocking.
 
 	virtual int available();
 		/// Returns the number of bytes available that can be read
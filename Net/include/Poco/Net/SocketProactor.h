@@ -24,6 +24,7 @@
 #include "Poco/Runnable.h"
 #include "Poco/Timespan.h"
 #include "Poco/Timestamp.h"
+#include "Poco/TimerWheel.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Mutex.h"
 #include "Poco/Activity.h"
@@ -50,14 +51,36 @@ namespace Net {
 
 class Socket;
 class Worker;
+class IOUring;
 
 
 class Net_API SocketProactor final: public Poco::Runnable
 	/// This class implements the proactor pattern.
 	/// It may also contain a simple work executor (enabled by default),
 	/// which executes submitted workload.
+	///
+	/// Two I/O backends are available. The readiness backend
+	/// polls the registered sockets through a PollSet and performs
+	/// the I/O when a socket becomes ready. On Linux, if the kernel
+	/// supports it, the io_uring backend submits the I/O operations
+	/// as true asynchronous requests and reaps their completions
+	/// in batches, so that a single system call both submits all
+	/// queued operations and collects the finished ones.
+	///
+	/// By default, the readiness backend is used; io_uring must be
+	/// requested explicitly at construction time, with either
+	/// IO_BACKEND_IO_URING or IO_BACKEND_DEFAULT. The io_uring
+	/// backend can be excluded from the build by defining
+	/// POCO_NET_NO_IO_URING.
 {
 public:
+	enum IOBackend
+	{
+		IO_BACKEND_DEFAULT,  /// io_uring if available, readiness polling otherwise
+		IO_BACKEND_POLL,     /// readiness polling through PollSet
+		IO_BACKEND_IO_URING  /// io_uring (Linux only)
+	};
+
 	using Buffer = std::vector<std::uint8_t>;
 	using Work = std::function<void()>;
 	using Callback = std::function<void (const std::error_code& failure, int bytesReceived)>;
@@ -69,10 +92,17 @@ public:
 	static const Timestamp::TimeDiff PERMANENT_COMPLETION_HANDLER;
 
 	explicit SocketProactor(bool worker = true);
-		/// Creates the SocketProactor.
+		/// Creates the SocketProactor, using the readiness backend.
 
 	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true);
-		/// Creates the SocketProactor, using the given timeout.
+		/// Creates the SocketProactor, using the given timeout
+		/// and the readiness backend.
+
+	SocketProactor(const Poco::Timespan& timeout, bool worker, IOBackend backend);
+		/// Creates the SocketProactor, using the given timeout and I/O backend.
+		///
+		/// Throws a NotImplementedException if IO_BACKEND_IO_URING
+		/// is requested, but io_uring is not available.
 
 	SocketProactor(const SocketProactor&) = delete;
 	SocketProactor(SocketProactor&&) = delete;
@@ -157,6 +187,14 @@ public:
 	Poco::Timespan getTimeout() const;
 		/// Returns the timeout.
 
+	Poco::TimerWheel& timers();
+		/// Returns the TimerWheel driven by the SocketProactor.
+		///
+		/// Timer callbacks are invoked in the proactor thread, from
+		/// poll(). The proactor never sleeps past the expiry of the
+		/// next timer, so timers can be used for per-operation and
+		/// per-connection timeouts.
+
 	void addSocket(const Socket& sock, int mode);
 		/// Adds the socket to the poll set.
 
@@ -182,6 +220,11 @@ public:
 
 	void addReceive(Socket sock, Buffer& buf, Callback&& onCompletion);
 		/// Adds the stream socket and the completion handler to the I/O receive queue.
+		///
+		/// With the readiness backend, the buffer is enlarged to hold
+		/// all the available data. With the io_uring backend, the data
+		/// is received directly into the buffer, which is only resized
+		/// if it is empty.
 
 	void addSend(Socket sock, const Buffer& message, Callback&& onCompletion);
 		/// Adds the stream socket and the completion handler to the I/O send queue.
@@ -201,6 +244,14 @@ public:
 	bool ioCompletionInProgress() const;
 		/// Returns true if there are not executed handlers from last IO.
 
+	IOBackend backend() const;
+		/// Returns the I/O backend in use, either IO_BACKEND_POLL
+		/// or IO_BACKEND_IO_URING.
+
+	static bool hasIOUring();
+		/// Returns true if the io_uring backend has been built
+		/// and is supported by the running kernel.
+
 private:
 	void onShutdown();
 		/// Called when the SocketProactor is about to terminate.
@@ -212,6 +263,9 @@ private:
 		/// If expiredOnly is true, only expired temporary functions
 		/// are called.
 
+	void init(IOBackend backend);
+		/// Creates the io_uring engine, if requested and available.
+
 	using MutexType = Poco::Mutex;
 	using ScopedLock = MutexType::ScopedLock;
 
@@ -229,6 +283,10 @@ private:
 		bool _owner = false;
 	};
 
+	void addHandler(Socket& sock, std::unique_ptr<Handler> pHandler, bool write);
+		/// Adds the handler to the read or write handler queue
+		/// of the active backend.
+
 	class IONotification: public Notification
 		/// IONotification object is used to transfer
 		/// the I/O completion handlers into the
@@ -446,6 +504,7 @@ private:
 	long              _timeout;
 	long              _maxTimeout;
 	PollSet           _pollSet;
+	Poco::TimerWheel  _timers;
 	Poco::Thread*     _pThread;
 
 	SubscriberMap _readHandlers;
@@ -455,7 +514,9 @@ private:
 	Poco::Mutex   _readMutex;
 
 	std::unique_ptr<Worker> _pWorker;
+	std::unique_ptr<IOUring> _pIOUring;
 	friend class Worker;
+	friend class IOUring;
 };
 
 //
@@ -497,6 +558,18 @@ inline bool SocketProactor::isRunning() const
 }
 
 
+inline Poco::TimerWheel& SocketProactor::timers()
+{
+	return _timers;
+}
+
+
+inline SocketProactor::IOBackend SocketProactor::backend() const
+{
+	return _pIOUring ? IO_BACKEND_IO_URING : IO_BACKEND_POLL;
+}
+
+
 } } // namespace Poco::Net
 
 
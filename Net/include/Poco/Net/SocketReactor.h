@@ -25,6 +25,7 @@
 #include "Poco/Net/PollSet.h"
 #include "Poco/Runnable.h"
 #include "Poco/Timespan.h"
+#include "Poco/TimerWheel.h"
 #include "Poco/Observer.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Event.h"
@@ -88,7 +89,9 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// TimeoutNotification will be dispatched to all event handlers
 	/// registered for it. This is done in the onTimeout() method
 	/// which can be overridden by subclasses to perform custom
-	/// timeout processing.
+	/// timeout processing. Timers scheduled on the TimerWheel may
+	/// shorten individual polls; the TimeoutNotification is then
+	/// dispatched once no socket event has occurred for the poll timeout.
 	///
 	/// By default, the SocketReactor is configured to start sleeping
 	/// when the poll timeout is zero and there are no socket events for
@@ -210,6 +213,20 @@ public:
 	const Poco::Timespan& getTimeout() const;
 		/// Returns the timeout.
 
+	Poco::TimerWheel& timers();
+		/// Returns the TimerWheel driven by the SocketReactor.
+		///
+		/// Timer callbacks are invoked in the reactor thread, so they
+		/// can safely access the state of event handlers. This is the
+		/// preferred way to implement per-connection timeouts, as
+		/// scheduling and rescheduling a timer takes constant time:
+		///
+		///     _idleTimer = reactor.timers().schedule(Timespan(30, 0), [this]() { onIdle(); });
+		///     ...
+		///     reactor.timers().reschedule(_idleTimer, Timespan(30, 0));
+		///
+		/// Timers are only serviced while the reactor is running.
+
 	void addEventHandler(const Socket& socket, const Poco::AbstractObserver& observer);
 		/// Registers an event handler with the SocketReactor.
 		///
@@ -321,6 +338,7 @@ private:
 	NotificationPtr   _pShutdownNotification;
 	MutexType         _mutex;
 	Poco::Event       _event;
+	Poco::TimerWheel  _timers;
 
 	friend class SocketNotifier;
 };
@@ -366,6 +384,12 @@ inline const SocketReactor::Params& SocketReactor::getParams() const
 }
 
 
+inline Poco::TimerWheel& SocketReactor::timers()
+{
+	return _timers;
+}
+
+
 inline int SocketReactor::getThreadAffinity() const
 {
 	return _threadAffinity;
@@ -21,6 +21,7 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/BufferedBidirectionalStreamBuf.h"
+#include "Poco/SlabAllocator.h"
 #include <istream>
 #include <ostream>
 
@@ -31,8 +32,13 @@ namespace Poco::Net {
 class StreamSocketImpl;
 
 
-class Net_API SocketStreamBuf: public Poco::BufferedBidirectionalStreamBuf
+using SocketBasicStreamBuf = Poco::BasicBufferedBidirectionalStreamBuf<char, std::char_traits<char>, Poco::SlabBufferAllocator<char>>;
+
+
+class Net_API SocketStreamBuf: public SocketBasicStreamBuf
 	/// This is the streambuf class used for reading from and writing to a socket.
+	///
+	/// The stream buffers are obtained from the Poco::SlabAllocator.
 {
 public:
 	SocketStreamBuf(const Socket& socket);
@@ -270,8 +270,7 @@ public:
 
 	std::streamsize sendFile(Poco::FileInputStream& FileInputStream, std::streamoff offset = 0, std::streamsize count = 0);
 		/// Sends the contents of a file over the socket, using operating
-		/// system-specific APIs, if available. The socket must not have
-		/// been set to non-blocking.
+		/// system-specific APIs, if available.
 		///
 		/// If count is != 0, sends the given number of bytes, otherwise
 		/// sends all bytes, starting from the given offset.
@@ -287,9 +286,15 @@ public:
 		/// Returns the number of bytes sent, which should be the same
 		/// as count, unless count is 0.
 		///
+		/// If the socket has been set to non-blocking, sends as many
+		/// bytes as the socket accepts without blocking and returns
+		/// the number of bytes sent, which may be less than requested.
+		/// The caller is expected to continue with the remaining part
+		/// (at offset + returned value) once the socket becomes writable
+		/// again. Returns -1 if no data could be sent because the
+		/// operation would block.
+		///
 		/// Throws NetException (or a subclass) in case of any errors.
-		/// Also throws a NetException if the socket has been set to 
-		/// non-blocking.
 
 	StreamSocket(SocketImpl* pImpl);
 		/// Creates the Socket and attaches the given SocketImpl.
@@ -8,6 +8,7 @@
 #include "Poco/Net/TCPServerParams.h"
 #include "Poco/ThreadPool.h"
 #include <atomic>
+#include <memory>
 #include <vector>
 
 namespace Poco::Net {
@@ -21,6 +22,16 @@ class Net_API TCPReactorServer
 	/// and a TCPReactorAcceptor. The SocketReactor handles the event
 	/// loop, while the TCPReactorAcceptor accepts incoming connections
 	/// and creates TCPReactorServerConnection objects to handle them.
+	///
+	/// One listening socket, reactor and acceptor is created for each
+	/// acceptor configured in TCPServerParams (see setAcceptorNum()).
+	/// All listening sockets are bound to the same address with
+	/// SO_REUSEPORT, so the kernel distributes incoming connections
+	/// among them. If the acceptor's own reactor is used for its
+	/// connections (see setUseSelfReactor()), every connection is
+	/// served by the thread that accepted it and never crosses threads.
+	/// Reactor threads can be pinned to CPU cores with
+	/// TCPServerParams::setThreadAffinity().
 {
 public:
 	TCPReactorServer(int port, TCPServerParams::Ptr pParams);
@@ -44,11 +55,19 @@ public:
 
 	int port() const { return _port; }
 
+	int acceptors() const { return static_cast<int>(_acceptors.size()); }
+		/// Returns the number of acceptors (shards) of the server.
+
 	void setRecvMessageCallback(const RecvMessageCallback& cb);
+		/// Sets the callback invoked for received data on all acceptors.
+
+	void setRecvMessageCallback(int acceptor, const RecvMessageCallback& cb);
+		/// Sets the callback invoked for received data on connections
+		/// accepted by the given acceptor only.
 
 private:
 	ThreadPool                                       _threadPool;
-	std::vector<SocketReactor>                       _reactors;
+	std::vector<std::unique_ptr<SocketReactor>>      _reactors;
 	std::vector<std::shared_ptr<TCPReactorAcceptor>> _acceptors;
 	std::vector<ServerSocket>                        _sockets;
 	TCPServerParams::Ptr                             _pParams;
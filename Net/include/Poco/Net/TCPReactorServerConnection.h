@@ -4,6 +4,9 @@
 #include "Poco/Net/Net.h"
 #include "Poco/Net/SocketReactor.h"
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Any.h"
+#include "Poco/FileStream.h"
+#include <memory>
 #include <string>
 #include <functional>
 
@@ -24,6 +27,7 @@ public:
 	void initialize();
 
 	void onRead(const AutoPtr<ReadableNotification>& pNf);
+	void onWritable(const AutoPtr<WritableNotification>& pNf);
 	void onError(const AutoPtr<ErrorNotification>& pNf);
 	void onShutdown(const AutoPtr<ShutdownNotification>& pNf);
 
@@ -31,13 +35,43 @@ public:
 	const StreamSocket& socket();
 	std::string& buffer();
 
+	Poco::Any& context();
+		/// Returns protocol-specific state that lives as long as
+		/// the connection (e.g. the state of an incremental parser).
+
 	void setRecvMessageCallback(const RecvMessageCallback& cb);
 
+	void sendFile(const std::shared_ptr<Poco::FileInputStream>& pStream, std::streamoff offset, std::streamsize count);
+		/// Sends count bytes of the given file, starting at offset,
+		/// using the operating system's zero-copy sendfile API if available.
+		///
+		/// The socket is switched to non-blocking mode for the transfer.
+		/// Whatever the socket does not accept immediately is sent from
+		/// the reactor thread as the socket becomes writable, so large
+		/// files do not block the reactor. While the transfer is pending,
+		/// received data is buffered but the receive callback is not
+		/// invoked; it is invoked once the transfer has completed and
+		/// buffered data is available.
+		///
+		/// Throws a NetException (or a subclass) if the transfer fails
+		/// before control is returned to the caller.
+
+	bool sendPending() const;
+		/// Returns true if a file transfer started with sendFile()
+		/// has not completed yet.
+
 private:
+	bool continueSendFile();
+	void finishSendFile();
+
 	Poco::Net::SocketReactor& _reactor;
 	Poco::Net::StreamSocket   _socket;
 	RecvMessageCallback       _rcvCallback;
 	std::string               _buf;
+	Poco::Any                 _context;
+	std::shared_ptr<Poco::FileInputStream> _pPendingFile;
+	std::streamoff            _pendingOffset{0};
+	std::streamsize           _pendingCount{0};
 };
 
 } // namespace Poco::Net
@@ -27,6 +27,7 @@
 #include "Poco/Runnable.h"
 #include "Poco/Thread.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/ActiveThreadPool.h"
 #include <atomic>
 
 
@@ -145,6 +146,23 @@ public:
 		///
 		/// New threads are taken from the given thread pool.
 
+	TCPServer(TCPServerConnectionFactory::Ptr pFactory, Poco::ActiveThreadPool& threadPool, const ServerSocket& socket, TCPServerParams::Ptr pParams = nullptr);
+		/// Creates the TCPServer, using the given ServerSocket.
+		///
+		/// The server takes ownership of the TCPServerConnectionFactory
+		/// and deletes it when it's no longer needed.
+		///
+		/// The server also takes ownership of the TCPServerParams object.
+		/// If no TCPServerParams object is given, the server's TCPServerDispatcher
+		/// creates its own one.
+		///
+		/// Every accepted connection is handed to the given thread pool as a
+		/// separate task, instead of going through the dispatcher's connection
+		/// queue. With a pool using the ActiveThreadPool::SCHEDULING_WORK_STEALING
+		/// policy, dispatching a connection does not acquire any lock.
+		///
+		/// The thread pool must outlive the server.
+
 	virtual ~TCPServer();
 		/// Destroys the TCPServer and its TCPServerConnectionFactory.
 
@@ -25,6 +25,7 @@
 #include "Poco/Runnable.h"
 #include "Poco/NotificationQueue.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/ActiveThreadPool.h"
 #include "Poco/Mutex.h"
 #include <atomic>
 
@@ -44,6 +45,19 @@ public:
 		/// If no TCPServerParams object is supplied, the TCPServerDispatcher
 		/// creates one.
 
+	TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::ActiveThreadPool& threadPool, TCPServerParams::Ptr pParams);
+		/// Creates the TCPServerDispatcher.
+		///
+		/// Every connection is started as a separate task in the
+		/// given ActiveThreadPool, instead of being queued in the
+		/// dispatcher's connection queue. The maximum number of queued
+		/// connections still applies, and counts connections started
+		/// in the thread pool that are still waiting for a thread.
+		///
+		/// The dispatcher takes ownership of the TCPServerParams object.
+		/// If no TCPServerParams object is supplied, the TCPServerDispatcher
+		/// creates one.
+
 	void duplicate();
 		/// Increments the object's reference count.
 
@@ -95,6 +109,10 @@ protected:
 	void endConnection();
 		/// Updates the performance counters.
 
+	void runConnection(const StreamSocket& socket);
+		/// Creates and runs the connection for the given socket,
+		/// unless the dispatcher has been stopped.
+
 private:
 	TCPServerDispatcher();
 	TCPServerDispatcher(const TCPServerDispatcher&);
@@ -110,8 +128,12 @@ private:
 	std::atomic<bool>  _stopped;
 	Poco::NotificationQueue         _queue;
 	TCPServerConnectionFactory::Ptr _pConnectionFactory;
-	Poco::ThreadPool&               _threadPool;
+	Poco::ThreadPool*               _pThreadPool;
+	Poco::ActiveThreadPool*         _pActiveThreadPool;
+	std::atomic<int>                _queuedConnections;
 	mutable Poco::FastMutex         _mutex;
+
+	friend class TCPConnectionTask;
 };
 
 
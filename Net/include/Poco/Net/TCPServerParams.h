@@ -23,6 +23,7 @@
 #include "Poco/Timespan.h"
 #include "Poco/Thread.h"
 #include "Poco/AutoPtr.h"
+#include <vector>
 
 
 namespace Poco::Net {
@@ -116,6 +117,23 @@ public:
 		///
 		/// If true, use acceptor's self reactor, else create {_maxThreads} threads to use
 
+	void setThreadAffinity(const std::vector<int>& cpus);
+		/// Sets the CPU cores the acceptor reactor threads are pinned to.
+		///
+		/// The reactor of acceptor n runs on core cpus[n % cpus.size()].
+		/// Combined with setUseSelfReactor(true), this gives a shared-nothing
+		/// thread-per-core server where each core owns its listening socket
+		/// and all connections accepted on it.
+		///
+		/// The default is an empty vector, which disables pinning.
+
+	const std::vector<int>& getThreadAffinity() const;
+		/// Returns the CPU cores the acceptor reactor threads are pinned to.
+
+	int getThreadAffinity(int acceptor) const;
+		/// Returns the CPU core the reactor of the given acceptor is
+		/// pinned to, or -1 if no affinity has been configured.
+
 protected:
 	virtual ~TCPServerParams();
 		/// Destroys the TCPServerParams.
@@ -129,6 +147,7 @@ private:
 	bool _reactorMode;
 	int _acceptorNum;
 	bool _useSelfReactor;
+	std::vector<int> _threadAffinity;
 };
 
 
@@ -159,6 +178,12 @@ inline Poco::Thread::Priority TCPServerParams::getThreadPriority() const
 }
 
 
+inline const std::vector<int>& TCPServerParams::getThreadAffinity() const
+{
+	return _threadAffinity;
+}
+
+
 } // namespace Poco::Net
 
 
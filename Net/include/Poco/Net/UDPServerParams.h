@@ -63,6 +63,19 @@ public:
 		/// reports backlogs back to the client. Only meaningful
 		/// if notifySender() is true.
 
+	void setBatchSize(int batchSize);
+		/// Sets the maximum number of datagrams the server
+		/// reads from a socket per wakeup. Defaults to 1.
+		///
+		/// With a batch size greater than one, datagrams are
+		/// received with DatagramSocket::receiveBatch(), which
+		/// on Linux needs a single recvmmsg() call for the whole
+		/// batch.
+
+	int batchSize() const;
+		/// Returns the maximum number of datagrams read
+		/// from a socket per wakeup.
+
 private:
 	UDPServerParams();
 
@@ -72,6 +85,7 @@ private:
 	std::size_t              _handlerBufListSize;
 	bool                     _notifySender;
 	int                      _backlogThreshold;
+	int                      _batchSize;
 };
 
 
@@ -115,6 +129,12 @@ inline int UDPServerParams::backlogThreshold() const
 }
 
 
+inline int UDPServerParams::batchSize() const
+{
+	return _batchSize;
+}
+
+
 } // namespace Poco::Net
 
 
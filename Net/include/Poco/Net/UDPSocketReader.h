@@ -24,6 +24,7 @@
 #include "Poco/Net/UDPServerParams.h"
 
 #include <map>
+#include <vector>
 
 namespace Poco::Net {
 
@@ -75,7 +76,8 @@ public:
 	UDPSocketReader(typename UDPHandlerImpl<S>::List& handlers, int backlogThreshold = 0):
 		_handlers(handlers),
 		_handler(_handlers.begin()),
-		_backlogThreshold(backlogThreshold)
+		_backlogThreshold(backlogThreshold),
+		_batchSize(1)
 		/// Creates the UDPSocketReader.
 	{
 		poco_assert(_handler != _handlers.end());
@@ -84,10 +86,21 @@ public:
 	UDPSocketReader(typename UDPHandlerImpl<S>::List& handlers, const UDPServerParams& serverParams):
 		_handlers(handlers),
 		_handler(_handlers.begin()),
-		_backlogThreshold(serverParams.backlogThreshold())
+		_backlogThreshold(serverParams.backlogThreshold()),
+		_batchSize(serverParams.batchSize())
 		/// Creates the UDPSocketReader.
 	{
 		poco_assert(_handler != _handlers.end());
+		poco_assert(_batchSize > 0);
+
+		if (_batchSize > 1)
+		{
+			_batch.reserve(_batchSize);
+			_bufVec.reserve(_batchSize);
+			_lengths.resize(_batchSize);
+			_pSA.reserve(_batchSize);
+			_pAL.reserve(_batchSize);
+		}
 	}
 
 	~UDPSocketReader()
@@ -100,7 +113,16 @@ public:
 		/// Errors are also passed to the handler. If object is configured
 		/// for replying to sender and data or error backlog threshold is
 		/// exceeded, sender is notified of the current backlog size.
+		///
+		/// If the batch size is greater than one, up to batch size
+		/// datagrams are read; see readBatch().
 	{
+		if (_batchSize > 1)
+		{
+			readBatch(sock);
+			return;
+		}
+
 		using RT = typename UDPHandlerImpl<S>::MsgSizeT;
 		char* p = nullptr;
 		struct sockaddr* pSA = nullptr;
@@ -152,6 +174,89 @@ public:
 		handler().notify();
 	}
 
+	void readBatch(DatagramSocket& sock)
+		/// Reads up to batch size datagrams from the socket with
+		/// a single call to DatagramSocket::receiveBatch() and passes
+		/// them on to the next handler. Buffers not filled are
+		/// returned to the handler.
+	{
+		using RT = typename UDPHandlerImpl<S>::MsgSizeT;
+		const Poco::UInt16 off = UDPHandlerImpl<S>::offset();
+		poco_socket_t sockfd = sock.impl()->sockfd();
+		nextHandler();
+		_batch.clear();
+		_bufVec.clear();
+		_pSA.clear();
+		_pAL.clear();
+		for (std::size_t i = 0; i < static_cast<std::size_t>(_batchSize); ++i)
+		{
+			char* p = handler().next(sockfd);
+			if (!p) break;
+			_batch.push_back(p);
+			_pAL.push_back(reinterpret_cast<poco_socklen_t*>(p + sizeof(RT)));
+			*_pAL.back() = SocketAddress::MAX_ADDRESS_LENGTH;
+			_pSA.push_back(reinterpret_cast<struct sockaddr*>(p + sizeof(RT) + sizeof(poco_socklen_t)));
+			_bufVec.push_back(Socket::makeBuffer(p + off, S - off - 1));
+		}
+		if (_batch.empty()) return;
+
+		std::size_t done = 0;
+		try
+		{
+			int n = sock.receiveBatch(_bufVec, _lengths.data(), _pSA.data(), _pAL.data());
+			if (n < 0)
+			{
+				AtomicCounter::ValueType errors = setError(sockfd, _batch[0], Error::getMessage(Error::last()));
+				done = 1;
+				releaseBatch(done);
+				if (_backlogThreshold > 0 && errors > _backlogThreshold && errors != _errorBacklog[sockfd])
+				{
+					auto err = static_cast<Poco::Int32>(errors);
+					sock.sendTo(&err, sizeof(Poco::Int32), SocketAddress(_pSA[0], *_pAL[0]));
+					_errorBacklog[sockfd] = errors;
+				}
+				return;
+			}
+			while (done < static_cast<std::size_t>(n))
+			{
+				const std::size_t i = done++;
+				char* p = _batch[i];
+				RT ret = _lengths[i];
+				AtomicCounter::ValueType data = handler().setData(p, ret);
+				p[off + ret] = 0; // for ascii convenience, zero-terminate
+				if (_backlogThreshold > 0 && data > _backlogThreshold && data != _dataBacklog[sockfd])
+				{
+					auto d = static_cast<Poco::Int32>(data);
+					sock.sendTo(&d, sizeof(Poco::Int32), SocketAddress(_pSA[i], *_pAL[i]));
+					_dataBacklog[sockfd] = data;
+				}
+			}
+			releaseBatch(done);
+		}
+		catch (Poco::Exception& exc)
+		{
+			if (done < _batch.size())
+			{
+				AtomicCounter::ValueType errors = setError(sockfd, _batch[done], exc.displayText());
+				releaseBatch(done + 1);
+				if (_backlogThreshold > 0 && errors > _backlogThreshold && errors != _errorBacklog[sockfd])
+				{
+					auto err = static_cast<Poco::Int32>(errors);
+					sock.sendTo(&err, sizeof(Poco::Int32), SocketAddress(_pSA[done], *_pAL[done]));
+					_errorBacklog[sockfd] = errors;
+				}
+			}
+		}
+		handler().notify();
+	}
+
+	int batchSize() const
+		/// Returns the maximum number of datagrams
+		/// read per call to read().
+	{
+		return _batchSize;
+	}
+
 	bool handlerStopped() const
 		/// Returns true if all handlers are stopped.
 	{
@@ -199,6 +304,16 @@ private:
 		if (++_handler == _handlers.end()) _handler = _handlers.begin();
 	}
 
+	void releaseBatch(std::size_t from)
+		/// Returns the unused buffers of the current batch,
+		/// starting at index from, to the handler.
+	{
+		for (std::size_t i = from; i < _batch.size(); ++i)
+		{
+			handler().setIdle(_batch[i]);
+		}
+	}
+
 	UDPHandlerImpl<S>& handler()
 		/// Returns the reference to the current handler.
 	{
@@ -215,6 +330,12 @@ private:
 	CounterMap      _dataBacklog;
 	CounterMap      _errorBacklog;
 	int             _backlogThreshold;
+	int             _batchSize;
+	std::vector<char*>            _batch;
+	SocketBufVec                  _bufVec;
+	std::vector<int>              _lengths;
+	std::vector<struct sockaddr*> _pSA;
+	std::vector<poco_socklen_t*>  _pAL;
 };
 
 
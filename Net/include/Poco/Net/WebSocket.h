@@ -57,6 +57,15 @@ class Net_API WebSocket: public StreamSocket
 	/// TCP_NODELAY is automatically enabled on the underlying socket
 	/// to prevent delays from Nagle's algorithm when sending small
 	/// WebSocket frames.
+	///
+	/// The "permessage-deflate" extension (RFC 7692) can be negotiated
+	/// by passing the WS_OPT_PERMESSAGE_DEFLATE option to the constructor.
+	/// If negotiated, complete text and binary frames sent with sendFrame()
+	/// are compressed, and compressed frames are decompressed by
+	/// receiveFrame(), transparently to the application.
+	///
+	/// To serve many connections without dedicating a thread to each
+	/// of them, a WebSocket can be handed over to an AsyncWebSocket.
 {
 public:
 	enum Mode
@@ -130,10 +139,22 @@ public:
 			/// No Sec-WebSocket-Accept header or wrong value.
 		WS_ERR_UNAUTHORIZED                   = 6,
 			/// The server rejected the username or password for authentication.
+		WS_ERR_HANDSHAKE_EXTENSION            = 7,
+			/// Invalid Sec-WebSocket-Extensions header in handshake response.
 		WS_ERR_PAYLOAD_TOO_BIG                = 10,
 			/// Payload too big for supplied buffer.
-		WS_ERR_INCOMPLETE_FRAME               = 11
+		WS_ERR_INCOMPLETE_FRAME               = 11,
 			/// Incomplete frame received.
+		WS_ERR_DECOMPRESSION_FAILED           = 12
+			/// Compressed payload cannot be decompressed.
+	};
+
+	enum Options
+		/// Options for the opening handshake.
+	{
+		WS_OPT_NONE               = 0,
+		WS_OPT_PERMESSAGE_DEFLATE = 1
+			/// Negotiate the "permessage-deflate" extension.
 	};
 
 	WebSocket(HTTPServerRequest& request, HTTPServerResponse& response);
@@ -147,6 +168,14 @@ public:
 		/// Throws an exception if the request is not a proper WebSocket
 		/// upgrade request.
 
+	WebSocket(HTTPServerRequest& request, HTTPServerResponse& response, int options);
+		/// Creates a server-side WebSocket from within a
+		/// HTTPRequestHandler, using the given handshake options
+		/// (see Options).
+		///
+		/// With WS_OPT_PERMESSAGE_DEFLATE, the "permessage-deflate"
+		/// extension is enabled if the client offers it.
+
 	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response);
 		/// Creates a client-side WebSocket, using the given
 		/// HTTPClientSession and HTTPRequest for the initial handshake
@@ -162,6 +191,18 @@ public:
 		/// The HTTPClientSession session object must no longer be used after setting
 		/// up the WebSocket.
 
+	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, int options);
+		/// Creates a client-side WebSocket, using the given
+		/// HTTPClientSession and HTTPRequest for the initial handshake,
+		/// and the given handshake options (see Options).
+		///
+		/// With WS_OPT_PERMESSAGE_DEFLATE, the "permessage-deflate"
+		/// extension is offered to the server. Whether the server
+		/// has accepted it can be determined with compressed().
+		///
+		/// The HTTPClientSession session object must no longer be used after setting
+		/// up the WebSocket.
+
 	WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials);
 		/// Creates a client-side WebSocket, using the given
 		/// HTTPClientSession and HTTPRequest for the initial handshake
@@ -353,6 +394,10 @@ public:
 		/// Returns WS_SERVER if the WebSocket is a server-side
 		/// WebSocket, or WS_CLIENT otherwise.
 
+	bool compressed() const;
+		/// Returns true if the "permessage-deflate" extension
+		/// has been negotiated for the WebSocket.
+
 	void setMaxPayloadSize(int maxPayloadSize);
 		/// Sets the maximum payload size for receiveFrame().
 		///
@@ -367,9 +412,9 @@ public:
 		/// The WebSocket protocol version supported (13).
 
 protected:
-	static WebSocketImpl* accept(HTTPServerRequest& request, HTTPServerResponse& response);
-	static WebSocketImpl* connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials);
-	static WebSocketImpl* completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key);
+	static WebSocketImpl* accept(HTTPServerRequest& request, HTTPServerResponse& response, int options = WS_OPT_NONE);
+	static WebSocketImpl* connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, int options = WS_OPT_NONE);
+	static WebSocketImpl* completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key, int options = WS_OPT_NONE);
 	static std::string computeAccept(const std::string& key);
 	static std::string createKey();
 
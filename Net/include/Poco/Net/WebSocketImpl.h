@@ -19,9 +19,12 @@
 
 
 #include "Poco/Net/StreamSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
 #include "Poco/Buffer.h"
 #include "Poco/Random.h"
 #include "Poco/Buffer.h"
+#include <memory>
+#include <string>
 
 
 namespace Poco::Net {
@@ -103,6 +106,22 @@ public:
 		///
 		/// The default is std::numeric_limits<int>::max().
 
+	void setPerMessageDeflate(PerMessageDeflate* pDeflate);
+		/// Enables the "permessage-deflate" extension, if pDeflate
+		/// is not null. Takes ownership of pDeflate.
+
+	PerMessageDeflate* perMessageDeflate() const;
+		/// Returns the PerMessageDeflate if the "permessage-deflate"
+		/// extension has been negotiated, or null otherwise.
+
+	StreamSocketImpl* streamSocketImpl() const;
+		/// Returns the underlying StreamSocketImpl.
+
+	void drainBuffer(Poco::Buffer<char>& buffer);
+		/// Copies all bytes that have been received, but not yet
+		/// consumed, into buffer, and removes them from the internal
+		/// buffer.
+
 protected:
 	enum
 	{
@@ -134,9 +153,13 @@ protected:
 	int peekHeader(ReceiveState& receiveState);
 	void skipHeader(int headerLength);
 	int receivePayload(char *buffer, int payloadLength, char mask[MASK_LENGTH], bool useMask, int maskOffset);
+	bool mustInflate();
+	int inflatePayload(char* buffer, int payloadLength, int length);
+	int inflatePayload(Poco::Buffer<char>& buffer, std::size_t offset, int payloadLength);
 	int receiveNBytes(void* buffer, int length);
 	int receiveSomeBytes(char* buffer, int length);
 	int peekSomeBytes(char* buffer, int length);
+	static int headerLength(const char* header, int length);
 	virtual ~WebSocketImpl();
 
 private:
@@ -150,6 +173,9 @@ private:
 	ReceiveState _receiveState;
 	SendState _sendState;
 	Poco::Random _rnd;
+	std::unique_ptr<PerMessageDeflate> _pDeflate;
+	bool _inflating;
+	std::string _deflateBuffer;
 };
 
 
@@ -174,6 +200,18 @@ inline int WebSocketImpl::getMaxPayloadSize() const
 }
 
 
+inline PerMessageDeflate* WebSocketImpl::perMessageDeflate() const
+{
+	return _pDeflate.get();
+}
+
+
+inline StreamSocketImpl* WebSocketImpl::streamSocketImpl() const
+{
+	return _pStreamSocketImpl;
+}
+
+
 } // namespace Poco::Net
 
 
@@ -0,0 +1,782 @@
+//
+// AsyncWebSocket.cpp
+//
+// Library: Net
+// Package: WebSocket
+// Module:  AsyncWebSocket
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/AsyncWebSocket.h"
+#include "Poco/Net/WebSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Net/StreamSocketImpl.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Buffer.h"
+#include <cstring>
+
+
+namespace Poco::Net {
+
+
+AsyncWebSocket::AsyncWebSocket(const WebSocket& webSocket, SocketReactor& reactor):
+	_webSocket(webSocket),
+	_pSocketImpl(nullptr),
+	_pDeflate(nullptr),
+	_reactor(reactor),
+	_mustMaskPayload(webSocket.mode() == WebSocket::WS_CLIENT),
+	_secure(webSocket.secure()),
+	_maxPayloadSize(webSocket.getMaxPayloadSize()),
+	_readableObserver(*this, &AsyncWebSocket::onReadable),
+	_writableObserver(*this, &AsyncWebSocket::onWritable),
+	_errorObserver(*this, &AsyncWebSocket::onError),
+	_shutdownObserver(*this, &AsyncWebSocket::onShutdown),
+	_inputOffset(0),
+	_messageFlags(0),
+	_messageCompressed(false),
+	_started(false),
+	_outputOffset(0),
+	_pendingBytes(0),
+	_writableRegistered(false),
+	_open(true),
+	_closeSent(false),
+	_closing(false),
+	_closeStatus(0)
+{
+	WebSocketImpl* pImpl = static_cast<WebSocketImpl*>(_webSocket.impl());
+	_pSocketImpl = pImpl->streamSocketImpl();
+	_pDeflate = pImpl->perMessageDeflate();
+
+	Poco::Buffer<char> buffered(0);
+	pImpl->drainBuffer(buffered);
+	_input.assign(buffered.begin(), buffered.size());
+
+	_webSocket.setBlocking(false);
+}
+
+
+AsyncWebSocket::~AsyncWebSocket()
+{
+	try
+	{
+		_webSocket.close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void AsyncWebSocket::setMessageCallback(const MessageCallback& callback)
+{
+	_messageCallback = callback;
+}
+
+
+void AsyncWebSocket::setCloseCallback(const CloseCallback& callback)
+{
+	_closeCallback = callback;
+}
+
+
+void AsyncWebSocket::setMaxPayloadSize(int maxPayloadSize)
+{
+	poco_assert (maxPayloadSize > 0);
+
+	_maxPayloadSize = maxPayloadSize;
+}
+
+
+void AsyncWebSocket::start()
+{
+	poco_assert (!_started);
+
+	// the reference held by the reactor
+	duplicate();
+	_started = true;
+
+	try
+	{
+		if (!_input.empty() && !processInput()) return;
+	}
+	catch (Poco::Exception& exc)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_closeStatus == 0)
+			{
+				_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+				_closeReason = exc.displayText();
+			}
+		}
+		closeImpl();
+		return;
+	}
+
+	_reactor.addEventHandler(_webSocket, _readableObserver);
+	_reactor.addEventHandler(_webSocket, _errorObserver);
+	_reactor.addEventHandler(_webSocket, _shutdownObserver);
+}
+
+
+bool AsyncWebSocket::sendFrame(const void* buffer, int length, int flags)
+{
+	poco_assert (length >= 0);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (!_open || _closing || _closeSent) return false;
+
+	const char* payload = reinterpret_cast<const char*>(buffer);
+	std::size_t payloadLength = static_cast<std::size_t>(length);
+	flags &= 0xff;
+	int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+	if (_pDeflate && length > 0 && (flags & WebSocket::FRAME_FLAG_FIN) && !(flags & WebSocket::FRAME_FLAG_RSV1) && (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY))
+	{
+		_pDeflate->compress(payload, payloadLength, _compressed);
+		payload = _compressed.data();
+		payloadLength = _compressed.size();
+		flags |= WebSocket::FRAME_FLAG_RSV1;
+	}
+	return queueFrame(payload, payloadLength, flags);
+}
+
+
+bool AsyncWebSocket::sendFrame(const std::string& message, int flags)
+{
+	return sendFrame(message.data(), static_cast<int>(message.size()), flags);
+}
+
+
+bool AsyncWebSocket::shutdown(Poco::UInt16 statusCode, const std::string& statusMessage)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (!_open || _closing || _closeSent) return false;
+
+	std::string payload;
+	payload += static_cast<char>(statusCode >> 8);
+	payload += static_cast<char>(statusCode & 0xff);
+	payload.append(statusMessage, 0, MAX_CONTROL_PAYLOAD_LENGTH - 2);
+	_closeSent = true;
+	return queueFrame(payload.data(), payload.size(), static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_CLOSE));
+}
+
+
+void AsyncWebSocket::close()
+{
+	abort(WebSocket::WS_RESERVED_ABNORMAL_CLOSE, "Connection closed");
+}
+
+
+bool AsyncWebSocket::isOpen() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _open;
+}
+
+
+std::size_t AsyncWebSocket::pendingBytes() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _pendingBytes;
+}
+
+
+void AsyncWebSocket::onReadable(const Poco::AutoPtr<ReadableNotification>& pNf)
+{
+	// closeImpl() may release the last reference
+	Ptr guard(this, true);
+
+	try
+	{
+		char buffer[RECEIVE_BUFFER_SIZE];
+		for (;;)
+		{
+			int n = _pSocketImpl->receiveBytes(buffer, sizeof(buffer));
+			if (n > 0)
+			{
+				_input.append(buffer, n);
+				if (!processInput()) return;
+				// A TLS connection may have buffered more data
+				// than the socket reports as available.
+				if (n < static_cast<int>(sizeof(buffer)) && !_secure) break;
+			}
+			else if (n == 0)
+			{
+				{
+					Poco::FastMutex::ScopedLock lock(_mutex);
+					if (_closeStatus == 0)
+					{
+						_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+						_closeReason = "Connection closed by peer";
+					}
+				}
+				closeImpl();
+				return;
+			}
+			else break;
+		}
+	}
+	catch (WebSocketException& exc)
+	{
+		fail(exc.code() == WebSocket::WS_ERR_PAYLOAD_TOO_BIG ? WebSocket::WS_PAYLOAD_TOO_BIG : WebSocket::WS_PROTOCOL_ERROR, exc.message());
+	}
+	catch (Poco::Exception& exc)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_closeStatus == 0)
+			{
+				_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+				_closeReason = exc.displayText();
+			}
+		}
+		closeImpl();
+	}
+}
+
+
+void AsyncWebSocket::onWritable(const Poco::AutoPtr<WritableNotification>& pNf)
+{
+	Ptr guard(this, true);
+
+	bool mustClose = false;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (!_open) return;
+		try
+		{
+			if (flushOutput())
+			{
+				if (_writableRegistered)
+				{
+					_reactor.removeEventHandler(_webSocket, _writableObserver);
+					_writableRegistered = false;
+				}
+				mustClose = _closing;
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			if (_closeStatus == 0)
+			{
+				_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+				_closeReason = exc.displayText();
+			}
+			mustClose = true;
+		}
+	}
+	if (mustClose) closeImpl();
+}
+
+
+void AsyncWebSocket::onError(const Poco::AutoPtr<ErrorNotification>& pNf)
+{
+	Ptr guard(this, true);
+
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_closeStatus == 0)
+		{
+			_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+			_closeReason = pNf->description();
+		}
+	}
+	closeImpl();
+}
+
+
+void AsyncWebSocket::onShutdown(const Poco::AutoPtr<ShutdownNotification>& pNf)
+{
+	Ptr guard(this, true);
+
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_closeStatus == 0)
+		{
+			_closeStatus = WebSocket::WS_ENDPOINT_GOING_AWAY;
+			_closeReason = "Reactor stopped";
+		}
+	}
+	closeImpl();
+}
+
+
+bool AsyncWebSocket::processInput()
+{
+	for (;;)
+	{
+		std::size_t available = _input.size() - _inputOffset;
+		if (available < 2) break;
+
+		const unsigned char* header = reinterpret_cast<const unsigned char*>(_input.data() + _inputOffset);
+		int flags = header[0];
+		bool useMask = (header[1] & 0x80) != 0;
+		Poco::UInt64 length = header[1] & 0x7f;
+		std::size_t headerLength = 2;
+		if (length == 126)
+		{
+			if (available < 4) break;
+			length = (static_cast<Poco::UInt64>(header[2]) << 8) | header[3];
+			headerLength = 4;
+		}
+		else if (length == 127)
+		{
+			if (available < 10) break;
+			length = 0;
+			for (int i = 2; i < 10; i++)
+			{
+				length = (length << 8) | header[i];
+			}
+			headerLength = 10;
+		}
+		if (length > static_cast<Poco::UInt64>(_maxPayloadSize))
+			throw WebSocketException("Payload too big", WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+		if (useMask) headerLength += 4;
+		if (available < headerLength + length) break;
+
+		char* payload = _input.data() + _inputOffset + headerLength;
+		if (useMask)
+		{
+			const unsigned char* mask = header + headerLength - 4;
+			for (std::size_t i = 0; i < length; i++)
+			{
+				payload[i] ^= mask[i % 4];
+			}
+		}
+		_inputOffset += headerLength + static_cast<std::size_t>(length);
+
+		if (!handleFrame(flags, payload, static_cast<std::size_t>(length))) return false;
+	}
+
+	if (_inputOffset == _input.size())
+	{
+		_input.clear();
+		if (_input.capacity() > MAX_IDLE_BUFFER_SIZE) _input.shrink_to_fit();
+	}
+	else
+	{
+		_input.erase(0, _inputOffset);
+	}
+	_inputOffset = 0;
+	return true;
+}
+
+
+bool AsyncWebSocket::handleFrame(int flags, const char* payload, std::size_t length)
+{
+	int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+	bool fin = (flags & WebSocket::FRAME_FLAG_FIN) != 0;
+	bool compressed = (flags & WebSocket::FRAME_FLAG_RSV1) != 0;
+
+	if ((flags & (WebSocket::FRAME_FLAG_RSV2 | WebSocket::FRAME_FLAG_RSV3)) || (compressed && !_pDeflate))
+	{
+		fail(WebSocket::WS_PROTOCOL_ERROR, "Reserved frame header bits set");
+		return false;
+	}
+
+	if (opcode & 0x08)
+	{
+		// control frames can be interleaved with the
+		// frames of a fragmented message
+		if (!fin || compressed || length > MAX_CONTROL_PAYLOAD_LENGTH)
+		{
+			fail(WebSocket::WS_PROTOCOL_ERROR, "Invalid control frame");
+			return false;
+		}
+		switch (opcode)
+		{
+		case WebSocket::FRAME_OP_PING:
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				if (!_closeSent && !_closing)
+					queueFrame(payload, length, static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_PONG));
+			}
+			return deliver(payload, length, flags);
+		case WebSocket::FRAME_OP_PONG:
+			return deliver(payload, length, flags);
+		case WebSocket::FRAME_OP_CLOSE:
+			{
+				int statusCode = WebSocket::WS_RESERVED_NO_STATUS_CODE;
+				std::string reason;
+				if (length >= 2)
+				{
+					statusCode = (static_cast<unsigned char>(payload[0]) << 8) | static_cast<unsigned char>(payload[1]);
+					reason.assign(payload + 2, length - 2);
+				}
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				if (!_closeSent && !_closing)
+				{
+					// echo the status code
+					queueFrame(payload, length >= 2 ? 2 : 0, static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_CLOSE));
+					_closeSent = true;
+				}
+				if (_closeStatus == 0)
+				{
+					_closeStatus = statusCode;
+					_closeReason = reason;
+				}
+			}
+			closeAfterFlush();
+			return false;
+		default:
+			fail(WebSocket::WS_PROTOCOL_ERROR, "Unknown control frame opcode");
+			return false;
+		}
+	}
+	else if (opcode == WebSocket::FRAME_OP_CONT)
+	{
+		if (_messageFlags == 0 || compressed)
+		{
+			fail(WebSocket::WS_PROTOCOL_ERROR, "Unexpected continuation frame");
+			return false;
+		}
+		if (_message.size() + length > static_cast<std::size_t>(_maxPayloadSize))
+		{
+			fail(WebSocket::WS_PAYLOAD_TOO_BIG, "Payload too big");
+			return false;
+		}
+		_message.append(payload, length);
+	}
+	else if (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY)
+	{
+		if (_messageFlags != 0)
+		{
+			fail(WebSocket::WS_PROTOCOL_ERROR, "Incomplete fragmented message");
+			return false;
+		}
+		if (fin && !compressed)
+		{
+			// the common case: the payload is passed on without copying
+			return deliver(payload, length, flags);
+		}
+		_messageFlags = WebSocket::FRAME_FLAG_FIN | opcode;
+		_messageCompressed = compressed;
+		_message.assign(payload, length);
+	}
+	else
+	{
+		fail(WebSocket::WS_PROTOCOL_ERROR, "Unknown frame opcode");
+		return false;
+	}
+
+	if (!fin) return true;
+
+	int messageFlags = _messageFlags;
+	_messageFlags = 0;
+	bool result;
+	if (_messageCompressed)
+	{
+		_inflated.clear();
+		_pDeflate->decompress(_message.data(), _message.size(), true, _inflated, _maxPayloadSize);
+		result = deliver(_inflated.data(), _inflated.size(), messageFlags);
+		if (_inflated.capacity() > MAX_IDLE_BUFFER_SIZE) std::string().swap(_inflated);
+	}
+	else
+	{
+		result = deliver(_message.data(), _message.size(), messageFlags);
+	}
+	if (_message.capacity() > MAX_IDLE_BUFFER_SIZE) std::string().swap(_message);
+	return result;
+}
+
+
+bool AsyncWebSocket::deliver(const char* data, std::size_t length, int flags)
+{
+	if (_messageCallback)
+	{
+		try
+		{
+			_messageCallback(*this, data, length, flags);
+		}
+		catch (Poco::Exception& exc)
+		{
+			fail(WebSocket::WS_UNEXPECTED_CONDITION, exc.displayText());
+			return false;
+		}
+		catch (std::exception& exc)
+		{
+			fail(WebSocket::WS_UNEXPECTED_CONDITION, exc.what());
+			return false;
+		}
+	}
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _open && !_closing;
+}
+
+
+void AsyncWebSocket::fail(int statusCode, const std::string& reason)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (!_closeSent && !_closing)
+		{
+			std::string payload;
+			payload += static_cast<char>(statusCode >> 8);
+			payload += static_cast<char>(statusCode & 0xff);
+			queueFrame(payload.data(), payload.size(), static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_CLOSE));
+			_closeSent = true;
+		}
+		if (_closeStatus == 0)
+		{
+			_closeStatus = statusCode;
+			_closeReason = reason;
+		}
+	}
+	closeAfterFlush();
+}
+
+
+bool AsyncWebSocket::queueFrame(const char* payload, std::size_t length, int flags)
+{
+	std::string frame;
+	encodeFrame(payload, length, flags, frame);
+	_pendingBytes += frame.size();
+	_output.push_back(std::move(frame));
+	if (!_writableRegistered)
+	{
+		try
+		{
+			if (!flushOutput())
+			{
+				_reactor.addEventHandler(_webSocket, _writableObserver);
+				_writableRegistered = true;
+			}
+		}
+		catch (Poco::Exception& exc)
+		{
+			if (_closeStatus == 0)
+			{
+				_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+				_closeReason = exc.displayText();
+			}
+			_closing = true;
+			// wakes up the reactor, which closes the connection
+			try
+			{
+				_pSocketImpl->shutdown();
+			}
+			catch (Poco::Exception&)
+			{
+			}
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void AsyncWebSocket::encodeFrame(const char* payload, std::size_t length, int flags, std::string& frame)
+{
+	char header[MAX_HEADER_LENGTH];
+	std::size_t headerLength = 0;
+	unsigned char maskFlag = _mustMaskPayload ? 0x80 : 0;
+	header[headerLength++] = static_cast<char>(flags);
+	if (length < 126)
+	{
+		header[headerLength++] = static_cast<char>(maskFlag | length);
+	}
+	else if (length < 65536)
+	{
+		header[headerLength++] = static_cast<char>(maskFlag | 126);
+		header[headerLength++] = static_cast<char>(length >> 8);
+		header[headerLength++] = static_cast<char>(length & 0xff);
+	}
+	else
+	{
+		header[headerLength++] = static_cast<char>(maskFlag | 127);
+		for (int i = 7; i >= 0; i--)
+		{
+			header[headerLength++] = static_cast<char>((static_cast<Poco::UInt64>(length) >> (8*i)) & 0xff);
+		}
+	}
+	if (_mustMaskPayload)
+	{
+		const Poco::UInt32 mask = _rnd.next();
+		const char* m = reinterpret_cast<const char*>(&mask);
+		std::memcpy(header + headerLength, m, 4);
+		headerLength += 4;
+		frame.reserve(headerLength + length);
+		frame.assign(header, headerLength);
+		frame.resize(headerLength + length);
+		char* p = frame.data() + headerLength;
+		for (std::size_t i = 0; i < length; i++)
+		{
+			p[i] = payload[i] ^ m[i % 4];
+		}
+	}
+	else
+	{
+		frame.reserve(headerLength + length);
+		frame.assign(header, headerLength);
+		frame.append(payload, length);
+	}
+}
+
+
+bool AsyncWebSocket::flushOutput()
+{
+	if (_secure)
+	{
+		// After a failed write, OpenSSL requires the write to be repeated
+		// with the same buffer, so queued frames are only gathered once
+		// the previous buffer has been sent completely.
+		for (;;)
+		{
+			if (_sendBuffer.size() == 0)
+			{
+				if (_output.empty()) return true;
+				for (const auto& frame: _output) _sendBuffer += frame;
+				_output.clear();
+			}
+			int n = _pSocketImpl->sendBytes(_sendBuffer.data(), static_cast<int>(_sendBuffer.size()));
+			if (n < 0) return false;
+			_pendingBytes -= n;
+			_sendBuffer.erase(0, n);
+		}
+	}
+	else
+	{
+		SocketBufVec buffers;
+		while (!_output.empty())
+		{
+			buffers.clear();
+			std::size_t total = 0;
+			std::size_t offset = _outputOffset;
+			for (auto it = _output.begin(); it != _output.end() && buffers.size() < MAX_IOVECS; ++it)
+			{
+				buffers.push_back(Socket::makeBuffer(it->data() + offset, it->size() - offset));
+				total += it->size() - offset;
+				offset = 0;
+			}
+			int n = static_cast<SocketImpl*>(_pSocketImpl)->sendBytes(buffers);
+			if (n < 0) return false;
+			_pendingBytes -= n;
+			std::size_t sent = static_cast<std::size_t>(n);
+			while (sent > 0)
+			{
+				std::size_t remaining = _output.front().size() - _outputOffset;
+				if (sent >= remaining)
+				{
+					sent -= remaining;
+					_output.pop_front();
+					_outputOffset = 0;
+				}
+				else
+				{
+					_outputOffset += sent;
+					sent = 0;
+				}
+			}
+			if (static_cast<std::size_t>(n) < total) return false;
+		}
+		return true;
+	}
+}
+
+
+void AsyncWebSocket::abort(int statusCode, const std::string& reason)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (!_open) return;
+		if (_closeStatus == 0)
+		{
+			_closeStatus = statusCode;
+			_closeReason = reason;
+		}
+		_closing = true;
+	}
+	if (_started)
+	{
+		// The connection is closed by the reactor thread, as
+		// notifications may still be dispatched to this object.
+		// Shutting down the socket makes it readable.
+		try
+		{
+			_pSocketImpl->shutdown();
+		}
+		catch (Poco::Exception&)
+		{
+			_reactor.wakeUp();
+		}
+	}
+	else closeImpl();
+}
+
+
+void AsyncWebSocket::closeAfterFlush()
+{
+	bool flushed;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_closing = true;
+		flushed = _output.empty() && _sendBuffer.empty();
+	}
+	if (flushed) closeImpl();
+}
+
+
+void AsyncWebSocket::closeImpl()
+{
+	int statusCode;
+	std::string reason;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (!_open) return;
+		_open = false;
+		_closing = true;
+		if (_closeStatus == 0)
+		{
+			_closeStatus = WebSocket::WS_RESERVED_ABNORMAL_CLOSE;
+		}
+		statusCode = _closeStatus;
+		reason = _closeReason;
+		_output.clear();
+		_sendBuffer.clear();
+		_pendingBytes = 0;
+		_writableRegistered = false;
+	}
+
+	_reactor.remove(_webSocket);
+	try
+	{
+		_webSocket.close();
+	}
+	catch (Poco::Exception&)
+	{
+	}
+
+	if (_closeCallback)
+	{
+		try
+		{
+			_closeCallback(*this, statusCode, reason);
+		}
+		catch (...)
+		{
+		}
+	}
+
+	if (_started)
+	{
+		_started = false;
+		release();
+	}
+}
+
+
+} // namespace Poco::Net
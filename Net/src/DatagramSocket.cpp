@@ -18,6 +18,7 @@
 
 
 using Poco::InvalidArgumentException;
+using Poco::NotImplementedException;
 
 
 namespace Poco::Net {
@@ -204,4 +205,104 @@ int DatagramSocket::receiveFrom(SocketBufVec& buffers, struct sockaddr** ppSA, p
 }
 
 
+int DatagramSocket::sendBatch(const SocketBufVec& buffers, const std::vector<SocketAddress>& addresses, int flags)
+{
+	if (!addresses.empty() && addresses.size() != buffers.size())
+		throw InvalidArgumentException("DatagramSocket::sendBatch(): number of addresses does not match number of buffers");
+
+	return impl()->sendBatch(buffers, addresses.empty() ? nullptr : addresses.data(), flags);
+}
+
+
+int DatagramSocket::receiveBatch(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, int flags)
+{
+	return receiveBatchImpl(buffers, addresses, lengths, nullptr, flags);
+}
+
+
+int DatagramSocket::receiveBatch(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, std::vector<int>& segmentSizes, int flags)
+{
+	segmentSizes.resize(buffers.size());
+	int rc = receiveBatchImpl(buffers, addresses, lengths, segmentSizes.data(), flags);
+	segmentSizes.resize(rc > 0 ? rc : 0);
+	return rc;
+}
+
+
+int DatagramSocket::receiveBatch(SocketBufVec& buffers, int* pLengths, struct sockaddr** ppSA, poco_socklen_t** ppSALen, int flags)
+{
+	return impl()->receiveBatch(buffers, pLengths, ppSA, ppSALen, nullptr, flags);
+}
+
+
+int DatagramSocket::receiveBatchImpl(SocketBufVec& buffers, std::vector<SocketAddress>& addresses, std::vector<int>& lengths, int* pSegmentSizes, int flags)
+{
+	const std::size_t count = buffers.size();
+	std::vector<sockaddr_storage> storage(count);
+	std::vector<poco_socklen_t> saLen(count, sizeof(sockaddr_storage));
+	std::vector<struct sockaddr*> pSA(count);
+	std::vector<poco_socklen_t*> pSALen(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		pSA[i] = reinterpret_cast<struct sockaddr*>(&storage[i]);
+		pSALen[i] = &saLen[i];
+	}
+	lengths.resize(count);
+	int rc = impl()->receiveBatch(buffers, lengths.data(), pSA.data(), pSALen.data(), pSegmentSizes, flags);
+	const std::size_t received = rc > 0 ? rc : 0;
+	lengths.resize(received);
+	addresses.clear();
+	addresses.reserve(received);
+	for (std::size_t i = 0; i < received; ++i)
+	{
+		addresses.emplace_back(pSA[i], saLen[i]);
+	}
+	return rc;
+}
+
+
+void DatagramSocket::setSegmentSize(int size)
+{
+#if defined(POCO_HAVE_MMSG)
+	impl()->setOption(IPPROTO_UDP, UDP_SEGMENT, size);
+#else
+	throw NotImplementedException("DatagramSocket::setSegmentSize()");
+#endif
+}
+
+
+int DatagramSocket::getSegmentSize()
+{
+#if defined(POCO_HAVE_MMSG)
+	int size = 0;
+	impl()->getOption(IPPROTO_UDP, UDP_SEGMENT, size);
+	return size;
+#else
+	throw NotImplementedException("DatagramSocket::getSegmentSize()");
+#endif
+}
+
+
+void DatagramSocket::setReceiveOffload(bool flag)
+{
+#if defined(POCO_HAVE_MMSG)
+	impl()->setOption(IPPROTO_UDP, UDP_GRO, flag ? 1 : 0);
+#else
+	throw NotImplementedException("DatagramSocket::setReceiveOffload()");
+#endif
+}
+
+
+bool DatagramSocket::getReceiveOffload()
+{
+#if defined(POCO_HAVE_MMSG)
+	int flag = 0;
+	impl()->getOption(IPPROTO_UDP, UDP_GRO, flag);
+	return flag != 0;
+#else
+	throw NotImplementedException("DatagramSocket::getReceiveOffload()");
+#endif
+}
+
+
 } // namespace Poco::Net
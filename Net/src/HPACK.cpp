@@ -0,0 +1,629 @@
+//
+// HPACK.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HPACK
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/NetException.h"
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	struct StaticEntry
+	{
+		const char* name;
+		const char* value;
+	};
+
+	const StaticEntry STATIC_TABLE[HPACKTable::STATIC_TABLE_SIZE] =
+	{
+		{":authority", ""},
+		{":method", "GET"},
+		{":method", "POST"},
+		{":path", "/"},
+		{":path", "/index.html"},
+		{":scheme", "http"},
+		{":scheme", "https"},
+		{":status", "200"},
+		{":status", "204"},
+		{":status", "206"},
+		{":status", "304"},
+		{":status", "400"},
+		{":status", "404"},
+		{":status", "500"},
+		{"accept-charset", ""},
+		{"accept-encoding", "gzip, deflate"},
+		{"accept-language", ""},
+		{"accept-ranges", ""},
+		{"accept", ""},
+		{"access-control-allow-origin", ""},
+		{"age", ""},
+		{"allow", ""},
+		{"authorization", ""},
+		{"cache-control", ""},
+		{"content-disposition", ""},
+		{"content-encoding", ""},
+		{"content-language", ""},
+		{"content-length", ""},
+		{"content-location", ""},
+		{"content-range", ""},
+		{"content-type", ""},
+		{"cookie", ""},
+		{"date", ""},
+		{"etag", ""},
+		{"expect", ""},
+		{"expires", ""},
+		{"from", ""},
+		{"host", ""},
+		{"if-match", ""},
+		{"if-modified-since", ""},
+		{"if-none-match", ""},
+		{"if-range", ""},
+		{"if-unmodified-since", ""},
+		{"last-modified", ""},
+		{"link", ""},
+		{"location", ""},
+		{"max-forwards", ""},
+		{"proxy-authenticate", ""},
+		{"proxy-authorization", ""},
+		{"range", ""},
+		{"referer", ""},
+		{"refresh", ""},
+		{"retry-after", ""},
+		{"server", ""},
+		{"set-cookie", ""},
+		{"strict-transport-security", ""},
+		{"transfer-encoding", ""},
+		{"user-agent", ""},
+		{"vary", ""},
+		{"via", ""},
+		{"www-authenticate", ""}
+	};
+
+	struct HuffmanCode
+	{
+		UInt32 code;
+		int length;
+	};
+
+	const int HUFFMAN_EOS = 256;
+
+	const HuffmanCode HUFFMAN_CODES[257] =
+		/// The Huffman code from RFC 7541, Appendix B.
+		/// The last entry is the EOS symbol.
+	{
+		{0x00001ff8, 13}, {0x007fffd8, 23}, {0x0fffffe2, 28}, {0x0fffffe3, 28},
+		{0x0fffffe4, 28}, {0x0fffffe5, 28}, {0x0fffffe6, 28}, {0x0fffffe7, 28},
+		{0x0fffffe8, 28}, {0x00ffffea, 24}, {0x3ffffffc, 30}, {0x0fffffe9, 28},
+		{0x0fffffea, 28}, {0x3ffffffd, 30}, {0x0fffffeb, 28}, {0x0fffffec, 28},
+		{0x0fffffed, 28}, {0x0fffffee, 28}, {0x0fffffef, 28}, {0x0ffffff0, 28},
+		{0x0ffffff1, 28}, {0x0ffffff2, 28}, {0x3ffffffe, 30}, {0x0ffffff3, 28},
+		{0x0ffffff4, 28}, {0x0ffffff5, 28}, {0x0ffffff6, 28}, {0x0ffffff7, 28},
+		{0x0ffffff8, 28}, {0x0ffffff9, 28}, {0x0ffffffa, 28}, {0x0ffffffb, 28},
+		{0x00000014,  6}, {0x000003f8, 10}, {0x000003f9, 10}, {0x00000ffa, 12},
+		{0x00001ff9, 13}, {0x00000015,  6}, {0x000000f8,  8}, {0x000007fa, 11},
+		{0x000003fa, 10}, {0x000003fb, 10}, {0x000000f9,  8}, {0x000007fb, 11},
+		{0x000000fa,  8}, {0x00000016,  6}, {0x00000017,  6}, {0x00000018,  6},
+		{0x00000000,  5}, {0x00000001,  5}, {0x00000002,  5}, {0x00000019,  6},
+		{0x0000001a,  6}, {0x0000001b,  6}, {0x0000001c,  6}, {0x0000001d,  6},
+		{0x0000001e,  6}, {0x0000001f,  6}, {0x0000005c,  7}, {0x000000fb,  8},
+		{0x00007ffc, 15}, {0x00000020,  6}, {0x00000ffb, 12}, {0x000003fc, 10},
+		{0x00001ffa, 13}, {0x00000021,  6}, {0x0000005d,  7}, {0x0000005e,  7},
+		{0x0000005f,  7}, {0x00000060,  7}, {0x00000061,  7}, {0x00000062,  7},
+		{0x00000063,  7}, {0x00000064,  7}, {0x00000065,  7}, {0x00000066,  7},
+		{0x00000067,  7}, {0x00000068,  7}, {0x00000069,  7}, {0x0000006a,  7},
+		{0x0000006b,  7}, {0x0000006c,  7}, {0x0000006d,  7}, {0x0000006e,  7},
+		{0x0000006f,  7}, {0x00000070,  7}, {0x00000071,  7}, {0x00000072,  7},
+		{0x000000fc,  8}, {0x00000073,  7}, {0x000000fd,  8}, {0x00001ffb, 13},
+		{0x0007fff0, 19}, {0x00001ffc, 13}, {0x00003ffc, 14}, {0x00000022,  6},
+		{0x00007ffd, 15}, {0x00000003,  5}, {0x00000023,  6}, {0x00000004,  5},
+		{0x00000024,  6}, {0x00000005,  5}, {0x00000025,  6}, {0x00000026,  6},
+		{0x00000027,  6}, {0x00000006,  5}, {0x00000074,  7}, {0x00000075,  7},
+		{0x00000028,  6}, {0x00000029,  6}, {0x0000002a,  6}, {0x00000007,  5},
+		{0x0000002b,  6}, {0x00000076,  7}, {0x0000002c,  6}, {0x00000008,  5},
+		{0x00000009,  5}, {0x0000002d,  6}, {0x00000077,  7}, {0x00000078,  7},
+		{0x00000079,  7}, {0x0000007a,  7}, {0x0000007b,  7}, {0x00007ffe, 15},
+		{0x000007fc, 11}, {0x00003ffd, 14}, {0x00001ffd, 13}, {0x0ffffffc, 28},
+		{0x000fffe6, 20}, {0x003fffd2, 22}, {0x000fffe7, 20}, {0x000fffe8, 20},
+		{0x003fffd3, 22}, {0x003fffd4, 22}, {0x003fffd5, 22}, {0x007fffd9, 23},
+		{0x003fffd6, 22}, {0x007fffda, 23}, {0x007fffdb, 23}, {0x007fffdc, 23},
+		{0x007fffdd, 23}, {0x007fffde, 23}, {0x00ffffeb, 24}, {0x007fffdf, 23},
+		{0x00ffffec, 24}, {0x00ffffed, 24}, {0x003fffd7, 22}, {0x007fffe0, 23},
+		{0x00ffffee, 24}, {0x007fffe1, 23}, {0x007fffe2, 23}, {0x007fffe3, 23},
+		{0x007fffe4, 23}, {0x001fffdc, 21}, {0x003fffd8, 22}, {0x007fffe5, 23},
+		{0x003fffd9, 22}, {0x007fffe6, 23}, {0x007fffe7, 23}, {0x00ffffef, 24},
+		{0x003fffda, 22}, {0x001fffdd, 21}, {0x000fffe9, 20}, {0x003fffdb, 22},
+		{0x003fffdc, 22}, {0x007fffe8, 23}, {0x007fffe9, 23}, {0x001fffde, 21},
+		{0x007fffea, 23}, {0x003fffdd, 22}, {0x003fffde, 22}, {0x00fffff0, 24},
+		{0x001fffdf, 21}, {0x003fffdf, 22}, {0x007fffeb, 23}, {0x007fffec, 23},
+		{0x001fffe0, 21}, {0x001fffe1, 21}, {0x003fffe0, 22}, {0x001fffe2, 21},
+		{0x007fffed, 23}, {0x003fffe1, 22}, {0x007fffee, 23}, {0x007fffef, 23},
+		{0x000fffea, 20}, {0x003fffe2, 22}, {0x003fffe3, 22}, {0x003fffe4, 22},
+		{0x007ffff0, 23}, {0x003fffe5, 22}, {0x003fffe6, 22}, {0x007ffff1, 23},
+		{0x03ffffe0, 26}, {0x03ffffe1, 26}, {0x000fffeb, 20}, {0x0007fff1, 19},
+		{0x003fffe7, 22}, {0x007ffff2, 23}, {0x003fffe8, 22}, {0x01ffffec, 25},
+		{0x03ffffe2, 26}, {0x03ffffe3, 26}, {0x03ffffe4, 26}, {0x07ffffde, 27},
+		{0x07ffffdf, 27}, {0x03ffffe5, 26}, {0x00fffff1, 24}, {0x01ffffed, 25},
+		{0x0007fff2, 19}, {0x001fffe3, 21}, {0x03ffffe6, 26}, {0x07ffffe0, 27},
+		{0x07ffffe1, 27}, {0x03ffffe7, 26}, {0x07ffffe2, 27}, {0x00fffff2, 24},
+		{0x001fffe4, 21}, {0x001fffe5, 21}, {0x03ffffe8, 26}, {0x03ffffe9, 26},
+		{0x0ffffffd, 28}, {0x07ffffe3, 27}, {0x07ffffe4, 27}, {0x07ffffe5, 27},
+		{0x000fffec, 20}, {0x00fffff3, 24}, {0x000fffed, 20}, {0x001fffe6, 21},
+		{0x003fffe9, 22}, {0x001fffe7, 21}, {0x001fffe8, 21}, {0x007ffff3, 23},
+		{0x003fffea, 22}, {0x003fffeb, 22}, {0x01ffffee, 25}, {0x01ffffef, 25},
+		{0x00fffff4, 24}, {0x00fffff5, 24}, {0x03ffffea, 26}, {0x007ffff4, 23},
+		{0x03ffffeb, 26}, {0x07ffffe6, 27}, {0x03ffffec, 26}, {0x03ffffed, 26},
+		{0x07ffffe7, 27}, {0x07ffffe8, 27}, {0x07ffffe9, 27}, {0x07ffffea, 27},
+		{0x07ffffeb, 27}, {0x0ffffffe, 28}, {0x07ffffec, 27}, {0x07ffffed, 27},
+		{0x07ffffee, 27}, {0x07ffffef, 27}, {0x07fffff0, 27}, {0x03ffffee, 26},
+		{0x3fffffff, 30}
+	};
+
+	class HuffmanTree
+		/// A binary tree for decoding Huffman codes bit by bit.
+	{
+	public:
+		struct Node
+		{
+			int children[2] = {-1, -1};
+			int symbol = -1;
+		};
+
+		HuffmanTree()
+		{
+			_nodes.emplace_back();
+			for (int sym = 0; sym <= HUFFMAN_EOS; ++sym)
+			{
+				int node = 0;
+				for (int bit = HUFFMAN_CODES[sym].length - 1; bit >= 0; --bit)
+				{
+					int b = (HUFFMAN_CODES[sym].code >> bit) & 1;
+					if (_nodes[node].children[b] < 0)
+					{
+						_nodes[node].children[b] = static_cast<int>(_nodes.size());
+						_nodes.emplace_back();
+					}
+					node = _nodes[node].children[b];
+				}
+				_nodes[node].symbol = sym;
+			}
+		}
+
+		const Node& node(int index) const
+		{
+			return _nodes[index];
+		}
+
+	private:
+		std::vector<Node> _nodes;
+	};
+
+	const HuffmanTree& huffmanTree()
+	{
+		static const HuffmanTree tree;
+		return tree;
+	}
+
+	[[noreturn]] void compressionError(const std::string& msg)
+	{
+		throw HTTP2Exception("HPACK", msg, HTTP2Frame::H2_ERR_COMPRESSION);
+	}
+
+	std::size_t decodeInteger(const unsigned char*& p, const unsigned char* end, int prefixBits)
+	{
+		if (p == end) compressionError("truncated integer");
+		std::size_t mask = (std::size_t(1) << prefixBits) - 1;
+		std::size_t value = *p++ & mask;
+		if (value < mask) return value;
+		int shift = 0;
+		unsigned char b;
+		do
+		{
+			if (p == end) compressionError("truncated integer");
+			if (shift > 28) compressionError("integer overflow");
+			b = *p++;
+			value += std::size_t(b & 0x7F) << shift;
+			shift += 7;
+		}
+		while (b & 0x80);
+		return value;
+	}
+
+	void decodeHuffman(const unsigned char* p, std::size_t length, std::string& str)
+	{
+		const HuffmanTree& tree = huffmanTree();
+		int node = 0;
+		int padBits = 0;
+		bool allOnes = true;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			for (int bit = 7; bit >= 0; --bit)
+			{
+				int b = (p[i] >> bit) & 1;
+				node = tree.node(node).children[b];
+				if (node < 0) compressionError("invalid Huffman code");
+				int sym = tree.node(node).symbol;
+				if (sym >= 0)
+				{
+					if (sym == HUFFMAN_EOS) compressionError("EOS in Huffman-coded string");
+					str += static_cast<char>(sym);
+					node = 0;
+					padBits = 0;
+					allOnes = true;
+				}
+				else
+				{
+					++padBits;
+					allOnes = allOnes && b;
+				}
+			}
+		}
+		if (padBits > 7 || !allOnes) compressionError("invalid Huffman padding");
+	}
+
+	void decodeString(const unsigned char*& p, const unsigned char* end, std::string& str)
+	{
+		if (p == end) compressionError("truncated string");
+		bool huffman = (*p & 0x80) != 0;
+		std::size_t length = decodeInteger(p, end, 7);
+		if (length > static_cast<std::size_t>(end - p)) compressionError("truncated string");
+		str.clear();
+		if (huffman)
+			decodeHuffman(p, length, str);
+		else
+			str.assign(reinterpret_cast<const char*>(p), length);
+		p += length;
+	}
+}
+
+
+//
+// HPACKTable
+//
+
+
+HPACKTable::HPACKTable(std::size_t maxSize):
+	_size(0),
+	_maxSize(maxSize)
+{
+}
+
+
+HPACKTable::~HPACKTable()
+{
+}
+
+
+bool HPACKTable::get(std::size_t index, std::string& name, std::string& value) const
+{
+	if (index == 0) return false;
+	if (index <= STATIC_TABLE_SIZE)
+	{
+		name = STATIC_TABLE[index - 1].name;
+		value = STATIC_TABLE[index - 1].value;
+		return true;
+	}
+	index -= STATIC_TABLE_SIZE + 1;
+	if (index >= _entries.size()) return false;
+	name = _entries[index].first;
+	value = _entries[index].second;
+	return true;
+}
+
+
+void HPACKTable::add(const std::string& name, const std::string& value)
+{
+	std::size_t entrySize = name.size() + value.size() + ENTRY_OVERHEAD;
+	if (entrySize > _maxSize)
+	{
+		evict(0);
+		return;
+	}
+	evict(_maxSize - entrySize);
+	_entries.emplace_front(name, value);
+	_size += entrySize;
+}
+
+
+std::size_t HPACKTable::find(const std::string& name, const std::string& value, bool& valueMatch) const
+{
+	std::size_t nameIndex = 0;
+	valueMatch = false;
+	for (std::size_t i = 0; i < STATIC_TABLE_SIZE; ++i)
+	{
+		if (name == STATIC_TABLE[i].name)
+		{
+			if (value == STATIC_TABLE[i].value)
+			{
+				valueMatch = true;
+				return i + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + 1;
+		}
+		else if (nameIndex != 0) break; // entries with the same name are adjacent
+	}
+	for (std::size_t i = 0; i < _entries.size(); ++i)
+	{
+		if (_entries[i].first == name)
+		{
+			if (_entries[i].second == value)
+			{
+				valueMatch = true;
+				return i + STATIC_TABLE_SIZE + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + STATIC_TABLE_SIZE + 1;
+		}
+	}
+	return nameIndex;
+}
+
+
+void HPACKTable::setMaxSize(std::size_t maxSize)
+{
+	_maxSize = maxSize;
+	evict(maxSize);
+}
+
+
+void HPACKTable::evict(std::size_t maxSize)
+{
+	while (_size > maxSize && !_entries.empty())
+	{
+		const Header& header = _entries.back();
+		_size -= header.first.size() + header.second.size() + ENTRY_OVERHEAD;
+		_entries.pop_back();
+	}
+}
+
+
+//
+// HPACKDecoder
+//
+
+
+HPACKDecoder::HPACKDecoder(std::size_t maxTableSize):
+	_maxTableSize(maxTableSize),
+	_maxHeaderListSize(0),
+	_table(maxTableSize)
+{
+}
+
+
+HPACKDecoder::~HPACKDecoder()
+{
+}
+
+
+void HPACKDecoder::decode(const char* pBlock, std::size_t length, HeaderList& headers)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(pBlock);
+	const unsigned char* end = p + length;
+	std::size_t listSize = 0;
+	bool tooLarge = false;
+	bool fieldSeen = false;
+	std::string name;
+	std::string value;
+	while (p < end)
+	{
+		unsigned char b = *p;
+		if (b & 0x80)
+		{
+			// Indexed Header Field
+			std::size_t index = decodeInteger(p, end, 7);
+			if (!_table.get(index, name, value)) compressionError("invalid index");
+		}
+		else if ((b & 0xE0) == 0x20)
+		{
+			// Dynamic Table Size Update
+			if (fieldSeen) compressionError("misplaced dynamic table size update");
+			std::size_t size = decodeInteger(p, end, 5);
+			if (size > _maxTableSize) compressionError("dynamic table size update too large");
+			_table.setMaxSize(size);
+			continue;
+		}
+		else
+		{
+			// Literal Header Field with Incremental Indexing (6-bit prefix),
+			// without Indexing or Never Indexed (4-bit prefix)
+			bool incremental = (b & 0xC0) == 0x40;
+			std::size_t index = decodeInteger(p, end, incremental ? 6 : 4);
+			if (index == 0)
+			{
+				decodeString(p, end, name);
+			}
+			else
+			{
+				std::string ignored;
+				if (!_table.get(index, name, ignored)) compressionError("invalid index");
+			}
+			decodeString(p, end, value);
+			if (incremental) _table.add(name, value);
+		}
+		fieldSeen = true;
+		if (!tooLarge)
+		{
+			listSize += name.size() + value.size() + HPACKTable::ENTRY_OVERHEAD;
+			if (_maxHeaderListSize > 0 && listSize > _maxHeaderListSize)
+			{
+				// Stop collecting fields, but keep decoding the rest
+				// of the block so the dynamic table stays in sync.
+				tooLarge = true;
+			}
+			else headers.emplace_back(name, value);
+		}
+	}
+	if (tooLarge)
+	{
+		throw HTTP2Exception("HPACK", "header list too large", HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM);
+	}
+}
+
+
+void HPACKDecoder::setMaxHeaderListSize(std::size_t size)
+{
+	_maxHeaderListSize = size;
+}
+
+
+//
+// HPACKEncoder
+//
+
+
+HPACKEncoder::HPACKEncoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_huffman(true),
+	_tableSizeUpdate(false),
+	_minTableSize(maxTableSize)
+{
+}
+
+
+HPACKEncoder::~HPACKEncoder()
+{
+}
+
+
+void HPACKEncoder::encode(const HeaderList& headers, std::string& block)
+{
+	beginBlock(block);
+	for (const auto& header: headers)
+	{
+		encode(header.first, header.second, block);
+	}
+}
+
+
+void HPACKEncoder::beginBlock(std::string& block)
+{
+	if (_tableSizeUpdate)
+	{
+		// Signal the smallest size the table had since the
+		// last header block first, then the current size.
+		if (_minTableSize < _table.getMaxSize())
+			encodeInteger(block, 0x20, 5, _minTableSize);
+		encodeInteger(block, 0x20, 5, _table.getMaxSize());
+		_tableSizeUpdate = false;
+		_minTableSize = _table.getMaxSize();
+	}
+}
+
+
+void HPACKEncoder::encode(const std::string& name, const std::string& value, std::string& block, bool sensitive)
+{
+	bool valueMatch;
+	std::size_t index = _table.find(name, value, valueMatch);
+	if (valueMatch && !sensitive)
+	{
+		encodeInteger(block, 0x80, 7, index);
+		return;
+	}
+
+	std::size_t entrySize = name.size() + value.size() + HPACKTable::ENTRY_OVERHEAD;
+	bool incremental = !sensitive && entrySize <= _table.getMaxSize()/2;
+	if (incremental)
+		encodeInteger(block, 0x40, 6, index);
+	else
+		encodeInteger(block, sensitive ? 0x10 : 0x00, 4, index);
+	if (index == 0) encodeString(block, name);
+	encodeString(block, value);
+	if (incremental) _table.add(name, value);
+}
+
+
+void HPACKEncoder::setMaxTableSize(std::size_t maxTableSize)
+{
+	if (maxTableSize != _table.getMaxSize())
+	{
+		_table.setMaxSize(maxTableSize);
+		if (maxTableSize < _minTableSize) _minTableSize = maxTableSize;
+		_tableSizeUpdate = true;
+	}
+}
+
+
+void HPACKEncoder::encodeString(std::string& out, const std::string& str)
+{
+	if (_huffman)
+	{
+		std::size_t length = huffmanLength(str);
+		if (length < str.size())
+		{
+			encodeInteger(out, 0x80, 7, length);
+			encodeHuffman(out, str);
+			return;
+		}
+	}
+	encodeInteger(out, 0x00, 7, str.size());
+	out.append(str);
+}
+
+
+void HPACKEncoder::encodeInteger(std::string& out, UInt8 prefix, int prefixBits, std::size_t value)
+{
+	std::size_t mask = (std::size_t(1) << prefixBits) - 1;
+	if (value < mask)
+	{
+		out += static_cast<char>(prefix | value);
+		return;
+	}
+	out += static_cast<char>(prefix | mask);
+	value -= mask;
+	while (value >= 0x80)
+	{
+		out += static_cast<char>((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+	out += static_cast<char>(value);
+}
+
+
+void HPACKEncoder::encodeHuffman(std::string& out, const std::string& str)
+{
+	UInt64 bits = 0;
+	int bitCount = 0;
+	for (unsigned char ch: str)
+	{
+		const HuffmanCode& hc = HUFFMAN_CODES[ch];
+		bits = (bits << hc.length) | hc.code;
+		bitCount += hc.length;
+		while (bitCount >= 8)
+		{
+			bitCount -= 8;
+			out += static_cast<char>(bits >> bitCount);
+		}
+	}
+	if (bitCount > 0)
+	{
+		// pad with the most significant bits of EOS (all ones)
+		bits = (bits << (8 - bitCount)) | (0xFF >> bitCount);
+		out += static_cast<char>(bits);
+	}
+}
+
+
+std::size_t HPACKEncoder::huffmanLength(const std::string& str)
+{
+	std::size_t bits = 0;
+	for (unsigned char ch: str)
+	{
+		bits += HUFFMAN_CODES[ch].length;
+	}
+	return (bits + 7)/8;
+}
+
+
+} // namespace Poco::Net
@@ -0,0 +1,1070 @@
+//
+// HTTP2ClientSession.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ClientSession
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/String.h"
+#include <cstring>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	const std::string HTTP_2_0("HTTP/2.0");
+	const std::size_t MAX_HEADER_LIST_SIZE = 65536;
+	const std::size_t MAX_HEADER_BLOCK_SIZE = 4*MAX_HEADER_LIST_SIZE;
+	const UInt32 MAX_STREAM_ID = 0x7FFFFFFF;
+	const long POLL_INTERVAL = 100000;
+
+	bool isConnectionHeader(const std::string& name)
+		/// Returns true if the given (lowercase) header name denotes
+		/// a connection-specific header field, which must not be
+		/// used with HTTP/2 (RFC 9113, Section 8.2.2).
+	{
+		return name == "connection" || name == "keep-alive" || name == "proxy-connection" ||
+			name == "transfer-encoding" || name == "upgrade";
+	}
+}
+
+
+//
+// HTTP2ClientSession::Stream
+//
+
+
+struct HTTP2ClientSession::Stream
+	/// The state of a single HTTP/2 stream. A Stream lives on the
+	/// stack of the thread sending the request. All members are
+	/// guarded by the session mutex while the stream is registered.
+{
+	Stream(HTTPResponse& resp, std::string& respBody):
+		id(0),
+		response(resp),
+		body(respBody),
+		headersReceived(false),
+		done(false),
+		endStreamSent(false),
+		error(-1),
+		sendWindow(0),
+		recvWindow(DEFAULT_INITIAL_WINDOW_SIZE),
+		recvConsumed(0)
+	{
+	}
+
+	UInt32 id;
+	HTTPResponse& response;
+	std::string& body;
+	bool headersReceived;
+	bool done;
+	bool endStreamSent;
+	int error;
+	Int64 sendWindow;
+	Int64 recvWindow;
+	UInt32 recvConsumed;
+	Poco::Timestamp lastActivity;
+};
+
+
+//
+// HTTP2ClientSession
+//
+
+
+HTTP2ClientSession::HTTP2ClientSession(const StreamSocket& socket, const std::string& host, Poco::UInt16 port):
+	_socket(socket),
+	_host(host),
+	_port(port),
+	_timeout(Poco::Timespan(60, 0).totalMicroseconds()),
+	_thread("HTTP2ClientSession"s),
+	_readBuffer(HTTP2Frame::HEADER_SIZE + HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_readPos(0),
+	_readEnd(0),
+	_payload(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_decoder(HTTP2Frame::DEFAULT_TABLE_SIZE),
+	_continuationStreamId(0),
+	_continuationEndStream(false),
+	_recvWindow(DEFAULT_INITIAL_WINDOW_SIZE),
+	_recvConsumed(0),
+	_openStreams(0),
+	_sendWindow(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_peerInitialWindowSize(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_peerMaxConcurrentStreams(100),
+	_peerMaxFrameSize(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_closed(false),
+	_goAwayReceived(false),
+	_encoder(HTTP2Frame::DEFAULT_TABLE_SIZE),
+	_writeBuffer(HTTP2Frame::HEADER_SIZE + HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_nextStreamId(1),
+	_goAwaySent(false)
+{
+	_decoder.setMaxHeaderListSize(MAX_HEADER_LIST_SIZE);
+
+	bool defaultPort = (port == 80 && !secure()) || (port == 443 && secure());
+	if (host.find(':') != std::string::npos && host[0] != '[')
+		_authority = "[" + host + "]";
+	else
+		_authority = host;
+	if (!defaultPort)
+	{
+		_authority += ':';
+		_authority += NumberFormatter::format(port);
+	}
+
+	sendPreface();
+	_thread.startFunc([this]() { run(); });
+}
+
+
+HTTP2ClientSession::~HTTP2ClientSession()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void HTTP2ClientSession::sendRequest(HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody)
+{
+	response.clear();
+	responseBody.clear();
+
+	Stream stream(response, responseBody);
+	openStream(stream, request, requestBody.size());
+	try
+	{
+		if (!requestBody.empty())
+		{
+			sendData(stream, requestBody.data(), requestBody.size());
+		}
+		waitForResponse(stream);
+	}
+	catch (...)
+	{
+		closeStream(stream);
+		throw;
+	}
+	closeStream(stream);
+}
+
+
+bool HTTP2ClientSession::canSendRequest() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return !_closed && !_goAwayReceived && _nextStreamId <= MAX_STREAM_ID &&
+		static_cast<UInt32>(_openStreams) < _peerMaxConcurrentStreams;
+}
+
+
+bool HTTP2ClientSession::isOpen() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return !_closed && !_goAwayReceived && _nextStreamId <= MAX_STREAM_ID;
+}
+
+
+int HTTP2ClientSession::activeStreams() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _openStreams;
+}
+
+
+int HTTP2ClientSession::maxConcurrentStreams() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return static_cast<int>(std::min<UInt32>(_peerMaxConcurrentStreams, 0x7FFFFFFF));
+}
+
+
+Poco::Timestamp HTTP2ClientSession::lastUsed() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _lastUsed;
+}
+
+
+void HTTP2ClientSession::setTimeout(const Poco::Timespan& timeout)
+{
+	_timeout = timeout.totalMicroseconds();
+}
+
+
+Poco::Timespan HTTP2ClientSession::getTimeout() const
+{
+	return Poco::Timespan(_timeout.load());
+}
+
+
+void HTTP2ClientSession::close()
+{
+	try
+	{
+		sendGoAway(HTTP2Frame::H2_ERR_NONE);
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	shutdown("HTTP/2 connection closed"s);
+	_thread.join();
+	try
+	{
+		_socket.close();
+	}
+	catch (Poco::Exception&)
+	{
+	}
+}
+
+
+void HTTP2ClientSession::run()
+{
+	std::string error;
+	try
+	{
+		HTTP2Frame frame;
+		bool first = true;
+		while (readFrame(frame))
+		{
+			if (first && frame.type() != HTTP2Frame::FRAME_TYPE_SETTINGS)
+				throw HTTP2Exception("Expected SETTINGS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+			first = false;
+
+			handleFrame(frame);
+		}
+		error = "HTTP/2 connection closed by server";
+	}
+	catch (HTTP2Exception& exc)
+	{
+		error = exc.displayText();
+		try
+		{
+			sendGoAway(static_cast<HTTP2Frame::ErrorCode>(exc.code()));
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		error = exc.displayText();
+	}
+	shutdown(error);
+}
+
+
+bool HTTP2ClientSession::receive(char* pBuffer, std::size_t length, bool frameStart)
+{
+	std::size_t received = 0;
+	while (received < length)
+	{
+		if (_readPos < _readEnd)
+		{
+			std::size_t n = std::min(length - received, _readEnd - _readPos);
+			std::memcpy(pBuffer + received, _readBuffer.begin() + _readPos, n);
+			_readPos += n;
+			received += n;
+			continue;
+		}
+
+		if (_closed) return false;
+
+		// Wait for data without blocking in receiveBytes(), as a
+		// secure socket cannot be written to while a thread is
+		// blocked reading it. available() accounts for data that
+		// has already been decrypted, which poll() does not see.
+		if (_socket.available() <= 0 && !_socket.poll(Poco::Timespan(POLL_INTERVAL), Socket::SELECT_READ | Socket::SELECT_ERROR))
+			continue;
+
+		int n = _socket.receiveBytes(_readBuffer.begin(), static_cast<int>(_readBuffer.size()));
+		if (n <= 0)
+		{
+			if (frameStart && received == 0) return false;
+			throw NetException("HTTP/2 connection closed in the middle of a frame");
+		}
+		_readPos = 0;
+		_readEnd = static_cast<std::size_t>(n);
+	}
+	return true;
+}
+
+
+bool HTTP2ClientSession::readFrame(HTTP2Frame& frame)
+{
+	char header[HTTP2Frame::HEADER_SIZE];
+	if (!receive(header, HTTP2Frame::HEADER_SIZE, true)) return false;
+
+	frame.read(header);
+	if (frame.length() > HTTP2Frame::DEFAULT_MAX_FRAME_SIZE)
+		throw HTTP2Exception("Frame exceeds SETTINGS_MAX_FRAME_SIZE", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	_payload.resize(frame.length(), false);
+	if (frame.length() > 0)
+	{
+		if (!receive(_payload.begin(), frame.length(), false)) return false;
+	}
+	return true;
+}
+
+
+void HTTP2ClientSession::handleFrame(const HTTP2Frame& frame)
+{
+	if (_continuationStreamId != 0 && frame.type() != HTTP2Frame::FRAME_TYPE_CONTINUATION)
+		throw HTTP2Exception("Expected CONTINUATION frame", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	switch (frame.type())
+	{
+	case HTTP2Frame::FRAME_TYPE_DATA:
+		handleData(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_HEADERS:
+		handleHeaders(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_PRIORITY:
+		if (frame.streamId() == 0)
+			throw HTTP2Exception("PRIORITY frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+		break;
+	case HTTP2Frame::FRAME_TYPE_RST_STREAM:
+		handleRstStream(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_SETTINGS:
+		handleSettings(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_PUSH_PROMISE:
+		// Server push has been disabled in our SETTINGS.
+		throw HTTP2Exception("Unexpected PUSH_PROMISE frame", HTTP2Frame::H2_ERR_PROTOCOL);
+	case HTTP2Frame::FRAME_TYPE_PING:
+		handlePing(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_GOAWAY:
+		handleGoAway(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE:
+		handleWindowUpdate(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_CONTINUATION:
+		handleContinuation(frame);
+		break;
+	default:
+		// Frames of unknown types must be ignored.
+		break;
+	}
+}
+
+
+void HTTP2ClientSession::handleData(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("DATA frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (streamId >= _nextStreamId)
+		throw HTTP2Exception("DATA frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	const char* pData = _payload.begin();
+	std::size_t length = frame.length();
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PADDED))
+	{
+		std::size_t padding = length > 0 ? static_cast<UInt8>(pData[0]) : 0;
+		if (length == 0 || padding >= length)
+			throw HTTP2Exception("Invalid padding in DATA frame", HTTP2Frame::H2_ERR_PROTOCOL);
+		++pData;
+		length -= padding + 1;
+	}
+
+	consumeReceiveWindow(streamId, frame.length());
+
+	bool protocolError = false;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		StreamMap::iterator it = _streams.find(streamId);
+		if (it == _streams.end() || it->second->done || it->second->error >= 0) return;
+
+		Stream& stream = *it->second;
+		if (stream.headersReceived)
+		{
+			stream.body.append(pData, length);
+			stream.lastActivity.update();
+			if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_STREAM)) stream.done = true;
+		}
+		else
+		{
+			stream.error = HTTP2Frame::H2_ERR_PROTOCOL;
+			protocolError = true;
+		}
+		_condition.broadcast();
+	}
+	if (protocolError) sendRstStream(streamId, HTTP2Frame::H2_ERR_PROTOCOL);
+}
+
+
+void HTTP2ClientSession::handleHeaders(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("HEADERS frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	const char* pData = _payload.begin();
+	std::size_t length = frame.length();
+	std::size_t padding = 0;
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PADDED))
+	{
+		if (length < 1)
+			throw HTTP2Exception("Invalid padding in HEADERS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+		padding = static_cast<UInt8>(pData[0]);
+		++pData;
+		--length;
+	}
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PRIORITY))
+	{
+		if (length < 5)
+			throw HTTP2Exception("Invalid HEADERS frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+		pData += 5;
+		length -= 5;
+	}
+	if (padding > length)
+		throw HTTP2Exception("Invalid padding in HEADERS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+	length -= padding;
+
+	_headerBlock.assign(pData, length);
+	_continuationEndStream = frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_STREAM);
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_HEADERS))
+		headerBlockComplete(streamId, _continuationEndStream);
+	else
+		_continuationStreamId = streamId;
+}
+
+
+void HTTP2ClientSession::handleContinuation(const HTTP2Frame& frame)
+{
+	if (_continuationStreamId == 0 || frame.streamId() != _continuationStreamId)
+		throw HTTP2Exception("Unexpected CONTINUATION frame", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (_headerBlock.size() + frame.length() > MAX_HEADER_BLOCK_SIZE)
+		throw HTTP2Exception("Header block too large", HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM);
+
+	_headerBlock.append(_payload.begin(), frame.length());
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_HEADERS))
+	{
+		UInt32 streamId = _continuationStreamId;
+		_continuationStreamId = 0;
+		headerBlockComplete(streamId, _continuationEndStream);
+	}
+}
+
+
+void HTTP2ClientSession::headerBlockComplete(UInt32 streamId, bool endStream)
+{
+	if ((streamId & 1) == 0 || streamId >= _nextStreamId)
+		throw HTTP2Exception("Invalid stream identifier", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	HPACKDecoder::HeaderList headers;
+	HTTP2Frame::ErrorCode error = HTTP2Frame::H2_ERR_NONE;
+	try
+	{
+		_decoder.decode(_headerBlock.data(), _headerBlock.size(), headers);
+	}
+	catch (HTTP2Exception& exc)
+	{
+		if (exc.code() != HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM) throw;
+		error = HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM;
+	}
+	_headerBlock.clear();
+
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		StreamMap::iterator it = _streams.find(streamId);
+		if (it == _streams.end() || it->second->done || it->second->error >= 0) return;
+
+		Stream& stream = *it->second;
+		stream.lastActivity.update();
+		if (error == HTTP2Frame::H2_ERR_NONE && !stream.headersReceived)
+		{
+			int status = 0;
+			if (headers.empty() || headers[0].first != ":status" || !NumberParser::tryParse(headers[0].second, status) || status < 100 || status > 999)
+			{
+				error = HTTP2Frame::H2_ERR_PROTOCOL;
+			}
+			else if (status >= 200)
+			{
+				stream.response.setVersion(HTTP_2_0);
+				stream.response.setStatusAndReason(static_cast<HTTPResponse::HTTPStatus>(status));
+				for (std::size_t i = 1; i < headers.size(); ++i)
+				{
+					if (headers[i].first.empty() || headers[i].first[0] == ':')
+					{
+						error = HTTP2Frame::H2_ERR_PROTOCOL;
+						break;
+					}
+					stream.response.add(headers[i].first, headers[i].second);
+				}
+				stream.headersReceived = true;
+			}
+			else if (endStream)
+			{
+				// An interim (1xx) response must not end the stream.
+				error = HTTP2Frame::H2_ERR_PROTOCOL;
+			}
+		}
+		else if (error == HTTP2Frame::H2_ERR_NONE && !endStream)
+		{
+			// A trailer section must end the stream.
+			error = HTTP2Frame::H2_ERR_PROTOCOL;
+		}
+
+		if (error != HTTP2Frame::H2_ERR_NONE)
+			stream.error = error;
+		else if (endStream && stream.headersReceived)
+			stream.done = true;
+		_condition.broadcast();
+	}
+	if (error != HTTP2Frame::H2_ERR_NONE) sendRstStream(streamId, error);
+}
+
+
+void HTTP2ClientSession::handleRstStream(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("RST_STREAM frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.length() != 4)
+		throw HTTP2Exception("Invalid RST_STREAM frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+	if (streamId >= _nextStreamId)
+		throw HTTP2Exception("RST_STREAM frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	UInt32 error = HTTP2Frame::readUInt32(_payload.begin());
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	StreamMap::iterator it = _streams.find(streamId);
+	if (it != _streams.end() && !it->second->done && it->second->error < 0)
+	{
+		it->second->error = static_cast<int>(error);
+		_condition.broadcast();
+	}
+}
+
+
+void HTTP2ClientSession::handleSettings(const HTTP2Frame& frame)
+{
+	if (frame.streamId() != 0)
+		throw HTTP2Exception("SETTINGS frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK))
+	{
+		if (frame.length() != 0)
+			throw HTTP2Exception("Invalid SETTINGS acknowledgement", HTTP2Frame::H2_ERR_FRAME_SIZE);
+		return;
+	}
+	if (frame.length() % 6 != 0)
+		throw HTTP2Exception("Invalid SETTINGS frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	const char* p = _payload.begin();
+	for (UInt32 i = 0; i < frame.length(); i += 6)
+	{
+		UInt16 id = static_cast<UInt16>((static_cast<UInt8>(p[i]) << 8) | static_cast<UInt8>(p[i + 1]));
+		UInt32 value = HTTP2Frame::readUInt32(p + i + 2);
+		switch (id)
+		{
+		case HTTP2Frame::SETTING_HEADER_TABLE_SIZE:
+			{
+				Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+				_encoder.setMaxTableSize(std::min<UInt32>(value, HTTP2Frame::DEFAULT_TABLE_SIZE));
+			}
+			break;
+		case HTTP2Frame::SETTING_ENABLE_PUSH:
+			if (value != 0)
+				throw HTTP2Exception("Invalid SETTINGS_ENABLE_PUSH value", HTTP2Frame::H2_ERR_PROTOCOL);
+			break;
+		case HTTP2Frame::SETTING_MAX_CONCURRENT_STREAMS:
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+
+				_peerMaxConcurrentStreams = value;
+				_condition.broadcast();
+			}
+			break;
+		case HTTP2Frame::SETTING_INITIAL_WINDOW_SIZE:
+			{
+				if (value > HTTP2Frame::MAX_WINDOW_SIZE)
+					throw HTTP2Exception("Invalid SETTINGS_INITIAL_WINDOW_SIZE value", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+
+				Poco::FastMutex::ScopedLock lock(_mutex);
+
+				Int64 delta = static_cast<Int64>(value) - _peerInitialWindowSize;
+				_peerInitialWindowSize = value;
+				for (auto& s: _streams)
+				{
+					s.second->sendWindow += delta;
+					if (s.second->sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+						throw HTTP2Exception("Flow-control window too large", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+				}
+				_condition.broadcast();
+			}
+			break;
+		case HTTP2Frame::SETTING_MAX_FRAME_SIZE:
+			if (value < HTTP2Frame::DEFAULT_MAX_FRAME_SIZE || value > HTTP2Frame::MAX_MAX_FRAME_SIZE)
+				throw HTTP2Exception("Invalid SETTINGS_MAX_FRAME_SIZE value", HTTP2Frame::H2_ERR_PROTOCOL);
+			_peerMaxFrameSize = value;
+			break;
+		default:
+			// Unknown settings must be ignored.
+			break;
+		}
+	}
+	writeFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, HTTP2Frame::FRAME_FLAG_ACK, 0, nullptr, 0);
+}
+
+
+void HTTP2ClientSession::handlePing(const HTTP2Frame& frame)
+{
+	if (frame.streamId() != 0)
+		throw HTTP2Exception("PING frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.length() != 8)
+		throw HTTP2Exception("Invalid PING frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	if (!frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK))
+	{
+		writeFrame(HTTP2Frame::FRAME_TYPE_PING, HTTP2Frame::FRAME_FLAG_ACK, 0, _payload.begin(), 8);
+	}
+}
+
+
+void HTTP2ClientSession::handleGoAway(const HTTP2Frame& frame)
+{
+	if (frame.streamId() != 0)
+		throw HTTP2Exception("GOAWAY frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.length() < 8)
+		throw HTTP2Exception("Invalid GOAWAY frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	UInt32 lastStreamId = HTTP2Frame::readUInt32(_payload.begin()) & MAX_STREAM_ID;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	// Streams above the last stream identifier have not been
+	// processed by the server and can be retried elsewhere.
+	_goAwayReceived = true;
+	for (auto& s: _streams)
+	{
+		if (s.first > lastStreamId && !s.second->done && s.second->error < 0)
+			s.second->error = HTTP2Frame::H2_ERR_REFUSED_STREAM;
+	}
+	_condition.broadcast();
+}
+
+
+void HTTP2ClientSession::handleWindowUpdate(const HTTP2Frame& frame)
+{
+	if (frame.length() != 4)
+		throw HTTP2Exception("Invalid WINDOW_UPDATE frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	UInt32 streamId = frame.streamId();
+	UInt32 increment = HTTP2Frame::readUInt32(_payload.begin()) & 0x7FFFFFFF;
+	if (streamId == 0)
+	{
+		if (increment == 0)
+			throw HTTP2Exception("Invalid WINDOW_UPDATE increment", HTTP2Frame::H2_ERR_PROTOCOL);
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_sendWindow += increment;
+		if (_sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+			throw HTTP2Exception("Flow-control window too large", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+		_condition.broadcast();
+	}
+	else
+	{
+		if (streamId >= _nextStreamId)
+			throw HTTP2Exception("WINDOW_UPDATE frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+
+		HTTP2Frame::ErrorCode error = HTTP2Frame::H2_ERR_NONE;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			StreamMap::iterator it = _streams.find(streamId);
+			if (it == _streams.end() || it->second->error >= 0) return;
+
+			Stream& stream = *it->second;
+			stream.sendWindow += increment;
+			if (increment == 0)
+				error = HTTP2Frame::H2_ERR_PROTOCOL;
+			else if (stream.sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+				error = HTTP2Frame::H2_ERR_FLOW_CONTROL;
+			if (error != HTTP2Frame::H2_ERR_NONE) stream.error = error;
+			_condition.broadcast();
+		}
+		if (error != HTTP2Frame::H2_ERR_NONE) sendRstStream(streamId, error);
+	}
+}
+
+
+void HTTP2ClientSession::consumeReceiveWindow(UInt32 streamId, UInt32 length)
+{
+	if (length == 0) return;
+
+	const UInt32 threshold = DEFAULT_INITIAL_WINDOW_SIZE/2;
+	_recvWindow -= length;
+	if (_recvWindow < 0)
+		throw HTTP2Exception("Connection flow-control window exceeded", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+	_recvConsumed += length;
+	if (_recvConsumed >= threshold)
+	{
+		sendWindowUpdate(0, _recvConsumed);
+		_recvWindow += _recvConsumed;
+		_recvConsumed = 0;
+	}
+
+	UInt32 increment = 0;
+	bool overflow = false;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		StreamMap::iterator it = _streams.find(streamId);
+		if (it == _streams.end() || it->second->done || it->second->error >= 0) return;
+
+		Stream& stream = *it->second;
+		stream.recvWindow -= length;
+		if (stream.recvWindow < 0)
+		{
+			stream.error = HTTP2Frame::H2_ERR_FLOW_CONTROL;
+			overflow = true;
+			_condition.broadcast();
+		}
+		else
+		{
+			stream.recvConsumed += length;
+			if (stream.recvConsumed >= threshold)
+			{
+				increment = stream.recvConsumed;
+				stream.recvWindow += stream.recvConsumed;
+				stream.recvConsumed = 0;
+			}
+		}
+	}
+	if (overflow)
+		sendRstStream(streamId, HTTP2Frame::H2_ERR_FLOW_CONTROL);
+	else if (increment > 0)
+		sendWindowUpdate(streamId, increment);
+}
+
+
+void HTTP2ClientSession::checkOpen() const
+{
+	if (_closed)
+		throw NetException(_error);
+	if (_goAwayReceived)
+		throw HTTP2Exception("HTTP/2 connection is shutting down", HTTP2Frame::H2_ERR_REFUSED_STREAM);
+}
+
+
+void HTTP2ClientSession::openStream(Stream& stream, const HTTPRequest& request, std::size_t contentLength)
+{
+	long timeout = static_cast<long>(getTimeout().totalMilliseconds());
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		for (;;)
+		{
+			checkOpen();
+			if (static_cast<UInt32>(_openStreams) < _peerMaxConcurrentStreams) break;
+			if (!_condition.tryWait(_mutex, timeout))
+				throw TimeoutException("Timed out waiting for HTTP/2 stream");
+		}
+		++_openStreams;
+	}
+	try
+	{
+		Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+		// Stream identifiers must be used in increasing order,
+		// so allocating and sending HEADERS cannot be separated.
+		UInt32 streamId = _nextStreamId;
+		if (streamId > MAX_STREAM_ID)
+			throw HTTP2Exception("HTTP/2 stream identifiers exhausted", HTTP2Frame::H2_ERR_REFUSED_STREAM);
+		{
+			Poco::FastMutex::ScopedLock streamLock(_mutex);
+
+			checkOpen();
+			stream.id = streamId;
+			stream.sendWindow = _peerInitialWindowSize;
+			stream.endStreamSent = (contentLength == 0);
+			_streams[streamId] = &stream;
+		}
+		_nextStreamId = streamId + 2;
+		sendHeaders(stream, request, contentLength);
+	}
+	catch (...)
+	{
+		closeStream(stream);
+		throw;
+	}
+}
+
+
+void HTTP2ClientSession::closeStream(Stream& stream)
+{
+	bool cancel = false;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (stream.id != 0)
+		{
+			_streams.erase(stream.id);
+			cancel = !_closed && stream.error < 0 && (!stream.done || !stream.endStreamSent);
+		}
+		--_openStreams;
+		_lastUsed.update();
+		_condition.broadcast();
+	}
+	if (cancel)
+	{
+		try
+		{
+			sendRstStream(stream.id, HTTP2Frame::H2_ERR_CANCEL);
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+}
+
+
+void HTTP2ClientSession::waitForResponse(Stream& stream)
+{
+	Poco::Timespan::TimeDiff timeout = _timeout;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		if (stream.done) return;
+		if (stream.error == HTTP2Frame::H2_ERR_REFUSED_STREAM)
+			throw HTTP2Exception("HTTP/2 stream refused by server", HTTP2Frame::H2_ERR_REFUSED_STREAM);
+		if (stream.error >= 0)
+			throw HTTP2Exception("HTTP/2 stream reset", stream.error);
+		if (_closed)
+			throw NetException(_error);
+
+		Poco::Timespan::TimeDiff remaining = timeout - stream.lastActivity.elapsed();
+		if (remaining <= 0)
+			throw TimeoutException("No response received from HTTP/2 server");
+		_condition.tryWait(_mutex, static_cast<long>(remaining/1000 + 1));
+	}
+}
+
+
+void HTTP2ClientSession::shutdown(const std::string& error)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (!_closed)
+	{
+		_error = error;
+		_closed = true;
+	}
+	_condition.broadcast();
+}
+
+
+void HTTP2ClientSession::writeFrame(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+	writeFrameImpl(type, flags, streamId, pPayload, length);
+}
+
+
+void HTTP2ClientSession::writeFrameImpl(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length)
+{
+	if (_closed) throw NetException("HTTP/2 connection closed");
+
+	HTTP2Frame frame(type, flags, streamId, static_cast<UInt32>(length));
+	_writeBuffer.resize(HTTP2Frame::HEADER_SIZE + length, false);
+	frame.write(_writeBuffer.begin());
+	if (length > 0)
+	{
+		std::memcpy(_writeBuffer.begin() + HTTP2Frame::HEADER_SIZE, pPayload, length);
+	}
+	_socket.sendBytes(_writeBuffer.begin(), static_cast<int>(_writeBuffer.size()));
+}
+
+
+void HTTP2ClientSession::sendPreface()
+{
+	const std::string& preface = HTTP2Frame::CONNECTION_PREFACE;
+	_socket.sendBytes(preface.data(), static_cast<int>(preface.size()));
+
+	char payload[18];
+	const UInt16 ids[3] =
+	{
+		HTTP2Frame::SETTING_ENABLE_PUSH,
+		HTTP2Frame::SETTING_INITIAL_WINDOW_SIZE,
+		HTTP2Frame::SETTING_MAX_HEADER_LIST_SIZE
+	};
+	const UInt32 values[3] =
+	{
+		0,
+		DEFAULT_INITIAL_WINDOW_SIZE,
+		static_cast<UInt32>(MAX_HEADER_LIST_SIZE)
+	};
+	for (int i = 0; i < 3; ++i)
+	{
+		payload[6*i]     = static_cast<char>(ids[i] >> 8);
+		payload[6*i + 1] = static_cast<char>(ids[i] & 0xFF);
+		HTTP2Frame::writeUInt32(payload + 6*i + 2, values[i]);
+	}
+	writeFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, 0, 0, payload, sizeof(payload));
+	sendWindowUpdate(0, static_cast<UInt32>(DEFAULT_INITIAL_WINDOW_SIZE) - HTTP2Frame::DEFAULT_WINDOW_SIZE);
+}
+
+
+void HTTP2ClientSession::sendWindowUpdate(UInt32 streamId, UInt32 increment)
+{
+	char payload[4];
+	HTTP2Frame::writeUInt32(payload, increment);
+	writeFrame(HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE, 0, streamId, payload, sizeof(payload));
+}
+
+
+void HTTP2ClientSession::sendRstStream(UInt32 streamId, HTTP2Frame::ErrorCode error)
+{
+	char payload[4];
+	HTTP2Frame::writeUInt32(payload, error);
+	writeFrame(HTTP2Frame::FRAME_TYPE_RST_STREAM, 0, streamId, payload, sizeof(payload));
+}
+
+
+void HTTP2ClientSession::sendGoAway(HTTP2Frame::ErrorCode error)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+	if (_goAwaySent) return;
+	char payload[8];
+	// We never accept streams initiated by the server.
+	HTTP2Frame::writeUInt32(payload, 0);
+	HTTP2Frame::writeUInt32(payload + 4, error);
+	_goAwaySent = true;
+	writeFrameImpl(HTTP2Frame::FRAME_TYPE_GOAWAY, 0, 0, payload, sizeof(payload));
+}
+
+
+void HTTP2ClientSession::sendHeaders(Stream& stream, const HTTPRequest& request, std::size_t contentLength)
+{
+	// Must be called with _writeMutex locked, as encoding and sending
+	// must not be interleaved with other header blocks.
+	std::string block;
+	_encoder.beginBlock(block);
+	_encoder.encode(":method"s, request.getMethod(), block);
+	_encoder.encode(":scheme"s, secure() ? "https"s : "http"s, block);
+	_encoder.encode(":authority"s, request.has(HTTPRequest::HOST) ? request.getHost() : _authority, block);
+	_encoder.encode(":path"s, request.getURI().empty() ? "/"s : request.getURI(), block);
+	for (const auto& h: request)
+	{
+		std::string name = Poco::toLower(h.first);
+		if (isConnectionHeader(name) || name == "host" || name == "content-length") continue;
+		if (name == "te" && Poco::icompare(h.second, "trailers"s) != 0) continue;
+		bool sensitive = (name == "authorization" || name == "proxy-authorization");
+		_encoder.encode(name, h.second, block, sensitive);
+	}
+	const std::string& method = request.getMethod();
+	if (contentLength > 0 || method == HTTPRequest::HTTP_POST || method == HTTPRequest::HTTP_PUT || method == HTTPRequest::HTTP_PATCH)
+	{
+		_encoder.encode("content-length"s, NumberFormatter::format(static_cast<UInt64>(contentLength)), block);
+	}
+
+	std::size_t maxFrameSize = _peerMaxFrameSize;
+	std::size_t pos = 0;
+	HTTP2Frame::FrameType type = HTTP2Frame::FRAME_TYPE_HEADERS;
+	do
+	{
+		std::size_t n = std::min(block.size() - pos, maxFrameSize);
+		UInt8 flags = 0;
+		if (pos + n == block.size()) flags |= HTTP2Frame::FRAME_FLAG_END_HEADERS;
+		if (type == HTTP2Frame::FRAME_TYPE_HEADERS && contentLength == 0) flags |= HTTP2Frame::FRAME_FLAG_END_STREAM;
+		writeFrameImpl(type, flags, stream.id, block.data() + pos, n);
+		pos += n;
+		type = HTTP2Frame::FRAME_TYPE_CONTINUATION;
+	}
+	while (pos < block.size());
+}
+
+
+void HTTP2ClientSession::sendData(Stream& stream, const char* pData, std::size_t length)
+{
+	while (length > 0)
+	{
+		std::size_t n = acquireSendWindow(stream, std::min<std::size_t>(length, _peerMaxFrameSize));
+		if (n == 0) break;
+
+		UInt8 flags = (n == length) ? HTTP2Frame::FRAME_FLAG_END_STREAM : 0;
+		writeFrame(HTTP2Frame::FRAME_TYPE_DATA, flags, stream.id, pData, n);
+		pData += n;
+		length -= n;
+	}
+	if (length == 0)
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		stream.endStreamSent = true;
+	}
+}
+
+
+std::size_t HTTP2ClientSession::acquireSendWindow(Stream& stream, std::size_t length)
+{
+	long timeout = static_cast<long>(getTimeout().totalMilliseconds());
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		if (_closed) throw NetException(_error);
+		if (stream.error >= 0) return 0;
+		// The server may respond before it has read the complete
+		// request body; we then stop sending it.
+		if (stream.done) return 0;
+
+		Int64 window = std::min(_sendWindow, stream.sendWindow);
+		if (window > 0)
+		{
+			std::size_t n = static_cast<std::size_t>(std::min<Int64>(window, static_cast<Int64>(length)));
+			_sendWindow -= n;
+			stream.sendWindow -= n;
+			return n;
+		}
+		if (!_condition.tryWait(_mutex, timeout))
+			throw TimeoutException("Timed out waiting for HTTP/2 flow-control window");
+	}
+}
+
+
+} // namespace Poco::Net
@@ -0,0 +1,84 @@
+//
+// HTTP2Frame.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Frame
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2Frame.h"
+
+
+namespace Poco::Net {
+
+
+const std::string HTTP2Frame::CONNECTION_PREFACE("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n");
+
+
+HTTP2Frame::HTTP2Frame():
+	_type(FRAME_TYPE_DATA),
+	_flags(0),
+	_streamId(0),
+	_length(0)
+{
+}
+
+
+HTTP2Frame::HTTP2Frame(FrameType type, UInt8 flags, UInt32 streamId, UInt32 length):
+	_type(type),
+	_flags(flags),
+	_streamId(streamId),
+	_length(length)
+{
+}
+
+
+HTTP2Frame::~HTTP2Frame()
+{
+}
+
+
+void HTTP2Frame::write(char* pBuffer) const
+{
+	pBuffer[0] = static_cast<char>((_length >> 16) & 0xFF);
+	pBuffer[1] = static_cast<char>((_length >> 8) & 0xFF);
+	pBuffer[2] = static_cast<char>(_length & 0xFF);
+	pBuffer[3] = static_cast<char>(_type);
+	pBuffer[4] = static_cast<char>(_flags);
+	writeUInt32(pBuffer + 5, _streamId & 0x7FFFFFFF);
+}
+
+
+void HTTP2Frame::read(const char* pBuffer)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(pBuffer);
+	_length = (UInt32(p[0]) << 16) | (UInt32(p[1]) << 8) | UInt32(p[2]);
+	_type = static_cast<FrameType>(p[3]);
+	_flags = p[4];
+	_streamId = readUInt32(pBuffer + 5) & 0x7FFFFFFF;
+}
+
+
+UInt32 HTTP2Frame::readUInt32(const char* pBuffer)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(pBuffer);
+	return (UInt32(p[0]) << 24) | (UInt32(p[1]) << 16) | (UInt32(p[2]) << 8) | UInt32(p[3]);
+}
+
+
+void HTTP2Frame::writeUInt32(char* pBuffer, UInt32 value)
+{
+	pBuffer[0] = static_cast<char>((value >> 24) & 0xFF);
+	pBuffer[1] = static_cast<char>((value >> 16) & 0xFF);
+	pBuffer[2] = static_cast<char>((value >> 8) & 0xFF);
+	pBuffer[3] = static_cast<char>(value & 0xFF);
+}
+
+
+} // namespace Poco::Net
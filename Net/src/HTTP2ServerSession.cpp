@@ -0,0 +1,1382 @@
+//
+// HTTP2ServerSession.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerSession
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPFileCache.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/BufferedStreamBuf.h"
+#include "Poco/MemoryStream.h"
+#include "Poco/NullStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Runnable.h"
+#include "Poco/Timestamp.h"
+#include "Poco/String.h"
+#include <cstring>
+#include <memory>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	const std::string HTTP_2_0("HTTP/2.0");
+	const std::size_t MAX_HEADER_LIST_SIZE = 65536;
+	const std::size_t MAX_HEADER_BLOCK_SIZE = 4*MAX_HEADER_LIST_SIZE;
+
+	bool isConnectionHeader(const std::string& name)
+		/// Returns true if the given (lowercase) header name denotes
+		/// a connection-specific header field, which must not be
+		/// used with HTTP/2 (RFC 9113, Section 8.2.2).
+	{
+		return name == "connection" || name == "keep-alive" || name == "proxy-connection" ||
+			name == "transfer-encoding" || name == "upgrade";
+	}
+
+	bool isValidRequest(const HPACKDecoder::HeaderList& headers, std::string& method)
+		/// Checks the pseudo-header fields and header field names
+		/// of a request (RFC 9113, Section 8.3.1).
+	{
+		bool regularSeen = false;
+		bool hasPath = false;
+		method.clear();
+		for (const auto& h: headers)
+		{
+			const std::string& name = h.first;
+			if (name.empty()) return false;
+			for (char c: name)
+			{
+				if (c >= 'A' && c <= 'Z') return false;
+			}
+			if (name[0] == ':')
+			{
+				if (regularSeen) return false;
+				if (name == ":method")
+				{
+					if (!method.empty() || h.second.empty()) return false;
+					method = h.second;
+				}
+				else if (name == ":path")
+				{
+					if (hasPath || h.second.empty()) return false;
+					hasPath = true;
+				}
+				else if (name != ":scheme" && name != ":authority")
+				{
+					return false;
+				}
+			}
+			else
+			{
+				regularSeen = true;
+				if (isConnectionHeader(name)) return false;
+				if (name == "te" && h.second != "trailers") return false;
+			}
+		}
+		return !method.empty() && (hasPath || method == HTTPRequest::HTTP_CONNECT);
+	}
+}
+
+
+//
+// HTTP2ServerSession::Stream
+//
+
+
+class HTTP2ServerSession::Stream: public Poco::RefCountedObject
+	/// The state of a single HTTP/2 stream.
+	///
+	/// headers, body, endStreamReceived, recvWindow and recvConsumed
+	/// are only used by the thread reading the connection, until the
+	/// stream has been dispatched. sendWindow and reset are guarded
+	/// by the session mutex.
+{
+public:
+	Stream(UInt32 streamId, Int64 initialSendWindow, Int64 initialRecvWindow):
+		id(streamId),
+		head(false),
+		endStreamReceived(false),
+		dispatched(false),
+		recvWindow(initialRecvWindow),
+		recvConsumed(0),
+		sendWindow(initialSendWindow),
+		reset(false)
+	{
+	}
+
+	const UInt32 id;
+	HPACKDecoder::HeaderList headers;
+	std::string body;
+	bool head;
+	bool endStreamReceived;
+	bool dispatched;
+	Int64 recvWindow;
+	UInt32 recvConsumed;
+	Int64 sendWindow;
+	bool reset;
+
+protected:
+	~Stream() = default;
+};
+
+
+//
+// HTTP2ServerSession::OutputStreamBuf
+//
+
+
+class HTTP2ServerSession::OutputStreamBuf: public Poco::BufferedStreamBuf
+	/// The streambuf for a response body, which
+	/// is sent in DATA frames.
+{
+public:
+	OutputStreamBuf(HTTP2ServerSession& session, Stream& stream):
+		Poco::BufferedStreamBuf(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE, std::ios::out),
+		_session(session),
+		_stream(stream)
+	{
+	}
+
+protected:
+	std::streamsize writeToDevice(const char* buffer, std::streamsize length) override
+	{
+		_session.sendData(_stream, buffer, static_cast<std::size_t>(length), false);
+		return length;
+	}
+
+private:
+	HTTP2ServerSession& _session;
+	Stream& _stream;
+};
+
+
+//
+// HTTP2ServerSession::Response
+//
+
+
+class HTTP2ServerSession::Response: public HTTPServerResponse
+	/// The HTTPServerResponse passed to request handlers.
+{
+public:
+	Response(HTTP2ServerSession& session, Stream& stream):
+		_session(session),
+		_stream(stream),
+		_pRequest(nullptr),
+		_headersSent(false),
+		_endStreamSent(false)
+	{
+	}
+
+	~Response()
+	{
+	}
+
+	void attachRequest(HTTPServerRequest* pRequest)
+	{
+		_pRequest = pRequest;
+	}
+
+	void sendContinue() override
+	{
+		// The request body has already been received
+		// completely when the request handler is invoked.
+	}
+
+	std::ostream& send() override
+	{
+		poco_assert (!_pStream);
+
+		if (_stream.head ||
+			getStatus() < 200 ||
+			getStatus() == HTTPResponse::HTTP_NO_CONTENT ||
+			getStatus() == HTTPResponse::HTTP_NOT_MODIFIED)
+		{
+			sendHeaders(true);
+			_pStream = std::make_unique<Poco::NullOutputStream>();
+		}
+		else
+		{
+			sendHeaders(false);
+			_pStreamBuf = std::make_unique<OutputStreamBuf>(_session, _stream);
+			_pStream = std::make_unique<std::ostream>(_pStreamBuf.get());
+		}
+		return *_pStream;
+	}
+
+	void sendFile(const std::string& path, const std::string& mediaType) override
+	{
+		poco_assert (!_pStream);
+
+		File::FileSize length = 0;
+		HTTPFileCache::Ptr pCache = _session._pParams->getFileCache();
+		if (pCache)
+		{
+			HTTPFileCache::EntryPtr pEntry = pCache->get(path);
+			set("Last-Modified"s, pEntry->lastModifiedHeader);
+			set("ETag"s, pEntry->etag);
+			if (_pRequest && HTTPFileCache::notModified(*_pRequest, *pEntry))
+			{
+				setStatusAndReason(HTTPResponse::HTTP_NOT_MODIFIED);
+				sendHeaders(true);
+				return;
+			}
+			length = pEntry->size;
+		}
+		else
+		{
+			File f(path);
+			set("Last-Modified"s, DateTimeFormatter::format(f.getLastModified(), DateTimeFormat::HTTP_FORMAT));
+			length = f.getSize();
+		}
+
+		Poco::FileInputStream istr(path);
+		if (!istr.good()) throw OpenFileException(path);
+
+		setContentLength64(length);
+		setContentType(mediaType);
+		setChunkedTransferEncoding(false);
+		std::ostream& ostr = send();
+		if (!_stream.head)
+		{
+			Poco::StreamCopier::copyStream(istr, ostr, HTTP2Frame::DEFAULT_MAX_FRAME_SIZE);
+		}
+	}
+
+	void sendBuffer(const void* pBuffer, std::size_t length) override
+	{
+		poco_assert (!_pStream);
+
+		setContentLength64(length);
+		setChunkedTransferEncoding(false);
+		if (_stream.head || length == 0)
+		{
+			sendHeaders(true);
+		}
+		else
+		{
+			sendHeaders(false);
+			_endStreamSent = true;
+			_session.sendData(_stream, static_cast<const char*>(pBuffer), length, true);
+		}
+		_pStream = std::make_unique<Poco::NullOutputStream>();
+	}
+
+	void redirect(const std::string& uri, HTTPStatus status) override
+	{
+		poco_assert (!_pStream);
+
+		setContentLength(0);
+		setChunkedTransferEncoding(false);
+
+		setStatusAndReason(status);
+		set("Location"s, uri);
+
+		sendHeaders(true);
+		_pStream = std::make_unique<Poco::NullOutputStream>();
+	}
+
+	void requireAuthentication(const std::string& realm) override
+	{
+		poco_assert (!_pStream);
+
+		setStatusAndReason(HTTPResponse::HTTP_UNAUTHORIZED);
+		std::string auth("Basic realm=\"");
+		auth.append(realm);
+		auth.append("\"");
+		set("WWW-Authenticate"s, auth);
+	}
+
+	bool sent() const override
+	{
+		return _headersSent;
+	}
+
+	void finish()
+		/// Completes the response after the request handler
+		/// has returned, by sending any buffered body data and
+		/// ending the stream.
+	{
+		if (!_headersSent)
+		{
+			sendHeaders(true);
+		}
+		else if (!_endStreamSent)
+		{
+			if (_pStreamBuf && _pStreamBuf->pubsync() == -1)
+				throw NetException("Failed to send HTTP/2 response body");
+			_endStreamSent = true;
+			_session.sendData(_stream, nullptr, 0, true);
+		}
+	}
+
+private:
+	void sendHeaders(bool endStream)
+	{
+		_headersSent = true;
+		_endStreamSent = endStream;
+		_session.sendHeaders(_stream, *this, endStream);
+	}
+
+	HTTP2ServerSession& _session;
+	Stream& _stream;
+	HTTPServerRequest* _pRequest;
+	std::unique_ptr<OutputStreamBuf> _pStreamBuf;
+	std::unique_ptr<std::ostream> _pStream;
+	bool _headersSent;
+	bool _endStreamSent;
+};
+
+
+//
+// HTTP2ServerSession::Request
+//
+
+
+class HTTP2ServerSession::Request: public HTTPServerRequest
+	/// The HTTPServerRequest passed to request handlers.
+{
+public:
+	Request(HTTP2ServerSession& session, Stream& stream, Response& response):
+		_session(session),
+		_response(response),
+		_istr(stream.body.data(), stream.body.size())
+	{
+		response.attachRequest(this);
+
+		setVersion(HTTP_2_0);
+		std::string cookie;
+		bool hasAuthority = false;
+		for (const auto& h: stream.headers)
+		{
+			if (h.first == ":method")
+			{
+				setMethod(h.second);
+			}
+			else if (h.first == ":path")
+			{
+				setURI(h.second);
+			}
+			else if (h.first == ":authority")
+			{
+				setHost(h.second);
+				hasAuthority = true;
+			}
+			else if (h.first == "cookie")
+			{
+				// Cookies may be split into multiple header
+				// fields (RFC 9113, Section 8.2.3).
+				if (!cookie.empty()) cookie.append("; ");
+				cookie.append(h.second);
+			}
+			else if (h.first[0] != ':' && !(hasAuthority && h.first == "host"))
+			{
+				add(h.first, h.second);
+			}
+		}
+		if (!cookie.empty()) set("Cookie"s, cookie);
+	}
+
+	~Request()
+	{
+	}
+
+	std::istream& stream() override
+	{
+		return _istr;
+	}
+
+	const SocketAddress& clientAddress() const override
+	{
+		return _session._clientAddress;
+	}
+
+	const SocketAddress& serverAddress() const override
+	{
+		return _session._serverAddress;
+	}
+
+	const HTTPServerParams& serverParams() const override
+	{
+		return *_session._pParams;
+	}
+
+	HTTPServerResponse& response() const override
+	{
+		return _response;
+	}
+
+	bool secure() const override
+	{
+		return _session._socket.secure();
+	}
+
+private:
+	HTTP2ServerSession& _session;
+	Response& _response;
+	Poco::MemoryInputStream _istr;
+};
+
+
+//
+// HTTP2ServerSession::Task
+//
+
+
+class HTTP2ServerSession::Task: public Poco::Runnable
+	/// Runs the request handler for a stream. The Task
+	/// deletes itself when the request has been processed.
+{
+public:
+	Task(HTTP2ServerSession& session, StreamPtr pStream):
+		_session(session),
+		_pStream(pStream)
+	{
+	}
+
+	void run() override
+	{
+		std::unique_ptr<Task> guard(this);
+		_session.processRequest(*_pStream);
+	}
+
+private:
+	HTTP2ServerSession& _session;
+	StreamPtr _pStream;
+};
+
+
+//
+// HTTP2ServerSession
+//
+
+
+HTTP2ServerSession::HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory):
+	HTTP2ServerSession(socket, pParams, pFactory, Poco::ActiveThreadPool::defaultPool())
+{
+}
+
+
+HTTP2ServerSession::HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ActiveThreadPool& threadPool):
+	_socket(socket),
+	_pParams(pParams),
+	_pFactory(pFactory),
+	_threadPool(threadPool),
+	_receivedPos(0),
+	_payload(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_decoder(HTTP2Frame::DEFAULT_TABLE_SIZE),
+	_continuationStreamId(0),
+	_continuationEndStream(false),
+	_lastStreamId(0),
+	_recvWindow(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_recvConsumed(0),
+	_goAwayReceived(false),
+	_activeTasks(0),
+	_sendWindow(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_peerInitialWindowSize(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_peerMaxFrameSize(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_closed(false),
+	_stopped(false),
+	_encoder(HTTP2Frame::DEFAULT_TABLE_SIZE),
+	_writeBuffer(HTTP2Frame::HEADER_SIZE + HTTP2Frame::DEFAULT_MAX_FRAME_SIZE),
+	_goAwaySent(false)
+{
+	poco_check_ptr (pParams);
+	poco_check_ptr (pFactory);
+
+	_decoder.setMaxHeaderListSize(MAX_HEADER_LIST_SIZE);
+}
+
+
+HTTP2ServerSession::~HTTP2ServerSession()
+{
+}
+
+
+void HTTP2ServerSession::run()
+{
+	run(nullptr, 0);
+}
+
+
+void HTTP2ServerSession::run(const char* pReceived, std::size_t length)
+{
+	if (length > 0) _received.assign(pReceived, length);
+	_receivedPos = 0;
+
+	std::unique_ptr<Poco::Exception> pException;
+	try
+	{
+		_clientAddress = _socket.peerAddress();
+		_serverAddress = _socket.address();
+
+		readPreface();
+		sendSettings();
+		Int64 windowSize = _pParams->getInitialWindowSize();
+		if (windowSize > HTTP2Frame::DEFAULT_WINDOW_SIZE)
+		{
+			sendWindowUpdate(0, static_cast<UInt32>(windowSize - HTTP2Frame::DEFAULT_WINDOW_SIZE));
+			_recvWindow = windowSize;
+		}
+		_socket.setReceiveTimeout(_pParams->getKeepAliveTimeout());
+
+		HTTP2Frame frame;
+		bool first = true;
+		while (readFrame(frame))
+		{
+			if (first && frame.type() != HTTP2Frame::FRAME_TYPE_SETTINGS)
+				throw HTTP2Exception("Expected SETTINGS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+			first = false;
+
+			handleFrame(frame);
+			if (_goAwayReceived && activeStreams() == 0) break;
+		}
+		try
+		{
+			sendGoAway(HTTP2Frame::H2_ERR_NONE);
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+	catch (HTTP2Exception& exc)
+	{
+		// Protocol errors are the client's fault, so, like malformed
+		// HTTP/1.1 requests, they are not reported to the ErrorHandler.
+		try
+		{
+			sendGoAway(static_cast<HTTP2Frame::ErrorCode>(exc.code()));
+		}
+		catch (Poco::Exception&)
+		{
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		pException.reset(exc.clone());
+	}
+	close();
+	if (pException) pException->rethrow();
+}
+
+
+void HTTP2ServerSession::stop()
+{
+	_stopped = true;
+	try
+	{
+		sendGoAway(HTTP2Frame::H2_ERR_NONE);
+	}
+	catch (Poco::Exception&)
+	{
+	}
+}
+
+
+int HTTP2ServerSession::activeStreams() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return static_cast<int>(_streams.size());
+}
+
+
+bool HTTP2ServerSession::receive(char* pBuffer, std::size_t length, bool frameStart)
+{
+	std::size_t received = 0;
+	while (received < length)
+	{
+		if (_receivedPos < _received.size())
+		{
+			std::size_t n = std::min(length - received, _received.size() - _receivedPos);
+			std::memcpy(pBuffer + received, _received.data() + _receivedPos, n);
+			_receivedPos += n;
+			received += n;
+			continue;
+		}
+
+		// Wait for data without blocking in receiveBytes(), as a
+		// secure socket cannot be written to by request handlers
+		// while a thread is blocked reading it. available() accounts
+		// for data that has already been decrypted.
+		if (_socket.available() <= 0 && !_socket.poll(_pParams->getKeepAliveTimeout(), Socket::SELECT_READ | Socket::SELECT_ERROR))
+		{
+			if (!frameStart || received > 0) throw Poco::TimeoutException("Timed out receiving HTTP/2 frame");
+			// The connection is idle if there are no open streams;
+			// otherwise we keep waiting for the client.
+			if (activeStreams() == 0) return false;
+			continue;
+		}
+		int n = _socket.receiveBytes(pBuffer + received, static_cast<int>(length - received));
+		if (n <= 0)
+		{
+			if (frameStart && received == 0) return false;
+			throw NetException("HTTP/2 connection closed in the middle of a frame");
+		}
+		received += n;
+	}
+	return true;
+}
+
+
+void HTTP2ServerSession::readPreface()
+{
+	const std::string& preface = HTTP2Frame::CONNECTION_PREFACE;
+	char buffer[32];
+	receive(buffer, preface.size(), false);
+	if (std::memcmp(buffer, preface.data(), preface.size()) != 0)
+		throw HTTP2Exception("Invalid connection preface", HTTP2Frame::H2_ERR_PROTOCOL);
+}
+
+
+bool HTTP2ServerSession::readFrame(HTTP2Frame& frame)
+{
+	char header[HTTP2Frame::HEADER_SIZE];
+	if (!receive(header, HTTP2Frame::HEADER_SIZE, true)) return false;
+
+	frame.read(header);
+	if (frame.length() > HTTP2Frame::DEFAULT_MAX_FRAME_SIZE)
+		throw HTTP2Exception("Frame exceeds SETTINGS_MAX_FRAME_SIZE", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	_payload.resize(frame.length(), false);
+	if (frame.length() > 0)
+	{
+		receive(_payload.begin(), frame.length(), false);
+	}
+	return true;
+}
+
+
+void HTTP2ServerSession::handleFrame(const HTTP2Frame& frame)
+{
+	if (_continuationStreamId != 0 && frame.type() != HTTP2Frame::FRAME_TYPE_CONTINUATION)
+		throw HTTP2Exception("Expected CONTINUATION frame", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	switch (frame.type())
+	{
+	case HTTP2Frame::FRAME_TYPE_DATA:
+		handleData(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_HEADERS:
+		handleHeaders(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_PRIORITY:
+		// Stream prioritization is deprecated (RFC 9113, Section 5.3)
+		// and PRIORITY frames are ignored.
+		if (frame.streamId() == 0)
+			throw HTTP2Exception("PRIORITY frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+		if (frame.length() != 5)
+			resetStream(frame.streamId(), HTTP2Frame::H2_ERR_FRAME_SIZE);
+		break;
+	case HTTP2Frame::FRAME_TYPE_RST_STREAM:
+		handleRstStream(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_SETTINGS:
+		handleSettings(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_PUSH_PROMISE:
+		throw HTTP2Exception("PUSH_PROMISE frame received from client", HTTP2Frame::H2_ERR_PROTOCOL);
+	case HTTP2Frame::FRAME_TYPE_PING:
+		handlePing(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_GOAWAY:
+		if (frame.streamId() != 0)
+			throw HTTP2Exception("GOAWAY frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+		_goAwayReceived = true;
+		break;
+	case HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE:
+		handleWindowUpdate(frame);
+		break;
+	case HTTP2Frame::FRAME_TYPE_CONTINUATION:
+		handleContinuation(frame);
+		break;
+	default:
+		// Frames of unknown types must be ignored.
+		break;
+	}
+}
+
+
+void HTTP2ServerSession::handleData(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("DATA frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	const char* pData = _payload.begin();
+	std::size_t length = frame.length();
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PADDED))
+	{
+		std::size_t padding = length > 0 ? static_cast<UInt8>(pData[0]) : 0;
+		if (length == 0 || padding >= length)
+			throw HTTP2Exception("Invalid padding in DATA frame", HTTP2Frame::H2_ERR_PROTOCOL);
+		++pData;
+		length -= padding + 1;
+	}
+
+	StreamPtr pStream = findStream(streamId);
+	bool open = pStream && !pStream->endStreamReceived;
+	Poco::Int64 maxBodySize = _pParams->getMaxRequestBodySize();
+	bool tooLarge = open && maxBodySize > 0 && static_cast<Poco::Int64>(pStream->body.size() + length) > maxBodySize;
+	// The connection window is always replenished, but a stream
+	// exceeding the body size limit gets no further window.
+	consumeReceiveWindow(open && !tooLarge ? pStream.get() : nullptr, frame.length());
+	if (!open)
+	{
+		if (streamId > _lastStreamId)
+			throw HTTP2Exception("DATA frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+		sendRstStream(streamId, HTTP2Frame::H2_ERR_STREAM_CLOSED);
+		return;
+	}
+	if (tooLarge)
+	{
+		resetStream(streamId, HTTP2Frame::H2_ERR_CANCEL);
+		return;
+	}
+
+	pStream->body.append(pData, length);
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_STREAM))
+	{
+		pStream->endStreamReceived = true;
+		dispatch(pStream);
+	}
+}
+
+
+void HTTP2ServerSession::handleHeaders(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("HEADERS frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	const char* pData = _payload.begin();
+	std::size_t length = frame.length();
+	std::size_t padding = 0;
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PADDED))
+	{
+		if (length < 1)
+			throw HTTP2Exception("Invalid padding in HEADERS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+		padding = static_cast<UInt8>(pData[0]);
+		++pData;
+		--length;
+	}
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_PRIORITY))
+	{
+		if (length < 5)
+			throw HTTP2Exception("Invalid HEADERS frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+		pData += 5;
+		length -= 5;
+	}
+	if (padding > length)
+		throw HTTP2Exception("Invalid padding in HEADERS frame", HTTP2Frame::H2_ERR_PROTOCOL);
+	length -= padding;
+
+	_headerBlock.assign(pData, length);
+	_continuationEndStream = frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_STREAM);
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_HEADERS))
+		headerBlockComplete(streamId, _continuationEndStream);
+	else
+		_continuationStreamId = streamId;
+}
+
+
+void HTTP2ServerSession::handleContinuation(const HTTP2Frame& frame)
+{
+	if (_continuationStreamId == 0 || frame.streamId() != _continuationStreamId)
+		throw HTTP2Exception("Unexpected CONTINUATION frame", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (_headerBlock.size() + frame.length() > MAX_HEADER_BLOCK_SIZE)
+		throw HTTP2Exception("Header block too large", HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM);
+
+	_headerBlock.append(_payload.begin(), frame.length());
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_HEADERS))
+	{
+		UInt32 streamId = _continuationStreamId;
+		_continuationStreamId = 0;
+		headerBlockComplete(streamId, _continuationEndStream);
+	}
+}
+
+
+void HTTP2ServerSession::headerBlockComplete(UInt32 streamId, bool endStream)
+{
+	HPACKDecoder::HeaderList headers;
+	bool tooLarge = false;
+	try
+	{
+		_decoder.decode(_headerBlock.data(), _headerBlock.size(), headers);
+	}
+	catch (HTTP2Exception& exc)
+	{
+		if (exc.code() != HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM) throw;
+		tooLarge = true;
+	}
+	_headerBlock.clear();
+
+	StreamPtr pStream = findStream(streamId);
+	if (pStream)
+	{
+		// trailer section
+		if (pStream->endStreamReceived)
+		{
+			sendRstStream(streamId, HTTP2Frame::H2_ERR_STREAM_CLOSED);
+		}
+		else if (!endStream)
+		{
+			resetStream(streamId, HTTP2Frame::H2_ERR_PROTOCOL);
+		}
+		else
+		{
+			pStream->endStreamReceived = true;
+			dispatch(pStream);
+		}
+		return;
+	}
+
+	if ((streamId & 1) == 0 || streamId <= _lastStreamId)
+		throw HTTP2Exception("Invalid stream identifier", HTTP2Frame::H2_ERR_PROTOCOL);
+	_lastStreamId = streamId;
+
+	if (_stopped || activeStreams() >= _pParams->getMaxConcurrentStreams())
+	{
+		sendRstStream(streamId, HTTP2Frame::H2_ERR_REFUSED_STREAM);
+		return;
+	}
+
+	pStream = new Stream(streamId, 0, _pParams->getInitialWindowSize());
+	if (tooLarge)
+	{
+		HTTPResponse response(HTTPResponse::HTTP_REQUEST_HEADER_FIELDS_TOO_LARGE);
+		response.setContentLength(0);
+		sendHeaders(*pStream, response, true);
+		return;
+	}
+
+	std::string method;
+	if (!isValidRequest(headers, method))
+	{
+		sendRstStream(streamId, HTTP2Frame::H2_ERR_PROTOCOL);
+		return;
+	}
+	pStream->headers.swap(headers);
+	pStream->head = (method == HTTPRequest::HTTP_HEAD);
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		pStream->sendWindow = _peerInitialWindowSize;
+		_streams[streamId] = pStream;
+	}
+	if (endStream)
+	{
+		pStream->endStreamReceived = true;
+		dispatch(pStream);
+	}
+}
+
+
+void HTTP2ServerSession::handleRstStream(const HTTP2Frame& frame)
+{
+	UInt32 streamId = frame.streamId();
+	if (streamId == 0)
+		throw HTTP2Exception("RST_STREAM frame on stream 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.length() != 4)
+		throw HTTP2Exception("Invalid RST_STREAM frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+	if (streamId > _lastStreamId)
+		throw HTTP2Exception("RST_STREAM frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	StreamMap::iterator it = _streams.find(streamId);
+	if (it != _streams.end())
+	{
+		it->second->reset = true;
+		if (!it->second->dispatched) _streams.erase(it);
+		_condition.broadcast();
+	}
+}
+
+
+void HTTP2ServerSession::handleSettings(const HTTP2Frame& frame)
+{
+	if (frame.streamId() != 0)
+		throw HTTP2Exception("SETTINGS frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK))
+	{
+		if (frame.length() != 0)
+			throw HTTP2Exception("Invalid SETTINGS acknowledgement", HTTP2Frame::H2_ERR_FRAME_SIZE);
+		return;
+	}
+	if (frame.length() % 6 != 0)
+		throw HTTP2Exception("Invalid SETTINGS frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	const char* p = _payload.begin();
+	for (UInt32 i = 0; i < frame.length(); i += 6)
+	{
+		UInt16 id = static_cast<UInt16>((static_cast<UInt8>(p[i]) << 8) | static_cast<UInt8>(p[i + 1]));
+		UInt32 value = HTTP2Frame::readUInt32(p + i + 2);
+		switch (id)
+		{
+		case HTTP2Frame::SETTING_HEADER_TABLE_SIZE:
+			{
+				Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+				_encoder.setMaxTableSize(std::min<UInt32>(value, HTTP2Frame::DEFAULT_TABLE_SIZE));
+			}
+			break;
+		case HTTP2Frame::SETTING_ENABLE_PUSH:
+			if (value > 1)
+				throw HTTP2Exception("Invalid SETTINGS_ENABLE_PUSH value", HTTP2Frame::H2_ERR_PROTOCOL);
+			break;
+		case HTTP2Frame::SETTING_INITIAL_WINDOW_SIZE:
+			{
+				if (value > HTTP2Frame::MAX_WINDOW_SIZE)
+					throw HTTP2Exception("Invalid SETTINGS_INITIAL_WINDOW_SIZE value", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+
+				Poco::FastMutex::ScopedLock lock(_mutex);
+
+				Int64 delta = static_cast<Int64>(value) - _peerInitialWindowSize;
+				_peerInitialWindowSize = value;
+				for (auto& s: _streams)
+				{
+					s.second->sendWindow += delta;
+					if (s.second->sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+						throw HTTP2Exception("Flow-control window too large", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+				}
+				_condition.broadcast();
+			}
+			break;
+		case HTTP2Frame::SETTING_MAX_FRAME_SIZE:
+			if (value < HTTP2Frame::DEFAULT_MAX_FRAME_SIZE || value > HTTP2Frame::MAX_MAX_FRAME_SIZE)
+				throw HTTP2Exception("Invalid SETTINGS_MAX_FRAME_SIZE value", HTTP2Frame::H2_ERR_PROTOCOL);
+			_peerMaxFrameSize = value;
+			break;
+		default:
+			// SETTINGS_MAX_CONCURRENT_STREAMS only limits pushed
+			// streams, and unknown settings must be ignored.
+			break;
+		}
+	}
+	writeFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, HTTP2Frame::FRAME_FLAG_ACK, 0, nullptr, 0);
+}
+
+
+void HTTP2ServerSession::handlePing(const HTTP2Frame& frame)
+{
+	if (frame.streamId() != 0)
+		throw HTTP2Exception("PING frame on stream other than 0", HTTP2Frame::H2_ERR_PROTOCOL);
+	if (frame.length() != 8)
+		throw HTTP2Exception("Invalid PING frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	if (!frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK))
+	{
+		writeFrame(HTTP2Frame::FRAME_TYPE_PING, HTTP2Frame::FRAME_FLAG_ACK, 0, _payload.begin(), 8);
+	}
+}
+
+
+void HTTP2ServerSession::handleWindowUpdate(const HTTP2Frame& frame)
+{
+	if (frame.length() != 4)
+		throw HTTP2Exception("Invalid WINDOW_UPDATE frame", HTTP2Frame::H2_ERR_FRAME_SIZE);
+
+	UInt32 streamId = frame.streamId();
+	UInt32 increment = HTTP2Frame::readUInt32(_payload.begin()) & 0x7FFFFFFF;
+	if (streamId == 0)
+	{
+		if (increment == 0)
+			throw HTTP2Exception("Invalid WINDOW_UPDATE increment", HTTP2Frame::H2_ERR_PROTOCOL);
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_sendWindow += increment;
+		if (_sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+			throw HTTP2Exception("Flow-control window too large", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+		_condition.broadcast();
+	}
+	else
+	{
+		if (streamId > _lastStreamId)
+			throw HTTP2Exception("WINDOW_UPDATE frame on idle stream", HTTP2Frame::H2_ERR_PROTOCOL);
+		if (increment == 0)
+		{
+			resetStream(streamId, HTTP2Frame::H2_ERR_PROTOCOL);
+			return;
+		}
+
+		bool overflow = false;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			StreamMap::iterator it = _streams.find(streamId);
+			if (it != _streams.end())
+			{
+				it->second->sendWindow += increment;
+				overflow = it->second->sendWindow > HTTP2Frame::MAX_WINDOW_SIZE;
+				_condition.broadcast();
+			}
+		}
+		if (overflow) resetStream(streamId, HTTP2Frame::H2_ERR_FLOW_CONTROL);
+	}
+}
+
+
+void HTTP2ServerSession::consumeReceiveWindow(Stream* pStream, UInt32 length)
+{
+	if (length == 0) return;
+
+	UInt32 threshold = static_cast<UInt32>(_pParams->getInitialWindowSize()/2);
+	_recvWindow -= length;
+	if (_recvWindow < 0)
+		throw HTTP2Exception("Connection flow-control window exceeded", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+	_recvConsumed += length;
+	if (_recvConsumed >= threshold)
+	{
+		sendWindowUpdate(0, _recvConsumed);
+		_recvWindow += _recvConsumed;
+		_recvConsumed = 0;
+	}
+
+	if (pStream)
+	{
+		pStream->recvWindow -= length;
+		if (pStream->recvWindow < 0)
+			throw HTTP2Exception("Stream flow-control window exceeded", HTTP2Frame::H2_ERR_FLOW_CONTROL);
+		pStream->recvConsumed += length;
+		if (pStream->recvConsumed >= threshold)
+		{
+			sendWindowUpdate(pStream->id, pStream->recvConsumed);
+			pStream->recvWindow += pStream->recvConsumed;
+			pStream->recvConsumed = 0;
+		}
+	}
+}
+
+
+void HTTP2ServerSession::resetStream(UInt32 streamId, HTTP2Frame::ErrorCode error)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		StreamMap::iterator it = _streams.find(streamId);
+		if (it != _streams.end())
+		{
+			it->second->reset = true;
+			if (!it->second->dispatched) _streams.erase(it);
+			_condition.broadcast();
+		}
+	}
+	sendRstStream(streamId, error);
+}
+
+
+void HTTP2ServerSession::dispatch(StreamPtr pStream)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		pStream->dispatched = true;
+		++_activeTasks;
+	}
+	Task* pTask = new Task(*this, pStream);
+	try
+	{
+		_threadPool.start(*pTask);
+	}
+	catch (Poco::Exception&)
+	{
+		delete pTask;
+		streamDone(*pStream);
+		sendRstStream(pStream->id, HTTP2Frame::H2_ERR_REFUSED_STREAM);
+	}
+}
+
+
+void HTTP2ServerSession::processRequest(Stream& stream)
+{
+	Response response(*this, stream);
+	try
+	{
+		Request request(*this, stream, response);
+
+		Poco::Timestamp now;
+		response.setDate(now);
+		const std::string& server = _pParams->getSoftwareVersion();
+		if (!server.empty())
+			response.set("Server"s, server);
+
+		std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+		if (pHandler)
+		{
+			pHandler->handleRequest(request, response);
+		}
+		else
+		{
+			response.setStatusAndReason(HTTPResponse::HTTP_NOT_IMPLEMENTED);
+			response.setContentLength(0);
+		}
+		response.finish();
+	}
+	catch (Poco::Exception& exc)
+	{
+		bool aborted;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			aborted = stream.reset || _closed;
+		}
+		// A request that has been cancelled by the client, or
+		// whose connection has gone away, is not an error.
+		if (!aborted)
+		{
+			try
+			{
+				if (!response.sent())
+				{
+					HTTPResponse error(HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+					error.setContentLength(0);
+					sendHeaders(stream, error, true);
+				}
+				else sendRstStream(stream.id, HTTP2Frame::H2_ERR_INTERNAL);
+			}
+			catch (...)
+			{
+			}
+			Poco::ErrorHandler::handle(exc);
+		}
+	}
+	catch (std::exception& exc)
+	{
+		try
+		{
+			sendRstStream(stream.id, HTTP2Frame::H2_ERR_INTERNAL);
+		}
+		catch (...)
+		{
+		}
+		Poco::ErrorHandler::handle(exc);
+	}
+	streamDone(stream);
+}
+
+
+void HTTP2ServerSession::streamDone(Stream& stream)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_streams.erase(stream.id);
+	--_activeTasks;
+	_condition.broadcast();
+}
+
+
+HTTP2ServerSession::StreamPtr HTTP2ServerSession::findStream(UInt32 streamId) const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	StreamMap::const_iterator it = _streams.find(streamId);
+	if (it != _streams.end())
+		return it->second;
+	else
+		return StreamPtr();
+}
+
+
+void HTTP2ServerSession::close()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_closed = true;
+	_condition.broadcast();
+	while (_activeTasks > 0)
+	{
+		_condition.wait(_mutex);
+	}
+	_streams.clear();
+}
+
+
+void HTTP2ServerSession::writeFrame(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+	writeFrameImpl(type, flags, streamId, pPayload, length);
+}
+
+
+void HTTP2ServerSession::writeFrameImpl(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const char* pPayload, std::size_t length)
+{
+	if (_closed) throw NetException("HTTP/2 connection closed");
+
+	HTTP2Frame frame(type, flags, streamId, static_cast<UInt32>(length));
+	_writeBuffer.resize(HTTP2Frame::HEADER_SIZE + length, false);
+	frame.write(_writeBuffer.begin());
+	if (length > 0)
+	{
+		std::memcpy(_writeBuffer.begin() + HTTP2Frame::HEADER_SIZE, pPayload, length);
+	}
+	_socket.sendBytes(_writeBuffer.begin(), static_cast<int>(_writeBuffer.size()));
+}
+
+
+void HTTP2ServerSession::sendSettings()
+{
+	char payload[18];
+	const UInt16 ids[3] =
+	{
+		HTTP2Frame::SETTING_MAX_CONCURRENT_STREAMS,
+		HTTP2Frame::SETTING_INITIAL_WINDOW_SIZE,
+		HTTP2Frame::SETTING_MAX_HEADER_LIST_SIZE
+	};
+	const UInt32 values[3] =
+	{
+		static_cast<UInt32>(_pParams->getMaxConcurrentStreams()),
+		static_cast<UInt32>(_pParams->getInitialWindowSize()),
+		static_cast<UInt32>(MAX_HEADER_LIST_SIZE)
+	};
+	for (int i = 0; i < 3; ++i)
+	{
+		payload[6*i]     = static_cast<char>(ids[i] >> 8);
+		payload[6*i + 1] = static_cast<char>(ids[i] & 0xFF);
+		HTTP2Frame::writeUInt32(payload + 6*i + 2, values[i]);
+	}
+	writeFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, 0, 0, payload, sizeof(payload));
+}
+
+
+void HTTP2ServerSession::sendWindowUpdate(UInt32 streamId, UInt32 increment)
+{
+	char payload[4];
+	HTTP2Frame::writeUInt32(payload, increment);
+	writeFrame(HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE, 0, streamId, payload, sizeof(payload));
+}
+
+
+void HTTP2ServerSession::sendRstStream(UInt32 streamId, HTTP2Frame::ErrorCode error)
+{
+	char payload[4];
+	HTTP2Frame::writeUInt32(payload, error);
+	writeFrame(HTTP2Frame::FRAME_TYPE_RST_STREAM, 0, streamId, payload, sizeof(payload));
+}
+
+
+void HTTP2ServerSession::sendGoAway(HTTP2Frame::ErrorCode error)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+	if (_goAwaySent) return;
+	char payload[8];
+	HTTP2Frame::writeUInt32(payload, _lastStreamId);
+	HTTP2Frame::writeUInt32(payload + 4, error);
+	_goAwaySent = true;
+	writeFrameImpl(HTTP2Frame::FRAME_TYPE_GOAWAY, 0, 0, payload, sizeof(payload));
+}
+
+
+void HTTP2ServerSession::sendHeaders(Stream& stream, const HTTPResponse& response, bool endStream)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+
+	// Encoding and sending must not be interleaved with other
+	// header blocks, as both update the HPACK dynamic table.
+	std::string block;
+	_encoder.beginBlock(block);
+	_encoder.encode(":status"s, NumberFormatter::format(static_cast<int>(response.getStatus())), block);
+	for (const auto& h: response)
+	{
+		std::string name = Poco::toLower(h.first);
+		if (!isConnectionHeader(name))
+		{
+			_encoder.encode(name, h.second, block);
+		}
+	}
+
+	std::size_t maxFrameSize = _peerMaxFrameSize;
+	std::size_t pos = 0;
+	HTTP2Frame::FrameType type = HTTP2Frame::FRAME_TYPE_HEADERS;
+	do
+	{
+		std::size_t n = std::min(block.size() - pos, maxFrameSize);
+		UInt8 flags = 0;
+		if (pos + n == block.size()) flags |= HTTP2Frame::FRAME_FLAG_END_HEADERS;
+		if (type == HTTP2Frame::FRAME_TYPE_HEADERS && endStream) flags |= HTTP2Frame::FRAME_FLAG_END_STREAM;
+		writeFrameImpl(type, flags, stream.id, block.data() + pos, n);
+		pos += n;
+		type = HTTP2Frame::FRAME_TYPE_CONTINUATION;
+	}
+	while (pos < block.size());
+}
+
+
+void HTTP2ServerSession::sendData(Stream& stream, const char* pData, std::size_t length, bool endStream)
+{
+	if (length == 0)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+
+			if (stream.reset) throw HTTP2Exception("Stream reset by client", HTTP2Frame::H2_ERR_CANCEL);
+		}
+		writeFrame(HTTP2Frame::FRAME_TYPE_DATA, endStream ? HTTP2Frame::FRAME_FLAG_END_STREAM : 0, stream.id, nullptr, 0);
+		return;
+	}
+
+	while (length > 0)
+	{
+		std::size_t n = acquireSendWindow(stream, std::min<std::size_t>(length, _peerMaxFrameSize));
+		UInt8 flags = (endStream && n == length) ? HTTP2Frame::FRAME_FLAG_END_STREAM : 0;
+		writeFrame(HTTP2Frame::FRAME_TYPE_DATA, flags, stream.id, pData, n);
+		pData += n;
+		length -= n;
+	}
+}
+
+
+std::size_t HTTP2ServerSession::acquireSendWindow(Stream& stream, std::size_t length)
+{
+	long timeout = static_cast<long>(_pParams->getTimeout().totalMilliseconds());
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		if (_closed) throw NetException("HTTP/2 connection closed");
+		if (stream.reset) throw HTTP2Exception("Stream reset by client", HTTP2Frame::H2_ERR_CANCEL);
+
+		Int64 window = std::min(_sendWindow, stream.sendWindow);
+		if (window > 0)
+		{
+			std::size_t n = static_cast<std::size_t>(std::min<Int64>(window, static_cast<Int64>(length)));
+			_sendWindow -= n;
+			stream.sendWindow -= n;
+			return n;
+		}
+		if (!_condition.tryWait(_mutex, timeout))
+			throw TimeoutException("Timed out waiting for HTTP/2 flow-control window");
+	}
+}
+
+
+} // namespace Poco::Net
@@ -13,30 +13,24 @@
 
 
 #include "Poco/Net/HTTPBufferAllocator.h"
+#include "Poco/SlabAllocator.h"
 
 
-using Poco::MemoryPool;
+using Poco::SlabAllocator;
 
 
 namespace Poco::Net {
 
 
-MemoryPool HTTPBufferAllocator::_pool(HTTPBufferAllocator::BUFFER_SIZE, 16);
-
-
 char* HTTPBufferAllocator::allocate(std::streamsize size)
 {
-	poco_assert_dbg (size == BUFFER_SIZE);
-
-	return reinterpret_cast<char*>(_pool.get());
+	return static_cast<char*>(SlabAllocator::allocate(static_cast<std::size_t>(size)));
 }
 
 
 void HTTPBufferAllocator::deallocate(char* ptr, std::streamsize size)
 {
-	poco_assert_dbg (size == BUFFER_SIZE);
-
-	_pool.release(ptr);
+	SlabAllocator::deallocate(ptr, static_cast<std::size_t>(size));
 }
 
 
@@ -16,6 +16,7 @@
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/SlabAllocator.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
 #include "Poco/Ascii.h"
@@ -34,7 +35,7 @@ namespace Poco::Net {
 
 
 HTTPChunkedStreamBuf::HTTPChunkedStreamBuf(HTTPSession& session, openmode mode, MessageHeader* pTrailer):
-	HTTPBasicStreamBuf(HTTPBufferAllocator::BUFFER_SIZE, mode),
+	HTTPBasicStreamBuf(session.getBufferSize(), mode),
 	_session(session),
 	_mode(mode),
 	_chunk(0),
@@ -177,9 +178,6 @@ HTTPChunkedStreamBuf* HTTPChunkedIOS::rdbuf()
 //
 
 
-Poco::MemoryPool HTTPChunkedInputStream::_pool(sizeof(HTTPChunkedInputStream));
-
-
 HTTPChunkedInputStream::HTTPChunkedInputStream(HTTPSession& session, MessageHeader* pTrailer):
 	HTTPChunkedIOS(session, std::ios::in, pTrailer),
 	std::istream(&_buf)
@@ -194,20 +192,13 @@ HTTPChunkedInputStream::~HTTPChunkedInputStream()
 
 void* HTTPChunkedInputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPChunkedInputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPChunkedInputStream));
 }
 
 
@@ -216,9 +207,6 @@ void HTTPChunkedInputStream::operator delete(void* ptr)
 //
 
 
-Poco::MemoryPool HTTPChunkedOutputStream::_pool(sizeof(HTTPChunkedOutputStream));
-
-
 HTTPChunkedOutputStream::HTTPChunkedOutputStream(HTTPSession& session, MessageHeader* pTrailer):
 	HTTPChunkedIOS(session, std::ios::out, pTrailer),
 	std::ostream(&_buf)
@@ -233,20 +221,13 @@ HTTPChunkedOutputStream::~HTTPChunkedOutputStream()
 
 void* HTTPChunkedOutputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPChunkedOutputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPChunkedOutputStream));
 }
 
 
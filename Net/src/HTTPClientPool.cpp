@@ -0,0 +1,599 @@
+//
+// HTTPClientPool.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientPool
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPClientPool.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPSessionFactory.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/ScopedUnlock.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/String.h"
+#include <algorithm>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	bool isIdempotent(const std::string& method)
+	{
+		return method == HTTPRequest::HTTP_GET || method == HTTPRequest::HTTP_HEAD ||
+			method == HTTPRequest::HTTP_PUT || method == HTTPRequest::HTTP_DELETE ||
+			method == HTTPRequest::HTTP_OPTIONS || method == HTTPRequest::HTTP_TRACE;
+	}
+}
+
+
+HTTPClientPool::HTTPClientPool():
+	HTTPClientPool(DEFAULT_MAX_CONNECTIONS_PER_HOST, Poco::Timespan(60, 0))
+{
+}
+
+
+HTTPClientPool::HTTPClientPool(int maxConnectionsPerHost, const Poco::Timespan& idleTimeout):
+	_maxConnectionsPerHost(maxConnectionsPerHost),
+	_idleTimeout(idleTimeout),
+	_timeout(60, 0),
+	_http2Enabled(true),
+	_http2PriorKnowledge(false)
+{
+	poco_assert (maxConnectionsPerHost > 0);
+}
+
+
+HTTPClientPool::~HTTPClientPool()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+	poco_assert_dbg (_borrowed.empty());
+}
+
+
+void HTTPClientPool::sendRequest(const Poco::URI& uri, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody)
+{
+	purgeIfDue();
+
+	Target t = target(uri);
+	if (getHTTP2Enabled() && sendHTTP2Request(t, request, requestBody, response, responseBody)) return;
+
+	sendHTTP1Request(t, request, requestBody, response, responseBody);
+}
+
+
+HTTPClientSession* HTTPClientPool::borrowSession(const Poco::URI& uri)
+{
+	purgeIfDue();
+
+	bool reused;
+	return acquireSession(target(uri), reused);
+}
+
+
+void HTTPClientPool::returnSession(HTTPClientSession* pSession, bool reusable)
+{
+	poco_check_ptr (pSession);
+
+	sessionReturned(*pSession);
+
+	std::unique_ptr<HTTPClientSession> pDeleted;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	SessionMap::iterator it = _borrowed.find(pSession);
+	if (it == _borrowed.end())
+		throw InvalidArgumentException("Session has not been obtained from this HTTPClientPool");
+
+	HostPool& pool = _hosts[it->second];
+	_borrowed.erase(it);
+	--pool.inUse;
+	if (reusable && pSession->connected() && pSession->getKeepAlive())
+	{
+		IdleSession idle;
+		idle.pSession.reset(pSession);
+		pool.idle.push_back(std::move(idle));
+	}
+	else
+	{
+		pDeleted.reset(pSession);
+	}
+	_condition.broadcast();
+}
+
+
+void HTTPClientPool::addIdleSession(const std::string& scheme, const std::string& host, Poco::UInt16 port, HTTPClientSession* pSession)
+{
+	poco_check_ptr (pSession);
+
+	std::unique_ptr<HTTPClientSession> pNew(pSession);
+	pNew->setTimeout(getTimeout());
+	pNew->setKeepAlive(true);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	HostPool& pool = _hosts[key(scheme, host, port)];
+	if (pool.connections() < _maxConnectionsPerHost)
+	{
+		IdleSession idle;
+		idle.pSession = std::move(pNew);
+		pool.idle.push_back(std::move(idle));
+		_condition.broadcast();
+	}
+	else
+	{
+		Poco::ScopedUnlock<Poco::FastMutex> unlock(_mutex);
+		pNew.reset();
+	}
+}
+
+
+void HTTPClientPool::purge()
+{
+	std::vector<IdleSession> evicted;
+	std::vector<HTTP2ClientSession::Ptr> closed;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		_lastPurge.update();
+		HostMap::iterator it = _hosts.begin();
+		while (it != _hosts.end())
+		{
+			HostPool& pool = it->second;
+			evictIdle(pool, evicted);
+			std::vector<HTTP2ClientSession::Ptr>::iterator itH2 = pool.http2.begin();
+			while (itH2 != pool.http2.end())
+			{
+				HTTP2ClientSession::Ptr pSession = *itH2;
+				if (!pSession->isOpen() || (pSession->activeStreams() == 0 && pSession->lastUsed().isElapsed(_idleTimeout.totalMicroseconds())))
+				{
+					closed.push_back(pSession);
+					itH2 = pool.http2.erase(itH2);
+				}
+				else ++itH2;
+			}
+			if (pool.connections() == 0 && !pool.http2Connecting)
+				it = _hosts.erase(it);
+			else
+				++it;
+		}
+		_condition.broadcast();
+	}
+	for (auto& pSession: closed)
+	{
+		if (pSession->activeStreams() == 0) pSession->close();
+	}
+}
+
+
+void HTTPClientPool::clear()
+{
+	std::vector<IdleSession> evicted;
+	std::vector<HTTP2ClientSession::Ptr> closed;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		for (auto& h: _hosts)
+		{
+			for (auto& idle: h.second.idle)
+			{
+				evicted.push_back(std::move(idle));
+			}
+			h.second.idle.clear();
+			closed.insert(closed.end(), h.second.http2.begin(), h.second.http2.end());
+			h.second.http2.clear();
+		}
+		_condition.broadcast();
+	}
+	for (auto& pSession: closed)
+	{
+		pSession->close();
+	}
+}
+
+
+int HTTPClientPool::connections(const Poco::URI& uri) const
+{
+	Target t = target(uri);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	HostMap::const_iterator it = _hosts.find(t.key);
+	return it != _hosts.end() ? static_cast<int>(it->second.connections()) : 0;
+}
+
+
+int HTTPClientPool::idleConnections(const Poco::URI& uri) const
+{
+	Target t = target(uri);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	HostMap::const_iterator it = _hosts.find(t.key);
+	return it != _hosts.end() ? static_cast<int>(it->second.idle.size()) : 0;
+}
+
+
+void HTTPClientPool::setMaxConnectionsPerHost(int maxConnections)
+{
+	poco_assert (maxConnections > 0);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_maxConnectionsPerHost = maxConnections;
+	_condition.broadcast();
+}
+
+
+int HTTPClientPool::getMaxConnectionsPerHost() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return static_cast<int>(_maxConnectionsPerHost);
+}
+
+
+void HTTPClientPool::setIdleTimeout(const Poco::Timespan& timeout)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_idleTimeout = timeout;
+}
+
+
+Poco::Timespan HTTPClientPool::getIdleTimeout() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _idleTimeout;
+}
+
+
+void HTTPClientPool::setTimeout(const Poco::Timespan& timeout)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_timeout = timeout;
+}
+
+
+Poco::Timespan HTTPClientPool::getTimeout() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _timeout;
+}
+
+
+void HTTPClientPool::setHTTP2Enabled(bool enabled)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_http2Enabled = enabled;
+}
+
+
+bool HTTPClientPool::getHTTP2Enabled() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _http2Enabled;
+}
+
+
+void HTTPClientPool::setHTTP2PriorKnowledge(bool enabled)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	_http2PriorKnowledge = enabled;
+}
+
+
+bool HTTPClientPool::getHTTP2PriorKnowledge() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _http2PriorKnowledge;
+}
+
+
+HTTPClientSession* HTTPClientPool::createSession(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	if (scheme == "http")
+	{
+		return new HTTPClientSession(host, port);
+	}
+	else
+	{
+		Poco::URI uri;
+		uri.setScheme(scheme);
+		uri.setHost(host);
+		uri.setPort(port);
+		return HTTPSessionFactory::defaultFactory().createClientSession(uri);
+	}
+}
+
+
+HTTP2ClientSession::Ptr HTTPClientPool::createHTTP2Session(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	if (scheme == "http" && getHTTP2PriorKnowledge())
+	{
+		StreamSocket socket;
+		socket.connect(SocketAddress(host, port), getTimeout());
+		socket.setNoDelay(true);
+		return new HTTP2ClientSession(socket, host, port);
+	}
+	return HTTP2ClientSession::Ptr();
+}
+
+
+void HTTPClientPool::sessionReturned(HTTPClientSession& session)
+{
+}
+
+
+HTTPClientPool::Target HTTPClientPool::target(const Poco::URI& uri)
+{
+	Target t;
+	t.scheme = Poco::toLower(uri.getScheme());
+	t.host = uri.getHost();
+	t.port = uri.getPort();
+	if (t.scheme.empty() || t.host.empty())
+		throw InvalidArgumentException("URI must specify scheme and host", uri.toString());
+
+	t.key = key(t.scheme, t.host, t.port);
+	return t;
+}
+
+
+std::string HTTPClientPool::key(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	std::string k = scheme;
+	k += "://";
+	k += Poco::toLower(host);
+	k += ':';
+	k += NumberFormatter::format(port);
+	return k;
+}
+
+
+HTTPClientSession* HTTPClientPool::acquireSession(const Target& target, bool& reused)
+{
+	std::vector<IdleSession> evicted;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		// The HostPool may be removed by purge() while we wait.
+		HostPool& pool = _hosts[target.key];
+		while (!pool.idle.empty())
+		{
+			IdleSession idle = std::move(pool.idle.back());
+			pool.idle.pop_back();
+			if (idle.since.isElapsed(_idleTimeout.totalMicroseconds()) || !idle.pSession->connected())
+			{
+				evicted.push_back(std::move(idle));
+			}
+			else
+			{
+				HTTPClientSession* pSession = idle.pSession.release();
+				_borrowed[pSession] = target.key;
+				++pool.inUse;
+				reused = true;
+				return pSession;
+			}
+		}
+		if (pool.connections() < _maxConnectionsPerHost)
+		{
+			++pool.inUse;
+			std::unique_ptr<HTTPClientSession> pSession;
+			try
+			{
+				Poco::ScopedUnlock<Poco::FastMutex> unlock(_mutex);
+
+				pSession.reset(createSession(target.scheme, target.host, target.port));
+				pSession->setTimeout(getTimeout());
+				pSession->setKeepAlive(true);
+			}
+			catch (...)
+			{
+				--pool.inUse;
+				_condition.broadcast();
+				throw;
+			}
+			_borrowed[pSession.get()] = target.key;
+			reused = false;
+			return pSession.release();
+		}
+		if (!_condition.tryWait(_mutex, static_cast<long>(_timeout.totalMilliseconds())))
+			throw TimeoutException("No connection available for "s + target.key);
+	}
+}
+
+
+HTTP2ClientSession::Ptr HTTPClientPool::acquireHTTP2Session(const Target& target)
+{
+	std::vector<IdleSession> evicted;
+	std::vector<HTTP2ClientSession::Ptr> closed;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	for (;;)
+	{
+		HostPool& pool = _hosts[target.key];
+		if (pool.http2Unavailable) return HTTP2ClientSession::Ptr();
+
+		HTTP2ClientSession::Ptr pBest;
+		std::vector<HTTP2ClientSession::Ptr>::iterator it = pool.http2.begin();
+		while (it != pool.http2.end())
+		{
+			if (!(*it)->isOpen())
+			{
+				closed.push_back(*it);
+				it = pool.http2.erase(it);
+				continue;
+			}
+			if ((*it)->canSendRequest() && (!pBest || (*it)->activeStreams() < pBest->activeStreams()))
+				pBest = *it;
+			++it;
+		}
+		if (pBest) return pBest;
+
+		if (!pool.http2Connecting)
+		{
+			if (pool.connections() >= _maxConnectionsPerHost && !pool.idle.empty())
+			{
+				// Make room for the HTTP/2 connection by closing
+				// the least recently used idle HTTP/1.1 connection.
+				evicted.push_back(std::move(pool.idle.front()));
+				pool.idle.erase(pool.idle.begin());
+			}
+			if (pool.connections() < _maxConnectionsPerHost)
+			{
+				pool.http2Connecting = true;
+				HTTP2ClientSession::Ptr pSession;
+				try
+				{
+					Poco::ScopedUnlock<Poco::FastMutex> unlock(_mutex);
+
+					pSession = createHTTP2Session(target.scheme, target.host, target.port);
+					if (pSession) pSession->setTimeout(getTimeout());
+				}
+				catch (...)
+				{
+					pool.http2Connecting = false;
+					_condition.broadcast();
+					throw;
+				}
+				pool.http2Connecting = false;
+				_condition.broadcast();
+				if (pSession)
+					pool.http2.push_back(pSession);
+				else
+					pool.http2Unavailable = true;
+				return pSession;
+			}
+			// All connections are in use; the request waits
+			// for a stream on the least busy one.
+			for (auto& pSession: pool.http2)
+			{
+				if (!pBest || pSession->activeStreams() < pBest->activeStreams())
+					pBest = pSession;
+			}
+			if (pBest) return pBest;
+		}
+		if (!_condition.tryWait(_mutex, static_cast<long>(_timeout.totalMilliseconds())))
+			throw TimeoutException("No connection available for "s + target.key);
+	}
+}
+
+
+bool HTTPClientPool::sendHTTP2Request(const Target& target, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody)
+{
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+		HTTP2ClientSession::Ptr pSession = acquireHTTP2Session(target);
+		if (!pSession) return false;
+		try
+		{
+			pSession->sendRequest(request, requestBody, response, responseBody);
+			return true;
+		}
+		catch (HTTP2Exception& exc)
+		{
+			if (exc.code() != HTTP2Frame::H2_ERR_REFUSED_STREAM || attempt > 0) throw;
+		}
+	}
+	return true;
+}
+
+
+void HTTPClientPool::sendHTTP1Request(const Target& target, HTTPRequest& request, const std::string& requestBody, HTTPResponse& response, std::string& responseBody)
+{
+	const std::string& method = request.getMethod();
+	if (!request.getChunkedTransferEncoding() &&
+		(!requestBody.empty() || method == HTTPRequest::HTTP_POST || method == HTTPRequest::HTTP_PUT || method == HTTPRequest::HTTP_PATCH))
+	{
+		request.setContentLength64(static_cast<std::streamsize>(requestBody.size()));
+	}
+
+	for (int attempt = 0;; ++attempt)
+	{
+		bool reused = false;
+		bool responseReceived = false;
+		HTTPClientSession* pSession = acquireSession(target, reused);
+		try
+		{
+			std::ostream& ostr = pSession->sendRequest(request);
+			ostr.write(requestBody.data(), static_cast<std::streamsize>(requestBody.size()));
+			std::istream& istr = pSession->receiveResponse(response);
+			responseReceived = true;
+			responseBody.clear();
+			Poco::StreamCopier::copyToString(istr, responseBody);
+		}
+		catch (Poco::Exception&)
+		{
+			returnSession(pSession, false);
+			// A reused connection may have been closed by
+			// the server while it was idle in the pool.
+			if (reused && !responseReceived && attempt == 0 && isIdempotent(method)) continue;
+			throw;
+		}
+		returnSession(pSession, true);
+		return;
+	}
+}
+
+
+void HTTPClientPool::purgeIfDue()
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		if (!_lastPurge.isElapsed(_idleTimeout.totalMicroseconds())) return;
+		_lastPurge.update();
+	}
+	purge();
+}
+
+
+void HTTPClientPool::evictIdle(HostPool& pool, std::vector<IdleSession>& evicted)
+{
+	// Must be called with _mutex locked.
+	std::vector<IdleSession>::iterator it = pool.idle.begin();
+	while (it != pool.idle.end())
+	{
+		if (it->since.isElapsed(_idleTimeout.totalMicroseconds()))
+		{
+			evicted.push_back(std::move(*it));
+			it = pool.idle.erase(it);
+		}
+		else ++it;
+	}
+}
+
+
+} // namespace Poco::Net
@@ -124,6 +124,24 @@ HTTPClientSession::HTTPClientSession(const std::string& host, Poco::UInt16 port,
 }
 
 
+HTTPClientSession::HTTPClientSession(const StreamSocket& socket, const std::string& host, Poco::UInt16 port):
+	HTTPSession(socket),
+	_host(host),
+	_port(port),
+	_sourceAddress4(IPAddress::wildcard(IPAddress::IPv4), 0),
+	_sourceAddress6(IPAddress::wildcard(IPAddress::IPv6), 0),
+	_proxyConfig(_globalProxyConfig),
+	_keepAliveTimeout(DEFAULT_KEEP_ALIVE_TIMEOUT, 0),
+	_reconnect(false),
+	_mustReconnect(false),
+	_expectResponseBody(false),
+	_responseReceived(false),
+	_ntlmProxyAuthenticated(false)
+{
+	initProxySessionFactory();
+}
+
+
 HTTPClientSession::HTTPClientSession(const StreamSocket& socket, const ProxyConfig& proxyConfig):
 	HTTPSession(socket),
 	_port(HTTPSession::HTTP_PORT),
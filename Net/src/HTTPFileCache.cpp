@@ -0,0 +1,161 @@
+//
+// HTTPFileCache.cpp
+//
+// Library: Net
+// Package: HTTPServer
+// Module:  HTTPFileCache
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPFileCache.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+#include "Poco/String.h"
+#include <string_view>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	std::string_view opaqueTag(std::string_view etag)
+		/// Returns the entity tag without the weakness indicator.
+	{
+		if (etag.size() >= 2 && etag[0] == 'W' && etag[1] == '/') etag.remove_prefix(2);
+		return etag;
+	}
+
+
+	bool matchesETag(std::string_view list, std::string_view etag)
+		/// Returns true if the If-None-Match field value list matches
+		/// etag, using the weak comparison function (RFC 9110, 13.1.2).
+	{
+		const std::string_view tag = opaqueTag(etag);
+		std::size_t pos = 0;
+		while (pos < list.size())
+		{
+			char c = list[pos];
+			if (c == ' ' || c == '\t' || c == ',')
+			{
+				++pos;
+				continue;
+			}
+			if (c == '*') return true;
+			std::size_t begin = pos;
+			if (list.compare(pos, 2, "W/") == 0) pos += 2;
+			if (pos >= list.size() || list[pos] != '"') return false;
+			// the opaque tag may contain commas, so scan for the closing quote
+			std::size_t end = list.find('"', pos + 1);
+			if (end == std::string_view::npos) return false;
+			if (opaqueTag(list.substr(begin, end + 1 - begin)) == tag) return true;
+			pos = end + 1;
+		}
+		return false;
+	}
+}
+
+
+HTTPFileCache::HTTPFileCache(std::size_t maxEntries, Poco::File::FileSize maxFileSize, const Poco::Timespan& checkInterval):
+	_cache(maxEntries),
+	_maxFileSize(maxFileSize),
+	_checkInterval(checkInterval)
+{
+}
+
+
+HTTPFileCache::~HTTPFileCache()
+{
+}
+
+
+HTTPFileCache::EntryPtr HTTPFileCache::get(const std::string& path)
+{
+	Poco::Timestamp now;
+	EntryPtr pEntry = _cache.get(path);
+	if (pEntry)
+	{
+		if (now.epochMicroseconds() - pEntry->validated.load(std::memory_order_relaxed) < _checkInterval.totalMicroseconds())
+			return pEntry;
+
+		Poco::File f(path);
+		if (f.exists() && f.getSize() == pEntry->size && f.getLastModified() == pEntry->lastModified)
+		{
+			pEntry->validated.store(now.epochMicroseconds(), std::memory_order_relaxed);
+			return pEntry;
+		}
+		_cache.remove(path);
+	}
+
+	pEntry = open(path);
+	if (pEntry->size <= _maxFileSize)
+	{
+		_cache.add(path, pEntry);
+	}
+	return pEntry;
+}
+
+
+void HTTPFileCache::remove(const std::string& path)
+{
+	_cache.remove(path);
+}
+
+
+void HTTPFileCache::clear()
+{
+	_cache.clear();
+}
+
+
+std::size_t HTTPFileCache::size()
+{
+	return _cache.size();
+}
+
+
+HTTPFileCache::EntryPtr HTTPFileCache::open(const std::string& path)
+{
+	Poco::File f(path);
+	if (!f.exists()) throw Poco::FileNotFoundException(path);
+
+	EntryPtr pEntry = new Entry;
+	pEntry->path = path;
+	pEntry->pStream = std::make_shared<Poco::FileInputStream>(path);
+	if (!pEntry->pStream->good()) throw Poco::OpenFileException(path);
+	pEntry->size = f.getSize();
+	pEntry->lastModified = f.getLastModified();
+	pEntry->lastModifiedHeader = Poco::DateTimeFormatter::format(pEntry->lastModified, Poco::DateTimeFormat::HTTP_FORMAT);
+	pEntry->etag.reserve(32);
+	pEntry->etag += '"';
+	Poco::NumberFormatter::appendHex(pEntry->etag, static_cast<Poco::UInt64>(pEntry->lastModified.epochMicroseconds()));
+	pEntry->etag += '-';
+	Poco::NumberFormatter::appendHex(pEntry->etag, static_cast<Poco::UInt64>(pEntry->size));
+	pEntry->etag += '"';
+	pEntry->validated.store(Poco::Timestamp().epochMicroseconds(), std::memory_order_relaxed);
+	return pEntry;
+}
+
+
+bool HTTPFileCache::notModified(const HTTPRequest& request, const Entry& entry)
+{
+	for (auto it = request.find("If-None-Match"s); it != request.end() && Poco::icompare(it->first, "If-None-Match"s) == 0; ++it)
+	{
+		if (matchesETag(it->second, entry.etag)) return true;
+	}
+	return false;
+}
+
+
+} // namespace Poco::Net
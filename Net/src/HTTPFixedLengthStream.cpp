@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPFixedLengthStream.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/SlabAllocator.h"
 
 
 using Poco::BufferedStreamBuf;
@@ -28,7 +29,7 @@ namespace Poco::Net {
 
 
 HTTPFixedLengthStreamBuf::HTTPFixedLengthStreamBuf(HTTPSession& session, ContentLength length, openmode mode):
-	HTTPBasicStreamBuf(HTTPBufferAllocator::BUFFER_SIZE, mode),
+	HTTPBasicStreamBuf(session.getBufferSize(), mode),
 	_session(session),
 	_length(length),
 	_count(0)
@@ -104,9 +105,6 @@ HTTPFixedLengthStreamBuf* HTTPFixedLengthIOS::rdbuf()
 //
 
 
-Poco::MemoryPool HTTPFixedLengthInputStream::_pool(sizeof(HTTPFixedLengthInputStream));
-
-
 HTTPFixedLengthInputStream::HTTPFixedLengthInputStream(HTTPSession& session, HTTPFixedLengthStreamBuf::ContentLength length):
 	HTTPFixedLengthIOS(session, length, std::ios::in),
 	std::istream(&_buf)
@@ -121,20 +119,13 @@ HTTPFixedLengthInputStream::~HTTPFixedLengthInputStream()
 
 void* HTTPFixedLengthInputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPFixedLengthInputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPFixedLengthInputStream));
 }
 
 
@@ -143,9 +134,6 @@ void HTTPFixedLengthInputStream::operator delete(void* ptr)
 //
 
 
-Poco::MemoryPool HTTPFixedLengthOutputStream::_pool(sizeof(HTTPFixedLengthOutputStream));
-
-
 HTTPFixedLengthOutputStream::HTTPFixedLengthOutputStream(HTTPSession& session, HTTPFixedLengthStreamBuf::ContentLength length):
 	HTTPFixedLengthIOS(session, length, std::ios::out),
 	std::ostream(&_buf)
@@ -160,20 +148,13 @@ HTTPFixedLengthOutputStream::~HTTPFixedLengthOutputStream()
 
 void* HTTPFixedLengthOutputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPFixedLengthOutputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPFixedLengthOutputStream));
 }
 
 
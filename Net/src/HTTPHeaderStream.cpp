@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/SlabAllocator.h"
 
 
 namespace Poco::Net {
@@ -25,7 +26,7 @@ namespace Poco::Net {
 
 
 HTTPHeaderStreamBuf::HTTPHeaderStreamBuf(HTTPSession& session, openmode mode):
-	HTTPBasicStreamBuf(HTTPBufferAllocator::BUFFER_SIZE, mode),
+	HTTPBasicStreamBuf(session.getBufferSize(), mode),
 	_session(session),
 	_end(false)
 {
@@ -101,9 +102,6 @@ HTTPHeaderStreamBuf* HTTPHeaderIOS::rdbuf()
 //
 
 
-Poco::MemoryPool HTTPHeaderInputStream::_pool(sizeof(HTTPHeaderInputStream));
-
-
 HTTPHeaderInputStream::HTTPHeaderInputStream(HTTPSession& session):
 	HTTPHeaderIOS(session, std::ios::in),
 	std::istream(&_buf)
@@ -118,20 +116,13 @@ HTTPHeaderInputStream::~HTTPHeaderInputStream()
 
 void* HTTPHeaderInputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPHeaderInputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPHeaderInputStream));
 }
 
 
@@ -140,9 +131,6 @@ void HTTPHeaderInputStream::operator delete(void* ptr)
 //
 
 
-Poco::MemoryPool HTTPHeaderOutputStream::_pool(sizeof(HTTPHeaderOutputStream));
-
-
 HTTPHeaderOutputStream::HTTPHeaderOutputStream(HTTPSession& session):
 	HTTPHeaderIOS(session, std::ios::out),
 	std::ostream(&_buf)
@@ -157,20 +145,13 @@ HTTPHeaderOutputStream::~HTTPHeaderOutputStream()
 
 void* HTTPHeaderOutputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPHeaderOutputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPHeaderOutputStream));
 }
 
 
@@ -2,7 +2,11 @@
 #include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Any.h"
 #include <cstring>
+#include <memory>
+#include <optional>
 
 namespace Poco::Net {
 
@@ -30,6 +34,25 @@ HTTPReactorServer::HTTPReactorServer(const SocketAddress& address, HTTPServerPar
 		});
 }
 
+HTTPReactorServer::HTTPReactorServer(const SocketAddress& address, HTTPServerParams::Ptr pParams, const FactoryCreator& factoryCreator)
+	: _tcpReactorServer(address, pParams)
+{
+	_pParams = pParams;
+	for (int i = 0; i < _tcpReactorServer.acceptors(); ++i)
+	{
+		HTTPRequestHandlerFactory::Ptr pFactory = factoryCreator(i);
+		poco_check_ptr (pFactory);
+		_factories.push_back(pFactory);
+		HTTPRequestHandlerFactory* pShardFactory = pFactory.get();
+		_tcpReactorServer.setRecvMessageCallback(i,
+			[this, pShardFactory](const TcpReactorConnectionPtr& conn)
+			{
+				this->onMessage(conn, *pShardFactory);
+			});
+	}
+	_pFactory = _factories.front();
+}
+
 HTTPReactorServer::~HTTPReactorServer()
 {
 }
@@ -45,17 +68,57 @@ void HTTPReactorServer::stop()
 }
 
 void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
+{
+	onMessage(conn, *_pFactory);
+}
+
+void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn, HTTPRequestHandlerFactory& factory)
+{
+	// The parser state is kept with the connection, so that partially
+	// received requests are not scanned again when more data arrives.
+	using ParserPtr = std::shared_ptr<HTTPRequestParser>;
+	ParserPtr* ppParser = Poco::AnyCast<ParserPtr>(&conn->context());
+	if (!ppParser)
+	{
+		ParserPtr pParser = std::make_shared<HTTPRequestParser>();
+		pParser->setFieldLimit(_pParams->getMaxHeaderFields());
+		pParser->setHeaderSizeLimit(_pParams->getMaxHeaderSize());
+		conn->context() = pParser;
+		ppParser = Poco::AnyCast<ParserPtr>(&conn->context());
+	}
+
+	// Dispatch all complete requests in the buffer, so that pipelined
+	// requests do not have to wait for more data to arrive.
+	// Dispatching stops while a file transfer started by sendFile() is
+	// pending; the connection resumes it once the transfer is complete.
+	while (!conn->sendPending() && processRequest(conn, **ppParser, factory));
+}
+
+bool HTTPReactorServer::processRequest(const TcpReactorConnectionPtr& conn, HTTPRequestParser& parser, HTTPRequestHandlerFactory& factory)
 {
 	try
 	{
-		HTTPReactorServerSession session(conn->socket(), conn->buffer(), _pParams);
-		if (!session.checkRequestComplete())
+		HTTPReactorServerSession session(conn->socket(), conn->buffer(), parser, _pParams);
+		session.setConnection(conn);
+		std::optional<HTTPServerResponseImpl> optResponse;
+		std::optional<HTTPServerRequestImpl> optRequest;
+		try
 		{
-			return;
+			if (!session.checkRequestComplete())
+			{
+				return false;
+			}
+			optResponse.emplace(session);
+			optRequest.emplace(*optResponse, session, _pParams);
 		}
-
-		HTTPServerResponseImpl response(session);
-		HTTPServerRequestImpl request(response, session, _pParams);
+		catch (MessageException&)
+		{
+			sendErrorResponse(session, parser.limitExceeded() ? HTTPResponse::HTTP_REQUEST_HEADER_FIELDS_TOO_LARGE : HTTPResponse::HTTP_BAD_REQUEST);
+			conn->handleClose();
+			return false;
+		}
+		HTTPServerResponseImpl& response = *optResponse;
+		HTTPServerRequestImpl& request = *optRequest;
 
 		Poco::Timestamp now;
 		response.setDate(now);
@@ -71,7 +134,7 @@ void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
 		{
 			session.requestTrailer().clear();
 			session.responseTrailer().clear();
-			std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+			std::unique_ptr<HTTPRequestHandler> pHandler(factory.createRequestHandler(request));
 			if (pHandler.get())
 			{
 				if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
@@ -108,6 +171,7 @@ void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
 	{
 		onError(ex);
 	}
+	return !conn->buffer().empty();
 }
 
 void HTTPReactorServer::sendErrorResponse(HTTPSession& session, HTTPResponse::HTTPStatus status)
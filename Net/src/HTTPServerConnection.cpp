@@ -18,6 +18,7 @@
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTP2ServerSession.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Timestamp.h"
@@ -59,6 +60,7 @@ HTTPServerConnection::~HTTPServerConnection()
 void HTTPServerConnection::run()
 {
 	std::string server = _pParams->getSoftwareVersion();
+	std::string http2Received;
 	HTTPServerSession session(socket(), _pParams);
 	while (!_stopped && session.hasMoreRequests())
 	{
@@ -70,6 +72,18 @@ void HTTPServerConnection::run()
 				HTTPServerResponseImpl response(session);
 				HTTPServerRequestImpl request(response, session, _pParams);
 
+				if (_pParams->getHTTP2Enabled() && isHTTP2Preface(request))
+				{
+					// The request line and the empty line following it are the
+					// first part of the HTTP/2 connection preface. The HTTP/2
+					// session needs them, plus anything buffered after them.
+					Poco::Buffer<char> buffer(0);
+					session.drainBuffer(buffer);
+					http2Received = request.getMethod() + " " + request.getURI() + " " + request.getVersion() + "\r\n\r\n";
+					http2Received.append(buffer.begin(), buffer.size());
+					break;
+				}
+
 				Poco::Timestamp now;
 				response.setDate(now);
 				response.setVersion(request.getVersion());
@@ -124,6 +138,20 @@ void HTTPServerConnection::run()
 			else throw;
 		}
 	}
+
+	if (!http2Received.empty())
+	{
+		// The HTTP/2 session is not run with the mutex held,
+		// as it may last for many requests.
+		HTTP2ServerSession http2Session(socket(), _pParams, _pFactory);
+		http2Session.run(http2Received.data(), http2Received.size());
+	}
+}
+
+
+bool HTTPServerConnection::isHTTP2Preface(const HTTPServerRequest& request)
+{
+	return request.getMethod() == "PRI"s && request.getURI() == "*"s && request.getVersion() == "HTTP/2.0"s;
 }
 
 
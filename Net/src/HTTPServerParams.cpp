@@ -13,6 +13,7 @@
 
 
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPBufferAllocator.h"
 
 
 namespace Poco::Net {
@@ -23,7 +24,14 @@ HTTPServerParams::HTTPServerParams():
 	_keepAlive(true),
 	_maxKeepAliveRequests(0),
 	_keepAliveTimeout(15000000),
-	_autoDecodeHeaders(true)
+	_autoDecodeHeaders(true),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
+	_maxHeaderFields(100),
+	_maxHeaderSize(65536),
+	_http2Enabled(false),
+	_maxConcurrentStreams(100),
+	_initialWindowSize(1048576),
+	_maxRequestBodySize(16777216)
 {
 }
 
@@ -76,4 +84,57 @@ void HTTPServerParams::setAutoDecodeHeaders(bool autoDecode)
 }
 
 
+void HTTPServerParams::setBufferSize(std::streamsize size)
+{
+	poco_assert (size > 0);
+	_bufferSize = size;
+}
+
+
+void HTTPServerParams::setMaxHeaderFields(int maxFields)
+{
+	poco_assert (maxFields >= 0);
+	_maxHeaderFields = maxFields;
+}
+
+
+void HTTPServerParams::setMaxHeaderSize(std::size_t maxSize)
+{
+	_maxHeaderSize = maxSize;
+}
+
+
+void HTTPServerParams::setFileCache(HTTPFileCache::Ptr pFileCache)
+{
+	_pFileCache = pFileCache;
+}
+
+
+void HTTPServerParams::setHTTP2Enabled(bool enabled)
+{
+	_http2Enabled = enabled;
+}
+
+
+void HTTPServerParams::setMaxConcurrentStreams(int maxStreams)
+{
+	poco_assert (maxStreams > 0);
+	_maxConcurrentStreams = maxStreams;
+}
+
+
+void HTTPServerParams::setInitialWindowSize(int size)
+{
+	poco_assert (size > 0);
+	_initialWindowSize = size;
+}
+
+
+void HTTPServerParams::setMaxRequestBodySize(Poco::Int64 size)
+{
+	poco_assert (size >= 0);
+	_maxRequestBodySize = size;
+}
+
+
 } // namespace Poco::Net
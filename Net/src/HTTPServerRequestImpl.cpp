@@ -15,6 +15,7 @@
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/HTTPStream.h"
@@ -41,22 +42,46 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 
 	HTTPHeaderInputStream hs(session);
 	setAutoDecode(_pParams->getAutoDecodeHeaders());
+	setFieldLimit(_pParams->getMaxHeaderFields());
 	read(hs);
 
+	init();
+}
+
+
+HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, HTTPReactorServerSession& session, HTTPServerParams* pParams):
+	_response(response),
+	_session(session),
+	_pStream(nullptr),
+	_pParams(pParams, true)
+{
+	response.attachRequest(this);
+
+	setAutoDecode(_pParams->getAutoDecodeHeaders());
+	setFieldLimit(_pParams->getMaxHeaderFields());
+	session.parser().fill(*this);
+	session.skipHeader();
+
+	init();
+}
+
+
+void HTTPServerRequestImpl::init()
+{
 	// Now that we know socket is still connected, obtain addresses
-	_clientAddress = session.clientAddress();
-	_serverAddress = session.serverAddress();
+	_clientAddress = _session.clientAddress();
+	_serverAddress = _session.serverAddress();
 
 	if (getChunkedTransferEncoding())
-		_pStream = new HTTPChunkedInputStream(session, &session.requestTrailer());
+		_pStream = new HTTPChunkedInputStream(_session, &_session.requestTrailer());
 	else if (hasContentLength())
 #if defined(POCO_HAVE_INT64)
-		_pStream = new HTTPFixedLengthInputStream(session, getContentLength64());
+		_pStream = new HTTPFixedLengthInputStream(_session, getContentLength64());
 #else
-		_pStream = new HTTPFixedLengthInputStream(session, getContentLength());
+		_pStream = new HTTPFixedLengthInputStream(_session, getContentLength());
 #endif
-	else 
-		_pStream = new HTTPFixedLengthInputStream(session, 0);
+	else
+		_pStream = new HTTPFixedLengthInputStream(_session, 0);
 }
 
 
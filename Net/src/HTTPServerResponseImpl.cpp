@@ -15,6 +15,9 @@
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPReactorServerSession.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPFileCache.h"
 #include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/HTTPStream.h"
@@ -113,6 +116,48 @@ void HTTPServerResponseImpl::sendFile(const std::string& path, const std::string
 {
 	poco_assert (!_pStream);
 
+	HTTPFileCache::Ptr pCache;
+	if (_pRequest) pCache = _pRequest->serverParams().getFileCache();
+	if (pCache)
+	{
+		HTTPFileCache::EntryPtr pEntry = pCache->get(path);
+		set("Last-Modified"s, pEntry->lastModifiedHeader);
+		set("ETag"s, pEntry->etag);
+		if (HTTPFileCache::notModified(*_pRequest, *pEntry))
+		{
+			setStatusAndReason(HTTPResponse::HTTP_NOT_MODIFIED);
+			_pStream = new HTTPHeaderOutputStream(_session);
+			write(*_pStream);
+			_pStream->flush();
+			return;
+		}
+#if defined(POCO_HAVE_INT64)
+		setContentLength64(pEntry->size);
+#else
+		setContentLength(static_cast<int>(pEntry->size));
+#endif
+		setContentType(mediaType);
+		setChunkedTransferEncoding(false);
+
+		_pStream = new HTTPHeaderOutputStream(_session);
+		write(*_pStream);
+		if (_pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
+		{
+			_pStream->flush(); // flush the HTTP headers to the socket, required by HTTP 1.0 and above
+			std::shared_ptr<Poco::FileInputStream> pStream = pEntry->pStream;
+#if defined(POCO_HAVE_SENDFILE)
+			if (_session.socket().secure())
+#endif
+			{
+				// The blockwise fallback reads through the stream,
+				// so the shared stream of the cache entry can't be used.
+				pStream = std::make_shared<Poco::FileInputStream>(path);
+			}
+			sendFileContent(pStream, static_cast<std::streamsize>(pEntry->size));
+		}
+		return;
+	}
+
 	File f(path);
 	Timestamp dateTime    = f.getLastModified();
 	File::FileSize length = f.getSize();
@@ -125,21 +170,36 @@ void HTTPServerResponseImpl::sendFile(const std::string& path, const std::string
 	setContentType(mediaType);
 	setChunkedTransferEncoding(false);
 
-	Poco::FileInputStream istr(path);
-	if (istr.good())
+	std::shared_ptr<Poco::FileInputStream> pStream = std::make_shared<Poco::FileInputStream>(path);
+	if (pStream->good())
 	{
 		_pStream = new HTTPHeaderOutputStream(_session);
 		write(*_pStream);
 		if (_pRequest && _pRequest->getMethod() != HTTPRequest::HTTP_HEAD)
 		{
 			_pStream->flush(); // flush the HTTP headers to the socket, required by HTTP 1.0 and above
-			_session.socket().sendFile(istr);
+			sendFileContent(pStream, static_cast<std::streamsize>(length));
 		}
 	}
 	else throw OpenFileException(path);
 }
 
 
+void HTTPServerResponseImpl::sendFileContent(const std::shared_ptr<Poco::FileInputStream>& pStream, std::streamsize length)
+{
+	// The length has already been sent as Content-Length, so send
+	// exactly that many bytes even if the file has changed since.
+	// A count of 0 would send the whole file.
+	if (length == 0) return;
+
+	HTTPReactorServerSession* pReactorSession = dynamic_cast<HTTPReactorServerSession*>(&_session);
+	if (pReactorSession)
+		pReactorSession->sendFile(pStream, 0, length);
+	else
+		_session.socket().sendFile(*pStream, 0, length);
+}
+
+
 void HTTPServerResponseImpl::sendBuffer(const void* pBuffer, std::size_t length)
 {
 	poco_assert (!_pStream);
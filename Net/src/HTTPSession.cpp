@@ -28,6 +28,7 @@ HTTPSession::HTTPSession():
 	_pBuffer(nullptr),
 	_pCurrent(nullptr),
 	_pEnd(nullptr),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_keepAlive(false),
 	_connectionTimeout(HTTP_DEFAULT_CONNECTION_TIMEOUT),
 	_receiveTimeout(HTTP_DEFAULT_TIMEOUT),
@@ -42,6 +43,7 @@ HTTPSession::HTTPSession(const StreamSocket& socket):
 	_pBuffer(nullptr),
 	_pCurrent(nullptr),
 	_pEnd(nullptr),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_keepAlive(false),
 	_connectionTimeout(HTTP_DEFAULT_CONNECTION_TIMEOUT),
 	_receiveTimeout(HTTP_DEFAULT_TIMEOUT),
@@ -56,6 +58,7 @@ HTTPSession::HTTPSession(const StreamSocket& socket, bool keepAlive):
 	_pBuffer(nullptr),
 	_pCurrent(nullptr),
 	_pEnd(nullptr),
+	_bufferSize(HTTPBufferAllocator::BUFFER_SIZE),
 	_keepAlive(keepAlive),
 	_connectionTimeout(HTTP_DEFAULT_CONNECTION_TIMEOUT),
 	_receiveTimeout(HTTP_DEFAULT_TIMEOUT),
@@ -69,7 +72,7 @@ HTTPSession::~HTTPSession()
 {
 	try
 	{
-		if (_pBuffer) HTTPBufferAllocator::deallocate(_pBuffer, HTTPBufferAllocator::BUFFER_SIZE);
+		if (_pBuffer) HTTPBufferAllocator::deallocate(_pBuffer, _bufferSize);
 	}
 	catch (...)
 	{
@@ -106,6 +109,21 @@ void HTTPSession::setTimeout(const Poco::Timespan& connectionTimeout, const Poco
 }
 
 
+void HTTPSession::setBufferSize(std::streamsize size)
+{
+	poco_assert (size > 0);
+
+	if (size == _bufferSize) return;
+	if (_pCurrent < _pEnd) throw Poco::IllegalStateException("Cannot change buffer size while the buffer holds data");
+	if (_pBuffer)
+	{
+		HTTPBufferAllocator::deallocate(_pBuffer, _bufferSize);
+		_pBuffer = _pCurrent = _pEnd = nullptr;
+	}
+	_bufferSize = size;
+}
+
+
 int HTTPSession::get()
 {
 	if (_pCurrent == _pEnd)
@@ -176,10 +194,10 @@ void HTTPSession::refill()
 {
 	if (!_pBuffer)
 	{
-		_pBuffer = HTTPBufferAllocator::allocate(HTTPBufferAllocator::BUFFER_SIZE);
+		_pBuffer = HTTPBufferAllocator::allocate(_bufferSize);
 	}
 	_pCurrent = _pEnd = _pBuffer;
-	int n = receive(_pBuffer, HTTPBufferAllocator::BUFFER_SIZE);
+	int n = receive(_pBuffer, static_cast<int>(_bufferSize));
 	_pEnd += n;
 }
 
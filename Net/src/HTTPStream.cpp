@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPStream.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/SlabAllocator.h"
 
 
 namespace Poco::Net {
@@ -25,7 +26,7 @@ namespace Poco::Net {
 
 
 HTTPStreamBuf::HTTPStreamBuf(HTTPSession& session, openmode mode):
-	HTTPBasicStreamBuf(HTTPBufferAllocator::BUFFER_SIZE, mode),
+	HTTPBasicStreamBuf(session.getBufferSize(), mode),
 	_session(session),
 	_mode(mode)
 {
@@ -95,9 +96,6 @@ HTTPStreamBuf* HTTPIOS::rdbuf()
 //
 
 
-Poco::MemoryPool HTTPInputStream::_pool(sizeof(HTTPInputStream));
-
-
 HTTPInputStream::HTTPInputStream(HTTPSession& session):
 	HTTPIOS(session, std::ios::in),
 	std::istream(&_buf)
@@ -112,20 +110,13 @@ HTTPInputStream::~HTTPInputStream()
 
 void* HTTPInputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPInputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPInputStream));
 }
 
 
@@ -134,9 +125,6 @@ void HTTPInputStream::operator delete(void* ptr)
 //
 
 
-Poco::MemoryPool HTTPOutputStream::_pool(sizeof(HTTPOutputStream));
-
-
 HTTPOutputStream::HTTPOutputStream(HTTPSession& session):
 	HTTPIOS(session, std::ios::out),
 	std::ostream(&_buf)
@@ -151,20 +139,13 @@ HTTPOutputStream::~HTTPOutputStream()
 
 void* HTTPOutputStream::operator new(std::size_t size)
 {
-	return _pool.get();
+	return Poco::SlabAllocator::allocate(size);
 }
 
 
 void HTTPOutputStream::operator delete(void* ptr)
 {
-	try
-	{
-		_pool.release(ptr);
-	}
-	catch (...)
-	{
-		poco_unexpected();
-	}
+	Poco::SlabAllocator::deallocate(ptr, sizeof(HTTPOutputStream));
 }
 
 
@@ -135,6 +135,25 @@ void MessageHeader::read(std::istream& istr)
 }
 
 
+void MessageHeader::readField(std::string_view name, std::string_view value)
+{
+	if (_fieldLimit > 0 && static_cast<int>(size()) >= _fieldLimit)
+		throw MessageException("Too many header fields");
+	if (static_cast<int>(name.length()) >= _nameLengthLimit)
+		throw MessageException("Field name too long/no colon found");
+	if (static_cast<int>(value.length()) >= _valueLengthLimit)
+		throw MessageException("Field value too long/no CRLF found");
+
+	while (!value.empty() && Poco::Ascii::isSpace(value.back())) value.remove_suffix(1);
+
+	if (_autoDecode)
+		add(std::string(name), decodeWord(std::string(value)));
+	else
+		add(std::string(name), std::string(value));
+	_decodedOnRead = _autoDecode;
+}
+
+
 void MessageHeader::setAutoDecode(bool decode)
 {
 	_autoDecode = decode;
@@ -39,6 +39,7 @@ POCO_IMPLEMENT_EXCEPTION(MultipartException, MessageException, "Malformed multip
 POCO_IMPLEMENT_EXCEPTION(HTTPException, NetException, "HTTP Exception")
 POCO_IMPLEMENT_EXCEPTION(NotAuthenticatedException, HTTPException, "No authentication information found")
 POCO_IMPLEMENT_EXCEPTION(UnsupportedRedirectException, HTTPException, "Unsupported HTTP redirect (protocol change)")
+POCO_IMPLEMENT_EXCEPTION(HTTP2Exception, HTTPException, "HTTP/2 Exception")
 POCO_IMPLEMENT_EXCEPTION(FTPException, NetException, "FTP Exception")
 POCO_IMPLEMENT_EXCEPTION(SMTPException, NetException, "SMTP Exception")
 POCO_IMPLEMENT_EXCEPTION(POP3Exception, NetException, "POP3 Exception")
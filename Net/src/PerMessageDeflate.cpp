@@ -0,0 +1,276 @@
+//
+// PerMessageDeflate.cpp
+//
+// Library: Net
+// Package: WebSocket
+// Module:  PerMessageDeflate
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Net/WebSocket.h"
+#include "Poco/Net/MessageHeader.h"
+#include "Poco/Net/NameValueCollection.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/String.h"
+#include <set>
+#include <vector>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco::Net {
+
+
+namespace
+{
+	// Every message compressed with a sync flush ends with
+	// an empty stored block, which is removed from the payload
+	// by the sender and appended again by the receiver.
+	const char DEFLATE_TRAILER[] = {'\x00', '\x00', '\xff', '\xff'};
+	const std::size_t DEFLATE_TRAILER_LENGTH = sizeof(DEFLATE_TRAILER);
+
+	bool parseWindowBits(const std::string& value, int minBits, int& bits)
+	{
+		return Poco::NumberParser::tryParse(value, bits) && bits >= minBits && bits <= PerMessageDeflate::MAX_WINDOW_BITS;
+	}
+}
+
+
+const std::string PerMessageDeflate::EXTENSION_NAME("permessage-deflate");
+
+
+PerMessageDeflate::PerMessageDeflate(const Parameters& params, bool server):
+	_params(params),
+	_server(server),
+	_deflated(&_deflatedBuf),
+	_inflated(&_inflatedBuf)
+{
+}
+
+
+PerMessageDeflate::~PerMessageDeflate()
+{
+	// Discard the output written when the zlib streams are closed.
+	_deflatedBuf.setTarget(nullptr, 0);
+	_inflatedBuf.setTarget(nullptr, 0);
+}
+
+
+void PerMessageDeflate::compress(const char* data, std::size_t length, std::string& compressed)
+{
+	compressed.clear();
+	if (!_pDeflater)
+	{
+		int windowBits = _server ? _params.serverMaxWindowBits : _params.clientMaxWindowBits;
+		_pDeflater = std::make_unique<Poco::DeflatingOutputStream>(_deflated, -windowBits, Poco::DeflatingStreamBuf::DEFAULT_COMPRESSION);
+	}
+	_deflatedBuf.setTarget(&compressed, std::string::npos);
+	_pDeflater->write(data, static_cast<std::streamsize>(length));
+	_pDeflater->flush();
+	_deflatedBuf.setTarget(nullptr, 0);
+	if (!_pDeflater->good())
+	{
+		_pDeflater.reset();
+		throw Poco::IOException("Cannot compress WebSocket message");
+	}
+
+	if (compressed.size() >= DEFLATE_TRAILER_LENGTH && compressed.compare(compressed.size() - DEFLATE_TRAILER_LENGTH, DEFLATE_TRAILER_LENGTH, DEFLATE_TRAILER, DEFLATE_TRAILER_LENGTH) == 0)
+	{
+		compressed.resize(compressed.size() - DEFLATE_TRAILER_LENGTH);
+	}
+
+	if (_server ? _params.serverNoContextTakeover : _params.clientNoContextTakeover)
+	{
+		_pDeflater.reset();
+	}
+}
+
+
+void PerMessageDeflate::decompress(const char* data, std::size_t length, bool final, std::string& decompressed, std::size_t maxLength)
+{
+	if (!_pInflater)
+	{
+		_pInflater = std::make_unique<Poco::InflatingOutputStream>(_inflated, -MAX_WINDOW_BITS);
+	}
+	_inflatedBuf.setTarget(&decompressed, maxLength);
+	_pInflater->write(data, static_cast<std::streamsize>(length));
+	if (final) _pInflater->write(DEFLATE_TRAILER, DEFLATE_TRAILER_LENGTH);
+	_pInflater->flush();
+	bool exceeded = _inflatedBuf.exceeded();
+	_inflatedBuf.setTarget(nullptr, 0);
+	if (exceeded)
+	{
+		_pInflater.reset();
+		throw WebSocketException("Decompressed payload too big", WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	}
+	if (!_pInflater->good())
+	{
+		_pInflater.reset();
+		throw WebSocketException("Cannot decompress payload", WebSocket::WS_ERR_DECOMPRESSION_FAILED);
+	}
+
+	if (final && (_server ? _params.clientNoContextTakeover : _params.serverNoContextTakeover))
+	{
+		_pInflater->rdbuf()->reset();
+	}
+}
+
+
+std::string PerMessageDeflate::offer()
+{
+	return EXTENSION_NAME + "; client_max_window_bits"s;
+}
+
+
+bool PerMessageDeflate::negotiate(const std::string& offers, Parameters& params, std::string& response)
+{
+	std::vector<std::string> elements;
+	MessageHeader::splitElements(offers, elements);
+	for (const auto& element: elements)
+	{
+		std::string name;
+		NameValueCollection offerParams;
+		MessageHeader::splitParameters(element, name, offerParams);
+		if (Poco::icompare(name, EXTENSION_NAME) != 0) continue;
+
+		Parameters negotiated;
+		std::string accepted(EXTENSION_NAME);
+		std::set<std::string> seen;
+		bool acceptable = true;
+		for (const auto& p: offerParams)
+		{
+			if (!seen.insert(Poco::toLower(p.first)).second)
+			{
+				// duplicate parameter
+				acceptable = false;
+			}
+			else if (Poco::icompare(p.first, "server_no_context_takeover"s) == 0 && p.second.empty())
+			{
+				negotiated.serverNoContextTakeover = true;
+				accepted += "; server_no_context_takeover"s;
+			}
+			else if (Poco::icompare(p.first, "client_no_context_takeover"s) == 0 && p.second.empty())
+			{
+				negotiated.clientNoContextTakeover = true;
+				accepted += "; client_no_context_takeover"s;
+			}
+			else if (Poco::icompare(p.first, "server_max_window_bits"s) == 0)
+			{
+				if (parseWindowBits(p.second, MIN_WINDOW_BITS, negotiated.serverMaxWindowBits))
+				{
+					accepted += "; server_max_window_bits="s;
+					accepted += NumberFormatter::format(negotiated.serverMaxWindowBits);
+				}
+				else acceptable = false;
+			}
+			else if (Poco::icompare(p.first, "client_max_window_bits"s) == 0)
+			{
+				// The client may limit its window size, but does not have to.
+				// As the decompressor always uses the maximum window size,
+				// there is no need to limit the client's window size.
+				int bits;
+				if (!p.second.empty() && !parseWindowBits(p.second, 8, bits))
+					acceptable = false;
+			}
+			else acceptable = false;
+
+			if (!acceptable) break;
+		}
+		if (acceptable)
+		{
+			params = negotiated;
+			response = accepted;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+bool PerMessageDeflate::accept(const std::string& response, Parameters& params)
+{
+	std::vector<std::string> elements;
+	MessageHeader::splitElements(response, elements);
+	for (const auto& element: elements)
+	{
+		std::string name;
+		NameValueCollection responseParams;
+		MessageHeader::splitParameters(element, name, responseParams);
+		if (Poco::icompare(name, EXTENSION_NAME) != 0) continue;
+
+		Parameters accepted;
+		for (const auto& p: responseParams)
+		{
+			bool valid = false;
+			if (Poco::icompare(p.first, "server_no_context_takeover"s) == 0)
+			{
+				accepted.serverNoContextTakeover = true;
+				valid = p.second.empty();
+			}
+			else if (Poco::icompare(p.first, "client_no_context_takeover"s) == 0)
+			{
+				accepted.clientNoContextTakeover = true;
+				valid = p.second.empty();
+			}
+			else if (Poco::icompare(p.first, "server_max_window_bits"s) == 0)
+			{
+				valid = parseWindowBits(p.second, 8, accepted.serverMaxWindowBits);
+			}
+			else if (Poco::icompare(p.first, "client_max_window_bits"s) == 0)
+			{
+				valid = parseWindowBits(p.second, MIN_WINDOW_BITS, accepted.clientMaxWindowBits);
+			}
+			if (!valid) throw WebSocketException("Unsupported permessage-deflate parameter in handshake response", p.first, WebSocket::WS_ERR_HANDSHAKE_EXTENSION);
+		}
+		params = accepted;
+		return true;
+	}
+	return false;
+}
+
+
+void PerMessageDeflate::StringStreamBuf::setTarget(std::string* pTarget, std::size_t maxLength)
+{
+	_pTarget = pTarget;
+	_maxLength = maxLength;
+	_exceeded = false;
+}
+
+
+bool PerMessageDeflate::StringStreamBuf::exceeded() const
+{
+	return _exceeded;
+}
+
+
+PerMessageDeflate::StringStreamBuf::int_type PerMessageDeflate::StringStreamBuf::overflow(int_type c)
+{
+	if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+	char ch = traits_type::to_char_type(c);
+	return xsputn(&ch, 1) == 1 ? c : traits_type::eof();
+}
+
+
+std::streamsize PerMessageDeflate::StringStreamBuf::xsputn(const char* s, std::streamsize n)
+{
+	if (!_pTarget) return n;
+	if (_pTarget->size() + static_cast<std::size_t>(n) > _maxLength)
+	{
+		_exceeded = true;
+		return 0;
+	}
+	_pTarget->append(s, static_cast<std::size_t>(n));
+	return n;
+}
+
+
+} // namespace Poco::Net
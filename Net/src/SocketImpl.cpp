@@ -19,6 +19,7 @@
 #include "Poco/Timestamp.h"
 #include "Poco/FileStream.h"
 #include "Poco/Error.h"
+#include <vector>
 #include <string.h> // FD_SET needs memset on some platforms, so we can't use <cstring>
 
 
@@ -73,6 +74,35 @@ using Poco::NumberFormatter;
 using Poco::Timespan;
 
 
+#if !defined(POCO_HAVE_MMSG)
+namespace {
+
+#if defined(POCO_OS_FAMILY_WINDOWS)
+	inline char* bufferData(const Poco::Net::SocketBuf& buf)
+	{
+		return buf.buf;
+	}
+
+	inline int bufferLength(const Poco::Net::SocketBuf& buf)
+	{
+		return static_cast<int>(buf.len);
+	}
+#else
+	inline void* bufferData(const Poco::Net::SocketBuf& buf)
+	{
+		return buf.iov_base;
+	}
+
+	inline int bufferLength(const Poco::Net::SocketBuf& buf)
+	{
+		return static_cast<int>(buf.iov_len);
+	}
+#endif
+
+}
+#endif // !POCO_HAVE_MMSG
+
+
 #ifdef WEPOLL_H_
 namespace {
 
@@ -687,6 +717,133 @@ int SocketImpl::receiveFrom(SocketBufVec& buffers, struct sockaddr** pSA, poco_s
 }
 
 
+int SocketImpl::sendBatch(const SocketBufVec& buffers, const SocketAddress* pAddresses, int flags)
+{
+	if (buffers.empty()) return 0;
+	if (_sockfd == POCO_INVALID_SOCKET)
+	{
+		if (!pAddresses) throw InvalidSocketException();
+		init(pAddresses[0].af());
+	}
+#if defined(POCO_HAVE_MMSG)
+	std::vector<struct mmsghdr> msgs(buffers.size());
+	for (std::size_t i = 0; i < buffers.size(); ++i)
+	{
+		struct msghdr& msgHdr = msgs[i].msg_hdr;
+		if (pAddresses)
+		{
+			msgHdr.msg_name = const_cast<sockaddr*>(pAddresses[i].addr());
+			msgHdr.msg_namelen = pAddresses[i].length();
+		}
+		msgHdr.msg_iov = const_cast<iovec*>(&buffers[i]);
+		msgHdr.msg_iovlen = 1;
+	}
+	// The kernel may send fewer datagrams than requested
+	// (e.g., more than UIO_MAXIOV), so keep going until
+	// all have been sent or an error occurs.
+	std::size_t sent = 0;
+	while (sent < msgs.size())
+	{
+		int rc = ::sendmmsg(_sockfd, &msgs[sent], static_cast<unsigned>(msgs.size() - sent), flags);
+		if (rc < 0)
+		{
+			int err = lastError();
+			if (_blocking && err == POCO_EINTR) continue;
+			if (sent > 0) break;
+			if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+				return -1;
+			else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+				throw TimeoutException(err);
+			else
+				error(err);
+		}
+		sent += rc;
+	}
+	return static_cast<int>(sent);
+#else
+	int sent = 0;
+	for (const auto& buf: buffers)
+	{
+		int rc = pAddresses ?
+			sendTo(bufferData(buf), bufferLength(buf), pAddresses[sent], flags) :
+			sendBytes(bufferData(buf), bufferLength(buf), flags);
+		if (rc < 0) break;
+		++sent;
+	}
+	return sent > 0 ? sent : -1;
+#endif
+}
+
+
+int SocketImpl::receiveBatch(SocketBufVec& buffers, int* pLengths, struct sockaddr** ppSA, poco_socklen_t** ppSALen, int* pSegmentSizes, int flags)
+{
+	if (buffers.empty()) return 0;
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+#if defined(POCO_HAVE_MMSG)
+	if (_blocking)
+	{
+		checkBrokenTimeout(SELECT_READ);
+	}
+	const std::size_t controlSize = CMSG_SPACE(sizeof(int));
+	std::vector<struct mmsghdr> msgs(buffers.size());
+	std::vector<char> control(pSegmentSizes ? buffers.size()*controlSize : 0);
+	for (std::size_t i = 0; i < buffers.size(); ++i)
+	{
+		struct msghdr& msgHdr = msgs[i].msg_hdr;
+		msgHdr.msg_name = ppSA[i];
+		msgHdr.msg_namelen = *ppSALen[i];
+		msgHdr.msg_iov = &buffers[i];
+		msgHdr.msg_iovlen = 1;
+		if (pSegmentSizes)
+		{
+			msgHdr.msg_control = &control[i*controlSize];
+			msgHdr.msg_controllen = controlSize;
+		}
+	}
+	int rc;
+	do
+	{
+		// MSG_WAITFORONE: block for the first datagram only,
+		// then take whatever else is already queued.
+		rc = ::recvmmsg(_sockfd, msgs.data(), static_cast<unsigned>(msgs.size()), flags | MSG_WAITFORONE, nullptr);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+			;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			throw TimeoutException(err);
+		else
+			error(err);
+		return rc;
+	}
+	for (int i = 0; i < rc; ++i)
+	{
+		pLengths[i] = static_cast<int>(msgs[i].msg_len);
+		*ppSALen[i] = msgs[i].msg_hdr.msg_namelen;
+		if (pSegmentSizes)
+		{
+			pSegmentSizes[i] = 0;
+			for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); pCmsg; pCmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, pCmsg))
+			{
+				if (pCmsg->cmsg_level == IPPROTO_UDP && pCmsg->cmsg_type == UDP_GRO)
+					memcpy(&pSegmentSizes[i], CMSG_DATA(pCmsg), sizeof(int));
+			}
+		}
+	}
+	return rc;
+#else
+	int rc = receiveFrom(bufferData(buffers[0]), bufferLength(buffers[0]), ppSA, ppSALen, flags);
+	if (rc < 0) return rc;
+	pLengths[0] = rc;
+	if (pSegmentSizes) pSegmentSizes[0] = 0;
+	return 1;
+#endif
+}
+
+
 void SocketImpl::sendUrgent(unsigned char data)
 {
 	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
@@ -698,8 +855,6 @@ void SocketImpl::sendUrgent(unsigned char data)
 
 std::streamsize SocketImpl::sendFile(FileInputStream& fileInputStream, std::streamoff offset, std::streamsize count)
 {
-	if (!getBlocking()) throw NetException("sendFile() not supported for non-blocking sockets");
-
 #ifdef POCO_HAVE_SENDFILE
 	if (secure())
 	{
@@ -1535,15 +1690,23 @@ std::streamsize SocketImpl::sendFileNative(FileInputStream& fileInputStream, std
 	while (count > 0)
 	{
 		std::streamoff rc = sendFileUnix(_sockfd, fd, offset, count);
-		if (rc >= 0)
+		if (rc > 0)
 		{
 			sent += rc;
 			offset += rc;
 			count -= rc;
 		}
+		else if (rc == 0)
+		{
+			break; // end of file reached
+		}
 		else
 		{
-			error(errno);
+			int err = errno;
+			if (err == POCO_EINTR) continue;
+			if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+				return sent > 0 ? sent : -1;
+			error(err);
 		}
 	}
 	return sent;
@@ -1566,8 +1729,14 @@ std::streamsize SocketImpl::sendFileBlockwise(FileInputStream& fileInputStream,
 	std::streamsize n = fileInputStream.gcount();
 	while (n > 0 && (count == 0 || len < count))
 	{
+		int rc = sendBytes(buffer.begin(), static_cast<int>(n));
+		if (rc < static_cast<int>(n))
+		{
+			// only possible with a non-blocking socket
+			if (rc > 0) len += rc;
+			return len > 0 ? len : -1;
+		}
 		len += n;
-		sendBytes(buffer.begin(), static_cast<int>(n));
 		if (count > 0 && len < count)
 		{
 			const std::size_t remaining = count - len;
@@ -15,14 +15,28 @@
 #include "Poco/Net/SocketProactor.h"
 #include "Poco/Net/DatagramSocket.h"
 #include "Poco/Net/DatagramSocketImpl.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/Thread.h"
 #include "Poco/Exception.h"
+#include "Poco/Error.h"
 #ifdef POCO_OS_FAMILY_WINDOWS
 #ifdef max
 #undef max
 #endif // max
 #endif // POCO_OS_FAMILY_WINDOWS
 #include <limits>
+#if defined(POCO_HAVE_IO_URING) && !defined(POCO_NET_NO_IO_URING)
+	#include <linux/io_uring.h>
+	#include <sys/eventfd.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <csignal>
+	#include <cstring>
+	#include <unistd.h>
+	#if defined(IORING_FEAT_EXT_ARG)
+		#define POCO_PROACTOR_IO_URING 1
+	#endif
+#endif
 
 
 using Poco::Exception;
@@ -220,6 +234,545 @@ private:
 };
 
 
+#if defined(POCO_PROACTOR_IO_URING)
+
+
+//
+// IOUring
+//
+
+
+namespace {
+
+
+int ioUringSetup(unsigned entries, struct io_uring_params* pParams)
+{
+	return static_cast<int>(::syscall(__NR_io_uring_setup, entries, pParams));
+}
+
+
+int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* pArg, std::size_t argSize)
+{
+	return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, pArg, argSize));
+}
+
+
+[[noreturn]] void ioUringError(const std::string& func)
+{
+	int err = errno;
+	throw NetException(func, Poco::Error::getMessage(err), err);
+}
+
+
+} // namespace
+
+
+class IOUring
+	/// IOUring is a minimal io_uring engine used by SocketProactor
+	/// on Linux. I/O operations are prepared as submission queue
+	/// entries by the polling thread and submitted, together with
+	/// the wait for completions, in a single io_uring_enter() call.
+	///
+	/// Handlers are kept in per-socket, per-direction FIFO queues and
+	/// only the head of each queue is in flight at any time, which
+	/// preserves the ordering of the readiness-based implementation.
+	/// Handlers may be added from any thread; the polling thread is
+	/// woken up through an eventfd kept armed as a read request in
+	/// the ring.
+{
+public:
+	using Handler = SocketProactor::Handler;
+	using HandlerPtr = std::unique_ptr<Handler>;
+	using HandlerList = SocketProactor::IOHandlerList;
+	using Buffer = SocketProactor::Buffer;
+
+	static const unsigned DEFAULT_ENTRIES = 256;
+	static const int DEFAULT_STREAM_RECEIVE_SIZE = 8192;
+	static const int DEFAULT_DATAGRAM_RECEIVE_SIZE = 65536;
+
+	explicit IOUring(SocketProactor& proactor, unsigned entries = DEFAULT_ENTRIES):
+		_proactor(proactor),
+		_ringFd(-1),
+		_eventFd(-1),
+		_pSQRing(MAP_FAILED),
+		_pCQRing(MAP_FAILED),
+		_pSQEs(MAP_FAILED),
+		_sqRingSize(0),
+		_cqRingSize(0),
+		_sqeSize(0),
+		_inFlight(0),
+		_wakeUpArmed(false),
+		_wakeUpValue(0),
+		_waiting(false)
+	{
+		struct io_uring_params params;
+		std::memset(&params, 0, sizeof(params));
+		_ringFd = ioUringSetup(entries, &params);
+		if (_ringFd < 0) ioUringError("io_uring_setup()");
+		try
+		{
+			map(params);
+			_eventFd = ::eventfd(0, EFD_CLOEXEC);
+			if (_eventFd < 0) ioUringError("eventfd()");
+		}
+		catch (...)
+		{
+			unmap();
+			throw;
+		}
+	}
+
+	~IOUring()
+	{
+		try
+		{
+			cancelAll();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+		for (auto& e: _sockets)
+		{
+			for (auto& pH: e.second->read.handlers) release(*pH);
+			for (auto& pH: e.second->write.handlers) release(*pH);
+		}
+		unmap();
+	}
+
+	IOUring(const IOUring&) = delete;
+	IOUring& operator = (const IOUring&) = delete;
+
+	static bool available()
+		/// Returns true if the running kernel supports all the
+		/// io_uring features required by this implementation.
+	{
+		static const bool avail = []()
+		{
+			struct io_uring_params params;
+			std::memset(&params, 0, sizeof(params));
+			int fd = ioUringSetup(2, &params);
+			if (fd < 0) return false;
+			::close(fd);
+			return (params.features & IORING_FEAT_EXT_ARG) && (params.features & IORING_FEAT_NODROP);
+		}();
+		return avail;
+	}
+
+	void add(const Socket& sock, HandlerPtr pHandler, bool write)
+		/// Queues the handler for submission by the polling thread.
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			auto& pEntry = _sockets[sock.impl()->sockfd()];
+			if (!pEntry)
+			{
+				pEntry.reset(new SocketEntry);
+				pEntry->read.pEntry = pEntry.get();
+				pEntry->write.pEntry = pEntry.get();
+				pEntry->write.write = true;
+			}
+			if (pEntry->pSocket.get() != sock.impl())
+			{
+				// the descriptor may have been reused by another socket
+				poco_assert_dbg (idle(*pEntry));
+				pEntry->pSocket.assign(sock.impl(), true);
+				pEntry->datagram = (sock.impl()->type() == SocketImpl::SOCKET_TYPE_DATAGRAM);
+			}
+			Channel& ch = write ? pEntry->write : pEntry->read;
+			ch.handlers.push_back(std::move(pHandler));
+			schedule(ch);
+		}
+		wakeUp();
+	}
+
+	int poll(const Poco::Timespan& timeout)
+		/// Submits all pending operations and reaps the completed ones,
+		/// waiting up to timeout for at least one completion if none
+		/// is readily available. Returns the number of completed
+		/// I/O handlers.
+	{
+		bool wait = timeout.totalMicroseconds() > 0;
+		if (wait) _waiting = true;
+		prepare();
+		unsigned toSubmit = *_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+		if (wait && completionsReady()) wait = false;
+		if (toSubmit || wait)
+		{
+			struct __kernel_timespec ts;
+			ts.tv_sec = timeout.totalMicroseconds() / Poco::Timespan::SECONDS;
+			ts.tv_nsec = (timeout.totalMicroseconds() % Poco::Timespan::SECONDS) * 1000;
+			struct io_uring_getevents_arg arg;
+			std::memset(&arg, 0, sizeof(arg));
+			arg.sigmask_sz = _NSIG / 8;
+			arg.ts = reinterpret_cast<__u64>(&ts);
+			unsigned flags = wait ? (IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG) : 0;
+			int rc = ioUringEnter(_ringFd, toSubmit, wait ? 1 : 0, flags, wait ? &arg : nullptr, wait ? sizeof(arg) : 0);
+			if (rc < 0 && errno != ETIME && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			{
+				_waiting = false;
+				ioUringError("io_uring_enter()");
+			}
+		}
+		_waiting = false;
+		return reap();
+	}
+
+	void wakeUp()
+		/// Wakes up the polling thread, if it is waiting for completions.
+	{
+		if (_waiting.exchange(false))
+		{
+			std::uint64_t val = 1;
+			while (::write(_eventFd, &val, sizeof(val)) < 0 && errno == EINTR);
+		}
+	}
+
+	bool has(const Socket& sock) const
+		/// Returns true if there are operations queued for the socket.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _sockets.find(sock.impl()->sockfd());
+		return it != _sockets.end() && it->second->pSocket.get() == sock.impl();
+	}
+
+	bool hasSockets() const
+		/// Returns true if any socket has operations queued or in flight.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		return !_sockets.empty();
+	}
+
+private:
+	struct SocketEntry;
+
+	struct Channel
+		/// Channel holds the queue of handlers for one direction
+		/// of a socket, and the state of the operation in flight.
+	{
+		HandlerList handlers;
+		SocketEntry* pEntry = nullptr;
+		bool write = false;
+		bool inFlight = false;
+		bool scheduled = false;
+		struct msghdr msg;
+		struct iovec iov;
+		struct sockaddr_storage addr;
+	};
+
+	struct SocketEntry
+		/// SocketEntry keeps the socket alive while it
+		/// has operations queued or in flight.
+	{
+		Poco::AutoPtr<SocketImpl> pSocket;
+		bool datagram = false;
+		Channel read;
+		Channel write;
+	};
+
+	using SocketMap = std::unordered_map<poco_socket_t, std::unique_ptr<SocketEntry>>;
+
+	static bool idle(const SocketEntry& entry)
+	{
+		return entry.read.handlers.empty() && !entry.read.inFlight &&
+			entry.write.handlers.empty() && !entry.write.inFlight;
+	}
+
+	static void release(Handler& handler)
+	{
+		if (handler._owner)
+		{
+			delete handler._pBuf;
+			handler._pBuf = nullptr;
+			delete handler._pAddr;
+			handler._pAddr = nullptr;
+		}
+	}
+
+	void map(const struct io_uring_params& params)
+	{
+		_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMap) _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+
+		_pSQRing = ::mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ringFd, IORING_OFF_SQ_RING);
+		if (_pSQRing == MAP_FAILED) ioUringError("mmap(IORING_OFF_SQ_RING)");
+		if (singleMap)
+		{
+			_pCQRing = _pSQRing;
+		}
+		else
+		{
+			_pCQRing = ::mmap(nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ringFd, IORING_OFF_CQ_RING);
+			if (_pCQRing == MAP_FAILED) ioUringError("mmap(IORING_OFF_CQ_RING)");
+		}
+		_sqeSize = params.sq_entries * sizeof(struct io_uring_sqe);
+		_pSQEs = ::mmap(nullptr, _sqeSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ringFd, IORING_OFF_SQES);
+		if (_pSQEs == MAP_FAILED) ioUringError("mmap(IORING_OFF_SQES)");
+
+		char* pSQ = static_cast<char*>(_pSQRing);
+		_sqHead = reinterpret_cast<unsigned*>(pSQ + params.sq_off.head);
+		_sqTail = reinterpret_cast<unsigned*>(pSQ + params.sq_off.tail);
+		_sqMask = *reinterpret_cast<unsigned*>(pSQ + params.sq_off.ring_mask);
+		_sqEntries = params.sq_entries;
+		unsigned* pArray = reinterpret_cast<unsigned*>(pSQ + params.sq_off.array);
+		for (unsigned i = 0; i < _sqEntries; ++i) pArray[i] = i;
+
+		char* pCQ = static_cast<char*>(_pCQRing);
+		_cqHead = reinterpret_cast<unsigned*>(pCQ + params.cq_off.head);
+		_cqTail = reinterpret_cast<unsigned*>(pCQ + params.cq_off.tail);
+		_cqMask = *reinterpret_cast<unsigned*>(pCQ + params.cq_off.ring_mask);
+		_pCQEs = reinterpret_cast<struct io_uring_cqe*>(pCQ + params.cq_off.cqes);
+	}
+
+	void unmap()
+	{
+		if (_pSQEs != MAP_FAILED) ::munmap(_pSQEs, _sqeSize);
+		if (_pCQRing != MAP_FAILED && _pCQRing != _pSQRing) ::munmap(_pCQRing, _cqRingSize);
+		if (_pSQRing != MAP_FAILED) ::munmap(_pSQRing, _sqRingSize);
+		if (_eventFd >= 0) ::close(_eventFd);
+		if (_ringFd >= 0) ::close(_ringFd);
+		_pSQEs = _pCQRing = _pSQRing = MAP_FAILED;
+		_eventFd = _ringFd = -1;
+	}
+
+	struct io_uring_sqe* nextSQE()
+		/// Returns the next free submission queue entry,
+		/// or null if the submission queue is full.
+	{
+		unsigned tail = *_sqTail;
+		if (tail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries) return nullptr;
+		struct io_uring_sqe* pSQE = &static_cast<struct io_uring_sqe*>(_pSQEs)[tail & _sqMask];
+		std::memset(pSQE, 0, sizeof(*pSQE));
+		__atomic_store_n(_sqTail, tail + 1, __ATOMIC_RELEASE);
+		return pSQE;
+	}
+
+	bool completionsReady() const
+	{
+		return *_cqHead != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+	}
+
+	void schedule(Channel& ch)
+		/// Marks the channel for submission of its head handler.
+	{
+		if (!ch.inFlight && !ch.scheduled && !ch.handlers.empty())
+		{
+			ch.scheduled = true;
+			_scheduled.push_back(&ch);
+		}
+	}
+
+	void prepare()
+		/// Fills the submission queue with the scheduled operations.
+	{
+		if (!_wakeUpArmed)
+		{
+			struct io_uring_sqe* pSQE = nextSQE();
+			if (!pSQE) return;
+			pSQE->opcode = IORING_OP_READ;
+			pSQE->fd = _eventFd;
+			pSQE->addr = reinterpret_cast<__u64>(&_wakeUpValue);
+			pSQE->len = sizeof(_wakeUpValue);
+			pSQE->user_data = 0;
+			_wakeUpArmed = true;
+			++_inFlight;
+		}
+
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		std::size_t n = 0;
+		for (; n < _scheduled.size(); ++n)
+		{
+			Channel& ch = *_scheduled[n];
+			struct io_uring_sqe* pSQE = nextSQE();
+			if (!pSQE) break;
+			ch.scheduled = false;
+			prepare(ch, *pSQE);
+		}
+		_scheduled.erase(_scheduled.begin(), _scheduled.begin() + n);
+	}
+
+	void prepare(Channel& ch, struct io_uring_sqe& sqe)
+		/// Prepares the submission queue entry for the head handler of the channel.
+	{
+		SocketEntry& entry = *ch.pEntry;
+		Handler& handler = *ch.handlers.front();
+		Buffer* pBuf = handler._pBuf;
+		poco_check_ptr (pBuf);
+		if (!ch.write && pBuf->empty())
+		{
+			int avail = entry.pSocket->available();
+			if (avail <= 0) avail = entry.datagram ? DEFAULT_DATAGRAM_RECEIVE_SIZE : DEFAULT_STREAM_RECEIVE_SIZE;
+			pBuf->resize(avail);
+		}
+		sqe.fd = entry.pSocket->sockfd();
+		sqe.user_data = reinterpret_cast<__u64>(&ch);
+		sqe.msg_flags = ch.write ? MSG_NOSIGNAL : 0;
+		if (entry.datagram && (!ch.write || handler._pAddr))
+		{
+			ch.iov.iov_base = pBuf->data();
+			ch.iov.iov_len = pBuf->size();
+			std::memset(&ch.msg, 0, sizeof(ch.msg));
+			ch.msg.msg_iov = &ch.iov;
+			ch.msg.msg_iovlen = 1;
+			if (ch.write)
+			{
+				ch.msg.msg_name = const_cast<struct sockaddr*>(handler._pAddr->addr());
+				ch.msg.msg_namelen = handler._pAddr->length();
+			}
+			else
+			{
+				ch.msg.msg_name = &ch.addr;
+				ch.msg.msg_namelen = sizeof(ch.addr);
+			}
+			sqe.opcode = ch.write ? IORING_OP_SENDMSG : IORING_OP_RECVMSG;
+			sqe.addr = reinterpret_cast<__u64>(&ch.msg);
+			sqe.len = 1;
+		}
+		else
+		{
+			sqe.opcode = ch.write ? IORING_OP_SEND : IORING_OP_RECV;
+			sqe.addr = reinterpret_cast<__u64>(pBuf->data());
+			sqe.len = static_cast<__u32>(pBuf->size());
+		}
+		ch.inFlight = true;
+		++_inFlight;
+	}
+
+	int reap()
+		/// Delivers the available completions to the completion queue
+		/// of the proactor and schedules the next queued operations.
+	{
+		int handled = 0;
+		unsigned head = *_cqHead;
+		unsigned tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+		if (head == tail) return 0;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			for (; head != tail; ++head)
+			{
+				const struct io_uring_cqe& cqe = _pCQEs[head & _cqMask];
+				--_inFlight;
+				if (cqe.user_data == 0)
+				{
+					_wakeUpArmed = false;
+					continue;
+				}
+				complete(*reinterpret_cast<Channel*>(cqe.user_data), cqe.res);
+				++handled;
+			}
+			__atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+		}
+		if (handled) _proactor._ioCompletion.wakeUp();
+		return handled;
+	}
+
+	void complete(Channel& ch, int result)
+		/// Completes the head handler of the channel.
+	{
+		SocketEntry& entry = *ch.pEntry;
+		ch.inFlight = false;
+		HandlerPtr pHandler = std::move(ch.handlers.front());
+		ch.handlers.pop_front();
+		int n = result > 0 ? result : 0;
+		int err = result < 0 ? -result : 0;
+		if (!ch.write && entry.datagram && result >= 0 && pHandler->_pAddr)
+		{
+			*pHandler->_pAddr = SocketAddress(reinterpret_cast<const struct sockaddr*>(&ch.addr), ch.msg.msg_namelen);
+		}
+		_proactor.enqueueIONotification(std::move(pHandler->_onCompletion), n, err);
+		release(*pHandler);
+		schedule(ch);
+		if (idle(entry)) _sockets.erase(entry.pSocket->sockfd());
+	}
+
+	void cancelAll()
+		/// Cancels all the operations in flight and waits for
+		/// their completion, so that the kernel no longer
+		/// accesses the buffers owned by the handlers.
+	{
+		std::vector<__u64> ops;
+		if (_wakeUpArmed) ops.push_back(0);
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			for (auto& e: _sockets)
+			{
+				if (e.second->read.inFlight) ops.push_back(reinterpret_cast<__u64>(&e.second->read));
+				if (e.second->write.inFlight) ops.push_back(reinterpret_cast<__u64>(&e.second->write));
+			}
+		}
+		for (auto op: ops)
+		{
+			struct io_uring_sqe* pSQE = nextSQE();
+			if (!pSQE) break;
+			pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+			pSQE->addr = op;
+			pSQE->user_data = std::numeric_limits<__u64>::max();
+		}
+		// wait for the cancelled operations and the cancel requests themselves
+		unsigned pending = _inFlight + static_cast<unsigned>(ops.size());
+		struct __kernel_timespec ts = { 0, 100 * 1000 * 1000 };
+		struct io_uring_getevents_arg arg;
+		std::memset(&arg, 0, sizeof(arg));
+		arg.sigmask_sz = _NSIG / 8;
+		arg.ts = reinterpret_cast<__u64>(&ts);
+		for (int attempts = 0; pending > 0 && attempts < 10; ++attempts)
+		{
+			unsigned toSubmit = *_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+			ioUringEnter(_ringFd, toSubmit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+			unsigned head = *_cqHead;
+			unsigned tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+			for (; head != tail && pending > 0; ++head) --pending;
+			__atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+		}
+		_inFlight = 0;
+	}
+
+	SocketProactor&      _proactor;
+	int                  _ringFd;
+	int                  _eventFd;
+	void*                _pSQRing;
+	void*                _pCQRing;
+	void*                _pSQEs;
+	std::size_t          _sqRingSize;
+	std::size_t          _cqRingSize;
+	std::size_t          _sqeSize;
+	unsigned*            _sqHead = nullptr;
+	unsigned*            _sqTail = nullptr;
+	unsigned             _sqMask = 0;
+	unsigned             _sqEntries = 0;
+	unsigned*            _cqHead = nullptr;
+	unsigned*            _cqTail = nullptr;
+	unsigned             _cqMask = 0;
+	struct io_uring_cqe* _pCQEs = nullptr;
+	unsigned             _inFlight;
+	bool                 _wakeUpArmed;
+	std::uint64_t        _wakeUpValue;
+	std::atomic<bool>    _waiting;
+	SocketMap            _sockets;
+	std::vector<Channel*> _scheduled;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+#else
+
+
+class IOUring
+	/// Placeholder for platforms without io_uring support.
+{
+public:
+	static bool available()
+	{
+		return false;
+	}
+};
+
+
+#endif // POCO_PROACTOR_IO_URING
+
+
 //
 // SocketProactor
 //
@@ -238,6 +791,7 @@ SocketProactor::SocketProactor(bool worker):
 	_ioCompletion(_maxTimeout),
 	_pWorker(worker ? new Worker : nullptr)
 {
+	init(IO_BACKEND_POLL);
 }
 
 
@@ -251,6 +805,21 @@ SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
 	_ioCompletion(_maxTimeout),
 	_pWorker(worker ? new Worker : nullptr)
 {
+	init(IO_BACKEND_POLL);
+}
+
+
+SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker, IOBackend backend):
+	_isRunning(false),
+	_isStopped(false),
+	_stop(false),
+	_timeout(0),
+	_maxTimeout(static_cast<long>(timeout.totalMilliseconds())),
+	_pThread(nullptr),
+	_ioCompletion(_maxTimeout),
+	_pWorker(worker ? new Worker : nullptr)
+{
+	init(backend);
 }
 
 
@@ -258,6 +827,7 @@ SocketProactor::~SocketProactor()
 {
 	_ioCompletion.stop();
 	wait();
+	_pIOUring.reset();
 	for (auto& pS : _writeHandlers)
 	{
 		for (auto& pH : pS.second)
@@ -269,6 +839,29 @@ SocketProactor::~SocketProactor()
 }
 
 
+void SocketProactor::init(IOBackend backend)
+{
+	_timers.setWakeUpCallback([this]() { wakeUp(); });
+	if (backend == IO_BACKEND_POLL) return;
+	if (hasIOUring())
+	{
+#if defined(POCO_PROACTOR_IO_URING)
+		_pIOUring.reset(new IOUring(*this));
+#endif
+	}
+	else if (backend == IO_BACKEND_IO_URING)
+	{
+		throw Poco::NotImplementedException("SocketProactor: io_uring backend not available");
+	}
+}
+
+
+bool SocketProactor::hasIOUring()
+{
+	return IOUring::available();
+}
+
+
 void SocketProactor::wait()
 {
 	_ioCompletion.wakeUp();
@@ -289,6 +882,22 @@ int SocketProactor::poll(int* pHandled)
 {
 	int handled = 0;
 	int worked = 0;
+	int expired = static_cast<int>(_timers.advance());
+#if defined(POCO_PROACTOR_IO_URING)
+	if (_pIOUring)
+	{
+		// with io_uring, the sockets registered in the poll set
+		// have no readiness handlers; all I/O goes through the ring
+		handled = _pIOUring->poll(_timeout);
+		if (_pWorker)
+		{
+			if (hasSocketHandlers() && handled) worked = doWork();
+			else worked = doWork(false, true);
+		}
+		if (pHandled) *pHandled = handled + expired;
+		return worked;
+	}
+#endif
 	PollSet::SocketModeMap sm = _pollSet.poll(_timeout);
 	if (sm.size() > 0)
 	{
@@ -322,7 +931,7 @@ int SocketProactor::poll(int* pHandled)
 		else worked = doWork(false, true);
 	}
 
-	if (pHandled) *pHandled = handled;
+	if (pHandled) *pHandled = handled + expired;
 	return worked;
 }
 
@@ -335,10 +944,7 @@ void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketA
 	pHandler->_pAddr = std::addressof(addr);
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
-
-	Poco::Mutex::ScopedLock l(_readMutex);
-	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
-	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	addHandler(sock, std::move(pHandler), false);
 }
 
 
@@ -392,10 +998,7 @@ void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletio
 	pHandler->_pAddr = nullptr;
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
-
-	Poco::Mutex::ScopedLock l(_readMutex);
-	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
-	if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	addHandler(sock, std::move(pHandler), false);
 }
 
 
@@ -442,10 +1045,37 @@ void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr
 	pHandler->_pBuf = pMessage;
 	pHandler->_onCompletion = std::move(onCompletion);
 	pHandler->_owner = own;
+	addHandler(sock, std::move(pHandler), true);
+}
 
-	Poco::Mutex::ScopedLock l(_writeMutex);
-	_writeHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
-	if (!has(sock)) addSocket(sock, PollSet::POLL_WRITE);
+
+void SocketProactor::addHandler(Socket& sock, std::unique_ptr<Handler> pHandler, bool write)
+{
+#if defined(POCO_PROACTOR_IO_URING)
+	if (_pIOUring)
+	{
+		if (!pHandler->_pBuf || (write && pHandler->_pBuf->empty()))
+		{
+			if (pHandler->_owner) delete pHandler->_pAddr;
+			if (pHandler->_owner) delete pHandler->_pBuf;
+			throw Poco::InvalidArgumentException("SocketProactor: null or empty buffer");
+		}
+		_pIOUring->add(sock, std::move(pHandler), write);
+		return;
+	}
+#endif
+	if (write)
+	{
+		Poco::Mutex::ScopedLock l(_writeMutex);
+		_writeHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
+		if (!has(sock)) addSocket(sock, PollSet::POLL_WRITE);
+	}
+	else
+	{
+		Poco::Mutex::ScopedLock l(_readMutex);
+		_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
+		if (!has(sock)) addSocket(sock, PollSet::POLL_READ);
+	}
 }
 
 
@@ -654,8 +1284,9 @@ void SocketProactor::sleep(bool isAtWork)
 		{
 			if (_timeout < _maxTimeout) ++_timeout;
 		}
-		if (_pThread) _pThread->trySleep(_timeout);
-		else Thread::sleep(_timeout);
+		long timeout = static_cast<long>(_timers.nextTimeout(Poco::Timespan(static_cast<Poco::Timespan::TimeDiff>(_timeout)*1000)).totalMilliseconds());
+		if (_pThread) _pThread->trySleep(timeout);
+		else Thread::sleep(timeout);
 	}
 	catch (Exception& exc)
 	{
@@ -693,6 +1324,10 @@ bool SocketProactor::hasSocketHandlers() const
 {
 	if (_readHandlers.size() || _writeHandlers.size())
 		return true;
+#if defined(POCO_PROACTOR_IO_URING)
+	if (_pIOUring && _pIOUring->hasSockets())
+		return true;
+#endif
 	return false;
 }
 
@@ -710,6 +1345,9 @@ void SocketProactor::stop()
 
 void SocketProactor::wakeUp()
 {
+#if defined(POCO_PROACTOR_IO_URING)
+	if (_pIOUring) _pIOUring->wakeUp();
+#endif
 	if (_pThread) _pThread->wakeUp();
 }
 
@@ -777,6 +1415,10 @@ int SocketProactor::removePermanentWork(int count)
 
 bool SocketProactor::has(const Socket& sock) const
 {
+#if defined(POCO_PROACTOR_IO_URING)
+	if (_pIOUring && _pIOUring->has(sock))
+		return true;
+#endif
 	return _pollSet.has(sock);
 }
 
@@ -790,6 +1432,7 @@ bool SocketProactor::ioCompletionInProgress() const
 void SocketProactor::onShutdown()
 {
 	_pollSet.wakeUp();
+	wakeUp();
 	_ioCompletion.stop();
 	_ioCompletion.wait();
 }
@@ -16,6 +16,7 @@
 #include "Poco/ErrorHandler.h"
 #include "Poco/Thread.h"
 #include "Poco/Stopwatch.h"
+#include "Poco/Timestamp.h"
 #include "Poco/Exception.h"
 
 
@@ -38,6 +39,7 @@ SocketReactor::SocketReactor():
 	_pTimeoutNotification(new TimeoutNotification(this)),
 	_pShutdownNotification(new ShutdownNotification(this))
 {
+	_timers.setWakeUpCallback([this]() { wakeUp(); });
 }
 
 
@@ -51,6 +53,7 @@ SocketReactor::SocketReactor(const Poco::Timespan& pollTimeout, int threadAffini
 	_pShutdownNotification(new ShutdownNotification(this))
 {
 	_params.pollTimeout = pollTimeout;
+	_timers.setWakeUpCallback([this]() { wakeUp(); });
 }
 
 SocketReactor::SocketReactor(const Params& params, int threadAffinity):
@@ -63,7 +66,7 @@ SocketReactor::SocketReactor(const Params& params, int threadAffinity):
 	_pTimeoutNotification(new TimeoutNotification(this)),
 	_pShutdownNotification(new ShutdownNotification(this))
 {
-
+	_timers.setWakeUpCallback([this]() { wakeUp(); });
 }
 
 
@@ -83,14 +86,17 @@ void SocketReactor::run()
 	Poco::Stopwatch sw;
 	if (_params.throttle) sw.start();
 	PollSet::SocketModeMap sm;
+	Poco::Timestamp idleSince;
 	while (!_stop)
 	{
 		try
 		{
 			if (hasSocketHandlers())
 			{
-				sm = _pollSet.poll(_params.pollTimeout);
+				Poco::Timespan timeout = _timers.nextTimeout(_params.pollTimeout);
+				sm = _pollSet.poll(timeout);
 				if (_stop) break;
+				_timers.advance();
 				for (const auto& s : sm)
 				{
 					try
@@ -124,15 +130,22 @@ void SocketReactor::run()
 						ErrorHandler::handle();
 					}
 				}
-				if (0 == sm.size())
+				// Timers may shorten the poll, so the idle time since the
+				// last socket event or timeout is checked as well.
+				if (0 == sm.size() && (timeout == _params.pollTimeout || idleSince.isElapsed(_params.pollTimeout.totalMicroseconds())))
 				{
+					idleSince.update();
 					onTimeout();
 					if (_params.throttle && _params.pollTimeout == 0)
 					{
 						if ((sw.elapsed()/1000) > _params.sleepLimit) sleep();
 					}
 				}
-				else if (_params.throttle) sw.restart();
+				else
+				{
+					if (0 != sm.size()) idleSince.update();
+					if (_params.throttle) sw.restart();
+				}
 			}
 			else sleep();
 		}
@@ -159,7 +172,9 @@ void SocketReactor::run()
 void SocketReactor::sleep()
 {
 	if (_params.sleep < _params.sleepLimit) ++_params.sleep;
-	_event.tryWait(_params.sleep);
+	Poco::Timespan timeout = _timers.nextTimeout(Poco::Timespan(static_cast<Poco::Timespan::TimeDiff>(_params.sleep)*1000));
+	_event.tryWait(static_cast<long>(timeout.totalMilliseconds()));
+	_timers.advance();
 }
 
 
@@ -17,7 +17,6 @@
 #include "Poco/Exception.h"
 
 
-using Poco::BufferedBidirectionalStreamBuf;
 using Poco::InvalidArgumentException;
 
 
@@ -30,7 +29,7 @@ namespace Poco::Net {
 
 
 SocketStreamBuf::SocketStreamBuf(const Socket& socket):
-	BufferedBidirectionalStreamBuf(STREAM_BUFFER_SIZE, std::ios::in | std::ios::out),
+	SocketBasicStreamBuf(STREAM_BUFFER_SIZE, std::ios::in | std::ios::out),
 	_pImpl(dynamic_cast<StreamSocketImpl*>(socket.impl()))
 {
 	if (_pImpl)
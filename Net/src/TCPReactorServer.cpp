@@ -15,20 +15,26 @@ TCPReactorServer::TCPReactorServer(int port, TCPServerParams::Ptr pParams)
 
 TCPReactorServer::TCPReactorServer(const SocketAddress& address, TCPServerParams::Ptr pParams)
 	: _threadPool("TCPRA", pParams->getAcceptorNum()),
-	  _reactors(pParams->getAcceptorNum()),
 	  _pParams(pParams),
 	  _port(address.port()),
 	  _stopped(false)
 {
-	for (auto& reactor : _reactors)
+	SocketAddress bindAddress(address);
+	for (int i = 0; i < _pParams->getAcceptorNum(); ++i)
 	{
-		ServerSocket socket(address);
+		_reactors.push_back(std::make_unique<SocketReactor>(SocketReactor::Params(), _pParams->getThreadAffinity(i)));
+
+		// ServerSocket binds with SO_REUSEADDR and SO_REUSEPORT; once the
+		// first socket has been bound (possibly to an ephemeral port),
+		// the remaining ones must share its actual address.
+		ServerSocket socket(bindAddress);
 		_sockets.push_back(socket);
 		if (_sockets.size() == 1)
 		{
-			_port = socket.address().port();
+			bindAddress = socket.address();
+			_port = bindAddress.port();
 		}
-		auto acceptor = std::make_shared<TCPReactorAcceptor>(socket, reactor, _pParams);
+		auto acceptor = std::make_shared<TCPReactorAcceptor>(socket, *_reactors.back(), _pParams);
 		_acceptors.push_back(acceptor);
 	}
 }
@@ -40,9 +46,9 @@ TCPReactorServer::~TCPReactorServer()
 
 void TCPReactorServer::start()
 {
-	for (auto& reactor : _reactors)
+	for (auto& pReactor : _reactors)
 	{
-		_threadPool.start(reactor);
+		_threadPool.start(*pReactor);
 	}
 }
 
@@ -54,6 +60,13 @@ void TCPReactorServer::setRecvMessageCallback(const RecvMessageCallback& cb)
 	}
 }
 
+void TCPReactorServer::setRecvMessageCallback(int acceptor, const RecvMessageCallback& cb)
+{
+	poco_assert (acceptor >= 0 && acceptor < acceptors());
+
+	_acceptors[acceptor]->setRecvMessageCallback(cb);
+}
+
 void TCPReactorServer::stop()
 {
 	if (_stopped.exchange(true))
@@ -64,9 +77,9 @@ void TCPReactorServer::stop()
 	{
 		acceptor->stop();
 	}
-	for (auto& reactor : _reactors)
+	for (auto& pReactor : _reactors)
 	{
-		reactor.stop();
+		pReactor->stop();
 	}
 	_threadPool.joinAll();
 }
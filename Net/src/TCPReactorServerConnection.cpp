@@ -34,13 +34,33 @@ void TCPReactorServerConnection::onRead(const AutoPtr<ReadableNotification>& pNf
 		handleClose();
 	} else if (n < 0)
 	{
-		// TODO
-		handleClose();
+		// the socket is non-blocking while a file transfer is pending
+		if (!_pPendingFile) handleClose();
 	} else
 	{
 		_buf.append(tmp, n);
-		_rcvCallback(shared_from_this());
+		// responses must not overtake a pending file transfer
+		if (!_pPendingFile) _rcvCallback(shared_from_this());
+	}
+}
+
+void TCPReactorServerConnection::onWritable(const AutoPtr<WritableNotification>& pNf)
+{
+	try
+	{
+		if (!continueSendFile()) return;
 	}
+	catch (Poco::Exception&)
+	{
+		handleClose();
+		return;
+	}
+	_reactor.removeEventHandler(
+		_socket,
+		HTTPObserver<TCPReactorServerConnection, WritableNotification>(
+			shared_from_this(), &TCPReactorServerConnection::onWritable));
+	finishSendFile();
+	if (!_buf.empty() && _rcvCallback) _rcvCallback(shared_from_this());
 }
 
 void TCPReactorServerConnection::onError(const AutoPtr<ErrorNotification>& pNf)
@@ -57,6 +77,14 @@ void TCPReactorServerConnection::handleClose()
 {
 	// here must keep _socket to delay the _socket destrcutor
 	StreamSocket keepSocket = _socket;
+	if (_pPendingFile)
+	{
+		_pPendingFile.reset();
+		_reactor.removeEventHandler(
+			_socket,
+			HTTPObserver<TCPReactorServerConnection, WritableNotification>(
+				shared_from_this(), &TCPReactorServerConnection::onWritable));
+	}
 	// here will delete this, so memberships' destructor will be invoked
 	_reactor.removeEventHandler(
 		_socket,
@@ -74,10 +102,71 @@ std::string& TCPReactorServerConnection::buffer()
 	return _buf;
 }
 
+Poco::Any& TCPReactorServerConnection::context()
+{
+	return _context;
+}
+
 void TCPReactorServerConnection::setRecvMessageCallback(const RecvMessageCallback& cb)
 {
 	_rcvCallback = cb;
 }
 
+void TCPReactorServerConnection::sendFile(const std::shared_ptr<Poco::FileInputStream>& pStream, std::streamoff offset, std::streamsize count)
+{
+	poco_assert (!_pPendingFile);
+	poco_check_ptr (pStream);
+
+	if (count <= 0) return;
+
+	_pPendingFile = pStream;
+	_pendingOffset = offset;
+	_pendingCount = count;
+	_socket.setBlocking(false);
+	try
+	{
+		if (continueSendFile())
+		{
+			finishSendFile();
+			return;
+		}
+	}
+	catch (...)
+	{
+		finishSendFile();
+		throw;
+	}
+	_reactor.addEventHandler(
+		_socket,
+		HTTPObserver<TCPReactorServerConnection, WritableNotification>(
+			shared_from_this(), &TCPReactorServerConnection::onWritable));
+}
+
+bool TCPReactorServerConnection::sendPending() const
+{
+	return _pPendingFile != nullptr;
+}
+
+bool TCPReactorServerConnection::continueSendFile()
+{
+	std::streamsize n = _socket.sendFile(*_pPendingFile, _pendingOffset, _pendingCount);
+	if (n > 0)
+	{
+		_pendingOffset += n;
+		_pendingCount -= n;
+	}
+	else if (n == 0)
+	{
+		throw ReadFileException("File truncated during transfer");
+	}
+	return _pendingCount <= 0;
+}
+
+void TCPReactorServerConnection::finishSendFile()
+{
+	_pPendingFile.reset();
+	_socket.setBlocking(true);
+}
+
 } // namespace Poco::Net
 
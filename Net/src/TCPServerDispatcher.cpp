@@ -55,6 +55,30 @@ class StopNotification: public Notification
 };
 
 
+class TCPConnectionTask: public Poco::Runnable
+	/// Runs a single connection in an ActiveThreadPool,
+	/// then deletes itself.
+{
+public:
+	TCPConnectionTask(TCPServerDispatcher* pDispatcher, const StreamSocket& socket):
+		_pDispatcher(pDispatcher, true),
+		_socket(socket)
+	{
+	}
+
+	void run() override
+	{
+		--_pDispatcher->_queuedConnections;
+		_pDispatcher->runConnection(_socket);
+		delete this;
+	}
+
+private:
+	AutoPtr<TCPServerDispatcher> _pDispatcher;
+	StreamSocket _socket;
+};
+
+
 TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::ThreadPool& threadPool, TCPServerParams::Ptr pParams):
 	_rc(1),
 	_pParams(pParams),
@@ -65,7 +89,33 @@ TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactor
 	_refusedConnections(0),
 	_stopped(false),
 	_pConnectionFactory(pFactory),
-	_threadPool(threadPool)
+	_pThreadPool(&threadPool),
+	_pActiveThreadPool(nullptr),
+	_queuedConnections(0)
+{
+	poco_check_ptr (pFactory);
+
+	if (!_pParams)
+		_pParams = new TCPServerParams;
+
+	if (_pParams->getMaxThreads() == 0)
+		_pParams->setMaxThreads(threadPool.capacity());
+}
+
+
+TCPServerDispatcher::TCPServerDispatcher(TCPServerConnectionFactory::Ptr pFactory, Poco::ActiveThreadPool& threadPool, TCPServerParams::Ptr pParams):
+	_rc(1),
+	_pParams(pParams),
+	_currentThreads(0),
+	_totalConnections(0),
+	_currentConnections(0),
+	_maxConcurrentConnections(0),
+	_refusedConnections(0),
+	_stopped(false),
+	_pConnectionFactory(pFactory),
+	_pThreadPool(nullptr),
+	_pActiveThreadPool(&threadPool),
+	_queuedConnections(0)
 {
 	poco_check_ptr (pFactory);
 
@@ -141,6 +191,31 @@ namespace
 
 void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 {
+	if (_pActiveThreadPool)
+	{
+		if (_queuedConnections < _pParams->getMaxQueued() && !_stopped)
+		{
+			++_queuedConnections;
+			try
+			{
+				std::unique_ptr<TCPConnectionTask> pTask(new TCPConnectionTask(this, socket));
+				_pActiveThreadPool->start(*pTask);
+				pTask.release(); // the task deletes itself after running
+			}
+			catch (...)
+			{
+				--_queuedConnections;
+				++_refusedConnections;
+				throw;
+			}
+		}
+		else
+		{
+			++_refusedConnections;
+		}
+		return;
+	}
+
 	FastMutex::ScopedLock lock(_mutex);
 
 	if (_queue.size() < _pParams->getMaxQueued())
@@ -150,7 +225,7 @@ void TCPServerDispatcher::enqueue(const StreamSocket& socket)
 		{
 			try
 			{
-				_threadPool.startWithPriority(_pParams->getThreadPriority(), *this, threadName);
+				_pThreadPool->startWithPriority(_pParams->getThreadPriority(), *this, threadName);
 				++_currentThreads;
 				// Ensure this object lives at least until run() starts
 				// Small chance of leaking if threadpool is stopped before this
@@ -176,10 +251,13 @@ void TCPServerDispatcher::stop()
 	FastMutex::ScopedLock lock(_mutex);
 	_pConnectionFactory->stop();
 	_stopped = true;
-	_queue.clear();
-	for (int i = 0; i < _threadPool.allocated(); i++)
+	if (_pThreadPool)
 	{
-		_queue.enqueueNotification(new StopNotification);
+		_queue.clear();
+		for (int i = 0; i < _pThreadPool->allocated(); i++)
+		{
+			_queue.enqueueNotification(new StopNotification);
+		}
 	}
 }
 
@@ -193,7 +271,7 @@ int TCPServerDispatcher::maxThreads() const
 {
 	FastMutex::ScopedLock lock(_mutex);
 
-	return _threadPool.capacity();
+	return _pThreadPool ? _pThreadPool->capacity() : _pActiveThreadPool->capacity();
 }
 
 
@@ -217,6 +295,8 @@ int TCPServerDispatcher::maxConcurrentConnections() const
 
 int TCPServerDispatcher::queuedConnections() const
 {
+	if (_pActiveThreadPool) return _queuedConnections;
+
 	return _queue.size();
 }
 
@@ -229,12 +309,12 @@ int TCPServerDispatcher::refusedConnections() const
 
 void TCPServerDispatcher::beginConnection()
 {
-	FastMutex::ScopedLock lock(_mutex);
-
 	++_totalConnections;
-	++_currentConnections;
-	if (_currentConnections > _maxConcurrentConnections)
-		_maxConcurrentConnections.store(_currentConnections);
+	int current = ++_currentConnections;
+	int maxConcurrent = _maxConcurrentConnections;
+	while (current > maxConcurrent && !_maxConcurrentConnections.compare_exchange_weak(maxConcurrent, current))
+	{
+	}
 }
 
 
@@ -244,4 +324,26 @@ void TCPServerDispatcher::endConnection()
 }
 
 
+void TCPServerDispatcher::runConnection(const StreamSocket& socket)
+{
+	if (_stopped) return;
+
+	++_currentThreads;
+	try
+	{
+		std::unique_ptr<TCPServerConnection> pConnection(_pConnectionFactory->createConnection(socket));
+		if (pConnection)
+		{
+			beginConnection();
+			pConnection->start();
+			endConnection();
+		}
+	}
+	catch (Poco::Exception &exc) { ErrorHandler::handle(exc); }
+	catch (std::exception &exc)  { ErrorHandler::handle(exc); }
+	catch (...)                  { ErrorHandler::handle();    }
+	--_currentThreads;
+}
+
+
 } // namespace Poco::Net
@@ -94,4 +94,21 @@ void TCPServerParams::setUseSelfReactor(bool useSelfReactor)
 }
 
 
+void TCPServerParams::setThreadAffinity(const std::vector<int>& cpus)
+{
+	for (int cpu: cpus) poco_assert (cpu >= 0);
+
+	_threadAffinity = cpus;
+}
+
+
+int TCPServerParams::getThreadAffinity(int acceptor) const
+{
+	poco_assert (acceptor >= 0);
+
+	if (_threadAffinity.empty()) return -1;
+	return _threadAffinity[acceptor % _threadAffinity.size()];
+}
+
+
 } // namespace Poco::Net
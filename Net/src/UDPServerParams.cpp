@@ -28,7 +28,8 @@ UDPServerParams::UDPServerParams(const Poco::Net::SocketAddress& sa,
 		_timeout(timeout),
 		_handlerBufListSize(handlerBufListSize),
 		_notifySender(notifySender),
-		_backlogThreshold(backlogThreshold)
+		_backlogThreshold(backlogThreshold),
+		_batchSize(1)
 {
 }
 
@@ -38,4 +39,12 @@ UDPServerParams::~UDPServerParams()
 }
 
 
+void UDPServerParams::setBatchSize(int batchSize)
+{
+	poco_assert (batchSize > 0);
+
+	_batchSize = batchSize;
+}
+
+
 } // namespace Poco::Net
@@ -14,6 +14,7 @@
 
 #include "Poco/Net/WebSocket.h"
 #include "Poco/Net/WebSocketImpl.h"
+#include "Poco/Net/PerMessageDeflate.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/HTTPClientSession.h"
@@ -27,6 +28,7 @@
 #include "Poco/String.h"
 #include "Poco/Random.h"
 #include "Poco/StreamCopier.h"
+#include <memory>
 #include <sstream>
 
 
@@ -47,12 +49,24 @@ WebSocket::WebSocket(HTTPServerRequest& request, HTTPServerResponse& response):
 }
 
 
+WebSocket::WebSocket(HTTPServerRequest& request, HTTPServerResponse& response, int options):
+	StreamSocket(accept(request, response, options))
+{
+}
+
+
 WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response):
 	StreamSocket(connect(cs, request, response, _defaultCreds))
 {
 }
 
 
+WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, int options):
+	StreamSocket(connect(cs, request, response, _defaultCreds, options))
+{
+}
+
+
 WebSocket::WebSocket(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials):
 	StreamSocket(connect(cs, request, response, credentials))
 {
@@ -192,7 +206,13 @@ int WebSocket::getMaxPayloadSize() const
 }
 
 
-WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse& response)
+bool WebSocket::compressed() const
+{
+	return static_cast<WebSocketImpl*>(impl())->perMessageDeflate() != nullptr;
+}
+
+
+WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse& response, int options)
 {
 	if (request.hasToken("Connection"s, "upgrade"s) && icompare(request.get("Upgrade"s, ""s), "websocket"s) == 0)
 	{
@@ -207,17 +227,42 @@ WebSocketImpl* WebSocket::accept(HTTPServerRequest& request, HTTPServerResponse&
 		response.set("Upgrade"s, "websocket"s);
 		response.set("Connection"s, "Upgrade"s);
 		response.set("Sec-WebSocket-Accept"s, computeAccept(key));
+
+		std::unique_ptr<PerMessageDeflate> pDeflate;
+		if (options & WS_OPT_PERMESSAGE_DEFLATE)
+		{
+			// The offers may be spread over multiple header fields.
+			std::string offers;
+			for (const auto& h: request)
+			{
+				if (icompare(h.first, "Sec-WebSocket-Extensions"s) == 0)
+				{
+					if (!offers.empty()) offers += ", "s;
+					offers += h.second;
+				}
+			}
+			PerMessageDeflate::Parameters params;
+			std::string extension;
+			if (PerMessageDeflate::negotiate(offers, params, extension))
+			{
+				response.set("Sec-WebSocket-Extensions"s, extension);
+				pDeflate = std::make_unique<PerMessageDeflate>(params, true);
+			}
+		}
+
 		response.setContentLength(HTTPResponse::UNKNOWN_CONTENT_LENGTH);
 		response.send().flush();
 
 		HTTPServerRequestImpl& requestImpl = static_cast<HTTPServerRequestImpl&>(request);
-		return new WebSocketImpl(static_cast<StreamSocketImpl*>(requestImpl.detachSocket().impl()), requestImpl.session(), false);
+		WebSocketImpl* pImpl = new WebSocketImpl(static_cast<StreamSocketImpl*>(requestImpl.detachSocket().impl()), requestImpl.session(), false);
+		pImpl->setPerMessageDeflate(pDeflate.release());
+		return pImpl;
 	}
 	else throw WebSocketException("No WebSocket handshake", WS_ERR_NO_HANDSHAKE);
 }
 
 
-WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials)
+WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, HTTPResponse& response, HTTPCredentials& credentials, int options)
 {
 	if (!cs.getProxyHost().empty() && !cs.secure())
 	{
@@ -228,13 +273,17 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 	request.set("Upgrade"s, "websocket"s);
 	request.set("Sec-WebSocket-Version"s, WEBSOCKET_VERSION);
 	request.set("Sec-WebSocket-Key"s, key);
+	if (options & WS_OPT_PERMESSAGE_DEFLATE)
+	{
+		request.set("Sec-WebSocket-Extensions"s, PerMessageDeflate::offer());
+	}
 	request.setChunkedTransferEncoding(false);
 	cs.setKeepAlive(true);
 	cs.sendRequest(request);
 	std::istream& istr = cs.receiveResponse(response);
 	if (response.getStatus() == HTTPResponse::HTTP_SWITCHING_PROTOCOLS)
 	{
-		return completeHandshake(cs, response, key);
+		return completeHandshake(cs, response, key, options);
 	}
 	else if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
 	{
@@ -252,7 +301,7 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 			cs.receiveResponse(response);
 			if (response.getStatus() == HTTPResponse::HTTP_SWITCHING_PROTOCOLS)
 			{
-				return completeHandshake(cs, response, key);
+				return completeHandshake(cs, response, key, options);
 			}
 			else if (response.getStatus() == HTTPResponse::HTTP_UNAUTHORIZED)
 			{
@@ -272,7 +321,7 @@ WebSocketImpl* WebSocket::connect(HTTPClientSession& cs, HTTPRequest& request, H
 }
 
 
-WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key)
+WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse& response, const std::string& key, int options)
 {
 	std::string connection = response.get("Connection"s, ""s);
 	if (Poco::icompare(connection, "Upgrade"s) != 0)
@@ -283,7 +332,17 @@ WebSocketImpl* WebSocket::completeHandshake(HTTPClientSession& cs, HTTPResponse&
 	std::string accept = response.get("Sec-WebSocket-Accept"s, ""s);
 	if (accept != computeAccept(key))
 		throw WebSocketException("Invalid or missing Sec-WebSocket-Accept header in handshake response", WS_ERR_HANDSHAKE_ACCEPT);
-	return new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), cs, true);
+
+	std::unique_ptr<PerMessageDeflate> pDeflate;
+	PerMessageDeflate::Parameters params;
+	if ((options & WS_OPT_PERMESSAGE_DEFLATE) && PerMessageDeflate::accept(response.get("Sec-WebSocket-Extensions"s, ""s), params))
+	{
+		pDeflate = std::make_unique<PerMessageDeflate>(params, false);
+	}
+
+	WebSocketImpl* pImpl = new WebSocketImpl(static_cast<StreamSocketImpl*>(cs.detachSocket().impl()), cs, true);
+	pImpl->setPerMessageDeflate(pDeflate.release());
+	return pImpl;
 }
 
 
@@ -37,7 +37,8 @@ WebSocketImpl::WebSocketImpl(StreamSocketImpl* pStreamSocketImpl, HTTPSession& s
 	_maxPayloadSize(std::numeric_limits<int>::max()),
 	_buffer(0),
 	_bufferOffset(0),
-	_mustMaskPayload(mustMaskPayload)
+	_mustMaskPayload(mustMaskPayload),
+	_inflating(false)
 {
 	poco_check_ptr(pStreamSocketImpl);
 	_pStreamSocketImpl->duplicate();
@@ -104,52 +105,64 @@ int WebSocketImpl::sendBytes(const void* buffer, int length, int flags)
 		else return -1;
 	}
 
+	if (flags == 0) flags = WebSocket::FRAME_BINARY;
+	flags &= 0xff;
+
+	const char* payload = reinterpret_cast<const char*>(buffer);
+	int payloadLength = length;
+	int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+	if (_pDeflate && length > 0 && (flags & WebSocket::FRAME_FLAG_FIN) && !(flags & WebSocket::FRAME_FLAG_RSV1) && (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY))
+	{
+		// Only unfragmented messages are compressed.
+		_pDeflate->compress(payload, length, _deflateBuffer);
+		payload = _deflateBuffer.data();
+		payloadLength = static_cast<int>(_deflateBuffer.size());
+		flags |= WebSocket::FRAME_FLAG_RSV1;
+	}
+
 	Poco::Buffer<char>& frame(_sendState.payload);
-	frame.resize(length + MAX_HEADER_LENGTH, false);
+	frame.resize(payloadLength + MAX_HEADER_LENGTH, false);
 	Poco::MemoryOutputStream ostr(frame.begin(), frame.size());
 	Poco::BinaryWriter writer(ostr, Poco::BinaryWriter::NETWORK_BYTE_ORDER);
 
-	if (flags == 0) flags = WebSocket::FRAME_BINARY;
-	flags &= 0xff;
 	writer << static_cast<Poco::UInt8>(flags);
 	Poco::UInt8 lengthByte(0);
 	if (_mustMaskPayload)
 	{
 		lengthByte |= FRAME_FLAG_MASK;
 	}
-	if (length < 126)
+	if (payloadLength < 126)
 	{
-		lengthByte |= static_cast<Poco::UInt8>(length);
+		lengthByte |= static_cast<Poco::UInt8>(payloadLength);
 		writer << lengthByte;
 	}
-	else if (length < 65536)
+	else if (payloadLength < 65536)
 	{
 		lengthByte |= 126;
-		writer << lengthByte << static_cast<Poco::UInt16>(length);
+		writer << lengthByte << static_cast<Poco::UInt16>(payloadLength);
 	}
 	else
 	{
 		lengthByte |= 127;
-		writer << lengthByte << static_cast<Poco::UInt64>(length);
+		writer << lengthByte << static_cast<Poco::UInt64>(payloadLength);
 	}
 	if (_mustMaskPayload)
 	{
 		const Poco::UInt32 mask = _rnd.next();
 		const char* m = reinterpret_cast<const char*>(&mask);
-		const char* b = reinterpret_cast<const char*>(buffer);
 		writer.writeRaw(m, MASK_LENGTH);
 		char* p = frame.begin() + ostr.charsWritten();
-		for (int i = 0; i < length; i++)
+		for (int i = 0; i < payloadLength; i++)
 		{
-			p[i] = b[i] ^ m[i % MASK_LENGTH];
+			p[i] = payload[i] ^ m[i % MASK_LENGTH];
 		}
 	}
 	else
 	{
-		std::memcpy(frame.begin() + ostr.charsWritten(), buffer, length);
+		std::memcpy(frame.begin() + ostr.charsWritten(), payload, payloadLength);
 	}
 
-	int frameLength = length + static_cast<int>(ostr.charsWritten());
+	int frameLength = payloadLength + static_cast<int>(ostr.charsWritten());
 	int sent = _pStreamSocketImpl->sendBytes(frame.begin(), frameLength);
 	if (sent >= 0)
 	{
@@ -279,6 +292,28 @@ void WebSocketImpl::setMaxPayloadSize(int maxPayloadSize)
 }
 
 
+void WebSocketImpl::setPerMessageDeflate(PerMessageDeflate* pDeflate)
+{
+	_pDeflate.reset(pDeflate);
+}
+
+
+void WebSocketImpl::drainBuffer(Poco::Buffer<char>& buffer)
+{
+	int n = static_cast<int>(_buffer.size()) - _bufferOffset;
+	if (n > 0)
+	{
+		buffer.assign(_buffer.begin() + _bufferOffset, n);
+	}
+	else
+	{
+		buffer.resize(0);
+	}
+	_buffer.resize(0);
+	_bufferOffset = 0;
+}
+
+
 int WebSocketImpl::receivePayload(char *buffer, int payloadLength, char mask[MASK_LENGTH], bool useMask, int maskOffset)
 {
 	int received = receiveNBytes(reinterpret_cast<char*>(buffer), payloadLength);
@@ -305,6 +340,8 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 		if (payloadLength <= 0)
 		{
 			skipHeader(_receiveState.headerLength);
+			if (payloadLength == 0 && _receiveState.frameFlags != 0 && mustInflate())
+				return inflatePayload(reinterpret_cast<char*>(buffer), 0, length);
 			return payloadLength;
 		}
 		else if (payloadLength > length)
@@ -317,6 +354,9 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 		if (receivePayload(reinterpret_cast<char*>(buffer), payloadLength, _receiveState.mask, _receiveState.useMask, 0) != payloadLength)
 			throw WebSocketException("Incomplete frame received", WebSocket::WS_ERR_INCOMPLETE_FRAME);
 
+		if (mustInflate())
+			return inflatePayload(reinterpret_cast<char*>(buffer), payloadLength, length);
+
 		return payloadLength;
 	}
 	else
@@ -327,6 +367,8 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 			if (payloadLength <= 0)
 			{
 				skipHeader(_receiveState.headerLength);
+				if (payloadLength == 0 && _receiveState.frameFlags != 0 && mustInflate())
+					return inflatePayload(reinterpret_cast<char*>(buffer), 0, length);
 				return payloadLength;
 			}
 			else if (payloadLength > length)
@@ -351,6 +393,8 @@ int WebSocketImpl::receiveBytes(void* buffer, int length, int)
 			{
 				_receiveState.maskOffset = 0;
 				std::memcpy(buffer, _receiveState.payload.begin(), _receiveState.payloadLength);
+				if (mustInflate())
+					return inflatePayload(reinterpret_cast<char*>(buffer), _receiveState.payloadLength, length);
 				return _receiveState.payloadLength;
 			}
 			else
@@ -383,6 +427,8 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 		if (payloadLength <= 0)
 		{
 			skipHeader(_receiveState.headerLength);
+			if (payloadLength == 0 && _receiveState.frameFlags != 0 && mustInflate())
+				return inflatePayload(buffer, buffer.size(), 0);
 			return payloadLength;
 		}
 
@@ -394,6 +440,9 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 		if (receivePayload(buffer.begin() + oldSize, payloadLength, _receiveState.mask, _receiveState.useMask, 0) != payloadLength)
 			throw WebSocketException("Incomplete frame received", WebSocket::WS_ERR_INCOMPLETE_FRAME);
 
+		if (mustInflate())
+			return inflatePayload(buffer, oldSize, payloadLength);
+
 		return payloadLength;
 	}
 	else
@@ -404,6 +453,8 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 			if (payloadLength <= 0)
 			{
 				skipHeader(_receiveState.headerLength);
+				if (payloadLength == 0 && _receiveState.frameFlags != 0 && mustInflate())
+					return inflatePayload(buffer, buffer.size(), 0);
 				return payloadLength;
 			}
 
@@ -423,6 +474,8 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 				buffer.resize(oldSize + _receiveState.payloadLength);
 
 				std::memcpy(buffer.begin() + oldSize, _receiveState.payload.begin(), _receiveState.payloadLength);
+				if (mustInflate())
+					return inflatePayload(buffer, oldSize, _receiveState.payloadLength);
 				return _receiveState.payloadLength;
 			}
 			else
@@ -443,6 +496,53 @@ int WebSocketImpl::receiveBytes(Poco::Buffer<char>& buffer, int, const Poco::Tim
 }
 
 
+bool WebSocketImpl::mustInflate()
+{
+	if (!_pDeflate) return false;
+
+	int opcode = _receiveState.frameFlags & WebSocket::FRAME_OP_BITMASK;
+	bool compressed = (_receiveState.frameFlags & WebSocket::FRAME_FLAG_RSV1) != 0;
+	_receiveState.frameFlags &= ~WebSocket::FRAME_FLAG_RSV1;
+	if (opcode & 0x08)
+	{
+		// control frames can be interleaved with the
+		// frames of a fragmented message
+		if (compressed) throw WebSocketException("Compressed control frame received", WebSocket::WS_ERR_DECOMPRESSION_FAILED);
+		return false;
+	}
+	else if (opcode == WebSocket::FRAME_OP_CONT)
+	{
+		if (compressed) throw WebSocketException("Compressed continuation frame received", WebSocket::WS_ERR_DECOMPRESSION_FAILED);
+	}
+	else _inflating = compressed;
+
+	bool inflate = _inflating;
+	if (_receiveState.frameFlags & WebSocket::FRAME_FLAG_FIN) _inflating = false;
+	return inflate;
+}
+
+
+int WebSocketImpl::inflatePayload(char* buffer, int payloadLength, int length)
+{
+	bool final = (_receiveState.frameFlags & WebSocket::FRAME_FLAG_FIN) != 0;
+	_deflateBuffer.clear();
+	_pDeflate->decompress(buffer, payloadLength, final, _deflateBuffer, std::min(length, _maxPayloadSize));
+	std::memcpy(buffer, _deflateBuffer.data(), _deflateBuffer.size());
+	return static_cast<int>(_deflateBuffer.size());
+}
+
+
+int WebSocketImpl::inflatePayload(Poco::Buffer<char>& buffer, std::size_t offset, int payloadLength)
+{
+	bool final = (_receiveState.frameFlags & WebSocket::FRAME_FLAG_FIN) != 0;
+	_deflateBuffer.clear();
+	_pDeflate->decompress(buffer.begin() + offset, payloadLength, final, _deflateBuffer, _maxPayloadSize);
+	buffer.resize(offset + _deflateBuffer.size());
+	std::memcpy(buffer.begin() + offset, _deflateBuffer.data(), _deflateBuffer.size());
+	return static_cast<int>(_deflateBuffer.size());
+}
+
+
 int WebSocketImpl::receiveNBytes(void* buffer, int length)
 {
 	int received = receiveSomeBytes(reinterpret_cast<char*>(buffer), length);
@@ -485,7 +585,9 @@ int WebSocketImpl::peekSomeBytes(char* buffer, int length)
 	{
 		if (length < n) n = length;
 		std::memcpy(buffer, _buffer.begin() + _bufferOffset, n);
-		if (length > n)
+		// Only read more if the buffered data does not contain a complete
+		// header, as a blocking read would wait for the next frame.
+		if (length > n && n < headerLength(buffer, n))
 		{
 			int rc = _pStreamSocketImpl->receiveBytes(buffer + n, length - n);
 			if (rc > 0) 
@@ -512,6 +614,22 @@ int WebSocketImpl::peekSomeBytes(char* buffer, int length)
 }
 
 
+int WebSocketImpl::headerLength(const char* header, int length)
+{
+	if (length < 2) return MAX_HEADER_LENGTH;
+
+	Poco::UInt8 lengthByte = static_cast<Poco::UInt8>(header[1]);
+	int n = 2;
+	if ((lengthByte & 0x7f) == 127)
+		n += 8;
+	else if ((lengthByte & 0x7f) == 126)
+		n += 2;
+	if (lengthByte & FRAME_FLAG_MASK)
+		n += MASK_LENGTH;
+	return n;
+}
+
+
 SocketImpl* WebSocketImpl::acceptConnection(SocketAddress& clientAddr)
 {
 	throw Poco::InvalidAccessException("Cannot acceptConnection() on a WebSocketImpl");
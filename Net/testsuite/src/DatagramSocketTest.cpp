@@ -25,6 +25,7 @@
 using Poco::Net::Socket;
 using Poco::Net::DatagramSocket;
 using Poco::Net::SocketAddress;
+using Poco::Net::SocketBufVec;
 using Poco::Net::IPAddress;
 #ifdef POCO_NET_HAS_INTERFACE
 	using Poco::Net::NetworkInterface;
@@ -158,6 +159,68 @@ void DatagramSocketTest::testSendToReceiveFrom()
 }
 
 
+void DatagramSocketTest::testSendReceiveBatch()
+{
+	DatagramSocket rs(SocketAddress("127.0.0.1", 0), false);
+	DatagramSocket ss(SocketAddress("127.0.0.1", 0), false);
+	const SocketAddress target("127.0.0.1", rs.address().port());
+
+	std::vector<std::string> messages = { "one", "two", "three", "four", "five" };
+	SocketBufVec sendBufs;
+	for (auto& m: messages) sendBufs.push_back(Socket::makeBuffer(m.data(), m.size()));
+	std::vector<SocketAddress> addresses(messages.size(), target);
+	int n = ss.sendBatch(sendBufs, addresses);
+	assertTrue (n == 5);
+
+	std::vector<std::string> received;
+	std::vector<SocketAddress> senders;
+	std::vector<int> lengths;
+	char data[8][64];
+	SocketBufVec recvBufs;
+	for (auto& d: data) recvBufs.push_back(Socket::makeBuffer(d, sizeof(d)));
+	rs.setReceiveTimeout(Timespan(5, 0));
+	while (received.size() < messages.size())
+	{
+		n = rs.receiveBatch(recvBufs, senders, lengths);
+		assertTrue (n > 0);
+		assertTrue (senders.size() == n);
+		assertTrue (lengths.size() == n);
+		for (int i = 0; i < n; ++i)
+		{
+			assertTrue (senders[i] == ss.address());
+			received.emplace_back(data[i], lengths[i]);
+		}
+	}
+	assertTrue (received == messages);
+
+	ss.connect(target);
+	n = ss.sendBatch(SocketBufVec(sendBufs.begin(), sendBufs.begin() + 2), std::vector<SocketAddress>());
+	assertTrue (n == 2);
+	received.clear();
+	while (received.size() < 2)
+	{
+		n = rs.receiveBatch(recvBufs, senders, lengths);
+		assertTrue (n > 0);
+		for (int i = 0; i < n; ++i) received.emplace_back(data[i], lengths[i]);
+	}
+	assertTrue (received[0] == "one");
+	assertTrue (received[1] == "two");
+
+	rs.setBlocking(false);
+	assertTrue (rs.receiveBatch(recvBufs, senders, lengths) == -1);
+	assertTrue (senders.empty());
+
+	try
+	{
+		ss.sendBatch(sendBufs, std::vector<SocketAddress>(2, target));
+		fail("mismatched number of addresses - must throw");
+	}
+	catch (InvalidArgumentException&)
+	{
+	}
+}
+
+
 void DatagramSocketTest::testUnbound()
 {
 	UDPEchoServer echoServer;
@@ -859,6 +922,7 @@ CppUnit::Test* DatagramSocketTest::suite()
 	CppUnit_addTest(pSuite, DatagramSocketTest, testEchoBuffer);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReceiveFromAvailable);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testSendToReceiveFrom);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSendReceiveBatch);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testUnbound);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReuseAddressPortWildcard);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testReuseAddressPortSpecific);
@@ -30,6 +30,7 @@ public:
 	void testEchoBuffer();
 	void testReceiveFromAvailable();
 	void testSendToReceiveFrom();
+	void testSendReceiveBatch();
 	void testUnbound();
 	void testReuseAddressPortWildcard();
 	void testReuseAddressPortSpecific();
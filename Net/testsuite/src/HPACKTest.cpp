@@ -0,0 +1,382 @@
+//
+// HPACKTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HPACKTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/HexBinaryDecoder.h"
+#include <sstream>
+
+
+using Poco::Net::HPACKTable;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HTTP2Frame;
+using Poco::Net::HTTP2Exception;
+
+
+namespace
+{
+	std::string fromHex(const std::string& hex)
+	{
+		std::string digits;
+		for (char c: hex)
+		{
+			if (c != ' ') digits += c;
+		}
+		std::istringstream istr(digits);
+		Poco::HexBinaryDecoder decoder(istr);
+		std::string result;
+		char c;
+		while (decoder.get(c)) result += c;
+		return result;
+	}
+
+	HPACKTable::HeaderList decode(HPACKDecoder& decoder, const std::string& hex)
+	{
+		std::string block = fromHex(hex);
+		HPACKTable::HeaderList headers;
+		decoder.decode(block.data(), block.size(), headers);
+		return headers;
+	}
+}
+
+
+HPACKTest::HPACKTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HPACKTest::~HPACKTest()
+{
+}
+
+
+void HPACKTest::testInteger()
+{
+	// RFC 7541, Appendix C.1
+	std::string out;
+	HPACKEncoder::encodeInteger(out, 0, 5, 10);
+	assertTrue (out == fromHex("0a"));
+
+	out.clear();
+	HPACKEncoder::encodeInteger(out, 0, 5, 1337);
+	assertTrue (out == fromHex("1f9a0a"));
+
+	out.clear();
+	HPACKEncoder::encodeInteger(out, 0, 8, 42);
+	assertTrue (out == fromHex("2a"));
+
+	out.clear();
+	HPACKEncoder::encodeInteger(out, 0x80, 7, 2);
+	assertTrue (out == fromHex("82"));
+}
+
+
+void HPACKTest::testHuffman()
+{
+	std::string out;
+	HPACKEncoder::encodeHuffman(out, "www.example.com");
+	assertTrue (out == fromHex("f1e3 c2e5 f23a 6ba0 ab90 f4ff"));
+	assertEqual (12, HPACKEncoder::huffmanLength("www.example.com"));
+
+	out.clear();
+	HPACKEncoder::encodeHuffman(out, "no-cache");
+	assertTrue (out == fromHex("a8eb 1064 9cbf"));
+
+	out.clear();
+	HPACKEncoder::encodeHuffman(out, "custom-value");
+	assertTrue (out == fromHex("25a8 49e9 5bb8 e8b4 bf"));
+}
+
+
+void HPACKTest::testDecodeRequests()
+{
+	// RFC 7541, Appendix C.3
+	HPACKDecoder decoder;
+
+	HPACKTable::HeaderList headers = decode(decoder, "8286 8441 0f77 7777 2e65 7861 6d70 6c65 2e63 6f6d");
+	assertEqual (4, headers.size());
+	assertTrue (headers[0] == HPACKTable::Header(":method", "GET"));
+	assertTrue (headers[1] == HPACKTable::Header(":scheme", "http"));
+	assertTrue (headers[2] == HPACKTable::Header(":path", "/"));
+	assertTrue (headers[3] == HPACKTable::Header(":authority", "www.example.com"));
+	assertEqual (57, decoder.table().size());
+
+	headers = decode(decoder, "8286 84be 5808 6e6f 2d63 6163 6865");
+	assertEqual (5, headers.size());
+	assertTrue (headers[3] == HPACKTable::Header(":authority", "www.example.com"));
+	assertTrue (headers[4] == HPACKTable::Header("cache-control", "no-cache"));
+	assertEqual (110, decoder.table().size());
+
+	headers = decode(decoder, "8287 85bf 400a 6375 7374 6f6d 2d6b 6579 0c63 7573 746f 6d2d 7661 6c75 65");
+	assertEqual (5, headers.size());
+	assertTrue (headers[1] == HPACKTable::Header(":scheme", "https"));
+	assertTrue (headers[2] == HPACKTable::Header(":path", "/index.html"));
+	assertTrue (headers[3] == HPACKTable::Header(":authority", "www.example.com"));
+	assertTrue (headers[4] == HPACKTable::Header("custom-key", "custom-value"));
+	assertEqual (3, decoder.table().entries());
+	assertEqual (164, decoder.table().size());
+}
+
+
+void HPACKTest::testDecodeHuffmanRequests()
+{
+	// RFC 7541, Appendix C.4
+	HPACKDecoder decoder;
+
+	HPACKTable::HeaderList headers = decode(decoder, "8286 8441 8cf1 e3c2 e5f2 3a6b a0ab 90f4 ff");
+	assertEqual (4, headers.size());
+	assertTrue (headers[3] == HPACKTable::Header(":authority", "www.example.com"));
+
+	headers = decode(decoder, "8286 84be 5886 a8eb 1064 9cbf");
+	assertEqual (5, headers.size());
+	assertTrue (headers[4] == HPACKTable::Header("cache-control", "no-cache"));
+
+	headers = decode(decoder, "8287 85bf 4088 25a8 49e9 5ba9 7d7f 8925 a849 e95b b8e8 b4bf");
+	assertEqual (5, headers.size());
+	assertTrue (headers[4] == HPACKTable::Header("custom-key", "custom-value"));
+	assertEqual (164, decoder.table().size());
+}
+
+
+void HPACKTest::testDecodeResponses()
+{
+	// RFC 7541, Appendix C.5, with eviction from a 256 byte table
+	HPACKDecoder decoder(256);
+
+	HPACKTable::HeaderList headers = decode(decoder,
+		"4803 3330 3258 0770 7269 7661 7465 611d"
+		"4d6f 6e2c 2032 3120 4f63 7420 3230 3133"
+		"2032 303a 3133 3a32 3120 474d 546e 1768"
+		"7474 7073 3a2f 2f77 7777 2e65 7861 6d70"
+		"6c65 2e63 6f6d");
+	assertEqual (4, headers.size());
+	assertTrue (headers[0] == HPACKTable::Header(":status", "302"));
+	assertTrue (headers[1] == HPACKTable::Header("cache-control", "private"));
+	assertTrue (headers[2] == HPACKTable::Header("date", "Mon, 21 Oct 2013 20:13:21 GMT"));
+	assertTrue (headers[3] == HPACKTable::Header("location", "https://www.example.com"));
+	assertEqual (222, decoder.table().size());
+
+	headers = decode(decoder, "4803 3330 37c1 c0bf");
+	assertEqual (4, headers.size());
+	assertTrue (headers[0] == HPACKTable::Header(":status", "307"));
+	assertTrue (headers[3] == HPACKTable::Header("location", "https://www.example.com"));
+	assertEqual (222, decoder.table().size());
+
+	headers = decode(decoder,
+		"88c1 611d 4d6f 6e2c 2032 3120 4f63 7420"
+		"3230 3133 2032 303a 3133 3a32 3220 474d"
+		"54c0 5a04 677a 6970 7738 666f 6f3d 4153"
+		"444a 4b48 514b 425a 584f 5157 454f 5049"
+		"5541 5851 5745 4f49 553b 206d 6178 2d61"
+		"6765 3d33 3630 303b 2076 6572 7369 6f6e"
+		"3d31");
+	assertEqual (6, headers.size());
+	assertTrue (headers[0] == HPACKTable::Header(":status", "200"));
+	assertTrue (headers[2] == HPACKTable::Header("date", "Mon, 21 Oct 2013 20:13:22 GMT"));
+	assertTrue (headers[4] == HPACKTable::Header("content-encoding", "gzip"));
+	assertTrue (headers[5] == HPACKTable::Header("set-cookie", "foo=ASDJKHQKBZXOQWEOPIUAXQWEOIU; max-age=3600; version=1"));
+	assertEqual (3, decoder.table().entries());
+	assertEqual (215, decoder.table().size());
+}
+
+
+void HPACKTest::testEncoder()
+{
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	HPACKTable::HeaderList request;
+	request.emplace_back(":method", "GET");
+	request.emplace_back(":scheme", "https");
+	request.emplace_back(":path", "/index.html");
+	request.emplace_back(":authority", "www.example.com");
+	request.emplace_back("custom-key", "custom-value");
+	request.emplace_back("user-agent", std::string(300, 'a'));
+
+	std::string first;
+	encoder.encode(request, first);
+	HPACKTable::HeaderList headers;
+	decoder.decode(first.data(), first.size(), headers);
+	assertTrue (headers == request);
+
+	// The second time, all fields that fit into the
+	// dynamic table are sent as indexed fields.
+	std::string second;
+	encoder.encode(request, second);
+	assertTrue (second.size() < first.size());
+	headers.clear();
+	decoder.decode(second.data(), second.size(), headers);
+	assertTrue (headers == request);
+	assertEqual (encoder.table().size(), decoder.table().size());
+
+	std::string sensitive;
+	encoder.beginBlock(sensitive);
+	encoder.encode("authorization", "secret", sensitive, true);
+	headers.clear();
+	decoder.decode(sensitive.data(), sensitive.size(), headers);
+	assertEqual (1, headers.size());
+	assertTrue (headers[0] == HPACKTable::Header("authorization", "secret"));
+	assertTrue ((static_cast<unsigned char>(sensitive[0]) & 0xF0) == 0x10);
+
+	encoder.setHuffmanEncoding(false);
+	std::string plain;
+	encoder.beginBlock(plain);
+	encoder.encode("x-plain", "value", plain);
+	assertTrue (plain.find("x-plain") != std::string::npos);
+	headers.clear();
+	decoder.decode(plain.data(), plain.size(), headers);
+	assertTrue (headers[0] == HPACKTable::Header("x-plain", "value"));
+}
+
+
+void HPACKTest::testTableSizeUpdate()
+{
+	HPACKEncoder encoder;
+	HPACKDecoder decoder;
+
+	HPACKTable::HeaderList request;
+	request.emplace_back("custom-key", "custom-value");
+	std::string block;
+	encoder.encode(request, block);
+	HPACKTable::HeaderList headers;
+	decoder.decode(block.data(), block.size(), headers);
+	assertEqual (1, decoder.table().entries());
+
+	encoder.setMaxTableSize(0);
+	encoder.setMaxTableSize(100);
+	block.clear();
+	encoder.encode(request, block);
+	headers.clear();
+	decoder.decode(block.data(), block.size(), headers);
+	assertTrue (headers == request);
+	assertEqual (100, decoder.table().getMaxSize());
+	// The update to size 0 has emptied the table, and the
+	// field is now too large to be worth indexing.
+	assertEqual (0, decoder.table().entries());
+	assertEqual (encoder.table().size(), decoder.table().size());
+
+	// A size update above the decoder's limit is an error.
+	std::string update;
+	HPACKEncoder::encodeInteger(update, 0x20, 5, 8192);
+	try
+	{
+		decoder.decode(update.data(), update.size(), headers);
+		fail("table size update above limit - must throw");
+	}
+	catch (HTTP2Exception& exc)
+	{
+		assertTrue (exc.code() == HTTP2Frame::H2_ERR_COMPRESSION);
+	}
+}
+
+
+void HPACKTest::testDecodeErrors()
+{
+	HPACKTable::HeaderList headers;
+
+	// index 0
+	HPACKDecoder decoder;
+	std::string block = fromHex("80");
+	try
+	{
+		decoder.decode(block.data(), block.size(), headers);
+		fail("invalid index - must throw");
+	}
+	catch (HTTP2Exception& exc)
+	{
+		assertTrue (exc.code() == HTTP2Frame::H2_ERR_COMPRESSION);
+	}
+
+	// index beyond the dynamic table
+	block = fromHex("be");
+	try
+	{
+		decoder.decode(block.data(), block.size(), headers);
+		fail("invalid index - must throw");
+	}
+	catch (HTTP2Exception&)
+	{
+	}
+
+	// truncated string literal
+	block = fromHex("400a 6375 7374");
+	try
+	{
+		decoder.decode(block.data(), block.size(), headers);
+		fail("truncated literal - must throw");
+	}
+	catch (HTTP2Exception&)
+	{
+	}
+
+	// header list too large
+	HPACKDecoder limitedDecoder;
+	limitedDecoder.setMaxHeaderListSize(64);
+	block = fromHex("8286 8441 0f77 7777 2e65 7861 6d70 6c65 2e63 6f6d");
+	try
+	{
+		limitedDecoder.decode(block.data(), block.size(), headers);
+		fail("header list too large - must throw");
+	}
+	catch (HTTP2Exception& exc)
+	{
+		assertTrue (exc.code() == HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM);
+	}
+	assertEqual (57, limitedDecoder.table().size());
+
+	// repeated references to a dynamic table entry stop
+	// being collected once the limit has been exceeded
+	headers.clear();
+	block = fromHex("400a 6375 7374 6f6d 2d6b 6579 0c63 7573 746f 6d2d 7661 6c75 65");
+	block.append(1000, '\xbe');
+	try
+	{
+		limitedDecoder.decode(block.data(), block.size(), headers);
+		fail("header list too large - must throw");
+	}
+	catch (HTTP2Exception& exc)
+	{
+		assertTrue (exc.code() == HTTP2Frame::H2_ERR_ENHANCE_YOUR_CALM);
+	}
+	assertTrue (headers.size() <= 1);
+	assertEqual (111, limitedDecoder.table().size());
+}
+
+
+void HPACKTest::setUp()
+{
+}
+
+
+void HPACKTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HPACKTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HPACKTest");
+
+	CppUnit_addTest(pSuite, HPACKTest, testInteger);
+	CppUnit_addTest(pSuite, HPACKTest, testHuffman);
+	CppUnit_addTest(pSuite, HPACKTest, testDecodeRequests);
+	CppUnit_addTest(pSuite, HPACKTest, testDecodeHuffmanRequests);
+	CppUnit_addTest(pSuite, HPACKTest, testDecodeResponses);
+	CppUnit_addTest(pSuite, HPACKTest, testEncoder);
+	CppUnit_addTest(pSuite, HPACKTest, testTableSizeUpdate);
+	CppUnit_addTest(pSuite, HPACKTest, testDecodeErrors);
+
+	return pSuite;
+}
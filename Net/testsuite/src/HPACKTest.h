@@ -0,0 +1,45 @@
+//
+// HPACKTest.h
+//
+// Definition of the HPACKTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HPACKTest_INCLUDED
+#define HPACKTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HPACKTest: public CppUnit::TestCase
+{
+public:
+	HPACKTest(const std::string& name);
+	~HPACKTest();
+
+	void testInteger();
+	void testHuffman();
+	void testDecodeRequests();
+	void testDecodeHuffmanRequests();
+	void testDecodeResponses();
+	void testEncoder();
+	void testTableSizeUpdate();
+	void testDecodeErrors();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HPACKTest_INCLUDED
@@ -0,0 +1,558 @@
+//
+// HTTP2ServerTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTP2ServerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPFileCache.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/NumberParser.h"
+#include "Poco/TemporaryFile.h"
+#include "Poco/FileStream.h"
+#include <map>
+#include <sstream>
+
+
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::HTTP2Frame;
+using Poco::Net::HPACKTable;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::StreamCopier;
+using Poco::UInt8;
+using Poco::UInt32;
+
+
+namespace
+{
+	const std::size_t largeResponseSize = 200000;
+	std::string filePath;
+
+	class HTTP2RequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			if (request.getURI() == "/echo")
+			{
+				std::string body;
+				StreamCopier::copyToString(request.stream(), body);
+				response.setContentType(request.getContentType());
+				response.sendBuffer(body.data(), body.size());
+			}
+			else if (request.getURI() == "/file")
+			{
+				response.sendFile(filePath, "text/plain");
+			}
+			else if (request.getURI() == "/large")
+			{
+				response.setContentLength64(largeResponseSize);
+				std::ostream& ostr = response.send();
+				for (std::size_t i = 0; i < largeResponseSize; ++i)
+				{
+					ostr.put(static_cast<char>('a' + i % 26));
+				}
+			}
+			else
+			{
+				std::string body = request.getMethod() + " " + request.getURI() + " " + request.getVersion() + " " + request.getHost();
+				response.setContentType("text/plain");
+				response.setContentLength(static_cast<int>(body.size()));
+				response.send() << body;
+			}
+		}
+	};
+
+	class HTTP2RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new HTTP2RequestHandler;
+		}
+	};
+
+	class HTTP2TestClient
+		/// A minimal HTTP/2 client working at the frame level.
+	{
+	public:
+		struct Response
+		{
+			std::string status;
+			HPACKTable::HeaderList headers;
+			std::string body;
+			bool complete = false;
+		};
+
+		explicit HTTP2TestClient(const SocketAddress& address):
+			_socket(address)
+		{
+			_socket.setReceiveTimeout(Poco::Timespan(10, 0));
+			_socket.sendBytes(HTTP2Frame::CONNECTION_PREFACE.data(), static_cast<int>(HTTP2Frame::CONNECTION_PREFACE.size()));
+			sendFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, 0, 0, std::string());
+		}
+
+		void sendFrame(HTTP2Frame::FrameType type, UInt8 flags, UInt32 streamId, const std::string& payload)
+		{
+			HTTP2Frame frame(type, flags, streamId, static_cast<UInt32>(payload.size()));
+			char header[HTTP2Frame::HEADER_SIZE];
+			frame.write(header);
+			std::string data(header, HTTP2Frame::HEADER_SIZE);
+			data += payload;
+			_socket.sendBytes(data.data(), static_cast<int>(data.size()));
+		}
+
+		bool readFrame(HTTP2Frame& frame, std::string& payload)
+		{
+			char header[HTTP2Frame::HEADER_SIZE];
+			if (!receive(header, HTTP2Frame::HEADER_SIZE)) return false;
+			frame.read(header);
+			payload.resize(frame.length());
+			return frame.length() == 0 || receive(&payload[0], frame.length());
+		}
+
+		void sendRequest(UInt32 streamId, const std::string& method, const std::string& path, const std::string& body = std::string(), const HPACKTable::HeaderList& extraHeaders = HPACKTable::HeaderList())
+		{
+			HPACKTable::HeaderList headers;
+			headers.emplace_back(":method", method);
+			headers.emplace_back(":scheme", "http");
+			headers.emplace_back(":path", path);
+			headers.emplace_back(":authority", "localhost");
+			headers.insert(headers.end(), extraHeaders.begin(), extraHeaders.end());
+			if (!body.empty())
+			{
+				headers.emplace_back("content-type", "application/octet-stream");
+				headers.emplace_back("content-length", std::to_string(body.size()));
+			}
+			std::string block;
+			_encoder.encode(headers, block);
+			UInt8 flags = HTTP2Frame::FRAME_FLAG_END_HEADERS;
+			if (body.empty()) flags |= HTTP2Frame::FRAME_FLAG_END_STREAM;
+			sendFrame(HTTP2Frame::FRAME_TYPE_HEADERS, flags, streamId, block);
+
+			std::size_t pos = 0;
+			while (pos < body.size())
+			{
+				std::size_t n = std::min<std::size_t>(body.size() - pos, HTTP2Frame::DEFAULT_MAX_FRAME_SIZE);
+				UInt8 dataFlags = (pos + n == body.size()) ? HTTP2Frame::FRAME_FLAG_END_STREAM : 0;
+				sendFrame(HTTP2Frame::FRAME_TYPE_DATA, dataFlags, streamId, body.substr(pos, n));
+				pos += n;
+			}
+		}
+
+		void readResponses(std::map<UInt32, Response>& responses, int count)
+			/// Reads frames until count responses are complete,
+			/// granting flow-control credit for all received data.
+		{
+			HTTP2Frame frame;
+			std::string payload;
+			while (count > 0 && readFrame(frame, payload))
+			{
+				switch (frame.type())
+				{
+				case HTTP2Frame::FRAME_TYPE_SETTINGS:
+					if (!frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK))
+						sendFrame(HTTP2Frame::FRAME_TYPE_SETTINGS, HTTP2Frame::FRAME_FLAG_ACK, 0, std::string());
+					break;
+				case HTTP2Frame::FRAME_TYPE_HEADERS:
+					{
+						Response& response = responses[frame.streamId()];
+						_decoder.decode(payload.data(), payload.size(), response.headers);
+						for (const auto& h: response.headers)
+						{
+							if (h.first == ":status") response.status = h.second;
+						}
+					}
+					break;
+				case HTTP2Frame::FRAME_TYPE_DATA:
+					responses[frame.streamId()].body += payload;
+					if (!payload.empty())
+					{
+						sendWindowUpdate(0, static_cast<UInt32>(payload.size()));
+						sendWindowUpdate(frame.streamId(), static_cast<UInt32>(payload.size()));
+					}
+					break;
+				case HTTP2Frame::FRAME_TYPE_GOAWAY:
+				case HTTP2Frame::FRAME_TYPE_RST_STREAM:
+					return;
+				default:
+					break;
+				}
+				if ((frame.type() == HTTP2Frame::FRAME_TYPE_HEADERS || frame.type() == HTTP2Frame::FRAME_TYPE_DATA) &&
+					frame.hasFlag(HTTP2Frame::FRAME_FLAG_END_STREAM))
+				{
+					responses[frame.streamId()].complete = true;
+					--count;
+				}
+			}
+		}
+
+		bool waitFor(HTTP2Frame::FrameType type, HTTP2Frame& frame, std::string& payload)
+			/// Reads frames until a frame of the given type is received.
+		{
+			while (readFrame(frame, payload))
+			{
+				if (frame.type() == type) return true;
+			}
+			return false;
+		}
+
+		void sendWindowUpdate(UInt32 streamId, UInt32 increment)
+		{
+			char buffer[4];
+			HTTP2Frame::writeUInt32(buffer, increment);
+			sendFrame(HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE, 0, streamId, std::string(buffer, 4));
+		}
+
+		static std::string header(const Response& response, const std::string& name)
+		{
+			for (const auto& h: response.headers)
+			{
+				if (h.first == name) return h.second;
+			}
+			return std::string();
+		}
+
+	private:
+		bool receive(char* buffer, std::size_t length)
+		{
+			std::size_t received = 0;
+			while (received < length)
+			{
+				int n = _socket.receiveBytes(buffer + received, static_cast<int>(length - received));
+				if (n <= 0) return false;
+				received += n;
+			}
+			return true;
+		}
+
+		StreamSocket _socket;
+		HPACKEncoder _encoder;
+		HPACKDecoder _decoder;
+	};
+
+	HTTPServerParams::Ptr http2Params()
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setHTTP2Enabled(true);
+		return pParams;
+	}
+}
+
+
+HTTP2ServerTest::HTTP2ServerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTP2ServerTest::~HTTP2ServerTest()
+{
+}
+
+
+void HTTP2ServerTest::testSimpleRequest()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/hello");
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	client.readResponses(responses, 1);
+
+	const HTTP2TestClient::Response& response = responses[1];
+	assertTrue (response.complete);
+	assertTrue (response.status == "200");
+	assertTrue (response.body == "GET /hello HTTP/2.0 localhost");
+	assertTrue (HTTP2TestClient::header(response, "content-type") == "text/plain");
+	assertTrue (HTTP2TestClient::header(response, "content-length") == "29");
+	assertTrue (!HTTP2TestClient::header(response, "date").empty());
+	assertTrue (HTTP2TestClient::header(response, "connection").empty());
+}
+
+
+void HTTP2ServerTest::testMultiplexing()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/first");
+	client.sendRequest(3, "GET", "/large");
+	client.sendRequest(5, "GET", "/third");
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	client.readResponses(responses, 3);
+
+	assertTrue (responses[1].complete);
+	assertTrue (responses[1].body == "GET /first HTTP/2.0 localhost");
+	assertTrue (responses[3].complete);
+	assertEqual (largeResponseSize, responses[3].body.size());
+	assertTrue (responses[5].complete);
+	assertTrue (responses[5].body == "GET /third HTTP/2.0 localhost");
+
+	// The connection remains usable after the requests.
+	client.sendRequest(7, "GET", "/fourth");
+	client.readResponses(responses, 1);
+	assertTrue (responses[7].complete);
+	assertTrue (responses[7].body == "GET /fourth HTTP/2.0 localhost");
+}
+
+
+void HTTP2ServerTest::testPost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+
+	// Wait for the server's SETTINGS, which grant a larger window.
+	HTTP2Frame frame;
+	std::string payload;
+	assertTrue (client.waitFor(HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE, frame, payload));
+
+	std::string body;
+	for (int i = 0; i < 100000; ++i) body += static_cast<char>('0' + i % 10);
+	client.sendRequest(1, "POST", "/echo", body);
+	client.readResponses(responses, 1);
+
+	const HTTP2TestClient::Response& response = responses[1];
+	assertTrue (response.complete);
+	assertTrue (response.status == "200");
+	assertTrue (HTTP2TestClient::header(response, "content-type") == "application/octet-stream");
+	assertTrue (response.body == body);
+}
+
+
+void HTTP2ServerTest::testPostTooLarge()
+{
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setMaxRequestBodySize(50000);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	HTTP2Frame frame;
+	std::string payload;
+	assertTrue (client.waitFor(HTTP2Frame::FRAME_TYPE_WINDOW_UPDATE, frame, payload));
+
+	std::string body(100000, 'x');
+	client.sendRequest(1, "POST", "/echo", body);
+	assertTrue (client.waitFor(HTTP2Frame::FRAME_TYPE_RST_STREAM, frame, payload));
+	assertEqual (1, frame.streamId());
+	assertTrue (HTTP2Frame::readUInt32(payload.data()) == HTTP2Frame::H2_ERR_CANCEL);
+
+	// The connection remains usable. DATA frames already in flight
+	// for stream 1 may still be answered with RST_STREAM.
+	client.sendRequest(3, "GET", "/hello");
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	for (int i = 0; i < 10 && !responses[3].complete; ++i)
+	{
+		client.readResponses(responses, 1);
+	}
+	assertTrue (responses[3].complete);
+	assertTrue (responses[3].body == "GET /hello HTTP/2.0 localhost");
+}
+
+
+void HTTP2ServerTest::testLargeResponse()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	// The response is larger than the client's initial window,
+	// so the server must wait for WINDOW_UPDATE frames.
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/large");
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	client.readResponses(responses, 1);
+
+	const HTTP2TestClient::Response& response = responses[1];
+	assertTrue (response.complete);
+	assertEqual (largeResponseSize, response.body.size());
+	for (std::size_t i = 0; i < largeResponseSize; ++i)
+	{
+		if (response.body[i] != static_cast<char>('a' + i % 26))
+			fail("response body corrupted");
+	}
+}
+
+
+void HTTP2ServerTest::testSendFileNotModified()
+{
+	Poco::TemporaryFile file;
+	Poco::FileOutputStream ostr(file.path());
+	ostr << "file contents";
+	ostr.close();
+	filePath = file.path();
+
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setFileCache(new Poco::Net::HTTPFileCache);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	client.sendRequest(1, "GET", "/file");
+	client.readResponses(responses, 1);
+	assertTrue (responses[1].status == "200");
+	assertTrue (responses[1].body == "file contents");
+	const std::string etag = HTTP2TestClient::header(responses[1], "etag");
+	assertTrue (!etag.empty());
+
+	// lists, weak validators and "*" use the weak comparison
+	UInt32 streamId = 3;
+	for (const std::string& ifNoneMatch: {etag, "\"x,y\", W/" + etag, std::string("*")})
+	{
+		client.sendRequest(streamId, "GET", "/file", std::string(), {{"if-none-match", ifNoneMatch}});
+		client.readResponses(responses, 1);
+		assertTrue (responses[streamId].status == "304");
+		assertTrue (responses[streamId].body.empty());
+		streamId += 2;
+	}
+
+	client.sendRequest(streamId, "GET", "/file", std::string(), {{"if-none-match", "\"x\", W/\"y," + etag.substr(1)}});
+	client.readResponses(responses, 1);
+	assertTrue (responses[streamId].status == "200");
+	assertTrue (responses[streamId].body == "file contents");
+}
+
+
+void HTTP2ServerTest::testHead()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "HEAD", "/large");
+	std::map<UInt32, HTTP2TestClient::Response> responses;
+	client.readResponses(responses, 1);
+
+	const HTTP2TestClient::Response& response = responses[1];
+	assertTrue (response.complete);
+	assertTrue (response.status == "200");
+	assertTrue (HTTP2TestClient::header(response, "content-length") == "200000");
+	assertTrue (response.body.empty());
+}
+
+
+void HTTP2ServerTest::testHTTP1()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::istream& rs = cs.receiveResponse(response);
+	std::string body;
+	StreamCopier::copyToString(rs, body);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (body == "GET /hello HTTP/1.1 127.0.0.1:" + std::to_string(svs.address().port()));
+}
+
+
+void HTTP2ServerTest::testPing()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendFrame(HTTP2Frame::FRAME_TYPE_PING, 0, 0, "12345678");
+	HTTP2Frame frame;
+	std::string payload;
+	assertTrue (client.waitFor(HTTP2Frame::FRAME_TYPE_PING, frame, payload));
+	assertTrue (frame.hasFlag(HTTP2Frame::FRAME_FLAG_ACK));
+	assertTrue (payload == "12345678");
+}
+
+
+void HTTP2ServerTest::testProtocolError()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HTTP2RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/hello");
+	client.sendFrame(HTTP2Frame::FRAME_TYPE_DATA, 0, 0, "data");
+	HTTP2Frame frame;
+	std::string payload;
+	assertTrue (client.waitFor(HTTP2Frame::FRAME_TYPE_GOAWAY, frame, payload));
+	assertEqual (8, payload.size());
+	assertEqual (1, HTTP2Frame::readUInt32(payload.data()));
+	assertTrue (HTTP2Frame::readUInt32(payload.data() + 4) == HTTP2Frame::H2_ERR_PROTOCOL);
+	assertTrue (!client.readFrame(frame, payload));
+}
+
+
+void HTTP2ServerTest::setUp()
+{
+}
+
+
+void HTTP2ServerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTP2ServerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTP2ServerTest");
+
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testSimpleRequest);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testMultiplexing);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPost);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPostTooLarge);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testLargeResponse);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHead);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testSendFileNotModified);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHTTP1);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPing);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testProtocolError);
+
+	return pSuite;
+}
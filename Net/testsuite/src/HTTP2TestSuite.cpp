@@ -0,0 +1,24 @@
+//
+// HTTP2TestSuite.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTP2TestSuite.h"
+#include "HPACKTest.h"
+#include "HTTP2ServerTest.h"
+
+
+CppUnit::Test* HTTP2TestSuite::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTP2TestSuite");
+
+	pSuite->addTest(HPACKTest::suite());
+	pSuite->addTest(HTTP2ServerTest::suite());
+
+	return pSuite;
+}
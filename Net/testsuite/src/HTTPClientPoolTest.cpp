@@ -0,0 +1,399 @@
+//
+// HTTPClientPoolTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPClientPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPClientPool.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Thread.h"
+#include "Poco/URI.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+
+using Poco::Net::HTTPClientPool;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::ServerSocket;
+using Poco::StreamCopier;
+using Poco::Thread;
+using Poco::URI;
+
+
+namespace
+{
+	class PoolRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			if (request.getURI() == "/echo")
+			{
+				std::string body;
+				StreamCopier::copyToString(request.stream(), body);
+				response.setContentType(request.getContentType());
+				response.sendBuffer(body.data(), body.size());
+				return;
+			}
+			if (request.getURI() == "/slow")
+			{
+				Thread::sleep(100);
+			}
+			std::string body = request.getMethod() + " " + request.getURI() + " " + request.getVersion();
+			response.setContentType("text/plain");
+			response.setContentLength(static_cast<int>(body.size()));
+			response.send() << body;
+		}
+	};
+
+	class PoolRequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new PoolRequestHandler;
+		}
+	};
+
+	HTTPServerParams::Ptr http2Params()
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setHTTP2Enabled(true);
+		return pParams;
+	}
+
+	URI serverURI(const ServerSocket& svs)
+	{
+		return URI("http://127.0.0.1:" + std::to_string(svs.address().port()));
+	}
+
+	int runConcurrently(HTTPClientPool& pool, const URI& uri, const std::string& path, int threads, int requests, const std::string& expectedVersion)
+		/// Sends the given number of requests from each of the
+		/// given number of threads, and returns the number of
+		/// successful requests.
+	{
+		std::atomic<int> succeeded(0);
+		std::vector<std::unique_ptr<Thread>> workers;
+		for (int i = 0; i < threads; ++i)
+		{
+			workers.push_back(std::make_unique<Thread>());
+			workers.back()->startFunc([&]()
+			{
+				for (int k = 0; k < requests; ++k)
+				{
+					try
+					{
+						HTTPRequest request(HTTPRequest::HTTP_GET, path, HTTPMessage::HTTP_1_1);
+						HTTPResponse response;
+						std::string body;
+						pool.sendRequest(uri, request, std::string(), response, body);
+						if (response.getStatus() == HTTPResponse::HTTP_OK && body == "GET " + path + " " + expectedVersion)
+							++succeeded;
+					}
+					catch (Poco::Exception&)
+					{
+					}
+				}
+			});
+		}
+		for (auto& pWorker: workers)
+		{
+			pWorker->join();
+		}
+		return succeeded;
+	}
+}
+
+
+HTTPClientPoolTest::HTTPClientPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPClientPoolTest::~HTTPClientPoolTest()
+{
+}
+
+
+void HTTPClientPoolTest::testKeepAlive()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	for (int i = 0; i < 5; ++i)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+		HTTPResponse response;
+		std::string body;
+		pool.sendRequest(uri, request, std::string(), response, body);
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue (body == "GET /hello HTTP/1.1");
+	}
+	assertEqual (1, pool.connections(uri));
+	assertEqual (1, pool.idleConnections(uri));
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPClientPoolTest::testPost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	for (int i = 0; i < 3; ++i)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_POST, "/echo", HTTPMessage::HTTP_1_1);
+		request.setContentType("text/plain");
+		std::string requestBody(1000*(i + 1), 'x');
+		HTTPResponse response;
+		std::string body;
+		pool.sendRequest(uri, request, requestBody, response, body);
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue (body == requestBody);
+	}
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPClientPoolTest::testMaxConnectionsPerHost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool(2, Poco::Timespan(60, 0));
+	int succeeded = runConcurrently(pool, uri, "/slow", 6, 2, "HTTP/1.1");
+	assertEqual (12, succeeded);
+	assertTrue (srv.totalConnections() <= 2);
+	assertTrue (pool.connections(uri) <= 2);
+}
+
+
+void HTTPClientPoolTest::testIdleTimeout()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool(4, Poco::Timespan(0, 200000));
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+	HTTPResponse response;
+	std::string body;
+	pool.sendRequest(uri, request, std::string(), response, body);
+	assertEqual (1, pool.idleConnections(uri));
+
+	pool.purge();
+	assertEqual (1, pool.idleConnections(uri));
+
+	Thread::sleep(400);
+	pool.purge();
+	assertEqual (0, pool.idleConnections(uri));
+	assertEqual (0, pool.connections(uri));
+
+	pool.sendRequest(uri, request, std::string(), response, body);
+	assertTrue (body == "GET /hello HTTP/1.1");
+	assertEqual (2, srv.totalConnections());
+}
+
+
+void HTTPClientPoolTest::testBorrowSession()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool(1, Poco::Timespan(60, 0));
+	pool.setTimeout(Poco::Timespan(0, 200000));
+
+	HTTPClientSession* pSession = pool.borrowSession(uri);
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+	pSession->sendRequest(request);
+	HTTPResponse response;
+	std::string body;
+	StreamCopier::copyToString(pSession->receiveResponse(response), body);
+	assertTrue (body == "GET /hello HTTP/1.1");
+
+	// The only connection is in use.
+	try
+	{
+		pool.borrowSession(uri);
+		fail("connection limit reached - must throw");
+	}
+	catch (Poco::TimeoutException&)
+	{
+	}
+
+	pool.returnSession(pSession);
+	assertEqual (1, pool.idleConnections(uri));
+	HTTPClientSession* pSession2 = pool.borrowSession(uri);
+	assertTrue (pSession2 == pSession);
+	pool.returnSession(pSession2, false);
+	assertEqual (0, pool.connections(uri));
+}
+
+
+void HTTPClientPoolTest::testHTTP2()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	pool.setHTTP2PriorKnowledge(true);
+	for (int i = 0; i < 3; ++i)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+		HTTPResponse response;
+		std::string body;
+		pool.sendRequest(uri, request, std::string(), response, body);
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue (response.getVersion() == "HTTP/2.0");
+		assertTrue (response.getContentType() == "text/plain");
+		assertTrue (body == "GET /hello HTTP/2.0");
+	}
+
+	HTTPRequest request(HTTPRequest::HTTP_HEAD, "/hello", HTTPMessage::HTTP_1_1);
+	HTTPResponse response;
+	std::string body;
+	pool.sendRequest(uri, request, std::string(), response, body);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (body.empty());
+
+	assertEqual (1, pool.connections(uri));
+	assertEqual (0, pool.idleConnections(uri));
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPClientPoolTest::testHTTP2Post()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	pool.setHTTP2PriorKnowledge(true);
+
+	// Larger than the default flow-control windows in both directions.
+	std::string requestBody;
+	for (int i = 0; i < 300000; ++i)
+	{
+		requestBody += static_cast<char>('a' + i % 26);
+	}
+	HTTPRequest request(HTTPRequest::HTTP_POST, "/echo", HTTPMessage::HTTP_1_1);
+	request.setContentType("application/octet-stream");
+	HTTPResponse response;
+	std::string body;
+	pool.sendRequest(uri, request, requestBody, response, body);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.getVersion() == "HTTP/2.0");
+	assertTrue (response.getContentType() == "application/octet-stream");
+	assertTrue (body == requestBody);
+}
+
+
+void HTTPClientPoolTest::testHTTP2Concurrent()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	pool.setHTTP2PriorKnowledge(true);
+	int succeeded = runConcurrently(pool, uri, "/slow", 8, 3, "HTTP/2.0");
+	assertEqual (24, succeeded);
+
+	// All requests have been multiplexed over a single connection.
+	assertEqual (1, srv.totalConnections());
+	assertEqual (1, pool.connections(uri));
+}
+
+
+void HTTPClientPoolTest::testHTTP2Unavailable()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	// Without prior knowledge, HTTP/1.1 is used for plain HTTP.
+	URI uri = serverURI(svs);
+	HTTPClientPool pool;
+	for (int i = 0; i < 2; ++i)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/hello", HTTPMessage::HTTP_1_1);
+		HTTPResponse response;
+		std::string body;
+		pool.sendRequest(uri, request, std::string(), response, body);
+		assertTrue (response.getVersion() == "HTTP/1.1");
+		assertTrue (body == "GET /hello HTTP/1.1");
+	}
+	assertEqual (1, pool.idleConnections(uri));
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPClientPoolTest::setUp()
+{
+}
+
+
+void HTTPClientPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPClientPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPClientPoolTest");
+
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testKeepAlive);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testPost);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testMaxConnectionsPerHost);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testIdleTimeout);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testBorrowSession);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testHTTP2);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testHTTP2Post);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testHTTP2Concurrent);
+	CppUnit_addTest(pSuite, HTTPClientPoolTest, testHTTP2Unavailable);
+
+	return pSuite;
+}
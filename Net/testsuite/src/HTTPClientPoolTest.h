@@ -0,0 +1,46 @@
+//
+// HTTPClientPoolTest.h
+//
+// Definition of the HTTPClientPoolTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPClientPoolTest_INCLUDED
+#define HTTPClientPoolTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPClientPoolTest: public CppUnit::TestCase
+{
+public:
+	HTTPClientPoolTest(const std::string& name);
+	~HTTPClientPoolTest();
+
+	void testKeepAlive();
+	void testPost();
+	void testMaxConnectionsPerHost();
+	void testIdleTimeout();
+	void testBorrowSession();
+	void testHTTP2();
+	void testHTTP2Post();
+	void testHTTP2Concurrent();
+	void testHTTP2Unavailable();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPClientPoolTest_INCLUDED
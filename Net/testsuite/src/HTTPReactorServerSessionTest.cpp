@@ -1,5 +1,8 @@
 #include "HTTPReactorServerSessionTest.h"
 #include "Poco/Net/HTTPReactorServerSession.h"
+#include "Poco/Net/HTTPRequestParser.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/NetException.h"
 #include "CppUnit/TestSuite.h"
 #include "CppUnit/TestCaller.h"
 
@@ -153,6 +156,182 @@ void HTTPReactorServerSessionTest::testCheckRequestCompleteContentLengthWithStic
 	assertTrue(buf.length() == len);
 }
 
+void HTTPReactorServerSessionTest::testIncrementalParse()
+{
+	const std::string request(
+		"POST /path?x=1 HTTP/1.1\r\nHost: localhost\r\nX-Custom:   value  \r\n"
+		"Transfer-Encoding: chunked\r\n\r\n5\r\nHello\r\n6;ext=1\r\n World\r\n0\r\nX-Trailer: t\r\n\r\n");
+	Poco::Net::HTTPRequestParser parser;
+	std::string buf;
+	for (std::size_t i = 0; i < request.size(); ++i)
+	{
+		// feed byte by byte; the buffer may be reallocated between calls
+		buf += request[i];
+		Poco::Net::HTTPReactorServerSession session(Poco::Net::StreamSocket(), buf, parser, nullptr);
+		assertTrue (session.checkRequestComplete() == (i == request.size() - 1));
+		if (i == request.size() - 1)
+		{
+			assertTrue (parser.method() == "POST");
+			assertTrue (parser.uri() == "/path?x=1");
+			assertTrue (parser.version() == "HTTP/1.1");
+			assertTrue (parser.chunked());
+			assertTrue (parser.fieldCount() == 3);
+			assertTrue (parser.field(1).first == "X-Custom");
+			assertTrue (parser.field(1).second == "value");
+			assertTrue (parser.messageLength() == request.size());
+
+			Poco::Net::HTTPRequest req;
+			parser.fill(req);
+			assertTrue (req.getMethod() == "POST");
+			assertTrue (req.getURI() == "/path?x=1");
+			assertTrue (req.get("x-custom") == "value");
+			assertTrue (req.getChunkedTransferEncoding());
+
+			session.popCompletedRequest();
+			assertTrue (buf.empty());
+			assertTrue (parser.status() == Poco::Net::HTTPRequestParser::PARSE_INCOMPLETE);
+		}
+	}
+}
+
+void HTTPReactorServerSessionTest::testPipelinedRequests()
+{
+	std::string buf(
+		"GET /1 HTTP/1.1\r\nHost: localhost\r\n\r\n"
+		"POST /2 HTTP/1.1\r\nContent-Length: 3\r\n\r\nabc"
+		"GET /3 HTTP/1.1\r\n");
+	Poco::Net::HTTPRequestParser parser;
+	std::string uris;
+	for (;;)
+	{
+		Poco::Net::HTTPReactorServerSession session(Poco::Net::StreamSocket(), buf, parser, nullptr);
+		if (!session.checkRequestComplete()) break;
+		uris.append(parser.uri());
+	}
+	assertTrue (uris == "/1/2");
+	assertTrue (buf == "GET /3 HTTP/1.1\r\n");
+
+	buf.append("Host: localhost\r\n\r\n");
+	Poco::Net::HTTPReactorServerSession session(Poco::Net::StreamSocket(), buf, parser, nullptr);
+	assertTrue (session.checkRequestComplete());
+	assertTrue (parser.uri() == "/3");
+}
+
+void HTTPReactorServerSessionTest::testMalformedRequest()
+{
+	std::string buf("GET / HTTP/1.1\r\nContent-Length: abc\r\n\r\n");
+	Poco::Net::HTTPReactorServerSession session(Poco::Net::StreamSocket(), buf, nullptr);
+	try
+	{
+		session.checkRequestComplete();
+		fail("malformed Content-Length - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+	}
+
+	buf.assign("GET / HTTP/1.1\r\nX-Folded: a\r\n b\r\n\r\n");
+	Poco::Net::HTTPReactorServerSession session1(Poco::Net::StreamSocket(), buf, nullptr);
+	try
+	{
+		session1.checkRequestComplete();
+		fail("folded header - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+	}
+
+	buf.assign("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n");
+	Poco::Net::HTTPReactorServerSession session2(Poco::Net::StreamSocket(), buf, nullptr);
+	try
+	{
+		session2.checkRequestComplete();
+		fail("invalid chunk size - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+	}
+}
+
+void HTTPReactorServerSessionTest::testHeaderLimits()
+{
+	Poco::Net::HTTPRequestParser parser;
+	parser.setFieldLimit(4);
+	std::string buf("GET / HTTP/1.1\r\n");
+	for (int i = 0; i < 4; ++i) buf.append("X-Field: value\r\n");
+	buf.append("\r\n");
+	Poco::Net::HTTPReactorServerSession session(Poco::Net::StreamSocket(), buf, parser, nullptr);
+	assertTrue (session.checkRequestComplete());
+	assertTrue (parser.fieldCount() == 4);
+	session.popCompletedRequest();
+
+	buf.assign("GET / HTTP/1.1\r\n");
+	for (int i = 0; i < 5; ++i) buf.append("X-Field: value\r\n");
+	Poco::Net::HTTPReactorServerSession session1(Poco::Net::StreamSocket(), buf, parser, nullptr);
+	try
+	{
+		session1.checkRequestComplete();
+		fail("too many header fields - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+		assertTrue (parser.limitExceeded());
+	}
+
+	// the size limit applies to the header received so far, even
+	// if every single line is short
+	parser.reset();
+	assertTrue (!parser.limitExceeded());
+	parser.setFieldLimit(0);
+	parser.setHeaderSizeLimit(1024);
+	buf.assign("GET / HTTP/1.1\r\n");
+	bool failed = false;
+	while (!failed && buf.size() < 4096)
+	{
+		buf.append("X-Field: value\r\n");
+		Poco::Net::HTTPReactorServerSession session2(Poco::Net::StreamSocket(), buf, parser, nullptr);
+		try
+		{
+			assertTrue (!session2.checkRequestComplete());
+		}
+		catch (Poco::Net::MessageException&)
+		{
+			failed = true;
+		}
+	}
+	assertTrue (failed);
+	assertTrue (parser.limitExceeded());
+	assertTrue (buf.size() <= 1024 + 16);
+
+	parser.reset();
+	buf.assign("GET / HTTP/1.1\r\nX-Long: ");
+	buf.append(2048, 'x');
+	Poco::Net::HTTPReactorServerSession session3(Poco::Net::StreamSocket(), buf, parser, nullptr);
+	try
+	{
+		session3.checkRequestComplete();
+		fail("header too large - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+		assertTrue (parser.limitExceeded());
+	}
+
+	// other errors do not count as exceeded limits
+	parser.reset();
+	buf.assign("GET / HTTP/1.1\r\nContent-Length: abc\r\n\r\n");
+	Poco::Net::HTTPReactorServerSession session4(Poco::Net::StreamSocket(), buf, parser, nullptr);
+	try
+	{
+		session4.checkRequestComplete();
+		fail("malformed Content-Length - must throw");
+	}
+	catch (Poco::Net::MessageException&)
+	{
+		assertTrue (!parser.limitExceeded());
+	}
+}
+
 CppUnit::Test* HTTPReactorServerSessionTest::suite()
 {
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPReactorServerSessionTest");
@@ -166,6 +345,10 @@ CppUnit::Test* HTTPReactorServerSessionTest::suite()
 	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testCheckRequestCompleteContentLength);
 	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testCheckRequestCompleteContentLengthIncomplete);
 	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testCheckRequestCompleteContentLengthWithStickyBody);
+	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testIncrementalParse);
+	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testPipelinedRequests);
+	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testMalformedRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerSessionTest, testHeaderLimits);
 
 	return pSuite;
 }
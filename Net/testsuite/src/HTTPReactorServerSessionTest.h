@@ -19,6 +19,10 @@ public:
 	void testCheckRequestCompleteContentLength();
 	void testCheckRequestCompleteContentLengthIncomplete();
 	void testCheckRequestCompleteContentLengthWithStickyBody();
+	void testIncrementalParse();
+	void testPipelinedRequests();
+	void testMalformedRequest();
+	void testHeaderLimits();
 
 
 	void setUp();
@@ -8,7 +8,13 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/SocketStream.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/HTTPFileCache.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/TemporaryFile.h"
+#include "Poco/FileStream.h"
+#include <atomic>
 #include "CppUnit/TestSuite.h"
 #include "CppUnit/TestCaller.h"
 
@@ -53,6 +59,19 @@ namespace
 		}
 	};
 
+	class FileRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.sendFile(path, "application/octet-stream");
+		}
+
+		static std::string path;
+	};
+
+	std::string FileRequestHandler::path;
+
 	class RequestHandlerFactory: public HTTPRequestHandlerFactory
 	{
 	public:
@@ -62,9 +81,31 @@ namespace
 			{
 				return nullptr;
 			}
+			if (request.getURI() == "/file")
+			{
+				return new FileRequestHandler;
+			}
 			return new EchoBodyRequestHandler;
 		}
 	};
+
+	class CountingRequestHandlerFactory: public RequestHandlerFactory
+	{
+	public:
+		CountingRequestHandlerFactory(std::atomic<int>& requests):
+			_requests(requests)
+		{
+		}
+
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			++_requests;
+			return RequestHandlerFactory::createRequestHandler(request);
+		}
+
+	private:
+		std::atomic<int>& _requests;
+	};
 }
 
 HTTPReactorServerTest::HTTPReactorServerTest(const std::string& name): CppUnit::TestCase(name)
@@ -512,6 +553,228 @@ void HTTPReactorServerTest::testNotImplementedResponseWithKeepAlive()
 }
 
 
+void HTTPReactorServerTest::testPipelinedRequests()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setReactorMode(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	Poco::Net::StreamSocket ss(Poco::Net::SocketAddress("127.0.0.1", srv.port()));
+	std::string requests(
+		"POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: 5\r\n\r\nfirst"
+		"POST / HTTP/1.1\r\nHost: localhost\r\nTransfer-Encoding: chunked\r\n\r\n6\r\nsecond\r\n0\r\n\r\n");
+	ss.sendBytes(requests.data(), static_cast<int>(requests.size()));
+
+	Poco::Net::SocketStream str(ss);
+	HTTPResponse response1;
+	response1.read(str);
+	std::string body1(5, '\0');
+	str.read(&body1[0], 5);
+	assertTrue (response1.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (body1 == "first");
+
+	HTTPResponse response2;
+	response2.read(str);
+	assertTrue (response2.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response2.getChunkedTransferEncoding());
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testMalformedRequest()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setReactorMode(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	Poco::Net::StreamSocket ss(Poco::Net::SocketAddress("127.0.0.1", srv.port()));
+	std::string request("GET / HTTP/1.1\r\nContent-Length: -1\r\n\r\n");
+	ss.sendBytes(request.data(), static_cast<int>(request.size()));
+
+	Poco::Net::SocketStream str(ss);
+	HTTPResponse response;
+	response.read(str);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_BAD_REQUEST);
+
+	Poco::Net::StreamSocket ss1(Poco::Net::SocketAddress("127.0.0.1", srv.port()));
+	std::string request1("GET / HTTP/1.1\r\n");
+	for (int i = 0; i < 200; ++i) request1.append("X-Field: value\r\n");
+	request1.append("\r\n");
+	ss1.sendBytes(request1.data(), static_cast<int>(request1.size()));
+
+	Poco::Net::SocketStream str1(ss1);
+	HTTPResponse response1;
+	response1.read(str1);
+	assertTrue (response1.getStatus() == HTTPResponse::HTTP_REQUEST_HEADER_FIELDS_TOO_LARGE);
+	srv.stop();
+
+	// the limits are taken from the server parameters
+	HTTPServerParams* pParams2 = new HTTPServerParams;
+	pParams2->setKeepAlive(false);
+	pParams2->setReactorMode(true);
+	pParams2->setMaxHeaderFields(250);
+	pParams2->setMaxHeaderSize(8192);
+
+	Poco::Net::HTTPReactorServer srv2(0, pParams2, new RequestHandlerFactory);
+	srv2.start();
+
+	Poco::Net::StreamSocket ss2(Poco::Net::SocketAddress("127.0.0.1", srv2.port()));
+	ss2.sendBytes(request1.data(), static_cast<int>(request1.size()));
+	Poco::Net::SocketStream str2(ss2);
+	HTTPResponse response2;
+	response2.read(str2);
+	assertTrue (response2.getStatus() == HTTPResponse::HTTP_OK);
+
+	Poco::Net::StreamSocket ss3(Poco::Net::SocketAddress("127.0.0.1", srv2.port()));
+	std::string request3("GET / HTTP/1.1\r\nX-Field: " + std::string(10000, 'x') + "\r\n\r\n");
+	ss3.sendBytes(request3.data(), static_cast<int>(request3.size()));
+	Poco::Net::SocketStream str3(ss3);
+	HTTPResponse response3;
+	response3.read(str3);
+	assertTrue (response3.getStatus() == HTTPResponse::HTTP_REQUEST_HEADER_FIELDS_TOO_LARGE);
+	srv2.stop();
+}
+
+void HTTPReactorServerTest::testSendFile()
+{
+	Poco::TemporaryFile file;
+	std::string data;
+	data.reserve(4*1024*1024);
+	for (int i = 0; data.size() < 4*1024*1024; ++i)
+	{
+		data += std::to_string(i);
+		data += '\n';
+	}
+	Poco::FileOutputStream ostr(file.path());
+	ostr << data;
+	ostr.close();
+	FileRequestHandler::path = file.path();
+
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setReactorMode(true);
+	pParams->setUseSelfReactor(true);
+	pParams->setFileCache(new Poco::Net::HTTPFileCache);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", srv.port());
+	cs.setKeepAlive(true);
+	HTTPRequest request("GET", "/file", HTTPMessage::HTTP_1_1);
+	cs.sendRequest(request);
+	HTTPResponse response;
+	std::istream& rs = cs.receiveResponse(response);
+	std::string rbody;
+	rbody.assign((std::istreambuf_iterator<char>(rs)), std::istreambuf_iterator<char>());
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.getContentLength() == data.size());
+	assertTrue (rbody == data);
+	const std::string etag = response.get("ETag", "");
+	assertTrue (!etag.empty());
+
+	HTTPRequest request2("GET", "/file", HTTPMessage::HTTP_1_1);
+	request2.set("If-None-Match", etag);
+	cs.sendRequest(request2);
+	HTTPResponse response2;
+	cs.receiveResponse(response2);
+	assertTrue (response2.getStatus() == HTTPResponse::HTTP_NOT_MODIFIED);
+
+	// lists, weak validators and "*" use the weak comparison
+	for (const std::string& ifNoneMatch: {"\"x,y\", W/" + etag, std::string("*")})
+	{
+		HTTPRequest request4("GET", "/file", HTTPMessage::HTTP_1_1);
+		request4.set("If-None-Match", ifNoneMatch);
+		cs.sendRequest(request4);
+		HTTPResponse response4;
+		cs.receiveResponse(response4);
+		assertTrue (response4.getStatus() == HTTPResponse::HTTP_NOT_MODIFIED);
+	}
+
+	HTTPRequest request5("GET", "/file", HTTPMessage::HTTP_1_1);
+	request5.set("If-None-Match", "\"x\", W/\"y," + etag.substr(1));
+	cs.sendRequest(request5);
+	HTTPResponse response5;
+	std::istream& rs5 = cs.receiveResponse(response5);
+	rbody.assign((std::istreambuf_iterator<char>(rs5)), std::istreambuf_iterator<char>());
+	assertTrue (response5.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (rbody == data);
+
+	std::string body("after file");
+	HTTPRequest request3("POST", "/", HTTPMessage::HTTP_1_1);
+	request3.setContentLength((int) body.length());
+	cs.sendRequest(request3) << body;
+	HTTPResponse response3;
+	std::istream& rs3 = cs.receiveResponse(response3);
+	rbody.assign((std::istreambuf_iterator<char>(rs3)), std::istreambuf_iterator<char>());
+	assertTrue (rbody == body);
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testShardedAcceptors()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setReactorMode(true);
+	pParams->setAcceptorNum(2);
+	pParams->setUseSelfReactor(true);
+	pParams->setThreadAffinity({0});
+
+	std::atomic<int> requests[2];
+	requests[0] = 0;
+	requests[1] = 0;
+	std::vector<int> shards;
+	Poco::Net::HTTPReactorServer srv(Poco::Net::SocketAddress("127.0.0.1", 0), pParams,
+		[&](int acceptor)
+		{
+			shards.push_back(acceptor);
+			return HTTPRequestHandlerFactory::Ptr(new CountingRequestHandlerFactory(requests[acceptor]));
+		});
+	assertTrue (shards.size() == 2);
+	assertTrue (shards[0] == 0 && shards[1] == 1);
+	srv.start();
+
+	int port = srv.port();
+
+	// the kernel distributes connections by hashing the client address,
+	// so keep connecting until both shards have accepted a connection
+	int connections = 0;
+	while (connections < 64 && (connections < 8 || requests[0] == 0 || requests[1] == 0))
+	{
+		int before[2] = {requests[0], requests[1]};
+		HTTPClientSession cs("127.0.0.1", port);
+		cs.setKeepAlive(true);
+		for (int j = 0; j < 2; ++j)
+		{
+			std::string body("Shard " + std::to_string(connections) + "/" + std::to_string(j));
+			HTTPRequest request("POST", "/", HTTPMessage::HTTP_1_1);
+			request.setKeepAlive(true);
+			request.setContentLength((int) body.length());
+			cs.sendRequest(request) << body;
+			HTTPResponse response;
+			std::string rbody;
+			std::istream& rs = cs.receiveResponse(response);
+			rbody.assign((std::istreambuf_iterator<char>(rs)), std::istreambuf_iterator<char>());
+			assertTrue (rbody == body);
+		}
+		// all requests of a connection go to the factory of the accepting shard
+		int delta0 = requests[0] - before[0];
+		int delta1 = requests[1] - before[1];
+		assertTrue ((delta0 == 2 && delta1 == 0) || (delta0 == 0 && delta1 == 2));
+		++connections;
+	}
+	assertTrue (requests[0] > 0);
+	assertTrue (requests[1] > 0);
+	assertTrue (requests[0] + requests[1] == 2*connections);
+	srv.stop();
+}
+
+
 void HTTPReactorServerTest::setUp()
 {
 }
@@ -539,6 +802,10 @@ CppUnit::Test* HTTPReactorServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testConcurrentRequests);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testUseSelfReactor);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testNotImplementedResponseWithKeepAlive);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testPipelinedRequests);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testMalformedRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testSendFile);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testShardedAcceptors);
 
 	return pSuite;
 }
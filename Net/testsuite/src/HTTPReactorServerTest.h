@@ -24,6 +24,10 @@ public:
 	void testConcurrentRequests();
 	void testUseSelfReactor();
 	void testNotImplementedResponseWithKeepAlive();
+	void testPipelinedRequests();
+	void testMalformedRequest();
+	void testSendFile();
+	void testShardedAcceptors();
 
 	void setUp();
 	void tearDown();
@@ -22,11 +22,13 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/HTTPServerSession.h"
+#include "Poco/Net/HTTPFileCache.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/StreamCopier.h"
 #include "Poco/Path.h"
 #include "Poco/FileStream.h"
 #include "Poco/File.h"
+#include "Poco/TemporaryFile.h"
 #include <sstream>
 
 
@@ -42,6 +44,7 @@ using Poco::Net::HTTPResponse;
 using Poco::Net::HTTPServerResponse;
 using Poco::Net::HTTPMessage;
 using Poco::Net::ServerSocket;
+using Poco::Net::HTTPFileCache;
 using Poco::StreamCopier;
 using Poco::Path;
 using Poco::File;
@@ -136,6 +139,19 @@ namespace
 		}
 	};
 	
+	class CachedFileRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.sendFile(path, "text/plain");
+		}
+
+		static std::string path;
+	};
+
+	std::string CachedFileRequestHandler::path;
+
 	class TrailerRequestHandler: public HTTPRequestHandler
 	{
 	public:
@@ -170,6 +186,8 @@ namespace
 				return new TrailerRequestHandler;
 			else if (request.getURI() == "/file")
 				return new FileRequestHandler;
+			else if (request.getURI() == "/cachedfile")
+				return new CachedFileRequestHandler;
 			else
 				return nullptr;
 		}
@@ -210,6 +228,32 @@ void HTTPServerTest::testIdentityRequest()
 }
 
 
+void HTTPServerTest::testLargeBufferSize()
+{
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(false);
+	pParams->setBufferSize(16384);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setBufferSize(16384);
+	assertTrue (cs.getBufferSize() == 16384);
+	std::string body(100000, 'x');
+	HTTPRequest request("POST", "/echoBody");
+	request.setChunkedTransferEncoding(true);
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getChunkedTransferEncoding());
+	assertTrue (response.getContentType() == "text/plain");
+	assertTrue (rbody == body);
+}
+
+
 void HTTPServerTest::testPutIdentityRequest()
 {
 	ServerSocket svs(0);
@@ -543,6 +587,45 @@ void HTTPServerTest::testFile()
 }
 
 
+void HTTPServerTest::testCachedFileChanged()
+{
+	std::string payload(sendFileSize, 'x');
+	Poco::TemporaryFile file;
+	FileOutputStream fout(file.path());
+	fout << payload;
+	fout.close();
+	CachedFileRequestHandler::path = file.path();
+
+	ServerSocket svs(0);
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setFileCache(new HTTPFileCache(16, 1024*1024, Poco::Timespan(60, 0)));
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	cs.setKeepAlive(true);
+	for (int i = 0; i < 3; ++i)
+	{
+		HTTPRequest request("GET", "/cachedfile", HTTPMessage::HTTP_1_1);
+		cs.sendRequest(request);
+		HTTPResponse response;
+		std::string rbody;
+		StreamCopier::copyToString(cs.receiveResponse(response), rbody);
+		assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+		assertTrue (rbody == payload);
+
+		// The cached entry is not revalidated yet, so the
+		// additional data must not be sent.
+		if (i == 0)
+		{
+			FileOutputStream fappend(file.path(), std::ios::out | std::ios::app);
+			fappend << "more data";
+		}
+	}
+}
+
+
 void HTTPServerTest::testChunkedTrailer()
 {
 	ServerSocket svs(0);
@@ -580,6 +663,7 @@ CppUnit::Test* HTTPServerTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPServerTest");
 
 	CppUnit_addTest(pSuite, HTTPServerTest, testIdentityRequest);
+	CppUnit_addTest(pSuite, HTTPServerTest, testLargeBufferSize);
 	CppUnit_addTest(pSuite, HTTPServerTest, testPutIdentityRequest);
 	CppUnit_addTest(pSuite, HTTPServerTest, testChunkedRequest);
 	CppUnit_addTest(pSuite, HTTPServerTest, testIdentityRequestKeepAlive);
@@ -592,6 +676,7 @@ CppUnit::Test* HTTPServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPServerTest, testNotImpl);
 	CppUnit_addTest(pSuite, HTTPServerTest, testBuffer);
 	CppUnit_addTest(pSuite, HTTPServerTest, testFile);
+	CppUnit_addTest(pSuite, HTTPServerTest, testCachedFileChanged);
 	CppUnit_addTest(pSuite, HTTPServerTest, testChunkedTrailer);
 
 	return pSuite;
@@ -25,6 +25,7 @@ public:
 	~HTTPServerTest();
 
 	void testIdentityRequest();
+	void testLargeBufferSize();
 	void testPutIdentityRequest();
 	void testChunkedRequest();
 	void testIdentityRequestKeepAlive();
@@ -37,6 +38,7 @@ public:
 	void testNotImpl();
 	void testBuffer();
 	void testFile();
+	void testCachedFileChanged();
 	void testChunkedTrailer();
 
 	void setUp();
@@ -18,6 +18,7 @@
 #include "UDPServerTestSuite.h"
 #include "HTTPServerTestSuite.h"
 #include "HTTPReactorServerTestSuite.h"
+#include "HTTP2TestSuite.h"
 #include "HTMLTestSuite.h"
 #include "ReactorTestSuite.h"
 #include "FTPClientTestSuite.h"
@@ -42,6 +43,7 @@ CppUnit::Test* NetTestSuite::suite()
 	pSuite->addTest(UDPServerTestSuite::suite());
 	pSuite->addTest(HTTPServerTestSuite::suite());
 	pSuite->addTest(HTTPReactorServerTestSuite::suite());
+	pSuite->addTest(HTTP2TestSuite::suite());
 	pSuite->addTest(HTMLTestSuite::suite());
 	pSuite->addTest(ReactorTestSuite::suite());
 	pSuite->addTest(FTPClientTestSuite::suite());
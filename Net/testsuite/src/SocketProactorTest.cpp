@@ -17,6 +17,8 @@
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Timestamp.h"
 #include "Poco/Stopwatch.h"
+#include "Poco/Event.h"
+#include "Poco/Format.h"
 #include <iostream>
 
 using Poco::Net::SocketProactor;
@@ -27,6 +29,8 @@ using Poco::Net::SocketAddress;
 using Poco::Thread;
 using Poco::Timestamp;
 using Poco::Stopwatch;
+using Poco::Event;
+using Poco::Timespan;
 
 
 SocketProactorTest::SocketProactorTest(const std::string& name): CppUnit::TestCase(name)
@@ -41,8 +45,125 @@ SocketProactorTest::~SocketProactorTest()
 
 void SocketProactorTest::testTCPSocketProactor()
 {
+	doTestTCPSocketProactor(SocketProactor::IO_BACKEND_POLL);
+	if (SocketProactor::hasIOUring())
+		doTestTCPSocketProactor(SocketProactor::IO_BACKEND_IO_URING);
+}
+
+
+void SocketProactorTest::testUDPSocketProactor()
+{
+	doTestUDPSocketProactor(SocketProactor::IO_BACKEND_POLL);
+	if (SocketProactor::hasIOUring())
+		doTestUDPSocketProactor(SocketProactor::IO_BACKEND_IO_URING);
+}
+
+
+void SocketProactorTest::testIOUringBatch()
+{
+	if (!SocketProactor::hasIOUring())
+	{
+		std::cout << "io_uring not available, skipping." << std::endl;
+		return;
+	}
+
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, SocketProactor::IO_BACKEND_IO_URING);
+	assertTrue (proactor.backend() == SocketProactor::IO_BACKEND_IO_URING);
+
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	receiver.setReceiveBufferSize(1024*1024);
+	DatagramSocket sender(SocketAddress::IPv4);
+	const int count = 64;
+	std::vector<SocketProactor::Buffer> bufs(count, SocketProactor::Buffer(8, 0));
+	std::vector<SocketAddress> addrs(count);
+	std::atomic<int> sent(0), received(0), failed(0);
+	std::vector<int> sizes(count, 0);
+	for (int i = 0; i < count; ++i)
+	{
+		proactor.addReceiveFrom(receiver, bufs[i], addrs[i], [&, i](std::error_code err, int bytes)
+		{
+			if (err) ++failed;
+			sizes[i] = bytes;
+			++received;
+		});
+	}
+	for (int i = 0; i < count; ++i)
+	{
+		std::string msg = Poco::format("msg%d", i);
+		proactor.addSendTo(sender, SocketProactor::Buffer(msg.begin(), msg.end()), receiver.address(), [&](std::error_code err, int)
+		{
+			if (err) ++failed;
+			++sent;
+		});
+	}
+	assertTrue (proactor.has(receiver));
+	assertTrue (proactor.has(sender));
+
+	Stopwatch sw;
+	sw.start();
+	while (received < count || sent < count)
+	{
+		if (sw.elapsedSeconds() > 2)
+			fail("SocketProactor batch completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertEquals (0, failed.load());
+	for (int i = 0; i < count; ++i)
+	{
+		std::string msg = Poco::format("msg%d", i);
+		assertEquals (static_cast<int>(msg.size()), sizes[i]);
+		assertEquals (msg, std::string(bufs[i].begin(), bufs[i].begin() + sizes[i]));
+		assertEquals (sender.address().port(), addrs[i].port());
+	}
+
+	// stream operations on one socket complete in submission order
 	EchoServer echoServer;
-	SocketProactor proactor(false);
+	StreamSocket s;
+	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	std::string data;
+	for (int i = 0; i < 3; ++i)
+	{
+		std::string msg = Poco::format("chunk%d;", i);
+		data += msg;
+		proactor.addSend(s, SocketProactor::Buffer(msg.begin(), msg.end()), nullptr);
+	}
+	SocketProactor::Buffer buf;
+	std::string echoed;
+	std::atomic<bool> done(false);
+	SocketProactor::Callback onReceive = [&](std::error_code err, int bytes)
+	{
+		if (err || bytes == 0)
+		{
+			done = true;
+			return;
+		}
+		echoed.append(buf.begin(), buf.begin() + bytes);
+		if (echoed.size() < data.size())
+			proactor.addReceive(s, buf, SocketProactor::Callback(onReceive));
+		else
+			done = true;
+	};
+	proactor.addReceive(s, buf, SocketProactor::Callback(onReceive));
+	sw.restart();
+	while (!done)
+	{
+		if (sw.elapsedSeconds() > 2)
+			fail("SocketProactor stream completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertEquals (data, echoed);
+
+	// sockets are released once all their operations have completed
+	assertFalse (proactor.has(s));
+	assertFalse (proactor.has(receiver));
+	assertFalse (proactor.hasSocketHandlers());
+}
+
+
+void SocketProactorTest::doTestTCPSocketProactor(SocketProactor::IOBackend backend)
+{
+	EchoServer echoServer;
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, backend);
 	StreamSocket s;
 	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE | SocketProactor::POLL_ERROR;
@@ -131,11 +252,11 @@ void SocketProactorTest::testTCPSocketProactor()
 }
 
 
-void SocketProactorTest::testUDPSocketProactor()
+void SocketProactorTest::doTestUDPSocketProactor(SocketProactor::IOBackend backend)
 {
 	UDPEchoServer echoServer;
 	DatagramSocket s(SocketAddress::IPv4);
-	SocketProactor proactor(false);
+	SocketProactor proactor(Poco::Timespan(0, 250000), false, backend);
 	int mode = SocketProactor::POLL_READ | SocketProactor::POLL_WRITE;
 	proactor.addSocket(s, mode);
 	std::string hello = "hello proactor world";
@@ -331,6 +452,39 @@ void SocketProactorTest::testTimedWork()
 }
 
 
+void SocketProactorTest::testTimers()
+{
+	SocketProactor proactor(Timespan(10, 0));
+	Thread thread;
+	thread.start(proactor);
+	Thread::sleep(100);
+
+	Event fired;
+	Thread::TID tid = 0;
+	Stopwatch sw;
+	sw.start();
+	SocketProactor::Work timer = [&]()
+	{
+		tid = Thread::currentTid();
+		fired.set();
+	};
+	Poco::TimerWheel::TimerId id = proactor.timers().schedule(Timespan(50000), timer);
+	assertTrue (id != Poco::TimerWheel::INVALID_TIMER);
+	assertTrue (fired.tryWait(5000));
+	assertTrue (sw.elapsed() < 5000000);
+	assertTrue (tid == thread.tid());
+	assertTrue (!proactor.timers().isScheduled(id));
+
+	id = proactor.timers().schedule(Timespan(10, 0), timer);
+	assertTrue (proactor.timers().cancel(id));
+	assertTrue (proactor.timers().empty());
+
+	proactor.stop();
+	proactor.wakeUp();
+	thread.join();
+}
+
+
 void SocketProactorTest::setUp()
 {
 }
@@ -347,9 +501,11 @@ CppUnit::Test* SocketProactorTest::suite()
 
 	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactor);
+	CppUnit_addTest(pSuite, SocketProactorTest, testIOUringBatch);
 	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorStartStop);
 	CppUnit_addTest(pSuite, SocketProactorTest, testWork);
 	CppUnit_addTest(pSuite, SocketProactorTest, testTimedWork);
+	CppUnit_addTest(pSuite, SocketProactorTest, testTimers);
 
 	return pSuite;
 }
@@ -32,10 +32,12 @@ public:
 
 	void testTCPSocketProactor();
 	void testUDPSocketProactor();
+	void testIOUringBatch();
 	void testSocketProactorStartStop();
 
 	void testWork();
 	void testTimedWork();
+	void testTimers();
 
 	void setUp();
 	void tearDown();
@@ -43,6 +45,8 @@ public:
 	static CppUnit::Test* suite();
 
 private:
+	void doTestTCPSocketProactor(Poco::Net::SocketProactor::IOBackend backend);
+	void doTestUDPSocketProactor(Poco::Net::SocketProactor::IOBackend backend);
 };
 
 
@@ -23,8 +23,11 @@
 #include "Poco/Stopwatch.h"
 #include "Poco/Exception.h"
 #include "Poco/Thread.h"
+#include "Poco/Event.h"
 #include <sstream>
 #include <chrono>
+#include <atomic>
+#include <functional>
 
 
 using Poco::Net::SocketReactor;
@@ -45,6 +48,8 @@ using Poco::NObserver;
 using Poco::Stopwatch;
 using Poco::IllegalStateException;
 using Poco::Thread;
+using Poco::Event;
+using Poco::Timespan;
 
 
 namespace
@@ -511,6 +516,24 @@ namespace
 		NObserver<ConcurrentRemovalHandler, WritableNotification> _ow;
 		int _removeCount;
 	};
+
+	class TimeoutReactor: public SocketReactor
+	{
+	public:
+		TimeoutReactor(const Params& params):
+			SocketReactor(params)
+		{
+		}
+
+		Event timeout;
+
+	protected:
+		void onTimeout() override
+		{
+			timeout.set();
+			SocketReactor::onTimeout();
+		}
+	};
 }
 
 
@@ -758,6 +781,90 @@ void SocketReactorTest::testSocketReactorWakeup()
 }
 
 
+void SocketReactorTest::testSocketReactorTimers()
+{
+	SocketReactor::Params params;
+	params.pollTimeout = Timespan(10, 0);
+	params.sleepLimit = 10000;
+	SocketReactor reactor(params);
+	Thread thread;
+	thread.start(reactor);
+
+	// idle reactor, no sockets
+	Thread::sleep(100);
+	Event fired;
+	Thread::TID tid = 0;
+	Stopwatch sw;
+	sw.start();
+	reactor.timers().schedule(Timespan(50000), [&]()
+		{
+			tid = Thread::currentTid();
+			fired.set();
+		});
+	assertTrue (fired.tryWait(5000));
+	assertTrue (sw.elapsed() < 5000000);
+	assertTrue (tid == thread.tid());
+
+	// reactor waiting in poll()
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock(sa);
+	StreamSocket accepted = ss.acceptConnection();
+	NObserver<SocketReactorTest, ReadableNotification> obsRead(*this, &SocketReactorTest::onReadable);
+	reactor.addEventHandler(accepted, obsRead);
+	Thread::sleep(100);
+
+	int count = 0;
+	sw.restart();
+	reactor.timers().schedule(Timespan(50000), [&]()
+		{
+			++count;
+			fired.set();
+		});
+	assertTrue (fired.tryWait(5000));
+	assertTrue (sw.elapsed() < 5000000);
+	assertTrue (count == 1);
+
+	reactor.remove(accepted);
+	reactor.stop();
+	thread.join();
+}
+
+
+void SocketReactorTest::testSocketReactorTimeoutWithTimers()
+{
+	SocketReactor::Params params;
+	params.pollTimeout = Timespan(200000);
+	TimeoutReactor reactor(params);
+	Thread thread;
+	thread.start(reactor);
+
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock(sa);
+	StreamSocket accepted = ss.acceptConnection();
+	NObserver<SocketReactorTest, ReadableNotification> obsRead(*this, &SocketReactorTest::onReadable);
+	reactor.addEventHandler(accepted, obsRead);
+
+	// a timer that fires more often than the poll timeout
+	// must not suppress the TimeoutNotification
+	std::atomic<bool> stopTimer(false);
+	std::function<void()> tick = [&]()
+		{
+			if (!stopTimer) reactor.timers().schedule(Timespan(20000), tick);
+		};
+	reactor.timers().schedule(Timespan(20000), tick);
+	assertTrue (reactor.timeout.tryWait(5000));
+
+	stopTimer = true;
+	reactor.remove(accepted);
+	reactor.stop();
+	thread.join();
+}
+
+
 void SocketReactorTest::testSocketReactorRemove()
 {
 	SocketAddress ssa;
@@ -931,6 +1038,8 @@ CppUnit::Test* SocketReactorTest::suite()
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorWakeup);
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorRemove);
 	CppUnit_addTest(pSuite, SocketReactorTest, testConcurrentHandlerRemoval);
+	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorTimers);
+	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorTimeoutWithTimers);
 
 	return pSuite;
 }
@@ -42,6 +42,8 @@ public:
 	void testSocketReactorWakeup();
 	void testSocketReactorRemove();
 	void testConcurrentHandlerRemoval();
+	void testSocketReactorTimers();
+	void testSocketReactorTimeoutWithTimers();
 
 	void setUp();
 	void tearDown();
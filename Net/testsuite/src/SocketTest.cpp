@@ -843,6 +843,62 @@ void SocketTest::testSendFileRange()
 }
 
 
+void SocketTest::testSendFileNonBlocking()
+{
+	ServerSocket svs(SocketAddress("127.0.0.1", 0));
+	StreamSocket ss;
+	ss.connect(svs.address());
+	StreamSocket sr = svs.acceptConnection();
+
+	std::string sentData;
+
+	Poco::TemporaryFile file;
+	Poco::FileOutputStream ostr(file.path());
+	std::string data("0123456789abcdef");
+	for (int i = 0; i < 256*1024; i++)
+	{
+		ostr.write(data.data(), data.size());
+		sentData += data;
+	}
+	ostr.close();
+
+	Poco::FileInputStream istr(file.path());
+	ss.setBlocking(false);
+	std::streamoff offset = 0;
+	std::streamsize remaining = static_cast<std::streamsize>(sentData.size());
+	std::string receivedData;
+	Buffer<char> buffer(65536);
+	bool partial = false;
+	while (remaining > 0)
+	{
+		std::streamsize n = ss.sendFile(istr, offset, remaining);
+		if (n > 0)
+		{
+			offset += n;
+			remaining -= n;
+		}
+		if (remaining > 0)
+		{
+			partial = true;
+			// drain what has been sent so far
+			int r = sr.receiveBytes(buffer.begin(), static_cast<int>(buffer.size()));
+			assertTrue (r > 0);
+			receivedData.append(buffer.begin(), r);
+		}
+	}
+	// 4 MB exceed the socket buffers, so at least one send must be partial
+	assertTrue (partial);
+	ss.setBlocking(true);
+	ss.shutdownSend();
+	int r;
+	while ((r = sr.receiveBytes(buffer.begin(), static_cast<int>(buffer.size()))) > 0)
+	{
+		receivedData.append(buffer.begin(), r);
+	}
+	assertTrue (receivedData == sentData);
+}
+
+
 void SocketTest::onReadable(bool& b)
 {
 	if (b) ++_notToReadable;
@@ -903,6 +959,7 @@ CppUnit::Test* SocketTest::suite()
 	CppUnit_addTest(pSuite, SocketTest, testSendFile);
 	CppUnit_addTest(pSuite, SocketTest, testSendFileLarge);
 	CppUnit_addTest(pSuite, SocketTest, testSendFileRange);
+	CppUnit_addTest(pSuite, SocketTest, testSendFileNonBlocking);
 
 	return pSuite;
 }
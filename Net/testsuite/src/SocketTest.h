@@ -52,6 +52,7 @@ public:
 	void testSendFile();
 	void testSendFileLarge();
 	void testSendFileRange();
+	void testSendFileNonBlocking();
 
 	void setUp() override;
 	void tearDown() override;
@@ -18,6 +18,7 @@
 #include "Poco/Net/StreamSocket.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Thread.h"
+#include "Poco/ActiveThreadPool.h"
 #include "Poco/Mutex.h"
 #include <iostream>
 
@@ -32,6 +33,7 @@ using Poco::Net::StreamSocket;
 using Poco::Net::ServerSocket;
 using Poco::Net::SocketAddress;
 using Poco::Thread;
+using Poco::ActiveThreadPool;
 
 
 namespace
@@ -258,6 +260,56 @@ void TCPServerTest::testThreadCapacity()
 }
 
 
+void TCPServerTest::testActiveThreadPool()
+{
+	ActiveThreadPool pool("TCPServerTest", 2, POCO_THREAD_STACK_SIZE, ActiveThreadPool::SCHEDULING_WORK_STEALING);
+	ServerSocket svs(0);
+	TCPServerParams* pParams = new TCPServerParams;
+	pParams->setMaxQueued(1);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>(), pool, svs, pParams);
+	srv.start();
+	assertTrue (srv.maxThreads() == 2);
+	assertTrue (srv.queuedConnections() == 0);
+
+	SocketAddress sa("127.0.0.1", svs.address().port());
+	std::string data("hello, world");
+	char buffer[256];
+	StreamSocket ss1(sa);
+	ss1.sendBytes(data.data(), (int) data.size());
+	int n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	StreamSocket ss2(sa);
+	ss2.sendBytes(data.data(), (int) data.size());
+	n = ss2.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (srv.currentConnections() == 2);
+	assertTrue (srv.currentThreads() == 2);
+
+	StreamSocket ss3(sa);
+	Thread::sleep(200);
+	assertTrue (srv.queuedConnections() == 1);
+	StreamSocket ss4(sa);
+	Thread::sleep(200);
+	assertTrue (srv.queuedConnections() == 1);
+	assertTrue (srv.refusedConnections() == 1);
+
+	ss1.close();
+	ss3.sendBytes(data.data(), (int) data.size());
+	n = ss3.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (srv.queuedConnections() == 0);
+	assertTrue (srv.totalConnections() == 3);
+
+	ss2.close();
+	ss3.close();
+	ss4.close();
+	srv.stop();
+	pool.joinAll();
+	assertTrue (srv.currentConnections() == 0);
+	assertTrue (srv.maxConcurrentConnections() == 2);
+}
+
+
 void TCPServerTest::testFilter()
 {
 	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>());
@@ -300,6 +352,7 @@ CppUnit::Test* TCPServerTest::suite()
 	CppUnit_addTest(pSuite, TCPServerTest, testTwoConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testMultiConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testThreadCapacity);
+	CppUnit_addTest(pSuite, TCPServerTest, testActiveThreadPool);
 	CppUnit_addTest(pSuite, TCPServerTest, testFilter);
 
 	return pSuite;
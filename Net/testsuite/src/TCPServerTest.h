@@ -28,6 +28,7 @@ public:
 	void testTwoConnections();
 	void testMultiConnections();
 	void testThreadCapacity();
+	void testActiveThreadPool();
 	void testFilter();
 
 	void setUp();
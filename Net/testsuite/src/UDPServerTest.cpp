@@ -83,13 +83,15 @@ namespace
 	AtomicCounter TestUDPHandler::errors;
 
 	template<typename S>
-	bool server(int handlerCount, int reps, int port = 0)
+	bool server(int handlerCount, int reps, int port = 0, int batchSize = 1)
 	{
 		Poco::Net::UDPHandler::List handlers;
 		for (int i = 0; i < handlerCount; ++i)
 			handlers.push_back(new TestUDPHandler());
 
-		S server(handlers, Poco::Net::SocketAddress("127.0.0.1", port));
+		Poco::Net::UDPServerParams params(Poco::Net::SocketAddress("127.0.0.1", port), 10, 250000, 1000, false, 0);
+		params.setBatchSize(batchSize);
+		S server(handlers, params);
 		Poco::Thread::sleep(100);
 
 		Poco::Net::UDPClient client("127.0.0.1", server.port(), true);
@@ -183,6 +185,15 @@ void UDPServerTest::testServer()
 }
 
 
+void UDPServerTest::testBatchServer()
+{
+	int msgs = 10000;
+	assertTrue (server<Poco::Net::UDPServer>(1, msgs, 0, 32));
+	assertTrue (server<Poco::Net::UDPMultiServer>(4, msgs, 22081, 64));
+	assertTrue (TestUDPHandler::errors == 0);
+}
+
+
 void UDPServerTest::setUp()
 {
 }
@@ -198,6 +209,7 @@ CppUnit::Test* UDPServerTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("UDPServerTest");
 
 	CppUnit_addTest(pSuite, UDPServerTest, testServer);
+	CppUnit_addTest(pSuite, UDPServerTest, testBatchServer);
 
 	return pSuite;
 }
@@ -25,6 +25,7 @@ public:
 	~UDPServerTest();
 
 	void testServer();
+	void testBatchServer();
 
 	void setUp();
 	void tearDown();
@@ -22,7 +22,11 @@
 #include "Poco/Net/HTTPServerResponse.h"
 #include "Poco/Net/ServerSocket.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/AsyncWebSocket.h"
+#include "Poco/Net/PerMessageDeflate.h"
+#include "Poco/Net/SocketReactor.h"
 #include "Poco/Thread.h"
+#include "Poco/Event.h"
 #include "Poco/Buffer.h"
 
 
@@ -34,6 +38,9 @@ using Poco::Net::HTTPServerResponse;
 using Poco::Net::SocketStream;
 using Poco::Net::WebSocket;
 using Poco::Net::WebSocketException;
+using Poco::Net::AsyncWebSocket;
+using Poco::Net::PerMessageDeflate;
+using Poco::Net::SocketReactor;
 using Poco::Net::ConnectionAbortedException;
 using Poco::IOException;
 
@@ -43,7 +50,9 @@ namespace
 	class WebSocketRequestHandler: public Poco::Net::HTTPRequestHandler
 	{
 	public:
-		WebSocketRequestHandler(std::size_t bufSize = 1024): _bufSize(bufSize)
+		WebSocketRequestHandler(std::size_t bufSize = 1024, int options = WebSocket::WS_OPT_NONE):
+			_bufSize(bufSize),
+			_options(options)
 		{
 		}
 
@@ -51,7 +60,7 @@ namespace
 		{
 			try
 			{
-				WebSocket ws(request, response);
+				WebSocket ws(request, response, _options);
 				Poco::Buffer<char> buffer(_bufSize);
 				int flags;
 				int n;
@@ -88,22 +97,85 @@ namespace
 
 	private:
 		std::size_t _bufSize;
+		int _options;
 	};
 
 	class WebSocketRequestHandlerFactory: public Poco::Net::HTTPRequestHandlerFactory
 	{
 	public:
-		WebSocketRequestHandlerFactory(std::size_t bufSize = 1024): _bufSize(bufSize)
+		WebSocketRequestHandlerFactory(std::size_t bufSize = 1024, int options = WebSocket::WS_OPT_NONE):
+			_bufSize(bufSize),
+			_options(options)
 		{
 		}
 
 		Poco::Net::HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
 		{
-			return new WebSocketRequestHandler(_bufSize);
+			return new WebSocketRequestHandler(_bufSize, _options);
 		}
 
 	private:
 		std::size_t _bufSize;
+		int _options;
+	};
+
+	class AsyncWebSocketRequestHandler: public Poco::Net::HTTPRequestHandler
+	{
+	public:
+		AsyncWebSocketRequestHandler(SocketReactor& reactor, Poco::Event& closed, int& closeStatus):
+			_reactor(reactor),
+			_closed(closed),
+			_closeStatus(closeStatus)
+		{
+		}
+
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			WebSocket ws(request, response, WebSocket::WS_OPT_PERMESSAGE_DEFLATE);
+			AsyncWebSocket::Ptr pWS = new AsyncWebSocket(ws, _reactor);
+			pWS->setMessageCallback(
+				[](AsyncWebSocket& ws, const char* data, std::size_t length, int flags)
+				{
+					int opcode = flags & WebSocket::FRAME_OP_BITMASK;
+					if (opcode == WebSocket::FRAME_OP_TEXT || opcode == WebSocket::FRAME_OP_BINARY)
+						ws.sendFrame(data, static_cast<int>(length), flags);
+				});
+			Poco::Event& closed = _closed;
+			int& closeStatus = _closeStatus;
+			pWS->setCloseCallback(
+				[&closed, &closeStatus](AsyncWebSocket& ws, int statusCode, const std::string& reason)
+				{
+					closeStatus = statusCode;
+					closed.set();
+				});
+			pWS->start();
+		}
+
+	private:
+		SocketReactor& _reactor;
+		Poco::Event& _closed;
+		int& _closeStatus;
+	};
+
+	class AsyncWebSocketRequestHandlerFactory: public Poco::Net::HTTPRequestHandlerFactory
+	{
+	public:
+		AsyncWebSocketRequestHandlerFactory(SocketReactor& reactor, Poco::Event& closed, int& closeStatus):
+			_reactor(reactor),
+			_closed(closed),
+			_closeStatus(closeStatus)
+		{
+		}
+
+		Poco::Net::HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new AsyncWebSocketRequestHandler(_reactor, _closed, _closeStatus);
+		}
+
+	private:
+		SocketReactor& _reactor;
+		Poco::Event& _closed;
+		int& _closeStatus;
 	};
 }
 
@@ -355,6 +427,186 @@ void WebSocketTest::testWebSocketNB()
 }
 
 
+void WebSocketTest::testPerMessageDeflate()
+{
+	PerMessageDeflate::Parameters params;
+	std::string response;
+	assertTrue (PerMessageDeflate::negotiate("x-webkit-deflate-frame, permessage-deflate; client_max_window_bits", params, response));
+	assertTrue (response == "permessage-deflate");
+	assertTrue (PerMessageDeflate::negotiate("permessage-deflate; server_max_window_bits=8, permessage-deflate; server_no_context_takeover", params, response));
+	assertTrue (response == "permessage-deflate; server_no_context_takeover");
+	assertTrue (params.serverNoContextTakeover);
+	assertTrue (!PerMessageDeflate::negotiate("permessage-deflate; unknown_parameter", params, response));
+
+	assertTrue (PerMessageDeflate::accept("permessage-deflate; client_max_window_bits=10", params));
+	assertTrue (params.clientMaxWindowBits == 10);
+	assertTrue (!params.serverNoContextTakeover);
+	try
+	{
+		PerMessageDeflate::accept("permessage-deflate; client_max_window_bits=16", params);
+		fail("invalid window size - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assertTrue (exc.code() == WebSocket::WS_ERR_HANDSHAKE_EXTENSION);
+	}
+
+	PerMessageDeflate server(PerMessageDeflate::Parameters(), true);
+	PerMessageDeflate client(PerMessageDeflate::Parameters(), false);
+	std::string message;
+	for (int i = 0; i < 200; i++)
+	{
+		message += "{\"id\": " + std::to_string(i) + ", \"name\": \"permessage-deflate\"}";
+	}
+	std::string compressed;
+	server.compress(message.data(), message.size(), compressed);
+	assertTrue (compressed.size() < message.size()/4);
+	std::string decompressed;
+	client.decompress(compressed.data(), compressed.size(), true, decompressed, message.size());
+	assertTrue (decompressed == message);
+
+	// the second message refers to the first one
+	std::string compressed2;
+	server.compress(message.data(), message.size(), compressed2);
+	assertTrue (compressed2.size() < compressed.size());
+	decompressed.clear();
+	client.decompress(compressed2.data(), compressed2.size(), true, decompressed, message.size());
+	assertTrue (decompressed == message);
+
+	server.compress(message.data(), message.size(), compressed);
+	decompressed.clear();
+	try
+	{
+		client.decompress(compressed.data(), compressed.size(), true, decompressed, message.size() - 1);
+		fail("payload too big - must throw");
+	}
+	catch (WebSocketException& exc)
+	{
+		assertTrue (exc.code() == WebSocket::WS_ERR_PAYLOAD_TOO_BIG);
+	}
+}
+
+
+void WebSocketTest::testWebSocketDeflate()
+{
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new WebSocketRequestHandlerFactory(256*1024, WebSocket::WS_OPT_PERMESSAGE_DEFLATE), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+
+	Poco::Thread::sleep(200);
+
+	HTTPClientSession cs("127.0.0.1", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/ws", HTTPRequest::HTTP_1_1);
+	HTTPResponse response;
+	WebSocket ws(cs, request, response, WebSocket::WS_OPT_PERMESSAGE_DEFLATE);
+	assertTrue (ws.compressed());
+	assertTrue (response.get("Sec-WebSocket-Extensions") == "permessage-deflate");
+
+	Poco::Buffer<char> buffer(256*1024);
+	int flags;
+	std::string payload("x");
+	ws.sendFrame(payload.data(), (int) payload.size());
+	int n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == payload.size());
+	assertTrue (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+	assertTrue (flags == WebSocket::FRAME_TEXT);
+
+	for (int i = 0; i < 3; i++)
+	{
+		payload.assign(200000, 'a' + i);
+		ws.sendFrame(payload.data(), (int) payload.size(), WebSocket::FRAME_BINARY);
+		n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+		assertTrue (n == payload.size());
+		assertTrue (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+		assertTrue (flags == WebSocket::FRAME_BINARY);
+	}
+
+	ws.shutdown();
+	n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == 2);
+	assertTrue ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+
+	server.stop();
+}
+
+
+void WebSocketTest::testAsyncWebSocket()
+{
+	SocketReactor reactor;
+	Poco::Thread reactorThread;
+	reactorThread.start(reactor);
+
+	Poco::Event closed;
+	int closeStatus = 0;
+	Poco::Net::ServerSocket ss(0);
+	Poco::Net::HTTPServer server(new AsyncWebSocketRequestHandlerFactory(reactor, closed, closeStatus), ss, new Poco::Net::HTTPServerParams);
+	server.start();
+
+	Poco::Thread::sleep(200);
+
+	HTTPClientSession cs("127.0.0.1", ss.address().port());
+	HTTPRequest request(HTTPRequest::HTTP_GET, "/ws", HTTPRequest::HTTP_1_1);
+	HTTPResponse response;
+	WebSocket ws(cs, request, response, WebSocket::WS_OPT_PERMESSAGE_DEFLATE);
+	assertTrue (ws.compressed());
+
+	Poco::Buffer<char> buffer(256*1024);
+	int flags;
+	int n;
+
+	// many small frames in a row
+	for (int i = 0; i < 100; i++)
+	{
+		std::string payload = "message " + std::to_string(i);
+		ws.sendFrame(payload.data(), (int) payload.size());
+	}
+	for (int i = 0; i < 100; i++)
+	{
+		std::string payload = "message " + std::to_string(i);
+		n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+		assertTrue (n == payload.size());
+		assertTrue (payload.compare(0, payload.size(), buffer.begin(), n) == 0);
+		assertTrue (flags == WebSocket::FRAME_TEXT);
+	}
+
+	// a fragmented message is echoed as a single frame
+	std::string part1(1000, 'x');
+	std::string part2(70000, 'y');
+	std::string part3("z");
+	ws.sendFrame(part1.data(), (int) part1.size(), WebSocket::FRAME_OP_BINARY);
+	ws.sendFrame(part2.data(), (int) part2.size(), WebSocket::FRAME_OP_CONT);
+	ws.sendFrame(part3.data(), (int) part3.size(), static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_CONT));
+	n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == part1.size() + part2.size() + part3.size());
+	assertTrue ((part1 + part2 + part3).compare(0, n, buffer.begin(), n) == 0);
+	assertTrue (flags == WebSocket::FRAME_BINARY);
+
+	std::string ping("ping");
+	ws.sendFrame(ping.data(), (int) ping.size(), static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_PING));
+	n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == ping.size());
+	assertTrue (ping.compare(0, ping.size(), buffer.begin(), n) == 0);
+	assertTrue (flags == (static_cast<int>(WebSocket::FRAME_FLAG_FIN) | static_cast<int>(WebSocket::FRAME_OP_PONG)));
+
+	std::string large(200000, 'L');
+	ws.sendFrame(large.data(), (int) large.size());
+	n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == large.size());
+	assertTrue (large.compare(0, large.size(), buffer.begin(), n) == 0);
+
+	ws.shutdown();
+	n = ws.receiveFrame(buffer.begin(), static_cast<int>(buffer.size()), flags);
+	assertTrue (n == 2);
+	assertTrue ((flags & WebSocket::FRAME_OP_BITMASK) == WebSocket::FRAME_OP_CLOSE);
+	assertTrue (closed.tryWait(5000));
+	assertTrue (closeStatus == WebSocket::WS_NORMAL_CLOSE);
+
+	server.stop();
+	reactor.stop();
+	reactorThread.join();
+}
+
+
 void WebSocketTest::setUp()
 {
 }
@@ -373,6 +625,9 @@ CppUnit::Test* WebSocketTest::suite()
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLarge);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketLargeInOneFrame);
 	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketNB);
+	CppUnit_addTest(pSuite, WebSocketTest, testPerMessageDeflate);
+	CppUnit_addTest(pSuite, WebSocketTest, testWebSocketDeflate);
+	CppUnit_addTest(pSuite, WebSocketTest, testAsyncWebSocket);
 
 	return pSuite;
 }
@@ -28,6 +28,9 @@ public:
 	void testWebSocketLarge();
 	void testWebSocketLargeInOneFrame();
 	void testWebSocketNB();
+	void testPerMessageDeflate();
+	void testWebSocketDeflate();
+	void testAsyncWebSocket();
 
 	void setUp();
 	void tearDown();
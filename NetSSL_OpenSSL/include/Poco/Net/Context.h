@@ -29,6 +29,8 @@
 #include "Poco/AutoPtr.h"
 #include <openssl/ssl.h>
 #include <cstdlib>
+#include <string>
+#include <vector>
 
 
 namespace Poco::Net {
@@ -487,6 +489,24 @@ public:
 		/// but no close_notify alert is sent to the peer. This behaviour violates the TLS standard.
 		/// The default is a normal shutdown behaviour as described by the TLS standard.
 
+	void setALPNProtocols(const std::vector<std::string>& protocols);
+		/// Sets the application-layer protocols (RFC 7301) supported
+		/// for connections using this Context, in order of preference,
+		/// for example "h2" and "http/1.1".
+		///
+		/// A client Context offers the protocols to the server during
+		/// the handshake. A server Context selects the first of its
+		/// protocols that is also offered by the client. If there is
+		/// no such protocol, or the client does not use ALPN, no protocol
+		/// is selected and the handshake continues normally.
+		///
+		/// The selected protocol can be obtained with
+		/// SecureStreamSocket::getALPNProtocol() after the handshake.
+
+	const std::vector<std::string>& getALPNProtocols() const;
+		/// Returns the application-layer protocols set with
+		/// setALPNProtocols().
+
 private:
 	void init(const Params& params);
 		/// Initializes the Context with the given parameters.
@@ -501,12 +521,17 @@ private:
 	void createSSLContext();
 		/// Create a SSL_CTX object according to Context configuration.
 
+	static int onALPNSelect(SSL* pSSL, const unsigned char** out, unsigned char* outlen, const unsigned char* in, unsigned int inlen, void* arg);
+		/// Selects the application-layer protocol for a server connection.
+
 	Usage _usage;
 	VerificationMode _mode;
 	SSL_CTX* _pSSLContext;
 	bool _extendedCertificateVerification;
 	bool _ocspStaplingResponseVerification;
 	InvalidCertificateHandlerPtr _pInvalidCertificateHandler;
+	std::vector<std::string> _alpnProtocols;
+	std::string _alpnWireFormat;
 };
 
 
@@ -542,6 +567,12 @@ inline SSL_CTX* Context::sslContext() const
 }
 
 
+inline const std::vector<std::string>& Context::getALPNProtocols() const
+{
+	return _alpnProtocols;
+}
+
+
 inline bool Context::extendedCertificateVerificationEnabled() const
 {
 	return _extendedCertificateVerification;
@@ -0,0 +1,102 @@
+//
+// HTTPSClientPool.h
+//
+// Library: NetSSL_OpenSSL
+// Package: HTTPSClient
+// Module:  HTTPSClientPool
+//
+// Definition of the HTTPSClientPool class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_HTTPSClientPool_INCLUDED
+#define NetSSL_HTTPSClientPool_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/Net/HTTPClientPool.h"
+#include "Poco/Net/Context.h"
+#include "Poco/Net/Session.h"
+#include "Poco/Mutex.h"
+#include <map>
+
+
+namespace Poco::Net {
+
+
+class NetSSL_API HTTPSClientPool: public HTTPClientPool
+	/// A HTTPClientPool that supports HTTPS, with TLS session
+	/// resumption and HTTP/2 negotiated via ALPN.
+	///
+	/// For every server, the pool keeps the TLS session of the most
+	/// recent connection and reuses it for new connections, which
+	/// saves a full handshake. Session resumption requires that
+	/// session caching has been enabled on the Context with
+	/// Context::enableSessionCache().
+	///
+	/// HTTP/2 is used for "https" URIs if the Context offers the
+	/// "h2" protocol via ALPN (see Context::setALPNProtocols()), and
+	/// the server selects it. If the server does not select "h2", the
+	/// pool uses HTTP/1.1 for the server. As ALPN is configured on the
+	/// Context, a Context offering "h2" must not be used if HTTP/2 has
+	/// been disabled for the pool.
+	///
+	/// "http" URIs are handled as by HTTPClientPool.
+{
+public:
+	HTTPSClientPool();
+		/// Creates the HTTPSClientPool, using the default client
+		/// Context obtained from the SSLManager.
+
+	explicit HTTPSClientPool(Context::Ptr pContext);
+		/// Creates the HTTPSClientPool, using the given Context.
+
+	HTTPSClientPool(Context::Ptr pContext, int maxConnectionsPerHost, const Poco::Timespan& idleTimeout);
+		/// Creates the HTTPSClientPool, using the given Context, with the
+		/// given limit of connections per server and the given idle timeout.
+
+	~HTTPSClientPool() override;
+		/// Destroys the HTTPSClientPool.
+
+	Context::Ptr context() const;
+		/// Returns the Context used for secure connections.
+
+protected:
+	HTTPClientSession* createSession(const std::string& scheme, const std::string& host, Poco::UInt16 port) override;
+	HTTP2ClientSession::Ptr createHTTP2Session(const std::string& scheme, const std::string& host, Poco::UInt16 port) override;
+	void sessionReturned(HTTPClientSession& session) override;
+
+	Session::Ptr getSession(const std::string& host, Poco::UInt16 port) const;
+		/// Returns the cached TLS session for the given
+		/// server, or a null pointer if there is none.
+
+	void setSession(const std::string& host, Poco::UInt16 port, Session::Ptr pSession);
+		/// Caches the given TLS session for the given server.
+
+private:
+	static std::string sessionKey(const std::string& host, Poco::UInt16 port);
+
+	Context::Ptr _pContext;
+	std::map<std::string, Session::Ptr> _sessions;
+	mutable Poco::FastMutex _sessionMutex;
+};
+
+
+//
+// inlines
+//
+inline Context::Ptr HTTPSClientPool::context() const
+{
+	return _pContext;
+}
+
+
+} // namespace Poco::Net
+
+
+#endif // NetSSL_HTTPSClientPool_INCLUDED
@@ -79,8 +79,8 @@ public:
 
 	explicit HTTPSClientSession(const SecureStreamSocket& socket, const std::string& host, Poco::UInt16 port = HTTPS_PORT);
 		/// Creates a HTTPSClientSession using the given socket.
-		/// The socket must not be connected. The session
-		/// takes ownership of the socket.
+		/// The socket may already be connected to the given
+		/// server. The session takes ownership of the socket.
 		///
 		/// The given host name is used for certificate verification.
 
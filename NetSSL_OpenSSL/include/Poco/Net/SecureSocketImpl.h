@@ -231,6 +231,11 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string getALPNProtocol() const;
+		/// Returns the application-layer protocol selected
+		/// during the handshake (see Context::setALPNProtocols()),
+		/// or an empty string if no protocol has been selected.
+
 	SocketImpl* socket();
 		/// Returns the underlying SocketImpl.
 		
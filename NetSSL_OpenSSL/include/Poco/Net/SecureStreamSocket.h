@@ -267,6 +267,11 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string getALPNProtocol() const;
+		/// Returns the application-layer protocol selected
+		/// during the handshake (see Context::setALPNProtocols()),
+		/// or an empty string if no protocol has been selected.
+
 	void abort();
 		/// Aborts the SSL connection by closing the underlying
 		/// TCP connection. No orderly SSL shutdown is performed.
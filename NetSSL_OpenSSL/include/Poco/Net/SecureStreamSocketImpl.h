@@ -206,6 +206,10 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string getALPNProtocol() const;
+		/// Returns the application-layer protocol selected
+		/// during the handshake, or an empty string if none.
+
 	// SocketImpl
 	virtual void setBlocking(bool flag) override;
 	virtual bool getBlocking() const override;
@@ -279,6 +283,12 @@ inline bool SecureStreamSocketImpl::sessionWasReused()
 }
 
 
+inline std::string SecureStreamSocketImpl::getALPNProtocol() const
+{
+	return _impl.getALPNProtocol();
+}
+
+
 inline int SecureStreamSocketImpl::lastError()
 {
 	return SocketImpl::lastError();
@@ -248,6 +248,53 @@ void Context::setQuietShutdown(bool flag)
 	SSL_CTX_set_quiet_shutdown(_pSSLContext, flag ? 1 : 0);
 }
 
+
+void Context::setALPNProtocols(const std::vector<std::string>& protocols)
+{
+	std::string wireFormat;
+	for (const auto& protocol: protocols)
+	{
+		if (protocol.empty() || protocol.size() > 255)
+			throw Poco::InvalidArgumentException("Invalid ALPN protocol name", protocol);
+		wireFormat += static_cast<char>(protocol.size());
+		wireFormat += protocol;
+	}
+	_alpnProtocols = protocols;
+	_alpnWireFormat = wireFormat;
+
+	if (isForServerUse())
+	{
+		if (_alpnWireFormat.empty())
+			SSL_CTX_set_alpn_select_cb(_pSSLContext, nullptr, nullptr);
+		else
+			SSL_CTX_set_alpn_select_cb(_pSSLContext, &Context::onALPNSelect, this);
+	}
+	else
+	{
+		// Note: unlike most OpenSSL functions, this one returns 0 on success.
+		if (SSL_CTX_set_alpn_protos(_pSSLContext, reinterpret_cast<const unsigned char*>(_alpnWireFormat.data()), static_cast<unsigned>(_alpnWireFormat.size())) != 0)
+		{
+			std::string msg = Utility::getLastError();
+			throw SSLContextException("Cannot set ALPN protocols for Context", msg);
+		}
+	}
+}
+
+
+int Context::onALPNSelect(SSL* /*pSSL*/, const unsigned char** out, unsigned char* outlen, const unsigned char* in, unsigned int inlen, void* arg)
+{
+	Context* pContext = reinterpret_cast<Context*>(arg);
+	const unsigned char* pServer = reinterpret_cast<const unsigned char*>(pContext->_alpnWireFormat.data());
+	unsigned serverLen = static_cast<unsigned>(pContext->_alpnWireFormat.size());
+	unsigned char* pSelected = nullptr;
+	if (SSL_select_next_proto(&pSelected, outlen, pServer, serverLen, in, inlen) == OPENSSL_NPN_NEGOTIATED)
+	{
+		*out = pSelected;
+		return SSL_TLSEXT_ERR_OK;
+	}
+	return SSL_TLSEXT_ERR_NOACK;
+}
+
 void Context::useCertificate(const Poco::Crypto::X509Certificate& certificate)
 {
 	int errCode = SSL_CTX_use_certificate(_pSSLContext, const_cast<X509*>(certificate.certificate()));
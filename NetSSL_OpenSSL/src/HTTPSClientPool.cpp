@@ -0,0 +1,132 @@
+//
+// HTTPSClientPool.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: HTTPSClient
+// Module:  HTTPSClientPool
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPSClientPool.h"
+#include "Poco/Net/HTTPSClientSession.h"
+#include "Poco/Net/SecureStreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/SSLManager.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/String.h"
+#include <algorithm>
+
+
+namespace Poco::Net {
+
+
+HTTPSClientPool::HTTPSClientPool():
+	_pContext(SSLManager::instance().defaultClientContext())
+{
+}
+
+
+HTTPSClientPool::HTTPSClientPool(Context::Ptr pContext):
+	_pContext(pContext)
+{
+	poco_check_ptr (pContext);
+}
+
+
+HTTPSClientPool::HTTPSClientPool(Context::Ptr pContext, int maxConnectionsPerHost, const Poco::Timespan& idleTimeout):
+	HTTPClientPool(maxConnectionsPerHost, idleTimeout),
+	_pContext(pContext)
+{
+	poco_check_ptr (pContext);
+}
+
+
+HTTPSClientPool::~HTTPSClientPool()
+{
+}
+
+
+HTTPClientSession* HTTPSClientPool::createSession(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	if (scheme == "https")
+		return new HTTPSClientSession(host, port, _pContext, getSession(host, port));
+	else
+		return HTTPClientPool::createSession(scheme, host, port);
+}
+
+
+HTTP2ClientSession::Ptr HTTPSClientPool::createHTTP2Session(const std::string& scheme, const std::string& host, Poco::UInt16 port)
+{
+	if (scheme != "https")
+		return HTTPClientPool::createHTTP2Session(scheme, host, port);
+
+	const std::vector<std::string>& protocols = _pContext->getALPNProtocols();
+	if (std::find(protocols.begin(), protocols.end(), "h2") == protocols.end())
+		return HTTP2ClientSession::Ptr();
+
+	SecureStreamSocket socket(_pContext, getSession(host, port));
+	socket.setPeerHostName(host);
+	socket.connect(SocketAddress(host, port), getTimeout());
+	socket.setNoDelay(true);
+	setSession(host, port, socket.currentSession());
+	if (socket.getALPNProtocol() != "h2")
+	{
+		// Keep the connection for HTTP/1.1 requests
+		// instead of connecting again.
+		addIdleSession(scheme, host, port, new HTTPSClientSession(socket, host, port));
+		return HTTP2ClientSession::Ptr();
+	}
+	return new HTTP2ClientSession(socket, host, port);
+}
+
+
+void HTTPSClientPool::sessionReturned(HTTPClientSession& session)
+{
+	// Session tickets may arrive after the handshake, so the
+	// session is taken from the socket rather than from
+	// HTTPSClientSession::sslSession().
+	if (session.secure() && session.connected())
+	{
+		SecureStreamSocket socket(session.socket());
+		setSession(session.getHost(), session.getPort(), socket.currentSession());
+	}
+}
+
+
+Session::Ptr HTTPSClientPool::getSession(const std::string& host, Poco::UInt16 port) const
+{
+	Poco::FastMutex::ScopedLock lock(_sessionMutex);
+
+	auto it = _sessions.find(sessionKey(host, port));
+	if (it != _sessions.end())
+		return it->second;
+	else
+		return Session::Ptr();
+}
+
+
+void HTTPSClientPool::setSession(const std::string& host, Poco::UInt16 port, Session::Ptr pSession)
+{
+	if (!pSession) return;
+
+	Poco::FastMutex::ScopedLock lock(_sessionMutex);
+
+	_sessions[sessionKey(host, port)] = pSession;
+}
+
+
+std::string HTTPSClientPool::sessionKey(const std::string& host, Poco::UInt16 port)
+{
+	std::string key = Poco::toLower(host);
+	key += ':';
+	key += NumberFormatter::format(port);
+	return key;
+}
+
+
+} // namespace Poco::Net
@@ -41,11 +41,9 @@ HTTPSClientSession::HTTPSClientSession():
 
 
 HTTPSClientSession::HTTPSClientSession(const SecureStreamSocket& socket, const std::string& host, Poco::UInt16 port):
-	HTTPClientSession(socket),
+	HTTPClientSession(socket, host, port),
 	_pContext(socket.context())
 {
-	setHost(host);
-	setPort(port);
 	initProxySessionFactory();
 }
 
@@ -691,6 +691,20 @@ void SecureSocketImpl::useSession(Session::Ptr pSession)
 }
 
 
+std::string SecureSocketImpl::getALPNProtocol() const
+{
+	if (_pSSL)
+	{
+		LockT l(_mutex);
+		const unsigned char* pData = nullptr;
+		unsigned int length = 0;
+		::SSL_get0_alpn_selected(_pSSL, &pData, &length);
+		if (pData) return std::string(reinterpret_cast<const char*>(pData), length);
+	}
+	return std::string();
+}
+
+
 bool SecureSocketImpl::sessionWasReused()
 {
 	if (_pSSL)
@@ -291,6 +291,12 @@ bool SecureStreamSocket::sessionWasReused()
 }
 
 
+std::string SecureStreamSocket::getALPNProtocol() const
+{
+	return static_cast<SecureStreamSocketImpl*>(impl())->getALPNProtocol();
+}
+
+
 void SecureStreamSocket::abort()
 {
 	static_cast<SecureStreamSocketImpl*>(impl())->abort();
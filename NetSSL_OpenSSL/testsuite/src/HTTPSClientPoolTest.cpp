@@ -0,0 +1,227 @@
+//
+// HTTPSClientPoolTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPSClientPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPSClientPool.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/SecureServerSocket.h"
+#include "Poco/Net/Context.h"
+#include "Poco/Net/SSLManager.h"
+#include "Poco/Util/Application.h"
+#include "Poco/Util/AbstractConfiguration.h"
+#include "Poco/URI.h"
+#include <openssl/ssl.h>
+
+
+using namespace Poco::Net;
+using Poco::Util::Application;
+using Poco::URI;
+
+
+namespace
+{
+	class PoolRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string body = request.getMethod() + " " + request.getURI() + " " + request.getVersion();
+			response.setContentType("text/plain");
+			response.setContentLength(static_cast<int>(body.size()));
+			response.send() << body;
+		}
+	};
+
+	class PoolRequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new PoolRequestHandler;
+		}
+	};
+
+	Context::Ptr createContext(Context::Usage usage, const std::string& prefix)
+	{
+		// ensure OpenSSL machinery, including the certificate handlers, is fully setup
+		SSLManager::instance().defaultServerContext();
+		SSLManager::instance().defaultClientContext();
+
+		Poco::Util::AbstractConfiguration& config = Application::instance().config();
+		Context::Ptr pContext = new Context(
+			usage,
+			config.getString(prefix + ".privateKeyFile"),
+			config.getString(prefix + ".privateKeyFile"),
+			config.getString(prefix + ".caConfig"),
+			usage == Context::SERVER_USE ? Context::VERIFY_NONE : Context::VERIFY_RELAXED,
+			9,
+			true,
+			"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+		if (usage == Context::SERVER_USE)
+		{
+			pContext->enableSessionCache(true, "TestSuite");
+			pContext->disableStatelessSessionResumption();
+		}
+		else
+		{
+			pContext->enableSessionCache(true);
+		}
+		return pContext;
+	}
+
+	std::string get(HTTPClientPool& pool, const URI& uri, const std::string& path, std::string& version)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, path, HTTPMessage::HTTP_1_1);
+		HTTPResponse response;
+		std::string body;
+		pool.sendRequest(uri, request, std::string(), response, body);
+		version = response.getVersion();
+		return body;
+	}
+}
+
+
+HTTPSClientPoolTest::HTTPSClientPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPSClientPoolTest::~HTTPSClientPoolTest()
+{
+}
+
+
+void HTTPSClientPoolTest::testKeepAlive()
+{
+	Context::Ptr pServerContext = createContext(Context::SERVER_USE, "openSSL.server");
+	SecureServerSocket svs(0, 64, pServerContext);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("https://127.0.0.1:" + std::to_string(svs.address().port()));
+	HTTPSClientPool pool(createContext(Context::CLIENT_USE, "openSSL.client"));
+	std::string version;
+	for (int i = 0; i < 3; ++i)
+	{
+		assertTrue (get(pool, uri, "/hello", version) == "GET /hello HTTP/1.1");
+		assertTrue (version == "HTTP/1.1");
+	}
+	assertEqual (1, pool.idleConnections(uri));
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPSClientPoolTest::testSessionResumption()
+{
+	Context::Ptr pServerContext = createContext(Context::SERVER_USE, "openSSL.server");
+	SecureServerSocket svs(0, 64, pServerContext);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("https://127.0.0.1:" + std::to_string(svs.address().port()));
+	Context::Ptr pClientContext = createContext(Context::CLIENT_USE, "openSSL.client");
+	// TLS 1.2, as the server session cache counts resumed
+	// sessions reliably only for session ID based resumption.
+	pClientContext->disableProtocols(Context::PROTO_TLSV1_3);
+	HTTPSClientPool pool(pClientContext);
+	std::string version;
+	assertTrue (get(pool, uri, "/first", version) == "GET /first HTTP/1.1");
+	assertEqual (0, static_cast<int>(SSL_CTX_sess_hits(pServerContext->sslContext())));
+
+	// The new connection resumes the TLS session of the first one.
+	pool.clear();
+	assertTrue (get(pool, uri, "/second", version) == "GET /second HTTP/1.1");
+	assertEqual (2, srv.totalConnections());
+	assertEqual (1, static_cast<int>(SSL_CTX_sess_hits(pServerContext->sslContext())));
+}
+
+
+void HTTPSClientPoolTest::testHTTP2()
+{
+	std::vector<std::string> protocols = {"h2", "http/1.1"};
+
+	Context::Ptr pServerContext = createContext(Context::SERVER_USE, "openSSL.server");
+	pServerContext->setALPNProtocols(protocols);
+	SecureServerSocket svs(0, 64, pServerContext);
+	HTTPServerParams::Ptr pParams = new HTTPServerParams;
+	pParams->setHTTP2Enabled(true);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	URI uri("https://127.0.0.1:" + std::to_string(svs.address().port()));
+	Context::Ptr pClientContext = createContext(Context::CLIENT_USE, "openSSL.client");
+	pClientContext->setALPNProtocols(protocols);
+	HTTPSClientPool pool(pClientContext);
+	std::string version;
+	for (int i = 0; i < 3; ++i)
+	{
+		assertTrue (get(pool, uri, "/hello", version) == "GET /hello HTTP/2.0");
+		assertTrue (version == "HTTP/2.0");
+	}
+	assertEqual (1, pool.connections(uri));
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPSClientPoolTest::testHTTP2Unavailable()
+{
+	// The server does not support ALPN, so the
+	// pool falls back to HTTP/1.1.
+	Context::Ptr pServerContext = createContext(Context::SERVER_USE, "openSSL.server");
+	SecureServerSocket svs(0, 64, pServerContext);
+	HTTPServer srv(new PoolRequestHandlerFactory, svs, new HTTPServerParams);
+	srv.start();
+
+	URI uri("https://127.0.0.1:" + std::to_string(svs.address().port()));
+	Context::Ptr pClientContext = createContext(Context::CLIENT_USE, "openSSL.client");
+	pClientContext->setALPNProtocols({"h2", "http/1.1"});
+	HTTPSClientPool pool(pClientContext);
+	std::string version;
+	for (int i = 0; i < 3; ++i)
+	{
+		assertTrue (get(pool, uri, "/hello", version) == "GET /hello HTTP/1.1");
+		assertTrue (version == "HTTP/1.1");
+	}
+	assertEqual (1, pool.idleConnections(uri));
+	// The connection used for the ALPN negotiation is kept for HTTP/1.1.
+	assertEqual (1, srv.totalConnections());
+}
+
+
+void HTTPSClientPoolTest::setUp()
+{
+}
+
+
+void HTTPSClientPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPSClientPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPSClientPoolTest");
+
+	CppUnit_addTest(pSuite, HTTPSClientPoolTest, testKeepAlive);
+	CppUnit_addTest(pSuite, HTTPSClientPoolTest, testSessionResumption);
+	CppUnit_addTest(pSuite, HTTPSClientPoolTest, testHTTP2);
+	CppUnit_addTest(pSuite, HTTPSClientPoolTest, testHTTP2Unavailable);
+
+	return pSuite;
+}
@@ -0,0 +1,41 @@
+//
+// HTTPSClientPoolTest.h
+//
+// Definition of the HTTPSClientPoolTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTPSClientPoolTest_INCLUDED
+#define HTTPSClientPoolTest_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTPSClientPoolTest: public CppUnit::TestCase
+{
+public:
+	HTTPSClientPoolTest(const std::string& name);
+	~HTTPSClientPoolTest();
+
+	void testKeepAlive();
+	void testSessionResumption();
+	void testHTTP2();
+	void testHTTP2Unavailable();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTPSClientPoolTest_INCLUDED
@@ -11,6 +11,7 @@
 #include "HTTPSClientTestSuite.h"
 #include "HTTPSClientSessionTest.h"
 #include "HTTPSStreamFactoryTest.h"
+#include "HTTPSClientPoolTest.h"
 
 
 CppUnit::Test* HTTPSClientTestSuite::suite()
@@ -19,6 +20,7 @@ CppUnit::Test* HTTPSClientTestSuite::suite()
 
 	pSuite->addTest(HTTPSClientSessionTest::suite());
 	pSuite->addTest(HTTPSStreamFactoryTest::suite());
+	pSuite->addTest(HTTPSClientPoolTest::suite());
 
 	return pSuite;
 }
@@ -13,9 +13,10 @@
 
 
 #include "Poco/Prometheus/TextExporter.h"
-#include "Poco/NumberFormatter.h"
+#include "Poco/NumericString.h"
 #include <vector>
 #include <ostream>
+#include <string_view>
 #include <cmath>
 
 
@@ -34,31 +35,37 @@ const std::string TextExporter::UNTYPED{"untyped"s};
 
 namespace
 {
-	std::string escape(const std::string& str)
+	void writeEscaped(std::ostream& stream, const std::string& str)
+		/// Writes str to stream, escaping backslash, newline and
+		/// double quote. Runs of other characters are written as a whole.
 	{
-		std::string result;
-		for (char c: str)
+		const char* begin = str.data();
+		const char* const end = begin + str.size();
+		for (const char* it = begin; it != end; ++it)
 		{
-			switch (c)
+			const char* escaped = nullptr;
+			switch (*it)
 			{
 			case '\\':
-				result += "\\\\";
+				escaped = "\\\\";
 				break;
 			case '\n':
-				result += "\\n";
+				escaped = "\\n";
 				break;
 			case '"':
-				result += "\\\"";
+				escaped = "\\\"";
 				break;
 			default:
-				result += c;
+				continue;
 			}
+			stream.write(begin, it - begin);
+			stream.write(escaped, 2);
+			begin = it + 1;
 		}
-		return result;
+		stream.write(begin, end - begin);
 	}
 
-	template <typename T>
-	void writeSampleImpl(std::ostream& stream, const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, T&& value, const Poco::Timestamp& timestamp)
+	void writeSampleImpl(std::ostream& stream, const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, std::string_view value, const Poco::Timestamp& timestamp)
 	{
 		poco_assert_dbg (labelNames.size() == labelValues.size());
 
@@ -69,17 +76,31 @@ namespace
 			for (std::size_t i = 0; i < labelNames.size(); i++)
 			{
 				if (i > 0) stream << ',';
-				stream << labelNames[i] << "=\"" << escape(labelValues[i]) << '"';
+				stream << labelNames[i] << "=\"";
+				writeEscaped(stream, labelValues[i]);
+				stream << '"';
 			}
 			stream << '}';
 		}
 		stream << ' ' << value;
 		if (timestamp != 0)
 		{
-			stream << ' ' << timestamp.epochMicroseconds()/1000;
+			char buffer[POCO_MAX_INT_STRING_LEN];
+			const auto res = Poco::toChars(buffer, buffer + sizeof(buffer), timestamp.epochMicroseconds()/1000);
+			stream << ' ';
+			stream.write(buffer, res.ptr - buffer);
 		}
 		stream << '\n';
 	}
+
+	template <typename T>
+	void writeNumberSample(std::ostream& stream, const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, T value, const Poco::Timestamp& timestamp)
+		/// Formats value into a stack buffer, avoiding a temporary string.
+	{
+		char buffer[POCO_MAX_FLT_STRING_LEN];
+		const auto res = Poco::toChars(buffer, buffer + sizeof(buffer), value);
+		writeSampleImpl(stream, metric, labelNames, labelValues, std::string_view(buffer, res.ptr - buffer), timestamp);
+	}
 }
 
 
@@ -113,47 +134,42 @@ void TextExporter::writeSample(const Metric& metric, const std::vector<std::stri
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, double value, const Poco::Timestamp& timestamp)
 {
-	std::string valueString;
 	if (std::isinf(value))
 	{
-		if (value > 0)
-			valueString = "+Inf";
-		else
-			valueString = "-Inf";
+		writeSampleImpl(_stream, metric, labelNames, labelValues, value > 0 ? "+Inf" : "-Inf", timestamp);
 	}
 	else if (std::isnan(value))
 	{
-		valueString = "NaN";
+		writeSampleImpl(_stream, metric, labelNames, labelValues, "NaN", timestamp);
 	}
 	else
 	{
-		valueString = Poco::NumberFormatter::format(value);
+		writeNumberSample(_stream, metric, labelNames, labelValues, value, timestamp);
 	}
-	writeSampleImpl(_stream, metric, labelNames, labelValues, valueString, timestamp);
 }
 
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt32 value, const Poco::Timestamp& timestamp)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	writeNumberSample(_stream, metric, labelNames, labelValues, value, timestamp);
 }
 
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int32 value, const Poco::Timestamp& timestamp)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	writeNumberSample(_stream, metric, labelNames, labelValues, value, timestamp);
 }
 
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::UInt64 value, const Poco::Timestamp& timestamp)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	writeNumberSample(_stream, metric, labelNames, labelValues, value, timestamp);
 }
 
 
 void TextExporter::writeSample(const Metric& metric, const std::vector<std::string>& labelNames, const std::vector<std::string>& labelValues, Poco::Int64 value, const Poco::Timestamp& timestamp)
 {
-	writeSampleImpl(_stream, metric, labelNames, labelValues, value, timestamp);
+	writeNumberSample(_stream, metric, labelNames, labelValues, value, timestamp);
 }
 
 
@@ -20,9 +20,13 @@
 
 #include "Poco/Util/Util.h"
 #include "Poco/Util/TimerTask.h"
-#include "Poco/TimedNotificationQueue.h"
+#include "Poco/TimerWheel.h"
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include "Poco/Clock.h"
+#include <atomic>
 
 
 namespace Poco::Util {
@@ -40,6 +44,10 @@ class Util_API Timer: protected Poco::Runnable
 	/// Timer is safe for multithreaded use - multiple threads can schedule
 	/// new tasks simultaneously.
 	///
+	/// Scheduled tasks are kept in a TimerWheel, so scheduling a task
+	/// takes constant time, regardless of the number of scheduled tasks.
+	/// Tasks are executed with a resolution of one millisecond.
+	///
 	/// Via the func() helper function template, a functor or
 	/// lambda can be used as timer task:
 	///
@@ -189,7 +197,23 @@ protected:
 	static void validateTask(const TimerTask::Ptr& pTask);
 
 private:
-	Poco::TimedNotificationQueue _queue;
+	enum TaskMode
+	{
+		TASK_ONCE,
+		TASK_PERIODIC,
+		TASK_FIXED_RATE
+	};
+
+	void scheduleTask(TimerTask::Ptr pTask, Poco::Clock clock, TaskMode mode, long interval);
+	void runTask(TimerTask::Ptr pTask, Poco::Clock clock, TaskMode mode, long interval, Poco::UInt64 generation);
+	static Poco::Clock toClock(const Poco::Timestamp& time);
+
+	Poco::TimerWheel _wheel;
+	Poco::Event _wakeUp;
+	std::atomic<bool> _stopped;
+	Poco::UInt64 _generation;
+	Poco::FastMutex _mutex;
+	Poco::FastMutex _taskMutex;
 	Poco::Thread _thread;
 };
 
@@ -199,13 +223,13 @@ private:
 //
 inline bool Timer::idle() const
 {
-	return _queue.empty();
+	return _wheel.empty();
 }
 
 
 inline std::size_t Timer::taskCount() const
 {
-	return _queue.size();
+	return _wheel.size();
 }
 
 
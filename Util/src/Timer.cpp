@@ -11,227 +11,38 @@
 // SPDX-License-Identifier:	BSL-1.0
 //
 
-
 #include "Poco/Util/Timer.h"
-#include "Poco/Notification.h"
 #include "Poco/ErrorHandler.h"
-#include "Poco/Event.h"
 
 
 using Poco::ErrorHandler;
+using Poco::FastMutex;
 
 
 namespace Poco::Util {
 
 
-class TimerNotification: public Poco::Notification
-{
-public:
-	TimerNotification(Poco::TimedNotificationQueue& queue):
-		_queue(queue)
-	{
-	}
-
-	~TimerNotification() = default;
-
-	virtual bool execute() = 0;
-
-	Poco::TimedNotificationQueue& queue()
-	{
-		return _queue;
-	}
-
-private:
-	Poco::TimedNotificationQueue& _queue;
-};
-
-
-class StopNotification: public TimerNotification
-{
-public:
-	StopNotification(Poco::TimedNotificationQueue& queue):
-		TimerNotification(queue)
-	{
-	}
-
-	~StopNotification() = default;
-
-	bool execute() override
-	{
-		queue().clear();
-		return false;
-	}
-};
-
-
-class CancelNotification: public TimerNotification
+namespace
 {
-public:
-	CancelNotification(Poco::TimedNotificationQueue& queue):
-		TimerNotification(queue)
-	{
-	}
-
-	~CancelNotification() = default;
-
-	bool execute() override
-	{
-		// Check if there's a StopNotification pending.
-		int numberOfPendingTasks = queue().size();
-		while (numberOfPendingTasks > 0)
-		{
-			Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(queue().dequeueNextNotification());
-			numberOfPendingTasks--;
-			if (!pNf)
-			{
-				continue;
-			}
-			if (pNf.cast<StopNotification>())
-			{
-				queue().clear();
-				_finished.set();
-				return false;
-			}
-			Poco::AutoPtr<CancelNotification> pCnf = pNf.cast<CancelNotification>();
-			if (pCnf)
-			{
-				pCnf->_finished.set();
-			}
-		}
-
-		_finished.set();
-		return true;
-	}
-
-	void wait()
-	{
-		_finished.wait();
-	}
-
-private:
-	Poco::Event _finished;
-};
-
-
-class TaskNotification: public TimerNotification
-{
-public:
-	TaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask):
-		TimerNotification(queue),
-		_pTask(pTask)
-	{
-	}
-
-	~TaskNotification() = default;
-
-	TimerTask::Ptr task()
-	{
-		return _pTask;
-	}
-
-	bool execute() override
-	{
-		if (!_pTask->isCancelled())
-		{
-			try
-			{
-				_pTask->updateLastExecution();
-				_pTask->run();
-			}
-			catch (Exception& exc)
-			{
-				ErrorHandler::handle(exc);
-			}
-			catch (std::exception& exc)
-			{
-				ErrorHandler::handle(exc);
-			}
-			catch (...)
-			{
-				ErrorHandler::handle();
-			}
-		}
-		return true;
-	}
-
-private:
-	TimerTask::Ptr _pTask;
-};
-
-
-class PeriodicTaskNotification: public TaskNotification
-{
-public:
-	PeriodicTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval):
-		TaskNotification(queue, pTask),
-		_interval(interval)
-	{
-	}
-
-	~PeriodicTaskNotification() = default;
-
-	bool execute() override
-	{
-		TaskNotification::execute();
-
-		if (!task()->isCancelled())
-		{
-			Poco::Clock now;
-			Poco::Clock nextExecution;
-			nextExecution += static_cast<Poco::Clock::ClockDiff>(_interval)*1000;
-			if (nextExecution < now) nextExecution = now;
-			queue().enqueueNotification(this, nextExecution);
-			duplicate();
-		}
-		return true;
-	}
-
-private:
-	long _interval;
-};
-
-
-class FixedRateTaskNotification: public TaskNotification
-{
-public:
-	FixedRateTaskNotification(Poco::TimedNotificationQueue& queue, TimerTask::Ptr pTask, long interval, Poco::Clock clock):
-		TaskNotification(queue, pTask),
-		_interval(interval),
-		_nextExecution(clock)
-	{
-	}
-
-	~FixedRateTaskNotification() = default;
-
-	bool execute() override
-	{
-		TaskNotification::execute();
-
-		if (!task()->isCancelled())
-		{
-			Poco::Clock now;
-			_nextExecution += static_cast<Poco::Clock::ClockDiff>(_interval)*1000;
-			if (_nextExecution < now) _nextExecution = now;
-			queue().enqueueNotification(this, _nextExecution);
-			duplicate();
-		}
-		return true;
-	}
-
-private:
-	long _interval;
-	Poco::Clock _nextExecution;
-};
+	const Poco::Timespan MAX_SLEEP(1, 0);
+		// Upper bound for a single wait of the timer thread.
+}
 
 
-Timer::Timer()
+Timer::Timer():
+	_stopped(false),
+	_generation(0)
 {
+	_wheel.setWakeUpCallback([this]() { _wakeUp.set(); });
 	_thread.start(*this);
 }
 
 
-Timer::Timer(Poco::Thread::Priority priority)
+Timer::Timer(Poco::Thread::Priority priority):
+	_stopped(false),
+	_generation(0)
 {
+	_wheel.setWakeUpCallback([this]() { _wakeUp.set(); });
 	_thread.setPriority(priority);
 	_thread.start(*this);
 }
@@ -241,8 +52,10 @@ Timer::~Timer()
 {
 	try
 	{
-		_queue.enqueueNotification(new StopNotification(_queue), Poco::Clock(0));
+		_stopped = true;
+		_wakeUp.set();
 		_thread.join();
+		_wheel.clear();
 	}
 	catch (...)
 	{
@@ -253,11 +66,15 @@ Timer::~Timer()
 
 void Timer::cancel(bool wait)
 {
-	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(_queue);
-	_queue.enqueueNotification(pNf, Poco::Clock(0));
-	if (wait)
 	{
-		pNf->wait();
+		FastMutex::ScopedLock lock(_mutex);
+		++_generation;
+		_wheel.clear();
+	}
+	if (wait && Poco::Thread::current() != &_thread)
+	{
+		// wait for a currently executing task to complete
+		FastMutex::ScopedLock lock(_taskMutex);
 	}
 }
 
@@ -265,14 +82,14 @@ void Timer::cancel(bool wait)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+	scheduleTask(pTask, toClock(time), TASK_ONCE, 0);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
+	scheduleTask(pTask, clock, TASK_ONCE, 0);
 }
 
 
@@ -287,14 +104,14 @@ void Timer::schedule(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
+	scheduleTask(pTask, toClock(time), TASK_PERIODIC, interval);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
+	scheduleTask(pTask, clock, TASK_PERIODIC, interval);
 }
 
 
@@ -309,28 +126,30 @@ void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	Poco::Timestamp tsNow;
-	Poco::Clock clock;
-	Poco::Timestamp::TimeDiff diff = time - tsNow;
-	clock += diff;
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	scheduleTask(pTask, toClock(time), TASK_FIXED_RATE, interval);
 }
 
 
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	scheduleTask(pTask, clock, TASK_FIXED_RATE, interval);
 }
 
 
 void Timer::run()
 {
-	bool cont = true;
-	while (cont)
+	while (!_stopped)
 	{
-		Poco::AutoPtr<TimerNotification> pNf = static_cast<TimerNotification*>(_queue.waitDequeueNotification());
-		cont = pNf->execute();
+		Poco::Timespan timeout = _wheel.nextTimeout(MAX_SLEEP);
+		if (timeout > 0)
+		{
+			_wakeUp.tryWait(static_cast<long>(timeout.totalMilliseconds()));
+		}
+		if (_stopped) break;
+
+		FastMutex::ScopedLock lock(_taskMutex);
+		_wheel.advance();
 	}
 }
 
@@ -344,4 +163,72 @@ void Timer::validateTask(const TimerTask::Ptr& pTask)
 }
 
 
+void Timer::scheduleTask(TimerTask::Ptr pTask, Poco::Clock clock, TaskMode mode, long interval)
+{
+	FastMutex::ScopedLock lock(_mutex);
+	Poco::UInt64 generation = _generation;
+	_wheel.schedule(clock, [this, pTask, clock, mode, interval, generation]()
+		{
+			runTask(pTask, clock, mode, interval, generation);
+		});
+}
+
+
+void Timer::runTask(TimerTask::Ptr pTask, Poco::Clock clock, TaskMode mode, long interval, Poco::UInt64 generation)
+{
+	{
+		// the task may have been taken from the wheel before cancel() cleared it
+		FastMutex::ScopedLock lock(_mutex);
+		if (generation != _generation) return;
+	}
+
+	if (!pTask->isCancelled())
+	{
+		try
+		{
+			pTask->updateLastExecution();
+			pTask->run();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+
+	if (mode != TASK_ONCE && !pTask->isCancelled())
+	{
+		Poco::Clock now;
+		Poco::Clock nextExecution(mode == TASK_FIXED_RATE ? clock : now);
+		nextExecution += static_cast<Poco::Clock::ClockDiff>(interval)*1000;
+		if (nextExecution < now) nextExecution = now;
+
+		FastMutex::ScopedLock lock(_mutex);
+		if (generation == _generation && !_stopped)
+		{
+			_wheel.schedule(nextExecution, [this, pTask, nextExecution, mode, interval, generation]()
+				{
+					runTask(pTask, nextExecution, mode, interval, generation);
+				});
+		}
+	}
+}
+
+
+Poco::Clock Timer::toClock(const Poco::Timestamp& time)
+{
+	Poco::Timestamp tsNow;
+	Poco::Clock clock;
+	clock += time - tsNow;
+	return clock;
+}
+
+
 } // namespace Poco::Util